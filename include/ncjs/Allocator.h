@@ -0,0 +1,84 @@
+/***************************************************************
+ * Name:      Allocator.h
+ * Purpose:   Defines Node-CEF Allocator Class
+ * Author:    Joshua GPBeta (studiocghibli@gmail.com)
+ * Created:   2016-08-08
+ * Copyright: Studio GPBeta (www.gpbeta.com)
+ * License:
+ **************************************************************/
+ 
+#ifndef NCJS_ALLOCATOR_H
+#define NCJS_ALLOCATOR_H
+
+/// ----------------------------------------------------------------------------
+/// Headers
+/// ----------------------------------------------------------------------------
+
+#include <stddef.h>
+
+namespace ncjs {
+
+/// ----------------------------------------------------------------------------
+/// \class Allocator
+/// Backing memory of native buffers. Small blocks are carved from slabs of
+/// power of two size classes with a free list per slab, larger blocks come
+/// from the system, in anonymous mappings above the map threshold. Every
+/// block remembers where it came from, so it can be freed from any thread
+/// and whatever mode was selected.
+/// ----------------------------------------------------------------------------
+class Allocator {
+public:
+
+    enum Mode {
+        SYSTEM,     // malloc() and free() for every block
+        SLAB,       // size classes up to 64 KB
+        MODE_COUNT
+    };
+
+    struct Stats {
+        size_t blockSize;       // usable bytes of a block, 0 for large blocks
+        unsigned slabs;         // slabs taken from the system
+        unsigned used;          // blocks in use
+        unsigned free;          // cached blocks, ready to be used
+        unsigned mapped;        // blocks in use with their own mapping
+        unsigned highWater;     // peak of used blocks, decays on trimming
+        double allocations;     // since startup
+        double frees;           // since startup
+        double requested;       // bytes asked for by the blocks in use
+        double reserved;        // bytes taken from the system
+    };
+
+    /// Static Functions
+    /// --------------------------------------------------------------
+
+    // thread safe, returns NULL if out of memory,
+    // mapped blocks are always zeroed
+    static void* Allocate(size_t size, bool zeroFill = false);
+    // thread safe, accepts NULL
+    static void Free(void* data);
+
+    static Mode GetMode() { return s_mode; }
+    static const char* GetModeName(Mode mode);
+    // returns MODE_COUNT for unknown names
+    static Mode FindMode(const char* name);
+
+    // system blocks of this size and above are mapped, 0 never maps
+    static size_t GetMapThreshold();
+    static void SetMapThreshold(size_t bytes);
+
+    // size classes, the last one counts the large blocks
+    static unsigned GetClassCount();
+    static void GetStats(unsigned cls, Stats& stats);
+
+    // sets up the size classes on the first call, later calls only switch
+    // the mode for new blocks, blocks are freed where they came from
+    static bool Initialize(Mode mode);
+
+private:
+
+    static Mode s_mode;
+};
+
+} // ncjs
+
+#endif // NCJS_ALLOCATOR_H
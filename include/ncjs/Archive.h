@@ -0,0 +1,65 @@
+/***************************************************************
+ * Name:      Archive.h
+ * Purpose:   Defines Node-CEF Archive Class
+ * Author:    Joshua GPBeta (studiocghibli@gmail.com)
+ * Created:   2016-08-12
+ * Copyright: Studio GPBeta (www.gpbeta.com)
+ * License:
+ **************************************************************/
+ 
+#ifndef NCJS_ARCHIVE_H
+#define NCJS_ARCHIVE_H
+
+/// ----------------------------------------------------------------------------
+/// Headers
+/// ----------------------------------------------------------------------------
+
+#include <stddef.h>
+
+#include <vector>
+
+namespace ncjs {
+
+/// ----------------------------------------------------------------------------
+/// \class Archive
+/// Read-only packs of module files made by tool/ncpk.py. A path going
+/// through a file named *.ncpk, like app.ncpk/node_modules/foo/index.js,
+/// is served from the pack, which is mapped into memory once and kept for
+/// the life of the process. The pack holds a sorted index of its entries,
+/// each entry is stored as it is or compressed as a LZ4 block.
+/// ----------------------------------------------------------------------------
+class Archive {
+public:
+
+    struct Stats {
+        unsigned archives;      // mapped packs
+        double mapped;          // bytes of the mapped packs
+        double reads;
+    };
+
+    /// Static Functions
+    /// --------------------------------------------------------------
+
+    // thread safe, all of them return false if the path doesn't lead into
+    // a pack, otherwise err is 0 or a libuv error code
+
+    // rc is 0 for files, 1 for directories or a libuv error code
+    static bool Stat(const char* path, int& rc, size_t* size = NULL);
+
+    // data points into the mapping for stored files and into buffer for
+    // compressed ones
+    static bool Read(const char* path, const char*& data, size_t& size,
+                     std::vector<char>& buffer, int& err);
+
+    // size is the room of dst on input, at least the one given by Stat(),
+    // and the length of the file on output
+    static bool Read(const char* path, char* dst, size_t& size, int& err);
+
+    static void GetStats(Stats& stats);
+
+    static bool Initialize();
+};
+
+} // ncjs
+
+#endif // NCJS_ARCHIVE_H
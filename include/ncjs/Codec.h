@@ -0,0 +1,92 @@
+/***************************************************************
+ * Name:      Codec.h
+ * Purpose:   Defines Node-CEF Codec Class
+ * Author:    Joshua GPBeta (studiocghibli@gmail.com)
+ * Created:   2016-08-07
+ * Copyright: Studio GPBeta (www.gpbeta.com)
+ * License:
+ **************************************************************/
+ 
+#ifndef NCJS_CODEC_H
+#define NCJS_CODEC_H
+
+/// ----------------------------------------------------------------------------
+/// Headers
+/// ----------------------------------------------------------------------------
+
+#include <stddef.h>
+
+namespace ncjs {
+
+/// ----------------------------------------------------------------------------
+/// \class Codec
+/// Hex, base64 and UTF-8 codecs between binary data and UTF-16 strings,
+/// using SSE2, SSSE3 or AVX2 when the CPU supports them. Every function
+/// writes directly into the memory given by the caller.
+/// ----------------------------------------------------------------------------
+class Codec {
+public:
+
+    typedef unsigned short char16;
+
+    enum Level {
+        SCALAR,
+        SSE2,
+        SSSE3,
+        AVX2,
+        LEVEL_COUNT
+    };
+
+    /// Static Functions
+    /// --------------------------------------------------------------
+
+    // hex
+
+    // writes len * 2 characters
+    static void HexEncode(const char* src, size_t len, char16* dst);
+    // decodes len / 2 bytes, stops at the first invalid pair,
+    // returns the number of bytes written
+    static size_t HexDecode(const char16* src, size_t len, char* dst);
+
+    // base64
+
+    static size_t Base64EncodedSize(size_t len) { return (len + 2) / 3 * 4; }
+    // upper bound of the decoded size, exact for input without whitespaces
+    static size_t Base64DecodedSize(const char16* src, size_t len);
+
+    // writes Base64EncodedSize(len) characters, padded with '='
+    static void Base64Encode(const char* src, size_t len, char16* dst);
+    // accepts both standard and URL-safe alphabets, skips invalid
+    // characters and stops at '=' or after size bytes,
+    // returns the number of bytes written
+    static size_t Base64Decode(const char16* src, size_t len, char* dst, size_t size);
+
+    // UTF-8, lone surrogates and invalid sequences become U+FFFD
+
+    // size of the UTF-8 form, without encoding it
+    static size_t Utf8Length(const char16* src, size_t len);
+    // writes whole characters only, up to size bytes,
+    // returns the number of bytes written
+    static size_t Utf8Encode(const char16* src, size_t len, char* dst, size_t size);
+    // writes at most len characters, returns the number of characters written
+    static size_t Utf8Decode(const char* src, size_t len, char16* dst);
+
+    // implementation
+
+    static Level GetLevel() { return s_level; }
+    static Level GetSupportedLevel();
+    static const char* GetLevelName(Level level);
+    // returns LEVEL_COUNT for unknown names
+    static Level FindLevel(const char* name);
+
+    // uses the best implementation up to max, returns the one in use
+    static Level SetLevel(Level max);
+
+private:
+
+    static Level s_level;
+};
+
+} // ncjs
+
+#endif // NCJS_CODEC_H
@@ -0,0 +1,77 @@
+/***************************************************************
+ * Name:      CompletionQueue.h
+ * Purpose:   Defines Node-CEF Completion Queue Class
+ * Author:    Joshua GPBeta (studiocghibli@gmail.com)
+ * Created:   2016-08-04
+ * Copyright: Studio GPBeta (www.gpbeta.com)
+ * License:
+ **************************************************************/
+ 
+#ifndef NCJS_COMPLETIONQUEUE_H
+#define NCJS_COMPLETIONQUEUE_H
+
+/// ----------------------------------------------------------------------------
+/// Headers
+/// ----------------------------------------------------------------------------
+
+#include <include/cef_v8.h>
+#include <include/base/cef_callback.h>
+
+namespace ncjs {
+
+class Environment;
+
+/// ----------------------------------------------------------------------------
+/// \class CompletionQueue
+/// Delivers completions from the asynchronous loop to the renderer thread.
+/// Completions posted while the renderer is busy are collected and run in
+/// one renderer task, entering each V8 context only once per batch.
+/// ----------------------------------------------------------------------------
+class CompletionQueue {
+
+    friend class Core;
+
+public:
+
+    // called on the renderer thread with the context entered,
+    // env is NULL if the context has been released, the task should
+    // only clean up itself in that case
+    typedef base::Callback<void(Environment*)> Task;
+
+    struct Stats {
+        double batches;     // renderer tasks which ran completions
+        double completions; // completions delivered
+        double entries;     // context entries
+        double fullBatches; // batches flushed due to max batch size
+        unsigned largest;   // largest batch delivered
+        unsigned pending;   // completions waiting for delivery
+    };
+
+    /// Static Functions
+    /// --------------------------------------------------------------
+
+    // thread safe
+    static void Post(const CefRefPtr<CefV8Context>& context, const Task& task);
+
+    static void GetStats(Stats& stats);
+
+    static unsigned GetMaxBatchSize() { return s_maxBatch; }
+    static unsigned GetLatency() { return s_latency; }
+
+private:
+
+    static bool Initialize(unsigned maxBatch, unsigned latency);
+    static void Shutdown();
+
+    static void Flush();
+
+    /// Declarations
+    /// -----------------
+
+    static unsigned s_maxBatch;
+    static unsigned s_latency; // in milliseconds
+};
+
+} // ncjs
+
+#endif // NCJS_COMPLETIONQUEUE_H
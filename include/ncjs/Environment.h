@@ -22,6 +22,7 @@ typedef struct uv_loop_s uv_loop_t;
 namespace ncjs {
 
 class EventLoop;
+class EnvironmentKey;
 
 /// ----------------------------------------------------------------------------
 /// \class Environment
@@ -85,6 +86,21 @@ public:
 
     BufferObjectInfo& GetBufferObjectInfo() { return m_infoBufferObject; }
 
+    // fs.Stats fields shared with JS as a Float64Array, NULL when the stat
+    // bindings should still build fs.Stats objects, see fs.statValues()
+    double* GetStatValues() const { return m_statValues; }
+    const CefRefPtr<CefBase>& GetStatValuesOwner() const { return m_ownerStatValues; }
+    void SetStatValues(const CefRefPtr<CefBase>& owner, double* values)
+    {
+        m_ownerStatValues = owner;
+        m_statValues = values;
+    }
+
+    // the asynchronous loop this environment was assigned to,
+    // all handles and requests of the environment run on it
+    EventLoop& GetAsyncLoop() const { return *m_loopAsync; }
+    unsigned GetAsyncLoopIndex() const;
+
     CefRefPtr<CefV8Value> New(const CefRefPtr<CefV8Value>& obj,
                               const CefV8ValueList& args)
     {
@@ -131,8 +147,11 @@ public:
 #endif
     }
 
-    static EventLoop& GetAsyncLoop() { return s_loopAsync; }
-    static uv_loop_t*  GetSyncLoop() { return s_loopSync; }
+    static uv_loop_t* GetSyncLoop() { return s_loopSync; }
+
+    static unsigned GetAsyncLoopCount() { return s_loopCount; }
+    // number of living environments assigned to the loop
+    static unsigned GetAsyncLoopLoad(unsigned index);
 
     static double GetProcessStartTime() { return s_startTime; }
 
@@ -172,15 +191,18 @@ public:
 private:
 
     typedef std::vector< CefRefPtr<Listener> > ListenerList;
-    typedef std::map< CefRefPtr<CefV8Context>, CefRefPtr<Environment> > EnvMap;
+    typedef std::map< CefV8Context*, CefRefPtr<Environment> > EnvMap;
 
-    static bool Initialize();
+    static bool Initialize(unsigned asyncLoops);
     static void Shutdown();
 
     /// Utilities Functions
     /// --------------------------------------------------------------
 
-    static bool FindEnvironment(const CefRefPtr<CefV8Context>& context, EnvMap::iterator& it);
+    static Environment* FindEnvironment(const CefRefPtr<CefV8Context>& context);
+    static Environment* ScanEnvironment(const CefRefPtr<CefV8Context>& context);
+
+    static EventLoop* AssignAsyncLoop();
 
     /// Constructors & Destructor
     /// --------------------------------------------------------------
@@ -193,18 +215,30 @@ private:
 
     ListenerList m_listener;
 
+    CefRefPtr<CefV8Context> m_context;
+    CefRefPtr<EnvironmentKey> m_key;
+
     BufferObjectInfo m_infoBufferObject;
+
+    CefRefPtr<CefBase> m_ownerStatValues;
+    double* m_statValues;
     
     CefString m_pathExec;
     CefString m_pathPage;
     CefString m_urlFrame;
 
+    EventLoop* m_loopAsync;
+
     static uv_loop_t* s_loopSync;
-    static EventLoop s_loopAsync;
+    static EventLoop* s_loopAsync; // pool of s_loopCount loops
+    static unsigned* s_loopLoad;
+    static unsigned s_loopCount;
+    static unsigned s_loopNext;
 
     static const double s_startTime;
 
     static EnvMap s_map;
+    static Environment* s_last; // environment of the latest lookup
 
     IMPLEMENT_REFCOUNTING(Environment);
 };
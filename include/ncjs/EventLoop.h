@@ -23,6 +23,7 @@ typedef struct uv_loop_s uv_loop_t;
 namespace ncjs {
 
 class EventLoopImpl;
+struct IoRequest;
 
 /// ----------------------------------------------------------------------------
 /// \class EventLoop
@@ -36,6 +37,9 @@ public:
     bool Stop();
 
     bool Queue(const base::Closure& work);
+    // prepared in the io_uring of the loop, submitted once the loop has run
+    // the queued tasks, false if the loop has no ring, use the thread pool
+    bool QueueIo(const IoRequest& req);
 
     uv_loop_t* ToUv() const { return reinterpret_cast<uv_loop_t*>(m_impl); }
 
@@ -0,0 +1,145 @@
+/***************************************************************
+ * Name:      FileWatcher.h
+ * Purpose:   Defines Node-CEF File Watcher Class
+ * Author:    Joshua GPBeta (studiocghibli@gmail.com)
+ * Created:   2016-09-12
+ * Copyright: Studio GPBeta (www.gpbeta.com)
+ * License:
+ **************************************************************/
+ 
+#ifndef NCJS_FILEWATCHER_H
+#define NCJS_FILEWATCHER_H
+
+/// ----------------------------------------------------------------------------
+/// Headers
+/// ----------------------------------------------------------------------------
+
+#include <include/base/cef_macros.h>
+#include <uv.h>
+
+#include <map>
+#include <string>
+#include <vector>
+
+namespace ncjs {
+
+/// ----------------------------------------------------------------------------
+/// \class FileWatcher
+/// The inotify instance of an asynchronous EventLoop, Linux only. All the
+/// fs.watch() of a loop share one inotify descriptor polled by the loop, a
+/// path watched by several listeners takes a single inotify watch, and a
+/// recursive listener gets a watch for every directory below its path,
+/// including those created later. Elsewhere Add() fails with UV_ENOSYS and
+/// the callers use uv_fs_event_t.
+/// ----------------------------------------------------------------------------
+class FileWatcher {
+public:
+
+    class Listener {
+    public:
+
+        // called on the loop thread, events are UV_RENAME and UV_CHANGE,
+        // filename is relative to the watched directory with '/' separators
+        // or the name of the watched file, NULL if the kernel dropped events
+        virtual void OnWatchEvent(const char* filename, int events) = 0;
+
+        // called on the loop thread, the listener gets nothing more
+        virtual void OnWatchError(int err) = 0;
+
+    protected:
+
+        virtual ~Listener() {}
+    };
+
+    /// Static Functions
+    /// --------------------------------------------------------------
+
+    // called on the loop thread, returns 0 or a libuv error code
+    static int Add(uv_loop_t* loop, const std::string& path, bool recursive,
+                   Listener* listener);
+    static void Remove(uv_loop_t* loop, Listener* listener);
+
+private:
+
+    // a directory seen by a listener, prefix is its path relative to the
+    // watched one, empty for the watched path itself
+    struct Subscription {
+        Listener* listener;
+        std::string prefix;
+
+        Subscription(Listener* l, const std::string& p) : listener(l), prefix(p) {}
+    };
+
+    struct Watch {
+        std::string path;
+        std::vector<Subscription> subs;
+    };
+
+    struct Registration {
+        typedef std::map<int, std::string> WdMap;
+        typedef std::map<std::string, int> DirMap;
+
+        std::string path;
+        bool recursive;
+        bool isDir;
+        WdMap wds;      // to the prefix of the subscription
+        DirMap dirs;    // the same by prefix, a subtree is a range of it
+
+        void Drop(int wd)
+        {
+            WdMap::iterator it = wds.find(wd);
+
+            if (it != wds.end()) {
+                dirs.erase(it->second);
+                wds.erase(it);
+            }
+        }
+    };
+
+    typedef std::map<int, Watch> WatchMap;
+    typedef std::map<Listener*, Registration> ListenerMap;
+
+    int AddListener(const std::string& path, bool recursive, Listener* listener);
+    void RemoveListener(Listener* listener);
+
+    int AddWatch(Listener* listener, Registration& reg,
+                 const std::string& path, const std::string& prefix);
+    int AddTree(Listener* listener, Registration& reg,
+                const std::string& path, const std::string& prefix, bool report);
+    void RemoveTree(Listener* listener, Registration& reg, const std::string& prefix);
+    void Unsubscribe(int wd, Listener* listener, const std::string* prefix);
+
+    void Read();
+    void Dispatch(int wd, unsigned mask, const char* name);
+    void Close();
+
+    /// Static Functions
+    /// --------------------------------------------------------------
+
+    static FileWatcher* Get(uv_loop_t* loop, bool create, int& err);
+
+    static void OnPoll(uv_poll_t* handle, int status, int events);
+    static void OnClose(uv_handle_t* handle);
+
+    /// Constructors & Destructor
+    /// --------------------------------------------------------------
+
+    FileWatcher(uv_loop_t* loop, int fd) : m_loop(loop), m_fd(fd) {}
+    ~FileWatcher() {}
+
+    /// Declarations
+    /// -----------------
+
+    uv_poll_t m_poll;
+    uv_loop_t* m_loop;
+    int m_fd;
+
+    WatchMap m_watches;         // by inotify watch descriptor
+    ListenerMap m_listeners;
+
+    DISALLOW_COPY_AND_ASSIGN(FileWatcher);
+};
+
+} // ncjs
+
+#endif // NCJS_FILEWATCHER_H
@@ -18,6 +18,7 @@
 #include "ncjs/UserData.h"
 #include "ncjs/EventLoop.h"
 #include "ncjs/Environment.h"
+#include "ncjs/CompletionQueue.h"
 
 #include <include/base/cef_bind.h>
 
@@ -35,13 +36,15 @@ public:
 
     void OnStart()
     {
-        if (m_active)
+        Environment* env = Environment::Get(m_context);
+
+        if (m_active || !env)
             return;
 
         m_active = true;
 
         // add context released listener
-        Environment::Get(m_context)->AddListener(this);
+        env->AddListener(this);
 
         m_loop.Queue(base::Bind(&HandleWrap::AsyncInit, this));
     }
@@ -54,7 +57,8 @@ public:
         m_active = false;
 
         // remove context released listener
-        Environment::Get(m_context)->RemoveListener(this);
+        if (Environment* env = Environment::Get(m_context))
+            env->RemoveListener(this);
 
         m_loop.Queue(base::Bind(&HandleWrap::AsyncDestroy, this));
     }
@@ -76,26 +80,19 @@ protected:
     // return true if the handle is intialized and started correctly.
     virtual bool AsyncStart(uv_loop_t* loop) = 0;
 
+    // called from the uv loop thread before the started handle is closed
+    virtual void AsyncStop() {}
+
     /// Synchronous Functions
     /// --------------------------------------------------------------
 
     bool IsActive() const { return m_active; }
 
-    Environment* EnterEnvironment() const
+    // thread safe, task will be called on the renderer thread
+    // with the handle's context entered
+    void PostCallback(const CompletionQueue::Task& task) const
     {
-        Environment* env = Environment::Get(m_context);
-
-        if (env)
-            m_context->Enter();
-
-        return env;
-    }
-
-    bool ExitEnvironment(Environment* env) const
-    {
-        NCJS_ASSERT(env);
-
-        return m_context->Exit();
+        CompletionQueue::Post(m_context, task);
     }
 
     const CefRefPtr<CefV8Value>& GetHandle() const { return m_handle; }
@@ -103,9 +100,10 @@ protected:
     bool EnterContext() const { return m_context->Enter(); }
     bool  ExitContext() const { return m_context->Exit(); }
 
-    HandleWrap(const CefRefPtr<CefV8Value>& handle) :
+    // env must be the environment of the current context
+    HandleWrap(Environment& env, const CefRefPtr<CefV8Value>& handle) :
         m_active(false),
-        m_loop(Environment::GetAsyncLoop()),
+        m_loop(env.GetAsyncLoop()),
         m_context(CefV8Context::GetCurrentContext()),
         m_handle(handle) { data = NULL; }
 
@@ -122,6 +120,8 @@ private:
     void AsyncDestroy()
     {
         if (data) {
+            AsyncStop();
+
             B* base = static_cast<B*>(this);
             uv_close(reinterpret_cast<uv_handle_t*>(base), HandleWrap::Delete);
         }
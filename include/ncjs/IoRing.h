@@ -0,0 +1,132 @@
+/***************************************************************
+ * Name:      IoRing.h
+ * Purpose:   Defines Node-CEF IO Ring Class
+ * Author:    Joshua GPBeta (studiocghibli@gmail.com)
+ * Created:   2016-09-02
+ * Copyright: Studio GPBeta (www.gpbeta.com)
+ * License:
+ **************************************************************/
+ 
+#ifndef NCJS_IORING_H
+#define NCJS_IORING_H
+
+/// ----------------------------------------------------------------------------
+/// Headers
+/// ----------------------------------------------------------------------------
+
+#include <include/base/cef_callback.h>
+#include <include/base/cef_macros.h>
+#include <uv.h>
+
+#include <string>
+
+namespace ncjs {
+
+/// ----------------------------------------------------------------------------
+/// \struct IoRequest
+/// A file system request for the io_uring of an asynchronous EventLoop.
+/// ----------------------------------------------------------------------------
+struct IoRequest {
+
+    enum Op { OPEN, CLOSE, READ, WRITE, STAT, LSTAT, FSTAT, FSYNC, FDATASYNC };
+
+    // called on the loop thread, result is >= 0 or a libuv error code
+    typedef base::Callback<void(int)> Callback;
+
+    Op op;
+    int fd;
+    std::string path;
+    int flags;              // OPEN
+    int mode;               // OPEN
+    const uv_buf_t* bufs;   // READ and WRITE, must live until the callback
+    unsigned nbufs;
+    int64_t offset;         // READ and WRITE, -1 for the file position
+    uv_stat_t* stat;        // the stat ops, must live until the callback
+
+    Callback callback;
+
+    static IoRequest Open(const std::string& path, int flags, int mode);
+    static IoRequest Close(int fd);
+    static IoRequest Read(int fd, const uv_buf_t* bufs, unsigned nbufs, int64_t offset);
+    static IoRequest Write(int fd, const uv_buf_t* bufs, unsigned nbufs, int64_t offset);
+    static IoRequest Stat(const std::string& path);
+    static IoRequest LStat(const std::string& path);
+    static IoRequest FStat(int fd);
+    static IoRequest FSync(int fd);
+    static IoRequest FDataSync(int fd);
+
+    IoRequest(Op operation = CLOSE) :
+        op(operation), fd(-1), flags(0), mode(0), bufs(NULL), nbufs(0),
+        offset(-1), stat(NULL) {}
+};
+
+/// ----------------------------------------------------------------------------
+/// \class IoRing
+/// io_uring of an asynchronous EventLoop, Linux only. Requests are prepared
+/// on the loop thread, everything prepared while the loop drains its task
+/// queue goes to the kernel with a single io_uring_enter(), and completions
+/// are reaped on the loop thread too. No ring is created elsewhere, or if
+/// the kernel lacks any of the operations, the thread pool is used then.
+/// ----------------------------------------------------------------------------
+class IoRing {
+
+    friend class Core;
+
+public:
+
+    struct Stats {
+        double requests;    // prepared
+        double completions; // reaped
+        double enters;      // io_uring_enter() calls submitting requests
+        unsigned rings;     // rings created, one per asynchronous loop
+        unsigned entries;   // submission queue size of each ring
+        bool enabled;
+    };
+
+    // loop thread only
+    void Prepare(const IoRequest& req);
+    void Submit();
+
+    /// Static Functions
+    /// --------------------------------------------------------------
+
+    // NULL if rings are disabled or not supported
+    static IoRing* Create(uv_loop_t* loop);
+    // closes the handle of the ring on its loop, the ring is deleted on close
+    static void Destroy(IoRing* ring);
+
+    // the request fits in a ring, otherwise it goes to the thread pool
+    static bool IsSupported(const IoRequest& req);
+
+    // rings are used by new requests, false if no ring could be created
+    static bool IsEnabled();
+    static bool SetEnabled(bool enabled);
+
+    static unsigned GetEntries() { return s_entries; }
+
+    static void GetStats(Stats& stats);
+
+private:
+
+    static bool Initialize(unsigned entries);
+
+    /// Constructors & Destructor
+    /// --------------------------------------------------------------
+
+    IoRing();
+    ~IoRing();
+
+    /// Declarations
+    /// -----------------
+
+    struct Impl;
+    Impl* m_impl;
+
+    static unsigned s_entries; // 0 disables rings
+
+    DISALLOW_COPY_AND_ASSIGN(IoRing);
+};
+
+} // ncjs
+
+#endif // NCJS_IORING_H
@@ -0,0 +1,92 @@
+/***************************************************************
+ * Name:      MappedFile.h
+ * Purpose:   Defines Node-CEF Mapped File Class
+ * Author:    Joshua GPBeta (studiocghibli@gmail.com)
+ * Created:   2016-09-06
+ * Copyright: Studio GPBeta (www.gpbeta.com)
+ * License:
+ **************************************************************/
+ 
+#ifndef NCJS_MAPPEDFILE_H
+#define NCJS_MAPPEDFILE_H
+
+/// ----------------------------------------------------------------------------
+/// Headers
+/// ----------------------------------------------------------------------------
+
+#include <include/cef_base.h>
+
+#include <uv.h>
+
+namespace ncjs {
+
+/// ----------------------------------------------------------------------------
+/// \class MappedFile
+/// A range of a file mapped into memory, the backing store of the Buffers
+/// made by fs.mmap(). Writable mappings are shared with the file, read-only
+/// ones are private copy-on-write, so writing to their Buffers never faults
+/// and never reaches the file. The range is unmapped with the last reference.
+/// ----------------------------------------------------------------------------
+class MappedFile : public CefBase {
+public:
+
+    enum Advice { NORMAL, RANDOM, SEQUENTIAL, WILLNEED, DONTNEED, ADVICE_COUNT };
+
+    // the byte at the offset asked for, not necessarily page aligned
+    char* Data() const { return m_data; }
+    size_t Size() const { return m_size; }
+
+    bool IsWritable() const { return m_writable; }
+    bool IsMapped() const { return m_mapped; }
+
+    // offset and length are relative to Data(), rounded out to whole pages,
+    // both are no-ops once unmapped
+    int Sync(size_t offset, size_t length, bool async);
+    int Advise(size_t offset, size_t length, Advice advice);
+
+    // drops the file and its pages right away, the memory stays reserved and
+    // reads zeros until the last Buffer is gone, on Windows before 10 1803
+    // UV_EBUSY if another thread took the address meanwhile
+    int Unmap();
+
+    /// Static Functions
+    /// --------------------------------------------------------------
+
+    // length 0 maps up to the end of the file, UV_EFBIG if that's more than
+    // maxLength bytes, the range must lie within the file, err is a libuv
+    // error code on failure
+    static CefRefPtr<MappedFile> Map(uv_file fd, int64_t offset, size_t length,
+                                     size_t maxLength, bool writable, int& err);
+
+    // ADVICE_COUNT for unknown names
+    static Advice FindAdvice(const char* name);
+
+private:
+
+    /// Constructors & Destructor
+    /// --------------------------------------------------------------
+
+    MappedFile(char* base, size_t length, size_t delta, bool writable) :
+        m_base(base), m_length(length), m_data(base + delta), m_size(length - delta),
+        m_writable(writable), m_mapped(true), m_reserved(true) {}
+    ~MappedFile();
+
+    /// Declarations
+    /// -----------------
+
+    char* m_base;       // page aligned start of the mapping
+    size_t m_length;    // mapped bytes from m_base
+    char* m_data;
+    size_t m_size;
+
+    const bool m_writable;
+    bool m_mapped;
+    bool m_reserved;    // m_base is still ours once unmapped
+
+    DISALLOW_COPY_AND_ASSIGN(MappedFile);
+    IMPLEMENT_REFCOUNTING(MappedFile);
+};
+
+} // ncjs
+
+#endif // NCJS_MAPPEDFILE_H
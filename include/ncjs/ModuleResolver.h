@@ -0,0 +1,86 @@
+/***************************************************************
+ * Name:      ModuleResolver.h
+ * Purpose:   Defines Node-CEF Module Resolver Class
+ * Author:    Joshua GPBeta (studiocghibli@gmail.com)
+ * Created:   2016-08-11
+ * Copyright: Studio GPBeta (www.gpbeta.com)
+ * License:
+ **************************************************************/
+ 
+#ifndef NCJS_MODULERESOLVER_H
+#define NCJS_MODULERESOLVER_H
+
+/// ----------------------------------------------------------------------------
+/// Headers
+/// ----------------------------------------------------------------------------
+
+#include <string>
+#include <vector>
+
+namespace ncjs {
+
+/// ----------------------------------------------------------------------------
+/// \class ModuleResolver
+/// Module._findPath() in native code. The successful stat() results, the
+/// "main" fields of package.json files and the successful realpath() results
+/// are cached for every context of the process until a watcher or a file
+/// system call of the process reports a change, or the cache is dropped.
+/// A module found through the cache is stat()ed once more, so files removed
+/// by other processes are searched again.
+/// ----------------------------------------------------------------------------
+class ModuleResolver {
+public:
+
+    typedef std::vector<std::string> PathList;
+
+    enum Result {
+        FOUND,
+        NOT_FOUND,
+        FALLBACK    // a package.json Module._findPath() must handle itself
+    };
+
+    struct Stats {
+        double statHits;
+        double statMisses;
+        double packageHits;
+        double packageMisses;
+        double realpathHits;
+        double realpathMisses;
+        unsigned entries;
+        unsigned capacity;
+    };
+
+    /// Static Functions
+    /// --------------------------------------------------------------
+
+    // thread safe, 0 for files, 1 for directories or a libuv error code
+    static int Stat(const std::string& path);
+
+    // thread safe, path must be absolute and normalized, 0 or a libuv error
+    // code, real is left untouched on errors which are not cached
+    static int RealPath(const std::string& path, std::string& real);
+
+    // thread safe, bases are the search paths resolved with the request, one
+    // for each path, index is set to the search path the module was found in,
+    // the filename is not a real path yet
+    static Result Resolve(const PathList& paths, const PathList& bases,
+                          const PathList& exts, bool trailingSlash,
+                          std::string& filename, unsigned& index);
+
+    // thread safe, drops the path and everything below it unless subtree is
+    // false, real paths resolved to them as well, NULL drops every entry,
+    // relative paths are resolved against the working directory
+    static void Invalidate(const char* path, bool subtree = true);
+
+    // the cache is dropped once it holds more entries, 0 disables caching
+    static unsigned GetCapacity();
+    static void SetCapacity(unsigned entries);
+
+    static void GetStats(Stats& stats);
+
+    static bool Initialize(unsigned capacity);
+};
+
+} // ncjs
+
+#endif // NCJS_MODULERESOLVER_H
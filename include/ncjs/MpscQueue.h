@@ -0,0 +1,135 @@
+/***************************************************************
+ * Name:      MpscQueue.h
+ * Purpose:   Defines Node-CEF Lock-free MPSC Queue Class
+ * Author:    Joshua GPBeta (studiocghibli@gmail.com)
+ * Created:   2016-08-02
+ * Copyright: Studio GPBeta (www.gpbeta.com)
+ * License:
+ **************************************************************/
+ 
+#ifndef NCJS_MPSCQUEUE_H
+#define NCJS_MPSCQUEUE_H
+
+/// ----------------------------------------------------------------------------
+/// Headers
+/// ----------------------------------------------------------------------------
+
+#include "ncjs/base.h"
+#include "ncjs/atomic.h"
+
+#include <include/base/cef_macros.h>
+
+namespace ncjs {
+
+/// ----------------------------------------------------------------------------
+/// \class MpscQueue
+/// A bounded multi-producer / single-consumer ring (D. Vyukov's algorithm),
+/// Push() may be called from any thread while Pop() must only be called
+/// from the consumer thread. The capacity must be a power of 2.
+/// ----------------------------------------------------------------------------
+template <class T>
+class MpscQueue {
+public:
+
+    unsigned Capacity() const { return m_mask + 1; }
+
+    // returns false if the ring is full
+    bool Push(const T& value)
+    {
+        Cell* cell;
+        atomic::Word pos = atomic::Load(&m_tail);
+
+        for (;;) {
+            cell = &m_cells[pos & m_mask];
+            const atomic::Word dif = Distance(atomic::Load(&cell->sequence), pos);
+
+            if (dif == 0) {
+                const atomic::Word cur = atomic::CompareExchange(&m_tail, pos, Advance(pos, 1));
+                if (cur == pos)
+                    break; // slot reserved
+                pos = cur;
+            } else if (dif < 0) {
+                return false; // full
+            } else {
+                pos = atomic::Load(&m_tail);
+            }
+        }
+
+        cell->value = value;
+        atomic::Store(&cell->sequence, Advance(pos, 1)); // publish
+
+        return true;
+    }
+
+    // returns false if the ring is empty or the next slot is still being written
+    bool Pop(T& value)
+    {
+        Cell* cell = &m_cells[m_head & m_mask];
+
+        if (Distance(atomic::Load(&cell->sequence), Advance(m_head, 1)) < 0)
+            return false;
+
+        value = cell->value;
+        cell->value = T(); // drop references as early as possible
+        atomic::Store(&cell->sequence, Advance(m_head, m_mask + 1)); // recycle
+        m_head = Advance(m_head, 1);
+
+        return true;
+    }
+
+    // consumer only, true if no slot is published or reserved by producers
+    bool IsIdle() const { return atomic::Load(&m_tail) == m_head; }
+
+    /// Constructors & Destructor
+    /// --------------------------------------------------------------
+
+    explicit MpscQueue(unsigned capacity) :
+        m_cells(new Cell[capacity]), m_mask(capacity - 1), m_tail(0), m_head(0)
+    {
+        NCJS_CHECK(capacity >= 2 && (capacity & m_mask) == 0);
+
+        for (unsigned i = 0; i < capacity; ++i)
+            m_cells[i].sequence = atomic::Word(i);
+    }
+
+    ~MpscQueue() { delete[] m_cells; }
+
+private:
+
+    struct Cell {
+        volatile atomic::Word sequence;
+        T value;
+    };
+
+    // sequence numbers wrap around, so do the arithmetic unsigned
+
+    static atomic::Word Advance(atomic::Word a, unsigned long n)
+    {
+        return atomic::Word(static_cast<unsigned long>(a) + n);
+    }
+
+    static atomic::Word Distance(atomic::Word a, atomic::Word b)
+    {
+        return atomic::Word(static_cast<unsigned long>(a) - static_cast<unsigned long>(b));
+    }
+
+    /// Declarations
+    /// -----------------
+
+    enum { CACHE_LINE = 64 };
+
+    Cell* const m_cells;
+    const atomic::Word m_mask;
+
+    // keep producers and consumer on their own cache lines
+    char m_pad0[CACHE_LINE];
+    volatile atomic::Word m_tail;
+    char m_pad1[CACHE_LINE];
+    atomic::Word m_head;
+
+    DISALLOW_COPY_AND_ASSIGN(MpscQueue);
+};
+
+} // ncjs
+
+#endif // NCJS_MPSCQUEUE_H
@@ -0,0 +1,59 @@
+/***************************************************************
+ * Name:      SourceCache.h
+ * Purpose:   Defines Node-CEF Source Cache Class
+ * Author:    Joshua GPBeta (studiocghibli@gmail.com)
+ * Created:   2016-08-10
+ * Copyright: Studio GPBeta (www.gpbeta.com)
+ * License:
+ **************************************************************/
+ 
+#ifndef NCJS_SOURCECACHE_H
+#define NCJS_SOURCECACHE_H
+
+/// ----------------------------------------------------------------------------
+/// Headers
+/// ----------------------------------------------------------------------------
+
+#include <include/internal/cef_string.h>
+
+namespace ncjs {
+
+/// ----------------------------------------------------------------------------
+/// \class SourceCache
+/// Decoded text of module files, shared by every environment of the process.
+/// An entry is keyed by path and only used while the modification time and
+/// the size of the file stay the same, so a hit costs a single stat().
+/// ----------------------------------------------------------------------------
+class SourceCache {
+public:
+
+    struct Stats {
+        double hits;
+        double misses;
+        unsigned entries;
+        double bytes;           // text held by the entries
+        double capacity;
+    };
+
+    /// Static Functions
+    /// --------------------------------------------------------------
+
+    // thread safe, reads the whole file as UTF-8 without BOM,
+    // returns 0 or a libuv error code
+    static int Read(const char* path, CefString& text);
+
+    // thread safe, NULL drops every entry
+    static void Invalidate(const char* path);
+
+    // least recently used entries are dropped above it, 0 disables caching
+    static size_t GetCapacity();
+    static void SetCapacity(size_t bytes);
+
+    static void GetStats(Stats& stats);
+
+    static bool Initialize(size_t capacity);
+};
+
+} // ncjs
+
+#endif // NCJS_SOURCECACHE_H
@@ -0,0 +1,138 @@
+/***************************************************************
+ * Name:      StatPoller.h
+ * Purpose:   Defines Node-CEF Stat Poller Class
+ * Author:    Joshua GPBeta (studiocghibli@gmail.com)
+ * Created:   2016-09-14
+ * Copyright: Studio GPBeta (www.gpbeta.com)
+ * License:
+ **************************************************************/
+ 
+#ifndef NCJS_STATPOLLER_H
+#define NCJS_STATPOLLER_H
+
+/// ----------------------------------------------------------------------------
+/// Headers
+/// ----------------------------------------------------------------------------
+
+#include <include/base/cef_macros.h>
+#include <uv.h>
+
+#include <map>
+#include <string>
+#include <vector>
+
+namespace ncjs {
+
+/// ----------------------------------------------------------------------------
+/// \class StatPoller
+/// Polls the stat() of paths for all the fs.watchFile() of an asynchronous
+/// EventLoop with one timer. Paths are kept in a wheel of ticks, those due
+/// at the same tick are stat'ed together by a few jobs on the METADATA
+/// queue of ThreadPool, and the results are compared on the loop thread as
+/// uv_fs_poll_t does, so only the paths which changed are reported.
+/// ----------------------------------------------------------------------------
+class StatPoller {
+public:
+
+    class Listener {
+    public:
+
+        // called on the loop thread, status is 0 or the libuv error of the
+        // last stat(), curr is zeroed on errors, as uv_fs_poll_cb
+        virtual void OnStatChange(int status, const uv_stat_t& prev,
+                                  const uv_stat_t& curr) = 0;
+
+    protected:
+
+        virtual ~Listener() {}
+    };
+
+    /// Static Functions
+    /// --------------------------------------------------------------
+
+    // called on the loop thread, the interval is in ms and rounded up to
+    // whole ticks, the first stat() is made on the next tick
+    static void Add(uv_loop_t* loop, const std::string& path, unsigned interval,
+                    Listener* listener);
+    static void Remove(uv_loop_t* loop, Listener* listener);
+
+private:
+
+    // ms, the resolution of the intervals
+    enum { TICK = 50, WHEEL_SIZE = 256, STATS_PER_JOB = 64 };
+
+    struct Entry {
+        Listener* listener;
+        std::string path;
+        uint64_t interval;  // ticks
+        uint64_t due;       // tick of the next stat()
+        int busy;           // 0 before the first stat(), 1 after a good one, an error
+        uv_stat_t stat;     // of the last good stat()
+        bool pending;       // in a job
+        bool removed;       // while pending
+    };
+
+    struct Job {
+        StatPoller* poller;
+        std::vector<Entry*> entries;
+        std::vector<int> errors;
+        std::vector<uv_stat_t> stats;
+    };
+
+    typedef std::vector<Entry*> Slot;
+    typedef std::map<Listener*, Entry*> EntryMap;
+
+    void Schedule(Entry* entry);
+    void Unschedule(Entry* entry);
+    void Arm();
+    void Tick();
+    void Done(Job* job);
+    void Complete(Job* job);
+    void CloseIfIdle();
+
+    uint64_t Now() const;
+
+    /// Static Functions
+    /// --------------------------------------------------------------
+
+    static StatPoller* Get(uv_loop_t* loop, bool create);
+
+    static void Run(Job* job);
+
+    static void OnTimer(uv_timer_t* handle);
+    static void OnAsync(uv_async_t* handle);
+    static void OnCloseTimer(uv_handle_t* handle);
+    static void OnClose(uv_handle_t* handle);
+
+    static bool IsEqual(const uv_stat_t& a, const uv_stat_t& b);
+
+    /// Constructors & Destructor
+    /// --------------------------------------------------------------
+
+    StatPoller(uv_loop_t* loop);
+    ~StatPoller();
+
+    /// Declarations
+    /// -----------------
+
+    uv_timer_t m_timer;
+    uv_async_t m_async;         // the jobs done
+    uv_loop_t* m_loop;
+
+    uv_mutex_t m_mutex;         // guards m_done only
+    std::vector<Job*> m_done;
+
+    const uint64_t m_origin;    // uv_now() of tick 0
+    uint64_t m_tick;            // the last one run
+
+    Slot m_wheel[WHEEL_SIZE];   // by due tick modulo WHEEL_SIZE
+    EntryMap m_entries;
+    unsigned m_scheduled;       // entries in the wheel
+    unsigned m_jobs;            // running
+
+    DISALLOW_COPY_AND_ASSIGN(StatPoller);
+};
+
+} // ncjs
+
+#endif // NCJS_STATPOLLER_H
@@ -0,0 +1,67 @@
+/***************************************************************
+ * Name:      ThreadPool.h
+ * Purpose:   Defines Node-CEF Thread Pool Class
+ * Author:    Joshua GPBeta (studiocghibli@gmail.com)
+ * Created:   2016-08-05
+ * Copyright: Studio GPBeta (www.gpbeta.com)
+ * License:
+ **************************************************************/
+ 
+#ifndef NCJS_THREADPOOL_H
+#define NCJS_THREADPOOL_H
+
+/// ----------------------------------------------------------------------------
+/// Headers
+/// ----------------------------------------------------------------------------
+
+#include <include/base/cef_callback_forward.h>
+
+namespace ncjs {
+
+/// ----------------------------------------------------------------------------
+/// \class ThreadPool
+/// Runs blocking file system work. Every class of work has its own queue
+/// and workers, so a slow fsync() never holds back a read() queued after it.
+/// ----------------------------------------------------------------------------
+class ThreadPool {
+
+    friend class Core;
+
+public:
+
+    enum Class {
+        METADATA,   // stat, readdir, access, open, ...
+        DATA,       // read, write
+        SLOW,       // fsync, rename, ...
+        CLASS_COUNT
+    };
+
+    struct Stats {
+        unsigned threads;   // workers of the class
+        unsigned pending;   // queued, not started yet
+        unsigned running;   // being run by workers
+        double completed;   // finished since startup
+    };
+
+    /// Static Functions
+    /// --------------------------------------------------------------
+
+    // thread safe, returns false if the pool has been shut down
+    static bool Queue(Class cls, const base::Closure& work);
+
+    static void GetStats(Class cls, Stats& stats);
+
+    static const char* GetClassName(Class cls);
+    static unsigned GetDefaultThreads(Class cls);
+
+private:
+
+    static bool Initialize(const unsigned (&threads)[CLASS_COUNT]);
+    static void Shutdown();
+
+    static void Worker(void* arg);
+};
+
+} // ncjs
+
+#endif // NCJS_THREADPOOL_H
@@ -21,7 +21,7 @@ namespace ncjs {
 
 namespace USER_DATA {
 
-enum { UNKNOWN, BUFFER, FS_EVENT_WRAP, STAT_WATCHER_WRAP, CUSTOM = 0x1000 };
+enum { UNKNOWN, BUFFER, FS_EVENT_WRAP, STAT_WATCHER_WRAP, ENVIRONMENT, CUSTOM = 0x1000 };
 
 typedef int TYPE;
 
@@ -0,0 +1,95 @@
+/***************************************************************
+ * Name:      atomic.h
+ * Purpose:   Defines Node-CEF Atomic Operations
+ * Author:    Joshua GPBeta (studiocghibli@gmail.com)
+ * Created:   2016-08-02
+ * Copyright: Studio GPBeta (www.gpbeta.com)
+ * License:
+ **************************************************************/
+ 
+#ifndef NCJS_ATOMIC_H
+#define NCJS_ATOMIC_H
+
+/// ----------------------------------------------------------------------------
+/// Headers
+/// ----------------------------------------------------------------------------
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#pragma intrinsic(_InterlockedCompareExchange)
+#pragma intrinsic(_InterlockedExchange)
+#pragma intrinsic(_InterlockedExchangeAdd)
+#pragma intrinsic(_ReadWriteBarrier)
+#endif // _MSC_VER
+
+namespace ncjs {
+
+namespace atomic {
+
+// All operations work on naturally aligned 32-bit words (long on Windows),
+// Load() has acquire semantics, Store() has release semantics and the
+// read-modify-write operations are full barriers.
+
+typedef long Word;
+
+static inline Word Load(const volatile Word* ptr)
+{
+#ifdef _MSC_VER
+    const Word value = *ptr; // volatile read is an acquire on MSVC
+    _ReadWriteBarrier();
+    return value;
+#else
+    return __atomic_load_n(ptr, __ATOMIC_ACQUIRE);
+#endif
+}
+
+static inline void Store(volatile Word* ptr, Word value)
+{
+#ifdef _MSC_VER
+    _ReadWriteBarrier();
+    *ptr = value; // volatile write is a release on MSVC
+#else
+    __atomic_store_n(ptr, value, __ATOMIC_RELEASE);
+#endif
+}
+
+// returns the previous value
+static inline Word Exchange(volatile Word* ptr, Word value)
+{
+#ifdef _MSC_VER
+    return _InterlockedExchange(ptr, value);
+#else
+    return __atomic_exchange_n(ptr, value, __ATOMIC_SEQ_CST);
+#endif
+}
+
+// returns the previous value, swapped if it equals to expected
+static inline Word CompareExchange(volatile Word* ptr, Word expected, Word value)
+{
+#ifdef _MSC_VER
+    return _InterlockedCompareExchange(ptr, value, expected);
+#else
+    __atomic_compare_exchange_n(ptr, &expected, value, false,
+                                __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+    return expected;
+#endif
+}
+
+// returns the new value
+static inline Word Add(volatile Word* ptr, Word value)
+{
+#ifdef _MSC_VER
+    return _InterlockedExchangeAdd(ptr, value) + value;
+#else
+    return __atomic_add_fetch(ptr, value, __ATOMIC_SEQ_CST);
+#endif
+}
+
+static inline Word Increment(volatile Word* ptr) { return Add(ptr, 1); }
+static inline Word Decrement(volatile Word* ptr) { return Add(ptr, -1); }
+
+} // atomic
+
+} // ncjs
+
+#endif // NCJS_ATOMIC_H
@@ -66,7 +66,10 @@ _NCJS_CONST_DECLARE_CEFSTR(str_module_load_list, "moduleLoadList");
 _NCJS_CONST_DECLARE_CEFSTR(str_netmask, "netmask");
 _NCJS_CONST_DECLARE_CEFSTR(str_nice, "nice");
 _NCJS_CONST_DECLARE_CEFSTR(str_onchange, "onchange");
+_NCJS_CONST_DECLARE_CEFSTR(str_onchanges, "onchanges");
 _NCJS_CONST_DECLARE_CEFSTR(str_oncomplete, "oncomplete");
+_NCJS_CONST_DECLARE_CEFSTR(str_onentries, "onentries");
+_NCJS_CONST_DECLARE_CEFSTR(str_onprogress, "onprogress");
 _NCJS_CONST_DECLARE_CEFSTR(str_onstop, "onstop");
 _NCJS_CONST_DECLARE_CEFSTR(str_prototype, "prototype");
 _NCJS_CONST_DECLARE_CEFSTR(str_rename, "rename");
@@ -16,6 +16,15 @@
 /// ----------------------------------------------------------------------------
 
 #include "ncjs/UserData.h"
+#include "ncjs/Allocator.h"
+#include "ncjs/MappedFile.h"
+
+#include <include/cef_version.h>
+
+// CefV8Value::CreateArrayBuffer() is available since CEF 3.2840
+#if CHROME_VERSION_MAJOR >= 54
+#define NCJS_BUFFER_VIEW
+#endif
 
 namespace ncjs {
 
@@ -41,6 +50,14 @@ public:
     }
 
     Buffer* SubBuffer(size_t offset, size_t size) const;
+    // the file mapping behind the buffer or its parents, NULL if none
+    MappedFile* GetMapping() const
+    {
+        const Buffer* root = this;
+        while (root->m_owner.get())
+            root = root->m_owner.get();
+        return root->m_mapping.get();
+    }
     int SubSearch(Buffer* sub, size_t offset, bool ucs2) const;
 
     /// Static Functions
@@ -65,16 +82,30 @@ public:
     static Buffer* Create(size_t size); // despise buffer object flags
     static Buffer* Create(const CefString& str, int encoding);
     static Buffer* Create(const CefString& str, const CefString& encoding);
+    // takes over data from Allocator::Allocate(), thread safe
+    static Buffer* Adopt(char* data, size_t size);
+    // the whole mapping, unmapped once the buffer and its slices are gone
+    static Buffer* Adopt(const CefRefPtr<MappedFile>& mapping);
+
+    // new buffer object for JS, undefined if buffer is NULL
+    static CefRefPtr<CefV8Value> NewObject(Buffer* buffer);
+#ifdef NCJS_BUFFER_VIEW
+    // ArrayBuffer sharing memory with the buffer, keeps it alive until collected
+    static CefRefPtr<CefV8Value> NewArrayBuffer(Buffer* buffer);
+#endif
 private:
 
     Buffer(char* buffer, size_t size, const Buffer* owner = NULL) :
        m_owner(owner), m_buffer(buffer), m_size(size) {}
-    ~Buffer() { if (NULL == m_owner.get()) free(m_buffer); }
+    explicit Buffer(const CefRefPtr<MappedFile>& mapping) :
+       m_mapping(mapping), m_buffer(mapping->Data()), m_size(mapping->Size()) {}
+    ~Buffer() { if (NULL == m_owner.get() && NULL == m_mapping.get()) Allocator::Free(m_buffer); }
     
     /// Declarations
     /// -----------------
 
     CefRefPtr<const Buffer> m_owner;
+    CefRefPtr<MappedFile> m_mapping;
 
     char* m_buffer;
     size_t m_size;
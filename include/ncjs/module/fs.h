@@ -25,7 +25,18 @@ class Environment;
 
 typedef void UvState;
 
-CefRefPtr<CefV8Value> BuildStatsObject(Environment& env, const UvState* stat);
+// fields of a fs.Stats in the order of its constructor arguments, and the
+// number of fs.Stats the values shared by fs.statValues() can hold
+enum { STATS_FIELDS = 14, STATS_SLOTS = 2 };
+
+// flags of fs.copyFile(), the values of later Node.js versions
+enum { COPYFILE_EXCL = 1, COPYFILE_FICLONE = 2, COPYFILE_FICLONE_FORCE = 4 };
+
+// writes the fields to the shared values at slot and returns undefined if
+// shared is true and the environment shares them with JS, otherwise a new
+// fs.Stats object
+CefRefPtr<CefV8Value> BuildStatsObject(Environment& env, const UvState* stat, int slot = 0,
+                                       bool shared = false);
 
 } // ncjs
 
@@ -9,15 +9,15 @@ namespace natives {
 
   const cef_char_t assert_native[] = { 47, 47, 32, 104, 116, 116, 112, 58, 47, 47, 119, 105, 107, 105, 46, 99, 111, 109, 109, 111, 110, 106, 115, 46, 111, 114, 103, 47, 119, 105, 107, 105, 47, 85, 110, 105, 116, 95, 84, 101, 115, 116, 105, 110, 103, 47, 49, 46, 48, 10, 47, 47, 10, 47, 47, 32, 84, 72, 73, 83, 32, 73, 83, 32, 78, 79, 84, 32, 84, 69, 83, 84, 69, 68, 32, 78, 79, 82, 32, 76, 73, 75, 69, 76, 89, 32, 84, 79, 32, 87, 79, 82, 75, 32, 79, 85, 84, 83, 73, 68, 69, 32, 86, 56, 33, 10, 47, 47, 10, 47, 47, 32, 79, 114, 105, 103, 105, 110, 97, 108, 108, 121, 32, 102, 114, 111, 109, 32, 110, 97, 114, 119, 104, 97, 108, 46, 106, 115, 32, 40, 104, 116, 116, 112, 58, 47, 47, 110, 97, 114, 119, 104, 97, 108, 106, 115, 46, 111, 114, 103, 41, 10, 47, 47, 32, 67, 111, 112, 121, 114, 105, 103, 104, 116, 32, 40, 99, 41, 32, 50, 48, 48, 57, 32, 84, 104, 111, 109, 97, 115, 32, 82, 111, 98, 105, 110, 115, 111, 110, 32, 60, 50, 56, 48, 110, 111, 114, 116, 104, 46, 99, 111, 109, 62, 10, 47, 47, 10, 47, 47, 32, 80, 101, 114, 109, 105, 115, 115, 105, 111, 110, 32, 105, 115, 32, 104, 101, 114, 101, 98, 121, 32, 103, 114, 97, 110, 116, 101, 100, 44, 32, 102, 114, 101, 101, 32, 111, 102, 32, 99, 104, 97, 114, 103, 101, 44, 32, 116, 111, 32, 97, 110, 121, 32, 112, 101, 114, 115, 111, 110, 32, 111, 98, 116, 97, 105, 110, 105, 110, 103, 32, 97, 32, 99, 111, 112, 121, 10, 47, 47, 32, 111, 102, 32, 116, 104, 105, 115, 32, 115, 111, 102, 116, 119, 97, 114, 101, 32, 97, 110, 100, 32, 97, 115, 115, 111, 99, 105, 97, 116, 101, 100, 32, 100, 111, 99, 117, 109, 101, 110, 116, 97, 116, 105, 111, 110, 32, 102, 105, 108, 101, 115, 32, 40, 116, 104, 101, 32, 39, 83, 111, 102, 116, 119, 97, 114, 101, 39, 41, 44, 32, 116, 111, 10, 47, 47, 32, 100, 101, 97, 108, 32, 105, 110, 32, 116, 104, 101, 32, 83, 111, 102, 116, 119, 97, 114, 101, 32, 119, 105, 116, 104, 111, 117, 116, 32, 114, 101, 115, 116, 114, 105, 99, 116, 105, 111, 110, 44, 32, 105, 110, 99, 108, 117, 100, 105, 110, 103, 32, 119, 105, 116, 104, 111, 117, 116, 32, 108, 105, 109, 105, 116, 97, 116, 105, 111, 110, 32, 116, 104, 101, 10, 47, 47, 32, 114, 105, 103, 104, 116, 115, 32, 116, 111, 32, 117, 115, 101, 44, 32, 99, 111, 112, 121, 44, 32, 109, 111, 100, 105, 102, 121, 44, 32, 109, 101, 114, 103, 101, 44, 32, 112, 117, 98, 108, 105, 115, 104, 44, 32, 100, 105, 115, 116, 114, 105, 98, 117, 116, 101, 44, 32, 115, 117, 98, 108, 105, 99, 101, 110, 115, 101, 44, 32, 97, 110, 100, 47, 111, 114, 10, 47, 47, 32, 115, 101, 108, 108, 32, 99, 111, 112, 105, 101, 115, 32, 111, 102, 32, 116, 104, 101, 32, 83, 111, 102, 116, 119, 97, 114, 101, 44, 32, 97, 110, 100, 32, 116, 111, 32, 112, 101, 114, 109, 105, 116, 32, 112, 101, 114, 115, 111, 110, 115, 32, 116, 111, 32, 119, 104, 111, 109, 32, 116, 104, 101, 32, 83, 111, 102, 116, 119, 97, 114, 101, 32, 105, 115, 10, 47, 47, 32, 102, 117, 114, 110, 105, 115, 104, 101, 100, 32, 116, 111, 32, 100, 111, 32, 115, 111, 44, 32, 115, 117, 98, 106, 101, 99, 116, 32, 116, 111, 32, 116, 104, 101, 32, 102, 111, 108, 108, 111, 119, 105, 110, 103, 32, 99, 111, 110, 100, 105, 116, 105, 111, 110, 115, 58, 10, 47, 47, 10, 47, 47, 32, 84, 104, 101, 32, 97, 98, 111, 118, 101, 32, 99, 111, 112, 121, 114, 105, 103, 104, 116, 32, 110, 111, 116, 105, 99, 101, 32, 97, 110, 100, 32, 116, 104, 105, 115, 32, 112, 101, 114, 109, 105, 115, 115, 105, 111, 110, 32, 110, 111, 116, 105, 99, 101, 32, 115, 104, 97, 108, 108, 32, 98, 101, 32, 105, 110, 99, 108, 117, 100, 101, 100, 32, 105, 110, 10, 47, 47, 32, 97, 108, 108, 32, 99, 111, 112, 105, 101, 115, 32, 111, 114, 32, 115, 117, 98, 115, 116, 97, 110, 116, 105, 97, 108, 32, 112, 111, 114, 116, 105, 111, 110, 115, 32, 111, 102, 32, 116, 104, 101, 32, 83, 111, 102, 116, 119, 97, 114, 101, 46, 10, 47, 47, 10, 47, 47, 32, 84, 72, 69, 32, 83, 79, 70, 84, 87, 65, 82, 69, 32, 73, 83, 32, 80, 82, 79, 86, 73, 68, 69, 68, 32, 39, 65, 83, 32, 73, 83, 39, 44, 32, 87, 73, 84, 72, 79, 85, 84, 32, 87, 65, 82, 82, 65, 78, 84, 89, 32, 79, 70, 32, 65, 78, 89, 32, 75, 73, 78, 68, 44, 32, 69, 88, 80, 82, 69, 83, 83, 32, 79, 82, 10, 47, 47, 32, 73, 77, 80, 76, 73, 69, 68, 44, 32, 73, 78, 67, 76, 85, 68, 73, 78, 71, 32, 66, 85, 84, 32, 78, 79, 84, 32, 76, 73, 77, 73, 84, 69, 68, 32, 84, 79, 32, 84, 72, 69, 32, 87, 65, 82, 82, 65, 78, 84, 73, 69, 83, 32, 79, 70, 32, 77, 69, 82, 67, 72, 65, 78, 84, 65, 66, 73, 76, 73, 84, 89, 44, 10, 47, 47, 32, 70, 73, 84, 78, 69, 83, 83, 32, 70, 79, 82, 32, 65, 32, 80, 65, 82, 84, 73, 67, 85, 76, 65, 82, 32, 80, 85, 82, 80, 79, 83, 69, 32, 65, 78, 68, 32, 78, 79, 78, 73, 78, 70, 82, 73, 78, 71, 69, 77, 69, 78, 84, 46, 32, 73, 78, 32, 78, 79, 32, 69, 86, 69, 78, 84, 32, 83, 72, 65, 76, 76, 32, 84, 72, 69, 10, 47, 47, 32, 65, 85, 84, 72, 79, 82, 83, 32, 66, 69, 32, 76, 73, 65, 66, 76, 69, 32, 70, 79, 82, 32, 65, 78, 89, 32, 67, 76, 65, 73, 77, 44, 32, 68, 65, 77, 65, 71, 69, 83, 32, 79, 82, 32, 79, 84, 72, 69, 82, 32, 76, 73, 65, 66, 73, 76, 73, 84, 89, 44, 32, 87, 72, 69, 84, 72, 69, 82, 32, 73, 78, 32, 65, 78, 10, 47, 47, 32, 65, 67, 84, 73, 79, 78, 32, 79, 70, 32, 67, 79, 78, 84, 82, 65, 67, 84, 44, 32, 84, 79, 82, 84, 32, 79, 82, 32, 79, 84, 72, 69, 82, 87, 73, 83, 69, 44, 32, 65, 82, 73, 83, 73, 78, 71, 32, 70, 82, 79, 77, 44, 32, 79, 85, 84, 32, 79, 70, 32, 79, 82, 32, 73, 78, 32, 67, 79, 78, 78, 69, 67, 84, 73, 79, 78, 10, 47, 47, 32, 87, 73, 84, 72, 32, 84, 72, 69, 32, 83, 79, 70, 84, 87, 65, 82, 69, 32, 79, 82, 32, 84, 72, 69, 32, 85, 83, 69, 32, 79, 82, 32, 79, 84, 72, 69, 82, 32, 68, 69, 65, 76, 73, 78, 71, 83, 32, 73, 78, 32, 84, 72, 69, 32, 83, 79, 70, 84, 87, 65, 82, 69, 46, 10, 10, 39, 117, 115, 101, 32, 115, 116, 114, 105, 99, 116, 39, 59, 10, 10, 47, 47, 32, 85, 84, 73, 76, 73, 84, 89, 10, 99, 111, 110, 115, 116, 32, 99, 111, 109, 112, 97, 114, 101, 32, 61, 32, 112, 114, 111, 99, 101, 115, 115, 46, 98, 105, 110, 100, 105, 110, 103, 40, 39, 98, 117, 102, 102, 101, 114, 39, 41, 46, 99, 111, 109, 112, 97, 114, 101, 59, 10, 99, 111, 110, 115, 116, 32, 117, 116, 105, 108, 32, 61, 32, 114, 101, 113, 117, 105, 114, 101, 40, 39, 117, 116, 105, 108, 39, 41, 59, 10, 99, 111, 110, 115, 116, 32, 66, 117, 102, 102, 101, 114, 32, 61, 32, 114, 101, 113, 117, 105, 114, 101, 40, 39, 98, 117, 102, 102, 101, 114, 39, 41, 46, 66, 117, 102, 102, 101, 114, 59, 10, 99, 111, 110, 115, 116, 32, 112, 83, 108, 105, 99, 101, 32, 61, 32, 65, 114, 114, 97, 121, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 115, 108, 105, 99, 101, 59, 10, 10, 47, 47, 32, 49, 46, 32, 84, 104, 101, 32, 97, 115, 115, 101, 114, 116, 32, 109, 111, 100, 117, 108, 101, 32, 112, 114, 111, 118, 105, 100, 101, 115, 32, 102, 117, 110, 99, 116, 105, 111, 110, 115, 32, 116, 104, 97, 116, 32, 116, 104, 114, 111, 119, 10, 47, 47, 32, 65, 115, 115, 101, 114, 116, 105, 111, 110, 69, 114, 114, 111, 114, 39, 115, 32, 119, 104, 101, 110, 32, 112, 97, 114, 116, 105, 99, 117, 108, 97, 114, 32, 99, 111, 110, 100, 105, 116, 105, 111, 110, 115, 32, 97, 114, 101, 32, 110, 111, 116, 32, 109, 101, 116, 46, 32, 84, 104, 101, 10, 47, 47, 32, 97, 115, 115, 101, 114, 116, 32, 109, 111, 100, 117, 108, 101, 32, 109, 117, 115, 116, 32, 99, 111, 110, 102, 111, 114, 109, 32, 116, 111, 32, 116, 104, 101, 32, 102, 111, 108, 108, 111, 119, 105, 110, 103, 32, 105, 110, 116, 101, 114, 102, 97, 99, 101, 46, 10, 10, 99, 111, 110, 115, 116, 32, 97, 115, 115, 101, 114, 116, 32, 61, 32, 109, 111, 100, 117, 108, 101, 46, 101, 120, 112, 111, 114, 116, 115, 32, 61, 32, 111, 107, 59, 10, 10, 47, 47, 32, 50, 46, 32, 84, 104, 101, 32, 65, 115, 115, 101, 114, 116, 105, 111, 110, 69, 114, 114, 111, 114, 32, 105, 115, 32, 100, 101, 102, 105, 110, 101, 100, 32, 105, 110, 32, 97, 115, 115, 101, 114, 116, 46, 10, 47, 47, 32, 110, 101, 119, 32, 97, 115, 115, 101, 114, 116, 46, 65, 115, 115, 101, 114, 116, 105, 111, 110, 69, 114, 114, 111, 114, 40, 123, 32, 109, 101, 115, 115, 97, 103, 101, 58, 32, 109, 101, 115, 115, 97, 103, 101, 44, 10, 47, 47, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 97, 99, 116, 117, 97, 108, 58, 32, 97, 99, 116, 117, 97, 108, 44, 10, 47, 47, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 101, 120, 112, 101, 99, 116, 101, 100, 58, 32, 101, 120, 112, 101, 99, 116, 101, 100, 32, 125, 41, 10, 10, 97, 115, 115, 101, 114, 116, 46, 65, 115, 115, 101, 114, 116, 105, 111, 110, 69, 114, 114, 111, 114, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 32, 65, 115, 115, 101, 114, 116, 105, 111, 110, 69, 114, 114, 111, 114, 40, 111, 112, 116, 105, 111, 110, 115, 41, 32, 123, 10, 32, 32, 116, 104, 105, 115, 46, 110, 97, 109, 101, 32, 61, 32, 39, 65, 115, 115, 101, 114, 116, 105, 111, 110, 69, 114, 114, 111, 114, 39, 59, 10, 32, 32, 116, 104, 105, 115, 46, 97, 99, 116, 117, 97, 108, 32, 61, 32, 111, 112, 116, 105, 111, 110, 115, 46, 97, 99, 116, 117, 97, 108, 59, 10, 32, 32, 116, 104, 105, 115, 46, 101, 120, 112, 101, 99, 116, 101, 100, 32, 61, 32, 111, 112, 116, 105, 111, 110, 115, 46, 101, 120, 112, 101, 99, 116, 101, 100, 59, 10, 32, 32, 116, 104, 105, 115, 46, 111, 112, 101, 114, 97, 116, 111, 114, 32, 61, 32, 111, 112, 116, 105, 111, 110, 115, 46, 111, 112, 101, 114, 97, 116, 111, 114, 59, 10, 32, 32, 105, 102, 32, 40, 111, 112, 116, 105, 111, 110, 115, 46, 109, 101, 115, 115, 97, 103, 101, 41, 32, 123, 10, 32, 32, 32, 32, 116, 104, 105, 115, 46, 109, 101, 115, 115, 97, 103, 101, 32, 61, 32, 111, 112, 116, 105, 111, 110, 115, 46, 109, 101, 115, 115, 97, 103, 101, 59, 10, 32, 32, 32, 32, 116, 104, 105, 115, 46, 103, 101, 110, 101, 114, 97, 116, 101, 100, 77, 101, 115, 115, 97, 103, 101, 32, 61, 32, 102, 97, 108, 115, 101, 59, 10, 32, 32, 125, 32, 101, 108, 115, 101, 32, 123, 10, 32, 32, 32, 32, 116, 104, 105, 115, 46, 109, 101, 115, 115, 97, 103, 101, 32, 61, 32, 103, 101, 116, 77, 101, 115, 115, 97, 103, 101, 40, 116, 104, 105, 115, 41, 59, 10, 32, 32, 32, 32, 116, 104, 105, 115, 46, 103, 101, 110, 101, 114, 97, 116, 101, 100, 77, 101, 115, 115, 97, 103, 101, 32, 61, 32, 116, 114, 117, 101, 59, 10, 32, 32, 125, 10, 32, 32, 118, 97, 114, 32, 115, 116, 97, 99, 107, 83, 116, 97, 114, 116, 70, 117, 110, 99, 116, 105, 111, 110, 32, 61, 32, 111, 112, 116, 105, 111, 110, 115, 46, 115, 116, 97, 99, 107, 83, 116, 97, 114, 116, 70, 117, 110, 99, 116, 105, 111, 110, 32, 124, 124, 32, 102, 97, 105, 108, 59, 10, 32, 32, 69, 114, 114, 111, 114, 46, 99, 97, 112, 116, 117, 114, 101, 83, 116, 97, 99, 107, 84, 114, 97, 99, 101, 40, 116, 104, 105, 115, 44, 32, 115, 116, 97, 99, 107, 83, 116, 97, 114, 116, 70, 117, 110, 99, 116, 105, 111, 110, 41, 59, 10, 125, 59, 10, 10, 47, 47, 32, 97, 115, 115, 101, 114, 116, 46, 65, 115, 115, 101, 114, 116, 105, 111, 110, 69, 114, 114, 111, 114, 32, 105, 110, 115, 116, 97, 110, 99, 101, 111, 102, 32, 69, 114, 114, 111, 114, 10, 117, 116, 105, 108, 46, 105, 110, 104, 101, 114, 105, 116, 115, 40, 97, 115, 115, 101, 114, 116, 46, 65, 115, 115, 101, 114, 116, 105, 111, 110, 69, 114, 114, 111, 114, 44, 32, 69, 114, 114, 111, 114, 41, 59, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 116, 114, 117, 110, 99, 97, 116, 101, 40, 115, 44, 32, 110, 41, 32, 123, 10, 32, 32, 105, 102, 32, 40, 116, 121, 112, 101, 111, 102, 32, 115, 32, 61, 61, 61, 32, 39, 115, 116, 114, 105, 110, 103, 39, 41, 32, 123, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 115, 46, 108, 101, 110, 103, 116, 104, 32, 60, 32, 110, 32, 63, 32, 115, 32, 58, 32, 115, 46, 115, 108, 105, 99, 101, 40, 48, 44, 32, 110, 41, 59, 10, 32, 32, 125, 32, 101, 108, 115, 101, 32, 123, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 115, 59, 10, 32, 32, 125, 10, 125, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 103, 101, 116, 77, 101, 115, 115, 97, 103, 101, 40, 115, 101, 108, 102, 41, 32, 123, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 116, 114, 117, 110, 99, 97, 116, 101, 40, 117, 116, 105, 108, 46, 105, 110, 115, 112, 101, 99, 116, 40, 115, 101, 108, 102, 46, 97, 99, 116, 117, 97, 108, 41, 44, 32, 49, 50, 56, 41, 32, 43, 32, 39, 32, 39, 32, 43, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 115, 101, 108, 102, 46, 111, 112, 101, 114, 97, 116, 111, 114, 32, 43, 32, 39, 32, 39, 32, 43, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 116, 114, 117, 110, 99, 97, 116, 101, 40, 117, 116, 105, 108, 46, 105, 110, 115, 112, 101, 99, 116, 40, 115, 101, 108, 102, 46, 101, 120, 112, 101, 99, 116, 101, 100, 41, 44, 32, 49, 50, 56, 41, 59, 10, 125, 10, 10, 47, 47, 32, 65, 116, 32, 112, 114, 101, 115, 101, 110, 116, 32, 111, 110, 108, 121, 32, 116, 104, 101, 32, 116, 104, 114, 101, 101, 32, 107, 101, 121, 115, 32, 109, 101, 110, 116, 105, 111, 110, 101, 100, 32, 97, 98, 111, 118, 101, 32, 97, 114, 101, 32, 117, 115, 101, 100, 32, 97, 110, 100, 10, 47, 47, 32, 117, 110, 100, 101, 114, 115, 116, 111, 111, 100, 32, 98, 121, 32, 116, 104, 101, 32, 115, 112, 101, 99, 46, 32, 73, 109, 112, 108, 101, 109, 101, 110, 116, 97, 116, 105, 111, 110, 115, 32, 111, 114, 32, 115, 117, 98, 32, 109, 111, 100, 117, 108, 101, 115, 32, 99, 97, 110, 32, 112, 97, 115, 115, 10, 47, 47, 32, 111, 116, 104, 101, 114, 32, 107, 101, 121, 115, 32, 116, 111, 32, 116, 104, 101, 32, 65, 115, 115, 101, 114, 116, 105, 111, 110, 69, 114, 114, 111, 114, 39, 115, 32, 99, 111, 110, 115, 116, 114, 117, 99, 116, 111, 114, 32, 45, 32, 116, 104, 101, 121, 32, 119, 105, 108, 108, 32, 98, 101, 10, 47, 47, 32, 105, 103, 110, 111, 114, 101, 100, 46, 10, 10, 47, 47, 32, 51, 46, 32, 65, 108, 108, 32, 111, 102, 32, 116, 104, 101, 32, 102, 111, 108, 108, 111, 119, 105, 110, 103, 32, 102, 117, 110, 99, 116, 105, 111, 110, 115, 32, 109, 117, 115, 116, 32, 116, 104, 114, 111, 119, 32, 97, 110, 32, 65, 115, 115, 101, 114, 116, 105, 111, 110, 69, 114, 114, 111, 114, 10, 47, 47, 32, 119, 104, 101, 110, 32, 97, 32, 99, 111, 114, 114, 101, 115, 112, 111, 110, 100, 105, 110, 103, 32, 99, 111, 110, 100, 105, 116, 105, 111, 110, 32, 105, 115, 32, 110, 111, 116, 32, 109, 101, 116, 44, 32, 119, 105, 116, 104, 32, 97, 32, 109, 101, 115, 115, 97, 103, 101, 32, 116, 104, 97, 116, 10, 47, 47, 32, 109, 97, 121, 32, 98, 101, 32, 117, 110, 100, 101, 102, 105, 110, 101, 100, 32, 105, 102, 32, 110, 111, 116, 32, 112, 114, 111, 118, 105, 100, 101, 100, 46, 32, 32, 65, 108, 108, 32, 97, 115, 115, 101, 114, 116, 105, 111, 110, 32, 109, 101, 116, 104, 111, 100, 115, 32, 112, 114, 111, 118, 105, 100, 101, 10, 47, 47, 32, 98, 111, 116, 104, 32, 116, 104, 101, 32, 97, 99, 116, 117, 97, 108, 32, 97, 110, 100, 32, 101, 120, 112, 101, 99, 116, 101, 100, 32, 118, 97, 108, 117, 101, 115, 32, 116, 111, 32, 116, 104, 101, 32, 97, 115, 115, 101, 114, 116, 105, 111, 110, 32, 101, 114, 114, 111, 114, 32, 102, 111, 114, 10, 47, 47, 32, 100, 105, 115, 112, 108, 97, 121, 32, 112, 117, 114, 112, 111, 115, 101, 115, 46, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 102, 97, 105, 108, 40, 97, 99, 116, 117, 97, 108, 44, 32, 101, 120, 112, 101, 99, 116, 101, 100, 44, 32, 109, 101, 115, 115, 97, 103, 101, 44, 32, 111, 112, 101, 114, 97, 116, 111, 114, 44, 32, 115, 116, 97, 99, 107, 83, 116, 97, 114, 116, 70, 117, 110, 99, 116, 105, 111, 110, 41, 32, 123, 10, 32, 32, 116, 104, 114, 111, 119, 32, 110, 101, 119, 32, 97, 115, 115, 101, 114, 116, 46, 65, 115, 115, 101, 114, 116, 105, 111, 110, 69, 114, 114, 111, 114, 40, 123, 10, 32, 32, 32, 32, 109, 101, 115, 115, 97, 103, 101, 58, 32, 109, 101, 115, 115, 97, 103, 101, 44, 10, 32, 32, 32, 32, 97, 99, 116, 117, 97, 108, 58, 32, 97, 99, 116, 117, 97, 108, 44, 10, 32, 32, 32, 32, 101, 120, 112, 101, 99, 116, 101, 100, 58, 32, 101, 120, 112, 101, 99, 116, 101, 100, 44, 10, 32, 32, 32, 32, 111, 112, 101, 114, 97, 116, 111, 114, 58, 32, 111, 112, 101, 114, 97, 116, 111, 114, 44, 10, 32, 32, 32, 32, 115, 116, 97, 99, 107, 83, 116, 97, 114, 116, 70, 117, 110, 99, 116, 105, 111, 110, 58, 32, 115, 116, 97, 99, 107, 83, 116, 97, 114, 116, 70, 117, 110, 99, 116, 105, 111, 110, 10, 32, 32, 125, 41, 59, 10, 125, 10, 10, 47, 47, 32, 69, 88, 84, 69, 78, 83, 73, 79, 78, 33, 32, 97, 108, 108, 111, 119, 115, 32, 102, 111, 114, 32, 119, 101, 108, 108, 32, 98, 101, 104, 97, 118, 101, 100, 32, 101, 114, 114, 111, 114, 115, 32, 100, 101, 102, 105, 110, 101, 100, 32, 101, 108, 115, 101, 119, 104, 101, 114, 101, 46, 10, 97, 115, 115, 101, 114, 116, 46, 102, 97, 105, 108, 32, 61, 32, 102, 97, 105, 108, 59, 10, 10, 47, 47, 32, 52, 46, 32, 80, 117, 114, 101, 32, 97, 115, 115, 101, 114, 116, 105, 111, 110, 32, 116, 101, 115, 116, 115, 32, 119, 104, 101, 116, 104, 101, 114, 32, 97, 32, 118, 97, 108, 117, 101, 32, 105, 115, 32, 116, 114, 117, 116, 104, 121, 44, 32, 97, 115, 32, 100, 101, 116, 101, 114, 109, 105, 110, 101, 100, 10, 47, 47, 32, 98, 121, 32, 33, 33, 103, 117, 97, 114, 100, 46, 10, 47, 47, 32, 97, 115, 115, 101, 114, 116, 46, 111, 107, 40, 103, 117, 97, 114, 100, 44, 32, 109, 101, 115, 115, 97, 103, 101, 95, 111, 112, 116, 41, 59, 10, 47, 47, 32, 84, 104, 105, 115, 32, 115, 116, 97, 116, 101, 109, 101, 110, 116, 32, 105, 115, 32, 101, 113, 117, 105, 118, 97, 108, 101, 110, 116, 32, 116, 111, 32, 97, 115, 115, 101, 114, 116, 46, 101, 113, 117, 97, 108, 40, 116, 114, 117, 101, 44, 32, 33, 33, 103, 117, 97, 114, 100, 44, 10, 47, 47, 32, 109, 101, 115, 115, 97, 103, 101, 95, 111, 112, 116, 41, 59, 46, 32, 84, 111, 32, 116, 101, 115, 116, 32, 115, 116, 114, 105, 99, 116, 108, 121, 32, 102, 111, 114, 32, 116, 104, 101, 32, 118, 97, 108, 117, 101, 32, 116, 114, 117, 101, 44, 32, 117, 115, 101, 10, 47, 47, 32, 97, 115, 115, 101, 114, 116, 46, 115, 116, 114, 105, 99, 116, 69, 113, 117, 97, 108, 40, 116, 114, 117, 101, 44, 32, 103, 117, 97, 114, 100, 44, 32, 109, 101, 115, 115, 97, 103, 101, 95, 111, 112, 116, 41, 59, 46, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 111, 107, 40, 118, 97, 108, 117, 101, 44, 32, 109, 101, 115, 115, 97, 103, 101, 41, 32, 123, 10, 32, 32, 105, 102, 32, 40, 33, 118, 97, 108, 117, 101, 41, 32, 102, 97, 105, 108, 40, 118, 97, 108, 117, 101, 44, 32, 116, 114, 117, 101, 44, 32, 109, 101, 115, 115, 97, 103, 101, 44, 32, 39, 61, 61, 39, 44, 32, 97, 115, 115, 101, 114, 116, 46, 111, 107, 41, 59, 10, 125, 10, 97, 115, 115, 101, 114, 116, 46, 111, 107, 32, 61, 32, 111, 107, 59, 10, 10, 47, 47, 32, 53, 46, 32, 84, 104, 101, 32, 101, 113, 117, 97, 108, 105, 116, 121, 32, 97, 115, 115, 101, 114, 116, 105, 111, 110, 32, 116, 101, 115, 116, 115, 32, 115, 104, 97, 108, 108, 111, 119, 44, 32, 99, 111, 101, 114, 99, 105, 118, 101, 32, 101, 113, 117, 97, 108, 105, 116, 121, 32, 119, 105, 116, 104, 10, 47, 47, 32, 61, 61, 46, 10, 47, 47, 32, 97, 115, 115, 101, 114, 116, 46, 101, 113, 117, 97, 108, 40, 97, 99, 116, 117, 97, 108, 44, 32, 101, 120, 112, 101, 99, 116, 101, 100, 44, 32, 109, 101, 115, 115, 97, 103, 101, 95, 111, 112, 116, 41, 59, 10, 10, 97, 115, 115, 101, 114, 116, 46, 101, 113, 117, 97, 108, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 32, 101, 113, 117, 97, 108, 40, 97, 99, 116, 117, 97, 108, 44, 32, 101, 120, 112, 101, 99, 116, 101, 100, 44, 32, 109, 101, 115, 115, 97, 103, 101, 41, 32, 123, 10, 32, 32, 105, 102, 32, 40, 97, 99, 116, 117, 97, 108, 32, 33, 61, 32, 101, 120, 112, 101, 99, 116, 101, 100, 41, 32, 102, 97, 105, 108, 40, 97, 99, 116, 117, 97, 108, 44, 32, 101, 120, 112, 101, 99, 116, 101, 100, 44, 32, 109, 101, 115, 115, 97, 103, 101, 44, 32, 39, 61, 61, 39, 44, 32, 97, 115, 115, 101, 114, 116, 46, 101, 113, 117, 97, 108, 41, 59, 10, 125, 59, 10, 10, 47, 47, 32, 54, 46, 32, 84, 104, 101, 32, 110, 111, 110, 45, 101, 113, 117, 97, 108, 105, 116, 121, 32, 97, 115, 115, 101, 114, 116, 105, 111, 110, 32, 116, 101, 115, 116, 115, 32, 102, 111, 114, 32, 119, 104, 101, 116, 104, 101, 114, 32, 116, 119, 111, 32, 111, 98, 106, 101, 99, 116, 115, 32, 97, 114, 101, 32, 110, 111, 116, 32, 101, 113, 117, 97, 108, 10, 47, 47, 32, 119, 105, 116, 104, 32, 33, 61, 32, 97, 115, 115, 101, 114, 116, 46, 110, 111, 116, 69, 113, 117, 97, 108, 40, 97, 99, 116, 117, 97, 108, 44, 32, 101, 120, 112, 101, 99, 116, 101, 100, 44, 32, 109, 101, 115, 115, 97, 103, 101, 95, 111, 112, 116, 41, 59, 10, 10, 97, 115, 115, 101, 114, 116, 46, 110, 111, 116, 69, 113, 117, 97, 108, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 32, 110, 111, 116, 69, 113, 117, 97, 108, 40, 97, 99, 116, 117, 97, 108, 44, 32, 101, 120, 112, 101, 99, 116, 101, 100, 44, 32, 109, 101, 115, 115, 97, 103, 101, 41, 32, 123, 10, 32, 32, 105, 102, 32, 40, 97, 99, 116, 117, 97, 108, 32, 61, 61, 32, 101, 120, 112, 101, 99, 116, 101, 100, 41, 32, 123, 10, 32, 32, 32, 32, 102, 97, 105, 108, 40, 97, 99, 116, 117, 97, 108, 44, 32, 101, 120, 112, 101, 99, 116, 101, 100, 44, 32, 109, 101, 115, 115, 97, 103, 101, 44, 32, 39, 33, 61, 39, 44, 32, 97, 115, 115, 101, 114, 116, 46, 110, 111, 116, 69, 113, 117, 97, 108, 41, 59, 10, 32, 32, 125, 10, 125, 59, 10, 10, 47, 47, 32, 55, 46, 32, 84, 104, 101, 32, 101, 113, 117, 105, 118, 97, 108, 101, 110, 99, 101, 32, 97, 115, 115, 101, 114, 116, 105, 111, 110, 32, 116, 101, 115, 116, 115, 32, 97, 32, 100, 101, 101, 112, 32, 101, 113, 117, 97, 108, 105, 116, 121, 32, 114, 101, 108, 97, 116, 105, 111, 110, 46, 10, 47, 47, 32, 97, 115, 115, 101, 114, 116, 46, 100, 101, 101, 112, 69, 113, 117, 97, 108, 40, 97, 99, 116, 117, 97, 108, 44, 32, 101, 120, 112, 101, 99, 116, 101, 100, 44, 32, 109, 101, 115, 115, 97, 103, 101, 95, 111, 112, 116, 41, 59, 10, 10, 97, 115, 115, 101, 114, 116, 46, 100, 101, 101, 112, 69, 113, 117, 97, 108, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 32, 100, 101, 101, 112, 69, 113, 117, 97, 108, 40, 97, 99, 116, 117, 97, 108, 44, 32, 101, 120, 112, 101, 99, 116, 101, 100, 44, 32, 109, 101, 115, 115, 97, 103, 101, 41, 32, 123, 10, 32, 32, 105, 102, 32, 40, 33, 95, 100, 101, 101, 112, 69, 113, 117, 97, 108, 40, 97, 99, 116, 117, 97, 108, 44, 32, 101, 120, 112, 101, 99, 116, 101, 100, 44, 32, 102, 97, 108, 115, 101, 41, 41, 32, 123, 10, 32, 32, 32, 32, 102, 97, 105, 108, 40, 97, 99, 116, 117, 97, 108, 44, 32, 101, 120, 112, 101, 99, 116, 101, 100, 44, 32, 109, 101, 115, 115, 97, 103, 101, 44, 32, 39, 100, 101, 101, 112, 69, 113, 117, 97, 108, 39, 44, 32, 97, 115, 115, 101, 114, 116, 46, 100, 101, 101, 112, 69, 113, 117, 97, 108, 41, 59, 10, 32, 32, 125, 10, 125, 59, 10, 10, 97, 115, 115, 101, 114, 116, 46, 100, 101, 101, 112, 83, 116, 114, 105, 99, 116, 69, 113, 117, 97, 108, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 32, 100, 101, 101, 112, 83, 116, 114, 105, 99, 116, 69, 113, 117, 97, 108, 40, 97, 99, 116, 117, 97, 108, 44, 32, 101, 120, 112, 101, 99, 116, 101, 100, 44, 32, 109, 101, 115, 115, 97, 103, 101, 41, 32, 123, 10, 32, 32, 105, 102, 32, 40, 33, 95, 100, 101, 101, 112, 69, 113, 117, 97, 108, 40, 97, 99, 116, 117, 97, 108, 44, 32, 101, 120, 112, 101, 99, 116, 101, 100, 44, 32, 116, 114, 117, 101, 41, 41, 32, 123, 10, 32, 32, 32, 32, 102, 97, 105, 108, 40, 97, 99, 116, 117, 97, 108, 44, 32, 101, 120, 112, 101, 99, 116, 101, 100, 44, 32, 109, 101, 115, 115, 97, 103, 101, 44, 32, 39, 100, 101, 101, 112, 83, 116, 114, 105, 99, 116, 69, 113, 117, 97, 108, 39, 44, 32, 97, 115, 115, 101, 114, 116, 46, 100, 101, 101, 112, 83, 116, 114, 105, 99, 116, 69, 113, 117, 97, 108, 41, 59, 10, 32, 32, 125, 10, 125, 59, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 95, 100, 101, 101, 112, 69, 113, 117, 97, 108, 40, 97, 99, 116, 117, 97, 108, 44, 32, 101, 120, 112, 101, 99, 116, 101, 100, 44, 32, 115, 116, 114, 105, 99, 116, 41, 32, 123, 10, 32, 32, 47, 47, 32, 55, 46, 49, 46, 32, 65, 108, 108, 32, 105, 100, 101, 110, 116, 105, 99, 97, 108, 32, 118, 97, 108, 117, 101, 115, 32, 97, 114, 101, 32, 101, 113, 117, 105, 118, 97, 108, 101, 110, 116, 44, 32, 97, 115, 32, 100, 101, 116, 101, 114, 109, 105, 110, 101, 100, 32, 98, 121, 32, 61, 61, 61, 46, 10, 32, 32, 105, 102, 32, 40, 97, 99, 116, 117, 97, 108, 32, 61, 61, 61, 32, 101, 120, 112, 101, 99, 116, 101, 100, 41, 32, 123, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 116, 114, 117, 101, 59, 10, 32, 32, 125, 32, 101, 108, 115, 101, 32, 105, 102, 32, 40, 97, 99, 116, 117, 97, 108, 32, 105, 110, 115, 116, 97, 110, 99, 101, 111, 102, 32, 66, 117, 102, 102, 101, 114, 32, 38, 38, 32, 101, 120, 112, 101, 99, 116, 101, 100, 32, 105, 110, 115, 116, 97, 110, 99, 101, 111, 102, 32, 66, 117, 102, 102, 101, 114, 41, 32, 123, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 99, 111, 109, 112, 97, 114, 101, 40, 97, 99, 116, 117, 97, 108, 44, 32, 101, 120, 112, 101, 99, 116, 101, 100, 41, 32, 61, 61, 61, 32, 48, 59, 10, 10, 32, 32, 47, 47, 32, 55, 46, 50, 46, 32, 73, 102, 32, 116, 104, 101, 32, 101, 120, 112, 101, 99, 116, 101, 100, 32, 118, 97, 108, 117, 101, 32, 105, 115, 32, 97, 32, 68, 97, 116, 101, 32, 111, 98, 106, 101, 99, 116, 44, 32, 116, 104, 101, 32, 97, 99, 116, 117, 97, 108, 32, 118, 97, 108, 117, 101, 32, 105, 115, 10, 32, 32, 47, 47, 32, 101, 113, 117, 105, 118, 97, 108, 101, 110, 116, 32, 105, 102, 32, 105, 116, 32, 105, 115, 32, 97, 108, 115, 111, 32, 97, 32, 68, 97, 116, 101, 32, 111, 98, 106, 101, 99, 116, 32, 116, 104, 97, 116, 32, 114, 101, 102, 101, 114, 115, 32, 116, 111, 32, 116, 104, 101, 32, 115, 97, 109, 101, 32, 116, 105, 109, 101, 46, 10, 32, 32, 125, 32, 101, 108, 115, 101, 32, 105, 102, 32, 40, 117, 116, 105, 108, 46, 105, 115, 68, 97, 116, 101, 40, 97, 99, 116, 117, 97, 108, 41, 32, 38, 38, 32, 117, 116, 105, 108, 46, 105, 115, 68, 97, 116, 101, 40, 101, 120, 112, 101, 99, 116, 101, 100, 41, 41, 32, 123, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 97, 99, 116, 117, 97, 108, 46, 103, 101, 116, 84, 105, 109, 101, 40, 41, 32, 61, 61, 61, 32, 101, 120, 112, 101, 99, 116, 101, 100, 46, 103, 101, 116, 84, 105, 109, 101, 40, 41, 59, 10, 10, 32, 32, 47, 47, 32, 55, 46, 51, 32, 73, 102, 32, 116, 104, 101, 32, 101, 120, 112, 101, 99, 116, 101, 100, 32, 118, 97, 108, 117, 101, 32, 105, 115, 32, 97, 32, 82, 101, 103, 69, 120, 112, 32, 111, 98, 106, 101, 99, 116, 44, 32, 116, 104, 101, 32, 97, 99, 116, 117, 97, 108, 32, 118, 97, 108, 117, 101, 32, 105, 115, 10, 32, 32, 47, 47, 32, 101, 113, 117, 105, 118, 97, 108, 101, 110, 116, 32, 105, 102, 32, 105, 116, 32, 105, 115, 32, 97, 108, 115, 111, 32, 97, 32, 82, 101, 103, 69, 120, 112, 32, 111, 98, 106, 101, 99, 116, 32, 119, 105, 116, 104, 32, 116, 104, 101, 32, 115, 97, 109, 101, 32, 115, 111, 117, 114, 99, 101, 32, 97, 110, 100, 10, 32, 32, 47, 47, 32, 112, 114, 111, 112, 101, 114, 116, 105, 101, 115, 32, 40, 96, 103, 108, 111, 98, 97, 108, 96, 44, 32, 96, 109, 117, 108, 116, 105, 108, 105, 110, 101, 96, 44, 32, 96, 108, 97, 115, 116, 73, 110, 100, 101, 120, 96, 44, 32, 96, 105, 103, 110, 111, 114, 101, 67, 97, 115, 101, 96, 41, 46, 10, 32, 32, 125, 32, 101, 108, 115, 101, 32, 105, 102, 32, 40, 117, 116, 105, 108, 46, 105, 115, 82, 101, 103, 69, 120, 112, 40, 97, 99, 116, 117, 97, 108, 41, 32, 38, 38, 32, 117, 116, 105, 108, 46, 105, 115, 82, 101, 103, 69, 120, 112, 40, 101, 120, 112, 101, 99, 116, 101, 100, 41, 41, 32, 123, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 97, 99, 116, 117, 97, 108, 46, 115, 111, 117, 114, 99, 101, 32, 61, 61, 61, 32, 101, 120, 112, 101, 99, 116, 101, 100, 46, 115, 111, 117, 114, 99, 101, 32, 38, 38, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 97, 99, 116, 117, 97, 108, 46, 103, 108, 111, 98, 97, 108, 32, 61, 61, 61, 32, 101, 120, 112, 101, 99, 116, 101, 100, 46, 103, 108, 111, 98, 97, 108, 32, 38, 38, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 97, 99, 116, 117, 97, 108, 46, 109, 117, 108, 116, 105, 108, 105, 110, 101, 32, 61, 61, 61, 32, 101, 120, 112, 101, 99, 116, 101, 100, 46, 109, 117, 108, 116, 105, 108, 105, 110, 101, 32, 38, 38, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 97, 99, 116, 117, 97, 108, 46, 108, 97, 115, 116, 73, 110, 100, 101, 120, 32, 61, 61, 61, 32, 101, 120, 112, 101, 99, 116, 101, 100, 46, 108, 97, 115, 116, 73, 110, 100, 101, 120, 32, 38, 38, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 97, 99, 116, 117, 97, 108, 46, 105, 103, 110, 111, 114, 101, 67, 97, 115, 101, 32, 61, 61, 61, 32, 101, 120, 112, 101, 99, 116, 101, 100, 46, 105, 103, 110, 111, 114, 101, 67, 97, 115, 101, 59, 10, 10, 32, 32, 47, 47, 32, 55, 46, 52, 46, 32, 79, 116, 104, 101, 114, 32, 112, 97, 105, 114, 115, 32, 116, 104, 97, 116, 32, 100, 111, 32, 110, 111, 116, 32, 98, 111, 116, 104, 32, 112, 97, 115, 115, 32, 116, 121, 112, 101, 111, 102, 32, 118, 97, 108, 117, 101, 32, 61, 61, 32, 39, 111, 98, 106, 101, 99, 116, 39, 44, 10, 32, 32, 47, 47, 32, 101, 113, 117, 105, 118, 97, 108, 101, 110, 99, 101, 32, 105, 115, 32, 100, 101, 116, 101, 114, 109, 105, 110, 101, 100, 32, 98, 121, 32, 61, 61, 46, 10, 32, 32, 125, 32, 101, 108, 115, 101, 32, 105, 102, 32, 40, 40, 97, 99, 116, 117, 97, 108, 32, 61, 61, 61, 32, 110, 117, 108, 108, 32, 124, 124, 32, 116, 121, 112, 101, 111, 102, 32, 97, 99, 116, 117, 97, 108, 32, 33, 61, 61, 32, 39, 111, 98, 106, 101, 99, 116, 39, 41, 32, 38, 38, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 40, 101, 120, 112, 101, 99, 116, 101, 100, 32, 61, 61, 61, 32, 110, 117, 108, 108, 32, 124, 124, 32, 116, 121, 112, 101, 111, 102, 32, 101, 120, 112, 101, 99, 116, 101, 100, 32, 33, 61, 61, 32, 39, 111, 98, 106, 101, 99, 116, 39, 41, 41, 32, 123, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 115, 116, 114, 105, 99, 116, 32, 63, 32, 97, 99, 116, 117, 97, 108, 32, 61, 61, 61, 32, 101, 120, 112, 101, 99, 116, 101, 100, 32, 58, 32, 97, 99, 116, 117, 97, 108, 32, 61, 61, 32, 101, 120, 112, 101, 99, 116, 101, 100, 59, 10, 10, 32, 32, 47, 47, 32, 73, 102, 32, 98, 111, 116, 104, 32, 118, 97, 108, 117, 101, 115, 32, 97, 114, 101, 32, 105, 110, 115, 116, 97, 110, 99, 101, 115, 32, 111, 102, 32, 116, 121, 112, 101, 100, 32, 97, 114, 114, 97, 121, 115, 44, 32, 119, 114, 97, 112, 32, 116, 104, 101, 109, 32, 105, 110, 10, 32, 32, 47, 47, 32, 97, 32, 66, 117, 102, 102, 101, 114, 32, 101, 97, 99, 104, 32, 116, 111, 32, 105, 110, 99, 114, 101, 97, 115, 101, 32, 112, 101, 114, 102, 111, 114, 109, 97, 110, 99, 101, 10, 32, 32, 125, 32, 101, 108, 115, 101, 32, 105, 102, 32, 40, 65, 114, 114, 97, 121, 66, 117, 102, 102, 101, 114, 46, 105, 115, 86, 105, 101, 119, 40, 97, 99, 116, 117, 97, 108, 41, 32, 38, 38, 32, 65, 114, 114, 97, 121, 66, 117, 102, 102, 101, 114, 46, 105, 115, 86, 105, 101, 119, 40, 101, 120, 112, 101, 99, 116, 101, 100, 41, 41, 32, 123, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 99, 111, 109, 112, 97, 114, 101, 40, 110, 101, 119, 32, 66, 117, 102, 102, 101, 114, 40, 97, 99, 116, 117, 97, 108, 41, 44, 32, 110, 101, 119, 32, 66, 117, 102, 102, 101, 114, 40, 101, 120, 112, 101, 99, 116, 101, 100, 41, 41, 32, 61, 61, 61, 32, 48, 59, 10, 10, 32, 32, 47, 47, 32, 55, 46, 53, 32, 70, 111, 114, 32, 97, 108, 108, 32, 111, 116, 104, 101, 114, 32, 79, 98, 106, 101, 99, 116, 32, 112, 97, 105, 114, 115, 44, 32, 105, 110, 99, 108, 117, 100, 105, 110, 103, 32, 65, 114, 114, 97, 121, 32, 111, 98, 106, 101, 99, 116, 115, 44, 32, 101, 113, 117, 105, 118, 97, 108, 101, 110, 99, 101, 32, 105, 115, 10, 32, 32, 47, 47, 32, 100, 101, 116, 101, 114, 109, 105, 110, 101, 100, 32, 98, 121, 32, 104, 97, 118, 105, 110, 103, 32, 116, 104, 101, 32, 115, 97, 109, 101, 32, 110, 117, 109, 98, 101, 114, 32, 111, 102, 32, 111, 119, 110, 101, 100, 32, 112, 114, 111, 112, 101, 114, 116, 105, 101, 115, 32, 40, 97, 115, 32, 118, 101, 114, 105, 102, 105, 101, 100, 10, 32, 32, 47, 47, 32, 119, 105, 116, 104, 32, 79, 98, 106, 101, 99, 116, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 104, 97, 115, 79, 119, 110, 80, 114, 111, 112, 101, 114, 116, 121, 46, 99, 97, 108, 108, 41, 44, 32, 116, 104, 101, 32, 115, 97, 109, 101, 32, 115, 101, 116, 32, 111, 102, 32, 107, 101, 121, 115, 10, 32, 32, 47, 47, 32, 40, 97, 108, 116, 104, 111, 117, 103, 104, 32, 110, 111, 116, 32, 110, 101, 99, 101, 115, 115, 97, 114, 105, 108, 121, 32, 116, 104, 101, 32, 115, 97, 109, 101, 32, 111, 114, 100, 101, 114, 41, 44, 32, 101, 113, 117, 105, 118, 97, 108, 101, 110, 116, 32, 118, 97, 108, 117, 101, 115, 32, 102, 111, 114, 32, 101, 118, 101, 114, 121, 10, 32, 32, 47, 47, 32, 99, 111, 114, 114, 101, 115, 112, 111, 110, 100, 105, 110, 103, 32, 107, 101, 121, 44, 32, 97, 110, 100, 32, 97, 110, 32, 105, 100, 101, 110, 116, 105, 99, 97, 108, 32, 39, 112, 114, 111, 116, 111, 116, 121, 112, 101, 39, 32, 112, 114, 111, 112, 101, 114, 116, 121, 46, 32, 78, 111, 116, 101, 58, 32, 116, 104, 105, 115, 10, 32, 32, 47, 47, 32, 97, 99, 99, 111, 117, 110, 116, 115, 32, 102, 111, 114, 32, 98, 111, 116, 104, 32, 110, 97, 109, 101, 100, 32, 97, 110, 100, 32, 105, 110, 100, 101, 120, 101, 100, 32, 112, 114, 111, 112, 101, 114, 116, 105, 101, 115, 32, 111, 110, 32, 65, 114, 114, 97, 121, 115, 46, 10, 32, 32, 125, 32, 101, 108, 115, 101, 32, 123, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 111, 98, 106, 69, 113, 117, 105, 118, 40, 97, 99, 116, 117, 97, 108, 44, 32, 101, 120, 112, 101, 99, 116, 101, 100, 44, 32, 115, 116, 114, 105, 99, 116, 41, 59, 10, 32, 32, 125, 10, 125, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 105, 115, 65, 114, 103, 117, 109, 101, 110, 116, 115, 40, 111, 98, 106, 101, 99, 116, 41, 32, 123, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 79, 98, 106, 101, 99, 116, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 116, 111, 83, 116, 114, 105, 110, 103, 46, 99, 97, 108, 108, 40, 111, 98, 106, 101, 99, 116, 41, 32, 61, 61, 32, 39, 91, 111, 98, 106, 101, 99, 116, 32, 65, 114, 103, 117, 109, 101, 110, 116, 115, 93, 39, 59, 10, 125, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 111, 98, 106, 69, 113, 117, 105, 118, 40, 97, 44, 32, 98, 44, 32, 115, 116, 114, 105, 99, 116, 41, 32, 123, 10, 32, 32, 105, 102, 32, 40, 97, 32, 61, 61, 61, 32, 110, 117, 108, 108, 32, 124, 124, 32, 97, 32, 61, 61, 61, 32, 117, 110, 100, 101, 102, 105, 110, 101, 100, 32, 124, 124, 32, 98, 32, 61, 61, 61, 32, 110, 117, 108, 108, 32, 124, 124, 32, 98, 32, 61, 61, 61, 32, 117, 110, 100, 101, 102, 105, 110, 101, 100, 41, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 102, 97, 108, 115, 101, 59, 10, 32, 32, 47, 47, 32, 105, 102, 32, 111, 110, 101, 32, 105, 115, 32, 97, 32, 112, 114, 105, 109, 105, 116, 105, 118, 101, 44, 32, 116, 104, 101, 32, 111, 116, 104, 101, 114, 32, 109, 117, 115, 116, 32, 98, 101, 32, 115, 97, 109, 101, 10, 32, 32, 105, 102, 32, 40, 117, 116, 105, 108, 46, 105, 115, 80, 114, 105, 109, 105, 116, 105, 118, 101, 40, 97, 41, 32, 124, 124, 32, 117, 116, 105, 108, 46, 105, 115, 80, 114, 105, 109, 105, 116, 105, 118, 101, 40, 98, 41, 41, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 97, 32, 61, 61, 61, 32, 98, 59, 10, 32, 32, 105, 102, 32, 40, 115, 116, 114, 105, 99, 116, 32, 38, 38, 32, 79, 98, 106, 101, 99, 116, 46, 103, 101, 116, 80, 114, 111, 116, 111, 116, 121, 112, 101, 79, 102, 40, 97, 41, 32, 33, 61, 61, 32, 79, 98, 106, 101, 99, 116, 46, 103, 101, 116, 80, 114, 111, 116, 111, 116, 121, 112, 101, 79, 102, 40, 98, 41, 41, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 102, 97, 108, 115, 101, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 97, 73, 115, 65, 114, 103, 115, 32, 61, 32, 105, 115, 65, 114, 103, 117, 109, 101, 110, 116, 115, 40, 97, 41, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 98, 73, 115, 65, 114, 103, 115, 32, 61, 32, 105, 115, 65, 114, 103, 117, 109, 101, 110, 116, 115, 40, 98, 41, 59, 10, 32, 32, 105, 102, 32, 40, 40, 97, 73, 115, 65, 114, 103, 115, 32, 38, 38, 32, 33, 98, 73, 115, 65, 114, 103, 115, 41, 32, 124, 124, 32, 40, 33, 97, 73, 115, 65, 114, 103, 115, 32, 38, 38, 32, 98, 73, 115, 65, 114, 103, 115, 41, 41, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 102, 97, 108, 115, 101, 59, 10, 32, 32, 105, 102, 32, 40, 97, 73, 115, 65, 114, 103, 115, 41, 32, 123, 10, 32, 32, 32, 32, 97, 32, 61, 32, 112, 83, 108, 105, 99, 101, 46, 99, 97, 108, 108, 40, 97, 41, 59, 10, 32, 32, 32, 32, 98, 32, 61, 32, 112, 83, 108, 105, 99, 101, 46, 99, 97, 108, 108, 40, 98, 41, 59, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 95, 100, 101, 101, 112, 69, 113, 117, 97, 108, 40, 97, 44, 32, 98, 44, 32, 115, 116, 114, 105, 99, 116, 41, 59, 10, 32, 32, 125, 10, 32, 32, 99, 111, 110, 115, 116, 32, 107, 97, 32, 61, 32, 79, 98, 106, 101, 99, 116, 46, 107, 101, 121, 115, 40, 97, 41, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 107, 98, 32, 61, 32, 79, 98, 106, 101, 99, 116, 46, 107, 101, 121, 115, 40, 98, 41, 59, 10, 32, 32, 118, 97, 114, 32, 107, 101, 121, 44, 32, 105, 59, 10, 32, 32, 47, 47, 32, 104, 97, 118, 105, 110, 103, 32, 116, 104, 101, 32, 115, 97, 109, 101, 32, 110, 117, 109, 98, 101, 114, 32, 111, 102, 32, 111, 119, 110, 101, 100, 32, 112, 114, 111, 112, 101, 114, 116, 105, 101, 115, 32, 40, 107, 101, 121, 115, 32, 105, 110, 99, 111, 114, 112, 111, 114, 97, 116, 101, 115, 10, 32, 32, 47, 47, 32, 104, 97, 115, 79, 119, 110, 80, 114, 111, 112, 101, 114, 116, 121, 41, 10, 32, 32, 105, 102, 32, 40, 107, 97, 46, 108, 101, 110, 103, 116, 104, 32, 33, 61, 61, 32, 107, 98, 46, 108, 101, 110, 103, 116, 104, 41, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 102, 97, 108, 115, 101, 59, 10, 32, 32, 47, 47, 116, 104, 101, 32, 115, 97, 109, 101, 32, 115, 101, 116, 32, 111, 102, 32, 107, 101, 121, 115, 32, 40, 97, 108, 116, 104, 111, 117, 103, 104, 32, 110, 111, 116, 32, 110, 101, 99, 101, 115, 115, 97, 114, 105, 108, 121, 32, 116, 104, 101, 32, 115, 97, 109, 101, 32, 111, 114, 100, 101, 114, 41, 44, 10, 32, 32, 107, 97, 46, 115, 111, 114, 116, 40, 41, 59, 10, 32, 32, 107, 98, 46, 115, 111, 114, 116, 40, 41, 59, 10, 32, 32, 47, 47, 126, 126, 126, 99, 104, 101, 97, 112, 32, 107, 101, 121, 32, 116, 101, 115, 116, 10, 32, 32, 102, 111, 114, 32, 40, 105, 32, 61, 32, 107, 97, 46, 108, 101, 110, 103, 116, 104, 32, 45, 32, 49, 59, 32, 105, 32, 62, 61, 32, 48, 59, 32, 105, 45, 45, 41, 32, 123, 10, 32, 32, 32, 32, 105, 102, 32, 40, 107, 97, 91, 105, 93, 32, 33, 61, 61, 32, 107, 98, 91, 105, 93, 41, 10, 32, 32, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 102, 97, 108, 115, 101, 59, 10, 32, 32, 125, 10, 32, 32, 47, 47, 101, 113, 117, 105, 118, 97, 108, 101, 110, 116, 32, 118, 97, 108, 117, 101, 115, 32, 102, 111, 114, 32, 101, 118, 101, 114, 121, 32, 99, 111, 114, 114, 101, 115, 112, 111, 110, 100, 105, 110, 103, 32, 107, 101, 121, 44, 32, 97, 110, 100, 10, 32, 32, 47, 47, 126, 126, 126, 112, 111, 115, 115, 105, 98, 108, 121, 32, 101, 120, 112, 101, 110, 115, 105, 118, 101, 32, 100, 101, 101, 112, 32, 116, 101, 115, 116, 10, 32, 32, 102, 111, 114, 32, 40, 105, 32, 61, 32, 107, 97, 46, 108, 101, 110, 103, 116, 104, 32, 45, 32, 49, 59, 32, 105, 32, 62, 61, 32, 48, 59, 32, 105, 45, 45, 41, 32, 123, 10, 32, 32, 32, 32, 107, 101, 121, 32, 61, 32, 107, 97, 91, 105, 93, 59, 10, 32, 32, 32, 32, 105, 102, 32, 40, 33, 95, 100, 101, 101, 112, 69, 113, 117, 97, 108, 40, 97, 91, 107, 101, 121, 93, 44, 32, 98, 91, 107, 101, 121, 93, 44, 32, 115, 116, 114, 105, 99, 116, 41, 41, 32, 114, 101, 116, 117, 114, 110, 32, 102, 97, 108, 115, 101, 59, 10, 32, 32, 125, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 116, 114, 117, 101, 59, 10, 125, 10, 10, 47, 47, 32, 56, 46, 32, 84, 104, 101, 32, 110, 111, 110, 45, 101, 113, 117, 105, 118, 97, 108, 101, 110, 99, 101, 32, 97, 115, 115, 101, 114, 116, 105, 111, 110, 32, 116, 101, 115, 116, 115, 32, 102, 111, 114, 32, 97, 110, 121, 32, 100, 101, 101, 112, 32, 105, 110, 101, 113, 117, 97, 108, 105, 116, 121, 46, 10, 47, 47, 32, 97, 115, 115, 101, 114, 116, 46, 110, 111, 116, 68, 101, 101, 112, 69, 113, 117, 97, 108, 40, 97, 99, 116, 117, 97, 108, 44, 32, 101, 120, 112, 101, 99, 116, 101, 100, 44, 32, 109, 101, 115, 115, 97, 103, 101, 95, 111, 112, 116, 41, 59, 10, 10, 97, 115, 115, 101, 114, 116, 46, 110, 111, 116, 68, 101, 101, 112, 69, 113, 117, 97, 108, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 32, 110, 111, 116, 68, 101, 101, 112, 69, 113, 117, 97, 108, 40, 97, 99, 116, 117, 97, 108, 44, 32, 101, 120, 112, 101, 99, 116, 101, 100, 44, 32, 109, 101, 115, 115, 97, 103, 101, 41, 32, 123, 10, 32, 32, 105, 102, 32, 40, 95, 100, 101, 101, 112, 69, 113, 117, 97, 108, 40, 97, 99, 116, 117, 97, 108, 44, 32, 101, 120, 112, 101, 99, 116, 101, 100, 44, 32, 102, 97, 108, 115, 101, 41, 41, 32, 123, 10, 32, 32, 32, 32, 102, 97, 105, 108, 40, 97, 99, 116, 117, 97, 108, 44, 32, 101, 120, 112, 101, 99, 116, 101, 100, 44, 32, 109, 101, 115, 115, 97, 103, 101, 44, 32, 39, 110, 111, 116, 68, 101, 101, 112, 69, 113, 117, 97, 108, 39, 44, 32, 97, 115, 115, 101, 114, 116, 46, 110, 111, 116, 68, 101, 101, 112, 69, 113, 117, 97, 108, 41, 59, 10, 32, 32, 125, 10, 125, 59, 10, 10, 97, 115, 115, 101, 114, 116, 46, 110, 111, 116, 68, 101, 101, 112, 83, 116, 114, 105, 99, 116, 69, 113, 117, 97, 108, 32, 61, 32, 110, 111, 116, 68, 101, 101, 112, 83, 116, 114, 105, 99, 116, 69, 113, 117, 97, 108, 59, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 110, 111, 116, 68, 101, 101, 112, 83, 116, 114, 105, 99, 116, 69, 113, 117, 97, 108, 40, 97, 99, 116, 117, 97, 108, 44, 32, 101, 120, 112, 101, 99, 116, 101, 100, 44, 32, 109, 101, 115, 115, 97, 103, 101, 41, 32, 123, 10, 32, 32, 105, 102, 32, 40, 95, 100, 101, 101, 112, 69, 113, 117, 97, 108, 40, 97, 99, 116, 117, 97, 108, 44, 32, 101, 120, 112, 101, 99, 116, 101, 100, 44, 32, 116, 114, 117, 101, 41, 41, 32, 123, 10, 32, 32, 32, 32, 102, 97, 105, 108, 40, 97, 99, 116, 117, 97, 108, 44, 32, 101, 120, 112, 101, 99, 116, 101, 100, 44, 32, 109, 101, 115, 115, 97, 103, 101, 44, 32, 39, 110, 111, 116, 68, 101, 101, 112, 83, 116, 114, 105, 99, 116, 69, 113, 117, 97, 108, 39, 44, 32, 110, 111, 116, 68, 101, 101, 112, 83, 116, 114, 105, 99, 116, 69, 113, 117, 97, 108, 41, 59, 10, 32, 32, 125, 10, 125, 10, 10, 10, 47, 47, 32, 57, 46, 32, 84, 104, 101, 32, 115, 116, 114, 105, 99, 116, 32, 101, 113, 117, 97, 108, 105, 116, 121, 32, 97, 115, 115, 101, 114, 116, 105, 111, 110, 32, 116, 101, 115, 116, 115, 32, 115, 116, 114, 105, 99, 116, 32, 101, 113, 117, 97, 108, 105, 116, 121, 44, 32, 97, 115, 32, 100, 101, 116, 101, 114, 109, 105, 110, 101, 100, 32, 98, 121, 32, 61, 61, 61, 46, 10, 47, 47, 32, 97, 115, 115, 101, 114, 116, 46, 115, 116, 114, 105, 99, 116, 69, 113, 117, 97, 108, 40, 97, 99, 116, 117, 97, 108, 44, 32, 101, 120, 112, 101, 99, 116, 101, 100, 44, 32, 109, 101, 115, 115, 97, 103, 101, 95, 111, 112, 116, 41, 59, 10, 10, 97, 115, 115, 101, 114, 116, 46, 115, 116, 114, 105, 99, 116, 69, 113, 117, 97, 108, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 32, 115, 116, 114, 105, 99, 116, 69, 113, 117, 97, 108, 40, 97, 99, 116, 117, 97, 108, 44, 32, 101, 120, 112, 101, 99, 116, 101, 100, 44, 32, 109, 101, 115, 115, 97, 103, 101, 41, 32, 123, 10, 32, 32, 105, 102, 32, 40, 97, 99, 116, 117, 97, 108, 32, 33, 61, 61, 32, 101, 120, 112, 101, 99, 116, 101, 100, 41, 32, 123, 10, 32, 32, 32, 32, 102, 97, 105, 108, 40, 97, 99, 116, 117, 97, 108, 44, 32, 101, 120, 112, 101, 99, 116, 101, 100, 44, 32, 109, 101, 115, 115, 97, 103, 101, 44, 32, 39, 61, 61, 61, 39, 44, 32, 97, 115, 115, 101, 114, 116, 46, 115, 116, 114, 105, 99, 116, 69, 113, 117, 97, 108, 41, 59, 10, 32, 32, 125, 10, 125, 59, 10, 10, 47, 47, 32, 49, 48, 46, 32, 84, 104, 101, 32, 115, 116, 114, 105, 99, 116, 32, 110, 111, 110, 45, 101, 113, 117, 97, 108, 105, 116, 121, 32, 97, 115, 115, 101, 114, 116, 105, 111, 110, 32, 116, 101, 115, 116, 115, 32, 102, 111, 114, 32, 115, 116, 114, 105, 99, 116, 32, 105, 110, 101, 113, 117, 97, 108, 105, 116, 121, 44, 32, 97, 115, 10, 47, 47, 32, 100, 101, 116, 101, 114, 109, 105, 110, 101, 100, 32, 98, 121, 32, 33, 61, 61, 46, 32, 32, 97, 115, 115, 101, 114, 116, 46, 110, 111, 116, 83, 116, 114, 105, 99, 116, 69, 113, 117, 97, 108, 40, 97, 99, 116, 117, 97, 108, 44, 32, 101, 120, 112, 101, 99, 116, 101, 100, 44, 32, 109, 101, 115, 115, 97, 103, 101, 95, 111, 112, 116, 41, 59, 10, 10, 97, 115, 115, 101, 114, 116, 46, 110, 111, 116, 83, 116, 114, 105, 99, 116, 69, 113, 117, 97, 108, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 32, 110, 111, 116, 83, 116, 114, 105, 99, 116, 69, 113, 117, 97, 108, 40, 97, 99, 116, 117, 97, 108, 44, 32, 101, 120, 112, 101, 99, 116, 101, 100, 44, 32, 109, 101, 115, 115, 97, 103, 101, 41, 32, 123, 10, 32, 32, 105, 102, 32, 40, 97, 99, 116, 117, 97, 108, 32, 61, 61, 61, 32, 101, 120, 112, 101, 99, 116, 101, 100, 41, 32, 123, 10, 32, 32, 32, 32, 102, 97, 105, 108, 40, 97, 99, 116, 117, 97, 108, 44, 32, 101, 120, 112, 101, 99, 116, 101, 100, 44, 32, 109, 101, 115, 115, 97, 103, 101, 44, 32, 39, 33, 61, 61, 39, 44, 32, 97, 115, 115, 101, 114, 116, 46, 110, 111, 116, 83, 116, 114, 105, 99, 116, 69, 113, 117, 97, 108, 41, 59, 10, 32, 32, 125, 10, 125, 59, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 101, 120, 112, 101, 99, 116, 101, 100, 69, 120, 99, 101, 112, 116, 105, 111, 110, 40, 97, 99, 116, 117, 97, 108, 44, 32, 101, 120, 112, 101, 99, 116, 101, 100, 41, 32, 123, 10, 32, 32, 105, 102, 32, 40, 33, 97, 99, 116, 117, 97, 108, 32, 124, 124, 32, 33, 101, 120, 112, 101, 99, 116, 101, 100, 41, 32, 123, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 102, 97, 108, 115, 101, 59, 10, 32, 32, 125, 10, 10, 32, 32, 105, 102, 32, 40, 79, 98, 106, 101, 99, 116, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 116, 111, 83, 116, 114, 105, 110, 103, 46, 99, 97, 108, 108, 40, 101, 120, 112, 101, 99, 116, 101, 100, 41, 32, 61, 61, 32, 39, 91, 111, 98, 106, 101, 99, 116, 32, 82, 101, 103, 69, 120, 112, 93, 39, 41, 32, 123, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 101, 120, 112, 101, 99, 116, 101, 100, 46, 116, 101, 115, 116, 40, 97, 99, 116, 117, 97, 108, 41, 59, 10, 32, 32, 125, 10, 10, 32, 32, 116, 114, 121, 32, 123, 10, 32, 32, 32, 32, 105, 102, 32, 40, 97, 99, 116, 117, 97, 108, 32, 105, 110, 115, 116, 97, 110, 99, 101, 111, 102, 32, 101, 120, 112, 101, 99, 116, 101, 100, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 116, 114, 117, 101, 59, 10, 32, 32, 32, 32, 125, 10, 32, 32, 125, 32, 99, 97, 116, 99, 104, 32, 40, 101, 41, 32, 123, 10, 32, 32, 32, 32, 47, 47, 32, 73, 103, 110, 111, 114, 101, 46, 32, 32, 84, 104, 101, 32, 105, 110, 115, 116, 97, 110, 99, 101, 111, 102, 32, 99, 104, 101, 99, 107, 32, 100, 111, 101, 115, 110, 39, 116, 32, 119, 111, 114, 107, 32, 102, 111, 114, 32, 97, 114, 114, 111, 119, 32, 102, 117, 110, 99, 116, 105, 111, 110, 115, 46, 10, 32, 32, 125, 10, 10, 32, 32, 105, 102, 32, 40, 69, 114, 114, 111, 114, 46, 105, 115, 80, 114, 111, 116, 111, 116, 121, 112, 101, 79, 102, 40, 101, 120, 112, 101, 99, 116, 101, 100, 41, 41, 32, 123, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 102, 97, 108, 115, 101, 59, 10, 32, 32, 125, 10, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 101, 120, 112, 101, 99, 116, 101, 100, 46, 99, 97, 108, 108, 40, 123, 125, 44, 32, 97, 99, 116, 117, 97, 108, 41, 32, 61, 61, 61, 32, 116, 114, 117, 101, 59, 10, 125, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 95, 116, 104, 114, 111, 119, 115, 40, 115, 104, 111, 117, 108, 100, 84, 104, 114, 111, 119, 44, 32, 98, 108, 111, 99, 107, 44, 32, 101, 120, 112, 101, 99, 116, 101, 100, 44, 32, 109, 101, 115, 115, 97, 103, 101, 41, 32, 123, 10, 32, 32, 118, 97, 114, 32, 97, 99, 116, 117, 97, 108, 59, 10, 10, 32, 32, 105, 102, 32, 40, 116, 121, 112, 101, 111, 102, 32, 98, 108, 111, 99, 107, 32, 33, 61, 61, 32, 39, 102, 117, 110, 99, 116, 105, 111, 110, 39, 41, 32, 123, 10, 32, 32, 32, 32, 116, 104, 114, 111, 119, 32, 110, 101, 119, 32, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 98, 108, 111, 99, 107, 32, 109, 117, 115, 116, 32, 98, 101, 32, 97, 32, 102, 117, 110, 99, 116, 105, 111, 110, 39, 41, 59, 10, 32, 32, 125, 10, 10, 32, 32, 105, 102, 32, 40, 116, 121, 112, 101, 111, 102, 32, 101, 120, 112, 101, 99, 116, 101, 100, 32, 61, 61, 61, 32, 39, 115, 116, 114, 105, 110, 103, 39, 41, 32, 123, 10, 32, 32, 32, 32, 109, 101, 115, 115, 97, 103, 101, 32, 61, 32, 101, 120, 112, 101, 99, 116, 101, 100, 59, 10, 32, 32, 32, 32, 101, 120, 112, 101, 99, 116, 101, 100, 32, 61, 32, 110, 117, 108, 108, 59, 10, 32, 32, 125, 10, 10, 32, 32, 116, 114, 121, 32, 123, 10, 32, 32, 32, 32, 98, 108, 111, 99, 107, 40, 41, 59, 10, 32, 32, 125, 32, 99, 97, 116, 99, 104, 32, 40, 101, 41, 32, 123, 10, 32, 32, 32, 32, 97, 99, 116, 117, 97, 108, 32, 61, 32, 101, 59, 10, 32, 32, 125, 10, 10, 32, 32, 109, 101, 115, 115, 97, 103, 101, 32, 61, 32, 40, 101, 120, 112, 101, 99, 116, 101, 100, 32, 38, 38, 32, 101, 120, 112, 101, 99, 116, 101, 100, 46, 110, 97, 109, 101, 32, 63, 32, 39, 32, 40, 39, 32, 43, 32, 101, 120, 112, 101, 99, 116, 101, 100, 46, 110, 97, 109, 101, 32, 43, 32, 39, 41, 46, 39, 32, 58, 32, 39, 46, 39, 41, 32, 43, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 40, 109, 101, 115, 115, 97, 103, 101, 32, 63, 32, 39, 32, 39, 32, 43, 32, 109, 101, 115, 115, 97, 103, 101, 32, 58, 32, 39, 46, 39, 41, 59, 10, 10, 32, 32, 105, 102, 32, 40, 115, 104, 111, 117, 108, 100, 84, 104, 114, 111, 119, 32, 38, 38, 32, 33, 97, 99, 116, 117, 97, 108, 41, 32, 123, 10, 32, 32, 32, 32, 102, 97, 105, 108, 40, 97, 99, 116, 117, 97, 108, 44, 32, 101, 120, 112, 101, 99, 116, 101, 100, 44, 32, 39, 77, 105, 115, 115, 105, 110, 103, 32, 101, 120, 112, 101, 99, 116, 101, 100, 32, 101, 120, 99, 101, 112, 116, 105, 111, 110, 39, 32, 43, 32, 109, 101, 115, 115, 97, 103, 101, 41, 59, 10, 32, 32, 125, 10, 10, 32, 32, 105, 102, 32, 40, 33, 115, 104, 111, 117, 108, 100, 84, 104, 114, 111, 119, 32, 38, 38, 32, 101, 120, 112, 101, 99, 116, 101, 100, 69, 120, 99, 101, 112, 116, 105, 111, 110, 40, 97, 99, 116, 117, 97, 108, 44, 32, 101, 120, 112, 101, 99, 116, 101, 100, 41, 41, 32, 123, 10, 32, 32, 32, 32, 102, 97, 105, 108, 40, 97, 99, 116, 117, 97, 108, 44, 32, 101, 120, 112, 101, 99, 116, 101, 100, 44, 32, 39, 71, 111, 116, 32, 117, 110, 119, 97, 110, 116, 101, 100, 32, 101, 120, 99, 101, 112, 116, 105, 111, 110, 39, 32, 43, 32, 109, 101, 115, 115, 97, 103, 101, 41, 59, 10, 32, 32, 125, 10, 10, 32, 32, 105, 102, 32, 40, 40, 115, 104, 111, 117, 108, 100, 84, 104, 114, 111, 119, 32, 38, 38, 32, 97, 99, 116, 117, 97, 108, 32, 38, 38, 32, 101, 120, 112, 101, 99, 116, 101, 100, 32, 38, 38, 10, 32, 32, 32, 32, 32, 32, 33, 101, 120, 112, 101, 99, 116, 101, 100, 69, 120, 99, 101, 112, 116, 105, 111, 110, 40, 97, 99, 116, 117, 97, 108, 44, 32, 101, 120, 112, 101, 99, 116, 101, 100, 41, 41, 32, 124, 124, 32, 40, 33, 115, 104, 111, 117, 108, 100, 84, 104, 114, 111, 119, 32, 38, 38, 32, 97, 99, 116, 117, 97, 108, 41, 41, 32, 123, 10, 32, 32, 32, 32, 116, 104, 114, 111, 119, 32, 97, 99, 116, 117, 97, 108, 59, 10, 32, 32, 125, 10, 125, 10, 10, 47, 47, 32, 49, 49, 46, 32, 69, 120, 112, 101, 99, 116, 101, 100, 32, 116, 111, 32, 116, 104, 114, 111, 119, 32, 97, 110, 32, 101, 114, 114, 111, 114, 58, 10, 47, 47, 32, 97, 115, 115, 101, 114, 116, 46, 116, 104, 114, 111, 119, 115, 40, 98, 108, 111, 99, 107, 44, 32, 69, 114, 114, 111, 114, 95, 111, 112, 116, 44, 32, 109, 101, 115, 115, 97, 103, 101, 95, 111, 112, 116, 41, 59, 10, 10, 97, 115, 115, 101, 114, 116, 46, 116, 104, 114, 111, 119, 115, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 98, 108, 111, 99, 107, 44, 32, 47, 42, 111, 112, 116, 105, 111, 110, 97, 108, 42, 47, 101, 114, 114, 111, 114, 44, 32, 47, 42, 111, 112, 116, 105, 111, 110, 97, 108, 42, 47, 109, 101, 115, 115, 97, 103, 101, 41, 32, 123, 10, 32, 32, 95, 116, 104, 114, 111, 119, 115, 46, 97, 112, 112, 108, 121, 40, 116, 104, 105, 115, 44, 32, 91, 116, 114, 117, 101, 93, 46, 99, 111, 110, 99, 97, 116, 40, 112, 83, 108, 105, 99, 101, 46, 99, 97, 108, 108, 40, 97, 114, 103, 117, 109, 101, 110, 116, 115, 41, 41, 41, 59, 10, 125, 59, 10, 10, 47, 47, 32, 69, 88, 84, 69, 78, 83, 73, 79, 78, 33, 32, 84, 104, 105, 115, 32, 105, 115, 32, 97, 110, 110, 111, 121, 105, 110, 103, 32, 116, 111, 32, 119, 114, 105, 116, 101, 32, 111, 117, 116, 115, 105, 100, 101, 32, 116, 104, 105, 115, 32, 109, 111, 100, 117, 108, 101, 46, 10, 97, 115, 115, 101, 114, 116, 46, 100, 111, 101, 115, 78, 111, 116, 84, 104, 114, 111, 119, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 98, 108, 111, 99, 107, 44, 32, 47, 42, 111, 112, 116, 105, 111, 110, 97, 108, 42, 47, 109, 101, 115, 115, 97, 103, 101, 41, 32, 123, 10, 32, 32, 95, 116, 104, 114, 111, 119, 115, 46, 97, 112, 112, 108, 121, 40, 116, 104, 105, 115, 44, 32, 91, 102, 97, 108, 115, 101, 93, 46, 99, 111, 110, 99, 97, 116, 40, 112, 83, 108, 105, 99, 101, 46, 99, 97, 108, 108, 40, 97, 114, 103, 117, 109, 101, 110, 116, 115, 41, 41, 41, 59, 10, 125, 59, 10, 10, 97, 115, 115, 101, 114, 116, 46, 105, 102, 69, 114, 114, 111, 114, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 101, 114, 114, 41, 32, 123, 32, 105, 102, 32, 40, 101, 114, 114, 41, 32, 116, 104, 114, 111, 119, 32, 101, 114, 114, 59, 32, 125, 59, 10, 0 };
 
-  const cef_char_t buffer_native[] = { 47, 47, 32, 77, 79, 68, 73, 70, 73, 69, 68, 58, 32, 108, 111, 119, 32, 108, 101, 118, 101, 108, 32, 114, 101, 112, 108, 97, 99, 101, 109, 101, 110, 116, 10, 47, 42, 32, 101, 115, 108, 105, 110, 116, 45, 100, 105, 115, 97, 98, 108, 101, 32, 114, 101, 113, 117, 105, 114, 101, 45, 98, 117, 102, 102, 101, 114, 32, 42, 47, 10, 39, 117, 115, 101, 32, 115, 116, 114, 105, 99, 116, 39, 59, 10, 10, 99, 111, 110, 115, 116, 32, 98, 105, 110, 100, 105, 110, 103, 32, 61, 32, 112, 114, 111, 99, 101, 115, 115, 46, 98, 105, 110, 100, 105, 110, 103, 40, 39, 98, 117, 102, 102, 101, 114, 39, 41, 59, 10, 99, 111, 110, 115, 116, 32, 105, 110, 116, 101, 114, 110, 97, 108, 85, 116, 105, 108, 32, 61, 32, 114, 101, 113, 117, 105, 114, 101, 40, 39, 105, 110, 116, 101, 114, 110, 97, 108, 47, 117, 116, 105, 108, 39, 41, 59, 10, 99, 111, 110, 115, 116, 32, 98, 105, 110, 100, 105, 110, 103, 79, 98, 106, 32, 61, 32, 123, 125, 59, 10, 10, 101, 120, 112, 111, 114, 116, 115, 46, 66, 117, 102, 102, 101, 114, 32, 61, 32, 66, 117, 102, 102, 101, 114, 59, 10, 101, 120, 112, 111, 114, 116, 115, 46, 83, 108, 111, 119, 66, 117, 102, 102, 101, 114, 32, 61, 32, 83, 108, 111, 119, 66, 117, 102, 102, 101, 114, 59, 10, 101, 120, 112, 111, 114, 116, 115, 46, 73, 78, 83, 80, 69, 67, 84, 95, 77, 65, 88, 95, 66, 89, 84, 69, 83, 32, 61, 32, 53, 48, 59, 10, 101, 120, 112, 111, 114, 116, 115, 46, 107, 77, 97, 120, 76, 101, 110, 103, 116, 104, 32, 61, 32, 98, 105, 110, 100, 105, 110, 103, 46, 107, 77, 97, 120, 76, 101, 110, 103, 116, 104, 59, 10, 10, 66, 117, 102, 102, 101, 114, 46, 112, 111, 111, 108, 83, 105, 122, 101, 32, 61, 32, 56, 32, 42, 32, 49, 48, 50, 52, 59, 10, 118, 97, 114, 32, 112, 111, 111, 108, 83, 105, 122, 101, 44, 32, 112, 111, 111, 108, 79, 102, 102, 115, 101, 116, 44, 32, 97, 108, 108, 111, 99, 80, 111, 111, 108, 59, 10, 10, 98, 105, 110, 100, 105, 110, 103, 46, 115, 101, 116, 117, 112, 66, 117, 102, 102, 101, 114, 74, 83, 40, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 44, 32, 98, 105, 110, 100, 105, 110, 103, 79, 98, 106, 41, 59, 10, 99, 111, 110, 115, 116, 32, 102, 108, 97, 103, 115, 32, 61, 32, 98, 105, 110, 100, 105, 110, 103, 79, 98, 106, 46, 102, 108, 97, 103, 115, 59, 10, 99, 111, 110, 115, 116, 32, 107, 78, 111, 90, 101, 114, 111, 70, 105, 108, 108, 32, 61, 32, 48, 59, 10, 10, 47, 47, 32, 78, 67, 74, 83, 58, 32, 85, 105, 110, 116, 56, 65, 114, 114, 97, 121, 45, 62, 66, 117, 102, 102, 101, 114, 87, 114, 97, 112, 10, 47, 47, 32, 66, 101, 99, 97, 117, 115, 101, 32, 67, 69, 70, 32, 100, 111, 101, 115, 32, 110, 111, 116, 32, 112, 114, 111, 118, 105, 100, 101, 115, 32, 65, 114, 114, 97, 121, 66, 117, 102, 102, 101, 114, 32, 97, 110, 100, 32, 88, 88, 88, 65, 114, 114, 97, 121, 44, 10, 47, 47, 32, 119, 101, 32, 105, 109, 112, 108, 101, 109, 101, 110, 116, 32, 97, 32, 66, 117, 102, 102, 101, 114, 87, 114, 97, 112, 32, 116, 111, 32, 109, 97, 110, 97, 103, 101, 114, 32, 109, 101, 109, 111, 114, 121, 32, 98, 105, 110, 100, 105, 110, 103, 32, 116, 111, 32, 97, 32, 66, 117, 102, 102, 101, 114, 46, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 66, 117, 102, 102, 101, 114, 87, 114, 97, 112, 40, 41, 32, 123, 125, 10, 66, 117, 102, 102, 101, 114, 87, 114, 97, 112, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 115, 117, 98, 97, 114, 114, 97, 121, 32, 61, 32, 98, 105, 110, 100, 105, 110, 103, 79, 98, 106, 46, 115, 117, 98, 97, 114, 114, 97, 121, 59, 10, 47, 47, 32, 78, 67, 74, 83, 58, 32, 85, 105, 110, 116, 56, 65, 114, 114, 97, 121, 91, 93, 32, 45, 62, 32, 66, 117, 102, 102, 101, 114, 87, 114, 97, 112, 46, 103, 101, 116, 40, 41, 47, 115, 101, 116, 40, 41, 10, 66, 117, 102, 102, 101, 114, 87, 114, 97, 112, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 103, 101, 116, 65, 116, 32, 61, 32, 98, 105, 110, 100, 105, 110, 103, 79, 98, 106, 46, 103, 101, 116, 65, 116, 59, 10, 66, 117, 102, 102, 101, 114, 87, 114, 97, 112, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 115, 101, 116, 65, 116, 32, 61, 32, 98, 105, 110, 100, 105, 110, 103, 79, 98, 106, 46, 115, 101, 116, 65, 116, 59, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 99, 114, 101, 97, 116, 101, 66, 117, 102, 102, 101, 114, 40, 115, 105, 122, 101, 41, 32, 123, 10, 32, 32, 99, 111, 110, 115, 116, 32, 117, 105, 56, 32, 61, 32, 98, 105, 110, 100, 105, 110, 103, 79, 98, 106, 46, 99, 114, 101, 97, 116, 101, 66, 117, 102, 102, 101, 114, 40, 115, 105, 122, 101, 41, 59, 10, 32, 32, 79, 98, 106, 101, 99, 116, 46, 115, 101, 116, 80, 114, 111, 116, 111, 116, 121, 112, 101, 79, 102, 40, 117, 105, 56, 44, 32, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 41, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 117, 105, 56, 59, 10, 125, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 99, 114, 101, 97, 116, 101, 80, 111, 111, 108, 40, 41, 32, 123, 10, 32, 32, 112, 111, 111, 108, 83, 105, 122, 101, 32, 61, 32, 66, 117, 102, 102, 101, 114, 46, 112, 111, 111, 108, 83, 105, 122, 101, 59, 10, 32, 32, 105, 102, 32, 40, 112, 111, 111, 108, 83, 105, 122, 101, 32, 62, 32, 48, 41, 10, 32, 32, 32, 32, 102, 108, 97, 103, 115, 91, 107, 78, 111, 90, 101, 114, 111, 70, 105, 108, 108, 93, 32, 61, 32, 49, 59, 10, 32, 32, 97, 108, 108, 111, 99, 80, 111, 111, 108, 32, 61, 32, 99, 114, 101, 97, 116, 101, 66, 117, 102, 102, 101, 114, 40, 112, 111, 111, 108, 83, 105, 122, 101, 41, 59, 10, 32, 32, 112, 111, 111, 108, 79, 102, 102, 115, 101, 116, 32, 61, 32, 48, 59, 10, 125, 10, 99, 114, 101, 97, 116, 101, 80, 111, 111, 108, 40, 41, 59, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 97, 108, 105, 103, 110, 80, 111, 111, 108, 40, 41, 32, 123, 10, 32, 32, 47, 47, 32, 69, 110, 115, 117, 114, 101, 32, 97, 108, 105, 103, 110, 101, 100, 32, 115, 108, 105, 99, 101, 115, 10, 32, 32, 105, 102, 32, 40, 112, 111, 111, 108, 79, 102, 102, 115, 101, 116, 32, 38, 32, 48, 120, 55, 41, 32, 123, 10, 32, 32, 32, 32, 112, 111, 111, 108, 79, 102, 102, 115, 101, 116, 32, 124, 61, 32, 48, 120, 55, 59, 10, 32, 32, 32, 32, 112, 111, 111, 108, 79, 102, 102, 115, 101, 116, 43, 43, 59, 10, 32, 32, 125, 10, 125, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 66, 117, 102, 102, 101, 114, 40, 97, 114, 103, 44, 32, 101, 110, 99, 111, 100, 105, 110, 103, 41, 32, 123, 10, 32, 32, 47, 47, 32, 67, 111, 109, 109, 111, 110, 32, 99, 97, 115, 101, 46, 10, 32, 32, 105, 102, 32, 40, 116, 121, 112, 101, 111, 102, 32, 97, 114, 103, 32, 61, 61, 61, 32, 39, 110, 117, 109, 98, 101, 114, 39, 41, 32, 123, 10, 32, 32, 32, 32, 47, 47, 32, 73, 102, 32, 108, 101, 115, 115, 32, 116, 104, 97, 110, 32, 122, 101, 114, 111, 44, 32, 111, 114, 32, 78, 97, 78, 46, 10, 32, 32, 32, 32, 105, 102, 32, 40, 97, 114, 103, 32, 60, 32, 48, 32, 124, 124, 32, 97, 114, 103, 32, 33, 61, 61, 32, 97, 114, 103, 41, 10, 32, 32, 32, 32, 32, 32, 97, 114, 103, 32, 61, 32, 48, 59, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 97, 108, 108, 111, 99, 97, 116, 101, 40, 97, 114, 103, 41, 59, 10, 32, 32, 125, 10, 10, 32, 32, 47, 47, 32, 83, 108, 105, 103, 104, 116, 108, 121, 32, 108, 101, 115, 115, 32, 99, 111, 109, 109, 111, 110, 32, 99, 97, 115, 101, 46, 10, 32, 32, 105, 102, 32, 40, 116, 121, 112, 101, 111, 102, 32, 97, 114, 103, 32, 61, 61, 61, 32, 39, 115, 116, 114, 105, 110, 103, 39, 41, 32, 123, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 102, 114, 111, 109, 83, 116, 114, 105, 110, 103, 40, 97, 114, 103, 44, 32, 101, 110, 99, 111, 100, 105, 110, 103, 41, 59, 10, 32, 32, 125, 10, 10, 32, 32, 47, 47, 32, 85, 110, 117, 115, 117, 97, 108, 46, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 102, 114, 111, 109, 79, 98, 106, 101, 99, 116, 40, 97, 114, 103, 41, 59, 10, 125, 10, 10, 79, 98, 106, 101, 99, 116, 46, 115, 101, 116, 80, 114, 111, 116, 111, 116, 121, 112, 101, 79, 102, 40, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 44, 32, 66, 117, 102, 102, 101, 114, 87, 114, 97, 112, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 41, 59, 10, 79, 98, 106, 101, 99, 116, 46, 115, 101, 116, 80, 114, 111, 116, 111, 116, 121, 112, 101, 79, 102, 40, 66, 117, 102, 102, 101, 114, 44, 32, 66, 117, 102, 102, 101, 114, 87, 114, 97, 112, 41, 59, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 83, 108, 111, 119, 66, 117, 102, 102, 101, 114, 40, 108, 101, 110, 103, 116, 104, 41, 32, 123, 10, 32, 32, 105, 102, 32, 40, 43, 108, 101, 110, 103, 116, 104, 32, 33, 61, 32, 108, 101, 110, 103, 116, 104, 41, 10, 32, 32, 32, 32, 108, 101, 110, 103, 116, 104, 32, 61, 32, 48, 59, 10, 32, 32, 105, 102, 32, 40, 108, 101, 110, 103, 116, 104, 32, 62, 32, 48, 41, 10, 32, 32, 32, 32, 102, 108, 97, 103, 115, 91, 107, 78, 111, 90, 101, 114, 111, 70, 105, 108, 108, 93, 32, 61, 32, 49, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 99, 114, 101, 97, 116, 101, 66, 117, 102, 102, 101, 114, 40, 43, 108, 101, 110, 103, 116, 104, 41, 59, 10, 125, 10, 10, 79, 98, 106, 101, 99, 116, 46, 115, 101, 116, 80, 114, 111, 116, 111, 116, 121, 112, 101, 79, 102, 40, 83, 108, 111, 119, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 44, 32, 66, 117, 102, 102, 101, 114, 87, 114, 97, 112, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 41, 59, 10, 79, 98, 106, 101, 99, 116, 46, 115, 101, 116, 80, 114, 111, 116, 111, 116, 121, 112, 101, 79, 102, 40, 83, 108, 111, 119, 66, 117, 102, 102, 101, 114, 44, 32, 66, 117, 102, 102, 101, 114, 87, 114, 97, 112, 41, 59, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 97, 108, 108, 111, 99, 97, 116, 101, 40, 115, 105, 122, 101, 41, 32, 123, 10, 32, 32, 105, 102, 32, 40, 115, 105, 122, 101, 32, 61, 61, 61, 32, 48, 41, 32, 123, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 99, 114, 101, 97, 116, 101, 66, 117, 102, 102, 101, 114, 40, 115, 105, 122, 101, 41, 59, 10, 32, 32, 125, 10, 32, 32, 105, 102, 32, 40, 115, 105, 122, 101, 32, 60, 32, 40, 66, 117, 102, 102, 101, 114, 46, 112, 111, 111, 108, 83, 105, 122, 101, 32, 62, 62, 62, 32, 49, 41, 41, 32, 123, 10, 32, 32, 32, 32, 105, 102, 32, 40, 115, 105, 122, 101, 32, 62, 32, 40, 112, 111, 111, 108, 83, 105, 122, 101, 32, 45, 32, 112, 111, 111, 108, 79, 102, 102, 115, 101, 116, 41, 41, 10, 32, 32, 32, 32, 32, 32, 99, 114, 101, 97, 116, 101, 80, 111, 111, 108, 40, 41, 59, 10, 32, 32, 32, 32, 118, 97, 114, 32, 98, 32, 61, 32, 97, 108, 108, 111, 99, 80, 111, 111, 108, 46, 115, 108, 105, 99, 101, 40, 112, 111, 111, 108, 79, 102, 102, 115, 101, 116, 44, 32, 112, 111, 111, 108, 79, 102, 102, 115, 101, 116, 32, 43, 32, 115, 105, 122, 101, 41, 59, 10, 32, 32, 32, 32, 112, 111, 111, 108, 79, 102, 102, 115, 101, 116, 32, 43, 61, 32, 115, 105, 122, 101, 59, 10, 32, 32, 32, 32, 97, 108, 105, 103, 110, 80, 111, 111, 108, 40, 41, 59, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 98, 59, 10, 32, 32, 125, 32, 101, 108, 115, 101, 32, 123, 10, 32, 32, 32, 32, 47, 47, 32, 69, 118, 101, 110, 32, 116, 104, 111, 117, 103, 104, 32, 116, 104, 105, 115, 32, 105, 115, 32, 99, 104, 101, 99, 107, 101, 100, 32, 97, 98, 111, 118, 101, 44, 32, 116, 104, 101, 32, 99, 111, 110, 100, 105, 116, 105, 111, 110, 97, 108, 32, 105, 115, 32, 97, 32, 115, 97, 102, 101, 116, 121, 32, 110, 101, 116, 32, 97, 110, 100, 10, 32, 32, 32, 32, 47, 47, 32, 115, 97, 110, 105, 116, 121, 32, 99, 104, 101, 99, 107, 32, 116, 111, 32, 112, 114, 101, 118, 101, 110, 116, 32, 97, 110, 121, 32, 115, 117, 98, 115, 101, 113, 117, 101, 110, 116, 32, 116, 121, 112, 101, 100, 32, 97, 114, 114, 97, 121, 32, 97, 108, 108, 111, 99, 97, 116, 105, 111, 110, 32, 102, 114, 111, 109, 32, 110, 111, 116, 10, 32, 32, 32, 32, 47, 47, 32, 98, 101, 105, 110, 103, 32, 122, 101, 114, 111, 32, 102, 105, 108, 108, 101, 100, 46, 10, 32, 32, 32, 32, 105, 102, 32, 40, 115, 105, 122, 101, 32, 62, 32, 48, 41, 10, 32, 32, 32, 32, 32, 32, 102, 108, 97, 103, 115, 91, 107, 78, 111, 90, 101, 114, 111, 70, 105, 108, 108, 93, 32, 61, 32, 49, 59, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 99, 114, 101, 97, 116, 101, 66, 117, 102, 102, 101, 114, 40, 115, 105, 122, 101, 41, 59, 10, 32, 32, 125, 10, 125, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 102, 114, 111, 109, 83, 116, 114, 105, 110, 103, 40, 115, 116, 114, 105, 110, 103, 44, 32, 101, 110, 99, 111, 100, 105, 110, 103, 41, 32, 123, 10, 32, 32, 105, 102, 32, 40, 116, 121, 112, 101, 111, 102, 32, 101, 110, 99, 111, 100, 105, 110, 103, 32, 33, 61, 61, 32, 39, 115, 116, 114, 105, 110, 103, 39, 32, 124, 124, 32, 101, 110, 99, 111, 100, 105, 110, 103, 32, 61, 61, 61, 32, 39, 39, 41, 10, 32, 32, 32, 32, 101, 110, 99, 111, 100, 105, 110, 103, 32, 61, 32, 39, 117, 116, 102, 56, 39, 59, 10, 10, 32, 32, 118, 97, 114, 32, 108, 101, 110, 103, 116, 104, 32, 61, 32, 98, 121, 116, 101, 76, 101, 110, 103, 116, 104, 40, 115, 116, 114, 105, 110, 103, 44, 32, 101, 110, 99, 111, 100, 105, 110, 103, 41, 59, 10, 32, 32, 105, 102, 32, 40, 108, 101, 110, 103, 116, 104, 32, 62, 61, 32, 40, 66, 117, 102, 102, 101, 114, 46, 112, 111, 111, 108, 83, 105, 122, 101, 32, 62, 62, 62, 32, 49, 41, 41, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 98, 105, 110, 100, 105, 110, 103, 46, 99, 114, 101, 97, 116, 101, 70, 114, 111, 109, 83, 116, 114, 105, 110, 103, 40, 115, 116, 114, 105, 110, 103, 44, 32, 101, 110, 99, 111, 100, 105, 110, 103, 41, 59, 10, 10, 32, 32, 105, 102, 32, 40, 108, 101, 110, 103, 116, 104, 32, 62, 32, 40, 112, 111, 111, 108, 83, 105, 122, 101, 32, 45, 32, 112, 111, 111, 108, 79, 102, 102, 115, 101, 116, 41, 41, 10, 32, 32, 32, 32, 99, 114, 101, 97, 116, 101, 80, 111, 111, 108, 40, 41, 59, 10, 32, 32, 118, 97, 114, 32, 97, 99, 116, 117, 97, 108, 32, 61, 32, 97, 108, 108, 111, 99, 80, 111, 111, 108, 46, 119, 114, 105, 116, 101, 40, 115, 116, 114, 105, 110, 103, 44, 32, 112, 111, 111, 108, 79, 102, 102, 115, 101, 116, 44, 32, 101, 110, 99, 111, 100, 105, 110, 103, 41, 59, 10, 32, 32, 118, 97, 114, 32, 98, 32, 61, 32, 97, 108, 108, 111, 99, 80, 111, 111, 108, 46, 115, 108, 105, 99, 101, 40, 112, 111, 111, 108, 79, 102, 102, 115, 101, 116, 44, 32, 112, 111, 111, 108, 79, 102, 102, 115, 101, 116, 32, 43, 32, 97, 99, 116, 117, 97, 108, 41, 59, 10, 32, 32, 112, 111, 111, 108, 79, 102, 102, 115, 101, 116, 32, 43, 61, 32, 97, 99, 116, 117, 97, 108, 59, 10, 32, 32, 97, 108, 105, 103, 110, 80, 111, 111, 108, 40, 41, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 98, 59, 10, 125, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 102, 114, 111, 109, 79, 98, 106, 101, 99, 116, 40, 111, 98, 106, 41, 32, 123, 10, 32, 32, 105, 102, 32, 40, 111, 98, 106, 32, 105, 110, 115, 116, 97, 110, 99, 101, 111, 102, 32, 66, 117, 102, 102, 101, 114, 41, 32, 123, 10, 32, 32, 32, 32, 118, 97, 114, 32, 98, 32, 61, 32, 97, 108, 108, 111, 99, 97, 116, 101, 40, 111, 98, 106, 46, 108, 101, 110, 103, 116, 104, 41, 59, 10, 10, 32, 32, 32, 32, 105, 102, 32, 40, 98, 46, 108, 101, 110, 103, 116, 104, 32, 61, 61, 61, 32, 48, 41, 10, 32, 32, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 98, 59, 10, 10, 32, 32, 32, 32, 111, 98, 106, 46, 99, 111, 112, 121, 40, 98, 44, 32, 48, 44, 32, 48, 44, 32, 111, 98, 106, 46, 108, 101, 110, 103, 116, 104, 41, 59, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 98, 59, 10, 32, 32, 125, 10, 10, 32, 32, 105, 102, 32, 40, 65, 114, 114, 97, 121, 46, 105, 115, 65, 114, 114, 97, 121, 40, 111, 98, 106, 41, 41, 32, 123, 10, 32, 32, 32, 32, 118, 97, 114, 32, 108, 101, 110, 103, 116, 104, 32, 61, 32, 111, 98, 106, 46, 108, 101, 110, 103, 116, 104, 59, 10, 32, 32, 32, 32, 118, 97, 114, 32, 98, 32, 61, 32, 97, 108, 108, 111, 99, 97, 116, 101, 40, 108, 101, 110, 103, 116, 104, 41, 59, 10, 32, 32, 32, 32, 102, 111, 114, 32, 40, 118, 97, 114, 32, 105, 32, 61, 32, 48, 59, 32, 105, 32, 60, 32, 108, 101, 110, 103, 116, 104, 59, 32, 105, 43, 43, 41, 10, 32, 32, 32, 32, 32, 32, 98, 46, 115, 101, 116, 65, 116, 40, 105, 44, 32, 111, 98, 106, 91, 105, 93, 32, 38, 32, 50, 53, 53, 41, 59, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 98, 59, 10, 32, 32, 125, 10, 10, 32, 32, 105, 102, 32, 40, 111, 98, 106, 32, 61, 61, 32, 110, 117, 108, 108, 41, 32, 123, 10, 32, 32, 32, 32, 116, 104, 114, 111, 119, 32, 110, 101, 119, 32, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 109, 117, 115, 116, 32, 115, 116, 97, 114, 116, 32, 119, 105, 116, 104, 32, 110, 117, 109, 98, 101, 114, 44, 32, 98, 117, 102, 102, 101, 114, 44, 32, 97, 114, 114, 97, 121, 32, 111, 114, 32, 115, 116, 114, 105, 110, 103, 39, 41, 59, 10, 32, 32, 125, 10, 10, 32, 32, 105, 102, 32, 40, 111, 98, 106, 32, 105, 110, 115, 116, 97, 110, 99, 101, 111, 102, 32, 65, 114, 114, 97, 121, 66, 117, 102, 102, 101, 114, 41, 32, 123, 10, 32, 32, 32, 32, 47, 47, 32, 78, 67, 74, 83, 58, 32, 67, 69, 70, 32, 100, 111, 101, 115, 32, 110, 111, 116, 32, 115, 117, 112, 112, 111, 114, 116, 32, 65, 114, 114, 97, 121, 66, 117, 102, 102, 101, 114, 44, 32, 99, 111, 110, 118, 101, 114, 116, 32, 111, 98, 106, 32, 116, 111, 32, 85, 105, 110, 116, 56, 65, 114, 114, 97, 121, 10, 32, 32, 32, 32, 111, 98, 106, 32, 61, 32, 110, 101, 119, 32, 85, 105, 110, 116, 56, 65, 114, 114, 97, 121, 40, 111, 98, 106, 41, 59, 10, 32, 32, 125, 10, 10, 32, 32, 105, 102, 32, 40, 111, 98, 106, 46, 98, 117, 102, 102, 101, 114, 32, 105, 110, 115, 116, 97, 110, 99, 101, 111, 102, 32, 65, 114, 114, 97, 121, 66, 117, 102, 102, 101, 114, 32, 124, 124, 32, 111, 98, 106, 46, 108, 101, 110, 103, 116, 104, 41, 32, 123, 10, 32, 32, 32, 32, 118, 97, 114, 32, 108, 101, 110, 103, 116, 104, 59, 10, 32, 32, 32, 32, 105, 102, 32, 40, 116, 121, 112, 101, 111, 102, 32, 111, 98, 106, 46, 108, 101, 110, 103, 116, 104, 32, 33, 61, 61, 32, 39, 110, 117, 109, 98, 101, 114, 39, 32, 124, 124, 32, 111, 98, 106, 46, 108, 101, 110, 103, 116, 104, 32, 33, 61, 61, 32, 111, 98, 106, 46, 108, 101, 110, 103, 116, 104, 41, 10, 32, 32, 32, 32, 32, 32, 108, 101, 110, 103, 116, 104, 32, 61, 32, 48, 59, 10, 32, 32, 32, 32, 101, 108, 115, 101, 10, 32, 32, 32, 32, 32, 32, 108, 101, 110, 103, 116, 104, 32, 61, 32, 111, 98, 106, 46, 108, 101, 110, 103, 116, 104, 59, 10, 32, 32, 32, 32, 118, 97, 114, 32, 98, 32, 61, 32, 97, 108, 108, 111, 99, 97, 116, 101, 40, 108, 101, 110, 103, 116, 104, 41, 59, 10, 32, 32, 32, 32, 102, 111, 114, 32, 40, 118, 97, 114, 32, 105, 32, 61, 32, 48, 59, 32, 105, 32, 60, 32, 108, 101, 110, 103, 116, 104, 59, 32, 105, 43, 43, 41, 10, 32, 32, 32, 32, 32, 32, 98, 46, 115, 101, 116, 65, 116, 40, 105, 44, 32, 111, 98, 106, 91, 105, 93, 32, 38, 32, 50, 53, 53, 41, 59, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 98, 59, 10, 32, 32, 125, 10, 10, 32, 32, 105, 102, 32, 40, 111, 98, 106, 46, 116, 121, 112, 101, 32, 61, 61, 61, 32, 39, 66, 117, 102, 102, 101, 114, 39, 32, 38, 38, 32, 65, 114, 114, 97, 121, 46, 105, 115, 65, 114, 114, 97, 121, 40, 111, 98, 106, 46, 100, 97, 116, 97, 41, 41, 32, 123, 10, 32, 32, 32, 32, 118, 97, 114, 32, 97, 114, 114, 97, 121, 32, 61, 32, 111, 98, 106, 46, 100, 97, 116, 97, 59, 10, 32, 32, 32, 32, 118, 97, 114, 32, 98, 32, 61, 32, 97, 108, 108, 111, 99, 97, 116, 101, 40, 97, 114, 114, 97, 121, 46, 108, 101, 110, 103, 116, 104, 41, 59, 10, 32, 32, 32, 32, 102, 111, 114, 32, 40, 118, 97, 114, 32, 105, 32, 61, 32, 48, 59, 32, 105, 32, 60, 32, 97, 114, 114, 97, 121, 46, 108, 101, 110, 103, 116, 104, 59, 32, 105, 43, 43, 41, 10, 32, 32, 32, 32, 32, 32, 98, 46, 115, 101, 116, 65, 116, 40, 105, 44, 32, 97, 114, 114, 97, 121, 91, 105, 93, 32, 38, 32, 50, 53, 53, 41, 59, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 98, 59, 10, 32, 32, 125, 10, 10, 32, 32, 116, 104, 114, 111, 119, 32, 110, 101, 119, 32, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 109, 117, 115, 116, 32, 115, 116, 97, 114, 116, 32, 119, 105, 116, 104, 32, 110, 117, 109, 98, 101, 114, 44, 32, 98, 117, 102, 102, 101, 114, 44, 32, 97, 114, 114, 97, 121, 32, 111, 114, 32, 115, 116, 114, 105, 110, 103, 39, 41, 59, 10, 125, 10, 10, 10, 47, 47, 32, 83, 116, 97, 116, 105, 99, 32, 109, 101, 116, 104, 111, 100, 115, 10, 10, 66, 117, 102, 102, 101, 114, 46, 105, 115, 66, 117, 102, 102, 101, 114, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 32, 105, 115, 66, 117, 102, 102, 101, 114, 40, 98, 41, 32, 123, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 98, 32, 105, 110, 115, 116, 97, 110, 99, 101, 111, 102, 32, 66, 117, 102, 102, 101, 114, 59, 10, 125, 59, 10, 10, 10, 66, 117, 102, 102, 101, 114, 46, 99, 111, 109, 112, 97, 114, 101, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 32, 99, 111, 109, 112, 97, 114, 101, 40, 97, 44, 32, 98, 41, 32, 123, 10, 32, 32, 105, 102, 32, 40, 33, 40, 97, 32, 105, 110, 115, 116, 97, 110, 99, 101, 111, 102, 32, 66, 117, 102, 102, 101, 114, 41, 32, 124, 124, 10, 32, 32, 32, 32, 32, 32, 33, 40, 98, 32, 105, 110, 115, 116, 97, 110, 99, 101, 111, 102, 32, 66, 117, 102, 102, 101, 114, 41, 41, 32, 123, 10, 32, 32, 32, 32, 116, 104, 114, 111, 119, 32, 110, 101, 119, 32, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 65, 114, 103, 117, 109, 101, 110, 116, 115, 32, 109, 117, 115, 116, 32, 98, 101, 32, 66, 117, 102, 102, 101, 114, 115, 39, 41, 59, 10, 32, 32, 125, 10, 10, 32, 32, 105, 102, 32, 40, 97, 32, 61, 61, 61, 32, 98, 41, 32, 123, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 48, 59, 10, 32, 32, 125, 10, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 98, 105, 110, 100, 105, 110, 103, 46, 99, 111, 109, 112, 97, 114, 101, 40, 97, 44, 32, 98, 41, 59, 10, 125, 59, 10, 10, 10, 66, 117, 102, 102, 101, 114, 46, 105, 115, 69, 110, 99, 111, 100, 105, 110, 103, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 101, 110, 99, 111, 100, 105, 110, 103, 41, 32, 123, 10, 32, 32, 118, 97, 114, 32, 108, 111, 119, 101, 114, 101, 100, 67, 97, 115, 101, 32, 61, 32, 102, 97, 108, 115, 101, 59, 10, 32, 32, 102, 111, 114, 32, 40, 59, 59, 41, 32, 123, 10, 32, 32, 32, 32, 115, 119, 105, 116, 99, 104, 32, 40, 101, 110, 99, 111, 100, 105, 110, 103, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 104, 101, 120, 39, 58, 10, 32, 32, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 117, 116, 102, 56, 39, 58, 10, 32, 32, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 117, 116, 102, 45, 56, 39, 58, 10, 32, 32, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 97, 115, 99, 105, 105, 39, 58, 10, 32, 32, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 98, 105, 110, 97, 114, 121, 39, 58, 10, 32, 32, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 98, 97, 115, 101, 54, 52, 39, 58, 10, 32, 32, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 117, 99, 115, 50, 39, 58, 10, 32, 32, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 117, 99, 115, 45, 50, 39, 58, 10, 32, 32, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 117, 116, 102, 49, 54, 108, 101, 39, 58, 10, 32, 32, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 117, 116, 102, 45, 49, 54, 108, 101, 39, 58, 10, 32, 32, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 114, 97, 119, 39, 58, 10, 32, 32, 32, 32, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 116, 114, 117, 101, 59, 10, 10, 32, 32, 32, 32, 32, 32, 100, 101, 102, 97, 117, 108, 116, 58, 10, 32, 32, 32, 32, 32, 32, 32, 32, 105, 102, 32, 40, 108, 111, 119, 101, 114, 101, 100, 67, 97, 115, 101, 41, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 102, 97, 108, 115, 101, 59, 10, 32, 32, 32, 32, 32, 32, 32, 32, 101, 110, 99, 111, 100, 105, 110, 103, 32, 61, 32, 40, 39, 39, 32, 43, 32, 101, 110, 99, 111, 100, 105, 110, 103, 41, 46, 116, 111, 76, 111, 119, 101, 114, 67, 97, 115, 101, 40, 41, 59, 10, 32, 32, 32, 32, 32, 32, 32, 32, 108, 111, 119, 101, 114, 101, 100, 67, 97, 115, 101, 32, 61, 32, 116, 114, 117, 101, 59, 10, 32, 32, 32, 32, 125, 10, 32, 32, 125, 10, 125, 59, 10, 10, 10, 66, 117, 102, 102, 101, 114, 46, 99, 111, 110, 99, 97, 116, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 108, 105, 115, 116, 44, 32, 108, 101, 110, 103, 116, 104, 41, 32, 123, 10, 32, 32, 105, 102, 32, 40, 33, 65, 114, 114, 97, 121, 46, 105, 115, 65, 114, 114, 97, 121, 40, 108, 105, 115, 116, 41, 41, 10, 32, 32, 32, 32, 116, 104, 114, 111, 119, 32, 110, 101, 119, 32, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 108, 105, 115, 116, 32, 97, 114, 103, 117, 109, 101, 110, 116, 32, 109, 117, 115, 116, 32, 98, 101, 32, 97, 110, 32, 65, 114, 114, 97, 121, 32, 111, 102, 32, 66, 117, 102, 102, 101, 114, 115, 46, 39, 41, 59, 10, 10, 32, 32, 105, 102, 32, 40, 108, 105, 115, 116, 46, 108, 101, 110, 103, 116, 104, 32, 61, 61, 61, 32, 48, 41, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 110, 101, 119, 32, 66, 117, 102, 102, 101, 114, 40, 48, 41, 59, 10, 10, 32, 32, 105, 102, 32, 40, 108, 101, 110, 103, 116, 104, 32, 61, 61, 61, 32, 117, 110, 100, 101, 102, 105, 110, 101, 100, 41, 32, 123, 10, 32, 32, 32, 32, 108, 101, 110, 103, 116, 104, 32, 61, 32, 48, 59, 10, 32, 32, 32, 32, 102, 111, 114, 32, 40, 118, 97, 114, 32, 105, 32, 61, 32, 48, 59, 32, 105, 32, 60, 32, 108, 105, 115, 116, 46, 108, 101, 110, 103, 116, 104, 59, 32, 105, 43, 43, 41, 10, 32, 32, 32, 32, 32, 32, 108, 101, 110, 103, 116, 104, 32, 43, 61, 32, 108, 105, 115, 116, 91, 105, 93, 46, 108, 101, 110, 103, 116, 104, 59, 10, 32, 32, 125, 32, 101, 108, 115, 101, 32, 123, 10, 32, 32, 32, 32, 108, 101, 110, 103, 116, 104, 32, 61, 32, 108, 101, 110, 103, 116, 104, 32, 62, 62, 62, 32, 48, 59, 10, 32, 32, 125, 10, 10, 32, 32, 118, 97, 114, 32, 98, 117, 102, 102, 101, 114, 32, 61, 32, 110, 101, 119, 32, 66, 117, 102, 102, 101, 114, 40, 108, 101, 110, 103, 116, 104, 41, 59, 10, 32, 32, 118, 97, 114, 32, 112, 111, 115, 32, 61, 32, 48, 59, 10, 32, 32, 102, 111, 114, 32, 40, 118, 97, 114, 32, 105, 32, 61, 32, 48, 59, 32, 105, 32, 60, 32, 108, 105, 115, 116, 46, 108, 101, 110, 103, 116, 104, 59, 32, 105, 43, 43, 41, 32, 123, 10, 32, 32, 32, 32, 118, 97, 114, 32, 98, 117, 102, 32, 61, 32, 108, 105, 115, 116, 91, 105, 93, 59, 10, 32, 32, 32, 32, 98, 117, 102, 46, 99, 111, 112, 121, 40, 98, 117, 102, 102, 101, 114, 44, 32, 112, 111, 115, 41, 59, 10, 32, 32, 32, 32, 112, 111, 115, 32, 43, 61, 32, 98, 117, 102, 46, 108, 101, 110, 103, 116, 104, 59, 10, 32, 32, 125, 10, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 98, 117, 102, 102, 101, 114, 59, 10, 125, 59, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 98, 97, 115, 101, 54, 52, 66, 121, 116, 101, 76, 101, 110, 103, 116, 104, 40, 115, 116, 114, 44, 32, 98, 121, 116, 101, 115, 41, 32, 123, 10, 32, 32, 47, 47, 32, 72, 97, 110, 100, 108, 101, 32, 112, 97, 100, 100, 105, 110, 103, 10, 32, 32, 105, 102, 32, 40, 115, 116, 114, 46, 99, 104, 97, 114, 67, 111, 100, 101, 65, 116, 40, 98, 121, 116, 101, 115, 32, 45, 32, 49, 41, 32, 61, 61, 61, 32, 48, 120, 51, 68, 41, 10, 32, 32, 32, 32, 98, 121, 116, 101, 115, 45, 45, 59, 10, 32, 32, 105, 102, 32, 40, 98, 121, 116, 101, 115, 32, 62, 32, 49, 32, 38, 38, 32, 115, 116, 114, 46, 99, 104, 97, 114, 67, 111, 100, 101, 65, 116, 40, 98, 121, 116, 101, 115, 32, 45, 32, 49, 41, 32, 61, 61, 61, 32, 48, 120, 51, 68, 41, 10, 32, 32, 32, 32, 98, 121, 116, 101, 115, 45, 45, 59, 10, 10, 32, 32, 47, 47, 32, 66, 97, 115, 101, 54, 52, 32, 114, 97, 116, 105, 111, 58, 32, 51, 47, 52, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 40, 98, 121, 116, 101, 115, 32, 42, 32, 51, 41, 32, 62, 62, 62, 32, 50, 59, 10, 125, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 98, 121, 116, 101, 76, 101, 110, 103, 116, 104, 40, 115, 116, 114, 105, 110, 103, 44, 32, 101, 110, 99, 111, 100, 105, 110, 103, 41, 32, 123, 10, 32, 32, 105, 102, 32, 40, 115, 116, 114, 105, 110, 103, 32, 105, 110, 115, 116, 97, 110, 99, 101, 111, 102, 32, 66, 117, 102, 102, 101, 114, 41, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 115, 116, 114, 105, 110, 103, 46, 108, 101, 110, 103, 116, 104, 59, 10, 10, 32, 32, 105, 102, 32, 40, 116, 121, 112, 101, 111, 102, 32, 115, 116, 114, 105, 110, 103, 32, 33, 61, 61, 32, 39, 115, 116, 114, 105, 110, 103, 39, 41, 10, 32, 32, 32, 32, 115, 116, 114, 105, 110, 103, 32, 61, 32, 39, 39, 32, 43, 32, 115, 116, 114, 105, 110, 103, 59, 10, 10, 32, 32, 118, 97, 114, 32, 108, 101, 110, 32, 61, 32, 115, 116, 114, 105, 110, 103, 46, 108, 101, 110, 103, 116, 104, 59, 10, 32, 32, 105, 102, 32, 40, 108, 101, 110, 32, 61, 61, 61, 32, 48, 41, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 48, 59, 10, 10, 32, 32, 47, 47, 32, 85, 115, 101, 32, 97, 32, 102, 111, 114, 32, 108, 111, 111, 112, 32, 116, 111, 32, 97, 118, 111, 105, 100, 32, 114, 101, 99, 117, 114, 115, 105, 111, 110, 10, 32, 32, 118, 97, 114, 32, 108, 111, 119, 101, 114, 101, 100, 67, 97, 115, 101, 32, 61, 32, 102, 97, 108, 115, 101, 59, 10, 32, 32, 102, 111, 114, 32, 40, 59, 59, 41, 32, 123, 10, 32, 32, 32, 32, 115, 119, 105, 116, 99, 104, 32, 40, 101, 110, 99, 111, 100, 105, 110, 103, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 97, 115, 99, 105, 105, 39, 58, 10, 32, 32, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 98, 105, 110, 97, 114, 121, 39, 58, 10, 32, 32, 32, 32, 32, 32, 47, 47, 32, 68, 101, 112, 114, 101, 99, 97, 116, 101, 100, 10, 32, 32, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 114, 97, 119, 39, 58, 10, 32, 32, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 114, 97, 119, 115, 39, 58, 10, 32, 32, 32, 32, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 108, 101, 110, 59, 10, 10, 32, 32, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 117, 116, 102, 56, 39, 58, 10, 32, 32, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 117, 116, 102, 45, 56, 39, 58, 10, 32, 32, 32, 32, 32, 32, 99, 97, 115, 101, 32, 117, 110, 100, 101, 102, 105, 110, 101, 100, 58, 10, 32, 32, 32, 32, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 98, 105, 110, 100, 105, 110, 103, 46, 98, 121, 116, 101, 76, 101, 110, 103, 116, 104, 85, 116, 102, 56, 40, 115, 116, 114, 105, 110, 103, 41, 59, 10, 10, 32, 32, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 117, 99, 115, 50, 39, 58, 10, 32, 32, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 117, 99, 115, 45, 50, 39, 58, 10, 32, 32, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 117, 116, 102, 49, 54, 108, 101, 39, 58, 10, 32, 32, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 117, 116, 102, 45, 49, 54, 108, 101, 39, 58, 10, 32, 32, 32, 32, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 108, 101, 110, 32, 42, 32, 50, 59, 10, 10, 32, 32, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 104, 101, 120, 39, 58, 10, 32, 32, 32, 32, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 108, 101, 110, 32, 62, 62, 62, 32, 49, 59, 10, 10, 32, 32, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 98, 97, 115, 101, 54, 52, 39, 58, 10, 32, 32, 32, 32, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 98, 97, 115, 101, 54, 52, 66, 121, 116, 101, 76, 101, 110, 103, 116, 104, 40, 115, 116, 114, 105, 110, 103, 44, 32, 108, 101, 110, 41, 59, 10, 10, 32, 32, 32, 32, 32, 32, 100, 101, 102, 97, 117, 108, 116, 58, 10, 32, 32, 32, 32, 32, 32, 32, 32, 47, 47, 32, 84, 104, 101, 32, 67, 43, 43, 32, 98, 105, 110, 100, 105, 110, 103, 32, 100, 101, 102, 97, 117, 108, 116, 101, 100, 32, 116, 111, 32, 85, 84, 70, 56, 44, 32, 119, 101, 32, 115, 104, 111, 117, 108, 100, 32, 116, 111, 111, 46, 10, 32, 32, 32, 32, 32, 32, 32, 32, 105, 102, 32, 40, 108, 111, 119, 101, 114, 101, 100, 67, 97, 115, 101, 41, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 98, 105, 110, 100, 105, 110, 103, 46, 98, 121, 116, 101, 76, 101, 110, 103, 116, 104, 85, 116, 102, 56, 40, 115, 116, 114, 105, 110, 103, 41, 59, 10, 10, 32, 32, 32, 32, 32, 32, 32, 32, 101, 110, 99, 111, 100, 105, 110, 103, 32, 61, 32, 40, 39, 39, 32, 43, 32, 101, 110, 99, 111, 100, 105, 110, 103, 41, 46, 116, 111, 76, 111, 119, 101, 114, 67, 97, 115, 101, 40, 41, 59, 10, 32, 32, 32, 32, 32, 32, 32, 32, 108, 111, 119, 101, 114, 101, 100, 67, 97, 115, 101, 32, 61, 32, 116, 114, 117, 101, 59, 10, 32, 32, 32, 32, 125, 10, 32, 32, 125, 10, 125, 10, 10, 66, 117, 102, 102, 101, 114, 46, 98, 121, 116, 101, 76, 101, 110, 103, 116, 104, 32, 61, 32, 98, 121, 116, 101, 76, 101, 110, 103, 116, 104, 59, 10, 10, 10, 47, 47, 32, 70, 111, 114, 32, 98, 97, 99, 107, 119, 97, 114, 100, 115, 32, 99, 111, 109, 112, 97, 116, 105, 98, 105, 108, 105, 116, 121, 46, 10, 79, 98, 106, 101, 99, 116, 46, 100, 101, 102, 105, 110, 101, 80, 114, 111, 112, 101, 114, 116, 121, 40, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 44, 32, 39, 112, 97, 114, 101, 110, 116, 39, 44, 32, 123, 10, 32, 32, 101, 110, 117, 109, 101, 114, 97, 98, 108, 101, 58, 32, 116, 114, 117, 101, 44, 10, 32, 32, 103, 101, 116, 58, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 32, 123, 10, 32, 32, 32, 32, 105, 102, 32, 40, 33, 40, 116, 104, 105, 115, 32, 105, 110, 115, 116, 97, 110, 99, 101, 111, 102, 32, 66, 117, 102, 102, 101, 114, 41, 41, 10, 32, 32, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 117, 110, 100, 101, 102, 105, 110, 101, 100, 59, 10, 32, 32, 32, 32, 105, 102, 32, 40, 116, 104, 105, 115, 46, 98, 121, 116, 101, 76, 101, 110, 103, 116, 104, 32, 61, 61, 61, 32, 48, 32, 124, 124, 10, 32, 32, 32, 32, 32, 32, 32, 32, 116, 104, 105, 115, 46, 98, 121, 116, 101, 76, 101, 110, 103, 116, 104, 32, 61, 61, 61, 32, 116, 104, 105, 115, 46, 98, 117, 102, 102, 101, 114, 46, 98, 121, 116, 101, 76, 101, 110, 103, 116, 104, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 117, 110, 100, 101, 102, 105, 110, 101, 100, 59, 10, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 46, 98, 117, 102, 102, 101, 114, 59, 10, 32, 32, 125, 10, 125, 41, 59, 10, 79, 98, 106, 101, 99, 116, 46, 100, 101, 102, 105, 110, 101, 80, 114, 111, 112, 101, 114, 116, 121, 40, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 44, 32, 39, 111, 102, 102, 115, 101, 116, 39, 44, 32, 123, 10, 32, 32, 101, 110, 117, 109, 101, 114, 97, 98, 108, 101, 58, 32, 116, 114, 117, 101, 44, 10, 32, 32, 103, 101, 116, 58, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 32, 123, 10, 32, 32, 32, 32, 105, 102, 32, 40, 33, 40, 116, 104, 105, 115, 32, 105, 110, 115, 116, 97, 110, 99, 101, 111, 102, 32, 66, 117, 102, 102, 101, 114, 41, 41, 10, 32, 32, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 117, 110, 100, 101, 102, 105, 110, 101, 100, 59, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 46, 98, 121, 116, 101, 79, 102, 102, 115, 101, 116, 59, 10, 32, 32, 125, 10, 125, 41, 59, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 115, 108, 111, 119, 84, 111, 83, 116, 114, 105, 110, 103, 40, 101, 110, 99, 111, 100, 105, 110, 103, 44, 32, 115, 116, 97, 114, 116, 44, 32, 101, 110, 100, 41, 32, 123, 10, 32, 32, 118, 97, 114, 32, 108, 111, 119, 101, 114, 101, 100, 67, 97, 115, 101, 32, 61, 32, 102, 97, 108, 115, 101, 59, 10, 10, 32, 32, 115, 116, 97, 114, 116, 32, 61, 32, 115, 116, 97, 114, 116, 32, 62, 62, 62, 32, 48, 59, 10, 32, 32, 101, 110, 100, 32, 61, 32, 101, 110, 100, 32, 61, 61, 61, 32, 117, 110, 100, 101, 102, 105, 110, 101, 100, 32, 124, 124, 32, 101, 110, 100, 32, 61, 61, 61, 32, 73, 110, 102, 105, 110, 105, 116, 121, 32, 63, 32, 116, 104, 105, 115, 46, 108, 101, 110, 103, 116, 104, 32, 58, 32, 101, 110, 100, 32, 62, 62, 62, 32, 48, 59, 10, 10, 32, 32, 105, 102, 32, 40, 33, 101, 110, 99, 111, 100, 105, 110, 103, 41, 32, 101, 110, 99, 111, 100, 105, 110, 103, 32, 61, 32, 39, 117, 116, 102, 56, 39, 59, 10, 32, 32, 105, 102, 32, 40, 115, 116, 97, 114, 116, 32, 60, 32, 48, 41, 32, 115, 116, 97, 114, 116, 32, 61, 32, 48, 59, 10, 32, 32, 105, 102, 32, 40, 101, 110, 100, 32, 62, 32, 116, 104, 105, 115, 46, 108, 101, 110, 103, 116, 104, 41, 32, 101, 110, 100, 32, 61, 32, 116, 104, 105, 115, 46, 108, 101, 110, 103, 116, 104, 59, 10, 32, 32, 105, 102, 32, 40, 101, 110, 100, 32, 60, 61, 32, 115, 116, 97, 114, 116, 41, 32, 114, 101, 116, 117, 114, 110, 32, 39, 39, 59, 10, 10, 32, 32, 119, 104, 105, 108, 101, 32, 40, 116, 114, 117, 101, 41, 32, 123, 10, 32, 32, 32, 32, 115, 119, 105, 116, 99, 104, 32, 40, 101, 110, 99, 111, 100, 105, 110, 103, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 104, 101, 120, 39, 58, 10, 32, 32, 32, 32, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 46, 104, 101, 120, 83, 108, 105, 99, 101, 40, 115, 116, 97, 114, 116, 44, 32, 101, 110, 100, 41, 59, 10, 10, 32, 32, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 117, 116, 102, 56, 39, 58, 10, 32, 32, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 117, 116, 102, 45, 56, 39, 58, 10, 32, 32, 32, 32, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 46, 117, 116, 102, 56, 83, 108, 105, 99, 101, 40, 115, 116, 97, 114, 116, 44, 32, 101, 110, 100, 41, 59, 10, 10, 32, 32, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 97, 115, 99, 105, 105, 39, 58, 10, 32, 32, 32, 32, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 46, 97, 115, 99, 105, 105, 83, 108, 105, 99, 101, 40, 115, 116, 97, 114, 116, 44, 32, 101, 110, 100, 41, 59, 10, 10, 32, 32, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 98, 105, 110, 97, 114, 121, 39, 58, 10, 32, 32, 32, 32, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 46, 98, 105, 110, 97, 114, 121, 83, 108, 105, 99, 101, 40, 115, 116, 97, 114, 116, 44, 32, 101, 110, 100, 41, 59, 10, 10, 32, 32, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 98, 97, 115, 101, 54, 52, 39, 58, 10, 32, 32, 32, 32, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 46, 98, 97, 115, 101, 54, 52, 83, 108, 105, 99, 101, 40, 115, 116, 97, 114, 116, 44, 32, 101, 110, 100, 41, 59, 10, 10, 32, 32, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 117, 99, 115, 50, 39, 58, 10, 32, 32, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 117, 99, 115, 45, 50, 39, 58, 10, 32, 32, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 117, 116, 102, 49, 54, 108, 101, 39, 58, 10, 32, 32, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 117, 116, 102, 45, 49, 54, 108, 101, 39, 58, 10, 32, 32, 32, 32, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 46, 117, 99, 115, 50, 83, 108, 105, 99, 101, 40, 115, 116, 97, 114, 116, 44, 32, 101, 110, 100, 41, 59, 10, 10, 32, 32, 32, 32, 32, 32, 100, 101, 102, 97, 117, 108, 116, 58, 10, 32, 32, 32, 32, 32, 32, 32, 32, 105, 102, 32, 40, 108, 111, 119, 101, 114, 101, 100, 67, 97, 115, 101, 41, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 116, 104, 114, 111, 119, 32, 110, 101, 119, 32, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 85, 110, 107, 110, 111, 119, 110, 32, 101, 110, 99, 111, 100, 105, 110, 103, 58, 32, 39, 32, 43, 32, 101, 110, 99, 111, 100, 105, 110, 103, 41, 59, 10, 32, 32, 32, 32, 32, 32, 32, 32, 101, 110, 99, 111, 100, 105, 110, 103, 32, 61, 32, 40, 101, 110, 99, 111, 100, 105, 110, 103, 32, 43, 32, 39, 39, 41, 46, 116, 111, 76, 111, 119, 101, 114, 67, 97, 115, 101, 40, 41, 59, 10, 32, 32, 32, 32, 32, 32, 32, 32, 108, 111, 119, 101, 114, 101, 100, 67, 97, 115, 101, 32, 61, 32, 116, 114, 117, 101, 59, 10, 32, 32, 32, 32, 125, 10, 32, 32, 125, 10, 125, 10, 10, 10, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 116, 111, 83, 116, 114, 105, 110, 103, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 32, 123, 10, 32, 32, 105, 102, 32, 40, 97, 114, 103, 117, 109, 101, 110, 116, 115, 46, 108, 101, 110, 103, 116, 104, 32, 61, 61, 61, 32, 48, 41, 32, 123, 10, 32, 32, 32, 32, 118, 97, 114, 32, 114, 101, 115, 117, 108, 116, 32, 61, 32, 116, 104, 105, 115, 46, 117, 116, 102, 56, 83, 108, 105, 99, 101, 40, 48, 44, 32, 116, 104, 105, 115, 46, 108, 101, 110, 103, 116, 104, 41, 59, 10, 32, 32, 125, 32, 101, 108, 115, 101, 32, 123, 10, 32, 32, 32, 32, 118, 97, 114, 32, 114, 101, 115, 117, 108, 116, 32, 61, 32, 115, 108, 111, 119, 84, 111, 83, 116, 114, 105, 110, 103, 46, 97, 112, 112, 108, 121, 40, 116, 104, 105, 115, 44, 32, 97, 114, 103, 117, 109, 101, 110, 116, 115, 41, 59, 10, 32, 32, 125, 10, 32, 32, 105, 102, 32, 40, 114, 101, 115, 117, 108, 116, 32, 61, 61, 61, 32, 117, 110, 100, 101, 102, 105, 110, 101, 100, 41, 10, 32, 32, 32, 32, 116, 104, 114, 111, 119, 32, 110, 101, 119, 32, 69, 114, 114, 111, 114, 40, 39, 116, 111, 83, 116, 114, 105, 110, 103, 32, 102, 97, 105, 108, 101, 100, 39, 41, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 114, 101, 115, 117, 108, 116, 59, 10, 125, 59, 10, 10, 10, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 101, 113, 117, 97, 108, 115, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 32, 101, 113, 117, 97, 108, 115, 40, 98, 41, 32, 123, 10, 32, 32, 105, 102, 32, 40, 33, 40, 98, 32, 105, 110, 115, 116, 97, 110, 99, 101, 111, 102, 32, 66, 117, 102, 102, 101, 114, 41, 41, 10, 32, 32, 32, 32, 116, 104, 114, 111, 119, 32, 110, 101, 119, 32, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 65, 114, 103, 117, 109, 101, 110, 116, 32, 109, 117, 115, 116, 32, 98, 101, 32, 97, 32, 66, 117, 102, 102, 101, 114, 39, 41, 59, 10, 10, 32, 32, 105, 102, 32, 40, 116, 104, 105, 115, 32, 61, 61, 61, 32, 98, 41, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 116, 114, 117, 101, 59, 10, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 98, 105, 110, 100, 105, 110, 103, 46, 99, 111, 109, 112, 97, 114, 101, 40, 116, 104, 105, 115, 44, 32, 98, 41, 32, 61, 61, 61, 32, 48, 59, 10, 125, 59, 10, 10, 10, 47, 47, 32, 73, 110, 115, 112, 101, 99, 116, 10, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 105, 110, 115, 112, 101, 99, 116, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 32, 105, 110, 115, 112, 101, 99, 116, 40, 41, 32, 123, 10, 32, 32, 118, 97, 114, 32, 115, 116, 114, 32, 61, 32, 39, 39, 59, 10, 32, 32, 118, 97, 114, 32, 109, 97, 120, 32, 61, 32, 101, 120, 112, 111, 114, 116, 115, 46, 73, 78, 83, 80, 69, 67, 84, 95, 77, 65, 88, 95, 66, 89, 84, 69, 83, 59, 10, 32, 32, 105, 102, 32, 40, 116, 104, 105, 115, 46, 108, 101, 110, 103, 116, 104, 32, 62, 32, 48, 41, 32, 123, 10, 32, 32, 32, 32, 115, 116, 114, 32, 61, 32, 116, 104, 105, 115, 46, 116, 111, 83, 116, 114, 105, 110, 103, 40, 39, 104, 101, 120, 39, 44, 32, 48, 44, 32, 109, 97, 120, 41, 46, 109, 97, 116, 99, 104, 40, 47, 46, 123, 50, 125, 47, 103, 41, 46, 106, 111, 105, 110, 40, 39, 32, 39, 41, 59, 10, 32, 32, 32, 32, 105, 102, 32, 40, 116, 104, 105, 115, 46, 108, 101, 110, 103, 116, 104, 32, 62, 32, 109, 97, 120, 41, 10, 32, 32, 32, 32, 32, 32, 115, 116, 114, 32, 43, 61, 32, 39, 32, 46, 46, 46, 32, 39, 59, 10, 32, 32, 125, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 39, 60, 39, 32, 43, 32, 116, 104, 105, 115, 46, 99, 111, 110, 115, 116, 114, 117, 99, 116, 111, 114, 46, 110, 97, 109, 101, 32, 43, 32, 39, 32, 39, 32, 43, 32, 115, 116, 114, 32, 43, 32, 39, 62, 39, 59, 10, 125, 59, 10, 10, 10, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 99, 111, 109, 112, 97, 114, 101, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 32, 99, 111, 109, 112, 97, 114, 101, 40, 98, 41, 32, 123, 10, 32, 32, 105, 102, 32, 40, 33, 40, 98, 32, 105, 110, 115, 116, 97, 110, 99, 101, 111, 102, 32, 66, 117, 102, 102, 101, 114, 41, 41, 10, 32, 32, 32, 32, 116, 104, 114, 111, 119, 32, 110, 101, 119, 32, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 65, 114, 103, 117, 109, 101, 110, 116, 32, 109, 117, 115, 116, 32, 98, 101, 32, 97, 32, 66, 117, 102, 102, 101, 114, 39, 41, 59, 10, 10, 32, 32, 105, 102, 32, 40, 116, 104, 105, 115, 32, 61, 61, 61, 32, 98, 41, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 48, 59, 10, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 98, 105, 110, 100, 105, 110, 103, 46, 99, 111, 109, 112, 97, 114, 101, 40, 116, 104, 105, 115, 44, 32, 98, 41, 59, 10, 125, 59, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 115, 108, 111, 119, 73, 110, 100, 101, 120, 79, 102, 40, 98, 117, 102, 102, 101, 114, 44, 32, 118, 97, 108, 44, 32, 98, 121, 116, 101, 79, 102, 102, 115, 101, 116, 44, 32, 101, 110, 99, 111, 100, 105, 110, 103, 41, 32, 123, 10, 32, 32, 118, 97, 114, 32, 108, 111, 119, 101, 114, 101, 100, 67, 97, 115, 101, 32, 61, 32, 102, 97, 108, 115, 101, 59, 10, 32, 32, 102, 111, 114, 32, 40, 59, 59, 41, 32, 123, 10, 32, 32, 32, 32, 115, 119, 105, 116, 99, 104, 32, 40, 101, 110, 99, 111, 100, 105, 110, 103, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 117, 116, 102, 56, 39, 58, 10, 32, 32, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 117, 116, 102, 45, 56, 39, 58, 10, 32, 32, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 117, 99, 115, 50, 39, 58, 10, 32, 32, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 117, 99, 115, 45, 50, 39, 58, 10, 32, 32, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 117, 116, 102, 49, 54, 108, 101, 39, 58, 10, 32, 32, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 117, 116, 102, 45, 49, 54, 108, 101, 39, 58, 10, 32, 32, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 98, 105, 110, 97, 114, 121, 39, 58, 10, 32, 32, 32, 32, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 98, 105, 110, 100, 105, 110, 103, 46, 105, 110, 100, 101, 120, 79, 102, 83, 116, 114, 105, 110, 103, 40, 98, 117, 102, 102, 101, 114, 44, 32, 118, 97, 108, 44, 32, 98, 121, 116, 101, 79, 102, 102, 115, 101, 116, 44, 32, 101, 110, 99, 111, 100, 105, 110, 103, 41, 59, 10, 10, 32, 32, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 98, 97, 115, 101, 54, 52, 39, 58, 10, 32, 32, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 97, 115, 99, 105, 105, 39, 58, 10, 32, 32, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 104, 101, 120, 39, 58, 10, 32, 32, 32, 32, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 98, 105, 110, 100, 105, 110, 103, 46, 105, 110, 100, 101, 120, 79, 102, 66, 117, 102, 102, 101, 114, 40, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 98, 117, 102, 102, 101, 114, 44, 32, 66, 117, 102, 102, 101, 114, 40, 118, 97, 108, 44, 32, 101, 110, 99, 111, 100, 105, 110, 103, 41, 44, 32, 98, 121, 116, 101, 79, 102, 102, 115, 101, 116, 44, 32, 101, 110, 99, 111, 100, 105, 110, 103, 41, 59, 10, 10, 32, 32, 32, 32, 32, 32, 100, 101, 102, 97, 117, 108, 116, 58, 10, 32, 32, 32, 32, 32, 32, 32, 32, 105, 102, 32, 40, 108, 111, 119, 101, 114, 101, 100, 67, 97, 115, 101, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 116, 104, 114, 111, 119, 32, 110, 101, 119, 32, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 85, 110, 107, 110, 111, 119, 110, 32, 101, 110, 99, 111, 100, 105, 110, 103, 58, 32, 39, 32, 43, 32, 101, 110, 99, 111, 100, 105, 110, 103, 41, 59, 10, 32, 32, 32, 32, 32, 32, 32, 32, 125, 10, 10, 32, 32, 32, 32, 32, 32, 32, 32, 101, 110, 99, 111, 100, 105, 110, 103, 32, 61, 32, 40, 39, 39, 32, 43, 32, 101, 110, 99, 111, 100, 105, 110, 103, 41, 46, 116, 111, 76, 111, 119, 101, 114, 67, 97, 115, 101, 40, 41, 59, 10, 32, 32, 32, 32, 32, 32, 32, 32, 108, 111, 119, 101, 114, 101, 100, 67, 97, 115, 101, 32, 61, 32, 116, 114, 117, 101, 59, 10, 32, 32, 32, 32, 125, 10, 32, 32, 125, 10, 125, 10, 10, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 105, 110, 100, 101, 120, 79, 102, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 32, 105, 110, 100, 101, 120, 79, 102, 40, 118, 97, 108, 44, 32, 98, 121, 116, 101, 79, 102, 102, 115, 101, 116, 44, 32, 101, 110, 99, 111, 100, 105, 110, 103, 41, 32, 123, 10, 32, 32, 105, 102, 32, 40, 98, 121, 116, 101, 79, 102, 102, 115, 101, 116, 32, 62, 32, 48, 120, 55, 102, 102, 102, 102, 102, 102, 102, 41, 10, 32, 32, 32, 32, 98, 121, 116, 101, 79, 102, 102, 115, 101, 116, 32, 61, 32, 48, 120, 55, 102, 102, 102, 102, 102, 102, 102, 59, 10, 32, 32, 101, 108, 115, 101, 32, 105, 102, 32, 40, 98, 121, 116, 101, 79, 102, 102, 115, 101, 116, 32, 60, 32, 45, 48, 120, 56, 48, 48, 48, 48, 48, 48, 48, 41, 10, 32, 32, 32, 32, 98, 121, 116, 101, 79, 102, 102, 115, 101, 116, 32, 61, 32, 45, 48, 120, 56, 48, 48, 48, 48, 48, 48, 48, 59, 10, 32, 32, 98, 121, 116, 101, 79, 102, 102, 115, 101, 116, 32, 62, 62, 61, 32, 48, 59, 10, 10, 32, 32, 105, 102, 32, 40, 116, 121, 112, 101, 111, 102, 32, 118, 97, 108, 32, 61, 61, 61, 32, 39, 115, 116, 114, 105, 110, 103, 39, 41, 32, 123, 10, 32, 32, 32, 32, 105, 102, 32, 40, 101, 110, 99, 111, 100, 105, 110, 103, 32, 61, 61, 61, 32, 117, 110, 100, 101, 102, 105, 110, 101, 100, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 98, 105, 110, 100, 105, 110, 103, 46, 105, 110, 100, 101, 120, 79, 102, 83, 116, 114, 105, 110, 103, 40, 116, 104, 105, 115, 44, 32, 118, 97, 108, 44, 32, 98, 121, 116, 101, 79, 102, 102, 115, 101, 116, 44, 32, 101, 110, 99, 111, 100, 105, 110, 103, 41, 59, 10, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 115, 108, 111, 119, 73, 110, 100, 101, 120, 79, 102, 40, 116, 104, 105, 115, 44, 32, 118, 97, 108, 44, 32, 98, 121, 116, 101, 79, 102, 102, 115, 101, 116, 44, 32, 101, 110, 99, 111, 100, 105, 110, 103, 41, 59, 10, 32, 32, 125, 32, 101, 108, 115, 101, 32, 105, 102, 32, 40, 118, 97, 108, 32, 105, 110, 115, 116, 97, 110, 99, 101, 111, 102, 32, 66, 117, 102, 102, 101, 114, 41, 32, 123, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 98, 105, 110, 100, 105, 110, 103, 46, 105, 110, 100, 101, 120, 79, 102, 66, 117, 102, 102, 101, 114, 40, 116, 104, 105, 115, 44, 32, 118, 97, 108, 44, 32, 98, 121, 116, 101, 79, 102, 102, 115, 101, 116, 44, 32, 101, 110, 99, 111, 100, 105, 110, 103, 41, 59, 10, 32, 32, 125, 32, 101, 108, 115, 101, 32, 105, 102, 32, 40, 116, 121, 112, 101, 111, 102, 32, 118, 97, 108, 32, 61, 61, 61, 32, 39, 110, 117, 109, 98, 101, 114, 39, 41, 32, 123, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 98, 105, 110, 100, 105, 110, 103, 46, 105, 110, 100, 101, 120, 79, 102, 78, 117, 109, 98, 101, 114, 40, 116, 104, 105, 115, 44, 32, 118, 97, 108, 44, 32, 98, 121, 116, 101, 79, 102, 102, 115, 101, 116, 41, 59, 10, 32, 32, 125, 10, 10, 32, 32, 116, 104, 114, 111, 119, 32, 110, 101, 119, 32, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 118, 97, 108, 32, 109, 117, 115, 116, 32, 98, 101, 32, 115, 116, 114, 105, 110, 103, 44, 32, 110, 117, 109, 98, 101, 114, 32, 111, 114, 32, 66, 117, 102, 102, 101, 114, 39, 41, 59, 10, 125, 59, 10, 10, 10, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 102, 105, 108, 108, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 32, 102, 105, 108, 108, 40, 118, 97, 108, 44, 32, 115, 116, 97, 114, 116, 44, 32, 101, 110, 100, 41, 32, 123, 10, 32, 32, 115, 116, 97, 114, 116, 32, 61, 32, 115, 116, 97, 114, 116, 32, 62, 62, 32, 48, 59, 10, 32, 32, 101, 110, 100, 32, 61, 32, 40, 101, 110, 100, 32, 61, 61, 61, 32, 117, 110, 100, 101, 102, 105, 110, 101, 100, 41, 32, 63, 32, 116, 104, 105, 115, 46, 108, 101, 110, 103, 116, 104, 32, 58, 32, 101, 110, 100, 32, 62, 62, 32, 48, 59, 10, 10, 32, 32, 105, 102, 32, 40, 115, 116, 97, 114, 116, 32, 60, 32, 48, 32, 124, 124, 32, 101, 110, 100, 32, 62, 32, 116, 104, 105, 115, 46, 108, 101, 110, 103, 116, 104, 41, 10, 32, 32, 32, 32, 116, 104, 114, 111, 119, 32, 110, 101, 119, 32, 82, 97, 110, 103, 101, 69, 114, 114, 111, 114, 40, 39, 111, 117, 116, 32, 111, 102, 32, 114, 97, 110, 103, 101, 32, 105, 110, 100, 101, 120, 39, 41, 59, 10, 32, 32, 105, 102, 32, 40, 101, 110, 100, 32, 60, 61, 32, 115, 116, 97, 114, 116, 41, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 59, 10, 10, 32, 32, 105, 102, 32, 40, 116, 121, 112, 101, 111, 102, 32, 118, 97, 108, 32, 33, 61, 61, 32, 39, 115, 116, 114, 105, 110, 103, 39, 41, 32, 123, 10, 32, 32, 32, 32, 118, 97, 108, 32, 61, 32, 118, 97, 108, 32, 62, 62, 62, 32, 48, 59, 10, 32, 32, 125, 32, 101, 108, 115, 101, 32, 105, 102, 32, 40, 118, 97, 108, 46, 108, 101, 110, 103, 116, 104, 32, 61, 61, 61, 32, 49, 41, 32, 123, 10, 32, 32, 32, 32, 118, 97, 114, 32, 99, 111, 100, 101, 32, 61, 32, 118, 97, 108, 46, 99, 104, 97, 114, 67, 111, 100, 101, 65, 116, 40, 48, 41, 59, 10, 32, 32, 32, 32, 105, 102, 32, 40, 99, 111, 100, 101, 32, 60, 32, 50, 53, 54, 41, 10, 32, 32, 32, 32, 32, 32, 118, 97, 108, 32, 61, 32, 99, 111, 100, 101, 59, 10, 32, 32, 125, 10, 10, 32, 32, 98, 105, 110, 100, 105, 110, 103, 46, 102, 105, 108, 108, 40, 116, 104, 105, 115, 44, 32, 118, 97, 108, 44, 32, 115, 116, 97, 114, 116, 44, 32, 101, 110, 100, 41, 59, 10, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 59, 10, 125, 59, 10, 10, 10, 47, 47, 32, 88, 88, 88, 32, 114, 101, 109, 111, 118, 101, 32, 105, 110, 32, 118, 48, 46, 49, 51, 10, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 103, 101, 116, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 32, 103, 101, 116, 40, 111, 102, 102, 115, 101, 116, 41, 32, 123, 10, 32, 32, 111, 102, 102, 115, 101, 116, 32, 61, 32, 126, 126, 111, 102, 102, 115, 101, 116, 59, 10, 32, 32, 105, 102, 32, 40, 111, 102, 102, 115, 101, 116, 32, 60, 32, 48, 32, 124, 124, 32, 111, 102, 102, 115, 101, 116, 32, 62, 61, 32, 116, 104, 105, 115, 46, 108, 101, 110, 103, 116, 104, 41, 10, 32, 32, 32, 32, 116, 104, 114, 111, 119, 32, 110, 101, 119, 32, 82, 97, 110, 103, 101, 69, 114, 114, 111, 114, 40, 39, 105, 110, 100, 101, 120, 32, 111, 117, 116, 32, 111, 102, 32, 114, 97, 110, 103, 101, 39, 41, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 46, 103, 101, 116, 65, 116, 40, 111, 102, 102, 115, 101, 116, 41, 59, 10, 125, 59, 10, 10, 47, 47, 32, 88, 88, 88, 32, 114, 101, 109, 111, 118, 101, 32, 105, 110, 32, 118, 48, 46, 49, 51, 10, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 115, 101, 116, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 32, 115, 101, 116, 40, 111, 102, 102, 115, 101, 116, 44, 32, 118, 41, 32, 123, 10, 32, 32, 111, 102, 102, 115, 101, 116, 32, 61, 32, 126, 126, 111, 102, 102, 115, 101, 116, 59, 10, 32, 32, 105, 102, 32, 40, 111, 102, 102, 115, 101, 116, 32, 60, 32, 48, 32, 124, 124, 32, 111, 102, 102, 115, 101, 116, 32, 62, 61, 32, 116, 104, 105, 115, 46, 108, 101, 110, 103, 116, 104, 41, 10, 32, 32, 32, 32, 116, 104, 114, 111, 119, 32, 110, 101, 119, 32, 82, 97, 110, 103, 101, 69, 114, 114, 111, 114, 40, 39, 105, 110, 100, 101, 120, 32, 111, 117, 116, 32, 111, 102, 32, 114, 97, 110, 103, 101, 39, 41, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 46, 115, 101, 116, 65, 116, 40, 111, 102, 102, 115, 101, 116, 44, 32, 118, 41, 59, 10, 125, 59, 10, 10, 118, 97, 114, 32, 119, 114, 105, 116, 101, 87, 97, 114, 110, 101, 100, 32, 61, 32, 102, 97, 108, 115, 101, 59, 10, 99, 111, 110, 115, 116, 32, 119, 114, 105, 116, 101, 77, 115, 103, 32, 61, 32, 39, 66, 117, 102, 102, 101, 114, 46, 119, 114, 105, 116, 101, 40, 115, 116, 114, 105, 110, 103, 44, 32, 101, 110, 99, 111, 100, 105, 110, 103, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 108, 101, 110, 103, 116, 104, 41, 32, 105, 115, 32, 39, 32, 43, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 39, 100, 101, 112, 114, 101, 99, 97, 116, 101, 100, 46, 32, 85, 115, 101, 32, 119, 114, 105, 116, 101, 40, 115, 116, 114, 105, 110, 103, 91, 44, 32, 111, 102, 102, 115, 101, 116, 91, 44, 32, 108, 101, 110, 103, 116, 104, 93, 93, 39, 32, 43, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 39, 91, 44, 32, 101, 110, 99, 111, 100, 105, 110, 103, 93, 41, 32, 105, 110, 115, 116, 101, 97, 100, 46, 39, 59, 10, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 119, 114, 105, 116, 101, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 115, 116, 114, 105, 110, 103, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 108, 101, 110, 103, 116, 104, 44, 32, 101, 110, 99, 111, 100, 105, 110, 103, 41, 32, 123, 10, 32, 32, 47, 47, 32, 66, 117, 102, 102, 101, 114, 35, 119, 114, 105, 116, 101, 40, 115, 116, 114, 105, 110, 103, 41, 59, 10, 32, 32, 105, 102, 32, 40, 111, 102, 102, 115, 101, 116, 32, 61, 61, 61, 32, 117, 110, 100, 101, 102, 105, 110, 101, 100, 41, 32, 123, 10, 32, 32, 32, 32, 101, 110, 99, 111, 100, 105, 110, 103, 32, 61, 32, 39, 117, 116, 102, 56, 39, 59, 10, 32, 32, 32, 32, 108, 101, 110, 103, 116, 104, 32, 61, 32, 116, 104, 105, 115, 46, 108, 101, 110, 103, 116, 104, 59, 10, 32, 32, 32, 32, 111, 102, 102, 115, 101, 116, 32, 61, 32, 48, 59, 10, 10, 32, 32, 47, 47, 32, 66, 117, 102, 102, 101, 114, 35, 119, 114, 105, 116, 101, 40, 115, 116, 114, 105, 110, 103, 44, 32, 101, 110, 99, 111, 100, 105, 110, 103, 41, 10, 32, 32, 125, 32, 101, 108, 115, 101, 32, 105, 102, 32, 40, 108, 101, 110, 103, 116, 104, 32, 61, 61, 61, 32, 117, 110, 100, 101, 102, 105, 110, 101, 100, 32, 38, 38, 32, 116, 121, 112, 101, 111, 102, 32, 111, 102, 102, 115, 101, 116, 32, 61, 61, 61, 32, 39, 115, 116, 114, 105, 110, 103, 39, 41, 32, 123, 10, 32, 32, 32, 32, 101, 110, 99, 111, 100, 105, 110, 103, 32, 61, 32, 111, 102, 102, 115, 101, 116, 59, 10, 32, 32, 32, 32, 108, 101, 110, 103, 116, 104, 32, 61, 32, 116, 104, 105, 115, 46, 108, 101, 110, 103, 116, 104, 59, 10, 32, 32, 32, 32, 111, 102, 102, 115, 101, 116, 32, 61, 32, 48, 59, 10, 10, 32, 32, 47, 47, 32, 66, 117, 102, 102, 101, 114, 35, 119, 114, 105, 116, 101, 40, 115, 116, 114, 105, 110, 103, 44, 32, 111, 102, 102, 115, 101, 116, 91, 44, 32, 108, 101, 110, 103, 116, 104, 93, 91, 44, 32, 101, 110, 99, 111, 100, 105, 110, 103, 93, 41, 10, 32, 32, 125, 32, 101, 108, 115, 101, 32, 105, 102, 32, 40, 105, 115, 70, 105, 110, 105, 116, 101, 40, 111, 102, 102, 115, 101, 116, 41, 41, 32, 123, 10, 32, 32, 32, 32, 111, 102, 102, 115, 101, 116, 32, 61, 32, 111, 102, 102, 115, 101, 116, 32, 62, 62, 62, 32, 48, 59, 10, 32, 32, 32, 32, 105, 102, 32, 40, 105, 115, 70, 105, 110, 105, 116, 101, 40, 108, 101, 110, 103, 116, 104, 41, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 108, 101, 110, 103, 116, 104, 32, 61, 32, 108, 101, 110, 103, 116, 104, 32, 62, 62, 62, 32, 48, 59, 10, 32, 32, 32, 32, 32, 32, 105, 102, 32, 40, 101, 110, 99, 111, 100, 105, 110, 103, 32, 61, 61, 61, 32, 117, 110, 100, 101, 102, 105, 110, 101, 100, 41, 10, 32, 32, 32, 32, 32, 32, 32, 32, 101, 110, 99, 111, 100, 105, 110, 103, 32, 61, 32, 39, 117, 116, 102, 56, 39, 59, 10, 32, 32, 32, 32, 125, 32, 101, 108, 115, 101, 32, 123, 10, 32, 32, 32, 32, 32, 32, 101, 110, 99, 111, 100, 105, 110, 103, 32, 61, 32, 108, 101, 110, 103, 116, 104, 59, 10, 32, 32, 32, 32, 32, 32, 108, 101, 110, 103, 116, 104, 32, 61, 32, 117, 110, 100, 101, 102, 105, 110, 101, 100, 59, 10, 32, 32, 32, 32, 125, 10, 10, 32, 32, 47, 47, 32, 88, 88, 88, 32, 108, 101, 103, 97, 99, 121, 32, 119, 114, 105, 116, 101, 40, 115, 116, 114, 105, 110, 103, 44, 32, 101, 110, 99, 111, 100, 105, 110, 103, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 108, 101, 110, 103, 116, 104, 41, 32, 45, 32, 114, 101, 109, 111, 118, 101, 32, 105, 110, 32, 118, 48, 46, 49, 51, 10, 32, 32, 125, 32, 101, 108, 115, 101, 32, 123, 10, 32, 32, 32, 32, 119, 114, 105, 116, 101, 87, 97, 114, 110, 101, 100, 32, 61, 32, 105, 110, 116, 101, 114, 110, 97, 108, 85, 116, 105, 108, 46, 112, 114, 105, 110, 116, 68, 101, 112, 114, 101, 99, 97, 116, 105, 111, 110, 77, 101, 115, 115, 97, 103, 101, 40, 119, 114, 105, 116, 101, 77, 115, 103, 44, 32, 119, 114, 105, 116, 101, 87, 97, 114, 110, 101, 100, 41, 59, 10, 32, 32, 32, 32, 118, 97, 114, 32, 115, 119, 97, 112, 32, 61, 32, 101, 110, 99, 111, 100, 105, 110, 103, 59, 10, 32, 32, 32, 32, 101, 110, 99, 111, 100, 105, 110, 103, 32, 61, 32, 111, 102, 102, 115, 101, 116, 59, 10, 32, 32, 32, 32, 111, 102, 102, 115, 101, 116, 32, 61, 32, 108, 101, 110, 103, 116, 104, 32, 62, 62, 62, 32, 48, 59, 10, 32, 32, 32, 32, 108, 101, 110, 103, 116, 104, 32, 61, 32, 115, 119, 97, 112, 59, 10, 32, 32, 125, 10, 10, 32, 32, 118, 97, 114, 32, 114, 101, 109, 97, 105, 110, 105, 110, 103, 32, 61, 32, 116, 104, 105, 115, 46, 108, 101, 110, 103, 116, 104, 32, 45, 32, 111, 102, 102, 115, 101, 116, 59, 10, 32, 32, 105, 102, 32, 40, 108, 101, 110, 103, 116, 104, 32, 61, 61, 61, 32, 117, 110, 100, 101, 102, 105, 110, 101, 100, 32, 124, 124, 32, 108, 101, 110, 103, 116, 104, 32, 62, 32, 114, 101, 109, 97, 105, 110, 105, 110, 103, 41, 10, 32, 32, 32, 32, 108, 101, 110, 103, 116, 104, 32, 61, 32, 114, 101, 109, 97, 105, 110, 105, 110, 103, 59, 10, 10, 32, 32, 105, 102, 32, 40, 115, 116, 114, 105, 110, 103, 46, 108, 101, 110, 103, 116, 104, 32, 62, 32, 48, 32, 38, 38, 32, 40, 108, 101, 110, 103, 116, 104, 32, 60, 32, 48, 32, 124, 124, 32, 111, 102, 102, 115, 101, 116, 32, 60, 32, 48, 41, 41, 10, 32, 32, 32, 32, 116, 104, 114, 111, 119, 32, 110, 101, 119, 32, 82, 97, 110, 103, 101, 69, 114, 114, 111, 114, 40, 39, 97, 116, 116, 101, 109, 112, 116, 32, 116, 111, 32, 119, 114, 105, 116, 101, 32, 111, 117, 116, 115, 105, 100, 101, 32, 98, 117, 102, 102, 101, 114, 32, 98, 111, 117, 110, 100, 115, 39, 41, 59, 10, 10, 32, 32, 105, 102, 32, 40, 33, 101, 110, 99, 111, 100, 105, 110, 103, 41, 10, 32, 32, 32, 32, 101, 110, 99, 111, 100, 105, 110, 103, 32, 61, 32, 39, 117, 116, 102, 56, 39, 59, 10, 10, 32, 32, 118, 97, 114, 32, 108, 111, 119, 101, 114, 101, 100, 67, 97, 115, 101, 32, 61, 32, 102, 97, 108, 115, 101, 59, 10, 32, 32, 102, 111, 114, 32, 40, 59, 59, 41, 32, 123, 10, 32, 32, 32, 32, 115, 119, 105, 116, 99, 104, 32, 40, 101, 110, 99, 111, 100, 105, 110, 103, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 104, 101, 120, 39, 58, 10, 32, 32, 32, 32, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 46, 104, 101, 120, 87, 114, 105, 116, 101, 40, 115, 116, 114, 105, 110, 103, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 108, 101, 110, 103, 116, 104, 41, 59, 10, 10, 32, 32, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 117, 116, 102, 56, 39, 58, 10, 32, 32, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 117, 116, 102, 45, 56, 39, 58, 10, 32, 32, 32, 32, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 46, 117, 116, 102, 56, 87, 114, 105, 116, 101, 40, 115, 116, 114, 105, 110, 103, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 108, 101, 110, 103, 116, 104, 41, 59, 10, 10, 32, 32, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 97, 115, 99, 105, 105, 39, 58, 10, 32, 32, 32, 32, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 46, 97, 115, 99, 105, 105, 87, 114, 105, 116, 101, 40, 115, 116, 114, 105, 110, 103, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 108, 101, 110, 103, 116, 104, 41, 59, 10, 10, 32, 32, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 98, 105, 110, 97, 114, 121, 39, 58, 10, 32, 32, 32, 32, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 46, 98, 105, 110, 97, 114, 121, 87, 114, 105, 116, 101, 40, 115, 116, 114, 105, 110, 103, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 108, 101, 110, 103, 116, 104, 41, 59, 10, 10, 32, 32, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 98, 97, 115, 101, 54, 52, 39, 58, 10, 32, 32, 32, 32, 32, 32, 32, 32, 47, 47, 32, 87, 97, 114, 110, 105, 110, 103, 58, 32, 109, 97, 120, 76, 101, 110, 103, 116, 104, 32, 110, 111, 116, 32, 116, 97, 107, 101, 110, 32, 105, 110, 116, 111, 32, 97, 99, 99, 111, 117, 110, 116, 32, 105, 110, 32, 98, 97, 115, 101, 54, 52, 87, 114, 105, 116, 101, 10, 32, 32, 32, 32, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 46, 98, 97, 115, 101, 54, 52, 87, 114, 105, 116, 101, 40, 115, 116, 114, 105, 110, 103, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 108, 101, 110, 103, 116, 104, 41, 59, 10, 10, 32, 32, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 117, 99, 115, 50, 39, 58, 10, 32, 32, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 117, 99, 115, 45, 50, 39, 58, 10, 32, 32, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 117, 116, 102, 49, 54, 108, 101, 39, 58, 10, 32, 32, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 117, 116, 102, 45, 49, 54, 108, 101, 39, 58, 10, 32, 32, 32, 32, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 46, 117, 99, 115, 50, 87, 114, 105, 116, 101, 40, 115, 116, 114, 105, 110, 103, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 108, 101, 110, 103, 116, 104, 41, 59, 10, 10, 32, 32, 32, 32, 32, 32, 100, 101, 102, 97, 117, 108, 116, 58, 10, 32, 32, 32, 32, 32, 32, 32, 32, 105, 102, 32, 40, 108, 111, 119, 101, 114, 101, 100, 67, 97, 115, 101, 41, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 116, 104, 114, 111, 119, 32, 110, 101, 119, 32, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 85, 110, 107, 110, 111, 119, 110, 32, 101, 110, 99, 111, 100, 105, 110, 103, 58, 32, 39, 32, 43, 32, 101, 110, 99, 111, 100, 105, 110, 103, 41, 59, 10, 32, 32, 32, 32, 32, 32, 32, 32, 101, 110, 99, 111, 100, 105, 110, 103, 32, 61, 32, 40, 39, 39, 32, 43, 32, 101, 110, 99, 111, 100, 105, 110, 103, 41, 46, 116, 111, 76, 111, 119, 101, 114, 67, 97, 115, 101, 40, 41, 59, 10, 32, 32, 32, 32, 32, 32, 32, 32, 108, 111, 119, 101, 114, 101, 100, 67, 97, 115, 101, 32, 61, 32, 116, 114, 117, 101, 59, 10, 32, 32, 32, 32, 125, 10, 32, 32, 125, 10, 125, 59, 10, 10, 10, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 116, 111, 65, 114, 114, 97, 121, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 32, 123, 10, 32, 32, 118, 97, 114, 32, 97, 114, 114, 97, 121, 32, 61, 32, 110, 101, 119, 32, 65, 114, 114, 97, 121, 40, 116, 104, 105, 115, 46, 108, 101, 110, 103, 116, 104, 41, 59, 10, 32, 32, 102, 111, 114, 32, 40, 118, 97, 114, 32, 105, 32, 61, 32, 48, 59, 32, 105, 32, 60, 32, 97, 114, 114, 97, 121, 46, 108, 101, 110, 103, 116, 104, 59, 32, 105, 43, 43, 41, 10, 32, 32, 32, 32, 97, 114, 114, 97, 121, 91, 105, 93, 32, 61, 32, 116, 104, 105, 115, 46, 103, 101, 116, 65, 116, 40, 105, 41, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 97, 114, 114, 97, 121, 59, 10, 125, 10, 10, 10, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 116, 111, 74, 83, 79, 78, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 32, 123, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 123, 10, 32, 32, 32, 32, 116, 121, 112, 101, 58, 32, 39, 66, 117, 102, 102, 101, 114, 39, 44, 10, 32, 32, 32, 32, 100, 97, 116, 97, 58, 32, 116, 104, 105, 115, 46, 116, 111, 65, 114, 114, 97, 121, 40, 41, 10, 32, 32, 125, 59, 10, 125, 59, 10, 10, 10, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 115, 108, 105, 99, 101, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 32, 115, 108, 105, 99, 101, 40, 115, 116, 97, 114, 116, 44, 32, 101, 110, 100, 41, 32, 123, 10, 32, 32, 99, 111, 110, 115, 116, 32, 98, 117, 102, 102, 101, 114, 32, 61, 32, 116, 104, 105, 115, 46, 115, 117, 98, 97, 114, 114, 97, 121, 40, 115, 116, 97, 114, 116, 44, 32, 101, 110, 100, 41, 59, 10, 32, 32, 79, 98, 106, 101, 99, 116, 46, 115, 101, 116, 80, 114, 111, 116, 111, 116, 121, 112, 101, 79, 102, 40, 98, 117, 102, 102, 101, 114, 44, 32, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 41, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 98, 117, 102, 102, 101, 114, 59, 10, 125, 59, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 99, 104, 101, 99, 107, 79, 102, 102, 115, 101, 116, 40, 111, 102, 102, 115, 101, 116, 44, 32, 101, 120, 116, 44, 32, 108, 101, 110, 103, 116, 104, 41, 32, 123, 10, 32, 32, 105, 102, 32, 40, 111, 102, 102, 115, 101, 116, 32, 43, 32, 101, 120, 116, 32, 62, 32, 108, 101, 110, 103, 116, 104, 41, 10, 32, 32, 32, 32, 116, 104, 114, 111, 119, 32, 110, 101, 119, 32, 82, 97, 110, 103, 101, 69, 114, 114, 111, 114, 40, 39, 105, 110, 100, 101, 120, 32, 111, 117, 116, 32, 111, 102, 32, 114, 97, 110, 103, 101, 39, 41, 59, 10, 125, 10, 10, 10, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 114, 101, 97, 100, 85, 73, 110, 116, 76, 69, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 111, 102, 102, 115, 101, 116, 44, 32, 98, 121, 116, 101, 76, 101, 110, 103, 116, 104, 44, 32, 110, 111, 65, 115, 115, 101, 114, 116, 41, 32, 123, 10, 32, 32, 111, 102, 102, 115, 101, 116, 32, 61, 32, 111, 102, 102, 115, 101, 116, 32, 62, 62, 62, 32, 48, 59, 10, 32, 32, 98, 121, 116, 101, 76, 101, 110, 103, 116, 104, 32, 61, 32, 98, 121, 116, 101, 76, 101, 110, 103, 116, 104, 32, 62, 62, 62, 32, 48, 59, 10, 32, 32, 105, 102, 32, 40, 33, 110, 111, 65, 115, 115, 101, 114, 116, 41, 10, 32, 32, 32, 32, 99, 104, 101, 99, 107, 79, 102, 102, 115, 101, 116, 40, 111, 102, 102, 115, 101, 116, 44, 32, 98, 121, 116, 101, 76, 101, 110, 103, 116, 104, 44, 32, 116, 104, 105, 115, 46, 108, 101, 110, 103, 116, 104, 41, 59, 10, 10, 32, 32, 118, 97, 114, 32, 118, 97, 108, 32, 61, 32, 116, 104, 105, 115, 46, 103, 101, 116, 65, 116, 40, 111, 102, 102, 115, 101, 116, 41, 59, 10, 32, 32, 118, 97, 114, 32, 109, 117, 108, 32, 61, 32, 49, 59, 10, 32, 32, 118, 97, 114, 32, 105, 32, 61, 32, 48, 59, 10, 32, 32, 119, 104, 105, 108, 101, 32, 40, 43, 43, 105, 32, 60, 32, 98, 121, 116, 101, 76, 101, 110, 103, 116, 104, 32, 38, 38, 32, 40, 109, 117, 108, 32, 42, 61, 32, 48, 120, 49, 48, 48, 41, 41, 10, 32, 32, 32, 32, 118, 97, 108, 32, 43, 61, 32, 116, 104, 105, 115, 46, 103, 101, 116, 65, 116, 40, 111, 102, 102, 115, 101, 116, 32, 43, 32, 105, 41, 32, 42, 32, 109, 117, 108, 59, 10, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 118, 97, 108, 59, 10, 125, 59, 10, 10, 10, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 114, 101, 97, 100, 85, 73, 110, 116, 66, 69, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 111, 102, 102, 115, 101, 116, 44, 32, 98, 121, 116, 101, 76, 101, 110, 103, 116, 104, 44, 32, 110, 111, 65, 115, 115, 101, 114, 116, 41, 32, 123, 10, 32, 32, 111, 102, 102, 115, 101, 116, 32, 61, 32, 111, 102, 102, 115, 101, 116, 32, 62, 62, 62, 32, 48, 59, 10, 32, 32, 98, 121, 116, 101, 76, 101, 110, 103, 116, 104, 32, 61, 32, 98, 121, 116, 101, 76, 101, 110, 103, 116, 104, 32, 62, 62, 62, 32, 48, 59, 10, 32, 32, 105, 102, 32, 40, 33, 110, 111, 65, 115, 115, 101, 114, 116, 41, 10, 32, 32, 32, 32, 99, 104, 101, 99, 107, 79, 102, 102, 115, 101, 116, 40, 111, 102, 102, 115, 101, 116, 44, 32, 98, 121, 116, 101, 76, 101, 110, 103, 116, 104, 44, 32, 116, 104, 105, 115, 46, 108, 101, 110, 103, 116, 104, 41, 59, 10, 10, 32, 32, 118, 97, 114, 32, 118, 97, 108, 32, 61, 32, 116, 104, 105, 115, 46, 103, 101, 116, 65, 116, 40, 111, 102, 102, 115, 101, 116, 32, 43, 32, 45, 45, 98, 121, 116, 101, 76, 101, 110, 103, 116, 104, 41, 59, 10, 32, 32, 118, 97, 114, 32, 109, 117, 108, 32, 61, 32, 49, 59, 10, 32, 32, 119, 104, 105, 108, 101, 32, 40, 98, 121, 116, 101, 76, 101, 110, 103, 116, 104, 32, 62, 32, 48, 32, 38, 38, 32, 40, 109, 117, 108, 32, 42, 61, 32, 48, 120, 49, 48, 48, 41, 41, 10, 32, 32, 32, 32, 118, 97, 108, 32, 43, 61, 32, 116, 104, 105, 115, 46, 103, 101, 116, 65, 116, 40, 111, 102, 102, 115, 101, 116, 32, 43, 32, 45, 45, 98, 121, 116, 101, 76, 101, 110, 103, 116, 104, 41, 32, 42, 32, 109, 117, 108, 59, 10, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 118, 97, 108, 59, 10, 125, 59, 10, 10, 10, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 114, 101, 97, 100, 85, 73, 110, 116, 56, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 111, 102, 102, 115, 101, 116, 44, 32, 110, 111, 65, 115, 115, 101, 114, 116, 41, 32, 123, 10, 32, 32, 111, 102, 102, 115, 101, 116, 32, 61, 32, 111, 102, 102, 115, 101, 116, 32, 62, 62, 62, 32, 48, 59, 10, 32, 32, 105, 102, 32, 40, 33, 110, 111, 65, 115, 115, 101, 114, 116, 41, 10, 32, 32, 32, 32, 99, 104, 101, 99, 107, 79, 102, 102, 115, 101, 116, 40, 111, 102, 102, 115, 101, 116, 44, 32, 49, 44, 32, 116, 104, 105, 115, 46, 108, 101, 110, 103, 116, 104, 41, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 46, 103, 101, 116, 65, 116, 40, 111, 102, 102, 115, 101, 116, 41, 59, 10, 125, 59, 10, 10, 10, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 114, 101, 97, 100, 85, 73, 110, 116, 49, 54, 76, 69, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 111, 102, 102, 115, 101, 116, 44, 32, 110, 111, 65, 115, 115, 101, 114, 116, 41, 32, 123, 10, 32, 32, 111, 102, 102, 115, 101, 116, 32, 61, 32, 111, 102, 102, 115, 101, 116, 32, 62, 62, 62, 32, 48, 59, 10, 32, 32, 105, 102, 32, 40, 33, 110, 111, 65, 115, 115, 101, 114, 116, 41, 10, 32, 32, 32, 32, 99, 104, 101, 99, 107, 79, 102, 102, 115, 101, 116, 40, 111, 102, 102, 115, 101, 116, 44, 32, 50, 44, 32, 116, 104, 105, 115, 46, 108, 101, 110, 103, 116, 104, 41, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 46, 103, 101, 116, 65, 116, 40, 111, 102, 102, 115, 101, 116, 41, 32, 124, 32, 40, 116, 104, 105, 115, 46, 103, 101, 116, 65, 116, 40, 111, 102, 102, 115, 101, 116, 32, 43, 32, 49, 41, 32, 60, 60, 32, 56, 41, 59, 10, 125, 59, 10, 10, 10, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 114, 101, 97, 100, 85, 73, 110, 116, 49, 54, 66, 69, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 111, 102, 102, 115, 101, 116, 44, 32, 110, 111, 65, 115, 115, 101, 114, 116, 41, 32, 123, 10, 32, 32, 111, 102, 102, 115, 101, 116, 32, 61, 32, 111, 102, 102, 115, 101, 116, 32, 62, 62, 62, 32, 48, 59, 10, 32, 32, 105, 102, 32, 40, 33, 110, 111, 65, 115, 115, 101, 114, 116, 41, 10, 32, 32, 32, 32, 99, 104, 101, 99, 107, 79, 102, 102, 115, 101, 116, 40, 111, 102, 102, 115, 101, 116, 44, 32, 50, 44, 32, 116, 104, 105, 115, 46, 108, 101, 110, 103, 116, 104, 41, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 40, 116, 104, 105, 115, 46, 103, 101, 116, 65, 116, 40, 111, 102, 102, 115, 101, 116, 41, 32, 60, 60, 32, 56, 41, 32, 124, 32, 116, 104, 105, 115, 46, 103, 101, 116, 65, 116, 40, 111, 102, 102, 115, 101, 116, 32, 43, 32, 49, 41, 59, 10, 125, 59, 10, 10, 10, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 114, 101, 97, 100, 85, 73, 110, 116, 51, 50, 76, 69, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 111, 102, 102, 115, 101, 116, 44, 32, 110, 111, 65, 115, 115, 101, 114, 116, 41, 32, 123, 10, 32, 32, 111, 102, 102, 115, 101, 116, 32, 61, 32, 111, 102, 102, 115, 101, 116, 32, 62, 62, 62, 32, 48, 59, 10, 32, 32, 105, 102, 32, 40, 33, 110, 111, 65, 115, 115, 101, 114, 116, 41, 10, 32, 32, 32, 32, 99, 104, 101, 99, 107, 79, 102, 102, 115, 101, 116, 40, 111, 102, 102, 115, 101, 116, 44, 32, 52, 44, 32, 116, 104, 105, 115, 46, 108, 101, 110, 103, 116, 104, 41, 59, 10, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 40, 40, 116, 104, 105, 115, 46, 103, 101, 116, 65, 116, 40, 111, 102, 102, 115, 101, 116, 41, 41, 32, 124, 10, 32, 32, 32, 32, 32, 32, 40, 116, 104, 105, 115, 46, 103, 101, 116, 65, 116, 40, 111, 102, 102, 115, 101, 116, 32, 43, 32, 49, 41, 32, 60, 60, 32, 56, 41, 32, 124, 10, 32, 32, 32, 32, 32, 32, 40, 116, 104, 105, 115, 46, 103, 101, 116, 65, 116, 40, 111, 102, 102, 115, 101, 116, 32, 43, 32, 50, 41, 32, 60, 60, 32, 49, 54, 41, 41, 32, 43, 10, 32, 32, 32, 32, 32, 32, 40, 116, 104, 105, 115, 46, 103, 101, 116, 65, 116, 40, 111, 102, 102, 115, 101, 116, 32, 43, 32, 51, 41, 32, 42, 32, 48, 120, 49, 48, 48, 48, 48, 48, 48, 41, 59, 10, 125, 59, 10, 10, 10, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 114, 101, 97, 100, 85, 73, 110, 116, 51, 50, 66, 69, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 111, 102, 102, 115, 101, 116, 44, 32, 110, 111, 65, 115, 115, 101, 114, 116, 41, 32, 123, 10, 32, 32, 111, 102, 102, 115, 101, 116, 32, 61, 32, 111, 102, 102, 115, 101, 116, 32, 62, 62, 62, 32, 48, 59, 10, 32, 32, 105, 102, 32, 40, 33, 110, 111, 65, 115, 115, 101, 114, 116, 41, 10, 32, 32, 32, 32, 99, 104, 101, 99, 107, 79, 102, 102, 115, 101, 116, 40, 111, 102, 102, 115, 101, 116, 44, 32, 52, 44, 32, 116, 104, 105, 115, 46, 108, 101, 110, 103, 116, 104, 41, 59, 10, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 40, 116, 104, 105, 115, 46, 103, 101, 116, 65, 116, 40, 111, 102, 102, 115, 101, 116, 41, 32, 42, 32, 48, 120, 49, 48, 48, 48, 48, 48, 48, 41, 32, 43, 10, 32, 32, 32, 32, 32, 32, 32, 32, 40, 40, 116, 104, 105, 115, 46, 103, 101, 116, 65, 116, 40, 111, 102, 102, 115, 101, 116, 32, 43, 32, 49, 41, 32, 60, 60, 32, 49, 54, 41, 32, 124, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 40, 116, 104, 105, 115, 46, 103, 101, 116, 65, 116, 40, 111, 102, 102, 115, 101, 116, 32, 43, 32, 50, 41, 32, 60, 60, 32, 56, 41, 32, 124, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 116, 104, 105, 115, 46, 103, 101, 116, 65, 116, 40, 111, 102, 102, 115, 101, 116, 32, 43, 32, 51, 41, 41, 59, 10, 125, 59, 10, 10, 10, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 114, 101, 97, 100, 73, 110, 116, 76, 69, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 111, 102, 102, 115, 101, 116, 44, 32, 98, 121, 116, 101, 76, 101, 110, 103, 116, 104, 44, 32, 110, 111, 65, 115, 115, 101, 114, 116, 41, 32, 123, 10, 32, 32, 111, 102, 102, 115, 101, 116, 32, 61, 32, 111, 102, 102, 115, 101, 116, 32, 62, 62, 62, 32, 48, 59, 10, 32, 32, 98, 121, 116, 101, 76, 101, 110, 103, 116, 104, 32, 61, 32, 98, 121, 116, 101, 76, 101, 110, 103, 116, 104, 32, 62, 62, 62, 32, 48, 59, 10, 32, 32, 105, 102, 32, 40, 33, 110, 111, 65, 115, 115, 101, 114, 116, 41, 10, 32, 32, 32, 32, 99, 104, 101, 99, 107, 79, 102, 102, 115, 101, 116, 40, 111, 102, 102, 115, 101, 116, 44, 32, 98, 121, 116, 101, 76, 101, 110, 103, 116, 104, 44, 32, 116, 104, 105, 115, 46, 108, 101, 110, 103, 116, 104, 41, 59, 10, 10, 32, 32, 118, 97, 114, 32, 118, 97, 108, 32, 61, 32, 116, 104, 105, 115, 46, 103, 101, 116, 65, 116, 40, 111, 102, 102, 115, 101, 116, 41, 59, 10, 32, 32, 118, 97, 114, 32, 109, 117, 108, 32, 61, 32, 49, 59, 10, 32, 32, 118, 97, 114, 32, 105, 32, 61, 32, 48, 59, 10, 32, 32, 119, 104, 105, 108, 101, 32, 40, 43, 43, 105, 32, 60, 32, 98, 121, 116, 101, 76, 101, 110, 103, 116, 104, 32, 38, 38, 32, 40, 109, 117, 108, 32, 42, 61, 32, 48, 120, 49, 48, 48, 41, 41, 10, 32, 32, 32, 32, 118, 97, 108, 32, 43, 61, 32, 116, 104, 105, 115, 46, 103, 101, 116, 65, 116, 40, 111, 102, 102, 115, 101, 116, 32, 43, 32, 105, 41, 32, 42, 32, 109, 117, 108, 59, 10, 32, 32, 109, 117, 108, 32, 42, 61, 32, 48, 120, 56, 48, 59, 10, 10, 32, 32, 105, 102, 32, 40, 118, 97, 108, 32, 62, 61, 32, 109, 117, 108, 41, 10, 32, 32, 32, 32, 118, 97, 108, 32, 45, 61, 32, 77, 97, 116, 104, 46, 112, 111, 119, 40, 50, 44, 32, 56, 32, 42, 32, 98, 121, 116, 101, 76, 101, 110, 103, 116, 104, 41, 59, 10, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 118, 97, 108, 59, 10, 125, 59, 10, 10, 10, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 114, 101, 97, 100, 73, 110, 116, 66, 69, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 111, 102, 102, 115, 101, 116, 44, 32, 98, 121, 116, 101, 76, 101, 110, 103, 116, 104, 44, 32, 110, 111, 65, 115, 115, 101, 114, 116, 41, 32, 123, 10, 32, 32, 111, 102, 102, 115, 101, 116, 32, 61, 32, 111, 102, 102, 115, 101, 116, 32, 62, 62, 62, 32, 48, 59, 10, 32, 32, 98, 121, 116, 101, 76, 101, 110, 103, 116, 104, 32, 61, 32, 98, 121, 116, 101, 76, 101, 110, 103, 116, 104, 32, 62, 62, 62, 32, 48, 59, 10, 32, 32, 105, 102, 32, 40, 33, 110, 111, 65, 115, 115, 101, 114, 116, 41, 10, 32, 32, 32, 32, 99, 104, 101, 99, 107, 79, 102, 102, 115, 101, 116, 40, 111, 102, 102, 115, 101, 116, 44, 32, 98, 121, 116, 101, 76, 101, 110, 103, 116, 104, 44, 32, 116, 104, 105, 115, 46, 108, 101, 110, 103, 116, 104, 41, 59, 10, 10, 32, 32, 118, 97, 114, 32, 105, 32, 61, 32, 98, 121, 116, 101, 76, 101, 110, 103, 116, 104, 59, 10, 32, 32, 118, 97, 114, 32, 109, 117, 108, 32, 61, 32, 49, 59, 10, 32, 32, 118, 97, 114, 32, 118, 97, 108, 32, 61, 32, 116, 104, 105, 115, 46, 103, 101, 116, 65, 116, 40, 111, 102, 102, 115, 101, 116, 32, 43, 32, 45, 45, 105, 41, 59, 10, 32, 32, 119, 104, 105, 108, 101, 32, 40, 105, 32, 62, 32, 48, 32, 38, 38, 32, 40, 109, 117, 108, 32, 42, 61, 32, 48, 120, 49, 48, 48, 41, 41, 10, 32, 32, 32, 32, 118, 97, 108, 32, 43, 61, 32, 116, 104, 105, 115, 46, 103, 101, 116, 65, 116, 40, 111, 102, 102, 115, 101, 116, 32, 43, 32, 45, 45, 105, 41, 32, 42, 32, 109, 117, 108, 59, 10, 32, 32, 109, 117, 108, 32, 42, 61, 32, 48, 120, 56, 48, 59, 10, 10, 32, 32, 105, 102, 32, 40, 118, 97, 108, 32, 62, 61, 32, 109, 117, 108, 41, 10, 32, 32, 32, 32, 118, 97, 108, 32, 45, 61, 32, 77, 97, 116, 104, 46, 112, 111, 119, 40, 50, 44, 32, 56, 32, 42, 32, 98, 121, 116, 101, 76, 101, 110, 103, 116, 104, 41, 59, 10, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 118, 97, 108, 59, 10, 125, 59, 10, 10, 10, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 114, 101, 97, 100, 73, 110, 116, 56, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 111, 102, 102, 115, 101, 116, 44, 32, 110, 111, 65, 115, 115, 101, 114, 116, 41, 32, 123, 10, 32, 32, 111, 102, 102, 115, 101, 116, 32, 61, 32, 111, 102, 102, 115, 101, 116, 32, 62, 62, 62, 32, 48, 59, 10, 32, 32, 105, 102, 32, 40, 33, 110, 111, 65, 115, 115, 101, 114, 116, 41, 10, 32, 32, 32, 32, 99, 104, 101, 99, 107, 79, 102, 102, 115, 101, 116, 40, 111, 102, 102, 115, 101, 116, 44, 32, 49, 44, 32, 116, 104, 105, 115, 46, 108, 101, 110, 103, 116, 104, 41, 59, 10, 32, 32, 118, 97, 114, 32, 118, 97, 108, 32, 61, 32, 116, 104, 105, 115, 46, 103, 101, 116, 65, 116, 40, 111, 102, 102, 115, 101, 116, 41, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 33, 40, 118, 97, 108, 32, 38, 32, 48, 120, 56, 48, 41, 32, 63, 32, 118, 97, 108, 32, 58, 32, 40, 48, 120, 102, 102, 32, 45, 32, 118, 97, 108, 32, 43, 32, 49, 41, 32, 42, 32, 45, 49, 59, 10, 125, 59, 10, 10, 10, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 114, 101, 97, 100, 73, 110, 116, 49, 54, 76, 69, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 111, 102, 102, 115, 101, 116, 44, 32, 110, 111, 65, 115, 115, 101, 114, 116, 41, 32, 123, 10, 32, 32, 111, 102, 102, 115, 101, 116, 32, 61, 32, 111, 102, 102, 115, 101, 116, 32, 62, 62, 62, 32, 48, 59, 10, 32, 32, 105, 102, 32, 40, 33, 110, 111, 65, 115, 115, 101, 114, 116, 41, 10, 32, 32, 32, 32, 99, 104, 101, 99, 107, 79, 102, 102, 115, 101, 116, 40, 111, 102, 102, 115, 101, 116, 44, 32, 50, 44, 32, 116, 104, 105, 115, 46, 108, 101, 110, 103, 116, 104, 41, 59, 10, 32, 32, 118, 97, 114, 32, 118, 97, 108, 32, 61, 32, 116, 104, 105, 115, 46, 103, 101, 116, 65, 116, 40, 111, 102, 102, 115, 101, 116, 41, 32, 124, 32, 40, 116, 104, 105, 115, 46, 103, 101, 116, 65, 116, 40, 111, 102, 102, 115, 101, 116, 32, 43, 32, 49, 41, 32, 60, 60, 32, 56, 41, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 40, 118, 97, 108, 32, 38, 32, 48, 120, 56, 48, 48, 48, 41, 32, 63, 32, 118, 97, 108, 32, 124, 32, 48, 120, 70, 70, 70, 70, 48, 48, 48, 48, 32, 58, 32, 118, 97, 108, 59, 10, 125, 59, 10, 10, 10, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 114, 101, 97, 100, 73, 110, 116, 49, 54, 66, 69, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 111, 102, 102, 115, 101, 116, 44, 32, 110, 111, 65, 115, 115, 101, 114, 116, 41, 32, 123, 10, 32, 32, 111, 102, 102, 115, 101, 116, 32, 61, 32, 111, 102, 102, 115, 101, 116, 32, 62, 62, 62, 32, 48, 59, 10, 32, 32, 105, 102, 32, 40, 33, 110, 111, 65, 115, 115, 101, 114, 116, 41, 10, 32, 32, 32, 32, 99, 104, 101, 99, 107, 79, 102, 102, 115, 101, 116, 40, 111, 102, 102, 115, 101, 116, 44, 32, 50, 44, 32, 116, 104, 105, 115, 46, 108, 101, 110, 103, 116, 104, 41, 59, 10, 32, 32, 118, 97, 114, 32, 118, 97, 108, 32, 61, 32, 116, 104, 105, 115, 46, 103, 101, 116, 65, 116, 40, 111, 102, 102, 115, 101, 116, 32, 43, 32, 49, 41, 32, 124, 32, 40, 116, 104, 105, 115, 46, 103, 101, 116, 65, 116, 40, 111, 102, 102, 115, 101, 116, 41, 32, 60, 60, 32, 56, 41, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 40, 118, 97, 108, 32, 38, 32, 48, 120, 56, 48, 48, 48, 41, 32, 63, 32, 118, 97, 108, 32, 124, 32, 48, 120, 70, 70, 70, 70, 48, 48, 48, 48, 32, 58, 32, 118, 97, 108, 59, 10, 125, 59, 10, 10, 10, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 114, 101, 97, 100, 73, 110, 116, 51, 50, 76, 69, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 111, 102, 102, 115, 101, 116, 44, 32, 110, 111, 65, 115, 115, 101, 114, 116, 41, 32, 123, 10, 32, 32, 111, 102, 102, 115, 101, 116, 32, 61, 32, 111, 102, 102, 115, 101, 116, 32, 62, 62, 62, 32, 48, 59, 10, 32, 32, 105, 102, 32, 40, 33, 110, 111, 65, 115, 115, 101, 114, 116, 41, 10, 32, 32, 32, 32, 99, 104, 101, 99, 107, 79, 102, 102, 115, 101, 116, 40, 111, 102, 102, 115, 101, 116, 44, 32, 52, 44, 32, 116, 104, 105, 115, 46, 108, 101, 110, 103, 116, 104, 41, 59, 10, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 40, 116, 104, 105, 115, 46, 103, 101, 116, 65, 116, 40, 111, 102, 102, 115, 101, 116, 41, 41, 32, 124, 10, 32, 32, 32, 32, 32, 32, 40, 116, 104, 105, 115, 46, 103, 101, 116, 65, 116, 40, 111, 102, 102, 115, 101, 116, 32, 43, 32, 49, 41, 32, 60, 60, 32, 56, 41, 32, 124, 10, 32, 32, 32, 32, 32, 32, 40, 116, 104, 105, 115, 46, 103, 101, 116, 65, 116, 40, 111, 102, 102, 115, 101, 116, 32, 43, 32, 50, 41, 32, 60, 60, 32, 49, 54, 41, 32, 124, 10, 32, 32, 32, 32, 32, 32, 40, 116, 104, 105, 115, 46, 103, 101, 116, 65, 116, 40, 111, 102, 102, 115, 101, 116, 32, 43, 32, 51, 41, 32, 60, 60, 32, 50, 52, 41, 59, 10, 125, 59, 10, 10, 10, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 114, 101, 97, 100, 73, 110, 116, 51, 50, 66, 69, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 111, 102, 102, 115, 101, 116, 44, 32, 110, 111, 65, 115, 115, 101, 114, 116, 41, 32, 123, 10, 32, 32, 111, 102, 102, 115, 101, 116, 32, 61, 32, 111, 102, 102, 115, 101, 116, 32, 62, 62, 62, 32, 48, 59, 10, 32, 32, 105, 102, 32, 40, 33, 110, 111, 65, 115, 115, 101, 114, 116, 41, 10, 32, 32, 32, 32, 99, 104, 101, 99, 107, 79, 102, 102, 115, 101, 116, 40, 111, 102, 102, 115, 101, 116, 44, 32, 52, 44, 32, 116, 104, 105, 115, 46, 108, 101, 110, 103, 116, 104, 41, 59, 10, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 40, 116, 104, 105, 115, 46, 103, 101, 116, 65, 116, 40, 111, 102, 102, 115, 101, 116, 41, 32, 60, 60, 32, 50, 52, 41, 32, 124, 10, 32, 32, 32, 32, 32, 32, 40, 116, 104, 105, 115, 46, 103, 101, 116, 65, 116, 40, 111, 102, 102, 115, 101, 116, 32, 43, 32, 49, 41, 32, 60, 60, 32, 49, 54, 41, 32, 124, 10, 32, 32, 32, 32, 32, 32, 40, 116, 104, 105, 115, 46, 103, 101, 116, 65, 116, 40, 111, 102, 102, 115, 101, 116, 32, 43, 32, 50, 41, 32, 60, 60, 32, 56, 41, 32, 124, 10, 32, 32, 32, 32, 32, 32, 40, 116, 104, 105, 115, 46, 103, 101, 116, 65, 116, 40, 111, 102, 102, 115, 101, 116, 32, 43, 32, 51, 41, 41, 59, 10, 125, 59, 10, 10, 10, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 114, 101, 97, 100, 70, 108, 111, 97, 116, 76, 69, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 32, 114, 101, 97, 100, 70, 108, 111, 97, 116, 76, 69, 40, 111, 102, 102, 115, 101, 116, 44, 32, 110, 111, 65, 115, 115, 101, 114, 116, 41, 32, 123, 10, 32, 32, 111, 102, 102, 115, 101, 116, 32, 61, 32, 111, 102, 102, 115, 101, 116, 32, 62, 62, 62, 32, 48, 59, 10, 32, 32, 105, 102, 32, 40, 33, 110, 111, 65, 115, 115, 101, 114, 116, 41, 10, 32, 32, 32, 32, 99, 104, 101, 99, 107, 79, 102, 102, 115, 101, 116, 40, 111, 102, 102, 115, 101, 116, 44, 32, 52, 44, 32, 116, 104, 105, 115, 46, 108, 101, 110, 103, 116, 104, 41, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 98, 105, 110, 100, 105, 110, 103, 46, 114, 101, 97, 100, 70, 108, 111, 97, 116, 76, 69, 40, 116, 104, 105, 115, 44, 32, 111, 102, 102, 115, 101, 116, 41, 59, 10, 125, 59, 10, 10, 10, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 114, 101, 97, 100, 70, 108, 111, 97, 116, 66, 69, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 32, 114, 101, 97, 100, 70, 108, 111, 97, 116, 66, 69, 40, 111, 102, 102, 115, 101, 116, 44, 32, 110, 111, 65, 115, 115, 101, 114, 116, 41, 32, 123, 10, 32, 32, 111, 102, 102, 115, 101, 116, 32, 61, 32, 111, 102, 102, 115, 101, 116, 32, 62, 62, 62, 32, 48, 59, 10, 32, 32, 105, 102, 32, 40, 33, 110, 111, 65, 115, 115, 101, 114, 116, 41, 10, 32, 32, 32, 32, 99, 104, 101, 99, 107, 79, 102, 102, 115, 101, 116, 40, 111, 102, 102, 115, 101, 116, 44, 32, 52, 44, 32, 116, 104, 105, 115, 46, 108, 101, 110, 103, 116, 104, 41, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 98, 105, 110, 100, 105, 110, 103, 46, 114, 101, 97, 100, 70, 108, 111, 97, 116, 66, 69, 40, 116, 104, 105, 115, 44, 32, 111, 102, 102, 115, 101, 116, 41, 59, 10, 125, 59, 10, 10, 10, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 114, 101, 97, 100, 68, 111, 117, 98, 108, 101, 76, 69, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 32, 114, 101, 97, 100, 68, 111, 117, 98, 108, 101, 76, 69, 40, 111, 102, 102, 115, 101, 116, 44, 32, 110, 111, 65, 115, 115, 101, 114, 116, 41, 32, 123, 10, 32, 32, 111, 102, 102, 115, 101, 116, 32, 61, 32, 111, 102, 102, 115, 101, 116, 32, 62, 62, 62, 32, 48, 59, 10, 32, 32, 105, 102, 32, 40, 33, 110, 111, 65, 115, 115, 101, 114, 116, 41, 10, 32, 32, 32, 32, 99, 104, 101, 99, 107, 79, 102, 102, 115, 101, 116, 40, 111, 102, 102, 115, 101, 116, 44, 32, 56, 44, 32, 116, 104, 105, 115, 46, 108, 101, 110, 103, 116, 104, 41, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 98, 105, 110, 100, 105, 110, 103, 46, 114, 101, 97, 100, 68, 111, 117, 98, 108, 101, 76, 69, 40, 116, 104, 105, 115, 44, 32, 111, 102, 102, 115, 101, 116, 41, 59, 10, 125, 59, 10, 10, 10, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 114, 101, 97, 100, 68, 111, 117, 98, 108, 101, 66, 69, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 32, 114, 101, 97, 100, 68, 111, 117, 98, 108, 101, 66, 69, 40, 111, 102, 102, 115, 101, 116, 44, 32, 110, 111, 65, 115, 115, 101, 114, 116, 41, 32, 123, 10, 32, 32, 111, 102, 102, 115, 101, 116, 32, 61, 32, 111, 102, 102, 115, 101, 116, 32, 62, 62, 62, 32, 48, 59, 10, 32, 32, 105, 102, 32, 40, 33, 110, 111, 65, 115, 115, 101, 114, 116, 41, 10, 32, 32, 32, 32, 99, 104, 101, 99, 107, 79, 102, 102, 115, 101, 116, 40, 111, 102, 102, 115, 101, 116, 44, 32, 56, 44, 32, 116, 104, 105, 115, 46, 108, 101, 110, 103, 116, 104, 41, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 98, 105, 110, 100, 105, 110, 103, 46, 114, 101, 97, 100, 68, 111, 117, 98, 108, 101, 66, 69, 40, 116, 104, 105, 115, 44, 32, 111, 102, 102, 115, 101, 116, 41, 59, 10, 125, 59, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 99, 104, 101, 99, 107, 73, 110, 116, 40, 98, 117, 102, 102, 101, 114, 44, 32, 118, 97, 108, 117, 101, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 101, 120, 116, 44, 32, 109, 97, 120, 44, 32, 109, 105, 110, 41, 32, 123, 10, 32, 32, 105, 102, 32, 40, 33, 40, 98, 117, 102, 102, 101, 114, 32, 105, 110, 115, 116, 97, 110, 99, 101, 111, 102, 32, 66, 117, 102, 102, 101, 114, 41, 41, 10, 32, 32, 32, 32, 116, 104, 114, 111, 119, 32, 110, 101, 119, 32, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 98, 117, 102, 102, 101, 114, 32, 109, 117, 115, 116, 32, 98, 101, 32, 97, 32, 66, 117, 102, 102, 101, 114, 32, 105, 110, 115, 116, 97, 110, 99, 101, 39, 41, 59, 10, 32, 32, 105, 102, 32, 40, 118, 97, 108, 117, 101, 32, 62, 32, 109, 97, 120, 32, 124, 124, 32, 118, 97, 108, 117, 101, 32, 60, 32, 109, 105, 110, 41, 10, 32, 32, 32, 32, 116, 104, 114, 111, 119, 32, 110, 101, 119, 32, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 118, 97, 108, 117, 101, 32, 105, 115, 32, 111, 117, 116, 32, 111, 102, 32, 98, 111, 117, 110, 100, 115, 39, 41, 59, 10, 32, 32, 105, 102, 32, 40, 111, 102, 102, 115, 101, 116, 32, 43, 32, 101, 120, 116, 32, 62, 32, 98, 117, 102, 102, 101, 114, 46, 108, 101, 110, 103, 116, 104, 41, 10, 32, 32, 32, 32, 116, 104, 114, 111, 119, 32, 110, 101, 119, 32, 82, 97, 110, 103, 101, 69, 114, 114, 111, 114, 40, 39, 105, 110, 100, 101, 120, 32, 111, 117, 116, 32, 111, 102, 32, 114, 97, 110, 103, 101, 39, 41, 59, 10, 125, 10, 10, 10, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 119, 114, 105, 116, 101, 85, 73, 110, 116, 76, 69, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 118, 97, 108, 117, 101, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 98, 121, 116, 101, 76, 101, 110, 103, 116, 104, 44, 32, 110, 111, 65, 115, 115, 101, 114, 116, 41, 32, 123, 10, 32, 32, 118, 97, 108, 117, 101, 32, 61, 32, 43, 118, 97, 108, 117, 101, 59, 10, 32, 32, 111, 102, 102, 115, 101, 116, 32, 61, 32, 111, 102, 102, 115, 101, 116, 32, 62, 62, 62, 32, 48, 59, 10, 32, 32, 98, 121, 116, 101, 76, 101, 110, 103, 116, 104, 32, 61, 32, 98, 121, 116, 101, 76, 101, 110, 103, 116, 104, 32, 62, 62, 62, 32, 48, 59, 10, 32, 32, 105, 102, 32, 40, 33, 110, 111, 65, 115, 115, 101, 114, 116, 41, 32, 123, 10, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 109, 97, 120, 66, 121, 116, 101, 115, 32, 61, 32, 77, 97, 116, 104, 46, 112, 111, 119, 40, 50, 44, 32, 56, 32, 42, 32, 98, 121, 116, 101, 76, 101, 110, 103, 116, 104, 41, 32, 45, 32, 49, 59, 10, 32, 32, 32, 32, 99, 104, 101, 99, 107, 73, 110, 116, 40, 116, 104, 105, 115, 44, 32, 118, 97, 108, 117, 101, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 98, 121, 116, 101, 76, 101, 110, 103, 116, 104, 44, 32, 109, 97, 120, 66, 121, 116, 101, 115, 44, 32, 48, 41, 59, 10, 32, 32, 125, 10, 10, 32, 32, 118, 97, 114, 32, 109, 117, 108, 32, 61, 32, 49, 59, 10, 32, 32, 118, 97, 114, 32, 105, 32, 61, 32, 48, 59, 10, 32, 32, 116, 104, 105, 115, 46, 115, 101, 116, 65, 116, 40, 111, 102, 102, 115, 101, 116, 44, 32, 118, 97, 108, 117, 101, 32, 38, 32, 48, 120, 102, 102, 41, 59, 10, 32, 32, 119, 104, 105, 108, 101, 32, 40, 43, 43, 105, 32, 60, 32, 98, 121, 116, 101, 76, 101, 110, 103, 116, 104, 32, 38, 38, 32, 40, 109, 117, 108, 32, 42, 61, 32, 48, 120, 49, 48, 48, 41, 41, 10, 32, 32, 32, 32, 116, 104, 105, 115, 46, 115, 101, 116, 65, 116, 40, 111, 102, 102, 115, 101, 116, 32, 43, 32, 105, 44, 32, 40, 118, 97, 108, 117, 101, 32, 47, 32, 109, 117, 108, 41, 32, 38, 32, 48, 120, 102, 102, 41, 59, 10, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 111, 102, 102, 115, 101, 116, 32, 43, 32, 98, 121, 116, 101, 76, 101, 110, 103, 116, 104, 59, 10, 125, 59, 10, 10, 10, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 119, 114, 105, 116, 101, 85, 73, 110, 116, 66, 69, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 118, 97, 108, 117, 101, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 98, 121, 116, 101, 76, 101, 110, 103, 116, 104, 44, 32, 110, 111, 65, 115, 115, 101, 114, 116, 41, 32, 123, 10, 32, 32, 118, 97, 108, 117, 101, 32, 61, 32, 43, 118, 97, 108, 117, 101, 59, 10, 32, 32, 111, 102, 102, 115, 101, 116, 32, 61, 32, 111, 102, 102, 115, 101, 116, 32, 62, 62, 62, 32, 48, 59, 10, 32, 32, 98, 121, 116, 101, 76, 101, 110, 103, 116, 104, 32, 61, 32, 98, 121, 116, 101, 76, 101, 110, 103, 116, 104, 32, 62, 62, 62, 32, 48, 59, 10, 32, 32, 105, 102, 32, 40, 33, 110, 111, 65, 115, 115, 101, 114, 116, 41, 32, 123, 10, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 109, 97, 120, 66, 121, 116, 101, 115, 32, 61, 32, 77, 97, 116, 104, 46, 112, 111, 119, 40, 50, 44, 32, 56, 32, 42, 32, 98, 121, 116, 101, 76, 101, 110, 103, 116, 104, 41, 32, 45, 32, 49, 59, 10, 32, 32, 32, 32, 99, 104, 101, 99, 107, 73, 110, 116, 40, 116, 104, 105, 115, 44, 32, 118, 97, 108, 117, 101, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 98, 121, 116, 101, 76, 101, 110, 103, 116, 104, 44, 32, 109, 97, 120, 66, 121, 116, 101, 115, 44, 32, 48, 41, 59, 10, 32, 32, 125, 10, 10, 32, 32, 118, 97, 114, 32, 105, 32, 61, 32, 98, 121, 116, 101, 76, 101, 110, 103, 116, 104, 32, 45, 32, 49, 59, 10, 32, 32, 118, 97, 114, 32, 109, 117, 108, 32, 61, 32, 49, 59, 10, 32, 32, 116, 104, 105, 115, 46, 115, 101, 116, 65, 116, 40, 111, 102, 102, 115, 101, 116, 32, 43, 32, 105, 44, 32, 118, 97, 108, 117, 101, 32, 38, 32, 48, 120, 102, 102, 41, 59, 10, 32, 32, 119, 104, 105, 108, 101, 32, 40, 45, 45, 105, 32, 62, 61, 32, 48, 32, 38, 38, 32, 40, 109, 117, 108, 32, 42, 61, 32, 48, 120, 49, 48, 48, 41, 41, 10, 32, 32, 32, 32, 116, 104, 105, 115, 46, 115, 101, 116, 65, 116, 40, 111, 102, 102, 115, 101, 116, 32, 43, 32, 105, 44, 32, 40, 118, 97, 108, 117, 101, 32, 47, 32, 109, 117, 108, 41, 32, 38, 32, 48, 120, 102, 102, 41, 59, 10, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 111, 102, 102, 115, 101, 116, 32, 43, 32, 98, 121, 116, 101, 76, 101, 110, 103, 116, 104, 59, 10, 125, 59, 10, 10, 10, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 119, 114, 105, 116, 101, 85, 73, 110, 116, 56, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 118, 97, 108, 117, 101, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 110, 111, 65, 115, 115, 101, 114, 116, 41, 32, 123, 10, 32, 32, 118, 97, 108, 117, 101, 32, 61, 32, 43, 118, 97, 108, 117, 101, 59, 10, 32, 32, 111, 102, 102, 115, 101, 116, 32, 61, 32, 111, 102, 102, 115, 101, 116, 32, 62, 62, 62, 32, 48, 59, 10, 32, 32, 105, 102, 32, 40, 33, 110, 111, 65, 115, 115, 101, 114, 116, 41, 10, 32, 32, 32, 32, 99, 104, 101, 99, 107, 73, 110, 116, 40, 116, 104, 105, 115, 44, 32, 118, 97, 108, 117, 101, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 49, 44, 32, 48, 120, 102, 102, 44, 32, 48, 41, 59, 10, 32, 32, 116, 104, 105, 115, 46, 115, 101, 116, 65, 116, 40, 111, 102, 102, 115, 101, 116, 44, 32, 118, 97, 108, 117, 101, 41, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 111, 102, 102, 115, 101, 116, 32, 43, 32, 49, 59, 10, 125, 59, 10, 10, 10, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 119, 114, 105, 116, 101, 85, 73, 110, 116, 49, 54, 76, 69, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 118, 97, 108, 117, 101, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 110, 111, 65, 115, 115, 101, 114, 116, 41, 32, 123, 10, 32, 32, 118, 97, 108, 117, 101, 32, 61, 32, 43, 118, 97, 108, 117, 101, 59, 10, 32, 32, 111, 102, 102, 115, 101, 116, 32, 61, 32, 111, 102, 102, 115, 101, 116, 32, 62, 62, 62, 32, 48, 59, 10, 32, 32, 105, 102, 32, 40, 33, 110, 111, 65, 115, 115, 101, 114, 116, 41, 10, 32, 32, 32, 32, 99, 104, 101, 99, 107, 73, 110, 116, 40, 116, 104, 105, 115, 44, 32, 118, 97, 108, 117, 101, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 50, 44, 32, 48, 120, 102, 102, 102, 102, 44, 32, 48, 41, 59, 10, 32, 32, 116, 104, 105, 115, 46, 115, 101, 116, 65, 116, 40, 111, 102, 102, 115, 101, 116, 44, 32, 32, 32, 32, 32, 118, 97, 108, 117, 101, 41, 59, 10, 32, 32, 116, 104, 105, 115, 46, 115, 101, 116, 65, 116, 40, 111, 102, 102, 115, 101, 116, 32, 43, 32, 49, 44, 32, 118, 97, 108, 117, 101, 32, 62, 62, 62, 32, 56, 41, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 111, 102, 102, 115, 101, 116, 32, 43, 32, 50, 59, 10, 125, 59, 10, 10, 10, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 119, 114, 105, 116, 101, 85, 73, 110, 116, 49, 54, 66, 69, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 118, 97, 108, 117, 101, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 110, 111, 65, 115, 115, 101, 114, 116, 41, 32, 123, 10, 32, 32, 118, 97, 108, 117, 101, 32, 61, 32, 43, 118, 97, 108, 117, 101, 59, 10, 32, 32, 111, 102, 102, 115, 101, 116, 32, 61, 32, 111, 102, 102, 115, 101, 116, 32, 62, 62, 62, 32, 48, 59, 10, 32, 32, 105, 102, 32, 40, 33, 110, 111, 65, 115, 115, 101, 114, 116, 41, 10, 32, 32, 32, 32, 99, 104, 101, 99, 107, 73, 110, 116, 40, 116, 104, 105, 115, 44, 32, 118, 97, 108, 117, 101, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 50, 44, 32, 48, 120, 102, 102, 102, 102, 44, 32, 48, 41, 59, 10, 32, 32, 116, 104, 105, 115, 46, 115, 101, 116, 65, 116, 40, 111, 102, 102, 115, 101, 116, 44, 32, 32, 32, 32, 32, 118, 97, 108, 117, 101, 32, 62, 62, 62, 32, 56, 41, 59, 10, 32, 32, 116, 104, 105, 115, 46, 115, 101, 116, 65, 116, 40, 111, 102, 102, 115, 101, 116, 32, 43, 32, 49, 44, 32, 118, 97, 108, 117, 101, 41, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 111, 102, 102, 115, 101, 116, 32, 43, 32, 50, 59, 10, 125, 59, 10, 10, 10, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 119, 114, 105, 116, 101, 85, 73, 110, 116, 51, 50, 76, 69, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 118, 97, 108, 117, 101, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 110, 111, 65, 115, 115, 101, 114, 116, 41, 32, 123, 10, 32, 32, 118, 97, 108, 117, 101, 32, 61, 32, 43, 118, 97, 108, 117, 101, 59, 10, 32, 32, 111, 102, 102, 115, 101, 116, 32, 61, 32, 111, 102, 102, 115, 101, 116, 32, 62, 62, 62, 32, 48, 59, 10, 32, 32, 105, 102, 32, 40, 33, 110, 111, 65, 115, 115, 101, 114, 116, 41, 10, 32, 32, 32, 32, 99, 104, 101, 99, 107, 73, 110, 116, 40, 116, 104, 105, 115, 44, 32, 118, 97, 108, 117, 101, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 52, 44, 32, 48, 120, 102, 102, 102, 102, 102, 102, 102, 102, 44, 32, 48, 41, 59, 10, 32, 32, 116, 104, 105, 115, 46, 115, 101, 116, 65, 116, 40, 111, 102, 102, 115, 101, 116, 32, 43, 32, 51, 44, 32, 118, 97, 108, 117, 101, 32, 62, 62, 62, 32, 50, 52, 41, 59, 10, 32, 32, 116, 104, 105, 115, 46, 115, 101, 116, 65, 116, 40, 111, 102, 102, 115, 101, 116, 32, 43, 32, 50, 44, 32, 118, 97, 108, 117, 101, 32, 62, 62, 62, 32, 49, 54, 41, 59, 10, 32, 32, 116, 104, 105, 115, 46, 115, 101, 116, 65, 116, 40, 111, 102, 102, 115, 101, 116, 32, 43, 32, 49, 44, 32, 118, 97, 108, 117, 101, 32, 62, 62, 62, 32, 56, 41, 59, 10, 32, 32, 116, 104, 105, 115, 46, 115, 101, 116, 65, 116, 40, 111, 102, 102, 115, 101, 116, 44, 32, 32, 32, 32, 32, 118, 97, 108, 117, 101, 41, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 111, 102, 102, 115, 101, 116, 32, 43, 32, 52, 59, 10, 125, 59, 10, 10, 10, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 119, 114, 105, 116, 101, 85, 73, 110, 116, 51, 50, 66, 69, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 118, 97, 108, 117, 101, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 110, 111, 65, 115, 115, 101, 114, 116, 41, 32, 123, 10, 32, 32, 118, 97, 108, 117, 101, 32, 61, 32, 43, 118, 97, 108, 117, 101, 59, 10, 32, 32, 111, 102, 102, 115, 101, 116, 32, 61, 32, 111, 102, 102, 115, 101, 116, 32, 62, 62, 62, 32, 48, 59, 10, 32, 32, 105, 102, 32, 40, 33, 110, 111, 65, 115, 115, 101, 114, 116, 41, 10, 32, 32, 32, 32, 99, 104, 101, 99, 107, 73, 110, 116, 40, 116, 104, 105, 115, 44, 32, 118, 97, 108, 117, 101, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 52, 44, 32, 48, 120, 102, 102, 102, 102, 102, 102, 102, 102, 44, 32, 48, 41, 59, 10, 32, 32, 116, 104, 105, 115, 46, 115, 101, 116, 65, 116, 40, 111, 102, 102, 115, 101, 116, 44, 32, 32, 32, 32, 32, 118, 97, 108, 117, 101, 32, 62, 62, 62, 32, 50, 52, 41, 59, 10, 32, 32, 116, 104, 105, 115, 46, 115, 101, 116, 65, 116, 40, 111, 102, 102, 115, 101, 116, 32, 43, 32, 49, 44, 32, 118, 97, 108, 117, 101, 32, 62, 62, 62, 32, 49, 54, 41, 59, 10, 32, 32, 116, 104, 105, 115, 46, 115, 101, 116, 65, 116, 40, 111, 102, 102, 115, 101, 116, 32, 43, 32, 50, 44, 32, 118, 97, 108, 117, 101, 32, 62, 62, 62, 32, 56, 41, 59, 10, 32, 32, 116, 104, 105, 115, 46, 115, 101, 116, 65, 116, 40, 111, 102, 102, 115, 101, 116, 32, 43, 32, 51, 44, 32, 118, 97, 108, 117, 101, 41, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 111, 102, 102, 115, 101, 116, 32, 43, 32, 52, 59, 10, 125, 59, 10, 10, 10, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 119, 114, 105, 116, 101, 73, 110, 116, 76, 69, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 118, 97, 108, 117, 101, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 98, 121, 116, 101, 76, 101, 110, 103, 116, 104, 44, 32, 110, 111, 65, 115, 115, 101, 114, 116, 41, 32, 123, 10, 32, 32, 118, 97, 108, 117, 101, 32, 61, 32, 43, 118, 97, 108, 117, 101, 59, 10, 32, 32, 111, 102, 102, 115, 101, 116, 32, 61, 32, 111, 102, 102, 115, 101, 116, 32, 62, 62, 62, 32, 48, 59, 10, 32, 32, 105, 102, 32, 40, 33, 110, 111, 65, 115, 115, 101, 114, 116, 41, 32, 123, 10, 32, 32, 32, 32, 99, 104, 101, 99, 107, 73, 110, 116, 40, 116, 104, 105, 115, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 118, 97, 108, 117, 101, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 111, 102, 102, 115, 101, 116, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 98, 121, 116, 101, 76, 101, 110, 103, 116, 104, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 77, 97, 116, 104, 46, 112, 111, 119, 40, 50, 44, 32, 56, 32, 42, 32, 98, 121, 116, 101, 76, 101, 110, 103, 116, 104, 32, 45, 32, 49, 41, 32, 45, 32, 49, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 45, 77, 97, 116, 104, 46, 112, 111, 119, 40, 50, 44, 32, 56, 32, 42, 32, 98, 121, 116, 101, 76, 101, 110, 103, 116, 104, 32, 45, 32, 49, 41, 41, 59, 10, 32, 32, 125, 10, 10, 32, 32, 118, 97, 114, 32, 105, 32, 61, 32, 48, 59, 10, 32, 32, 118, 97, 114, 32, 109, 117, 108, 32, 61, 32, 49, 59, 10, 32, 32, 118, 97, 114, 32, 115, 117, 98, 32, 61, 32, 48, 59, 10, 32, 32, 116, 104, 105, 115, 46, 115, 101, 116, 65, 116, 40, 111, 102, 102, 115, 101, 116, 44, 32, 118, 97, 108, 117, 101, 32, 38, 32, 48, 120, 102, 102, 41, 59, 10, 32, 32, 119, 104, 105, 108, 101, 32, 40, 43, 43, 105, 32, 60, 32, 98, 121, 116, 101, 76, 101, 110, 103, 116, 104, 32, 38, 38, 32, 40, 109, 117, 108, 32, 42, 61, 32, 48, 120, 49, 48, 48, 41, 41, 32, 123, 10, 32, 32, 32, 32, 105, 102, 32, 40, 118, 97, 108, 117, 101, 32, 60, 32, 48, 32, 38, 38, 32, 115, 117, 98, 32, 61, 61, 61, 32, 48, 32, 38, 38, 32, 116, 104, 105, 115, 46, 103, 101, 116, 65, 116, 40, 111, 102, 102, 115, 101, 116, 32, 43, 32, 105, 32, 45, 32, 49, 41, 32, 33, 61, 61, 32, 48, 41, 10, 32, 32, 32, 32, 32, 32, 115, 117, 98, 32, 61, 32, 49, 59, 10, 32, 32, 32, 32, 116, 104, 105, 115, 46, 115, 101, 116, 65, 116, 40, 111, 102, 102, 115, 101, 116, 32, 43, 32, 105, 44, 32, 40, 118, 97, 108, 117, 101, 32, 47, 32, 109, 117, 108, 32, 45, 32, 115, 117, 98, 41, 32, 38, 32, 48, 120, 102, 102, 41, 59, 10, 32, 32, 125, 10, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 111, 102, 102, 115, 101, 116, 32, 43, 32, 98, 121, 116, 101, 76, 101, 110, 103, 116, 104, 59, 10, 125, 59, 10, 10, 10, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 119, 114, 105, 116, 101, 73, 110, 116, 66, 69, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 118, 97, 108, 117, 101, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 98, 121, 116, 101, 76, 101, 110, 103, 116, 104, 44, 32, 110, 111, 65, 115, 115, 101, 114, 116, 41, 32, 123, 10, 32, 32, 118, 97, 108, 117, 101, 32, 61, 32, 43, 118, 97, 108, 117, 101, 59, 10, 32, 32, 111, 102, 102, 115, 101, 116, 32, 61, 32, 111, 102, 102, 115, 101, 116, 32, 62, 62, 62, 32, 48, 59, 10, 32, 32, 105, 102, 32, 40, 33, 110, 111, 65, 115, 115, 101, 114, 116, 41, 32, 123, 10, 32, 32, 32, 32, 99, 104, 101, 99, 107, 73, 110, 116, 40, 116, 104, 105, 115, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 118, 97, 108, 117, 101, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 111, 102, 102, 115, 101, 116, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 98, 121, 116, 101, 76, 101, 110, 103, 116, 104, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 77, 97, 116, 104, 46, 112, 111, 119, 40, 50, 44, 32, 56, 32, 42, 32, 98, 121, 116, 101, 76, 101, 110, 103, 116, 104, 32, 45, 32, 49, 41, 32, 45, 32, 49, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 45, 77, 97, 116, 104, 46, 112, 111, 119, 40, 50, 44, 32, 56, 32, 42, 32, 98, 121, 116, 101, 76, 101, 110, 103, 116, 104, 32, 45, 32, 49, 41, 41, 59, 10, 32, 32, 125, 10, 10, 32, 32, 118, 97, 114, 32, 105, 32, 61, 32, 98, 121, 116, 101, 76, 101, 110, 103, 116, 104, 32, 45, 32, 49, 59, 10, 32, 32, 118, 97, 114, 32, 109, 117, 108, 32, 61, 32, 49, 59, 10, 32, 32, 118, 97, 114, 32, 115, 117, 98, 32, 61, 32, 48, 59, 10, 32, 32, 116, 104, 105, 115, 46, 115, 101, 116, 65, 116, 40, 111, 102, 102, 115, 101, 116, 32, 43, 32, 105, 44, 32, 118, 97, 108, 117, 101, 32, 38, 32, 48, 120, 102, 102, 41, 59, 10, 32, 32, 119, 104, 105, 108, 101, 32, 40, 45, 45, 105, 32, 62, 61, 32, 48, 32, 38, 38, 32, 40, 109, 117, 108, 32, 42, 61, 32, 48, 120, 49, 48, 48, 41, 41, 32, 123, 10, 32, 32, 32, 32, 105, 102, 32, 40, 118, 97, 108, 117, 101, 32, 60, 32, 48, 32, 38, 38, 32, 115, 117, 98, 32, 61, 61, 61, 32, 48, 32, 38, 38, 32, 116, 104, 105, 115, 46, 103, 101, 116, 65, 116, 40, 111, 102, 102, 115, 101, 116, 32, 43, 32, 105, 32, 43, 32, 49, 41, 32, 33, 61, 61, 32, 48, 41, 10, 32, 32, 32, 32, 32, 32, 115, 117, 98, 32, 61, 32, 49, 59, 10, 32, 32, 32, 32, 116, 104, 105, 115, 46, 115, 101, 116, 65, 116, 40, 111, 102, 102, 115, 101, 116, 32, 43, 32, 105, 44, 32, 40, 118, 97, 108, 117, 101, 32, 47, 32, 109, 117, 108, 32, 45, 32, 115, 117, 98, 41, 32, 38, 32, 48, 120, 102, 102, 41, 59, 10, 32, 32, 125, 10, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 111, 102, 102, 115, 101, 116, 32, 43, 32, 98, 121, 116, 101, 76, 101, 110, 103, 116, 104, 59, 10, 125, 59, 10, 10, 10, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 119, 114, 105, 116, 101, 73, 110, 116, 56, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 118, 97, 108, 117, 101, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 110, 111, 65, 115, 115, 101, 114, 116, 41, 32, 123, 10, 32, 32, 118, 97, 108, 117, 101, 32, 61, 32, 43, 118, 97, 108, 117, 101, 59, 10, 32, 32, 111, 102, 102, 115, 101, 116, 32, 61, 32, 111, 102, 102, 115, 101, 116, 32, 62, 62, 62, 32, 48, 59, 10, 32, 32, 105, 102, 32, 40, 33, 110, 111, 65, 115, 115, 101, 114, 116, 41, 10, 32, 32, 32, 32, 99, 104, 101, 99, 107, 73, 110, 116, 40, 116, 104, 105, 115, 44, 32, 118, 97, 108, 117, 101, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 49, 44, 32, 48, 120, 55, 102, 44, 32, 45, 48, 120, 56, 48, 41, 59, 10, 32, 32, 116, 104, 105, 115, 46, 115, 101, 116, 65, 116, 40, 111, 102, 102, 115, 101, 116, 44, 32, 118, 97, 108, 117, 101, 41, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 111, 102, 102, 115, 101, 116, 32, 43, 32, 49, 59, 10, 125, 59, 10, 10, 10, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 119, 114, 105, 116, 101, 73, 110, 116, 49, 54, 76, 69, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 118, 97, 108, 117, 101, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 110, 111, 65, 115, 115, 101, 114, 116, 41, 32, 123, 10, 32, 32, 118, 97, 108, 117, 101, 32, 61, 32, 43, 118, 97, 108, 117, 101, 59, 10, 32, 32, 111, 102, 102, 115, 101, 116, 32, 61, 32, 111, 102, 102, 115, 101, 116, 32, 62, 62, 62, 32, 48, 59, 10, 32, 32, 105, 102, 32, 40, 33, 110, 111, 65, 115, 115, 101, 114, 116, 41, 10, 32, 32, 32, 32, 99, 104, 101, 99, 107, 73, 110, 116, 40, 116, 104, 105, 115, 44, 32, 118, 97, 108, 117, 101, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 50, 44, 32, 48, 120, 55, 102, 102, 102, 44, 32, 45, 48, 120, 56, 48, 48, 48, 41, 59, 10, 32, 32, 116, 104, 105, 115, 46, 115, 101, 116, 65, 116, 40, 111, 102, 102, 115, 101, 116, 44, 32, 32, 32, 32, 32, 118, 97, 108, 117, 101, 41, 59, 10, 32, 32, 116, 104, 105, 115, 46, 115, 101, 116, 65, 116, 40, 111, 102, 102, 115, 101, 116, 32, 43, 32, 49, 44, 32, 118, 97, 108, 117, 101, 32, 62, 62, 62, 32, 56, 41, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 111, 102, 102, 115, 101, 116, 32, 43, 32, 50, 59, 10, 125, 59, 10, 10, 10, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 119, 114, 105, 116, 101, 73, 110, 116, 49, 54, 66, 69, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 118, 97, 108, 117, 101, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 110, 111, 65, 115, 115, 101, 114, 116, 41, 32, 123, 10, 32, 32, 118, 97, 108, 117, 101, 32, 61, 32, 43, 118, 97, 108, 117, 101, 59, 10, 32, 32, 111, 102, 102, 115, 101, 116, 32, 61, 32, 111, 102, 102, 115, 101, 116, 32, 62, 62, 62, 32, 48, 59, 10, 32, 32, 105, 102, 32, 40, 33, 110, 111, 65, 115, 115, 101, 114, 116, 41, 10, 32, 32, 32, 32, 99, 104, 101, 99, 107, 73, 110, 116, 40, 116, 104, 105, 115, 44, 32, 118, 97, 108, 117, 101, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 50, 44, 32, 48, 120, 55, 102, 102, 102, 44, 32, 45, 48, 120, 56, 48, 48, 48, 41, 59, 10, 32, 32, 116, 104, 105, 115, 46, 115, 101, 116, 65, 116, 40, 111, 102, 102, 115, 101, 116, 44, 32, 32, 32, 32, 32, 118, 97, 108, 117, 101, 32, 62, 62, 62, 32, 56, 41, 59, 10, 32, 32, 116, 104, 105, 115, 46, 115, 101, 116, 65, 116, 40, 111, 102, 102, 115, 101, 116, 32, 43, 32, 49, 44, 32, 118, 97, 108, 117, 101, 41, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 111, 102, 102, 115, 101, 116, 32, 43, 32, 50, 59, 10, 125, 59, 10, 10, 10, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 119, 114, 105, 116, 101, 73, 110, 116, 51, 50, 76, 69, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 118, 97, 108, 117, 101, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 110, 111, 65, 115, 115, 101, 114, 116, 41, 32, 123, 10, 32, 32, 118, 97, 108, 117, 101, 32, 61, 32, 43, 118, 97, 108, 117, 101, 59, 10, 32, 32, 111, 102, 102, 115, 101, 116, 32, 61, 32, 111, 102, 102, 115, 101, 116, 32, 62, 62, 62, 32, 48, 59, 10, 32, 32, 105, 102, 32, 40, 33, 110, 111, 65, 115, 115, 101, 114, 116, 41, 10, 32, 32, 32, 32, 99, 104, 101, 99, 107, 73, 110, 116, 40, 116, 104, 105, 115, 44, 32, 118, 97, 108, 117, 101, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 52, 44, 32, 48, 120, 55, 102, 102, 102, 102, 102, 102, 102, 44, 32, 45, 48, 120, 56, 48, 48, 48, 48, 48, 48, 48, 41, 59, 10, 32, 32, 116, 104, 105, 115, 46, 115, 101, 116, 65, 116, 40, 111, 102, 102, 115, 101, 116, 44, 32, 32, 32, 32, 32, 118, 97, 108, 117, 101, 41, 59, 10, 32, 32, 116, 104, 105, 115, 46, 115, 101, 116, 65, 116, 40, 111, 102, 102, 115, 101, 116, 32, 43, 32, 49, 44, 32, 118, 97, 108, 117, 101, 32, 62, 62, 62, 32, 56, 41, 59, 10, 32, 32, 116, 104, 105, 115, 46, 115, 101, 116, 65, 116, 40, 111, 102, 102, 115, 101, 116, 32, 43, 32, 50, 44, 32, 118, 97, 108, 117, 101, 32, 62, 62, 62, 32, 49, 54, 41, 59, 10, 32, 32, 116, 104, 105, 115, 46, 115, 101, 116, 65, 116, 40, 111, 102, 102, 115, 101, 116, 32, 43, 32, 51, 44, 32, 118, 97, 108, 117, 101, 32, 62, 62, 62, 32, 50, 52, 41, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 111, 102, 102, 115, 101, 116, 32, 43, 32, 52, 59, 10, 125, 59, 10, 10, 10, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 119, 114, 105, 116, 101, 73, 110, 116, 51, 50, 66, 69, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 118, 97, 108, 117, 101, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 110, 111, 65, 115, 115, 101, 114, 116, 41, 32, 123, 10, 32, 32, 118, 97, 108, 117, 101, 32, 61, 32, 43, 118, 97, 108, 117, 101, 59, 10, 32, 32, 111, 102, 102, 115, 101, 116, 32, 61, 32, 111, 102, 102, 115, 101, 116, 32, 62, 62, 62, 32, 48, 59, 10, 32, 32, 105, 102, 32, 40, 33, 110, 111, 65, 115, 115, 101, 114, 116, 41, 10, 32, 32, 32, 32, 99, 104, 101, 99, 107, 73, 110, 116, 40, 116, 104, 105, 115, 44, 32, 118, 97, 108, 117, 101, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 52, 44, 32, 48, 120, 55, 102, 102, 102, 102, 102, 102, 102, 44, 32, 45, 48, 120, 56, 48, 48, 48, 48, 48, 48, 48, 41, 59, 10, 32, 32, 116, 104, 105, 115, 46, 115, 101, 116, 65, 116, 40, 111, 102, 102, 115, 101, 116, 44, 32, 32, 32, 32, 32, 118, 97, 108, 117, 101, 32, 62, 62, 62, 32, 50, 52, 41, 59, 10, 32, 32, 116, 104, 105, 115, 46, 115, 101, 116, 65, 116, 40, 111, 102, 102, 115, 101, 116, 32, 43, 32, 49, 44, 32, 118, 97, 108, 117, 101, 32, 62, 62, 62, 32, 49, 54, 41, 59, 10, 32, 32, 116, 104, 105, 115, 46, 115, 101, 116, 65, 116, 40, 111, 102, 102, 115, 101, 116, 32, 43, 32, 50, 44, 32, 118, 97, 108, 117, 101, 32, 62, 62, 62, 32, 56, 41, 59, 10, 32, 32, 116, 104, 105, 115, 46, 115, 101, 116, 65, 116, 40, 111, 102, 102, 115, 101, 116, 32, 43, 32, 51, 44, 32, 118, 97, 108, 117, 101, 41, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 111, 102, 102, 115, 101, 116, 32, 43, 32, 52, 59, 10, 125, 59, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 99, 104, 101, 99, 107, 70, 108, 111, 97, 116, 40, 98, 117, 102, 102, 101, 114, 44, 32, 118, 97, 108, 117, 101, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 101, 120, 116, 41, 32, 123, 10, 32, 32, 105, 102, 32, 40, 33, 40, 98, 117, 102, 102, 101, 114, 32, 105, 110, 115, 116, 97, 110, 99, 101, 111, 102, 32, 66, 117, 102, 102, 101, 114, 41, 41, 10, 32, 32, 32, 32, 116, 104, 114, 111, 119, 32, 110, 101, 119, 32, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 98, 117, 102, 102, 101, 114, 32, 109, 117, 115, 116, 32, 98, 101, 32, 97, 32, 66, 117, 102, 102, 101, 114, 32, 105, 110, 115, 116, 97, 110, 99, 101, 39, 41, 59, 10, 32, 32, 105, 102, 32, 40, 111, 102, 102, 115, 101, 116, 32, 43, 32, 101, 120, 116, 32, 62, 32, 98, 117, 102, 102, 101, 114, 46, 108, 101, 110, 103, 116, 104, 41, 10, 32, 32, 32, 32, 116, 104, 114, 111, 119, 32, 110, 101, 119, 32, 82, 97, 110, 103, 101, 69, 114, 114, 111, 114, 40, 39, 105, 110, 100, 101, 120, 32, 111, 117, 116, 32, 111, 102, 32, 114, 97, 110, 103, 101, 39, 41, 59, 10, 125, 10, 10, 10, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 119, 114, 105, 116, 101, 70, 108, 111, 97, 116, 76, 69, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 32, 119, 114, 105, 116, 101, 70, 108, 111, 97, 116, 76, 69, 40, 118, 97, 108, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 110, 111, 65, 115, 115, 101, 114, 116, 41, 32, 123, 10, 32, 32, 118, 97, 108, 32, 61, 32, 43, 118, 97, 108, 59, 10, 32, 32, 111, 102, 102, 115, 101, 116, 32, 61, 32, 111, 102, 102, 115, 101, 116, 32, 62, 62, 62, 32, 48, 59, 10, 32, 32, 105, 102, 32, 40, 33, 110, 111, 65, 115, 115, 101, 114, 116, 41, 10, 32, 32, 32, 32, 99, 104, 101, 99, 107, 70, 108, 111, 97, 116, 40, 116, 104, 105, 115, 44, 32, 118, 97, 108, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 52, 41, 59, 10, 32, 32, 98, 105, 110, 100, 105, 110, 103, 46, 119, 114, 105, 116, 101, 70, 108, 111, 97, 116, 76, 69, 40, 116, 104, 105, 115, 44, 32, 118, 97, 108, 44, 32, 111, 102, 102, 115, 101, 116, 41, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 111, 102, 102, 115, 101, 116, 32, 43, 32, 52, 59, 10, 125, 59, 10, 10, 10, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 119, 114, 105, 116, 101, 70, 108, 111, 97, 116, 66, 69, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 32, 119, 114, 105, 116, 101, 70, 108, 111, 97, 116, 66, 69, 40, 118, 97, 108, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 110, 111, 65, 115, 115, 101, 114, 116, 41, 32, 123, 10, 32, 32, 118, 97, 108, 32, 61, 32, 43, 118, 97, 108, 59, 10, 32, 32, 111, 102, 102, 115, 101, 116, 32, 61, 32, 111, 102, 102, 115, 101, 116, 32, 62, 62, 62, 32, 48, 59, 10, 32, 32, 105, 102, 32, 40, 33, 110, 111, 65, 115, 115, 101, 114, 116, 41, 10, 32, 32, 32, 32, 99, 104, 101, 99, 107, 70, 108, 111, 97, 116, 40, 116, 104, 105, 115, 44, 32, 118, 97, 108, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 52, 41, 59, 10, 32, 32, 98, 105, 110, 100, 105, 110, 103, 46, 119, 114, 105, 116, 101, 70, 108, 111, 97, 116, 66, 69, 40, 116, 104, 105, 115, 44, 32, 118, 97, 108, 44, 32, 111, 102, 102, 115, 101, 116, 41, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 111, 102, 102, 115, 101, 116, 32, 43, 32, 52, 59, 10, 125, 59, 10, 10, 10, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 119, 114, 105, 116, 101, 68, 111, 117, 98, 108, 101, 76, 69, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 32, 119, 114, 105, 116, 101, 68, 111, 117, 98, 108, 101, 76, 69, 40, 118, 97, 108, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 110, 111, 65, 115, 115, 101, 114, 116, 41, 32, 123, 10, 32, 32, 118, 97, 108, 32, 61, 32, 43, 118, 97, 108, 59, 10, 32, 32, 111, 102, 102, 115, 101, 116, 32, 61, 32, 111, 102, 102, 115, 101, 116, 32, 62, 62, 62, 32, 48, 59, 10, 32, 32, 105, 102, 32, 40, 33, 110, 111, 65, 115, 115, 101, 114, 116, 41, 10, 32, 32, 32, 32, 99, 104, 101, 99, 107, 70, 108, 111, 97, 116, 40, 116, 104, 105, 115, 44, 32, 118, 97, 108, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 56, 41, 59, 10, 32, 32, 98, 105, 110, 100, 105, 110, 103, 46, 119, 114, 105, 116, 101, 68, 111, 117, 98, 108, 101, 76, 69, 40, 116, 104, 105, 115, 44, 32, 118, 97, 108, 44, 32, 111, 102, 102, 115, 101, 116, 41, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 111, 102, 102, 115, 101, 116, 32, 43, 32, 56, 59, 10, 125, 59, 10, 10, 10, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 119, 114, 105, 116, 101, 68, 111, 117, 98, 108, 101, 66, 69, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 32, 119, 114, 105, 116, 101, 68, 111, 117, 98, 108, 101, 66, 69, 40, 118, 97, 108, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 110, 111, 65, 115, 115, 101, 114, 116, 41, 32, 123, 10, 32, 32, 118, 97, 108, 32, 61, 32, 43, 118, 97, 108, 59, 10, 32, 32, 111, 102, 102, 115, 101, 116, 32, 61, 32, 111, 102, 102, 115, 101, 116, 32, 62, 62, 62, 32, 48, 59, 10, 32, 32, 105, 102, 32, 40, 33, 110, 111, 65, 115, 115, 101, 114, 116, 41, 10, 32, 32, 32, 32, 99, 104, 101, 99, 107, 70, 108, 111, 97, 116, 40, 116, 104, 105, 115, 44, 32, 118, 97, 108, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 56, 41, 59, 10, 32, 32, 98, 105, 110, 100, 105, 110, 103, 46, 119, 114, 105, 116, 101, 68, 111, 117, 98, 108, 101, 66, 69, 40, 116, 104, 105, 115, 44, 32, 118, 97, 108, 44, 32, 111, 102, 102, 115, 101, 116, 41, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 111, 102, 102, 115, 101, 116, 32, 43, 32, 56, 59, 10, 125, 59, 10, 0 };
+  const cef_char_t buffer_native[] = { 47, 47, 32, 77, 79, 68, 73, 70, 73, 69, 68, 58, 32, 108, 111, 119, 32, 108, 101, 118, 101, 108, 32, 114, 101, 112, 108, 97, 99, 101, 109, 101, 110, 116, 10, 47, 42, 32, 101, 115, 108, 105, 110, 116, 45, 100, 105, 115, 97, 98, 108, 101, 32, 114, 101, 113, 117, 105, 114, 101, 45, 98, 117, 102, 102, 101, 114, 32, 42, 47, 10, 39, 117, 115, 101, 32, 115, 116, 114, 105, 99, 116, 39, 59, 10, 10, 99, 111, 110, 115, 116, 32, 98, 105, 110, 100, 105, 110, 103, 32, 61, 32, 112, 114, 111, 99, 101, 115, 115, 46, 98, 105, 110, 100, 105, 110, 103, 40, 39, 98, 117, 102, 102, 101, 114, 39, 41, 59, 10, 99, 111, 110, 115, 116, 32, 105, 110, 116, 101, 114, 110, 97, 108, 85, 116, 105, 108, 32, 61, 32, 114, 101, 113, 117, 105, 114, 101, 40, 39, 105, 110, 116, 101, 114, 110, 97, 108, 47, 117, 116, 105, 108, 39, 41, 59, 10, 99, 111, 110, 115, 116, 32, 98, 105, 110, 100, 105, 110, 103, 79, 98, 106, 32, 61, 32, 123, 125, 59, 10, 10, 101, 120, 112, 111, 114, 116, 115, 46, 66, 117, 102, 102, 101, 114, 32, 61, 32, 66, 117, 102, 102, 101, 114, 59, 10, 101, 120, 112, 111, 114, 116, 115, 46, 83, 108, 111, 119, 66, 117, 102, 102, 101, 114, 32, 61, 32, 83, 108, 111, 119, 66, 117, 102, 102, 101, 114, 59, 10, 101, 120, 112, 111, 114, 116, 115, 46, 73, 78, 83, 80, 69, 67, 84, 95, 77, 65, 88, 95, 66, 89, 84, 69, 83, 32, 61, 32, 53, 48, 59, 10, 101, 120, 112, 111, 114, 116, 115, 46, 107, 77, 97, 120, 76, 101, 110, 103, 116, 104, 32, 61, 32, 98, 105, 110, 100, 105, 110, 103, 46, 107, 77, 97, 120, 76, 101, 110, 103, 116, 104, 59, 10, 10, 66, 117, 102, 102, 101, 114, 46, 112, 111, 111, 108, 83, 105, 122, 101, 32, 61, 32, 56, 32, 42, 32, 49, 48, 50, 52, 59, 10, 118, 97, 114, 32, 112, 111, 111, 108, 83, 105, 122, 101, 44, 32, 112, 111, 111, 108, 79, 102, 102, 115, 101, 116, 44, 32, 97, 108, 108, 111, 99, 80, 111, 111, 108, 59, 10, 10, 98, 105, 110, 100, 105, 110, 103, 46, 115, 101, 116, 117, 112, 66, 117, 102, 102, 101, 114, 74, 83, 40, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 44, 32, 98, 105, 110, 100, 105, 110, 103, 79, 98, 106, 41, 59, 10, 99, 111, 110, 115, 116, 32, 102, 108, 97, 103, 115, 32, 61, 32, 98, 105, 110, 100, 105, 110, 103, 79, 98, 106, 46, 102, 108, 97, 103, 115, 59, 10, 99, 111, 110, 115, 116, 32, 107, 78, 111, 90, 101, 114, 111, 70, 105, 108, 108, 32, 61, 32, 48, 59, 10, 10, 47, 47, 32, 78, 67, 74, 83, 58, 32, 85, 105, 110, 116, 56, 65, 114, 114, 97, 121, 45, 62, 66, 117, 102, 102, 101, 114, 87, 114, 97, 112, 10, 47, 47, 32, 66, 101, 99, 97, 117, 115, 101, 32, 67, 69, 70, 32, 100, 111, 101, 115, 32, 110, 111, 116, 32, 112, 114, 111, 118, 105, 100, 101, 115, 32, 65, 114, 114, 97, 121, 66, 117, 102, 102, 101, 114, 32, 97, 110, 100, 32, 88, 88, 88, 65, 114, 114, 97, 121, 44, 10, 47, 47, 32, 119, 101, 32, 105, 109, 112, 108, 101, 109, 101, 110, 116, 32, 97, 32, 66, 117, 102, 102, 101, 114, 87, 114, 97, 112, 32, 116, 111, 32, 109, 97, 110, 97, 103, 101, 114, 32, 109, 101, 109, 111, 114, 121, 32, 98, 105, 110, 100, 105, 110, 103, 32, 116, 111, 32, 97, 32, 66, 117, 102, 102, 101, 114, 46, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 66, 117, 102, 102, 101, 114, 87, 114, 97, 112, 40, 41, 32, 123, 125, 10, 66, 117, 102, 102, 101, 114, 87, 114, 97, 112, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 115, 117, 98, 97, 114, 114, 97, 121, 32, 61, 32, 98, 105, 110, 100, 105, 110, 103, 79, 98, 106, 46, 115, 117, 98, 97, 114, 114, 97, 121, 59, 10, 47, 47, 32, 78, 67, 74, 83, 58, 32, 85, 105, 110, 116, 56, 65, 114, 114, 97, 121, 91, 93, 32, 45, 62, 32, 66, 117, 102, 102, 101, 114, 87, 114, 97, 112, 46, 103, 101, 116, 40, 41, 47, 115, 101, 116, 40, 41, 10, 105, 102, 32, 40, 116, 121, 112, 101, 111, 102, 32, 98, 105, 110, 100, 105, 110, 103, 79, 98, 106, 46, 97, 114, 114, 97, 121, 66, 117, 102, 102, 101, 114, 32, 61, 61, 61, 32, 39, 102, 117, 110, 99, 116, 105, 111, 110, 39, 41, 32, 123, 10, 32, 32, 47, 47, 32, 67, 69, 70, 32, 51, 46, 50, 56, 52, 48, 43, 58, 32, 97, 99, 99, 101, 115, 115, 32, 116, 104, 101, 32, 110, 97, 116, 105, 118, 101, 32, 109, 101, 109, 111, 114, 121, 32, 116, 104, 114, 111, 117, 103, 104, 32, 97, 32, 85, 105, 110, 116, 56, 65, 114, 114, 97, 121, 32, 118, 105, 101, 119, 44, 10, 32, 32, 47, 47, 32, 99, 114, 101, 97, 116, 101, 100, 32, 111, 110, 32, 102, 105, 114, 115, 116, 32, 97, 99, 99, 101, 115, 115, 44, 32, 105, 110, 115, 116, 101, 97, 100, 32, 111, 102, 32, 97, 32, 110, 97, 116, 105, 118, 101, 32, 99, 97, 108, 108, 32, 112, 101, 114, 32, 98, 121, 116, 101, 46, 10, 32, 32, 99, 111, 110, 115, 116, 32, 97, 114, 114, 97, 121, 66, 117, 102, 102, 101, 114, 32, 61, 32, 98, 105, 110, 100, 105, 110, 103, 79, 98, 106, 46, 97, 114, 114, 97, 121, 66, 117, 102, 102, 101, 114, 59, 10, 32, 32, 79, 98, 106, 101, 99, 116, 46, 100, 101, 102, 105, 110, 101, 80, 114, 111, 112, 101, 114, 116, 121, 40, 66, 117, 102, 102, 101, 114, 87, 114, 97, 112, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 44, 32, 39, 95, 118, 105, 101, 119, 39, 44, 32, 123, 10, 32, 32, 32, 32, 103, 101, 116, 58, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 118, 105, 101, 119, 32, 61, 32, 110, 101, 119, 32, 85, 105, 110, 116, 56, 65, 114, 114, 97, 121, 40, 97, 114, 114, 97, 121, 66, 117, 102, 102, 101, 114, 46, 99, 97, 108, 108, 40, 116, 104, 105, 115, 41, 41, 59, 10, 32, 32, 32, 32, 32, 32, 79, 98, 106, 101, 99, 116, 46, 100, 101, 102, 105, 110, 101, 80, 114, 111, 112, 101, 114, 116, 121, 40, 116, 104, 105, 115, 44, 32, 39, 95, 118, 105, 101, 119, 39, 44, 32, 123, 32, 118, 97, 108, 117, 101, 58, 32, 118, 105, 101, 119, 32, 125, 41, 59, 10, 32, 32, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 118, 105, 101, 119, 59, 10, 32, 32, 32, 32, 125, 10, 32, 32, 125, 41, 59, 10, 32, 32, 66, 117, 102, 102, 101, 114, 87, 114, 97, 112, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 103, 101, 116, 65, 116, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 111, 102, 102, 115, 101, 116, 41, 32, 123, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 46, 95, 118, 105, 101, 119, 91, 111, 102, 102, 115, 101, 116, 93, 59, 10, 32, 32, 125, 59, 10, 32, 32, 66, 117, 102, 102, 101, 114, 87, 114, 97, 112, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 115, 101, 116, 65, 116, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 111, 102, 102, 115, 101, 116, 44, 32, 118, 97, 108, 117, 101, 41, 32, 123, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 40, 116, 104, 105, 115, 46, 95, 118, 105, 101, 119, 91, 111, 102, 102, 115, 101, 116, 93, 32, 61, 32, 118, 97, 108, 117, 101, 41, 59, 10, 32, 32, 125, 59, 10, 125, 32, 101, 108, 115, 101, 32, 123, 10, 32, 32, 66, 117, 102, 102, 101, 114, 87, 114, 97, 112, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 103, 101, 116, 65, 116, 32, 61, 32, 98, 105, 110, 100, 105, 110, 103, 79, 98, 106, 46, 103, 101, 116, 65, 116, 59, 10, 32, 32, 66, 117, 102, 102, 101, 114, 87, 114, 97, 112, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 115, 101, 116, 65, 116, 32, 61, 32, 98, 105, 110, 100, 105, 110, 103, 79, 98, 106, 46, 115, 101, 116, 65, 116, 59, 10, 125, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 99, 114, 101, 97, 116, 101, 66, 117, 102, 102, 101, 114, 40, 115, 105, 122, 101, 41, 32, 123, 10, 32, 32, 99, 111, 110, 115, 116, 32, 117, 105, 56, 32, 61, 32, 98, 105, 110, 100, 105, 110, 103, 79, 98, 106, 46, 99, 114, 101, 97, 116, 101, 66, 117, 102, 102, 101, 114, 40, 115, 105, 122, 101, 41, 59, 10, 32, 32, 79, 98, 106, 101, 99, 116, 46, 115, 101, 116, 80, 114, 111, 116, 111, 116, 121, 112, 101, 79, 102, 40, 117, 105, 56, 44, 32, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 41, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 117, 105, 56, 59, 10, 125, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 99, 114, 101, 97, 116, 101, 80, 111, 111, 108, 40, 41, 32, 123, 10, 32, 32, 112, 111, 111, 108, 83, 105, 122, 101, 32, 61, 32, 66, 117, 102, 102, 101, 114, 46, 112, 111, 111, 108, 83, 105, 122, 101, 59, 10, 32, 32, 105, 102, 32, 40, 112, 111, 111, 108, 83, 105, 122, 101, 32, 62, 32, 48, 41, 10, 32, 32, 32, 32, 102, 108, 97, 103, 115, 91, 107, 78, 111, 90, 101, 114, 111, 70, 105, 108, 108, 93, 32, 61, 32, 49, 59, 10, 32, 32, 97, 108, 108, 111, 99, 80, 111, 111, 108, 32, 61, 32, 99, 114, 101, 97, 116, 101, 66, 117, 102, 102, 101, 114, 40, 112, 111, 111, 108, 83, 105, 122, 101, 41, 59, 10, 32, 32, 112, 111, 111, 108, 79, 102, 102, 115, 101, 116, 32, 61, 32, 48, 59, 10, 125, 10, 99, 114, 101, 97, 116, 101, 80, 111, 111, 108, 40, 41, 59, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 97, 108, 105, 103, 110, 80, 111, 111, 108, 40, 41, 32, 123, 10, 32, 32, 47, 47, 32, 69, 110, 115, 117, 114, 101, 32, 97, 108, 105, 103, 110, 101, 100, 32, 115, 108, 105, 99, 101, 115, 10, 32, 32, 105, 102, 32, 40, 112, 111, 111, 108, 79, 102, 102, 115, 101, 116, 32, 38, 32, 48, 120, 55, 41, 32, 123, 10, 32, 32, 32, 32, 112, 111, 111, 108, 79, 102, 102, 115, 101, 116, 32, 124, 61, 32, 48, 120, 55, 59, 10, 32, 32, 32, 32, 112, 111, 111, 108, 79, 102, 102, 115, 101, 116, 43, 43, 59, 10, 32, 32, 125, 10, 125, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 66, 117, 102, 102, 101, 114, 40, 97, 114, 103, 44, 32, 101, 110, 99, 111, 100, 105, 110, 103, 41, 32, 123, 10, 32, 32, 47, 47, 32, 67, 111, 109, 109, 111, 110, 32, 99, 97, 115, 101, 46, 10, 32, 32, 105, 102, 32, 40, 116, 121, 112, 101, 111, 102, 32, 97, 114, 103, 32, 61, 61, 61, 32, 39, 110, 117, 109, 98, 101, 114, 39, 41, 32, 123, 10, 32, 32, 32, 32, 47, 47, 32, 73, 102, 32, 108, 101, 115, 115, 32, 116, 104, 97, 110, 32, 122, 101, 114, 111, 44, 32, 111, 114, 32, 78, 97, 78, 46, 10, 32, 32, 32, 32, 105, 102, 32, 40, 97, 114, 103, 32, 60, 32, 48, 32, 124, 124, 32, 97, 114, 103, 32, 33, 61, 61, 32, 97, 114, 103, 41, 10, 32, 32, 32, 32, 32, 32, 97, 114, 103, 32, 61, 32, 48, 59, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 97, 108, 108, 111, 99, 97, 116, 101, 40, 97, 114, 103, 41, 59, 10, 32, 32, 125, 10, 10, 32, 32, 47, 47, 32, 83, 108, 105, 103, 104, 116, 108, 121, 32, 108, 101, 115, 115, 32, 99, 111, 109, 109, 111, 110, 32, 99, 97, 115, 101, 46, 10, 32, 32, 105, 102, 32, 40, 116, 121, 112, 101, 111, 102, 32, 97, 114, 103, 32, 61, 61, 61, 32, 39, 115, 116, 114, 105, 110, 103, 39, 41, 32, 123, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 102, 114, 111, 109, 83, 116, 114, 105, 110, 103, 40, 97, 114, 103, 44, 32, 101, 110, 99, 111, 100, 105, 110, 103, 41, 59, 10, 32, 32, 125, 10, 10, 32, 32, 47, 47, 32, 85, 110, 117, 115, 117, 97, 108, 46, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 102, 114, 111, 109, 79, 98, 106, 101, 99, 116, 40, 97, 114, 103, 41, 59, 10, 125, 10, 10, 79, 98, 106, 101, 99, 116, 46, 115, 101, 116, 80, 114, 111, 116, 111, 116, 121, 112, 101, 79, 102, 40, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 44, 32, 66, 117, 102, 102, 101, 114, 87, 114, 97, 112, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 41, 59, 10, 79, 98, 106, 101, 99, 116, 46, 115, 101, 116, 80, 114, 111, 116, 111, 116, 121, 112, 101, 79, 102, 40, 66, 117, 102, 102, 101, 114, 44, 32, 66, 117, 102, 102, 101, 114, 87, 114, 97, 112, 41, 59, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 83, 108, 111, 119, 66, 117, 102, 102, 101, 114, 40, 108, 101, 110, 103, 116, 104, 41, 32, 123, 10, 32, 32, 105, 102, 32, 40, 43, 108, 101, 110, 103, 116, 104, 32, 33, 61, 32, 108, 101, 110, 103, 116, 104, 41, 10, 32, 32, 32, 32, 108, 101, 110, 103, 116, 104, 32, 61, 32, 48, 59, 10, 32, 32, 105, 102, 32, 40, 108, 101, 110, 103, 116, 104, 32, 62, 32, 48, 41, 10, 32, 32, 32, 32, 102, 108, 97, 103, 115, 91, 107, 78, 111, 90, 101, 114, 111, 70, 105, 108, 108, 93, 32, 61, 32, 49, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 99, 114, 101, 97, 116, 101, 66, 117, 102, 102, 101, 114, 40, 43, 108, 101, 110, 103, 116, 104, 41, 59, 10, 125, 10, 10, 79, 98, 106, 101, 99, 116, 46, 115, 101, 116, 80, 114, 111, 116, 111, 116, 121, 112, 101, 79, 102, 40, 83, 108, 111, 119, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 44, 32, 66, 117, 102, 102, 101, 114, 87, 114, 97, 112, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 41, 59, 10, 79, 98, 106, 101, 99, 116, 46, 115, 101, 116, 80, 114, 111, 116, 111, 116, 121, 112, 101, 79, 102, 40, 83, 108, 111, 119, 66, 117, 102, 102, 101, 114, 44, 32, 66, 117, 102, 102, 101, 114, 87, 114, 97, 112, 41, 59, 10, 10, 10, 47, 47, 32, 116, 104, 101, 32, 98, 105, 110, 100, 105, 110, 103, 32, 116, 97, 107, 101, 115, 32, 116, 104, 101, 32, 115, 105, 122, 101, 32, 97, 115, 32, 97, 110, 32, 117, 110, 115, 105, 103, 110, 101, 100, 32, 105, 110, 116, 101, 103, 101, 114, 44, 32, 45, 49, 32, 119, 111, 117, 108, 100, 32, 98, 101, 99, 111, 109, 101, 32, 52, 32, 71, 66, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 97, 115, 115, 101, 114, 116, 83, 105, 122, 101, 40, 115, 105, 122, 101, 41, 32, 123, 10, 32, 32, 105, 102, 32, 40, 116, 121, 112, 101, 111, 102, 32, 115, 105, 122, 101, 32, 33, 61, 61, 32, 39, 110, 117, 109, 98, 101, 114, 39, 41, 10, 32, 32, 32, 32, 116, 104, 114, 111, 119, 32, 110, 101, 119, 32, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 34, 115, 105, 122, 101, 34, 32, 97, 114, 103, 117, 109, 101, 110, 116, 32, 109, 117, 115, 116, 32, 98, 101, 32, 97, 32, 110, 117, 109, 98, 101, 114, 39, 41, 59, 10, 32, 32, 105, 102, 32, 40, 115, 105, 122, 101, 32, 60, 32, 48, 32, 124, 124, 32, 115, 105, 122, 101, 32, 33, 61, 61, 32, 115, 105, 122, 101, 41, 10, 32, 32, 32, 32, 116, 104, 114, 111, 119, 32, 110, 101, 119, 32, 82, 97, 110, 103, 101, 69, 114, 114, 111, 114, 40, 39, 34, 115, 105, 122, 101, 34, 32, 97, 114, 103, 117, 109, 101, 110, 116, 32, 109, 117, 115, 116, 32, 110, 111, 116, 32, 98, 101, 32, 110, 101, 103, 97, 116, 105, 118, 101, 39, 41, 59, 10, 32, 32, 105, 102, 32, 40, 115, 105, 122, 101, 32, 62, 32, 98, 105, 110, 100, 105, 110, 103, 46, 107, 77, 97, 120, 76, 101, 110, 103, 116, 104, 41, 10, 32, 32, 32, 32, 116, 104, 114, 111, 119, 32, 110, 101, 119, 32, 82, 97, 110, 103, 101, 69, 114, 114, 111, 114, 40, 39, 34, 115, 105, 122, 101, 34, 32, 97, 114, 103, 117, 109, 101, 110, 116, 32, 109, 117, 115, 116, 32, 110, 111, 116, 32, 98, 101, 32, 108, 97, 114, 103, 101, 114, 32, 116, 104, 97, 110, 32, 39, 32, 43, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 98, 105, 110, 100, 105, 110, 103, 46, 107, 77, 97, 120, 76, 101, 110, 103, 116, 104, 41, 59, 10, 125, 10, 10, 10, 66, 117, 102, 102, 101, 114, 46, 97, 108, 108, 111, 99, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 115, 105, 122, 101, 44, 32, 102, 105, 108, 108, 44, 32, 101, 110, 99, 111, 100, 105, 110, 103, 41, 32, 123, 10, 32, 32, 97, 115, 115, 101, 114, 116, 83, 105, 122, 101, 40, 115, 105, 122, 101, 41, 59, 10, 32, 32, 105, 102, 32, 40, 115, 105, 122, 101, 32, 61, 61, 61, 32, 48, 41, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 99, 114, 101, 97, 116, 101, 66, 117, 102, 102, 101, 114, 40, 115, 105, 122, 101, 41, 59, 10, 32, 32, 105, 102, 32, 40, 33, 102, 105, 108, 108, 32, 124, 124, 32, 102, 105, 108, 108, 46, 108, 101, 110, 103, 116, 104, 32, 61, 61, 61, 32, 48, 41, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 99, 114, 101, 97, 116, 101, 66, 117, 102, 102, 101, 114, 40, 115, 105, 122, 101, 41, 59, 10, 32, 32, 47, 47, 32, 70, 105, 108, 108, 101, 100, 32, 105, 110, 32, 97, 32, 115, 105, 110, 103, 108, 101, 32, 112, 97, 115, 115, 44, 32, 110, 111, 32, 110, 101, 101, 100, 32, 116, 111, 32, 122, 101, 114, 111, 32, 116, 104, 101, 32, 109, 101, 109, 111, 114, 121, 32, 102, 105, 114, 115, 116, 46, 32, 76, 97, 114, 103, 101, 10, 32, 32, 47, 47, 32, 98, 117, 102, 102, 101, 114, 115, 32, 99, 111, 109, 101, 32, 102, 114, 111, 109, 32, 102, 114, 101, 115, 104, 32, 109, 97, 112, 112, 105, 110, 103, 115, 32, 119, 104, 105, 99, 104, 32, 97, 114, 101, 32, 122, 101, 114, 111, 101, 100, 32, 97, 110, 121, 119, 97, 121, 46, 10, 32, 32, 102, 108, 97, 103, 115, 91, 107, 78, 111, 90, 101, 114, 111, 70, 105, 108, 108, 93, 32, 61, 32, 49, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 99, 114, 101, 97, 116, 101, 66, 117, 102, 102, 101, 114, 40, 115, 105, 122, 101, 41, 46, 102, 105, 108, 108, 40, 102, 105, 108, 108, 44, 32, 48, 44, 32, 115, 105, 122, 101, 44, 32, 101, 110, 99, 111, 100, 105, 110, 103, 41, 59, 10, 125, 59, 10, 10, 10, 66, 117, 102, 102, 101, 114, 46, 97, 108, 108, 111, 99, 85, 110, 115, 97, 102, 101, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 115, 105, 122, 101, 41, 32, 123, 10, 32, 32, 97, 115, 115, 101, 114, 116, 83, 105, 122, 101, 40, 115, 105, 122, 101, 41, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 97, 108, 108, 111, 99, 97, 116, 101, 40, 115, 105, 122, 101, 41, 59, 10, 125, 59, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 97, 108, 108, 111, 99, 97, 116, 101, 40, 115, 105, 122, 101, 41, 32, 123, 10, 32, 32, 105, 102, 32, 40, 115, 105, 122, 101, 32, 61, 61, 61, 32, 48, 41, 32, 123, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 99, 114, 101, 97, 116, 101, 66, 117, 102, 102, 101, 114, 40, 115, 105, 122, 101, 41, 59, 10, 32, 32, 125, 10, 32, 32, 105, 102, 32, 40, 115, 105, 122, 101, 32, 60, 32, 40, 66, 117, 102, 102, 101, 114, 46, 112, 111, 111, 108, 83, 105, 122, 101, 32, 62, 62, 62, 32, 49, 41, 41, 32, 123, 10, 32, 32, 32, 32, 105, 102, 32, 40, 115, 105, 122, 101, 32, 62, 32, 40, 112, 111, 111, 108, 83, 105, 122, 101, 32, 45, 32, 112, 111, 111, 108, 79, 102, 102, 115, 101, 116, 41, 41, 10, 32, 32, 32, 32, 32, 32, 99, 114, 101, 97, 116, 101, 80, 111, 111, 108, 40, 41, 59, 10, 32, 32, 32, 32, 118, 97, 114, 32, 98, 32, 61, 32, 97, 108, 108, 111, 99, 80, 111, 111, 108, 46, 115, 108, 105, 99, 101, 40, 112, 111, 111, 108, 79, 102, 102, 115, 101, 116, 44, 32, 112, 111, 111, 108, 79, 102, 102, 115, 101, 116, 32, 43, 32, 115, 105, 122, 101, 41, 59, 10, 32, 32, 32, 32, 112, 111, 111, 108, 79, 102, 102, 115, 101, 116, 32, 43, 61, 32, 115, 105, 122, 101, 59, 10, 32, 32, 32, 32, 97, 108, 105, 103, 110, 80, 111, 111, 108, 40, 41, 59, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 98, 59, 10, 32, 32, 125, 32, 101, 108, 115, 101, 32, 123, 10, 32, 32, 32, 32, 47, 47, 32, 69, 118, 101, 110, 32, 116, 104, 111, 117, 103, 104, 32, 116, 104, 105, 115, 32, 105, 115, 32, 99, 104, 101, 99, 107, 101, 100, 32, 97, 98, 111, 118, 101, 44, 32, 116, 104, 101, 32, 99, 111, 110, 100, 105, 116, 105, 111, 110, 97, 108, 32, 105, 115, 32, 97, 32, 115, 97, 102, 101, 116, 121, 32, 110, 101, 116, 32, 97, 110, 100, 10, 32, 32, 32, 32, 47, 47, 32, 115, 97, 110, 105, 116, 121, 32, 99, 104, 101, 99, 107, 32, 116, 111, 32, 112, 114, 101, 118, 101, 110, 116, 32, 97, 110, 121, 32, 115, 117, 98, 115, 101, 113, 117, 101, 110, 116, 32, 116, 121, 112, 101, 100, 32, 97, 114, 114, 97, 121, 32, 97, 108, 108, 111, 99, 97, 116, 105, 111, 110, 32, 102, 114, 111, 109, 32, 110, 111, 116, 10, 32, 32, 32, 32, 47, 47, 32, 98, 101, 105, 110, 103, 32, 122, 101, 114, 111, 32, 102, 105, 108, 108, 101, 100, 46, 10, 32, 32, 32, 32, 105, 102, 32, 40, 115, 105, 122, 101, 32, 62, 32, 48, 41, 10, 32, 32, 32, 32, 32, 32, 102, 108, 97, 103, 115, 91, 107, 78, 111, 90, 101, 114, 111, 70, 105, 108, 108, 93, 32, 61, 32, 49, 59, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 99, 114, 101, 97, 116, 101, 66, 117, 102, 102, 101, 114, 40, 115, 105, 122, 101, 41, 59, 10, 32, 32, 125, 10, 125, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 102, 114, 111, 109, 83, 116, 114, 105, 110, 103, 40, 115, 116, 114, 105, 110, 103, 44, 32, 101, 110, 99, 111, 100, 105, 110, 103, 41, 32, 123, 10, 32, 32, 105, 102, 32, 40, 116, 121, 112, 101, 111, 102, 32, 101, 110, 99, 111, 100, 105, 110, 103, 32, 33, 61, 61, 32, 39, 115, 116, 114, 105, 110, 103, 39, 32, 124, 124, 32, 101, 110, 99, 111, 100, 105, 110, 103, 32, 61, 61, 61, 32, 39, 39, 41, 10, 32, 32, 32, 32, 101, 110, 99, 111, 100, 105, 110, 103, 32, 61, 32, 39, 117, 116, 102, 56, 39, 59, 10, 10, 32, 32, 118, 97, 114, 32, 108, 101, 110, 103, 116, 104, 32, 61, 32, 98, 121, 116, 101, 76, 101, 110, 103, 116, 104, 40, 115, 116, 114, 105, 110, 103, 44, 32, 101, 110, 99, 111, 100, 105, 110, 103, 41, 59, 10, 32, 32, 105, 102, 32, 40, 108, 101, 110, 103, 116, 104, 32, 62, 61, 32, 40, 66, 117, 102, 102, 101, 114, 46, 112, 111, 111, 108, 83, 105, 122, 101, 32, 62, 62, 62, 32, 49, 41, 41, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 98, 105, 110, 100, 105, 110, 103, 46, 99, 114, 101, 97, 116, 101, 70, 114, 111, 109, 83, 116, 114, 105, 110, 103, 40, 115, 116, 114, 105, 110, 103, 44, 32, 101, 110, 99, 111, 100, 105, 110, 103, 41, 59, 10, 10, 32, 32, 105, 102, 32, 40, 108, 101, 110, 103, 116, 104, 32, 62, 32, 40, 112, 111, 111, 108, 83, 105, 122, 101, 32, 45, 32, 112, 111, 111, 108, 79, 102, 102, 115, 101, 116, 41, 41, 10, 32, 32, 32, 32, 99, 114, 101, 97, 116, 101, 80, 111, 111, 108, 40, 41, 59, 10, 32, 32, 118, 97, 114, 32, 97, 99, 116, 117, 97, 108, 32, 61, 32, 97, 108, 108, 111, 99, 80, 111, 111, 108, 46, 119, 114, 105, 116, 101, 40, 115, 116, 114, 105, 110, 103, 44, 32, 112, 111, 111, 108, 79, 102, 102, 115, 101, 116, 44, 32, 101, 110, 99, 111, 100, 105, 110, 103, 41, 59, 10, 32, 32, 118, 97, 114, 32, 98, 32, 61, 32, 97, 108, 108, 111, 99, 80, 111, 111, 108, 46, 115, 108, 105, 99, 101, 40, 112, 111, 111, 108, 79, 102, 102, 115, 101, 116, 44, 32, 112, 111, 111, 108, 79, 102, 102, 115, 101, 116, 32, 43, 32, 97, 99, 116, 117, 97, 108, 41, 59, 10, 32, 32, 112, 111, 111, 108, 79, 102, 102, 115, 101, 116, 32, 43, 61, 32, 97, 99, 116, 117, 97, 108, 59, 10, 32, 32, 97, 108, 105, 103, 110, 80, 111, 111, 108, 40, 41, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 98, 59, 10, 125, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 102, 114, 111, 109, 79, 98, 106, 101, 99, 116, 40, 111, 98, 106, 41, 32, 123, 10, 32, 32, 105, 102, 32, 40, 111, 98, 106, 32, 105, 110, 115, 116, 97, 110, 99, 101, 111, 102, 32, 66, 117, 102, 102, 101, 114, 41, 32, 123, 10, 32, 32, 32, 32, 118, 97, 114, 32, 98, 32, 61, 32, 97, 108, 108, 111, 99, 97, 116, 101, 40, 111, 98, 106, 46, 108, 101, 110, 103, 116, 104, 41, 59, 10, 10, 32, 32, 32, 32, 105, 102, 32, 40, 98, 46, 108, 101, 110, 103, 116, 104, 32, 61, 61, 61, 32, 48, 41, 10, 32, 32, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 98, 59, 10, 10, 32, 32, 32, 32, 111, 98, 106, 46, 99, 111, 112, 121, 40, 98, 44, 32, 48, 44, 32, 48, 44, 32, 111, 98, 106, 46, 108, 101, 110, 103, 116, 104, 41, 59, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 98, 59, 10, 32, 32, 125, 10, 10, 32, 32, 105, 102, 32, 40, 65, 114, 114, 97, 121, 46, 105, 115, 65, 114, 114, 97, 121, 40, 111, 98, 106, 41, 41, 32, 123, 10, 32, 32, 32, 32, 118, 97, 114, 32, 108, 101, 110, 103, 116, 104, 32, 61, 32, 111, 98, 106, 46, 108, 101, 110, 103, 116, 104, 59, 10, 32, 32, 32, 32, 118, 97, 114, 32, 98, 32, 61, 32, 97, 108, 108, 111, 99, 97, 116, 101, 40, 108, 101, 110, 103, 116, 104, 41, 59, 10, 32, 32, 32, 32, 102, 111, 114, 32, 40, 118, 97, 114, 32, 105, 32, 61, 32, 48, 59, 32, 105, 32, 60, 32, 108, 101, 110, 103, 116, 104, 59, 32, 105, 43, 43, 41, 10, 32, 32, 32, 32, 32, 32, 98, 46, 115, 101, 116, 65, 116, 40, 105, 44, 32, 111, 98, 106, 91, 105, 93, 32, 38, 32, 50, 53, 53, 41, 59, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 98, 59, 10, 32, 32, 125, 10, 10, 32, 32, 105, 102, 32, 40, 111, 98, 106, 32, 61, 61, 32, 110, 117, 108, 108, 41, 32, 123, 10, 32, 32, 32, 32, 116, 104, 114, 111, 119, 32, 110, 101, 119, 32, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 109, 117, 115, 116, 32, 115, 116, 97, 114, 116, 32, 119, 105, 116, 104, 32, 110, 117, 109, 98, 101, 114, 44, 32, 98, 117, 102, 102, 101, 114, 44, 32, 97, 114, 114, 97, 121, 32, 111, 114, 32, 115, 116, 114, 105, 110, 103, 39, 41, 59, 10, 32, 32, 125, 10, 10, 32, 32, 105, 102, 32, 40, 111, 98, 106, 32, 105, 110, 115, 116, 97, 110, 99, 101, 111, 102, 32, 65, 114, 114, 97, 121, 66, 117, 102, 102, 101, 114, 41, 32, 123, 10, 32, 32, 32, 32, 47, 47, 32, 78, 67, 74, 83, 58, 32, 67, 69, 70, 32, 100, 111, 101, 115, 32, 110, 111, 116, 32, 115, 117, 112, 112, 111, 114, 116, 32, 65, 114, 114, 97, 121, 66, 117, 102, 102, 101, 114, 44, 32, 99, 111, 110, 118, 101, 114, 116, 32, 111, 98, 106, 32, 116, 111, 32, 85, 105, 110, 116, 56, 65, 114, 114, 97, 121, 10, 32, 32, 32, 32, 111, 98, 106, 32, 61, 32, 110, 101, 119, 32, 85, 105, 110, 116, 56, 65, 114, 114, 97, 121, 40, 111, 98, 106, 41, 59, 10, 32, 32, 125, 10, 10, 32, 32, 105, 102, 32, 40, 111, 98, 106, 46, 98, 117, 102, 102, 101, 114, 32, 105, 110, 115, 116, 97, 110, 99, 101, 111, 102, 32, 65, 114, 114, 97, 121, 66, 117, 102, 102, 101, 114, 32, 124, 124, 32, 111, 98, 106, 46, 108, 101, 110, 103, 116, 104, 41, 32, 123, 10, 32, 32, 32, 32, 118, 97, 114, 32, 108, 101, 110, 103, 116, 104, 59, 10, 32, 32, 32, 32, 105, 102, 32, 40, 116, 121, 112, 101, 111, 102, 32, 111, 98, 106, 46, 108, 101, 110, 103, 116, 104, 32, 33, 61, 61, 32, 39, 110, 117, 109, 98, 101, 114, 39, 32, 124, 124, 32, 111, 98, 106, 46, 108, 101, 110, 103, 116, 104, 32, 33, 61, 61, 32, 111, 98, 106, 46, 108, 101, 110, 103, 116, 104, 41, 10, 32, 32, 32, 32, 32, 32, 108, 101, 110, 103, 116, 104, 32, 61, 32, 48, 59, 10, 32, 32, 32, 32, 101, 108, 115, 101, 10, 32, 32, 32, 32, 32, 32, 108, 101, 110, 103, 116, 104, 32, 61, 32, 111, 98, 106, 46, 108, 101, 110, 103, 116, 104, 59, 10, 32, 32, 32, 32, 118, 97, 114, 32, 98, 32, 61, 32, 97, 108, 108, 111, 99, 97, 116, 101, 40, 108, 101, 110, 103, 116, 104, 41, 59, 10, 32, 32, 32, 32, 102, 111, 114, 32, 40, 118, 97, 114, 32, 105, 32, 61, 32, 48, 59, 32, 105, 32, 60, 32, 108, 101, 110, 103, 116, 104, 59, 32, 105, 43, 43, 41, 10, 32, 32, 32, 32, 32, 32, 98, 46, 115, 101, 116, 65, 116, 40, 105, 44, 32, 111, 98, 106, 91, 105, 93, 32, 38, 32, 50, 53, 53, 41, 59, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 98, 59, 10, 32, 32, 125, 10, 10, 32, 32, 105, 102, 32, 40, 111, 98, 106, 46, 116, 121, 112, 101, 32, 61, 61, 61, 32, 39, 66, 117, 102, 102, 101, 114, 39, 32, 38, 38, 32, 65, 114, 114, 97, 121, 46, 105, 115, 65, 114, 114, 97, 121, 40, 111, 98, 106, 46, 100, 97, 116, 97, 41, 41, 32, 123, 10, 32, 32, 32, 32, 118, 97, 114, 32, 97, 114, 114, 97, 121, 32, 61, 32, 111, 98, 106, 46, 100, 97, 116, 97, 59, 10, 32, 32, 32, 32, 118, 97, 114, 32, 98, 32, 61, 32, 97, 108, 108, 111, 99, 97, 116, 101, 40, 97, 114, 114, 97, 121, 46, 108, 101, 110, 103, 116, 104, 41, 59, 10, 32, 32, 32, 32, 102, 111, 114, 32, 40, 118, 97, 114, 32, 105, 32, 61, 32, 48, 59, 32, 105, 32, 60, 32, 97, 114, 114, 97, 121, 46, 108, 101, 110, 103, 116, 104, 59, 32, 105, 43, 43, 41, 10, 32, 32, 32, 32, 32, 32, 98, 46, 115, 101, 116, 65, 116, 40, 105, 44, 32, 97, 114, 114, 97, 121, 91, 105, 93, 32, 38, 32, 50, 53, 53, 41, 59, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 98, 59, 10, 32, 32, 125, 10, 10, 32, 32, 116, 104, 114, 111, 119, 32, 110, 101, 119, 32, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 109, 117, 115, 116, 32, 115, 116, 97, 114, 116, 32, 119, 105, 116, 104, 32, 110, 117, 109, 98, 101, 114, 44, 32, 98, 117, 102, 102, 101, 114, 44, 32, 97, 114, 114, 97, 121, 32, 111, 114, 32, 115, 116, 114, 105, 110, 103, 39, 41, 59, 10, 125, 10, 10, 10, 47, 47, 32, 83, 116, 97, 116, 105, 99, 32, 109, 101, 116, 104, 111, 100, 115, 10, 10, 66, 117, 102, 102, 101, 114, 46, 105, 115, 66, 117, 102, 102, 101, 114, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 32, 105, 115, 66, 117, 102, 102, 101, 114, 40, 98, 41, 32, 123, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 98, 32, 105, 110, 115, 116, 97, 110, 99, 101, 111, 102, 32, 66, 117, 102, 102, 101, 114, 59, 10, 125, 59, 10, 10, 10, 66, 117, 102, 102, 101, 114, 46, 99, 111, 109, 112, 97, 114, 101, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 32, 99, 111, 109, 112, 97, 114, 101, 40, 97, 44, 32, 98, 41, 32, 123, 10, 32, 32, 105, 102, 32, 40, 33, 40, 97, 32, 105, 110, 115, 116, 97, 110, 99, 101, 111, 102, 32, 66, 117, 102, 102, 101, 114, 41, 32, 124, 124, 10, 32, 32, 32, 32, 32, 32, 33, 40, 98, 32, 105, 110, 115, 116, 97, 110, 99, 101, 111, 102, 32, 66, 117, 102, 102, 101, 114, 41, 41, 32, 123, 10, 32, 32, 32, 32, 116, 104, 114, 111, 119, 32, 110, 101, 119, 32, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 65, 114, 103, 117, 109, 101, 110, 116, 115, 32, 109, 117, 115, 116, 32, 98, 101, 32, 66, 117, 102, 102, 101, 114, 115, 39, 41, 59, 10, 32, 32, 125, 10, 10, 32, 32, 105, 102, 32, 40, 97, 32, 61, 61, 61, 32, 98, 41, 32, 123, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 48, 59, 10, 32, 32, 125, 10, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 98, 105, 110, 100, 105, 110, 103, 46, 99, 111, 109, 112, 97, 114, 101, 40, 97, 44, 32, 98, 41, 59, 10, 125, 59, 10, 10, 10, 66, 117, 102, 102, 101, 114, 46, 105, 115, 69, 110, 99, 111, 100, 105, 110, 103, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 101, 110, 99, 111, 100, 105, 110, 103, 41, 32, 123, 10, 32, 32, 118, 97, 114, 32, 108, 111, 119, 101, 114, 101, 100, 67, 97, 115, 101, 32, 61, 32, 102, 97, 108, 115, 101, 59, 10, 32, 32, 102, 111, 114, 32, 40, 59, 59, 41, 32, 123, 10, 32, 32, 32, 32, 115, 119, 105, 116, 99, 104, 32, 40, 101, 110, 99, 111, 100, 105, 110, 103, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 104, 101, 120, 39, 58, 10, 32, 32, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 117, 116, 102, 56, 39, 58, 10, 32, 32, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 117, 116, 102, 45, 56, 39, 58, 10, 32, 32, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 97, 115, 99, 105, 105, 39, 58, 10, 32, 32, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 98, 105, 110, 97, 114, 121, 39, 58, 10, 32, 32, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 98, 97, 115, 101, 54, 52, 39, 58, 10, 32, 32, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 117, 99, 115, 50, 39, 58, 10, 32, 32, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 117, 99, 115, 45, 50, 39, 58, 10, 32, 32, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 117, 116, 102, 49, 54, 108, 101, 39, 58, 10, 32, 32, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 117, 116, 102, 45, 49, 54, 108, 101, 39, 58, 10, 32, 32, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 114, 97, 119, 39, 58, 10, 32, 32, 32, 32, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 116, 114, 117, 101, 59, 10, 10, 32, 32, 32, 32, 32, 32, 100, 101, 102, 97, 117, 108, 116, 58, 10, 32, 32, 32, 32, 32, 32, 32, 32, 105, 102, 32, 40, 108, 111, 119, 101, 114, 101, 100, 67, 97, 115, 101, 41, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 102, 97, 108, 115, 101, 59, 10, 32, 32, 32, 32, 32, 32, 32, 32, 101, 110, 99, 111, 100, 105, 110, 103, 32, 61, 32, 40, 39, 39, 32, 43, 32, 101, 110, 99, 111, 100, 105, 110, 103, 41, 46, 116, 111, 76, 111, 119, 101, 114, 67, 97, 115, 101, 40, 41, 59, 10, 32, 32, 32, 32, 32, 32, 32, 32, 108, 111, 119, 101, 114, 101, 100, 67, 97, 115, 101, 32, 61, 32, 116, 114, 117, 101, 59, 10, 32, 32, 32, 32, 125, 10, 32, 32, 125, 10, 125, 59, 10, 10, 10, 66, 117, 102, 102, 101, 114, 46, 99, 111, 110, 99, 97, 116, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 108, 105, 115, 116, 44, 32, 108, 101, 110, 103, 116, 104, 41, 32, 123, 10, 32, 32, 105, 102, 32, 40, 33, 65, 114, 114, 97, 121, 46, 105, 115, 65, 114, 114, 97, 121, 40, 108, 105, 115, 116, 41, 41, 10, 32, 32, 32, 32, 116, 104, 114, 111, 119, 32, 110, 101, 119, 32, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 108, 105, 115, 116, 32, 97, 114, 103, 117, 109, 101, 110, 116, 32, 109, 117, 115, 116, 32, 98, 101, 32, 97, 110, 32, 65, 114, 114, 97, 121, 32, 111, 102, 32, 66, 117, 102, 102, 101, 114, 115, 46, 39, 41, 59, 10, 10, 32, 32, 105, 102, 32, 40, 108, 105, 115, 116, 46, 108, 101, 110, 103, 116, 104, 32, 61, 61, 61, 32, 48, 41, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 110, 101, 119, 32, 66, 117, 102, 102, 101, 114, 40, 48, 41, 59, 10, 10, 32, 32, 105, 102, 32, 40, 108, 101, 110, 103, 116, 104, 32, 61, 61, 61, 32, 117, 110, 100, 101, 102, 105, 110, 101, 100, 41, 32, 123, 10, 32, 32, 32, 32, 108, 101, 110, 103, 116, 104, 32, 61, 32, 48, 59, 10, 32, 32, 32, 32, 102, 111, 114, 32, 40, 118, 97, 114, 32, 105, 32, 61, 32, 48, 59, 32, 105, 32, 60, 32, 108, 105, 115, 116, 46, 108, 101, 110, 103, 116, 104, 59, 32, 105, 43, 43, 41, 10, 32, 32, 32, 32, 32, 32, 108, 101, 110, 103, 116, 104, 32, 43, 61, 32, 108, 105, 115, 116, 91, 105, 93, 46, 108, 101, 110, 103, 116, 104, 59, 10, 32, 32, 125, 32, 101, 108, 115, 101, 32, 123, 10, 32, 32, 32, 32, 108, 101, 110, 103, 116, 104, 32, 61, 32, 108, 101, 110, 103, 116, 104, 32, 62, 62, 62, 32, 48, 59, 10, 32, 32, 125, 10, 10, 32, 32, 118, 97, 114, 32, 98, 117, 102, 102, 101, 114, 32, 61, 32, 110, 101, 119, 32, 66, 117, 102, 102, 101, 114, 40, 108, 101, 110, 103, 116, 104, 41, 59, 10, 32, 32, 118, 97, 114, 32, 112, 111, 115, 32, 61, 32, 48, 59, 10, 32, 32, 102, 111, 114, 32, 40, 118, 97, 114, 32, 105, 32, 61, 32, 48, 59, 32, 105, 32, 60, 32, 108, 105, 115, 116, 46, 108, 101, 110, 103, 116, 104, 59, 32, 105, 43, 43, 41, 32, 123, 10, 32, 32, 32, 32, 118, 97, 114, 32, 98, 117, 102, 32, 61, 32, 108, 105, 115, 116, 91, 105, 93, 59, 10, 32, 32, 32, 32, 98, 117, 102, 46, 99, 111, 112, 121, 40, 98, 117, 102, 102, 101, 114, 44, 32, 112, 111, 115, 41, 59, 10, 32, 32, 32, 32, 112, 111, 115, 32, 43, 61, 32, 98, 117, 102, 46, 108, 101, 110, 103, 116, 104, 59, 10, 32, 32, 125, 10, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 98, 117, 102, 102, 101, 114, 59, 10, 125, 59, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 98, 97, 115, 101, 54, 52, 66, 121, 116, 101, 76, 101, 110, 103, 116, 104, 40, 115, 116, 114, 44, 32, 98, 121, 116, 101, 115, 41, 32, 123, 10, 32, 32, 47, 47, 32, 72, 97, 110, 100, 108, 101, 32, 112, 97, 100, 100, 105, 110, 103, 10, 32, 32, 105, 102, 32, 40, 115, 116, 114, 46, 99, 104, 97, 114, 67, 111, 100, 101, 65, 116, 40, 98, 121, 116, 101, 115, 32, 45, 32, 49, 41, 32, 61, 61, 61, 32, 48, 120, 51, 68, 41, 10, 32, 32, 32, 32, 98, 121, 116, 101, 115, 45, 45, 59, 10, 32, 32, 105, 102, 32, 40, 98, 121, 116, 101, 115, 32, 62, 32, 49, 32, 38, 38, 32, 115, 116, 114, 46, 99, 104, 97, 114, 67, 111, 100, 101, 65, 116, 40, 98, 121, 116, 101, 115, 32, 45, 32, 49, 41, 32, 61, 61, 61, 32, 48, 120, 51, 68, 41, 10, 32, 32, 32, 32, 98, 121, 116, 101, 115, 45, 45, 59, 10, 10, 32, 32, 47, 47, 32, 66, 97, 115, 101, 54, 52, 32, 114, 97, 116, 105, 111, 58, 32, 51, 47, 52, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 40, 98, 121, 116, 101, 115, 32, 42, 32, 51, 41, 32, 62, 62, 62, 32, 50, 59, 10, 125, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 98, 121, 116, 101, 76, 101, 110, 103, 116, 104, 40, 115, 116, 114, 105, 110, 103, 44, 32, 101, 110, 99, 111, 100, 105, 110, 103, 41, 32, 123, 10, 32, 32, 105, 102, 32, 40, 115, 116, 114, 105, 110, 103, 32, 105, 110, 115, 116, 97, 110, 99, 101, 111, 102, 32, 66, 117, 102, 102, 101, 114, 41, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 115, 116, 114, 105, 110, 103, 46, 108, 101, 110, 103, 116, 104, 59, 10, 10, 32, 32, 105, 102, 32, 40, 116, 121, 112, 101, 111, 102, 32, 115, 116, 114, 105, 110, 103, 32, 33, 61, 61, 32, 39, 115, 116, 114, 105, 110, 103, 39, 41, 10, 32, 32, 32, 32, 115, 116, 114, 105, 110, 103, 32, 61, 32, 39, 39, 32, 43, 32, 115, 116, 114, 105, 110, 103, 59, 10, 10, 32, 32, 118, 97, 114, 32, 108, 101, 110, 32, 61, 32, 115, 116, 114, 105, 110, 103, 46, 108, 101, 110, 103, 116, 104, 59, 10, 32, 32, 105, 102, 32, 40, 108, 101, 110, 32, 61, 61, 61, 32, 48, 41, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 48, 59, 10, 10, 32, 32, 47, 47, 32, 85, 115, 101, 32, 97, 32, 102, 111, 114, 32, 108, 111, 111, 112, 32, 116, 111, 32, 97, 118, 111, 105, 100, 32, 114, 101, 99, 117, 114, 115, 105, 111, 110, 10, 32, 32, 118, 97, 114, 32, 108, 111, 119, 101, 114, 101, 100, 67, 97, 115, 101, 32, 61, 32, 102, 97, 108, 115, 101, 59, 10, 32, 32, 102, 111, 114, 32, 40, 59, 59, 41, 32, 123, 10, 32, 32, 32, 32, 115, 119, 105, 116, 99, 104, 32, 40, 101, 110, 99, 111, 100, 105, 110, 103, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 97, 115, 99, 105, 105, 39, 58, 10, 32, 32, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 98, 105, 110, 97, 114, 121, 39, 58, 10, 32, 32, 32, 32, 32, 32, 47, 47, 32, 68, 101, 112, 114, 101, 99, 97, 116, 101, 100, 10, 32, 32, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 114, 97, 119, 39, 58, 10, 32, 32, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 114, 97, 119, 115, 39, 58, 10, 32, 32, 32, 32, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 108, 101, 110, 59, 10, 10, 32, 32, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 117, 116, 102, 56, 39, 58, 10, 32, 32, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 117, 116, 102, 45, 56, 39, 58, 10, 32, 32, 32, 32, 32, 32, 99, 97, 115, 101, 32, 117, 110, 100, 101, 102, 105, 110, 101, 100, 58, 10, 32, 32, 32, 32, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 98, 105, 110, 100, 105, 110, 103, 46, 98, 121, 116, 101, 76, 101, 110, 103, 116, 104, 85, 116, 102, 56, 40, 115, 116, 114, 105, 110, 103, 41, 59, 10, 10, 32, 32, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 117, 99, 115, 50, 39, 58, 10, 32, 32, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 117, 99, 115, 45, 50, 39, 58, 10, 32, 32, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 117, 116, 102, 49, 54, 108, 101, 39, 58, 10, 32, 32, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 117, 116, 102, 45, 49, 54, 108, 101, 39, 58, 10, 32, 32, 32, 32, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 108, 101, 110, 32, 42, 32, 50, 59, 10, 10, 32, 32, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 104, 101, 120, 39, 58, 10, 32, 32, 32, 32, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 108, 101, 110, 32, 62, 62, 62, 32, 49, 59, 10, 10, 32, 32, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 98, 97, 115, 101, 54, 52, 39, 58, 10, 32, 32, 32, 32, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 98, 97, 115, 101, 54, 52, 66, 121, 116, 101, 76, 101, 110, 103, 116, 104, 40, 115, 116, 114, 105, 110, 103, 44, 32, 108, 101, 110, 41, 59, 10, 10, 32, 32, 32, 32, 32, 32, 100, 101, 102, 97, 117, 108, 116, 58, 10, 32, 32, 32, 32, 32, 32, 32, 32, 47, 47, 32, 84, 104, 101, 32, 67, 43, 43, 32, 98, 105, 110, 100, 105, 110, 103, 32, 100, 101, 102, 97, 117, 108, 116, 101, 100, 32, 116, 111, 32, 85, 84, 70, 56, 44, 32, 119, 101, 32, 115, 104, 111, 117, 108, 100, 32, 116, 111, 111, 46, 10, 32, 32, 32, 32, 32, 32, 32, 32, 105, 102, 32, 40, 108, 111, 119, 101, 114, 101, 100, 67, 97, 115, 101, 41, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 98, 105, 110, 100, 105, 110, 103, 46, 98, 121, 116, 101, 76, 101, 110, 103, 116, 104, 85, 116, 102, 56, 40, 115, 116, 114, 105, 110, 103, 41, 59, 10, 10, 32, 32, 32, 32, 32, 32, 32, 32, 101, 110, 99, 111, 100, 105, 110, 103, 32, 61, 32, 40, 39, 39, 32, 43, 32, 101, 110, 99, 111, 100, 105, 110, 103, 41, 46, 116, 111, 76, 111, 119, 101, 114, 67, 97, 115, 101, 40, 41, 59, 10, 32, 32, 32, 32, 32, 32, 32, 32, 108, 111, 119, 101, 114, 101, 100, 67, 97, 115, 101, 32, 61, 32, 116, 114, 117, 101, 59, 10, 32, 32, 32, 32, 125, 10, 32, 32, 125, 10, 125, 10, 10, 66, 117, 102, 102, 101, 114, 46, 98, 121, 116, 101, 76, 101, 110, 103, 116, 104, 32, 61, 32, 98, 121, 116, 101, 76, 101, 110, 103, 116, 104, 59, 10, 10, 10, 47, 47, 32, 70, 111, 114, 32, 98, 97, 99, 107, 119, 97, 114, 100, 115, 32, 99, 111, 109, 112, 97, 116, 105, 98, 105, 108, 105, 116, 121, 46, 10, 79, 98, 106, 101, 99, 116, 46, 100, 101, 102, 105, 110, 101, 80, 114, 111, 112, 101, 114, 116, 121, 40, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 44, 32, 39, 112, 97, 114, 101, 110, 116, 39, 44, 32, 123, 10, 32, 32, 101, 110, 117, 109, 101, 114, 97, 98, 108, 101, 58, 32, 116, 114, 117, 101, 44, 10, 32, 32, 103, 101, 116, 58, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 32, 123, 10, 32, 32, 32, 32, 105, 102, 32, 40, 33, 40, 116, 104, 105, 115, 32, 105, 110, 115, 116, 97, 110, 99, 101, 111, 102, 32, 66, 117, 102, 102, 101, 114, 41, 41, 10, 32, 32, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 117, 110, 100, 101, 102, 105, 110, 101, 100, 59, 10, 32, 32, 32, 32, 105, 102, 32, 40, 116, 104, 105, 115, 46, 98, 121, 116, 101, 76, 101, 110, 103, 116, 104, 32, 61, 61, 61, 32, 48, 32, 124, 124, 10, 32, 32, 32, 32, 32, 32, 32, 32, 116, 104, 105, 115, 46, 98, 121, 116, 101, 76, 101, 110, 103, 116, 104, 32, 61, 61, 61, 32, 116, 104, 105, 115, 46, 98, 117, 102, 102, 101, 114, 46, 98, 121, 116, 101, 76, 101, 110, 103, 116, 104, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 117, 110, 100, 101, 102, 105, 110, 101, 100, 59, 10, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 46, 98, 117, 102, 102, 101, 114, 59, 10, 32, 32, 125, 10, 125, 41, 59, 10, 79, 98, 106, 101, 99, 116, 46, 100, 101, 102, 105, 110, 101, 80, 114, 111, 112, 101, 114, 116, 121, 40, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 44, 32, 39, 111, 102, 102, 115, 101, 116, 39, 44, 32, 123, 10, 32, 32, 101, 110, 117, 109, 101, 114, 97, 98, 108, 101, 58, 32, 116, 114, 117, 101, 44, 10, 32, 32, 103, 101, 116, 58, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 32, 123, 10, 32, 32, 32, 32, 105, 102, 32, 40, 33, 40, 116, 104, 105, 115, 32, 105, 110, 115, 116, 97, 110, 99, 101, 111, 102, 32, 66, 117, 102, 102, 101, 114, 41, 41, 10, 32, 32, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 117, 110, 100, 101, 102, 105, 110, 101, 100, 59, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 46, 98, 121, 116, 101, 79, 102, 102, 115, 101, 116, 59, 10, 32, 32, 125, 10, 125, 41, 59, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 115, 108, 111, 119, 84, 111, 83, 116, 114, 105, 110, 103, 40, 101, 110, 99, 111, 100, 105, 110, 103, 44, 32, 115, 116, 97, 114, 116, 44, 32, 101, 110, 100, 41, 32, 123, 10, 32, 32, 118, 97, 114, 32, 108, 111, 119, 101, 114, 101, 100, 67, 97, 115, 101, 32, 61, 32, 102, 97, 108, 115, 101, 59, 10, 10, 32, 32, 115, 116, 97, 114, 116, 32, 61, 32, 115, 116, 97, 114, 116, 32, 62, 62, 62, 32, 48, 59, 10, 32, 32, 101, 110, 100, 32, 61, 32, 101, 110, 100, 32, 61, 61, 61, 32, 117, 110, 100, 101, 102, 105, 110, 101, 100, 32, 124, 124, 32, 101, 110, 100, 32, 61, 61, 61, 32, 73, 110, 102, 105, 110, 105, 116, 121, 32, 63, 32, 116, 104, 105, 115, 46, 108, 101, 110, 103, 116, 104, 32, 58, 32, 101, 110, 100, 32, 62, 62, 62, 32, 48, 59, 10, 10, 32, 32, 105, 102, 32, 40, 33, 101, 110, 99, 111, 100, 105, 110, 103, 41, 32, 101, 110, 99, 111, 100, 105, 110, 103, 32, 61, 32, 39, 117, 116, 102, 56, 39, 59, 10, 32, 32, 105, 102, 32, 40, 115, 116, 97, 114, 116, 32, 60, 32, 48, 41, 32, 115, 116, 97, 114, 116, 32, 61, 32, 48, 59, 10, 32, 32, 105, 102, 32, 40, 101, 110, 100, 32, 62, 32, 116, 104, 105, 115, 46, 108, 101, 110, 103, 116, 104, 41, 32, 101, 110, 100, 32, 61, 32, 116, 104, 105, 115, 46, 108, 101, 110, 103, 116, 104, 59, 10, 32, 32, 105, 102, 32, 40, 101, 110, 100, 32, 60, 61, 32, 115, 116, 97, 114, 116, 41, 32, 114, 101, 116, 117, 114, 110, 32, 39, 39, 59, 10, 10, 32, 32, 119, 104, 105, 108, 101, 32, 40, 116, 114, 117, 101, 41, 32, 123, 10, 32, 32, 32, 32, 115, 119, 105, 116, 99, 104, 32, 40, 101, 110, 99, 111, 100, 105, 110, 103, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 104, 101, 120, 39, 58, 10, 32, 32, 32, 32, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 46, 104, 101, 120, 83, 108, 105, 99, 101, 40, 115, 116, 97, 114, 116, 44, 32, 101, 110, 100, 41, 59, 10, 10, 32, 32, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 117, 116, 102, 56, 39, 58, 10, 32, 32, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 117, 116, 102, 45, 56, 39, 58, 10, 32, 32, 32, 32, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 46, 117, 116, 102, 56, 83, 108, 105, 99, 101, 40, 115, 116, 97, 114, 116, 44, 32, 101, 110, 100, 41, 59, 10, 10, 32, 32, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 97, 115, 99, 105, 105, 39, 58, 10, 32, 32, 32, 32, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 46, 97, 115, 99, 105, 105, 83, 108, 105, 99, 101, 40, 115, 116, 97, 114, 116, 44, 32, 101, 110, 100, 41, 59, 10, 10, 32, 32, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 98, 105, 110, 97, 114, 121, 39, 58, 10, 32, 32, 32, 32, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 46, 98, 105, 110, 97, 114, 121, 83, 108, 105, 99, 101, 40, 115, 116, 97, 114, 116, 44, 32, 101, 110, 100, 41, 59, 10, 10, 32, 32, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 98, 97, 115, 101, 54, 52, 39, 58, 10, 32, 32, 32, 32, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 46, 98, 97, 115, 101, 54, 52, 83, 108, 105, 99, 101, 40, 115, 116, 97, 114, 116, 44, 32, 101, 110, 100, 41, 59, 10, 10, 32, 32, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 117, 99, 115, 50, 39, 58, 10, 32, 32, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 117, 99, 115, 45, 50, 39, 58, 10, 32, 32, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 117, 116, 102, 49, 54, 108, 101, 39, 58, 10, 32, 32, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 117, 116, 102, 45, 49, 54, 108, 101, 39, 58, 10, 32, 32, 32, 32, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 46, 117, 99, 115, 50, 83, 108, 105, 99, 101, 40, 115, 116, 97, 114, 116, 44, 32, 101, 110, 100, 41, 59, 10, 10, 32, 32, 32, 32, 32, 32, 100, 101, 102, 97, 117, 108, 116, 58, 10, 32, 32, 32, 32, 32, 32, 32, 32, 105, 102, 32, 40, 108, 111, 119, 101, 114, 101, 100, 67, 97, 115, 101, 41, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 116, 104, 114, 111, 119, 32, 110, 101, 119, 32, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 85, 110, 107, 110, 111, 119, 110, 32, 101, 110, 99, 111, 100, 105, 110, 103, 58, 32, 39, 32, 43, 32, 101, 110, 99, 111, 100, 105, 110, 103, 41, 59, 10, 32, 32, 32, 32, 32, 32, 32, 32, 101, 110, 99, 111, 100, 105, 110, 103, 32, 61, 32, 40, 101, 110, 99, 111, 100, 105, 110, 103, 32, 43, 32, 39, 39, 41, 46, 116, 111, 76, 111, 119, 101, 114, 67, 97, 115, 101, 40, 41, 59, 10, 32, 32, 32, 32, 32, 32, 32, 32, 108, 111, 119, 101, 114, 101, 100, 67, 97, 115, 101, 32, 61, 32, 116, 114, 117, 101, 59, 10, 32, 32, 32, 32, 125, 10, 32, 32, 125, 10, 125, 10, 10, 10, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 116, 111, 83, 116, 114, 105, 110, 103, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 32, 123, 10, 32, 32, 105, 102, 32, 40, 97, 114, 103, 117, 109, 101, 110, 116, 115, 46, 108, 101, 110, 103, 116, 104, 32, 61, 61, 61, 32, 48, 41, 32, 123, 10, 32, 32, 32, 32, 118, 97, 114, 32, 114, 101, 115, 117, 108, 116, 32, 61, 32, 116, 104, 105, 115, 46, 117, 116, 102, 56, 83, 108, 105, 99, 101, 40, 48, 44, 32, 116, 104, 105, 115, 46, 108, 101, 110, 103, 116, 104, 41, 59, 10, 32, 32, 125, 32, 101, 108, 115, 101, 32, 123, 10, 32, 32, 32, 32, 118, 97, 114, 32, 114, 101, 115, 117, 108, 116, 32, 61, 32, 115, 108, 111, 119, 84, 111, 83, 116, 114, 105, 110, 103, 46, 97, 112, 112, 108, 121, 40, 116, 104, 105, 115, 44, 32, 97, 114, 103, 117, 109, 101, 110, 116, 115, 41, 59, 10, 32, 32, 125, 10, 32, 32, 105, 102, 32, 40, 114, 101, 115, 117, 108, 116, 32, 61, 61, 61, 32, 117, 110, 100, 101, 102, 105, 110, 101, 100, 41, 10, 32, 32, 32, 32, 116, 104, 114, 111, 119, 32, 110, 101, 119, 32, 69, 114, 114, 111, 114, 40, 39, 116, 111, 83, 116, 114, 105, 110, 103, 32, 102, 97, 105, 108, 101, 100, 39, 41, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 114, 101, 115, 117, 108, 116, 59, 10, 125, 59, 10, 10, 10, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 101, 113, 117, 97, 108, 115, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 32, 101, 113, 117, 97, 108, 115, 40, 98, 41, 32, 123, 10, 32, 32, 105, 102, 32, 40, 33, 40, 98, 32, 105, 110, 115, 116, 97, 110, 99, 101, 111, 102, 32, 66, 117, 102, 102, 101, 114, 41, 41, 10, 32, 32, 32, 32, 116, 104, 114, 111, 119, 32, 110, 101, 119, 32, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 65, 114, 103, 117, 109, 101, 110, 116, 32, 109, 117, 115, 116, 32, 98, 101, 32, 97, 32, 66, 117, 102, 102, 101, 114, 39, 41, 59, 10, 10, 32, 32, 105, 102, 32, 40, 116, 104, 105, 115, 32, 61, 61, 61, 32, 98, 41, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 116, 114, 117, 101, 59, 10, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 98, 105, 110, 100, 105, 110, 103, 46, 99, 111, 109, 112, 97, 114, 101, 40, 116, 104, 105, 115, 44, 32, 98, 41, 32, 61, 61, 61, 32, 48, 59, 10, 125, 59, 10, 10, 10, 47, 47, 32, 73, 110, 115, 112, 101, 99, 116, 10, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 105, 110, 115, 112, 101, 99, 116, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 32, 105, 110, 115, 112, 101, 99, 116, 40, 41, 32, 123, 10, 32, 32, 118, 97, 114, 32, 115, 116, 114, 32, 61, 32, 39, 39, 59, 10, 32, 32, 118, 97, 114, 32, 109, 97, 120, 32, 61, 32, 101, 120, 112, 111, 114, 116, 115, 46, 73, 78, 83, 80, 69, 67, 84, 95, 77, 65, 88, 95, 66, 89, 84, 69, 83, 59, 10, 32, 32, 105, 102, 32, 40, 116, 104, 105, 115, 46, 108, 101, 110, 103, 116, 104, 32, 62, 32, 48, 41, 32, 123, 10, 32, 32, 32, 32, 115, 116, 114, 32, 61, 32, 116, 104, 105, 115, 46, 116, 111, 83, 116, 114, 105, 110, 103, 40, 39, 104, 101, 120, 39, 44, 32, 48, 44, 32, 109, 97, 120, 41, 46, 109, 97, 116, 99, 104, 40, 47, 46, 123, 50, 125, 47, 103, 41, 46, 106, 111, 105, 110, 40, 39, 32, 39, 41, 59, 10, 32, 32, 32, 32, 105, 102, 32, 40, 116, 104, 105, 115, 46, 108, 101, 110, 103, 116, 104, 32, 62, 32, 109, 97, 120, 41, 10, 32, 32, 32, 32, 32, 32, 115, 116, 114, 32, 43, 61, 32, 39, 32, 46, 46, 46, 32, 39, 59, 10, 32, 32, 125, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 39, 60, 39, 32, 43, 32, 116, 104, 105, 115, 46, 99, 111, 110, 115, 116, 114, 117, 99, 116, 111, 114, 46, 110, 97, 109, 101, 32, 43, 32, 39, 32, 39, 32, 43, 32, 115, 116, 114, 32, 43, 32, 39, 62, 39, 59, 10, 125, 59, 10, 10, 10, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 99, 111, 109, 112, 97, 114, 101, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 32, 99, 111, 109, 112, 97, 114, 101, 40, 98, 41, 32, 123, 10, 32, 32, 105, 102, 32, 40, 33, 40, 98, 32, 105, 110, 115, 116, 97, 110, 99, 101, 111, 102, 32, 66, 117, 102, 102, 101, 114, 41, 41, 10, 32, 32, 32, 32, 116, 104, 114, 111, 119, 32, 110, 101, 119, 32, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 65, 114, 103, 117, 109, 101, 110, 116, 32, 109, 117, 115, 116, 32, 98, 101, 32, 97, 32, 66, 117, 102, 102, 101, 114, 39, 41, 59, 10, 10, 32, 32, 105, 102, 32, 40, 116, 104, 105, 115, 32, 61, 61, 61, 32, 98, 41, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 48, 59, 10, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 98, 105, 110, 100, 105, 110, 103, 46, 99, 111, 109, 112, 97, 114, 101, 40, 116, 104, 105, 115, 44, 32, 98, 41, 59, 10, 125, 59, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 115, 108, 111, 119, 73, 110, 100, 101, 120, 79, 102, 40, 98, 117, 102, 102, 101, 114, 44, 32, 118, 97, 108, 44, 32, 98, 121, 116, 101, 79, 102, 102, 115, 101, 116, 44, 32, 101, 110, 99, 111, 100, 105, 110, 103, 41, 32, 123, 10, 32, 32, 118, 97, 114, 32, 108, 111, 119, 101, 114, 101, 100, 67, 97, 115, 101, 32, 61, 32, 102, 97, 108, 115, 101, 59, 10, 32, 32, 102, 111, 114, 32, 40, 59, 59, 41, 32, 123, 10, 32, 32, 32, 32, 115, 119, 105, 116, 99, 104, 32, 40, 101, 110, 99, 111, 100, 105, 110, 103, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 117, 116, 102, 56, 39, 58, 10, 32, 32, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 117, 116, 102, 45, 56, 39, 58, 10, 32, 32, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 117, 99, 115, 50, 39, 58, 10, 32, 32, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 117, 99, 115, 45, 50, 39, 58, 10, 32, 32, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 117, 116, 102, 49, 54, 108, 101, 39, 58, 10, 32, 32, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 117, 116, 102, 45, 49, 54, 108, 101, 39, 58, 10, 32, 32, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 98, 105, 110, 97, 114, 121, 39, 58, 10, 32, 32, 32, 32, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 98, 105, 110, 100, 105, 110, 103, 46, 105, 110, 100, 101, 120, 79, 102, 83, 116, 114, 105, 110, 103, 40, 98, 117, 102, 102, 101, 114, 44, 32, 118, 97, 108, 44, 32, 98, 121, 116, 101, 79, 102, 102, 115, 101, 116, 44, 32, 101, 110, 99, 111, 100, 105, 110, 103, 41, 59, 10, 10, 32, 32, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 98, 97, 115, 101, 54, 52, 39, 58, 10, 32, 32, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 97, 115, 99, 105, 105, 39, 58, 10, 32, 32, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 104, 101, 120, 39, 58, 10, 32, 32, 32, 32, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 98, 105, 110, 100, 105, 110, 103, 46, 105, 110, 100, 101, 120, 79, 102, 66, 117, 102, 102, 101, 114, 40, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 98, 117, 102, 102, 101, 114, 44, 32, 66, 117, 102, 102, 101, 114, 40, 118, 97, 108, 44, 32, 101, 110, 99, 111, 100, 105, 110, 103, 41, 44, 32, 98, 121, 116, 101, 79, 102, 102, 115, 101, 116, 44, 32, 101, 110, 99, 111, 100, 105, 110, 103, 41, 59, 10, 10, 32, 32, 32, 32, 32, 32, 100, 101, 102, 97, 117, 108, 116, 58, 10, 32, 32, 32, 32, 32, 32, 32, 32, 105, 102, 32, 40, 108, 111, 119, 101, 114, 101, 100, 67, 97, 115, 101, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 116, 104, 114, 111, 119, 32, 110, 101, 119, 32, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 85, 110, 107, 110, 111, 119, 110, 32, 101, 110, 99, 111, 100, 105, 110, 103, 58, 32, 39, 32, 43, 32, 101, 110, 99, 111, 100, 105, 110, 103, 41, 59, 10, 32, 32, 32, 32, 32, 32, 32, 32, 125, 10, 10, 32, 32, 32, 32, 32, 32, 32, 32, 101, 110, 99, 111, 100, 105, 110, 103, 32, 61, 32, 40, 39, 39, 32, 43, 32, 101, 110, 99, 111, 100, 105, 110, 103, 41, 46, 116, 111, 76, 111, 119, 101, 114, 67, 97, 115, 101, 40, 41, 59, 10, 32, 32, 32, 32, 32, 32, 32, 32, 108, 111, 119, 101, 114, 101, 100, 67, 97, 115, 101, 32, 61, 32, 116, 114, 117, 101, 59, 10, 32, 32, 32, 32, 125, 10, 32, 32, 125, 10, 125, 10, 10, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 105, 110, 100, 101, 120, 79, 102, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 32, 105, 110, 100, 101, 120, 79, 102, 40, 118, 97, 108, 44, 32, 98, 121, 116, 101, 79, 102, 102, 115, 101, 116, 44, 32, 101, 110, 99, 111, 100, 105, 110, 103, 41, 32, 123, 10, 32, 32, 105, 102, 32, 40, 98, 121, 116, 101, 79, 102, 102, 115, 101, 116, 32, 62, 32, 48, 120, 55, 102, 102, 102, 102, 102, 102, 102, 41, 10, 32, 32, 32, 32, 98, 121, 116, 101, 79, 102, 102, 115, 101, 116, 32, 61, 32, 48, 120, 55, 102, 102, 102, 102, 102, 102, 102, 59, 10, 32, 32, 101, 108, 115, 101, 32, 105, 102, 32, 40, 98, 121, 116, 101, 79, 102, 102, 115, 101, 116, 32, 60, 32, 45, 48, 120, 56, 48, 48, 48, 48, 48, 48, 48, 41, 10, 32, 32, 32, 32, 98, 121, 116, 101, 79, 102, 102, 115, 101, 116, 32, 61, 32, 45, 48, 120, 56, 48, 48, 48, 48, 48, 48, 48, 59, 10, 32, 32, 98, 121, 116, 101, 79, 102, 102, 115, 101, 116, 32, 62, 62, 61, 32, 48, 59, 10, 10, 32, 32, 105, 102, 32, 40, 116, 121, 112, 101, 111, 102, 32, 118, 97, 108, 32, 61, 61, 61, 32, 39, 115, 116, 114, 105, 110, 103, 39, 41, 32, 123, 10, 32, 32, 32, 32, 105, 102, 32, 40, 101, 110, 99, 111, 100, 105, 110, 103, 32, 61, 61, 61, 32, 117, 110, 100, 101, 102, 105, 110, 101, 100, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 98, 105, 110, 100, 105, 110, 103, 46, 105, 110, 100, 101, 120, 79, 102, 83, 116, 114, 105, 110, 103, 40, 116, 104, 105, 115, 44, 32, 118, 97, 108, 44, 32, 98, 121, 116, 101, 79, 102, 102, 115, 101, 116, 44, 32, 101, 110, 99, 111, 100, 105, 110, 103, 41, 59, 10, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 115, 108, 111, 119, 73, 110, 100, 101, 120, 79, 102, 40, 116, 104, 105, 115, 44, 32, 118, 97, 108, 44, 32, 98, 121, 116, 101, 79, 102, 102, 115, 101, 116, 44, 32, 101, 110, 99, 111, 100, 105, 110, 103, 41, 59, 10, 32, 32, 125, 32, 101, 108, 115, 101, 32, 105, 102, 32, 40, 118, 97, 108, 32, 105, 110, 115, 116, 97, 110, 99, 101, 111, 102, 32, 66, 117, 102, 102, 101, 114, 41, 32, 123, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 98, 105, 110, 100, 105, 110, 103, 46, 105, 110, 100, 101, 120, 79, 102, 66, 117, 102, 102, 101, 114, 40, 116, 104, 105, 115, 44, 32, 118, 97, 108, 44, 32, 98, 121, 116, 101, 79, 102, 102, 115, 101, 116, 44, 32, 101, 110, 99, 111, 100, 105, 110, 103, 41, 59, 10, 32, 32, 125, 32, 101, 108, 115, 101, 32, 105, 102, 32, 40, 116, 121, 112, 101, 111, 102, 32, 118, 97, 108, 32, 61, 61, 61, 32, 39, 110, 117, 109, 98, 101, 114, 39, 41, 32, 123, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 98, 105, 110, 100, 105, 110, 103, 46, 105, 110, 100, 101, 120, 79, 102, 78, 117, 109, 98, 101, 114, 40, 116, 104, 105, 115, 44, 32, 118, 97, 108, 44, 32, 98, 121, 116, 101, 79, 102, 102, 115, 101, 116, 41, 59, 10, 32, 32, 125, 10, 10, 32, 32, 116, 104, 114, 111, 119, 32, 110, 101, 119, 32, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 118, 97, 108, 32, 109, 117, 115, 116, 32, 98, 101, 32, 115, 116, 114, 105, 110, 103, 44, 32, 110, 117, 109, 98, 101, 114, 32, 111, 114, 32, 66, 117, 102, 102, 101, 114, 39, 41, 59, 10, 125, 59, 10, 10, 10, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 102, 105, 108, 108, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 32, 102, 105, 108, 108, 40, 118, 97, 108, 44, 32, 115, 116, 97, 114, 116, 44, 32, 101, 110, 100, 44, 32, 101, 110, 99, 111, 100, 105, 110, 103, 41, 32, 123, 10, 32, 32, 105, 102, 32, 40, 116, 121, 112, 101, 111, 102, 32, 115, 116, 97, 114, 116, 32, 61, 61, 61, 32, 39, 115, 116, 114, 105, 110, 103, 39, 41, 32, 123, 10, 32, 32, 32, 32, 101, 110, 99, 111, 100, 105, 110, 103, 32, 61, 32, 115, 116, 97, 114, 116, 59, 10, 32, 32, 32, 32, 115, 116, 97, 114, 116, 32, 61, 32, 48, 59, 10, 32, 32, 32, 32, 101, 110, 100, 32, 61, 32, 116, 104, 105, 115, 46, 108, 101, 110, 103, 116, 104, 59, 10, 32, 32, 125, 32, 101, 108, 115, 101, 32, 105, 102, 32, 40, 116, 121, 112, 101, 111, 102, 32, 101, 110, 100, 32, 61, 61, 61, 32, 39, 115, 116, 114, 105, 110, 103, 39, 41, 32, 123, 10, 32, 32, 32, 32, 101, 110, 99, 111, 100, 105, 110, 103, 32, 61, 32, 101, 110, 100, 59, 10, 32, 32, 32, 32, 101, 110, 100, 32, 61, 32, 116, 104, 105, 115, 46, 108, 101, 110, 103, 116, 104, 59, 10, 32, 32, 125, 10, 10, 32, 32, 115, 116, 97, 114, 116, 32, 61, 32, 115, 116, 97, 114, 116, 32, 62, 62, 32, 48, 59, 10, 32, 32, 101, 110, 100, 32, 61, 32, 40, 101, 110, 100, 32, 61, 61, 61, 32, 117, 110, 100, 101, 102, 105, 110, 101, 100, 41, 32, 63, 32, 116, 104, 105, 115, 46, 108, 101, 110, 103, 116, 104, 32, 58, 32, 101, 110, 100, 32, 62, 62, 32, 48, 59, 10, 10, 32, 32, 105, 102, 32, 40, 115, 116, 97, 114, 116, 32, 60, 32, 48, 32, 124, 124, 32, 101, 110, 100, 32, 62, 32, 116, 104, 105, 115, 46, 108, 101, 110, 103, 116, 104, 41, 10, 32, 32, 32, 32, 116, 104, 114, 111, 119, 32, 110, 101, 119, 32, 82, 97, 110, 103, 101, 69, 114, 114, 111, 114, 40, 39, 111, 117, 116, 32, 111, 102, 32, 114, 97, 110, 103, 101, 32, 105, 110, 100, 101, 120, 39, 41, 59, 10, 32, 32, 105, 102, 32, 40, 101, 110, 100, 32, 60, 61, 32, 115, 116, 97, 114, 116, 41, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 59, 10, 10, 32, 32, 105, 102, 32, 40, 116, 121, 112, 101, 111, 102, 32, 118, 97, 108, 32, 61, 61, 61, 32, 39, 115, 116, 114, 105, 110, 103, 39, 41, 32, 123, 10, 32, 32, 32, 32, 105, 102, 32, 40, 101, 110, 99, 111, 100, 105, 110, 103, 32, 33, 61, 61, 32, 117, 110, 100, 101, 102, 105, 110, 101, 100, 32, 38, 38, 32, 116, 121, 112, 101, 111, 102, 32, 101, 110, 99, 111, 100, 105, 110, 103, 32, 33, 61, 61, 32, 39, 115, 116, 114, 105, 110, 103, 39, 41, 10, 32, 32, 32, 32, 32, 32, 116, 104, 114, 111, 119, 32, 110, 101, 119, 32, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 101, 110, 99, 111, 100, 105, 110, 103, 32, 109, 117, 115, 116, 32, 98, 101, 32, 97, 32, 115, 116, 114, 105, 110, 103, 39, 41, 59, 10, 32, 32, 32, 32, 105, 102, 32, 40, 116, 121, 112, 101, 111, 102, 32, 101, 110, 99, 111, 100, 105, 110, 103, 32, 61, 61, 61, 32, 39, 115, 116, 114, 105, 110, 103, 39, 32, 38, 38, 32, 33, 66, 117, 102, 102, 101, 114, 46, 105, 115, 69, 110, 99, 111, 100, 105, 110, 103, 40, 101, 110, 99, 111, 100, 105, 110, 103, 41, 41, 10, 32, 32, 32, 32, 32, 32, 116, 104, 114, 111, 119, 32, 110, 101, 119, 32, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 85, 110, 107, 110, 111, 119, 110, 32, 101, 110, 99, 111, 100, 105, 110, 103, 58, 32, 39, 32, 43, 32, 101, 110, 99, 111, 100, 105, 110, 103, 41, 59, 10, 10, 32, 32, 32, 32, 101, 110, 99, 111, 100, 105, 110, 103, 32, 61, 32, 40, 101, 110, 99, 111, 100, 105, 110, 103, 32, 124, 124, 32, 39, 117, 116, 102, 56, 39, 41, 46, 116, 111, 76, 111, 119, 101, 114, 67, 97, 115, 101, 40, 41, 59, 10, 32, 32, 32, 32, 105, 102, 32, 40, 101, 110, 99, 111, 100, 105, 110, 103, 32, 33, 61, 61, 32, 39, 117, 116, 102, 56, 39, 32, 38, 38, 32, 101, 110, 99, 111, 100, 105, 110, 103, 32, 33, 61, 61, 32, 39, 117, 116, 102, 45, 56, 39, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 47, 47, 32, 84, 104, 101, 32, 110, 97, 116, 105, 118, 101, 32, 115, 105, 100, 101, 32, 116, 97, 107, 101, 115, 32, 85, 84, 70, 45, 56, 32, 116, 101, 120, 116, 44, 32, 111, 116, 104, 101, 114, 32, 101, 110, 99, 111, 100, 105, 110, 103, 115, 32, 102, 105, 108, 108, 32, 116, 104, 101, 32, 98, 121, 116, 101, 115, 46, 10, 32, 32, 32, 32, 32, 32, 118, 97, 108, 32, 61, 32, 102, 114, 111, 109, 83, 116, 114, 105, 110, 103, 40, 118, 97, 108, 44, 32, 101, 110, 99, 111, 100, 105, 110, 103, 41, 59, 10, 32, 32, 32, 32, 32, 32, 47, 47, 32, 78, 111, 116, 104, 105, 110, 103, 32, 100, 101, 99, 111, 100, 101, 100, 44, 32, 122, 101, 114, 111, 32, 116, 104, 101, 32, 114, 97, 110, 103, 101, 32, 114, 97, 116, 104, 101, 114, 32, 116, 104, 97, 110, 32, 108, 101, 97, 118, 105, 110, 103, 32, 105, 116, 32, 97, 115, 32, 105, 116, 32, 119, 97, 115, 46, 10, 32, 32, 32, 32, 32, 32, 105, 102, 32, 40, 118, 97, 108, 46, 108, 101, 110, 103, 116, 104, 32, 61, 61, 61, 32, 48, 41, 10, 32, 32, 32, 32, 32, 32, 32, 32, 118, 97, 108, 32, 61, 32, 48, 59, 10, 32, 32, 32, 32, 125, 32, 101, 108, 115, 101, 32, 105, 102, 32, 40, 118, 97, 108, 46, 108, 101, 110, 103, 116, 104, 32, 61, 61, 61, 32, 49, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 118, 97, 114, 32, 99, 111, 100, 101, 32, 61, 32, 118, 97, 108, 46, 99, 104, 97, 114, 67, 111, 100, 101, 65, 116, 40, 48, 41, 59, 10, 32, 32, 32, 32, 32, 32, 105, 102, 32, 40, 99, 111, 100, 101, 32, 60, 32, 50, 53, 54, 41, 10, 32, 32, 32, 32, 32, 32, 32, 32, 118, 97, 108, 32, 61, 32, 99, 111, 100, 101, 59, 10, 32, 32, 32, 32, 125, 10, 32, 32, 125, 32, 101, 108, 115, 101, 32, 105, 102, 32, 40, 33, 40, 118, 97, 108, 32, 105, 110, 115, 116, 97, 110, 99, 101, 111, 102, 32, 66, 117, 102, 102, 101, 114, 41, 41, 32, 123, 10, 32, 32, 32, 32, 118, 97, 108, 32, 61, 32, 118, 97, 108, 32, 62, 62, 62, 32, 48, 59, 10, 32, 32, 125, 10, 10, 32, 32, 98, 105, 110, 100, 105, 110, 103, 46, 102, 105, 108, 108, 40, 116, 104, 105, 115, 44, 32, 118, 97, 108, 44, 32, 115, 116, 97, 114, 116, 44, 32, 101, 110, 100, 41, 59, 10, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 59, 10, 125, 59, 10, 10, 10, 47, 47, 32, 88, 88, 88, 32, 114, 101, 109, 111, 118, 101, 32, 105, 110, 32, 118, 48, 46, 49, 51, 10, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 103, 101, 116, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 32, 103, 101, 116, 40, 111, 102, 102, 115, 101, 116, 41, 32, 123, 10, 32, 32, 111, 102, 102, 115, 101, 116, 32, 61, 32, 126, 126, 111, 102, 102, 115, 101, 116, 59, 10, 32, 32, 105, 102, 32, 40, 111, 102, 102, 115, 101, 116, 32, 60, 32, 48, 32, 124, 124, 32, 111, 102, 102, 115, 101, 116, 32, 62, 61, 32, 116, 104, 105, 115, 46, 108, 101, 110, 103, 116, 104, 41, 10, 32, 32, 32, 32, 116, 104, 114, 111, 119, 32, 110, 101, 119, 32, 82, 97, 110, 103, 101, 69, 114, 114, 111, 114, 40, 39, 105, 110, 100, 101, 120, 32, 111, 117, 116, 32, 111, 102, 32, 114, 97, 110, 103, 101, 39, 41, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 46, 103, 101, 116, 65, 116, 40, 111, 102, 102, 115, 101, 116, 41, 59, 10, 125, 59, 10, 10, 47, 47, 32, 88, 88, 88, 32, 114, 101, 109, 111, 118, 101, 32, 105, 110, 32, 118, 48, 46, 49, 51, 10, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 115, 101, 116, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 32, 115, 101, 116, 40, 111, 102, 102, 115, 101, 116, 44, 32, 118, 41, 32, 123, 10, 32, 32, 111, 102, 102, 115, 101, 116, 32, 61, 32, 126, 126, 111, 102, 102, 115, 101, 116, 59, 10, 32, 32, 105, 102, 32, 40, 111, 102, 102, 115, 101, 116, 32, 60, 32, 48, 32, 124, 124, 32, 111, 102, 102, 115, 101, 116, 32, 62, 61, 32, 116, 104, 105, 115, 46, 108, 101, 110, 103, 116, 104, 41, 10, 32, 32, 32, 32, 116, 104, 114, 111, 119, 32, 110, 101, 119, 32, 82, 97, 110, 103, 101, 69, 114, 114, 111, 114, 40, 39, 105, 110, 100, 101, 120, 32, 111, 117, 116, 32, 111, 102, 32, 114, 97, 110, 103, 101, 39, 41, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 46, 115, 101, 116, 65, 116, 40, 111, 102, 102, 115, 101, 116, 44, 32, 118, 41, 59, 10, 125, 59, 10, 10, 118, 97, 114, 32, 119, 114, 105, 116, 101, 87, 97, 114, 110, 101, 100, 32, 61, 32, 102, 97, 108, 115, 101, 59, 10, 99, 111, 110, 115, 116, 32, 119, 114, 105, 116, 101, 77, 115, 103, 32, 61, 32, 39, 66, 117, 102, 102, 101, 114, 46, 119, 114, 105, 116, 101, 40, 115, 116, 114, 105, 110, 103, 44, 32, 101, 110, 99, 111, 100, 105, 110, 103, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 108, 101, 110, 103, 116, 104, 41, 32, 105, 115, 32, 39, 32, 43, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 39, 100, 101, 112, 114, 101, 99, 97, 116, 101, 100, 46, 32, 85, 115, 101, 32, 119, 114, 105, 116, 101, 40, 115, 116, 114, 105, 110, 103, 91, 44, 32, 111, 102, 102, 115, 101, 116, 91, 44, 32, 108, 101, 110, 103, 116, 104, 93, 93, 39, 32, 43, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 39, 91, 44, 32, 101, 110, 99, 111, 100, 105, 110, 103, 93, 41, 32, 105, 110, 115, 116, 101, 97, 100, 46, 39, 59, 10, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 119, 114, 105, 116, 101, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 115, 116, 114, 105, 110, 103, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 108, 101, 110, 103, 116, 104, 44, 32, 101, 110, 99, 111, 100, 105, 110, 103, 41, 32, 123, 10, 32, 32, 47, 47, 32, 66, 117, 102, 102, 101, 114, 35, 119, 114, 105, 116, 101, 40, 115, 116, 114, 105, 110, 103, 41, 59, 10, 32, 32, 105, 102, 32, 40, 111, 102, 102, 115, 101, 116, 32, 61, 61, 61, 32, 117, 110, 100, 101, 102, 105, 110, 101, 100, 41, 32, 123, 10, 32, 32, 32, 32, 101, 110, 99, 111, 100, 105, 110, 103, 32, 61, 32, 39, 117, 116, 102, 56, 39, 59, 10, 32, 32, 32, 32, 108, 101, 110, 103, 116, 104, 32, 61, 32, 116, 104, 105, 115, 46, 108, 101, 110, 103, 116, 104, 59, 10, 32, 32, 32, 32, 111, 102, 102, 115, 101, 116, 32, 61, 32, 48, 59, 10, 10, 32, 32, 47, 47, 32, 66, 117, 102, 102, 101, 114, 35, 119, 114, 105, 116, 101, 40, 115, 116, 114, 105, 110, 103, 44, 32, 101, 110, 99, 111, 100, 105, 110, 103, 41, 10, 32, 32, 125, 32, 101, 108, 115, 101, 32, 105, 102, 32, 40, 108, 101, 110, 103, 116, 104, 32, 61, 61, 61, 32, 117, 110, 100, 101, 102, 105, 110, 101, 100, 32, 38, 38, 32, 116, 121, 112, 101, 111, 102, 32, 111, 102, 102, 115, 101, 116, 32, 61, 61, 61, 32, 39, 115, 116, 114, 105, 110, 103, 39, 41, 32, 123, 10, 32, 32, 32, 32, 101, 110, 99, 111, 100, 105, 110, 103, 32, 61, 32, 111, 102, 102, 115, 101, 116, 59, 10, 32, 32, 32, 32, 108, 101, 110, 103, 116, 104, 32, 61, 32, 116, 104, 105, 115, 46, 108, 101, 110, 103, 116, 104, 59, 10, 32, 32, 32, 32, 111, 102, 102, 115, 101, 116, 32, 61, 32, 48, 59, 10, 10, 32, 32, 47, 47, 32, 66, 117, 102, 102, 101, 114, 35, 119, 114, 105, 116, 101, 40, 115, 116, 114, 105, 110, 103, 44, 32, 111, 102, 102, 115, 101, 116, 91, 44, 32, 108, 101, 110, 103, 116, 104, 93, 91, 44, 32, 101, 110, 99, 111, 100, 105, 110, 103, 93, 41, 10, 32, 32, 125, 32, 101, 108, 115, 101, 32, 105, 102, 32, 40, 105, 115, 70, 105, 110, 105, 116, 101, 40, 111, 102, 102, 115, 101, 116, 41, 41, 32, 123, 10, 32, 32, 32, 32, 111, 102, 102, 115, 101, 116, 32, 61, 32, 111, 102, 102, 115, 101, 116, 32, 62, 62, 62, 32, 48, 59, 10, 32, 32, 32, 32, 105, 102, 32, 40, 105, 115, 70, 105, 110, 105, 116, 101, 40, 108, 101, 110, 103, 116, 104, 41, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 108, 101, 110, 103, 116, 104, 32, 61, 32, 108, 101, 110, 103, 116, 104, 32, 62, 62, 62, 32, 48, 59, 10, 32, 32, 32, 32, 32, 32, 105, 102, 32, 40, 101, 110, 99, 111, 100, 105, 110, 103, 32, 61, 61, 61, 32, 117, 110, 100, 101, 102, 105, 110, 101, 100, 41, 10, 32, 32, 32, 32, 32, 32, 32, 32, 101, 110, 99, 111, 100, 105, 110, 103, 32, 61, 32, 39, 117, 116, 102, 56, 39, 59, 10, 32, 32, 32, 32, 125, 32, 101, 108, 115, 101, 32, 123, 10, 32, 32, 32, 32, 32, 32, 101, 110, 99, 111, 100, 105, 110, 103, 32, 61, 32, 108, 101, 110, 103, 116, 104, 59, 10, 32, 32, 32, 32, 32, 32, 108, 101, 110, 103, 116, 104, 32, 61, 32, 117, 110, 100, 101, 102, 105, 110, 101, 100, 59, 10, 32, 32, 32, 32, 125, 10, 10, 32, 32, 47, 47, 32, 88, 88, 88, 32, 108, 101, 103, 97, 99, 121, 32, 119, 114, 105, 116, 101, 40, 115, 116, 114, 105, 110, 103, 44, 32, 101, 110, 99, 111, 100, 105, 110, 103, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 108, 101, 110, 103, 116, 104, 41, 32, 45, 32, 114, 101, 109, 111, 118, 101, 32, 105, 110, 32, 118, 48, 46, 49, 51, 10, 32, 32, 125, 32, 101, 108, 115, 101, 32, 123, 10, 32, 32, 32, 32, 119, 114, 105, 116, 101, 87, 97, 114, 110, 101, 100, 32, 61, 32, 105, 110, 116, 101, 114, 110, 97, 108, 85, 116, 105, 108, 46, 112, 114, 105, 110, 116, 68, 101, 112, 114, 101, 99, 97, 116, 105, 111, 110, 77, 101, 115, 115, 97, 103, 101, 40, 119, 114, 105, 116, 101, 77, 115, 103, 44, 32, 119, 114, 105, 116, 101, 87, 97, 114, 110, 101, 100, 41, 59, 10, 32, 32, 32, 32, 118, 97, 114, 32, 115, 119, 97, 112, 32, 61, 32, 101, 110, 99, 111, 100, 105, 110, 103, 59, 10, 32, 32, 32, 32, 101, 110, 99, 111, 100, 105, 110, 103, 32, 61, 32, 111, 102, 102, 115, 101, 116, 59, 10, 32, 32, 32, 32, 111, 102, 102, 115, 101, 116, 32, 61, 32, 108, 101, 110, 103, 116, 104, 32, 62, 62, 62, 32, 48, 59, 10, 32, 32, 32, 32, 108, 101, 110, 103, 116, 104, 32, 61, 32, 115, 119, 97, 112, 59, 10, 32, 32, 125, 10, 10, 32, 32, 118, 97, 114, 32, 114, 101, 109, 97, 105, 110, 105, 110, 103, 32, 61, 32, 116, 104, 105, 115, 46, 108, 101, 110, 103, 116, 104, 32, 45, 32, 111, 102, 102, 115, 101, 116, 59, 10, 32, 32, 105, 102, 32, 40, 108, 101, 110, 103, 116, 104, 32, 61, 61, 61, 32, 117, 110, 100, 101, 102, 105, 110, 101, 100, 32, 124, 124, 32, 108, 101, 110, 103, 116, 104, 32, 62, 32, 114, 101, 109, 97, 105, 110, 105, 110, 103, 41, 10, 32, 32, 32, 32, 108, 101, 110, 103, 116, 104, 32, 61, 32, 114, 101, 109, 97, 105, 110, 105, 110, 103, 59, 10, 10, 32, 32, 105, 102, 32, 40, 115, 116, 114, 105, 110, 103, 46, 108, 101, 110, 103, 116, 104, 32, 62, 32, 48, 32, 38, 38, 32, 40, 108, 101, 110, 103, 116, 104, 32, 60, 32, 48, 32, 124, 124, 32, 111, 102, 102, 115, 101, 116, 32, 60, 32, 48, 41, 41, 10, 32, 32, 32, 32, 116, 104, 114, 111, 119, 32, 110, 101, 119, 32, 82, 97, 110, 103, 101, 69, 114, 114, 111, 114, 40, 39, 97, 116, 116, 101, 109, 112, 116, 32, 116, 111, 32, 119, 114, 105, 116, 101, 32, 111, 117, 116, 115, 105, 100, 101, 32, 98, 117, 102, 102, 101, 114, 32, 98, 111, 117, 110, 100, 115, 39, 41, 59, 10, 10, 32, 32, 105, 102, 32, 40, 33, 101, 110, 99, 111, 100, 105, 110, 103, 41, 10, 32, 32, 32, 32, 101, 110, 99, 111, 100, 105, 110, 103, 32, 61, 32, 39, 117, 116, 102, 56, 39, 59, 10, 10, 32, 32, 118, 97, 114, 32, 108, 111, 119, 101, 114, 101, 100, 67, 97, 115, 101, 32, 61, 32, 102, 97, 108, 115, 101, 59, 10, 32, 32, 102, 111, 114, 32, 40, 59, 59, 41, 32, 123, 10, 32, 32, 32, 32, 115, 119, 105, 116, 99, 104, 32, 40, 101, 110, 99, 111, 100, 105, 110, 103, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 104, 101, 120, 39, 58, 10, 32, 32, 32, 32, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 46, 104, 101, 120, 87, 114, 105, 116, 101, 40, 115, 116, 114, 105, 110, 103, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 108, 101, 110, 103, 116, 104, 41, 59, 10, 10, 32, 32, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 117, 116, 102, 56, 39, 58, 10, 32, 32, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 117, 116, 102, 45, 56, 39, 58, 10, 32, 32, 32, 32, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 46, 117, 116, 102, 56, 87, 114, 105, 116, 101, 40, 115, 116, 114, 105, 110, 103, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 108, 101, 110, 103, 116, 104, 41, 59, 10, 10, 32, 32, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 97, 115, 99, 105, 105, 39, 58, 10, 32, 32, 32, 32, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 46, 97, 115, 99, 105, 105, 87, 114, 105, 116, 101, 40, 115, 116, 114, 105, 110, 103, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 108, 101, 110, 103, 116, 104, 41, 59, 10, 10, 32, 32, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 98, 105, 110, 97, 114, 121, 39, 58, 10, 32, 32, 32, 32, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 46, 98, 105, 110, 97, 114, 121, 87, 114, 105, 116, 101, 40, 115, 116, 114, 105, 110, 103, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 108, 101, 110, 103, 116, 104, 41, 59, 10, 10, 32, 32, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 98, 97, 115, 101, 54, 52, 39, 58, 10, 32, 32, 32, 32, 32, 32, 32, 32, 47, 47, 32, 87, 97, 114, 110, 105, 110, 103, 58, 32, 109, 97, 120, 76, 101, 110, 103, 116, 104, 32, 110, 111, 116, 32, 116, 97, 107, 101, 110, 32, 105, 110, 116, 111, 32, 97, 99, 99, 111, 117, 110, 116, 32, 105, 110, 32, 98, 97, 115, 101, 54, 52, 87, 114, 105, 116, 101, 10, 32, 32, 32, 32, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 46, 98, 97, 115, 101, 54, 52, 87, 114, 105, 116, 101, 40, 115, 116, 114, 105, 110, 103, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 108, 101, 110, 103, 116, 104, 41, 59, 10, 10, 32, 32, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 117, 99, 115, 50, 39, 58, 10, 32, 32, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 117, 99, 115, 45, 50, 39, 58, 10, 32, 32, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 117, 116, 102, 49, 54, 108, 101, 39, 58, 10, 32, 32, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 117, 116, 102, 45, 49, 54, 108, 101, 39, 58, 10, 32, 32, 32, 32, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 46, 117, 99, 115, 50, 87, 114, 105, 116, 101, 40, 115, 116, 114, 105, 110, 103, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 108, 101, 110, 103, 116, 104, 41, 59, 10, 10, 32, 32, 32, 32, 32, 32, 100, 101, 102, 97, 117, 108, 116, 58, 10, 32, 32, 32, 32, 32, 32, 32, 32, 105, 102, 32, 40, 108, 111, 119, 101, 114, 101, 100, 67, 97, 115, 101, 41, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 116, 104, 114, 111, 119, 32, 110, 101, 119, 32, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 85, 110, 107, 110, 111, 119, 110, 32, 101, 110, 99, 111, 100, 105, 110, 103, 58, 32, 39, 32, 43, 32, 101, 110, 99, 111, 100, 105, 110, 103, 41, 59, 10, 32, 32, 32, 32, 32, 32, 32, 32, 101, 110, 99, 111, 100, 105, 110, 103, 32, 61, 32, 40, 39, 39, 32, 43, 32, 101, 110, 99, 111, 100, 105, 110, 103, 41, 46, 116, 111, 76, 111, 119, 101, 114, 67, 97, 115, 101, 40, 41, 59, 10, 32, 32, 32, 32, 32, 32, 32, 32, 108, 111, 119, 101, 114, 101, 100, 67, 97, 115, 101, 32, 61, 32, 116, 114, 117, 101, 59, 10, 32, 32, 32, 32, 125, 10, 32, 32, 125, 10, 125, 59, 10, 10, 10, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 116, 111, 65, 114, 114, 97, 121, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 32, 123, 10, 32, 32, 118, 97, 114, 32, 97, 114, 114, 97, 121, 32, 61, 32, 110, 101, 119, 32, 65, 114, 114, 97, 121, 40, 116, 104, 105, 115, 46, 108, 101, 110, 103, 116, 104, 41, 59, 10, 32, 32, 102, 111, 114, 32, 40, 118, 97, 114, 32, 105, 32, 61, 32, 48, 59, 32, 105, 32, 60, 32, 97, 114, 114, 97, 121, 46, 108, 101, 110, 103, 116, 104, 59, 32, 105, 43, 43, 41, 10, 32, 32, 32, 32, 97, 114, 114, 97, 121, 91, 105, 93, 32, 61, 32, 116, 104, 105, 115, 46, 103, 101, 116, 65, 116, 40, 105, 41, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 97, 114, 114, 97, 121, 59, 10, 125, 10, 10, 10, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 116, 111, 74, 83, 79, 78, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 32, 123, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 123, 10, 32, 32, 32, 32, 116, 121, 112, 101, 58, 32, 39, 66, 117, 102, 102, 101, 114, 39, 44, 10, 32, 32, 32, 32, 100, 97, 116, 97, 58, 32, 116, 104, 105, 115, 46, 116, 111, 65, 114, 114, 97, 121, 40, 41, 10, 32, 32, 125, 59, 10, 125, 59, 10, 10, 10, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 115, 108, 105, 99, 101, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 32, 115, 108, 105, 99, 101, 40, 115, 116, 97, 114, 116, 44, 32, 101, 110, 100, 41, 32, 123, 10, 32, 32, 99, 111, 110, 115, 116, 32, 98, 117, 102, 102, 101, 114, 32, 61, 32, 116, 104, 105, 115, 46, 115, 117, 98, 97, 114, 114, 97, 121, 40, 115, 116, 97, 114, 116, 44, 32, 101, 110, 100, 41, 59, 10, 32, 32, 79, 98, 106, 101, 99, 116, 46, 115, 101, 116, 80, 114, 111, 116, 111, 116, 121, 112, 101, 79, 102, 40, 98, 117, 102, 102, 101, 114, 44, 32, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 41, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 98, 117, 102, 102, 101, 114, 59, 10, 125, 59, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 99, 104, 101, 99, 107, 79, 102, 102, 115, 101, 116, 40, 111, 102, 102, 115, 101, 116, 44, 32, 101, 120, 116, 44, 32, 108, 101, 110, 103, 116, 104, 41, 32, 123, 10, 32, 32, 105, 102, 32, 40, 111, 102, 102, 115, 101, 116, 32, 43, 32, 101, 120, 116, 32, 62, 32, 108, 101, 110, 103, 116, 104, 41, 10, 32, 32, 32, 32, 116, 104, 114, 111, 119, 32, 110, 101, 119, 32, 82, 97, 110, 103, 101, 69, 114, 114, 111, 114, 40, 39, 105, 110, 100, 101, 120, 32, 111, 117, 116, 32, 111, 102, 32, 114, 97, 110, 103, 101, 39, 41, 59, 10, 125, 10, 10, 10, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 114, 101, 97, 100, 85, 73, 110, 116, 76, 69, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 111, 102, 102, 115, 101, 116, 44, 32, 98, 121, 116, 101, 76, 101, 110, 103, 116, 104, 44, 32, 110, 111, 65, 115, 115, 101, 114, 116, 41, 32, 123, 10, 32, 32, 111, 102, 102, 115, 101, 116, 32, 61, 32, 111, 102, 102, 115, 101, 116, 32, 62, 62, 62, 32, 48, 59, 10, 32, 32, 98, 121, 116, 101, 76, 101, 110, 103, 116, 104, 32, 61, 32, 98, 121, 116, 101, 76, 101, 110, 103, 116, 104, 32, 62, 62, 62, 32, 48, 59, 10, 32, 32, 105, 102, 32, 40, 33, 110, 111, 65, 115, 115, 101, 114, 116, 41, 10, 32, 32, 32, 32, 99, 104, 101, 99, 107, 79, 102, 102, 115, 101, 116, 40, 111, 102, 102, 115, 101, 116, 44, 32, 98, 121, 116, 101, 76, 101, 110, 103, 116, 104, 44, 32, 116, 104, 105, 115, 46, 108, 101, 110, 103, 116, 104, 41, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 98, 105, 110, 100, 105, 110, 103, 46, 114, 101, 97, 100, 85, 73, 110, 116, 76, 69, 40, 116, 104, 105, 115, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 98, 121, 116, 101, 76, 101, 110, 103, 116, 104, 41, 59, 10, 125, 59, 10, 10, 10, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 114, 101, 97, 100, 85, 73, 110, 116, 66, 69, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 111, 102, 102, 115, 101, 116, 44, 32, 98, 121, 116, 101, 76, 101, 110, 103, 116, 104, 44, 32, 110, 111, 65, 115, 115, 101, 114, 116, 41, 32, 123, 10, 32, 32, 111, 102, 102, 115, 101, 116, 32, 61, 32, 111, 102, 102, 115, 101, 116, 32, 62, 62, 62, 32, 48, 59, 10, 32, 32, 98, 121, 116, 101, 76, 101, 110, 103, 116, 104, 32, 61, 32, 98, 121, 116, 101, 76, 101, 110, 103, 116, 104, 32, 62, 62, 62, 32, 48, 59, 10, 32, 32, 105, 102, 32, 40, 33, 110, 111, 65, 115, 115, 101, 114, 116, 41, 10, 32, 32, 32, 32, 99, 104, 101, 99, 107, 79, 102, 102, 115, 101, 116, 40, 111, 102, 102, 115, 101, 116, 44, 32, 98, 121, 116, 101, 76, 101, 110, 103, 116, 104, 44, 32, 116, 104, 105, 115, 46, 108, 101, 110, 103, 116, 104, 41, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 98, 105, 110, 100, 105, 110, 103, 46, 114, 101, 97, 100, 85, 73, 110, 116, 66, 69, 40, 116, 104, 105, 115, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 98, 121, 116, 101, 76, 101, 110, 103, 116, 104, 41, 59, 10, 125, 59, 10, 10, 10, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 114, 101, 97, 100, 85, 73, 110, 116, 56, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 111, 102, 102, 115, 101, 116, 44, 32, 110, 111, 65, 115, 115, 101, 114, 116, 41, 32, 123, 10, 32, 32, 111, 102, 102, 115, 101, 116, 32, 61, 32, 111, 102, 102, 115, 101, 116, 32, 62, 62, 62, 32, 48, 59, 10, 32, 32, 105, 102, 32, 40, 33, 110, 111, 65, 115, 115, 101, 114, 116, 41, 10, 32, 32, 32, 32, 99, 104, 101, 99, 107, 79, 102, 102, 115, 101, 116, 40, 111, 102, 102, 115, 101, 116, 44, 32, 49, 44, 32, 116, 104, 105, 115, 46, 108, 101, 110, 103, 116, 104, 41, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 46, 103, 101, 116, 65, 116, 40, 111, 102, 102, 115, 101, 116, 41, 59, 10, 125, 59, 10, 10, 10, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 114, 101, 97, 100, 85, 73, 110, 116, 49, 54, 76, 69, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 111, 102, 102, 115, 101, 116, 44, 32, 110, 111, 65, 115, 115, 101, 114, 116, 41, 32, 123, 10, 32, 32, 111, 102, 102, 115, 101, 116, 32, 61, 32, 111, 102, 102, 115, 101, 116, 32, 62, 62, 62, 32, 48, 59, 10, 32, 32, 105, 102, 32, 40, 33, 110, 111, 65, 115, 115, 101, 114, 116, 41, 10, 32, 32, 32, 32, 99, 104, 101, 99, 107, 79, 102, 102, 115, 101, 116, 40, 111, 102, 102, 115, 101, 116, 44, 32, 50, 44, 32, 116, 104, 105, 115, 46, 108, 101, 110, 103, 116, 104, 41, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 46, 103, 101, 116, 65, 116, 40, 111, 102, 102, 115, 101, 116, 41, 32, 124, 32, 40, 116, 104, 105, 115, 46, 103, 101, 116, 65, 116, 40, 111, 102, 102, 115, 101, 116, 32, 43, 32, 49, 41, 32, 60, 60, 32, 56, 41, 59, 10, 125, 59, 10, 10, 10, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 114, 101, 97, 100, 85, 73, 110, 116, 49, 54, 66, 69, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 111, 102, 102, 115, 101, 116, 44, 32, 110, 111, 65, 115, 115, 101, 114, 116, 41, 32, 123, 10, 32, 32, 111, 102, 102, 115, 101, 116, 32, 61, 32, 111, 102, 102, 115, 101, 116, 32, 62, 62, 62, 32, 48, 59, 10, 32, 32, 105, 102, 32, 40, 33, 110, 111, 65, 115, 115, 101, 114, 116, 41, 10, 32, 32, 32, 32, 99, 104, 101, 99, 107, 79, 102, 102, 115, 101, 116, 40, 111, 102, 102, 115, 101, 116, 44, 32, 50, 44, 32, 116, 104, 105, 115, 46, 108, 101, 110, 103, 116, 104, 41, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 40, 116, 104, 105, 115, 46, 103, 101, 116, 65, 116, 40, 111, 102, 102, 115, 101, 116, 41, 32, 60, 60, 32, 56, 41, 32, 124, 32, 116, 104, 105, 115, 46, 103, 101, 116, 65, 116, 40, 111, 102, 102, 115, 101, 116, 32, 43, 32, 49, 41, 59, 10, 125, 59, 10, 10, 10, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 114, 101, 97, 100, 85, 73, 110, 116, 51, 50, 76, 69, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 111, 102, 102, 115, 101, 116, 44, 32, 110, 111, 65, 115, 115, 101, 114, 116, 41, 32, 123, 10, 32, 32, 111, 102, 102, 115, 101, 116, 32, 61, 32, 111, 102, 102, 115, 101, 116, 32, 62, 62, 62, 32, 48, 59, 10, 32, 32, 105, 102, 32, 40, 33, 110, 111, 65, 115, 115, 101, 114, 116, 41, 10, 32, 32, 32, 32, 99, 104, 101, 99, 107, 79, 102, 102, 115, 101, 116, 40, 111, 102, 102, 115, 101, 116, 44, 32, 52, 44, 32, 116, 104, 105, 115, 46, 108, 101, 110, 103, 116, 104, 41, 59, 10, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 40, 40, 116, 104, 105, 115, 46, 103, 101, 116, 65, 116, 40, 111, 102, 102, 115, 101, 116, 41, 41, 32, 124, 10, 32, 32, 32, 32, 32, 32, 40, 116, 104, 105, 115, 46, 103, 101, 116, 65, 116, 40, 111, 102, 102, 115, 101, 116, 32, 43, 32, 49, 41, 32, 60, 60, 32, 56, 41, 32, 124, 10, 32, 32, 32, 32, 32, 32, 40, 116, 104, 105, 115, 46, 103, 101, 116, 65, 116, 40, 111, 102, 102, 115, 101, 116, 32, 43, 32, 50, 41, 32, 60, 60, 32, 49, 54, 41, 41, 32, 43, 10, 32, 32, 32, 32, 32, 32, 40, 116, 104, 105, 115, 46, 103, 101, 116, 65, 116, 40, 111, 102, 102, 115, 101, 116, 32, 43, 32, 51, 41, 32, 42, 32, 48, 120, 49, 48, 48, 48, 48, 48, 48, 41, 59, 10, 125, 59, 10, 10, 10, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 114, 101, 97, 100, 85, 73, 110, 116, 51, 50, 66, 69, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 111, 102, 102, 115, 101, 116, 44, 32, 110, 111, 65, 115, 115, 101, 114, 116, 41, 32, 123, 10, 32, 32, 111, 102, 102, 115, 101, 116, 32, 61, 32, 111, 102, 102, 115, 101, 116, 32, 62, 62, 62, 32, 48, 59, 10, 32, 32, 105, 102, 32, 40, 33, 110, 111, 65, 115, 115, 101, 114, 116, 41, 10, 32, 32, 32, 32, 99, 104, 101, 99, 107, 79, 102, 102, 115, 101, 116, 40, 111, 102, 102, 115, 101, 116, 44, 32, 52, 44, 32, 116, 104, 105, 115, 46, 108, 101, 110, 103, 116, 104, 41, 59, 10, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 40, 116, 104, 105, 115, 46, 103, 101, 116, 65, 116, 40, 111, 102, 102, 115, 101, 116, 41, 32, 42, 32, 48, 120, 49, 48, 48, 48, 48, 48, 48, 41, 32, 43, 10, 32, 32, 32, 32, 32, 32, 32, 32, 40, 40, 116, 104, 105, 115, 46, 103, 101, 116, 65, 116, 40, 111, 102, 102, 115, 101, 116, 32, 43, 32, 49, 41, 32, 60, 60, 32, 49, 54, 41, 32, 124, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 40, 116, 104, 105, 115, 46, 103, 101, 116, 65, 116, 40, 111, 102, 102, 115, 101, 116, 32, 43, 32, 50, 41, 32, 60, 60, 32, 56, 41, 32, 124, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 116, 104, 105, 115, 46, 103, 101, 116, 65, 116, 40, 111, 102, 102, 115, 101, 116, 32, 43, 32, 51, 41, 41, 59, 10, 125, 59, 10, 10, 10, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 114, 101, 97, 100, 73, 110, 116, 76, 69, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 111, 102, 102, 115, 101, 116, 44, 32, 98, 121, 116, 101, 76, 101, 110, 103, 116, 104, 44, 32, 110, 111, 65, 115, 115, 101, 114, 116, 41, 32, 123, 10, 32, 32, 111, 102, 102, 115, 101, 116, 32, 61, 32, 111, 102, 102, 115, 101, 116, 32, 62, 62, 62, 32, 48, 59, 10, 32, 32, 98, 121, 116, 101, 76, 101, 110, 103, 116, 104, 32, 61, 32, 98, 121, 116, 101, 76, 101, 110, 103, 116, 104, 32, 62, 62, 62, 32, 48, 59, 10, 32, 32, 105, 102, 32, 40, 33, 110, 111, 65, 115, 115, 101, 114, 116, 41, 10, 32, 32, 32, 32, 99, 104, 101, 99, 107, 79, 102, 102, 115, 101, 116, 40, 111, 102, 102, 115, 101, 116, 44, 32, 98, 121, 116, 101, 76, 101, 110, 103, 116, 104, 44, 32, 116, 104, 105, 115, 46, 108, 101, 110, 103, 116, 104, 41, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 98, 105, 110, 100, 105, 110, 103, 46, 114, 101, 97, 100, 73, 110, 116, 76, 69, 40, 116, 104, 105, 115, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 98, 121, 116, 101, 76, 101, 110, 103, 116, 104, 41, 59, 10, 125, 59, 10, 10, 10, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 114, 101, 97, 100, 73, 110, 116, 66, 69, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 111, 102, 102, 115, 101, 116, 44, 32, 98, 121, 116, 101, 76, 101, 110, 103, 116, 104, 44, 32, 110, 111, 65, 115, 115, 101, 114, 116, 41, 32, 123, 10, 32, 32, 111, 102, 102, 115, 101, 116, 32, 61, 32, 111, 102, 102, 115, 101, 116, 32, 62, 62, 62, 32, 48, 59, 10, 32, 32, 98, 121, 116, 101, 76, 101, 110, 103, 116, 104, 32, 61, 32, 98, 121, 116, 101, 76, 101, 110, 103, 116, 104, 32, 62, 62, 62, 32, 48, 59, 10, 32, 32, 105, 102, 32, 40, 33, 110, 111, 65, 115, 115, 101, 114, 116, 41, 10, 32, 32, 32, 32, 99, 104, 101, 99, 107, 79, 102, 102, 115, 101, 116, 40, 111, 102, 102, 115, 101, 116, 44, 32, 98, 121, 116, 101, 76, 101, 110, 103, 116, 104, 44, 32, 116, 104, 105, 115, 46, 108, 101, 110, 103, 116, 104, 41, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 98, 105, 110, 100, 105, 110, 103, 46, 114, 101, 97, 100, 73, 110, 116, 66, 69, 40, 116, 104, 105, 115, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 98, 121, 116, 101, 76, 101, 110, 103, 116, 104, 41, 59, 10, 125, 59, 10, 10, 10, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 114, 101, 97, 100, 73, 110, 116, 56, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 111, 102, 102, 115, 101, 116, 44, 32, 110, 111, 65, 115, 115, 101, 114, 116, 41, 32, 123, 10, 32, 32, 111, 102, 102, 115, 101, 116, 32, 61, 32, 111, 102, 102, 115, 101, 116, 32, 62, 62, 62, 32, 48, 59, 10, 32, 32, 105, 102, 32, 40, 33, 110, 111, 65, 115, 115, 101, 114, 116, 41, 10, 32, 32, 32, 32, 99, 104, 101, 99, 107, 79, 102, 102, 115, 101, 116, 40, 111, 102, 102, 115, 101, 116, 44, 32, 49, 44, 32, 116, 104, 105, 115, 46, 108, 101, 110, 103, 116, 104, 41, 59, 10, 32, 32, 118, 97, 114, 32, 118, 97, 108, 32, 61, 32, 116, 104, 105, 115, 46, 103, 101, 116, 65, 116, 40, 111, 102, 102, 115, 101, 116, 41, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 33, 40, 118, 97, 108, 32, 38, 32, 48, 120, 56, 48, 41, 32, 63, 32, 118, 97, 108, 32, 58, 32, 40, 48, 120, 102, 102, 32, 45, 32, 118, 97, 108, 32, 43, 32, 49, 41, 32, 42, 32, 45, 49, 59, 10, 125, 59, 10, 10, 10, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 114, 101, 97, 100, 73, 110, 116, 49, 54, 76, 69, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 111, 102, 102, 115, 101, 116, 44, 32, 110, 111, 65, 115, 115, 101, 114, 116, 41, 32, 123, 10, 32, 32, 111, 102, 102, 115, 101, 116, 32, 61, 32, 111, 102, 102, 115, 101, 116, 32, 62, 62, 62, 32, 48, 59, 10, 32, 32, 105, 102, 32, 40, 33, 110, 111, 65, 115, 115, 101, 114, 116, 41, 10, 32, 32, 32, 32, 99, 104, 101, 99, 107, 79, 102, 102, 115, 101, 116, 40, 111, 102, 102, 115, 101, 116, 44, 32, 50, 44, 32, 116, 104, 105, 115, 46, 108, 101, 110, 103, 116, 104, 41, 59, 10, 32, 32, 118, 97, 114, 32, 118, 97, 108, 32, 61, 32, 116, 104, 105, 115, 46, 103, 101, 116, 65, 116, 40, 111, 102, 102, 115, 101, 116, 41, 32, 124, 32, 40, 116, 104, 105, 115, 46, 103, 101, 116, 65, 116, 40, 111, 102, 102, 115, 101, 116, 32, 43, 32, 49, 41, 32, 60, 60, 32, 56, 41, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 40, 118, 97, 108, 32, 38, 32, 48, 120, 56, 48, 48, 48, 41, 32, 63, 32, 118, 97, 108, 32, 124, 32, 48, 120, 70, 70, 70, 70, 48, 48, 48, 48, 32, 58, 32, 118, 97, 108, 59, 10, 125, 59, 10, 10, 10, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 114, 101, 97, 100, 73, 110, 116, 49, 54, 66, 69, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 111, 102, 102, 115, 101, 116, 44, 32, 110, 111, 65, 115, 115, 101, 114, 116, 41, 32, 123, 10, 32, 32, 111, 102, 102, 115, 101, 116, 32, 61, 32, 111, 102, 102, 115, 101, 116, 32, 62, 62, 62, 32, 48, 59, 10, 32, 32, 105, 102, 32, 40, 33, 110, 111, 65, 115, 115, 101, 114, 116, 41, 10, 32, 32, 32, 32, 99, 104, 101, 99, 107, 79, 102, 102, 115, 101, 116, 40, 111, 102, 102, 115, 101, 116, 44, 32, 50, 44, 32, 116, 104, 105, 115, 46, 108, 101, 110, 103, 116, 104, 41, 59, 10, 32, 32, 118, 97, 114, 32, 118, 97, 108, 32, 61, 32, 116, 104, 105, 115, 46, 103, 101, 116, 65, 116, 40, 111, 102, 102, 115, 101, 116, 32, 43, 32, 49, 41, 32, 124, 32, 40, 116, 104, 105, 115, 46, 103, 101, 116, 65, 116, 40, 111, 102, 102, 115, 101, 116, 41, 32, 60, 60, 32, 56, 41, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 40, 118, 97, 108, 32, 38, 32, 48, 120, 56, 48, 48, 48, 41, 32, 63, 32, 118, 97, 108, 32, 124, 32, 48, 120, 70, 70, 70, 70, 48, 48, 48, 48, 32, 58, 32, 118, 97, 108, 59, 10, 125, 59, 10, 10, 10, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 114, 101, 97, 100, 73, 110, 116, 51, 50, 76, 69, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 111, 102, 102, 115, 101, 116, 44, 32, 110, 111, 65, 115, 115, 101, 114, 116, 41, 32, 123, 10, 32, 32, 111, 102, 102, 115, 101, 116, 32, 61, 32, 111, 102, 102, 115, 101, 116, 32, 62, 62, 62, 32, 48, 59, 10, 32, 32, 105, 102, 32, 40, 33, 110, 111, 65, 115, 115, 101, 114, 116, 41, 10, 32, 32, 32, 32, 99, 104, 101, 99, 107, 79, 102, 102, 115, 101, 116, 40, 111, 102, 102, 115, 101, 116, 44, 32, 52, 44, 32, 116, 104, 105, 115, 46, 108, 101, 110, 103, 116, 104, 41, 59, 10, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 40, 116, 104, 105, 115, 46, 103, 101, 116, 65, 116, 40, 111, 102, 102, 115, 101, 116, 41, 41, 32, 124, 10, 32, 32, 32, 32, 32, 32, 40, 116, 104, 105, 115, 46, 103, 101, 116, 65, 116, 40, 111, 102, 102, 115, 101, 116, 32, 43, 32, 49, 41, 32, 60, 60, 32, 56, 41, 32, 124, 10, 32, 32, 32, 32, 32, 32, 40, 116, 104, 105, 115, 46, 103, 101, 116, 65, 116, 40, 111, 102, 102, 115, 101, 116, 32, 43, 32, 50, 41, 32, 60, 60, 32, 49, 54, 41, 32, 124, 10, 32, 32, 32, 32, 32, 32, 40, 116, 104, 105, 115, 46, 103, 101, 116, 65, 116, 40, 111, 102, 102, 115, 101, 116, 32, 43, 32, 51, 41, 32, 60, 60, 32, 50, 52, 41, 59, 10, 125, 59, 10, 10, 10, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 114, 101, 97, 100, 73, 110, 116, 51, 50, 66, 69, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 111, 102, 102, 115, 101, 116, 44, 32, 110, 111, 65, 115, 115, 101, 114, 116, 41, 32, 123, 10, 32, 32, 111, 102, 102, 115, 101, 116, 32, 61, 32, 111, 102, 102, 115, 101, 116, 32, 62, 62, 62, 32, 48, 59, 10, 32, 32, 105, 102, 32, 40, 33, 110, 111, 65, 115, 115, 101, 114, 116, 41, 10, 32, 32, 32, 32, 99, 104, 101, 99, 107, 79, 102, 102, 115, 101, 116, 40, 111, 102, 102, 115, 101, 116, 44, 32, 52, 44, 32, 116, 104, 105, 115, 46, 108, 101, 110, 103, 116, 104, 41, 59, 10, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 40, 116, 104, 105, 115, 46, 103, 101, 116, 65, 116, 40, 111, 102, 102, 115, 101, 116, 41, 32, 60, 60, 32, 50, 52, 41, 32, 124, 10, 32, 32, 32, 32, 32, 32, 40, 116, 104, 105, 115, 46, 103, 101, 116, 65, 116, 40, 111, 102, 102, 115, 101, 116, 32, 43, 32, 49, 41, 32, 60, 60, 32, 49, 54, 41, 32, 124, 10, 32, 32, 32, 32, 32, 32, 40, 116, 104, 105, 115, 46, 103, 101, 116, 65, 116, 40, 111, 102, 102, 115, 101, 116, 32, 43, 32, 50, 41, 32, 60, 60, 32, 56, 41, 32, 124, 10, 32, 32, 32, 32, 32, 32, 40, 116, 104, 105, 115, 46, 103, 101, 116, 65, 116, 40, 111, 102, 102, 115, 101, 116, 32, 43, 32, 51, 41, 41, 59, 10, 125, 59, 10, 10, 10, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 114, 101, 97, 100, 70, 108, 111, 97, 116, 76, 69, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 32, 114, 101, 97, 100, 70, 108, 111, 97, 116, 76, 69, 40, 111, 102, 102, 115, 101, 116, 44, 32, 110, 111, 65, 115, 115, 101, 114, 116, 41, 32, 123, 10, 32, 32, 111, 102, 102, 115, 101, 116, 32, 61, 32, 111, 102, 102, 115, 101, 116, 32, 62, 62, 62, 32, 48, 59, 10, 32, 32, 105, 102, 32, 40, 33, 110, 111, 65, 115, 115, 101, 114, 116, 41, 10, 32, 32, 32, 32, 99, 104, 101, 99, 107, 79, 102, 102, 115, 101, 116, 40, 111, 102, 102, 115, 101, 116, 44, 32, 52, 44, 32, 116, 104, 105, 115, 46, 108, 101, 110, 103, 116, 104, 41, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 98, 105, 110, 100, 105, 110, 103, 46, 114, 101, 97, 100, 70, 108, 111, 97, 116, 76, 69, 40, 116, 104, 105, 115, 44, 32, 111, 102, 102, 115, 101, 116, 41, 59, 10, 125, 59, 10, 10, 10, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 114, 101, 97, 100, 70, 108, 111, 97, 116, 66, 69, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 32, 114, 101, 97, 100, 70, 108, 111, 97, 116, 66, 69, 40, 111, 102, 102, 115, 101, 116, 44, 32, 110, 111, 65, 115, 115, 101, 114, 116, 41, 32, 123, 10, 32, 32, 111, 102, 102, 115, 101, 116, 32, 61, 32, 111, 102, 102, 115, 101, 116, 32, 62, 62, 62, 32, 48, 59, 10, 32, 32, 105, 102, 32, 40, 33, 110, 111, 65, 115, 115, 101, 114, 116, 41, 10, 32, 32, 32, 32, 99, 104, 101, 99, 107, 79, 102, 102, 115, 101, 116, 40, 111, 102, 102, 115, 101, 116, 44, 32, 52, 44, 32, 116, 104, 105, 115, 46, 108, 101, 110, 103, 116, 104, 41, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 98, 105, 110, 100, 105, 110, 103, 46, 114, 101, 97, 100, 70, 108, 111, 97, 116, 66, 69, 40, 116, 104, 105, 115, 44, 32, 111, 102, 102, 115, 101, 116, 41, 59, 10, 125, 59, 10, 10, 10, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 114, 101, 97, 100, 68, 111, 117, 98, 108, 101, 76, 69, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 32, 114, 101, 97, 100, 68, 111, 117, 98, 108, 101, 76, 69, 40, 111, 102, 102, 115, 101, 116, 44, 32, 110, 111, 65, 115, 115, 101, 114, 116, 41, 32, 123, 10, 32, 32, 111, 102, 102, 115, 101, 116, 32, 61, 32, 111, 102, 102, 115, 101, 116, 32, 62, 62, 62, 32, 48, 59, 10, 32, 32, 105, 102, 32, 40, 33, 110, 111, 65, 115, 115, 101, 114, 116, 41, 10, 32, 32, 32, 32, 99, 104, 101, 99, 107, 79, 102, 102, 115, 101, 116, 40, 111, 102, 102, 115, 101, 116, 44, 32, 56, 44, 32, 116, 104, 105, 115, 46, 108, 101, 110, 103, 116, 104, 41, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 98, 105, 110, 100, 105, 110, 103, 46, 114, 101, 97, 100, 68, 111, 117, 98, 108, 101, 76, 69, 40, 116, 104, 105, 115, 44, 32, 111, 102, 102, 115, 101, 116, 41, 59, 10, 125, 59, 10, 10, 10, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 114, 101, 97, 100, 68, 111, 117, 98, 108, 101, 66, 69, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 32, 114, 101, 97, 100, 68, 111, 117, 98, 108, 101, 66, 69, 40, 111, 102, 102, 115, 101, 116, 44, 32, 110, 111, 65, 115, 115, 101, 114, 116, 41, 32, 123, 10, 32, 32, 111, 102, 102, 115, 101, 116, 32, 61, 32, 111, 102, 102, 115, 101, 116, 32, 62, 62, 62, 32, 48, 59, 10, 32, 32, 105, 102, 32, 40, 33, 110, 111, 65, 115, 115, 101, 114, 116, 41, 10, 32, 32, 32, 32, 99, 104, 101, 99, 107, 79, 102, 102, 115, 101, 116, 40, 111, 102, 102, 115, 101, 116, 44, 32, 56, 44, 32, 116, 104, 105, 115, 46, 108, 101, 110, 103, 116, 104, 41, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 98, 105, 110, 100, 105, 110, 103, 46, 114, 101, 97, 100, 68, 111, 117, 98, 108, 101, 66, 69, 40, 116, 104, 105, 115, 44, 32, 111, 102, 102, 115, 101, 116, 41, 59, 10, 125, 59, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 99, 104, 101, 99, 107, 73, 110, 116, 40, 98, 117, 102, 102, 101, 114, 44, 32, 118, 97, 108, 117, 101, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 101, 120, 116, 44, 32, 109, 97, 120, 44, 32, 109, 105, 110, 41, 32, 123, 10, 32, 32, 105, 102, 32, 40, 33, 40, 98, 117, 102, 102, 101, 114, 32, 105, 110, 115, 116, 97, 110, 99, 101, 111, 102, 32, 66, 117, 102, 102, 101, 114, 41, 41, 10, 32, 32, 32, 32, 116, 104, 114, 111, 119, 32, 110, 101, 119, 32, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 98, 117, 102, 102, 101, 114, 32, 109, 117, 115, 116, 32, 98, 101, 32, 97, 32, 66, 117, 102, 102, 101, 114, 32, 105, 110, 115, 116, 97, 110, 99, 101, 39, 41, 59, 10, 32, 32, 105, 102, 32, 40, 118, 97, 108, 117, 101, 32, 62, 32, 109, 97, 120, 32, 124, 124, 32, 118, 97, 108, 117, 101, 32, 60, 32, 109, 105, 110, 41, 10, 32, 32, 32, 32, 116, 104, 114, 111, 119, 32, 110, 101, 119, 32, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 118, 97, 108, 117, 101, 32, 105, 115, 32, 111, 117, 116, 32, 111, 102, 32, 98, 111, 117, 110, 100, 115, 39, 41, 59, 10, 32, 32, 105, 102, 32, 40, 111, 102, 102, 115, 101, 116, 32, 43, 32, 101, 120, 116, 32, 62, 32, 98, 117, 102, 102, 101, 114, 46, 108, 101, 110, 103, 116, 104, 41, 10, 32, 32, 32, 32, 116, 104, 114, 111, 119, 32, 110, 101, 119, 32, 82, 97, 110, 103, 101, 69, 114, 114, 111, 114, 40, 39, 105, 110, 100, 101, 120, 32, 111, 117, 116, 32, 111, 102, 32, 114, 97, 110, 103, 101, 39, 41, 59, 10, 125, 10, 10, 10, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 119, 114, 105, 116, 101, 85, 73, 110, 116, 76, 69, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 118, 97, 108, 117, 101, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 98, 121, 116, 101, 76, 101, 110, 103, 116, 104, 44, 32, 110, 111, 65, 115, 115, 101, 114, 116, 41, 32, 123, 10, 32, 32, 118, 97, 108, 117, 101, 32, 61, 32, 43, 118, 97, 108, 117, 101, 59, 10, 32, 32, 111, 102, 102, 115, 101, 116, 32, 61, 32, 111, 102, 102, 115, 101, 116, 32, 62, 62, 62, 32, 48, 59, 10, 32, 32, 98, 121, 116, 101, 76, 101, 110, 103, 116, 104, 32, 61, 32, 98, 121, 116, 101, 76, 101, 110, 103, 116, 104, 32, 62, 62, 62, 32, 48, 59, 10, 32, 32, 105, 102, 32, 40, 33, 110, 111, 65, 115, 115, 101, 114, 116, 41, 32, 123, 10, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 109, 97, 120, 66, 121, 116, 101, 115, 32, 61, 32, 77, 97, 116, 104, 46, 112, 111, 119, 40, 50, 44, 32, 56, 32, 42, 32, 98, 121, 116, 101, 76, 101, 110, 103, 116, 104, 41, 32, 45, 32, 49, 59, 10, 32, 32, 32, 32, 99, 104, 101, 99, 107, 73, 110, 116, 40, 116, 104, 105, 115, 44, 32, 118, 97, 108, 117, 101, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 98, 121, 116, 101, 76, 101, 110, 103, 116, 104, 44, 32, 109, 97, 120, 66, 121, 116, 101, 115, 44, 32, 48, 41, 59, 10, 32, 32, 125, 10, 32, 32, 98, 105, 110, 100, 105, 110, 103, 46, 119, 114, 105, 116, 101, 73, 110, 116, 76, 69, 40, 116, 104, 105, 115, 44, 32, 118, 97, 108, 117, 101, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 98, 121, 116, 101, 76, 101, 110, 103, 116, 104, 41, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 111, 102, 102, 115, 101, 116, 32, 43, 32, 98, 121, 116, 101, 76, 101, 110, 103, 116, 104, 59, 10, 125, 59, 10, 10, 10, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 119, 114, 105, 116, 101, 85, 73, 110, 116, 66, 69, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 118, 97, 108, 117, 101, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 98, 121, 116, 101, 76, 101, 110, 103, 116, 104, 44, 32, 110, 111, 65, 115, 115, 101, 114, 116, 41, 32, 123, 10, 32, 32, 118, 97, 108, 117, 101, 32, 61, 32, 43, 118, 97, 108, 117, 101, 59, 10, 32, 32, 111, 102, 102, 115, 101, 116, 32, 61, 32, 111, 102, 102, 115, 101, 116, 32, 62, 62, 62, 32, 48, 59, 10, 32, 32, 98, 121, 116, 101, 76, 101, 110, 103, 116, 104, 32, 61, 32, 98, 121, 116, 101, 76, 101, 110, 103, 116, 104, 32, 62, 62, 62, 32, 48, 59, 10, 32, 32, 105, 102, 32, 40, 33, 110, 111, 65, 115, 115, 101, 114, 116, 41, 32, 123, 10, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 109, 97, 120, 66, 121, 116, 101, 115, 32, 61, 32, 77, 97, 116, 104, 46, 112, 111, 119, 40, 50, 44, 32, 56, 32, 42, 32, 98, 121, 116, 101, 76, 101, 110, 103, 116, 104, 41, 32, 45, 32, 49, 59, 10, 32, 32, 32, 32, 99, 104, 101, 99, 107, 73, 110, 116, 40, 116, 104, 105, 115, 44, 32, 118, 97, 108, 117, 101, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 98, 121, 116, 101, 76, 101, 110, 103, 116, 104, 44, 32, 109, 97, 120, 66, 121, 116, 101, 115, 44, 32, 48, 41, 59, 10, 32, 32, 125, 10, 32, 32, 98, 105, 110, 100, 105, 110, 103, 46, 119, 114, 105, 116, 101, 73, 110, 116, 66, 69, 40, 116, 104, 105, 115, 44, 32, 118, 97, 108, 117, 101, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 98, 121, 116, 101, 76, 101, 110, 103, 116, 104, 41, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 111, 102, 102, 115, 101, 116, 32, 43, 32, 98, 121, 116, 101, 76, 101, 110, 103, 116, 104, 59, 10, 125, 59, 10, 10, 10, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 119, 114, 105, 116, 101, 85, 73, 110, 116, 56, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 118, 97, 108, 117, 101, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 110, 111, 65, 115, 115, 101, 114, 116, 41, 32, 123, 10, 32, 32, 118, 97, 108, 117, 101, 32, 61, 32, 43, 118, 97, 108, 117, 101, 59, 10, 32, 32, 111, 102, 102, 115, 101, 116, 32, 61, 32, 111, 102, 102, 115, 101, 116, 32, 62, 62, 62, 32, 48, 59, 10, 32, 32, 105, 102, 32, 40, 33, 110, 111, 65, 115, 115, 101, 114, 116, 41, 10, 32, 32, 32, 32, 99, 104, 101, 99, 107, 73, 110, 116, 40, 116, 104, 105, 115, 44, 32, 118, 97, 108, 117, 101, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 49, 44, 32, 48, 120, 102, 102, 44, 32, 48, 41, 59, 10, 32, 32, 116, 104, 105, 115, 46, 115, 101, 116, 65, 116, 40, 111, 102, 102, 115, 101, 116, 44, 32, 118, 97, 108, 117, 101, 41, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 111, 102, 102, 115, 101, 116, 32, 43, 32, 49, 59, 10, 125, 59, 10, 10, 10, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 119, 114, 105, 116, 101, 85, 73, 110, 116, 49, 54, 76, 69, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 118, 97, 108, 117, 101, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 110, 111, 65, 115, 115, 101, 114, 116, 41, 32, 123, 10, 32, 32, 118, 97, 108, 117, 101, 32, 61, 32, 43, 118, 97, 108, 117, 101, 59, 10, 32, 32, 111, 102, 102, 115, 101, 116, 32, 61, 32, 111, 102, 102, 115, 101, 116, 32, 62, 62, 62, 32, 48, 59, 10, 32, 32, 105, 102, 32, 40, 33, 110, 111, 65, 115, 115, 101, 114, 116, 41, 10, 32, 32, 32, 32, 99, 104, 101, 99, 107, 73, 110, 116, 40, 116, 104, 105, 115, 44, 32, 118, 97, 108, 117, 101, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 50, 44, 32, 48, 120, 102, 102, 102, 102, 44, 32, 48, 41, 59, 10, 32, 32, 116, 104, 105, 115, 46, 115, 101, 116, 65, 116, 40, 111, 102, 102, 115, 101, 116, 44, 32, 32, 32, 32, 32, 118, 97, 108, 117, 101, 41, 59, 10, 32, 32, 116, 104, 105, 115, 46, 115, 101, 116, 65, 116, 40, 111, 102, 102, 115, 101, 116, 32, 43, 32, 49, 44, 32, 118, 97, 108, 117, 101, 32, 62, 62, 62, 32, 56, 41, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 111, 102, 102, 115, 101, 116, 32, 43, 32, 50, 59, 10, 125, 59, 10, 10, 10, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 119, 114, 105, 116, 101, 85, 73, 110, 116, 49, 54, 66, 69, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 118, 97, 108, 117, 101, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 110, 111, 65, 115, 115, 101, 114, 116, 41, 32, 123, 10, 32, 32, 118, 97, 108, 117, 101, 32, 61, 32, 43, 118, 97, 108, 117, 101, 59, 10, 32, 32, 111, 102, 102, 115, 101, 116, 32, 61, 32, 111, 102, 102, 115, 101, 116, 32, 62, 62, 62, 32, 48, 59, 10, 32, 32, 105, 102, 32, 40, 33, 110, 111, 65, 115, 115, 101, 114, 116, 41, 10, 32, 32, 32, 32, 99, 104, 101, 99, 107, 73, 110, 116, 40, 116, 104, 105, 115, 44, 32, 118, 97, 108, 117, 101, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 50, 44, 32, 48, 120, 102, 102, 102, 102, 44, 32, 48, 41, 59, 10, 32, 32, 116, 104, 105, 115, 46, 115, 101, 116, 65, 116, 40, 111, 102, 102, 115, 101, 116, 44, 32, 32, 32, 32, 32, 118, 97, 108, 117, 101, 32, 62, 62, 62, 32, 56, 41, 59, 10, 32, 32, 116, 104, 105, 115, 46, 115, 101, 116, 65, 116, 40, 111, 102, 102, 115, 101, 116, 32, 43, 32, 49, 44, 32, 118, 97, 108, 117, 101, 41, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 111, 102, 102, 115, 101, 116, 32, 43, 32, 50, 59, 10, 125, 59, 10, 10, 10, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 119, 114, 105, 116, 101, 85, 73, 110, 116, 51, 50, 76, 69, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 118, 97, 108, 117, 101, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 110, 111, 65, 115, 115, 101, 114, 116, 41, 32, 123, 10, 32, 32, 118, 97, 108, 117, 101, 32, 61, 32, 43, 118, 97, 108, 117, 101, 59, 10, 32, 32, 111, 102, 102, 115, 101, 116, 32, 61, 32, 111, 102, 102, 115, 101, 116, 32, 62, 62, 62, 32, 48, 59, 10, 32, 32, 105, 102, 32, 40, 33, 110, 111, 65, 115, 115, 101, 114, 116, 41, 10, 32, 32, 32, 32, 99, 104, 101, 99, 107, 73, 110, 116, 40, 116, 104, 105, 115, 44, 32, 118, 97, 108, 117, 101, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 52, 44, 32, 48, 120, 102, 102, 102, 102, 102, 102, 102, 102, 44, 32, 48, 41, 59, 10, 32, 32, 116, 104, 105, 115, 46, 115, 101, 116, 65, 116, 40, 111, 102, 102, 115, 101, 116, 32, 43, 32, 51, 44, 32, 118, 97, 108, 117, 101, 32, 62, 62, 62, 32, 50, 52, 41, 59, 10, 32, 32, 116, 104, 105, 115, 46, 115, 101, 116, 65, 116, 40, 111, 102, 102, 115, 101, 116, 32, 43, 32, 50, 44, 32, 118, 97, 108, 117, 101, 32, 62, 62, 62, 32, 49, 54, 41, 59, 10, 32, 32, 116, 104, 105, 115, 46, 115, 101, 116, 65, 116, 40, 111, 102, 102, 115, 101, 116, 32, 43, 32, 49, 44, 32, 118, 97, 108, 117, 101, 32, 62, 62, 62, 32, 56, 41, 59, 10, 32, 32, 116, 104, 105, 115, 46, 115, 101, 116, 65, 116, 40, 111, 102, 102, 115, 101, 116, 44, 32, 32, 32, 32, 32, 118, 97, 108, 117, 101, 41, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 111, 102, 102, 115, 101, 116, 32, 43, 32, 52, 59, 10, 125, 59, 10, 10, 10, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 119, 114, 105, 116, 101, 85, 73, 110, 116, 51, 50, 66, 69, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 118, 97, 108, 117, 101, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 110, 111, 65, 115, 115, 101, 114, 116, 41, 32, 123, 10, 32, 32, 118, 97, 108, 117, 101, 32, 61, 32, 43, 118, 97, 108, 117, 101, 59, 10, 32, 32, 111, 102, 102, 115, 101, 116, 32, 61, 32, 111, 102, 102, 115, 101, 116, 32, 62, 62, 62, 32, 48, 59, 10, 32, 32, 105, 102, 32, 40, 33, 110, 111, 65, 115, 115, 101, 114, 116, 41, 10, 32, 32, 32, 32, 99, 104, 101, 99, 107, 73, 110, 116, 40, 116, 104, 105, 115, 44, 32, 118, 97, 108, 117, 101, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 52, 44, 32, 48, 120, 102, 102, 102, 102, 102, 102, 102, 102, 44, 32, 48, 41, 59, 10, 32, 32, 116, 104, 105, 115, 46, 115, 101, 116, 65, 116, 40, 111, 102, 102, 115, 101, 116, 44, 32, 32, 32, 32, 32, 118, 97, 108, 117, 101, 32, 62, 62, 62, 32, 50, 52, 41, 59, 10, 32, 32, 116, 104, 105, 115, 46, 115, 101, 116, 65, 116, 40, 111, 102, 102, 115, 101, 116, 32, 43, 32, 49, 44, 32, 118, 97, 108, 117, 101, 32, 62, 62, 62, 32, 49, 54, 41, 59, 10, 32, 32, 116, 104, 105, 115, 46, 115, 101, 116, 65, 116, 40, 111, 102, 102, 115, 101, 116, 32, 43, 32, 50, 44, 32, 118, 97, 108, 117, 101, 32, 62, 62, 62, 32, 56, 41, 59, 10, 32, 32, 116, 104, 105, 115, 46, 115, 101, 116, 65, 116, 40, 111, 102, 102, 115, 101, 116, 32, 43, 32, 51, 44, 32, 118, 97, 108, 117, 101, 41, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 111, 102, 102, 115, 101, 116, 32, 43, 32, 52, 59, 10, 125, 59, 10, 10, 10, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 119, 114, 105, 116, 101, 73, 110, 116, 76, 69, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 118, 97, 108, 117, 101, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 98, 121, 116, 101, 76, 101, 110, 103, 116, 104, 44, 32, 110, 111, 65, 115, 115, 101, 114, 116, 41, 32, 123, 10, 32, 32, 118, 97, 108, 117, 101, 32, 61, 32, 43, 118, 97, 108, 117, 101, 59, 10, 32, 32, 111, 102, 102, 115, 101, 116, 32, 61, 32, 111, 102, 102, 115, 101, 116, 32, 62, 62, 62, 32, 48, 59, 10, 32, 32, 98, 121, 116, 101, 76, 101, 110, 103, 116, 104, 32, 61, 32, 98, 121, 116, 101, 76, 101, 110, 103, 116, 104, 32, 62, 62, 62, 32, 48, 59, 10, 32, 32, 105, 102, 32, 40, 33, 110, 111, 65, 115, 115, 101, 114, 116, 41, 32, 123, 10, 32, 32, 32, 32, 99, 104, 101, 99, 107, 73, 110, 116, 40, 116, 104, 105, 115, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 118, 97, 108, 117, 101, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 111, 102, 102, 115, 101, 116, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 98, 121, 116, 101, 76, 101, 110, 103, 116, 104, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 77, 97, 116, 104, 46, 112, 111, 119, 40, 50, 44, 32, 56, 32, 42, 32, 98, 121, 116, 101, 76, 101, 110, 103, 116, 104, 32, 45, 32, 49, 41, 32, 45, 32, 49, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 45, 77, 97, 116, 104, 46, 112, 111, 119, 40, 50, 44, 32, 56, 32, 42, 32, 98, 121, 116, 101, 76, 101, 110, 103, 116, 104, 32, 45, 32, 49, 41, 41, 59, 10, 32, 32, 125, 10, 32, 32, 98, 105, 110, 100, 105, 110, 103, 46, 119, 114, 105, 116, 101, 73, 110, 116, 76, 69, 40, 116, 104, 105, 115, 44, 32, 118, 97, 108, 117, 101, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 98, 121, 116, 101, 76, 101, 110, 103, 116, 104, 41, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 111, 102, 102, 115, 101, 116, 32, 43, 32, 98, 121, 116, 101, 76, 101, 110, 103, 116, 104, 59, 10, 125, 59, 10, 10, 10, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 119, 114, 105, 116, 101, 73, 110, 116, 66, 69, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 118, 97, 108, 117, 101, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 98, 121, 116, 101, 76, 101, 110, 103, 116, 104, 44, 32, 110, 111, 65, 115, 115, 101, 114, 116, 41, 32, 123, 10, 32, 32, 118, 97, 108, 117, 101, 32, 61, 32, 43, 118, 97, 108, 117, 101, 59, 10, 32, 32, 111, 102, 102, 115, 101, 116, 32, 61, 32, 111, 102, 102, 115, 101, 116, 32, 62, 62, 62, 32, 48, 59, 10, 32, 32, 98, 121, 116, 101, 76, 101, 110, 103, 116, 104, 32, 61, 32, 98, 121, 116, 101, 76, 101, 110, 103, 116, 104, 32, 62, 62, 62, 32, 48, 59, 10, 32, 32, 105, 102, 32, 40, 33, 110, 111, 65, 115, 115, 101, 114, 116, 41, 32, 123, 10, 32, 32, 32, 32, 99, 104, 101, 99, 107, 73, 110, 116, 40, 116, 104, 105, 115, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 118, 97, 108, 117, 101, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 111, 102, 102, 115, 101, 116, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 98, 121, 116, 101, 76, 101, 110, 103, 116, 104, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 77, 97, 116, 104, 46, 112, 111, 119, 40, 50, 44, 32, 56, 32, 42, 32, 98, 121, 116, 101, 76, 101, 110, 103, 116, 104, 32, 45, 32, 49, 41, 32, 45, 32, 49, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 45, 77, 97, 116, 104, 46, 112, 111, 119, 40, 50, 44, 32, 56, 32, 42, 32, 98, 121, 116, 101, 76, 101, 110, 103, 116, 104, 32, 45, 32, 49, 41, 41, 59, 10, 32, 32, 125, 10, 32, 32, 98, 105, 110, 100, 105, 110, 103, 46, 119, 114, 105, 116, 101, 73, 110, 116, 66, 69, 40, 116, 104, 105, 115, 44, 32, 118, 97, 108, 117, 101, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 98, 121, 116, 101, 76, 101, 110, 103, 116, 104, 41, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 111, 102, 102, 115, 101, 116, 32, 43, 32, 98, 121, 116, 101, 76, 101, 110, 103, 116, 104, 59, 10, 125, 59, 10, 10, 10, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 119, 114, 105, 116, 101, 73, 110, 116, 56, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 118, 97, 108, 117, 101, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 110, 111, 65, 115, 115, 101, 114, 116, 41, 32, 123, 10, 32, 32, 118, 97, 108, 117, 101, 32, 61, 32, 43, 118, 97, 108, 117, 101, 59, 10, 32, 32, 111, 102, 102, 115, 101, 116, 32, 61, 32, 111, 102, 102, 115, 101, 116, 32, 62, 62, 62, 32, 48, 59, 10, 32, 32, 105, 102, 32, 40, 33, 110, 111, 65, 115, 115, 101, 114, 116, 41, 10, 32, 32, 32, 32, 99, 104, 101, 99, 107, 73, 110, 116, 40, 116, 104, 105, 115, 44, 32, 118, 97, 108, 117, 101, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 49, 44, 32, 48, 120, 55, 102, 44, 32, 45, 48, 120, 56, 48, 41, 59, 10, 32, 32, 116, 104, 105, 115, 46, 115, 101, 116, 65, 116, 40, 111, 102, 102, 115, 101, 116, 44, 32, 118, 97, 108, 117, 101, 41, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 111, 102, 102, 115, 101, 116, 32, 43, 32, 49, 59, 10, 125, 59, 10, 10, 10, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 119, 114, 105, 116, 101, 73, 110, 116, 49, 54, 76, 69, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 118, 97, 108, 117, 101, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 110, 111, 65, 115, 115, 101, 114, 116, 41, 32, 123, 10, 32, 32, 118, 97, 108, 117, 101, 32, 61, 32, 43, 118, 97, 108, 117, 101, 59, 10, 32, 32, 111, 102, 102, 115, 101, 116, 32, 61, 32, 111, 102, 102, 115, 101, 116, 32, 62, 62, 62, 32, 48, 59, 10, 32, 32, 105, 102, 32, 40, 33, 110, 111, 65, 115, 115, 101, 114, 116, 41, 10, 32, 32, 32, 32, 99, 104, 101, 99, 107, 73, 110, 116, 40, 116, 104, 105, 115, 44, 32, 118, 97, 108, 117, 101, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 50, 44, 32, 48, 120, 55, 102, 102, 102, 44, 32, 45, 48, 120, 56, 48, 48, 48, 41, 59, 10, 32, 32, 116, 104, 105, 115, 46, 115, 101, 116, 65, 116, 40, 111, 102, 102, 115, 101, 116, 44, 32, 32, 32, 32, 32, 118, 97, 108, 117, 101, 41, 59, 10, 32, 32, 116, 104, 105, 115, 46, 115, 101, 116, 65, 116, 40, 111, 102, 102, 115, 101, 116, 32, 43, 32, 49, 44, 32, 118, 97, 108, 117, 101, 32, 62, 62, 62, 32, 56, 41, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 111, 102, 102, 115, 101, 116, 32, 43, 32, 50, 59, 10, 125, 59, 10, 10, 10, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 119, 114, 105, 116, 101, 73, 110, 116, 49, 54, 66, 69, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 118, 97, 108, 117, 101, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 110, 111, 65, 115, 115, 101, 114, 116, 41, 32, 123, 10, 32, 32, 118, 97, 108, 117, 101, 32, 61, 32, 43, 118, 97, 108, 117, 101, 59, 10, 32, 32, 111, 102, 102, 115, 101, 116, 32, 61, 32, 111, 102, 102, 115, 101, 116, 32, 62, 62, 62, 32, 48, 59, 10, 32, 32, 105, 102, 32, 40, 33, 110, 111, 65, 115, 115, 101, 114, 116, 41, 10, 32, 32, 32, 32, 99, 104, 101, 99, 107, 73, 110, 116, 40, 116, 104, 105, 115, 44, 32, 118, 97, 108, 117, 101, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 50, 44, 32, 48, 120, 55, 102, 102, 102, 44, 32, 45, 48, 120, 56, 48, 48, 48, 41, 59, 10, 32, 32, 116, 104, 105, 115, 46, 115, 101, 116, 65, 116, 40, 111, 102, 102, 115, 101, 116, 44, 32, 32, 32, 32, 32, 118, 97, 108, 117, 101, 32, 62, 62, 62, 32, 56, 41, 59, 10, 32, 32, 116, 104, 105, 115, 46, 115, 101, 116, 65, 116, 40, 111, 102, 102, 115, 101, 116, 32, 43, 32, 49, 44, 32, 118, 97, 108, 117, 101, 41, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 111, 102, 102, 115, 101, 116, 32, 43, 32, 50, 59, 10, 125, 59, 10, 10, 10, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 119, 114, 105, 116, 101, 73, 110, 116, 51, 50, 76, 69, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 118, 97, 108, 117, 101, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 110, 111, 65, 115, 115, 101, 114, 116, 41, 32, 123, 10, 32, 32, 118, 97, 108, 117, 101, 32, 61, 32, 43, 118, 97, 108, 117, 101, 59, 10, 32, 32, 111, 102, 102, 115, 101, 116, 32, 61, 32, 111, 102, 102, 115, 101, 116, 32, 62, 62, 62, 32, 48, 59, 10, 32, 32, 105, 102, 32, 40, 33, 110, 111, 65, 115, 115, 101, 114, 116, 41, 10, 32, 32, 32, 32, 99, 104, 101, 99, 107, 73, 110, 116, 40, 116, 104, 105, 115, 44, 32, 118, 97, 108, 117, 101, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 52, 44, 32, 48, 120, 55, 102, 102, 102, 102, 102, 102, 102, 44, 32, 45, 48, 120, 56, 48, 48, 48, 48, 48, 48, 48, 41, 59, 10, 32, 32, 116, 104, 105, 115, 46, 115, 101, 116, 65, 116, 40, 111, 102, 102, 115, 101, 116, 44, 32, 32, 32, 32, 32, 118, 97, 108, 117, 101, 41, 59, 10, 32, 32, 116, 104, 105, 115, 46, 115, 101, 116, 65, 116, 40, 111, 102, 102, 115, 101, 116, 32, 43, 32, 49, 44, 32, 118, 97, 108, 117, 101, 32, 62, 62, 62, 32, 56, 41, 59, 10, 32, 32, 116, 104, 105, 115, 46, 115, 101, 116, 65, 116, 40, 111, 102, 102, 115, 101, 116, 32, 43, 32, 50, 44, 32, 118, 97, 108, 117, 101, 32, 62, 62, 62, 32, 49, 54, 41, 59, 10, 32, 32, 116, 104, 105, 115, 46, 115, 101, 116, 65, 116, 40, 111, 102, 102, 115, 101, 116, 32, 43, 32, 51, 44, 32, 118, 97, 108, 117, 101, 32, 62, 62, 62, 32, 50, 52, 41, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 111, 102, 102, 115, 101, 116, 32, 43, 32, 52, 59, 10, 125, 59, 10, 10, 10, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 119, 114, 105, 116, 101, 73, 110, 116, 51, 50, 66, 69, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 118, 97, 108, 117, 101, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 110, 111, 65, 115, 115, 101, 114, 116, 41, 32, 123, 10, 32, 32, 118, 97, 108, 117, 101, 32, 61, 32, 43, 118, 97, 108, 117, 101, 59, 10, 32, 32, 111, 102, 102, 115, 101, 116, 32, 61, 32, 111, 102, 102, 115, 101, 116, 32, 62, 62, 62, 32, 48, 59, 10, 32, 32, 105, 102, 32, 40, 33, 110, 111, 65, 115, 115, 101, 114, 116, 41, 10, 32, 32, 32, 32, 99, 104, 101, 99, 107, 73, 110, 116, 40, 116, 104, 105, 115, 44, 32, 118, 97, 108, 117, 101, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 52, 44, 32, 48, 120, 55, 102, 102, 102, 102, 102, 102, 102, 44, 32, 45, 48, 120, 56, 48, 48, 48, 48, 48, 48, 48, 41, 59, 10, 32, 32, 116, 104, 105, 115, 46, 115, 101, 116, 65, 116, 40, 111, 102, 102, 115, 101, 116, 44, 32, 32, 32, 32, 32, 118, 97, 108, 117, 101, 32, 62, 62, 62, 32, 50, 52, 41, 59, 10, 32, 32, 116, 104, 105, 115, 46, 115, 101, 116, 65, 116, 40, 111, 102, 102, 115, 101, 116, 32, 43, 32, 49, 44, 32, 118, 97, 108, 117, 101, 32, 62, 62, 62, 32, 49, 54, 41, 59, 10, 32, 32, 116, 104, 105, 115, 46, 115, 101, 116, 65, 116, 40, 111, 102, 102, 115, 101, 116, 32, 43, 32, 50, 44, 32, 118, 97, 108, 117, 101, 32, 62, 62, 62, 32, 56, 41, 59, 10, 32, 32, 116, 104, 105, 115, 46, 115, 101, 116, 65, 116, 40, 111, 102, 102, 115, 101, 116, 32, 43, 32, 51, 44, 32, 118, 97, 108, 117, 101, 41, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 111, 102, 102, 115, 101, 116, 32, 43, 32, 52, 59, 10, 125, 59, 10, 10, 10, 10, 47, 47, 32, 54, 52, 45, 98, 105, 116, 32, 105, 110, 116, 101, 103, 101, 114, 115, 32, 97, 114, 101, 32, 101, 120, 97, 99, 116, 32, 117, 112, 32, 116, 111, 32, 78, 117, 109, 98, 101, 114, 46, 77, 65, 88, 95, 83, 65, 70, 69, 95, 73, 78, 84, 69, 71, 69, 82, 10, 47, 47, 32, 116, 104, 101, 32, 108, 97, 114, 103, 101, 115, 116, 32, 100, 111, 117, 98, 108, 101, 115, 32, 98, 101, 108, 111, 119, 32, 50, 94, 54, 52, 32, 97, 110, 100, 32, 50, 94, 54, 51, 44, 32, 116, 104, 101, 32, 108, 105, 116, 101, 114, 97, 108, 115, 32, 111, 102, 32, 50, 94, 54, 52, 32, 45, 32, 49, 32, 97, 110, 100, 10, 47, 47, 32, 50, 94, 54, 51, 32, 45, 32, 49, 32, 114, 111, 117, 110, 100, 32, 117, 112, 32, 116, 111, 32, 116, 104, 101, 109, 32, 97, 110, 100, 32, 119, 111, 117, 108, 100, 32, 108, 101, 116, 32, 116, 104, 101, 109, 32, 116, 104, 114, 111, 117, 103, 104, 32, 99, 104, 101, 99, 107, 73, 110, 116, 40, 41, 10, 99, 111, 110, 115, 116, 32, 107, 77, 97, 120, 85, 73, 110, 116, 54, 52, 32, 61, 32, 48, 120, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 56, 48, 48, 59, 10, 99, 111, 110, 115, 116, 32, 107, 77, 97, 120, 73, 110, 116, 54, 52, 32, 61, 32, 48, 120, 55, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 99, 48, 48, 59, 10, 10, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 114, 101, 97, 100, 85, 73, 110, 116, 54, 52, 76, 69, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 111, 102, 102, 115, 101, 116, 44, 32, 110, 111, 65, 115, 115, 101, 114, 116, 41, 32, 123, 10, 32, 32, 111, 102, 102, 115, 101, 116, 32, 61, 32, 111, 102, 102, 115, 101, 116, 32, 62, 62, 62, 32, 48, 59, 10, 32, 32, 105, 102, 32, 40, 33, 110, 111, 65, 115, 115, 101, 114, 116, 41, 10, 32, 32, 32, 32, 99, 104, 101, 99, 107, 79, 102, 102, 115, 101, 116, 40, 111, 102, 102, 115, 101, 116, 44, 32, 56, 44, 32, 116, 104, 105, 115, 46, 108, 101, 110, 103, 116, 104, 41, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 98, 105, 110, 100, 105, 110, 103, 46, 114, 101, 97, 100, 85, 73, 110, 116, 76, 69, 40, 116, 104, 105, 115, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 56, 41, 59, 10, 125, 59, 10, 10, 10, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 114, 101, 97, 100, 85, 73, 110, 116, 54, 52, 66, 69, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 111, 102, 102, 115, 101, 116, 44, 32, 110, 111, 65, 115, 115, 101, 114, 116, 41, 32, 123, 10, 32, 32, 111, 102, 102, 115, 101, 116, 32, 61, 32, 111, 102, 102, 115, 101, 116, 32, 62, 62, 62, 32, 48, 59, 10, 32, 32, 105, 102, 32, 40, 33, 110, 111, 65, 115, 115, 101, 114, 116, 41, 10, 32, 32, 32, 32, 99, 104, 101, 99, 107, 79, 102, 102, 115, 101, 116, 40, 111, 102, 102, 115, 101, 116, 44, 32, 56, 44, 32, 116, 104, 105, 115, 46, 108, 101, 110, 103, 116, 104, 41, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 98, 105, 110, 100, 105, 110, 103, 46, 114, 101, 97, 100, 85, 73, 110, 116, 66, 69, 40, 116, 104, 105, 115, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 56, 41, 59, 10, 125, 59, 10, 10, 10, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 114, 101, 97, 100, 73, 110, 116, 54, 52, 76, 69, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 111, 102, 102, 115, 101, 116, 44, 32, 110, 111, 65, 115, 115, 101, 114, 116, 41, 32, 123, 10, 32, 32, 111, 102, 102, 115, 101, 116, 32, 61, 32, 111, 102, 102, 115, 101, 116, 32, 62, 62, 62, 32, 48, 59, 10, 32, 32, 105, 102, 32, 40, 33, 110, 111, 65, 115, 115, 101, 114, 116, 41, 10, 32, 32, 32, 32, 99, 104, 101, 99, 107, 79, 102, 102, 115, 101, 116, 40, 111, 102, 102, 115, 101, 116, 44, 32, 56, 44, 32, 116, 104, 105, 115, 46, 108, 101, 110, 103, 116, 104, 41, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 98, 105, 110, 100, 105, 110, 103, 46, 114, 101, 97, 100, 73, 110, 116, 76, 69, 40, 116, 104, 105, 115, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 56, 41, 59, 10, 125, 59, 10, 10, 10, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 114, 101, 97, 100, 73, 110, 116, 54, 52, 66, 69, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 111, 102, 102, 115, 101, 116, 44, 32, 110, 111, 65, 115, 115, 101, 114, 116, 41, 32, 123, 10, 32, 32, 111, 102, 102, 115, 101, 116, 32, 61, 32, 111, 102, 102, 115, 101, 116, 32, 62, 62, 62, 32, 48, 59, 10, 32, 32, 105, 102, 32, 40, 33, 110, 111, 65, 115, 115, 101, 114, 116, 41, 10, 32, 32, 32, 32, 99, 104, 101, 99, 107, 79, 102, 102, 115, 101, 116, 40, 111, 102, 102, 115, 101, 116, 44, 32, 56, 44, 32, 116, 104, 105, 115, 46, 108, 101, 110, 103, 116, 104, 41, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 98, 105, 110, 100, 105, 110, 103, 46, 114, 101, 97, 100, 73, 110, 116, 66, 69, 40, 116, 104, 105, 115, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 56, 41, 59, 10, 125, 59, 10, 10, 10, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 119, 114, 105, 116, 101, 85, 73, 110, 116, 54, 52, 76, 69, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 118, 97, 108, 117, 101, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 110, 111, 65, 115, 115, 101, 114, 116, 41, 32, 123, 10, 32, 32, 118, 97, 108, 117, 101, 32, 61, 32, 43, 118, 97, 108, 117, 101, 59, 10, 32, 32, 111, 102, 102, 115, 101, 116, 32, 61, 32, 111, 102, 102, 115, 101, 116, 32, 62, 62, 62, 32, 48, 59, 10, 32, 32, 105, 102, 32, 40, 33, 110, 111, 65, 115, 115, 101, 114, 116, 41, 10, 32, 32, 32, 32, 99, 104, 101, 99, 107, 73, 110, 116, 40, 116, 104, 105, 115, 44, 32, 118, 97, 108, 117, 101, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 56, 44, 32, 107, 77, 97, 120, 85, 73, 110, 116, 54, 52, 44, 32, 48, 41, 59, 10, 32, 32, 98, 105, 110, 100, 105, 110, 103, 46, 119, 114, 105, 116, 101, 73, 110, 116, 76, 69, 40, 116, 104, 105, 115, 44, 32, 118, 97, 108, 117, 101, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 56, 41, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 111, 102, 102, 115, 101, 116, 32, 43, 32, 56, 59, 10, 125, 59, 10, 10, 10, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 119, 114, 105, 116, 101, 85, 73, 110, 116, 54, 52, 66, 69, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 118, 97, 108, 117, 101, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 110, 111, 65, 115, 115, 101, 114, 116, 41, 32, 123, 10, 32, 32, 118, 97, 108, 117, 101, 32, 61, 32, 43, 118, 97, 108, 117, 101, 59, 10, 32, 32, 111, 102, 102, 115, 101, 116, 32, 61, 32, 111, 102, 102, 115, 101, 116, 32, 62, 62, 62, 32, 48, 59, 10, 32, 32, 105, 102, 32, 40, 33, 110, 111, 65, 115, 115, 101, 114, 116, 41, 10, 32, 32, 32, 32, 99, 104, 101, 99, 107, 73, 110, 116, 40, 116, 104, 105, 115, 44, 32, 118, 97, 108, 117, 101, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 56, 44, 32, 107, 77, 97, 120, 85, 73, 110, 116, 54, 52, 44, 32, 48, 41, 59, 10, 32, 32, 98, 105, 110, 100, 105, 110, 103, 46, 119, 114, 105, 116, 101, 73, 110, 116, 66, 69, 40, 116, 104, 105, 115, 44, 32, 118, 97, 108, 117, 101, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 56, 41, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 111, 102, 102, 115, 101, 116, 32, 43, 32, 56, 59, 10, 125, 59, 10, 10, 10, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 119, 114, 105, 116, 101, 73, 110, 116, 54, 52, 76, 69, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 118, 97, 108, 117, 101, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 110, 111, 65, 115, 115, 101, 114, 116, 41, 32, 123, 10, 32, 32, 118, 97, 108, 117, 101, 32, 61, 32, 43, 118, 97, 108, 117, 101, 59, 10, 32, 32, 111, 102, 102, 115, 101, 116, 32, 61, 32, 111, 102, 102, 115, 101, 116, 32, 62, 62, 62, 32, 48, 59, 10, 32, 32, 105, 102, 32, 40, 33, 110, 111, 65, 115, 115, 101, 114, 116, 41, 10, 32, 32, 32, 32, 99, 104, 101, 99, 107, 73, 110, 116, 40, 116, 104, 105, 115, 44, 32, 118, 97, 108, 117, 101, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 56, 44, 32, 107, 77, 97, 120, 73, 110, 116, 54, 52, 44, 32, 45, 48, 120, 56, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 41, 59, 10, 32, 32, 98, 105, 110, 100, 105, 110, 103, 46, 119, 114, 105, 116, 101, 73, 110, 116, 76, 69, 40, 116, 104, 105, 115, 44, 32, 118, 97, 108, 117, 101, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 56, 41, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 111, 102, 102, 115, 101, 116, 32, 43, 32, 56, 59, 10, 125, 59, 10, 10, 10, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 119, 114, 105, 116, 101, 73, 110, 116, 54, 52, 66, 69, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 118, 97, 108, 117, 101, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 110, 111, 65, 115, 115, 101, 114, 116, 41, 32, 123, 10, 32, 32, 118, 97, 108, 117, 101, 32, 61, 32, 43, 118, 97, 108, 117, 101, 59, 10, 32, 32, 111, 102, 102, 115, 101, 116, 32, 61, 32, 111, 102, 102, 115, 101, 116, 32, 62, 62, 62, 32, 48, 59, 10, 32, 32, 105, 102, 32, 40, 33, 110, 111, 65, 115, 115, 101, 114, 116, 41, 10, 32, 32, 32, 32, 99, 104, 101, 99, 107, 73, 110, 116, 40, 116, 104, 105, 115, 44, 32, 118, 97, 108, 117, 101, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 56, 44, 32, 107, 77, 97, 120, 73, 110, 116, 54, 52, 44, 32, 45, 48, 120, 56, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 41, 59, 10, 32, 32, 98, 105, 110, 100, 105, 110, 103, 46, 119, 114, 105, 116, 101, 73, 110, 116, 66, 69, 40, 116, 104, 105, 115, 44, 32, 118, 97, 108, 117, 101, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 56, 41, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 111, 102, 102, 115, 101, 116, 32, 43, 32, 56, 59, 10, 125, 59, 10, 10, 10, 47, 47, 32, 78, 67, 74, 83, 58, 32, 119, 105, 116, 104, 111, 117, 116, 32, 116, 104, 101, 32, 85, 105, 110, 116, 56, 65, 114, 114, 97, 121, 32, 118, 105, 101, 119, 32, 101, 118, 101, 114, 121, 32, 103, 101, 116, 65, 116, 40, 41, 47, 115, 101, 116, 65, 116, 40, 41, 32, 105, 115, 32, 97, 32, 110, 97, 116, 105, 118, 101, 10, 47, 47, 32, 99, 97, 108, 108, 44, 32, 115, 111, 32, 100, 101, 99, 111, 100, 101, 32, 116, 104, 101, 32, 102, 105, 120, 101, 100, 45, 119, 105, 100, 116, 104, 32, 105, 110, 116, 101, 103, 101, 114, 115, 32, 119, 105, 116, 104, 32, 97, 32, 115, 105, 110, 103, 108, 101, 32, 111, 110, 101, 32, 105, 110, 115, 116, 101, 97, 100, 46, 10, 105, 102, 32, 40, 116, 121, 112, 101, 111, 102, 32, 98, 105, 110, 100, 105, 110, 103, 79, 98, 106, 46, 97, 114, 114, 97, 121, 66, 117, 102, 102, 101, 114, 32, 33, 61, 61, 32, 39, 102, 117, 110, 99, 116, 105, 111, 110, 39, 41, 32, 123, 10, 32, 32, 99, 111, 110, 115, 116, 32, 110, 97, 116, 105, 118, 101, 82, 101, 97, 100, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 114, 101, 97, 100, 44, 32, 98, 121, 116, 101, 76, 101, 110, 103, 116, 104, 41, 32, 123, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 111, 102, 102, 115, 101, 116, 44, 32, 110, 111, 65, 115, 115, 101, 114, 116, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 111, 102, 102, 115, 101, 116, 32, 61, 32, 111, 102, 102, 115, 101, 116, 32, 62, 62, 62, 32, 48, 59, 10, 32, 32, 32, 32, 32, 32, 105, 102, 32, 40, 33, 110, 111, 65, 115, 115, 101, 114, 116, 41, 10, 32, 32, 32, 32, 32, 32, 32, 32, 99, 104, 101, 99, 107, 79, 102, 102, 115, 101, 116, 40, 111, 102, 102, 115, 101, 116, 44, 32, 98, 121, 116, 101, 76, 101, 110, 103, 116, 104, 44, 32, 116, 104, 105, 115, 46, 108, 101, 110, 103, 116, 104, 41, 59, 10, 32, 32, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 114, 101, 97, 100, 40, 116, 104, 105, 115, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 98, 121, 116, 101, 76, 101, 110, 103, 116, 104, 41, 59, 10, 32, 32, 32, 32, 125, 59, 10, 32, 32, 125, 59, 10, 10, 32, 32, 99, 111, 110, 115, 116, 32, 110, 97, 116, 105, 118, 101, 87, 114, 105, 116, 101, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 119, 114, 105, 116, 101, 44, 32, 98, 121, 116, 101, 76, 101, 110, 103, 116, 104, 44, 32, 109, 97, 120, 44, 32, 109, 105, 110, 41, 32, 123, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 118, 97, 108, 117, 101, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 110, 111, 65, 115, 115, 101, 114, 116, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 118, 97, 108, 117, 101, 32, 61, 32, 43, 118, 97, 108, 117, 101, 59, 10, 32, 32, 32, 32, 32, 32, 111, 102, 102, 115, 101, 116, 32, 61, 32, 111, 102, 102, 115, 101, 116, 32, 62, 62, 62, 32, 48, 59, 10, 32, 32, 32, 32, 32, 32, 105, 102, 32, 40, 33, 110, 111, 65, 115, 115, 101, 114, 116, 41, 10, 32, 32, 32, 32, 32, 32, 32, 32, 99, 104, 101, 99, 107, 73, 110, 116, 40, 116, 104, 105, 115, 44, 32, 118, 97, 108, 117, 101, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 98, 121, 116, 101, 76, 101, 110, 103, 116, 104, 44, 32, 109, 97, 120, 44, 32, 109, 105, 110, 41, 59, 10, 32, 32, 32, 32, 32, 32, 119, 114, 105, 116, 101, 40, 116, 104, 105, 115, 44, 32, 118, 97, 108, 117, 101, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 98, 121, 116, 101, 76, 101, 110, 103, 116, 104, 41, 59, 10, 32, 32, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 111, 102, 102, 115, 101, 116, 32, 43, 32, 98, 121, 116, 101, 76, 101, 110, 103, 116, 104, 59, 10, 32, 32, 32, 32, 125, 59, 10, 32, 32, 125, 59, 10, 10, 32, 32, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 114, 101, 97, 100, 85, 73, 110, 116, 49, 54, 76, 69, 32, 61, 32, 110, 97, 116, 105, 118, 101, 82, 101, 97, 100, 40, 98, 105, 110, 100, 105, 110, 103, 46, 114, 101, 97, 100, 85, 73, 110, 116, 76, 69, 44, 32, 50, 41, 59, 10, 32, 32, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 114, 101, 97, 100, 85, 73, 110, 116, 49, 54, 66, 69, 32, 61, 32, 110, 97, 116, 105, 118, 101, 82, 101, 97, 100, 40, 98, 105, 110, 100, 105, 110, 103, 46, 114, 101, 97, 100, 85, 73, 110, 116, 66, 69, 44, 32, 50, 41, 59, 10, 32, 32, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 114, 101, 97, 100, 85, 73, 110, 116, 51, 50, 76, 69, 32, 61, 32, 110, 97, 116, 105, 118, 101, 82, 101, 97, 100, 40, 98, 105, 110, 100, 105, 110, 103, 46, 114, 101, 97, 100, 85, 73, 110, 116, 76, 69, 44, 32, 52, 41, 59, 10, 32, 32, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 114, 101, 97, 100, 85, 73, 110, 116, 51, 50, 66, 69, 32, 61, 32, 110, 97, 116, 105, 118, 101, 82, 101, 97, 100, 40, 98, 105, 110, 100, 105, 110, 103, 46, 114, 101, 97, 100, 85, 73, 110, 116, 66, 69, 44, 32, 52, 41, 59, 10, 32, 32, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 114, 101, 97, 100, 73, 110, 116, 49, 54, 76, 69, 32, 61, 32, 110, 97, 116, 105, 118, 101, 82, 101, 97, 100, 40, 98, 105, 110, 100, 105, 110, 103, 46, 114, 101, 97, 100, 73, 110, 116, 76, 69, 44, 32, 50, 41, 59, 10, 32, 32, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 114, 101, 97, 100, 73, 110, 116, 49, 54, 66, 69, 32, 61, 32, 110, 97, 116, 105, 118, 101, 82, 101, 97, 100, 40, 98, 105, 110, 100, 105, 110, 103, 46, 114, 101, 97, 100, 73, 110, 116, 66, 69, 44, 32, 50, 41, 59, 10, 32, 32, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 114, 101, 97, 100, 73, 110, 116, 51, 50, 76, 69, 32, 61, 32, 110, 97, 116, 105, 118, 101, 82, 101, 97, 100, 40, 98, 105, 110, 100, 105, 110, 103, 46, 114, 101, 97, 100, 73, 110, 116, 76, 69, 44, 32, 52, 41, 59, 10, 32, 32, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 114, 101, 97, 100, 73, 110, 116, 51, 50, 66, 69, 32, 61, 32, 110, 97, 116, 105, 118, 101, 82, 101, 97, 100, 40, 98, 105, 110, 100, 105, 110, 103, 46, 114, 101, 97, 100, 73, 110, 116, 66, 69, 44, 32, 52, 41, 59, 10, 10, 32, 32, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 119, 114, 105, 116, 101, 85, 73, 110, 116, 49, 54, 76, 69, 32, 61, 10, 32, 32, 32, 32, 32, 32, 110, 97, 116, 105, 118, 101, 87, 114, 105, 116, 101, 40, 98, 105, 110, 100, 105, 110, 103, 46, 119, 114, 105, 116, 101, 73, 110, 116, 76, 69, 44, 32, 50, 44, 32, 48, 120, 102, 102, 102, 102, 44, 32, 48, 41, 59, 10, 32, 32, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 119, 114, 105, 116, 101, 85, 73, 110, 116, 49, 54, 66, 69, 32, 61, 10, 32, 32, 32, 32, 32, 32, 110, 97, 116, 105, 118, 101, 87, 114, 105, 116, 101, 40, 98, 105, 110, 100, 105, 110, 103, 46, 119, 114, 105, 116, 101, 73, 110, 116, 66, 69, 44, 32, 50, 44, 32, 48, 120, 102, 102, 102, 102, 44, 32, 48, 41, 59, 10, 32, 32, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 119, 114, 105, 116, 101, 85, 73, 110, 116, 51, 50, 76, 69, 32, 61, 10, 32, 32, 32, 32, 32, 32, 110, 97, 116, 105, 118, 101, 87, 114, 105, 116, 101, 40, 98, 105, 110, 100, 105, 110, 103, 46, 119, 114, 105, 116, 101, 73, 110, 116, 76, 69, 44, 32, 52, 44, 32, 48, 120, 102, 102, 102, 102, 102, 102, 102, 102, 44, 32, 48, 41, 59, 10, 32, 32, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 119, 114, 105, 116, 101, 85, 73, 110, 116, 51, 50, 66, 69, 32, 61, 10, 32, 32, 32, 32, 32, 32, 110, 97, 116, 105, 118, 101, 87, 114, 105, 116, 101, 40, 98, 105, 110, 100, 105, 110, 103, 46, 119, 114, 105, 116, 101, 73, 110, 116, 66, 69, 44, 32, 52, 44, 32, 48, 120, 102, 102, 102, 102, 102, 102, 102, 102, 44, 32, 48, 41, 59, 10, 32, 32, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 119, 114, 105, 116, 101, 73, 110, 116, 49, 54, 76, 69, 32, 61, 10, 32, 32, 32, 32, 32, 32, 110, 97, 116, 105, 118, 101, 87, 114, 105, 116, 101, 40, 98, 105, 110, 100, 105, 110, 103, 46, 119, 114, 105, 116, 101, 73, 110, 116, 76, 69, 44, 32, 50, 44, 32, 48, 120, 55, 102, 102, 102, 44, 32, 45, 48, 120, 56, 48, 48, 48, 41, 59, 10, 32, 32, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 119, 114, 105, 116, 101, 73, 110, 116, 49, 54, 66, 69, 32, 61, 10, 32, 32, 32, 32, 32, 32, 110, 97, 116, 105, 118, 101, 87, 114, 105, 116, 101, 40, 98, 105, 110, 100, 105, 110, 103, 46, 119, 114, 105, 116, 101, 73, 110, 116, 66, 69, 44, 32, 50, 44, 32, 48, 120, 55, 102, 102, 102, 44, 32, 45, 48, 120, 56, 48, 48, 48, 41, 59, 10, 32, 32, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 119, 114, 105, 116, 101, 73, 110, 116, 51, 50, 76, 69, 32, 61, 10, 32, 32, 32, 32, 32, 32, 110, 97, 116, 105, 118, 101, 87, 114, 105, 116, 101, 40, 98, 105, 110, 100, 105, 110, 103, 46, 119, 114, 105, 116, 101, 73, 110, 116, 76, 69, 44, 32, 52, 44, 32, 48, 120, 55, 102, 102, 102, 102, 102, 102, 102, 44, 32, 45, 48, 120, 56, 48, 48, 48, 48, 48, 48, 48, 41, 59, 10, 32, 32, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 119, 114, 105, 116, 101, 73, 110, 116, 51, 50, 66, 69, 32, 61, 10, 32, 32, 32, 32, 32, 32, 110, 97, 116, 105, 118, 101, 87, 114, 105, 116, 101, 40, 98, 105, 110, 100, 105, 110, 103, 46, 119, 114, 105, 116, 101, 73, 110, 116, 66, 69, 44, 32, 52, 44, 32, 48, 120, 55, 102, 102, 102, 102, 102, 102, 102, 44, 32, 45, 48, 120, 56, 48, 48, 48, 48, 48, 48, 48, 41, 59, 10, 125, 10, 10, 10, 47, 47, 32, 78, 67, 74, 83, 58, 32, 98, 97, 116, 99, 104, 101, 100, 32, 100, 101, 99, 111, 100, 105, 110, 103, 44, 32, 101, 46, 103, 46, 32, 98, 117, 102, 46, 114, 101, 97, 100, 85, 73, 110, 116, 51, 50, 76, 69, 65, 114, 114, 97, 121, 40, 111, 102, 102, 115, 101, 116, 44, 32, 99, 111, 117, 110, 116, 91, 44, 32, 115, 116, 114, 105, 100, 101, 93, 41, 10, 47, 47, 32, 114, 101, 97, 100, 115, 32, 99, 111, 117, 110, 116, 32, 102, 105, 101, 108, 100, 115, 32, 115, 116, 97, 114, 116, 105, 110, 103, 32, 97, 116, 32, 111, 102, 102, 115, 101, 116, 44, 32, 115, 116, 114, 105, 100, 101, 32, 98, 121, 116, 101, 115, 32, 97, 112, 97, 114, 116, 32, 40, 100, 101, 102, 97, 117, 108, 116, 115, 32, 116, 111, 10, 47, 47, 32, 116, 104, 101, 32, 102, 105, 101, 108, 100, 32, 115, 105, 122, 101, 41, 44, 32, 119, 105, 116, 104, 32, 111, 110, 101, 32, 110, 97, 116, 105, 118, 101, 32, 99, 97, 108, 108, 46, 10, 91, 10, 32, 32, 91, 39, 73, 110, 116, 56, 39, 44, 32, 49, 93, 44, 32, 91, 39, 85, 73, 110, 116, 56, 39, 44, 32, 49, 93, 44, 10, 32, 32, 91, 39, 73, 110, 116, 49, 54, 76, 69, 39, 44, 32, 50, 93, 44, 32, 91, 39, 73, 110, 116, 49, 54, 66, 69, 39, 44, 32, 50, 93, 44, 32, 91, 39, 85, 73, 110, 116, 49, 54, 76, 69, 39, 44, 32, 50, 93, 44, 32, 91, 39, 85, 73, 110, 116, 49, 54, 66, 69, 39, 44, 32, 50, 93, 44, 10, 32, 32, 91, 39, 73, 110, 116, 51, 50, 76, 69, 39, 44, 32, 52, 93, 44, 32, 91, 39, 73, 110, 116, 51, 50, 66, 69, 39, 44, 32, 52, 93, 44, 32, 91, 39, 85, 73, 110, 116, 51, 50, 76, 69, 39, 44, 32, 52, 93, 44, 32, 91, 39, 85, 73, 110, 116, 51, 50, 66, 69, 39, 44, 32, 52, 93, 44, 10, 32, 32, 91, 39, 73, 110, 116, 54, 52, 76, 69, 39, 44, 32, 56, 93, 44, 32, 91, 39, 73, 110, 116, 54, 52, 66, 69, 39, 44, 32, 56, 93, 44, 32, 91, 39, 85, 73, 110, 116, 54, 52, 76, 69, 39, 44, 32, 56, 93, 44, 32, 91, 39, 85, 73, 110, 116, 54, 52, 66, 69, 39, 44, 32, 56, 93, 44, 10, 32, 32, 91, 39, 70, 108, 111, 97, 116, 76, 69, 39, 44, 32, 52, 93, 44, 32, 91, 39, 70, 108, 111, 97, 116, 66, 69, 39, 44, 32, 52, 93, 44, 32, 91, 39, 68, 111, 117, 98, 108, 101, 76, 69, 39, 44, 32, 56, 93, 44, 32, 91, 39, 68, 111, 117, 98, 108, 101, 66, 69, 39, 44, 32, 56, 93, 10, 93, 46, 102, 111, 114, 69, 97, 99, 104, 40, 102, 117, 110, 99, 116, 105, 111, 110, 40, 102, 105, 101, 108, 100, 41, 32, 123, 10, 32, 32, 99, 111, 110, 115, 116, 32, 116, 121, 112, 101, 32, 61, 32, 102, 105, 101, 108, 100, 91, 48, 93, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 115, 105, 122, 101, 32, 61, 32, 102, 105, 101, 108, 100, 91, 49, 93, 59, 10, 10, 32, 32, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 91, 39, 114, 101, 97, 100, 39, 32, 43, 32, 116, 121, 112, 101, 32, 43, 32, 39, 65, 114, 114, 97, 121, 39, 93, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 111, 102, 102, 115, 101, 116, 44, 32, 99, 111, 117, 110, 116, 44, 32, 115, 116, 114, 105, 100, 101, 41, 32, 123, 10, 32, 32, 32, 32, 111, 102, 102, 115, 101, 116, 32, 61, 32, 111, 102, 102, 115, 101, 116, 32, 62, 62, 62, 32, 48, 59, 10, 32, 32, 32, 32, 99, 111, 117, 110, 116, 32, 61, 32, 99, 111, 117, 110, 116, 32, 62, 62, 62, 32, 48, 59, 10, 32, 32, 32, 32, 115, 116, 114, 105, 100, 101, 32, 61, 32, 115, 116, 114, 105, 100, 101, 32, 61, 61, 61, 32, 117, 110, 100, 101, 102, 105, 110, 101, 100, 32, 63, 32, 115, 105, 122, 101, 32, 58, 32, 115, 116, 114, 105, 100, 101, 32, 62, 62, 62, 32, 48, 59, 10, 32, 32, 32, 32, 105, 102, 32, 40, 99, 111, 117, 110, 116, 32, 62, 32, 48, 41, 10, 32, 32, 32, 32, 32, 32, 99, 104, 101, 99, 107, 79, 102, 102, 115, 101, 116, 40, 111, 102, 102, 115, 101, 116, 32, 43, 32, 40, 99, 111, 117, 110, 116, 32, 45, 32, 49, 41, 32, 42, 32, 115, 116, 114, 105, 100, 101, 44, 32, 115, 105, 122, 101, 44, 32, 116, 104, 105, 115, 46, 108, 101, 110, 103, 116, 104, 41, 59, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 98, 105, 110, 100, 105, 110, 103, 46, 114, 101, 97, 100, 65, 114, 114, 97, 121, 40, 116, 104, 105, 115, 44, 32, 116, 121, 112, 101, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 99, 111, 117, 110, 116, 44, 32, 115, 116, 114, 105, 100, 101, 41, 59, 10, 32, 32, 125, 59, 10, 125, 41, 59, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 99, 104, 101, 99, 107, 70, 108, 111, 97, 116, 40, 98, 117, 102, 102, 101, 114, 44, 32, 118, 97, 108, 117, 101, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 101, 120, 116, 41, 32, 123, 10, 32, 32, 105, 102, 32, 40, 33, 40, 98, 117, 102, 102, 101, 114, 32, 105, 110, 115, 116, 97, 110, 99, 101, 111, 102, 32, 66, 117, 102, 102, 101, 114, 41, 41, 10, 32, 32, 32, 32, 116, 104, 114, 111, 119, 32, 110, 101, 119, 32, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 98, 117, 102, 102, 101, 114, 32, 109, 117, 115, 116, 32, 98, 101, 32, 97, 32, 66, 117, 102, 102, 101, 114, 32, 105, 110, 115, 116, 97, 110, 99, 101, 39, 41, 59, 10, 32, 32, 105, 102, 32, 40, 111, 102, 102, 115, 101, 116, 32, 43, 32, 101, 120, 116, 32, 62, 32, 98, 117, 102, 102, 101, 114, 46, 108, 101, 110, 103, 116, 104, 41, 10, 32, 32, 32, 32, 116, 104, 114, 111, 119, 32, 110, 101, 119, 32, 82, 97, 110, 103, 101, 69, 114, 114, 111, 114, 40, 39, 105, 110, 100, 101, 120, 32, 111, 117, 116, 32, 111, 102, 32, 114, 97, 110, 103, 101, 39, 41, 59, 10, 125, 10, 10, 10, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 119, 114, 105, 116, 101, 70, 108, 111, 97, 116, 76, 69, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 32, 119, 114, 105, 116, 101, 70, 108, 111, 97, 116, 76, 69, 40, 118, 97, 108, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 110, 111, 65, 115, 115, 101, 114, 116, 41, 32, 123, 10, 32, 32, 118, 97, 108, 32, 61, 32, 43, 118, 97, 108, 59, 10, 32, 32, 111, 102, 102, 115, 101, 116, 32, 61, 32, 111, 102, 102, 115, 101, 116, 32, 62, 62, 62, 32, 48, 59, 10, 32, 32, 105, 102, 32, 40, 33, 110, 111, 65, 115, 115, 101, 114, 116, 41, 10, 32, 32, 32, 32, 99, 104, 101, 99, 107, 70, 108, 111, 97, 116, 40, 116, 104, 105, 115, 44, 32, 118, 97, 108, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 52, 41, 59, 10, 32, 32, 98, 105, 110, 100, 105, 110, 103, 46, 119, 114, 105, 116, 101, 70, 108, 111, 97, 116, 76, 69, 40, 116, 104, 105, 115, 44, 32, 118, 97, 108, 44, 32, 111, 102, 102, 115, 101, 116, 41, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 111, 102, 102, 115, 101, 116, 32, 43, 32, 52, 59, 10, 125, 59, 10, 10, 10, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 119, 114, 105, 116, 101, 70, 108, 111, 97, 116, 66, 69, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 32, 119, 114, 105, 116, 101, 70, 108, 111, 97, 116, 66, 69, 40, 118, 97, 108, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 110, 111, 65, 115, 115, 101, 114, 116, 41, 32, 123, 10, 32, 32, 118, 97, 108, 32, 61, 32, 43, 118, 97, 108, 59, 10, 32, 32, 111, 102, 102, 115, 101, 116, 32, 61, 32, 111, 102, 102, 115, 101, 116, 32, 62, 62, 62, 32, 48, 59, 10, 32, 32, 105, 102, 32, 40, 33, 110, 111, 65, 115, 115, 101, 114, 116, 41, 10, 32, 32, 32, 32, 99, 104, 101, 99, 107, 70, 108, 111, 97, 116, 40, 116, 104, 105, 115, 44, 32, 118, 97, 108, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 52, 41, 59, 10, 32, 32, 98, 105, 110, 100, 105, 110, 103, 46, 119, 114, 105, 116, 101, 70, 108, 111, 97, 116, 66, 69, 40, 116, 104, 105, 115, 44, 32, 118, 97, 108, 44, 32, 111, 102, 102, 115, 101, 116, 41, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 111, 102, 102, 115, 101, 116, 32, 43, 32, 52, 59, 10, 125, 59, 10, 10, 10, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 119, 114, 105, 116, 101, 68, 111, 117, 98, 108, 101, 76, 69, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 32, 119, 114, 105, 116, 101, 68, 111, 117, 98, 108, 101, 76, 69, 40, 118, 97, 108, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 110, 111, 65, 115, 115, 101, 114, 116, 41, 32, 123, 10, 32, 32, 118, 97, 108, 32, 61, 32, 43, 118, 97, 108, 59, 10, 32, 32, 111, 102, 102, 115, 101, 116, 32, 61, 32, 111, 102, 102, 115, 101, 116, 32, 62, 62, 62, 32, 48, 59, 10, 32, 32, 105, 102, 32, 40, 33, 110, 111, 65, 115, 115, 101, 114, 116, 41, 10, 32, 32, 32, 32, 99, 104, 101, 99, 107, 70, 108, 111, 97, 116, 40, 116, 104, 105, 115, 44, 32, 118, 97, 108, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 56, 41, 59, 10, 32, 32, 98, 105, 110, 100, 105, 110, 103, 46, 119, 114, 105, 116, 101, 68, 111, 117, 98, 108, 101, 76, 69, 40, 116, 104, 105, 115, 44, 32, 118, 97, 108, 44, 32, 111, 102, 102, 115, 101, 116, 41, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 111, 102, 102, 115, 101, 116, 32, 43, 32, 56, 59, 10, 125, 59, 10, 10, 10, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 119, 114, 105, 116, 101, 68, 111, 117, 98, 108, 101, 66, 69, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 32, 119, 114, 105, 116, 101, 68, 111, 117, 98, 108, 101, 66, 69, 40, 118, 97, 108, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 110, 111, 65, 115, 115, 101, 114, 116, 41, 32, 123, 10, 32, 32, 118, 97, 108, 32, 61, 32, 43, 118, 97, 108, 59, 10, 32, 32, 111, 102, 102, 115, 101, 116, 32, 61, 32, 111, 102, 102, 115, 101, 116, 32, 62, 62, 62, 32, 48, 59, 10, 32, 32, 105, 102, 32, 40, 33, 110, 111, 65, 115, 115, 101, 114, 116, 41, 10, 32, 32, 32, 32, 99, 104, 101, 99, 107, 70, 108, 111, 97, 116, 40, 116, 104, 105, 115, 44, 32, 118, 97, 108, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 56, 41, 59, 10, 32, 32, 98, 105, 110, 100, 105, 110, 103, 46, 119, 114, 105, 116, 101, 68, 111, 117, 98, 108, 101, 66, 69, 40, 116, 104, 105, 115, 44, 32, 118, 97, 108, 44, 32, 111, 102, 102, 115, 101, 116, 41, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 111, 102, 102, 115, 101, 116, 32, 43, 32, 56, 59, 10, 125, 59, 10, 0 };
 
   const cef_char_t constants_native[] = { 39, 117, 115, 101, 32, 115, 116, 114, 105, 99, 116, 39, 59, 10, 10, 109, 111, 100, 117, 108, 101, 46, 101, 120, 112, 111, 114, 116, 115, 32, 61, 32, 112, 114, 111, 99, 101, 115, 115, 46, 98, 105, 110, 100, 105, 110, 103, 40, 39, 99, 111, 110, 115, 116, 97, 110, 116, 115, 39, 41, 59, 10, 0 };
 
   const cef_char_t events_native[] = { 39, 117, 115, 101, 32, 115, 116, 114, 105, 99, 116, 39, 59, 10, 10, 118, 97, 114, 32, 100, 111, 109, 97, 105, 110, 59, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 69, 118, 101, 110, 116, 69, 109, 105, 116, 116, 101, 114, 40, 41, 32, 123, 10, 32, 32, 69, 118, 101, 110, 116, 69, 109, 105, 116, 116, 101, 114, 46, 105, 110, 105, 116, 46, 99, 97, 108, 108, 40, 116, 104, 105, 115, 41, 59, 10, 125, 10, 109, 111, 100, 117, 108, 101, 46, 101, 120, 112, 111, 114, 116, 115, 32, 61, 32, 69, 118, 101, 110, 116, 69, 109, 105, 116, 116, 101, 114, 59, 10, 10, 47, 47, 32, 66, 97, 99, 107, 119, 97, 114, 100, 115, 45, 99, 111, 109, 112, 97, 116, 32, 119, 105, 116, 104, 32, 110, 111, 100, 101, 32, 48, 46, 49, 48, 46, 120, 10, 69, 118, 101, 110, 116, 69, 109, 105, 116, 116, 101, 114, 46, 69, 118, 101, 110, 116, 69, 109, 105, 116, 116, 101, 114, 32, 61, 32, 69, 118, 101, 110, 116, 69, 109, 105, 116, 116, 101, 114, 59, 10, 10, 69, 118, 101, 110, 116, 69, 109, 105, 116, 116, 101, 114, 46, 117, 115, 105, 110, 103, 68, 111, 109, 97, 105, 110, 115, 32, 61, 32, 102, 97, 108, 115, 101, 59, 10, 10, 69, 118, 101, 110, 116, 69, 109, 105, 116, 116, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 100, 111, 109, 97, 105, 110, 32, 61, 32, 117, 110, 100, 101, 102, 105, 110, 101, 100, 59, 10, 69, 118, 101, 110, 116, 69, 109, 105, 116, 116, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 95, 101, 118, 101, 110, 116, 115, 32, 61, 32, 117, 110, 100, 101, 102, 105, 110, 101, 100, 59, 10, 69, 118, 101, 110, 116, 69, 109, 105, 116, 116, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 95, 109, 97, 120, 76, 105, 115, 116, 101, 110, 101, 114, 115, 32, 61, 32, 117, 110, 100, 101, 102, 105, 110, 101, 100, 59, 10, 10, 47, 47, 32, 66, 121, 32, 100, 101, 102, 97, 117, 108, 116, 32, 69, 118, 101, 110, 116, 69, 109, 105, 116, 116, 101, 114, 115, 32, 119, 105, 108, 108, 32, 112, 114, 105, 110, 116, 32, 97, 32, 119, 97, 114, 110, 105, 110, 103, 32, 105, 102, 32, 109, 111, 114, 101, 32, 116, 104, 97, 110, 32, 49, 48, 32, 108, 105, 115, 116, 101, 110, 101, 114, 115, 32, 97, 114, 101, 10, 47, 47, 32, 97, 100, 100, 101, 100, 32, 116, 111, 32, 105, 116, 46, 32, 84, 104, 105, 115, 32, 105, 115, 32, 97, 32, 117, 115, 101, 102, 117, 108, 32, 100, 101, 102, 97, 117, 108, 116, 32, 119, 104, 105, 99, 104, 32, 104, 101, 108, 112, 115, 32, 102, 105, 110, 100, 105, 110, 103, 32, 109, 101, 109, 111, 114, 121, 32, 108, 101, 97, 107, 115, 46, 10, 69, 118, 101, 110, 116, 69, 109, 105, 116, 116, 101, 114, 46, 100, 101, 102, 97, 117, 108, 116, 77, 97, 120, 76, 105, 115, 116, 101, 110, 101, 114, 115, 32, 61, 32, 49, 48, 59, 10, 10, 69, 118, 101, 110, 116, 69, 109, 105, 116, 116, 101, 114, 46, 105, 110, 105, 116, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 32, 123, 10, 32, 32, 116, 104, 105, 115, 46, 100, 111, 109, 97, 105, 110, 32, 61, 32, 110, 117, 108, 108, 59, 10, 32, 32, 105, 102, 32, 40, 69, 118, 101, 110, 116, 69, 109, 105, 116, 116, 101, 114, 46, 117, 115, 105, 110, 103, 68, 111, 109, 97, 105, 110, 115, 41, 32, 123, 10, 32, 32, 32, 32, 47, 47, 32, 105, 102, 32, 116, 104, 101, 114, 101, 32, 105, 115, 32, 97, 110, 32, 97, 99, 116, 105, 118, 101, 32, 100, 111, 109, 97, 105, 110, 44, 32, 116, 104, 101, 110, 32, 97, 116, 116, 97, 99, 104, 32, 116, 111, 32, 105, 116, 46, 10, 32, 32, 32, 32, 100, 111, 109, 97, 105, 110, 32, 61, 32, 100, 111, 109, 97, 105, 110, 32, 124, 124, 32, 114, 101, 113, 117, 105, 114, 101, 40, 39, 100, 111, 109, 97, 105, 110, 39, 41, 59, 10, 32, 32, 32, 32, 105, 102, 32, 40, 100, 111, 109, 97, 105, 110, 46, 97, 99, 116, 105, 118, 101, 32, 38, 38, 32, 33, 40, 116, 104, 105, 115, 32, 105, 110, 115, 116, 97, 110, 99, 101, 111, 102, 32, 100, 111, 109, 97, 105, 110, 46, 68, 111, 109, 97, 105, 110, 41, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 116, 104, 105, 115, 46, 100, 111, 109, 97, 105, 110, 32, 61, 32, 100, 111, 109, 97, 105, 110, 46, 97, 99, 116, 105, 118, 101, 59, 10, 32, 32, 32, 32, 125, 10, 32, 32, 125, 10, 10, 32, 32, 105, 102, 32, 40, 33, 116, 104, 105, 115, 46, 95, 101, 118, 101, 110, 116, 115, 32, 124, 124, 32, 116, 104, 105, 115, 46, 95, 101, 118, 101, 110, 116, 115, 32, 61, 61, 61, 32, 79, 98, 106, 101, 99, 116, 46, 103, 101, 116, 80, 114, 111, 116, 111, 116, 121, 112, 101, 79, 102, 40, 116, 104, 105, 115, 41, 46, 95, 101, 118, 101, 110, 116, 115, 41, 32, 123, 10, 32, 32, 32, 32, 116, 104, 105, 115, 46, 95, 101, 118, 101, 110, 116, 115, 32, 61, 32, 123, 125, 59, 10, 32, 32, 32, 32, 116, 104, 105, 115, 46, 95, 101, 118, 101, 110, 116, 115, 67, 111, 117, 110, 116, 32, 61, 32, 48, 59, 10, 32, 32, 125, 10, 10, 32, 32, 116, 104, 105, 115, 46, 95, 109, 97, 120, 76, 105, 115, 116, 101, 110, 101, 114, 115, 32, 61, 32, 116, 104, 105, 115, 46, 95, 109, 97, 120, 76, 105, 115, 116, 101, 110, 101, 114, 115, 32, 124, 124, 32, 117, 110, 100, 101, 102, 105, 110, 101, 100, 59, 10, 125, 59, 10, 10, 47, 47, 32, 79, 98, 118, 105, 111, 117, 115, 108, 121, 32, 110, 111, 116, 32, 97, 108, 108, 32, 69, 109, 105, 116, 116, 101, 114, 115, 32, 115, 104, 111, 117, 108, 100, 32, 98, 101, 32, 108, 105, 109, 105, 116, 101, 100, 32, 116, 111, 32, 49, 48, 46, 32, 84, 104, 105, 115, 32, 102, 117, 110, 99, 116, 105, 111, 110, 32, 97, 108, 108, 111, 119, 115, 10, 47, 47, 32, 116, 104, 97, 116, 32, 116, 111, 32, 98, 101, 32, 105, 110, 99, 114, 101, 97, 115, 101, 100, 46, 32, 83, 101, 116, 32, 116, 111, 32, 122, 101, 114, 111, 32, 102, 111, 114, 32, 117, 110, 108, 105, 109, 105, 116, 101, 100, 46, 10, 69, 118, 101, 110, 116, 69, 109, 105, 116, 116, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 115, 101, 116, 77, 97, 120, 76, 105, 115, 116, 101, 110, 101, 114, 115, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 32, 115, 101, 116, 77, 97, 120, 76, 105, 115, 116, 101, 110, 101, 114, 115, 40, 110, 41, 32, 123, 10, 32, 32, 105, 102, 32, 40, 116, 121, 112, 101, 111, 102, 32, 110, 32, 33, 61, 61, 32, 39, 110, 117, 109, 98, 101, 114, 39, 32, 124, 124, 32, 110, 32, 60, 32, 48, 32, 124, 124, 32, 105, 115, 78, 97, 78, 40, 110, 41, 41, 10, 32, 32, 32, 32, 116, 104, 114, 111, 119, 32, 110, 101, 119, 32, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 110, 32, 109, 117, 115, 116, 32, 98, 101, 32, 97, 32, 112, 111, 115, 105, 116, 105, 118, 101, 32, 110, 117, 109, 98, 101, 114, 39, 41, 59, 10, 32, 32, 116, 104, 105, 115, 46, 95, 109, 97, 120, 76, 105, 115, 116, 101, 110, 101, 114, 115, 32, 61, 32, 110, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 59, 10, 125, 59, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 36, 103, 101, 116, 77, 97, 120, 76, 105, 115, 116, 101, 110, 101, 114, 115, 40, 116, 104, 97, 116, 41, 32, 123, 10, 32, 32, 105, 102, 32, 40, 116, 104, 97, 116, 46, 95, 109, 97, 120, 76, 105, 115, 116, 101, 110, 101, 114, 115, 32, 61, 61, 61, 32, 117, 110, 100, 101, 102, 105, 110, 101, 100, 41, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 69, 118, 101, 110, 116, 69, 109, 105, 116, 116, 101, 114, 46, 100, 101, 102, 97, 117, 108, 116, 77, 97, 120, 76, 105, 115, 116, 101, 110, 101, 114, 115, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 116, 104, 97, 116, 46, 95, 109, 97, 120, 76, 105, 115, 116, 101, 110, 101, 114, 115, 59, 10, 125, 10, 10, 69, 118, 101, 110, 116, 69, 109, 105, 116, 116, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 103, 101, 116, 77, 97, 120, 76, 105, 115, 116, 101, 110, 101, 114, 115, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 32, 103, 101, 116, 77, 97, 120, 76, 105, 115, 116, 101, 110, 101, 114, 115, 40, 41, 32, 123, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 36, 103, 101, 116, 77, 97, 120, 76, 105, 115, 116, 101, 110, 101, 114, 115, 40, 116, 104, 105, 115, 41, 59, 10, 125, 59, 10, 10, 47, 47, 32, 84, 104, 101, 115, 101, 32, 115, 116, 97, 110, 100, 97, 108, 111, 110, 101, 32, 101, 109, 105, 116, 42, 32, 102, 117, 110, 99, 116, 105, 111, 110, 115, 32, 97, 114, 101, 32, 117, 115, 101, 100, 32, 116, 111, 32, 111, 112, 116, 105, 109, 105, 122, 101, 32, 99, 97, 108, 108, 105, 110, 103, 32, 111, 102, 32, 101, 118, 101, 110, 116, 10, 47, 47, 32, 104, 97, 110, 100, 108, 101, 114, 115, 32, 102, 111, 114, 32, 102, 97, 115, 116, 32, 99, 97, 115, 101, 115, 32, 98, 101, 99, 97, 117, 115, 101, 32, 101, 109, 105, 116, 40, 41, 32, 105, 116, 115, 101, 108, 102, 32, 111, 102, 116, 101, 110, 32, 104, 97, 115, 32, 97, 32, 118, 97, 114, 105, 97, 98, 108, 101, 32, 110, 117, 109, 98, 101, 114, 32, 111, 102, 10, 47, 47, 32, 97, 114, 103, 117, 109, 101, 110, 116, 115, 32, 97, 110, 100, 32, 99, 97, 110, 32, 98, 101, 32, 100, 101, 111, 112, 116, 105, 109, 105, 122, 101, 100, 32, 98, 101, 99, 97, 117, 115, 101, 32, 111, 102, 32, 116, 104, 97, 116, 46, 32, 84, 104, 101, 115, 101, 32, 102, 117, 110, 99, 116, 105, 111, 110, 115, 32, 97, 108, 119, 97, 121, 115, 32, 104, 97, 118, 101, 10, 47, 47, 32, 116, 104, 101, 32, 115, 97, 109, 101, 32, 110, 117, 109, 98, 101, 114, 32, 111, 102, 32, 97, 114, 103, 117, 109, 101, 110, 116, 115, 32, 97, 110, 100, 32, 116, 104, 117, 115, 32, 100, 111, 32, 110, 111, 116, 32, 103, 101, 116, 32, 100, 101, 111, 112, 116, 105, 109, 105, 122, 101, 100, 44, 32, 115, 111, 32, 116, 104, 101, 32, 99, 111, 100, 101, 10, 47, 47, 32, 105, 110, 115, 105, 100, 101, 32, 116, 104, 101, 109, 32, 99, 97, 110, 32, 101, 120, 101, 99, 117, 116, 101, 32, 102, 97, 115, 116, 101, 114, 46, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 101, 109, 105, 116, 78, 111, 110, 101, 40, 104, 97, 110, 100, 108, 101, 114, 44, 32, 105, 115, 70, 110, 44, 32, 115, 101, 108, 102, 41, 32, 123, 10, 32, 32, 105, 102, 32, 40, 105, 115, 70, 110, 41, 10, 32, 32, 32, 32, 104, 97, 110, 100, 108, 101, 114, 46, 99, 97, 108, 108, 40, 115, 101, 108, 102, 41, 59, 10, 32, 32, 101, 108, 115, 101, 32, 123, 10, 32, 32, 32, 32, 118, 97, 114, 32, 108, 101, 110, 32, 61, 32, 104, 97, 110, 100, 108, 101, 114, 46, 108, 101, 110, 103, 116, 104, 59, 10, 32, 32, 32, 32, 118, 97, 114, 32, 108, 105, 115, 116, 101, 110, 101, 114, 115, 32, 61, 32, 97, 114, 114, 97, 121, 67, 108, 111, 110, 101, 40, 104, 97, 110, 100, 108, 101, 114, 44, 32, 108, 101, 110, 41, 59, 10, 32, 32, 32, 32, 102, 111, 114, 32, 40, 118, 97, 114, 32, 105, 32, 61, 32, 48, 59, 32, 105, 32, 60, 32, 108, 101, 110, 59, 32, 43, 43, 105, 41, 10, 32, 32, 32, 32, 32, 32, 108, 105, 115, 116, 101, 110, 101, 114, 115, 91, 105, 93, 46, 99, 97, 108, 108, 40, 115, 101, 108, 102, 41, 59, 10, 32, 32, 125, 10, 125, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 101, 109, 105, 116, 79, 110, 101, 40, 104, 97, 110, 100, 108, 101, 114, 44, 32, 105, 115, 70, 110, 44, 32, 115, 101, 108, 102, 44, 32, 97, 114, 103, 49, 41, 32, 123, 10, 32, 32, 105, 102, 32, 40, 105, 115, 70, 110, 41, 10, 32, 32, 32, 32, 104, 97, 110, 100, 108, 101, 114, 46, 99, 97, 108, 108, 40, 115, 101, 108, 102, 44, 32, 97, 114, 103, 49, 41, 59, 10, 32, 32, 101, 108, 115, 101, 32, 123, 10, 32, 32, 32, 32, 118, 97, 114, 32, 108, 101, 110, 32, 61, 32, 104, 97, 110, 100, 108, 101, 114, 46, 108, 101, 110, 103, 116, 104, 59, 10, 32, 32, 32, 32, 118, 97, 114, 32, 108, 105, 115, 116, 101, 110, 101, 114, 115, 32, 61, 32, 97, 114, 114, 97, 121, 67, 108, 111, 110, 101, 40, 104, 97, 110, 100, 108, 101, 114, 44, 32, 108, 101, 110, 41, 59, 10, 32, 32, 32, 32, 102, 111, 114, 32, 40, 118, 97, 114, 32, 105, 32, 61, 32, 48, 59, 32, 105, 32, 60, 32, 108, 101, 110, 59, 32, 43, 43, 105, 41, 10, 32, 32, 32, 32, 32, 32, 108, 105, 115, 116, 101, 110, 101, 114, 115, 91, 105, 93, 46, 99, 97, 108, 108, 40, 115, 101, 108, 102, 44, 32, 97, 114, 103, 49, 41, 59, 10, 32, 32, 125, 10, 125, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 101, 109, 105, 116, 84, 119, 111, 40, 104, 97, 110, 100, 108, 101, 114, 44, 32, 105, 115, 70, 110, 44, 32, 115, 101, 108, 102, 44, 32, 97, 114, 103, 49, 44, 32, 97, 114, 103, 50, 41, 32, 123, 10, 32, 32, 105, 102, 32, 40, 105, 115, 70, 110, 41, 10, 32, 32, 32, 32, 104, 97, 110, 100, 108, 101, 114, 46, 99, 97, 108, 108, 40, 115, 101, 108, 102, 44, 32, 97, 114, 103, 49, 44, 32, 97, 114, 103, 50, 41, 59, 10, 32, 32, 101, 108, 115, 101, 32, 123, 10, 32, 32, 32, 32, 118, 97, 114, 32, 108, 101, 110, 32, 61, 32, 104, 97, 110, 100, 108, 101, 114, 46, 108, 101, 110, 103, 116, 104, 59, 10, 32, 32, 32, 32, 118, 97, 114, 32, 108, 105, 115, 116, 101, 110, 101, 114, 115, 32, 61, 32, 97, 114, 114, 97, 121, 67, 108, 111, 110, 101, 40, 104, 97, 110, 100, 108, 101, 114, 44, 32, 108, 101, 110, 41, 59, 10, 32, 32, 32, 32, 102, 111, 114, 32, 40, 118, 97, 114, 32, 105, 32, 61, 32, 48, 59, 32, 105, 32, 60, 32, 108, 101, 110, 59, 32, 43, 43, 105, 41, 10, 32, 32, 32, 32, 32, 32, 108, 105, 115, 116, 101, 110, 101, 114, 115, 91, 105, 93, 46, 99, 97, 108, 108, 40, 115, 101, 108, 102, 44, 32, 97, 114, 103, 49, 44, 32, 97, 114, 103, 50, 41, 59, 10, 32, 32, 125, 10, 125, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 101, 109, 105, 116, 84, 104, 114, 101, 101, 40, 104, 97, 110, 100, 108, 101, 114, 44, 32, 105, 115, 70, 110, 44, 32, 115, 101, 108, 102, 44, 32, 97, 114, 103, 49, 44, 32, 97, 114, 103, 50, 44, 32, 97, 114, 103, 51, 41, 32, 123, 10, 32, 32, 105, 102, 32, 40, 105, 115, 70, 110, 41, 10, 32, 32, 32, 32, 104, 97, 110, 100, 108, 101, 114, 46, 99, 97, 108, 108, 40, 115, 101, 108, 102, 44, 32, 97, 114, 103, 49, 44, 32, 97, 114, 103, 50, 44, 32, 97, 114, 103, 51, 41, 59, 10, 32, 32, 101, 108, 115, 101, 32, 123, 10, 32, 32, 32, 32, 118, 97, 114, 32, 108, 101, 110, 32, 61, 32, 104, 97, 110, 100, 108, 101, 114, 46, 108, 101, 110, 103, 116, 104, 59, 10, 32, 32, 32, 32, 118, 97, 114, 32, 108, 105, 115, 116, 101, 110, 101, 114, 115, 32, 61, 32, 97, 114, 114, 97, 121, 67, 108, 111, 110, 101, 40, 104, 97, 110, 100, 108, 101, 114, 44, 32, 108, 101, 110, 41, 59, 10, 32, 32, 32, 32, 102, 111, 114, 32, 40, 118, 97, 114, 32, 105, 32, 61, 32, 48, 59, 32, 105, 32, 60, 32, 108, 101, 110, 59, 32, 43, 43, 105, 41, 10, 32, 32, 32, 32, 32, 32, 108, 105, 115, 116, 101, 110, 101, 114, 115, 91, 105, 93, 46, 99, 97, 108, 108, 40, 115, 101, 108, 102, 44, 32, 97, 114, 103, 49, 44, 32, 97, 114, 103, 50, 44, 32, 97, 114, 103, 51, 41, 59, 10, 32, 32, 125, 10, 125, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 101, 109, 105, 116, 77, 97, 110, 121, 40, 104, 97, 110, 100, 108, 101, 114, 44, 32, 105, 115, 70, 110, 44, 32, 115, 101, 108, 102, 44, 32, 97, 114, 103, 115, 41, 32, 123, 10, 32, 32, 105, 102, 32, 40, 105, 115, 70, 110, 41, 10, 32, 32, 32, 32, 104, 97, 110, 100, 108, 101, 114, 46, 97, 112, 112, 108, 121, 40, 115, 101, 108, 102, 44, 32, 97, 114, 103, 115, 41, 59, 10, 32, 32, 101, 108, 115, 101, 32, 123, 10, 32, 32, 32, 32, 118, 97, 114, 32, 108, 101, 110, 32, 61, 32, 104, 97, 110, 100, 108, 101, 114, 46, 108, 101, 110, 103, 116, 104, 59, 10, 32, 32, 32, 32, 118, 97, 114, 32, 108, 105, 115, 116, 101, 110, 101, 114, 115, 32, 61, 32, 97, 114, 114, 97, 121, 67, 108, 111, 110, 101, 40, 104, 97, 110, 100, 108, 101, 114, 44, 32, 108, 101, 110, 41, 59, 10, 32, 32, 32, 32, 102, 111, 114, 32, 40, 118, 97, 114, 32, 105, 32, 61, 32, 48, 59, 32, 105, 32, 60, 32, 108, 101, 110, 59, 32, 43, 43, 105, 41, 10, 32, 32, 32, 32, 32, 32, 108, 105, 115, 116, 101, 110, 101, 114, 115, 91, 105, 93, 46, 97, 112, 112, 108, 121, 40, 115, 101, 108, 102, 44, 32, 97, 114, 103, 115, 41, 59, 10, 32, 32, 125, 10, 125, 10, 10, 69, 118, 101, 110, 116, 69, 109, 105, 116, 116, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 101, 109, 105, 116, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 32, 101, 109, 105, 116, 40, 116, 121, 112, 101, 41, 32, 123, 10, 32, 32, 118, 97, 114, 32, 101, 114, 44, 32, 104, 97, 110, 100, 108, 101, 114, 44, 32, 108, 101, 110, 44, 32, 97, 114, 103, 115, 44, 32, 105, 44, 32, 101, 118, 101, 110, 116, 115, 44, 32, 100, 111, 109, 97, 105, 110, 59, 10, 32, 32, 118, 97, 114, 32, 110, 101, 101, 100, 68, 111, 109, 97, 105, 110, 69, 120, 105, 116, 32, 61, 32, 102, 97, 108, 115, 101, 59, 10, 32, 32, 118, 97, 114, 32, 100, 111, 69, 114, 114, 111, 114, 32, 61, 32, 40, 116, 121, 112, 101, 32, 61, 61, 61, 32, 39, 101, 114, 114, 111, 114, 39, 41, 59, 10, 10, 32, 32, 101, 118, 101, 110, 116, 115, 32, 61, 32, 116, 104, 105, 115, 46, 95, 101, 118, 101, 110, 116, 115, 59, 10, 32, 32, 105, 102, 32, 40, 101, 118, 101, 110, 116, 115, 41, 10, 32, 32, 32, 32, 100, 111, 69, 114, 114, 111, 114, 32, 61, 32, 40, 100, 111, 69, 114, 114, 111, 114, 32, 38, 38, 32, 101, 118, 101, 110, 116, 115, 46, 101, 114, 114, 111, 114, 32, 61, 61, 32, 110, 117, 108, 108, 41, 59, 10, 32, 32, 101, 108, 115, 101, 32, 105, 102, 32, 40, 33, 100, 111, 69, 114, 114, 111, 114, 41, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 102, 97, 108, 115, 101, 59, 10, 10, 32, 32, 100, 111, 109, 97, 105, 110, 32, 61, 32, 116, 104, 105, 115, 46, 100, 111, 109, 97, 105, 110, 59, 10, 10, 32, 32, 47, 47, 32, 73, 102, 32, 116, 104, 101, 114, 101, 32, 105, 115, 32, 110, 111, 32, 39, 101, 114, 114, 111, 114, 39, 32, 101, 118, 101, 110, 116, 32, 108, 105, 115, 116, 101, 110, 101, 114, 32, 116, 104, 101, 110, 32, 116, 104, 114, 111, 119, 46, 10, 32, 32, 105, 102, 32, 40, 100, 111, 69, 114, 114, 111, 114, 41, 32, 123, 10, 32, 32, 32, 32, 101, 114, 32, 61, 32, 97, 114, 103, 117, 109, 101, 110, 116, 115, 91, 49, 93, 59, 10, 32, 32, 32, 32, 105, 102, 32, 40, 100, 111, 109, 97, 105, 110, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 105, 102, 32, 40, 33, 101, 114, 41, 10, 32, 32, 32, 32, 32, 32, 32, 32, 101, 114, 32, 61, 32, 110, 101, 119, 32, 69, 114, 114, 111, 114, 40, 39, 85, 110, 99, 97, 117, 103, 104, 116, 44, 32, 117, 110, 115, 112, 101, 99, 105, 102, 105, 101, 100, 32, 34, 101, 114, 114, 111, 114, 34, 32, 101, 118, 101, 110, 116, 46, 39, 41, 59, 10, 32, 32, 32, 32, 32, 32, 101, 114, 46, 100, 111, 109, 97, 105, 110, 69, 109, 105, 116, 116, 101, 114, 32, 61, 32, 116, 104, 105, 115, 59, 10, 32, 32, 32, 32, 32, 32, 101, 114, 46, 100, 111, 109, 97, 105, 110, 32, 61, 32, 100, 111, 109, 97, 105, 110, 59, 10, 32, 32, 32, 32, 32, 32, 101, 114, 46, 100, 111, 109, 97, 105, 110, 84, 104, 114, 111, 119, 110, 32, 61, 32, 102, 97, 108, 115, 101, 59, 10, 32, 32, 32, 32, 32, 32, 100, 111, 109, 97, 105, 110, 46, 101, 109, 105, 116, 40, 39, 101, 114, 114, 111, 114, 39, 44, 32, 101, 114, 41, 59, 10, 32, 32, 32, 32, 125, 32, 101, 108, 115, 101, 32, 105, 102, 32, 40, 101, 114, 32, 105, 110, 115, 116, 97, 110, 99, 101, 111, 102, 32, 69, 114, 114, 111, 114, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 116, 104, 114, 111, 119, 32, 101, 114, 59, 32, 47, 47, 32, 85, 110, 104, 97, 110, 100, 108, 101, 100, 32, 39, 101, 114, 114, 111, 114, 39, 32, 101, 118, 101, 110, 116, 10, 32, 32, 32, 32, 125, 32, 101, 108, 115, 101, 32, 123, 10, 32, 32, 32, 32, 32, 32, 47, 47, 32, 65, 116, 32, 108, 101, 97, 115, 116, 32, 103, 105, 118, 101, 32, 115, 111, 109, 101, 32, 107, 105, 110, 100, 32, 111, 102, 32, 99, 111, 110, 116, 101, 120, 116, 32, 116, 111, 32, 116, 104, 101, 32, 117, 115, 101, 114, 10, 32, 32, 32, 32, 32, 32, 118, 97, 114, 32, 101, 114, 114, 32, 61, 32, 110, 101, 119, 32, 69, 114, 114, 111, 114, 40, 39, 85, 110, 99, 97, 117, 103, 104, 116, 44, 32, 117, 110, 115, 112, 101, 99, 105, 102, 105, 101, 100, 32, 34, 101, 114, 114, 111, 114, 34, 32, 101, 118, 101, 110, 116, 46, 32, 40, 39, 32, 43, 32, 101, 114, 32, 43, 32, 39, 41, 39, 41, 59, 10, 32, 32, 32, 32, 32, 32, 101, 114, 114, 46, 99, 111, 110, 116, 101, 120, 116, 32, 61, 32, 101, 114, 59, 10, 32, 32, 32, 32, 32, 32, 116, 104, 114, 111, 119, 32, 101, 114, 114, 59, 10, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 102, 97, 108, 115, 101, 59, 10, 32, 32, 125, 10, 10, 32, 32, 104, 97, 110, 100, 108, 101, 114, 32, 61, 32, 101, 118, 101, 110, 116, 115, 91, 116, 121, 112, 101, 93, 59, 10, 10, 32, 32, 105, 102, 32, 40, 33, 104, 97, 110, 100, 108, 101, 114, 41, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 102, 97, 108, 115, 101, 59, 10, 10, 32, 32, 105, 102, 32, 40, 100, 111, 109, 97, 105, 110, 32, 38, 38, 32, 116, 104, 105, 115, 32, 33, 61, 61, 32, 112, 114, 111, 99, 101, 115, 115, 41, 32, 123, 10, 32, 32, 32, 32, 100, 111, 109, 97, 105, 110, 46, 101, 110, 116, 101, 114, 40, 41, 59, 10, 32, 32, 32, 32, 110, 101, 101, 100, 68, 111, 109, 97, 105, 110, 69, 120, 105, 116, 32, 61, 32, 116, 114, 117, 101, 59, 10, 32, 32, 125, 10, 10, 32, 32, 118, 97, 114, 32, 105, 115, 70, 110, 32, 61, 32, 116, 121, 112, 101, 111, 102, 32, 104, 97, 110, 100, 108, 101, 114, 32, 61, 61, 61, 32, 39, 102, 117, 110, 99, 116, 105, 111, 110, 39, 59, 10, 32, 32, 108, 101, 110, 32, 61, 32, 97, 114, 103, 117, 109, 101, 110, 116, 115, 46, 108, 101, 110, 103, 116, 104, 59, 10, 32, 32, 115, 119, 105, 116, 99, 104, 32, 40, 108, 101, 110, 41, 32, 123, 10, 32, 32, 32, 32, 47, 47, 32, 102, 97, 115, 116, 32, 99, 97, 115, 101, 115, 10, 32, 32, 32, 32, 99, 97, 115, 101, 32, 49, 58, 10, 32, 32, 32, 32, 32, 32, 101, 109, 105, 116, 78, 111, 110, 101, 40, 104, 97, 110, 100, 108, 101, 114, 44, 32, 105, 115, 70, 110, 44, 32, 116, 104, 105, 115, 41, 59, 10, 32, 32, 32, 32, 32, 32, 98, 114, 101, 97, 107, 59, 10, 32, 32, 32, 32, 99, 97, 115, 101, 32, 50, 58, 10, 32, 32, 32, 32, 32, 32, 101, 109, 105, 116, 79, 110, 101, 40, 104, 97, 110, 100, 108, 101, 114, 44, 32, 105, 115, 70, 110, 44, 32, 116, 104, 105, 115, 44, 32, 97, 114, 103, 117, 109, 101, 110, 116, 115, 91, 49, 93, 41, 59, 10, 32, 32, 32, 32, 32, 32, 98, 114, 101, 97, 107, 59, 10, 32, 32, 32, 32, 99, 97, 115, 101, 32, 51, 58, 10, 32, 32, 32, 32, 32, 32, 101, 109, 105, 116, 84, 119, 111, 40, 104, 97, 110, 100, 108, 101, 114, 44, 32, 105, 115, 70, 110, 44, 32, 116, 104, 105, 115, 44, 32, 97, 114, 103, 117, 109, 101, 110, 116, 115, 91, 49, 93, 44, 32, 97, 114, 103, 117, 109, 101, 110, 116, 115, 91, 50, 93, 41, 59, 10, 32, 32, 32, 32, 32, 32, 98, 114, 101, 97, 107, 59, 10, 32, 32, 32, 32, 99, 97, 115, 101, 32, 52, 58, 10, 32, 32, 32, 32, 32, 32, 101, 109, 105, 116, 84, 104, 114, 101, 101, 40, 104, 97, 110, 100, 108, 101, 114, 44, 32, 105, 115, 70, 110, 44, 32, 116, 104, 105, 115, 44, 32, 97, 114, 103, 117, 109, 101, 110, 116, 115, 91, 49, 93, 44, 32, 97, 114, 103, 117, 109, 101, 110, 116, 115, 91, 50, 93, 44, 32, 97, 114, 103, 117, 109, 101, 110, 116, 115, 91, 51, 93, 41, 59, 10, 32, 32, 32, 32, 32, 32, 98, 114, 101, 97, 107, 59, 10, 32, 32, 32, 32, 47, 47, 32, 115, 108, 111, 119, 101, 114, 10, 32, 32, 32, 32, 100, 101, 102, 97, 117, 108, 116, 58, 10, 32, 32, 32, 32, 32, 32, 97, 114, 103, 115, 32, 61, 32, 110, 101, 119, 32, 65, 114, 114, 97, 121, 40, 108, 101, 110, 32, 45, 32, 49, 41, 59, 10, 32, 32, 32, 32, 32, 32, 102, 111, 114, 32, 40, 105, 32, 61, 32, 49, 59, 32, 105, 32, 60, 32, 108, 101, 110, 59, 32, 105, 43, 43, 41, 10, 32, 32, 32, 32, 32, 32, 32, 32, 97, 114, 103, 115, 91, 105, 32, 45, 32, 49, 93, 32, 61, 32, 97, 114, 103, 117, 109, 101, 110, 116, 115, 91, 105, 93, 59, 10, 32, 32, 32, 32, 32, 32, 101, 109, 105, 116, 77, 97, 110, 121, 40, 104, 97, 110, 100, 108, 101, 114, 44, 32, 105, 115, 70, 110, 44, 32, 116, 104, 105, 115, 44, 32, 97, 114, 103, 115, 41, 59, 10, 32, 32, 125, 10, 10, 32, 32, 105, 102, 32, 40, 110, 101, 101, 100, 68, 111, 109, 97, 105, 110, 69, 120, 105, 116, 41, 10, 32, 32, 32, 32, 100, 111, 109, 97, 105, 110, 46, 101, 120, 105, 116, 40, 41, 59, 10, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 116, 114, 117, 101, 59, 10, 125, 59, 10, 10, 69, 118, 101, 110, 116, 69, 109, 105, 116, 116, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 97, 100, 100, 76, 105, 115, 116, 101, 110, 101, 114, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 32, 97, 100, 100, 76, 105, 115, 116, 101, 110, 101, 114, 40, 116, 121, 112, 101, 44, 32, 108, 105, 115, 116, 101, 110, 101, 114, 41, 32, 123, 10, 32, 32, 118, 97, 114, 32, 109, 59, 10, 32, 32, 118, 97, 114, 32, 101, 118, 101, 110, 116, 115, 59, 10, 32, 32, 118, 97, 114, 32, 101, 120, 105, 115, 116, 105, 110, 103, 59, 10, 10, 32, 32, 105, 102, 32, 40, 116, 121, 112, 101, 111, 102, 32, 108, 105, 115, 116, 101, 110, 101, 114, 32, 33, 61, 61, 32, 39, 102, 117, 110, 99, 116, 105, 111, 110, 39, 41, 10, 32, 32, 32, 32, 116, 104, 114, 111, 119, 32, 110, 101, 119, 32, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 108, 105, 115, 116, 101, 110, 101, 114, 32, 109, 117, 115, 116, 32, 98, 101, 32, 97, 32, 102, 117, 110, 99, 116, 105, 111, 110, 39, 41, 59, 10, 10, 32, 32, 101, 118, 101, 110, 116, 115, 32, 61, 32, 116, 104, 105, 115, 46, 95, 101, 118, 101, 110, 116, 115, 59, 10, 32, 32, 105, 102, 32, 40, 33, 101, 118, 101, 110, 116, 115, 41, 32, 123, 10, 32, 32, 32, 32, 101, 118, 101, 110, 116, 115, 32, 61, 32, 116, 104, 105, 115, 46, 95, 101, 118, 101, 110, 116, 115, 32, 61, 32, 123, 125, 59, 10, 32, 32, 32, 32, 116, 104, 105, 115, 46, 95, 101, 118, 101, 110, 116, 115, 67, 111, 117, 110, 116, 32, 61, 32, 48, 59, 10, 32, 32, 125, 32, 101, 108, 115, 101, 32, 123, 10, 32, 32, 32, 32, 47, 47, 32, 84, 111, 32, 97, 118, 111, 105, 100, 32, 114, 101, 99, 117, 114, 115, 105, 111, 110, 32, 105, 110, 32, 116, 104, 101, 32, 99, 97, 115, 101, 32, 116, 104, 97, 116, 32, 116, 121, 112, 101, 32, 61, 61, 61, 32, 34, 110, 101, 119, 76, 105, 115, 116, 101, 110, 101, 114, 34, 33, 32, 66, 101, 102, 111, 114, 101, 10, 32, 32, 32, 32, 47, 47, 32, 97, 100, 100, 105, 110, 103, 32, 105, 116, 32, 116, 111, 32, 116, 104, 101, 32, 108, 105, 115, 116, 101, 110, 101, 114, 115, 44, 32, 102, 105, 114, 115, 116, 32, 101, 109, 105, 116, 32, 34, 110, 101, 119, 76, 105, 115, 116, 101, 110, 101, 114, 34, 46, 10, 32, 32, 32, 32, 105, 102, 32, 40, 101, 118, 101, 110, 116, 115, 46, 110, 101, 119, 76, 105, 115, 116, 101, 110, 101, 114, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 116, 104, 105, 115, 46, 101, 109, 105, 116, 40, 39, 110, 101, 119, 76, 105, 115, 116, 101, 110, 101, 114, 39, 44, 32, 116, 121, 112, 101, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 108, 105, 115, 116, 101, 110, 101, 114, 46, 108, 105, 115, 116, 101, 110, 101, 114, 32, 63, 32, 108, 105, 115, 116, 101, 110, 101, 114, 46, 108, 105, 115, 116, 101, 110, 101, 114, 32, 58, 32, 108, 105, 115, 116, 101, 110, 101, 114, 41, 59, 10, 10, 32, 32, 32, 32, 32, 32, 47, 47, 32, 82, 101, 45, 97, 115, 115, 105, 103, 110, 32, 96, 101, 118, 101, 110, 116, 115, 96, 32, 98, 101, 99, 97, 117, 115, 101, 32, 97, 32, 110, 101, 119, 76, 105, 115, 116, 101, 110, 101, 114, 32, 104, 97, 110, 100, 108, 101, 114, 32, 99, 111, 117, 108, 100, 32, 104, 97, 118, 101, 32, 99, 97, 117, 115, 101, 100, 32, 116, 104, 101, 10, 32, 32, 32, 32, 32, 32, 47, 47, 32, 116, 104, 105, 115, 46, 95, 101, 118, 101, 110, 116, 115, 32, 116, 111, 32, 98, 101, 32, 97, 115, 115, 105, 103, 110, 101, 100, 32, 116, 111, 32, 97, 32, 110, 101, 119, 32, 111, 98, 106, 101, 99, 116, 10, 32, 32, 32, 32, 32, 32, 101, 118, 101, 110, 116, 115, 32, 61, 32, 116, 104, 105, 115, 46, 95, 101, 118, 101, 110, 116, 115, 59, 10, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 101, 120, 105, 115, 116, 105, 110, 103, 32, 61, 32, 101, 118, 101, 110, 116, 115, 91, 116, 121, 112, 101, 93, 59, 10, 32, 32, 125, 10, 10, 32, 32, 105, 102, 32, 40, 33, 101, 120, 105, 115, 116, 105, 110, 103, 41, 32, 123, 10, 32, 32, 32, 32, 47, 47, 32, 79, 112, 116, 105, 109, 105, 122, 101, 32, 116, 104, 101, 32, 99, 97, 115, 101, 32, 111, 102, 32, 111, 110, 101, 32, 108, 105, 115, 116, 101, 110, 101, 114, 46, 32, 68, 111, 110, 39, 116, 32, 110, 101, 101, 100, 32, 116, 104, 101, 32, 101, 120, 116, 114, 97, 32, 97, 114, 114, 97, 121, 32, 111, 98, 106, 101, 99, 116, 46, 10, 32, 32, 32, 32, 101, 120, 105, 115, 116, 105, 110, 103, 32, 61, 32, 101, 118, 101, 110, 116, 115, 91, 116, 121, 112, 101, 93, 32, 61, 32, 108, 105, 115, 116, 101, 110, 101, 114, 59, 10, 32, 32, 32, 32, 43, 43, 116, 104, 105, 115, 46, 95, 101, 118, 101, 110, 116, 115, 67, 111, 117, 110, 116, 59, 10, 32, 32, 125, 32, 101, 108, 115, 101, 32, 123, 10, 32, 32, 32, 32, 105, 102, 32, 40, 116, 121, 112, 101, 111, 102, 32, 101, 120, 105, 115, 116, 105, 110, 103, 32, 61, 61, 61, 32, 39, 102, 117, 110, 99, 116, 105, 111, 110, 39, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 47, 47, 32, 65, 100, 100, 105, 110, 103, 32, 116, 104, 101, 32, 115, 101, 99, 111, 110, 100, 32, 101, 108, 101, 109, 101, 110, 116, 44, 32, 110, 101, 101, 100, 32, 116, 111, 32, 99, 104, 97, 110, 103, 101, 32, 116, 111, 32, 97, 114, 114, 97, 121, 46, 10, 32, 32, 32, 32, 32, 32, 101, 120, 105, 115, 116, 105, 110, 103, 32, 61, 32, 101, 118, 101, 110, 116, 115, 91, 116, 121, 112, 101, 93, 32, 61, 32, 91, 101, 120, 105, 115, 116, 105, 110, 103, 44, 32, 108, 105, 115, 116, 101, 110, 101, 114, 93, 59, 10, 32, 32, 32, 32, 125, 32, 101, 108, 115, 101, 32, 123, 10, 32, 32, 32, 32, 32, 32, 47, 47, 32, 73, 102, 32, 119, 101, 39, 118, 101, 32, 97, 108, 114, 101, 97, 100, 121, 32, 103, 111, 116, 32, 97, 110, 32, 97, 114, 114, 97, 121, 44, 32, 106, 117, 115, 116, 32, 97, 112, 112, 101, 110, 100, 46, 10, 32, 32, 32, 32, 32, 32, 101, 120, 105, 115, 116, 105, 110, 103, 46, 112, 117, 115, 104, 40, 108, 105, 115, 116, 101, 110, 101, 114, 41, 59, 10, 32, 32, 32, 32, 125, 10, 10, 32, 32, 32, 32, 47, 47, 32, 67, 104, 101, 99, 107, 32, 102, 111, 114, 32, 108, 105, 115, 116, 101, 110, 101, 114, 32, 108, 101, 97, 107, 10, 32, 32, 32, 32, 105, 102, 32, 40, 33, 101, 120, 105, 115, 116, 105, 110, 103, 46, 119, 97, 114, 110, 101, 100, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 109, 32, 61, 32, 36, 103, 101, 116, 77, 97, 120, 76, 105, 115, 116, 101, 110, 101, 114, 115, 40, 116, 104, 105, 115, 41, 59, 10, 32, 32, 32, 32, 32, 32, 105, 102, 32, 40, 109, 32, 38, 38, 32, 109, 32, 62, 32, 48, 32, 38, 38, 32, 101, 120, 105, 115, 116, 105, 110, 103, 46, 108, 101, 110, 103, 116, 104, 32, 62, 32, 109, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 101, 120, 105, 115, 116, 105, 110, 103, 46, 119, 97, 114, 110, 101, 100, 32, 61, 32, 116, 114, 117, 101, 59, 10, 32, 32, 32, 32, 32, 32, 32, 32, 99, 111, 110, 115, 111, 108, 101, 46, 101, 114, 114, 111, 114, 40, 39, 40, 110, 111, 100, 101, 41, 32, 119, 97, 114, 110, 105, 110, 103, 58, 32, 112, 111, 115, 115, 105, 98, 108, 101, 32, 69, 118, 101, 110, 116, 69, 109, 105, 116, 116, 101, 114, 32, 109, 101, 109, 111, 114, 121, 32, 39, 32, 43, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 39, 108, 101, 97, 107, 32, 100, 101, 116, 101, 99, 116, 101, 100, 46, 32, 37, 100, 32, 37, 115, 32, 108, 105, 115, 116, 101, 110, 101, 114, 115, 32, 97, 100, 100, 101, 100, 46, 32, 39, 32, 43, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 39, 85, 115, 101, 32, 101, 109, 105, 116, 116, 101, 114, 46, 115, 101, 116, 77, 97, 120, 76, 105, 115, 116, 101, 110, 101, 114, 115, 40, 41, 32, 116, 111, 32, 105, 110, 99, 114, 101, 97, 115, 101, 32, 108, 105, 109, 105, 116, 46, 39, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 101, 120, 105, 115, 116, 105, 110, 103, 46, 108, 101, 110, 103, 116, 104, 44, 32, 116, 121, 112, 101, 41, 59, 10, 32, 32, 32, 32, 32, 32, 32, 32, 99, 111, 110, 115, 111, 108, 101, 46, 116, 114, 97, 99, 101, 40, 41, 59, 10, 32, 32, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 125, 10, 32, 32, 125, 10, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 59, 10, 125, 59, 10, 10, 69, 118, 101, 110, 116, 69, 109, 105, 116, 116, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 111, 110, 32, 61, 32, 69, 118, 101, 110, 116, 69, 109, 105, 116, 116, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 97, 100, 100, 76, 105, 115, 116, 101, 110, 101, 114, 59, 10, 10, 69, 118, 101, 110, 116, 69, 109, 105, 116, 116, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 111, 110, 99, 101, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 32, 111, 110, 99, 101, 40, 116, 121, 112, 101, 44, 32, 108, 105, 115, 116, 101, 110, 101, 114, 41, 32, 123, 10, 32, 32, 105, 102, 32, 40, 116, 121, 112, 101, 111, 102, 32, 108, 105, 115, 116, 101, 110, 101, 114, 32, 33, 61, 61, 32, 39, 102, 117, 110, 99, 116, 105, 111, 110, 39, 41, 10, 32, 32, 32, 32, 116, 104, 114, 111, 119, 32, 110, 101, 119, 32, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 108, 105, 115, 116, 101, 110, 101, 114, 32, 109, 117, 115, 116, 32, 98, 101, 32, 97, 32, 102, 117, 110, 99, 116, 105, 111, 110, 39, 41, 59, 10, 10, 32, 32, 118, 97, 114, 32, 102, 105, 114, 101, 100, 32, 61, 32, 102, 97, 108, 115, 101, 59, 10, 10, 32, 32, 102, 117, 110, 99, 116, 105, 111, 110, 32, 103, 40, 41, 32, 123, 10, 32, 32, 32, 32, 116, 104, 105, 115, 46, 114, 101, 109, 111, 118, 101, 76, 105, 115, 116, 101, 110, 101, 114, 40, 116, 121, 112, 101, 44, 32, 103, 41, 59, 10, 10, 32, 32, 32, 32, 105, 102, 32, 40, 33, 102, 105, 114, 101, 100, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 102, 105, 114, 101, 100, 32, 61, 32, 116, 114, 117, 101, 59, 10, 32, 32, 32, 32, 32, 32, 108, 105, 115, 116, 101, 110, 101, 114, 46, 97, 112, 112, 108, 121, 40, 116, 104, 105, 115, 44, 32, 97, 114, 103, 117, 109, 101, 110, 116, 115, 41, 59, 10, 32, 32, 32, 32, 125, 10, 32, 32, 125, 10, 10, 32, 32, 103, 46, 108, 105, 115, 116, 101, 110, 101, 114, 32, 61, 32, 108, 105, 115, 116, 101, 110, 101, 114, 59, 10, 32, 32, 116, 104, 105, 115, 46, 111, 110, 40, 116, 121, 112, 101, 44, 32, 103, 41, 59, 10, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 59, 10, 125, 59, 10, 10, 47, 47, 32, 101, 109, 105, 116, 115, 32, 97, 32, 39, 114, 101, 109, 111, 118, 101, 76, 105, 115, 116, 101, 110, 101, 114, 39, 32, 101, 118, 101, 110, 116, 32, 105, 102, 102, 32, 116, 104, 101, 32, 108, 105, 115, 116, 101, 110, 101, 114, 32, 119, 97, 115, 32, 114, 101, 109, 111, 118, 101, 100, 10, 69, 118, 101, 110, 116, 69, 109, 105, 116, 116, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 114, 101, 109, 111, 118, 101, 76, 105, 115, 116, 101, 110, 101, 114, 32, 61, 10, 32, 32, 32, 32, 102, 117, 110, 99, 116, 105, 111, 110, 32, 114, 101, 109, 111, 118, 101, 76, 105, 115, 116, 101, 110, 101, 114, 40, 116, 121, 112, 101, 44, 32, 108, 105, 115, 116, 101, 110, 101, 114, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 118, 97, 114, 32, 108, 105, 115, 116, 44, 32, 101, 118, 101, 110, 116, 115, 44, 32, 112, 111, 115, 105, 116, 105, 111, 110, 44, 32, 105, 59, 10, 10, 32, 32, 32, 32, 32, 32, 105, 102, 32, 40, 116, 121, 112, 101, 111, 102, 32, 108, 105, 115, 116, 101, 110, 101, 114, 32, 33, 61, 61, 32, 39, 102, 117, 110, 99, 116, 105, 111, 110, 39, 41, 10, 32, 32, 32, 32, 32, 32, 32, 32, 116, 104, 114, 111, 119, 32, 110, 101, 119, 32, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 108, 105, 115, 116, 101, 110, 101, 114, 32, 109, 117, 115, 116, 32, 98, 101, 32, 97, 32, 102, 117, 110, 99, 116, 105, 111, 110, 39, 41, 59, 10, 10, 32, 32, 32, 32, 32, 32, 101, 118, 101, 110, 116, 115, 32, 61, 32, 116, 104, 105, 115, 46, 95, 101, 118, 101, 110, 116, 115, 59, 10, 32, 32, 32, 32, 32, 32, 105, 102, 32, 40, 33, 101, 118, 101, 110, 116, 115, 41, 10, 32, 32, 32, 32, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 59, 10, 10, 32, 32, 32, 32, 32, 32, 108, 105, 115, 116, 32, 61, 32, 101, 118, 101, 110, 116, 115, 91, 116, 121, 112, 101, 93, 59, 10, 32, 32, 32, 32, 32, 32, 105, 102, 32, 40, 33, 108, 105, 115, 116, 41, 10, 32, 32, 32, 32, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 59, 10, 10, 32, 32, 32, 32, 32, 32, 105, 102, 32, 40, 108, 105, 115, 116, 32, 61, 61, 61, 32, 108, 105, 115, 116, 101, 110, 101, 114, 32, 124, 124, 32, 40, 108, 105, 115, 116, 46, 108, 105, 115, 116, 101, 110, 101, 114, 32, 38, 38, 32, 108, 105, 115, 116, 46, 108, 105, 115, 116, 101, 110, 101, 114, 32, 61, 61, 61, 32, 108, 105, 115, 116, 101, 110, 101, 114, 41, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 105, 102, 32, 40, 45, 45, 116, 104, 105, 115, 46, 95, 101, 118, 101, 110, 116, 115, 67, 111, 117, 110, 116, 32, 61, 61, 61, 32, 48, 41, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 116, 104, 105, 115, 46, 95, 101, 118, 101, 110, 116, 115, 32, 61, 32, 123, 125, 59, 10, 32, 32, 32, 32, 32, 32, 32, 32, 101, 108, 115, 101, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 100, 101, 108, 101, 116, 101, 32, 101, 118, 101, 110, 116, 115, 91, 116, 121, 112, 101, 93, 59, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 105, 102, 32, 40, 101, 118, 101, 110, 116, 115, 46, 114, 101, 109, 111, 118, 101, 76, 105, 115, 116, 101, 110, 101, 114, 41, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 116, 104, 105, 115, 46, 101, 109, 105, 116, 40, 39, 114, 101, 109, 111, 118, 101, 76, 105, 115, 116, 101, 110, 101, 114, 39, 44, 32, 116, 121, 112, 101, 44, 32, 108, 105, 115, 116, 101, 110, 101, 114, 41, 59, 10, 32, 32, 32, 32, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 32, 32, 125, 32, 101, 108, 115, 101, 32, 105, 102, 32, 40, 116, 121, 112, 101, 111, 102, 32, 108, 105, 115, 116, 32, 33, 61, 61, 32, 39, 102, 117, 110, 99, 116, 105, 111, 110, 39, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 112, 111, 115, 105, 116, 105, 111, 110, 32, 61, 32, 45, 49, 59, 10, 10, 32, 32, 32, 32, 32, 32, 32, 32, 102, 111, 114, 32, 40, 105, 32, 61, 32, 108, 105, 115, 116, 46, 108, 101, 110, 103, 116, 104, 59, 32, 105, 45, 45, 32, 62, 32, 48, 59, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 105, 102, 32, 40, 108, 105, 115, 116, 91, 105, 93, 32, 61, 61, 61, 32, 108, 105, 115, 116, 101, 110, 101, 114, 32, 124, 124, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 40, 108, 105, 115, 116, 91, 105, 93, 46, 108, 105, 115, 116, 101, 110, 101, 114, 32, 38, 38, 32, 108, 105, 115, 116, 91, 105, 93, 46, 108, 105, 115, 116, 101, 110, 101, 114, 32, 61, 61, 61, 32, 108, 105, 115, 116, 101, 110, 101, 114, 41, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 112, 111, 115, 105, 116, 105, 111, 110, 32, 61, 32, 105, 59, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 98, 114, 101, 97, 107, 59, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 32, 32, 32, 32, 125, 10, 10, 32, 32, 32, 32, 32, 32, 32, 32, 105, 102, 32, 40, 112, 111, 115, 105, 116, 105, 111, 110, 32, 60, 32, 48, 41, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 59, 10, 10, 32, 32, 32, 32, 32, 32, 32, 32, 105, 102, 32, 40, 108, 105, 115, 116, 46, 108, 101, 110, 103, 116, 104, 32, 61, 61, 61, 32, 49, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 108, 105, 115, 116, 91, 48, 93, 32, 61, 32, 117, 110, 100, 101, 102, 105, 110, 101, 100, 59, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 105, 102, 32, 40, 45, 45, 116, 104, 105, 115, 46, 95, 101, 118, 101, 110, 116, 115, 67, 111, 117, 110, 116, 32, 61, 61, 61, 32, 48, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 116, 104, 105, 115, 46, 95, 101, 118, 101, 110, 116, 115, 32, 61, 32, 123, 125, 59, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 59, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 32, 101, 108, 115, 101, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 100, 101, 108, 101, 116, 101, 32, 101, 118, 101, 110, 116, 115, 91, 116, 121, 112, 101, 93, 59, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 32, 32, 32, 32, 125, 32, 101, 108, 115, 101, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 115, 112, 108, 105, 99, 101, 79, 110, 101, 40, 108, 105, 115, 116, 44, 32, 112, 111, 115, 105, 116, 105, 111, 110, 41, 59, 10, 32, 32, 32, 32, 32, 32, 32, 32, 125, 10, 10, 32, 32, 32, 32, 32, 32, 32, 32, 105, 102, 32, 40, 101, 118, 101, 110, 116, 115, 46, 114, 101, 109, 111, 118, 101, 76, 105, 115, 116, 101, 110, 101, 114, 41, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 116, 104, 105, 115, 46, 101, 109, 105, 116, 40, 39, 114, 101, 109, 111, 118, 101, 76, 105, 115, 116, 101, 110, 101, 114, 39, 44, 32, 116, 121, 112, 101, 44, 32, 108, 105, 115, 116, 101, 110, 101, 114, 41, 59, 10, 32, 32, 32, 32, 32, 32, 125, 10, 10, 32, 32, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 59, 10, 32, 32, 32, 32, 125, 59, 10, 10, 69, 118, 101, 110, 116, 69, 109, 105, 116, 116, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 114, 101, 109, 111, 118, 101, 65, 108, 108, 76, 105, 115, 116, 101, 110, 101, 114, 115, 32, 61, 10, 32, 32, 32, 32, 102, 117, 110, 99, 116, 105, 111, 110, 32, 114, 101, 109, 111, 118, 101, 65, 108, 108, 76, 105, 115, 116, 101, 110, 101, 114, 115, 40, 116, 121, 112, 101, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 118, 97, 114, 32, 108, 105, 115, 116, 101, 110, 101, 114, 115, 44, 32, 101, 118, 101, 110, 116, 115, 59, 10, 10, 32, 32, 32, 32, 32, 32, 101, 118, 101, 110, 116, 115, 32, 61, 32, 116, 104, 105, 115, 46, 95, 101, 118, 101, 110, 116, 115, 59, 10, 32, 32, 32, 32, 32, 32, 105, 102, 32, 40, 33, 101, 118, 101, 110, 116, 115, 41, 10, 32, 32, 32, 32, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 59, 10, 10, 32, 32, 32, 32, 32, 32, 47, 47, 32, 110, 111, 116, 32, 108, 105, 115, 116, 101, 110, 105, 110, 103, 32, 102, 111, 114, 32, 114, 101, 109, 111, 118, 101, 76, 105, 115, 116, 101, 110, 101, 114, 44, 32, 110, 111, 32, 110, 101, 101, 100, 32, 116, 111, 32, 101, 109, 105, 116, 10, 32, 32, 32, 32, 32, 32, 105, 102, 32, 40, 33, 101, 118, 101, 110, 116, 115, 46, 114, 101, 109, 111, 118, 101, 76, 105, 115, 116, 101, 110, 101, 114, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 105, 102, 32, 40, 97, 114, 103, 117, 109, 101, 110, 116, 115, 46, 108, 101, 110, 103, 116, 104, 32, 61, 61, 61, 32, 48, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 116, 104, 105, 115, 46, 95, 101, 118, 101, 110, 116, 115, 32, 61, 32, 123, 125, 59, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 116, 104, 105, 115, 46, 95, 101, 118, 101, 110, 116, 115, 67, 111, 117, 110, 116, 32, 61, 32, 48, 59, 10, 32, 32, 32, 32, 32, 32, 32, 32, 125, 32, 101, 108, 115, 101, 32, 105, 102, 32, 40, 101, 118, 101, 110, 116, 115, 91, 116, 121, 112, 101, 93, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 105, 102, 32, 40, 45, 45, 116, 104, 105, 115, 46, 95, 101, 118, 101, 110, 116, 115, 67, 111, 117, 110, 116, 32, 61, 61, 61, 32, 48, 41, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 116, 104, 105, 115, 46, 95, 101, 118, 101, 110, 116, 115, 32, 61, 32, 123, 125, 59, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 101, 108, 115, 101, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 100, 101, 108, 101, 116, 101, 32, 101, 118, 101, 110, 116, 115, 91, 116, 121, 112, 101, 93, 59, 10, 32, 32, 32, 32, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 59, 10, 32, 32, 32, 32, 32, 32, 125, 10, 10, 32, 32, 32, 32, 32, 32, 47, 47, 32, 101, 109, 105, 116, 32, 114, 101, 109, 111, 118, 101, 76, 105, 115, 116, 101, 110, 101, 114, 32, 102, 111, 114, 32, 97, 108, 108, 32, 108, 105, 115, 116, 101, 110, 101, 114, 115, 32, 111, 110, 32, 97, 108, 108, 32, 101, 118, 101, 110, 116, 115, 10, 32, 32, 32, 32, 32, 32, 105, 102, 32, 40, 97, 114, 103, 117, 109, 101, 110, 116, 115, 46, 108, 101, 110, 103, 116, 104, 32, 61, 61, 61, 32, 48, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 118, 97, 114, 32, 107, 101, 121, 115, 32, 61, 32, 79, 98, 106, 101, 99, 116, 46, 107, 101, 121, 115, 40, 101, 118, 101, 110, 116, 115, 41, 59, 10, 32, 32, 32, 32, 32, 32, 32, 32, 102, 111, 114, 32, 40, 118, 97, 114, 32, 105, 32, 61, 32, 48, 44, 32, 107, 101, 121, 59, 32, 105, 32, 60, 32, 107, 101, 121, 115, 46, 108, 101, 110, 103, 116, 104, 59, 32, 43, 43, 105, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 107, 101, 121, 32, 61, 32, 107, 101, 121, 115, 91, 105, 93, 59, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 105, 102, 32, 40, 107, 101, 121, 32, 61, 61, 61, 32, 39, 114, 101, 109, 111, 118, 101, 76, 105, 115, 116, 101, 110, 101, 114, 39, 41, 32, 99, 111, 110, 116, 105, 110, 117, 101, 59, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 116, 104, 105, 115, 46, 114, 101, 109, 111, 118, 101, 65, 108, 108, 76, 105, 115, 116, 101, 110, 101, 114, 115, 40, 107, 101, 121, 41, 59, 10, 32, 32, 32, 32, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 32, 32, 32, 32, 116, 104, 105, 115, 46, 114, 101, 109, 111, 118, 101, 65, 108, 108, 76, 105, 115, 116, 101, 110, 101, 114, 115, 40, 39, 114, 101, 109, 111, 118, 101, 76, 105, 115, 116, 101, 110, 101, 114, 39, 41, 59, 10, 32, 32, 32, 32, 32, 32, 32, 32, 116, 104, 105, 115, 46, 95, 101, 118, 101, 110, 116, 115, 32, 61, 32, 123, 125, 59, 10, 32, 32, 32, 32, 32, 32, 32, 32, 116, 104, 105, 115, 46, 95, 101, 118, 101, 110, 116, 115, 67, 111, 117, 110, 116, 32, 61, 32, 48, 59, 10, 32, 32, 32, 32, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 59, 10, 32, 32, 32, 32, 32, 32, 125, 10, 10, 32, 32, 32, 32, 32, 32, 108, 105, 115, 116, 101, 110, 101, 114, 115, 32, 61, 32, 101, 118, 101, 110, 116, 115, 91, 116, 121, 112, 101, 93, 59, 10, 10, 32, 32, 32, 32, 32, 32, 105, 102, 32, 40, 116, 121, 112, 101, 111, 102, 32, 108, 105, 115, 116, 101, 110, 101, 114, 115, 32, 61, 61, 61, 32, 39, 102, 117, 110, 99, 116, 105, 111, 110, 39, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 116, 104, 105, 115, 46, 114, 101, 109, 111, 118, 101, 76, 105, 115, 116, 101, 110, 101, 114, 40, 116, 121, 112, 101, 44, 32, 108, 105, 115, 116, 101, 110, 101, 114, 115, 41, 59, 10, 32, 32, 32, 32, 32, 32, 125, 32, 101, 108, 115, 101, 32, 105, 102, 32, 40, 108, 105, 115, 116, 101, 110, 101, 114, 115, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 47, 47, 32, 76, 73, 70, 79, 32, 111, 114, 100, 101, 114, 10, 32, 32, 32, 32, 32, 32, 32, 32, 100, 111, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 116, 104, 105, 115, 46, 114, 101, 109, 111, 118, 101, 76, 105, 115, 116, 101, 110, 101, 114, 40, 116, 121, 112, 101, 44, 32, 108, 105, 115, 116, 101, 110, 101, 114, 115, 91, 108, 105, 115, 116, 101, 110, 101, 114, 115, 46, 108, 101, 110, 103, 116, 104, 32, 45, 32, 49, 93, 41, 59, 10, 32, 32, 32, 32, 32, 32, 32, 32, 125, 32, 119, 104, 105, 108, 101, 32, 40, 108, 105, 115, 116, 101, 110, 101, 114, 115, 91, 48, 93, 41, 59, 10, 32, 32, 32, 32, 32, 32, 125, 10, 10, 32, 32, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 59, 10, 32, 32, 32, 32, 125, 59, 10, 10, 69, 118, 101, 110, 116, 69, 109, 105, 116, 116, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 108, 105, 115, 116, 101, 110, 101, 114, 115, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 32, 108, 105, 115, 116, 101, 110, 101, 114, 115, 40, 116, 121, 112, 101, 41, 32, 123, 10, 32, 32, 118, 97, 114, 32, 101, 118, 108, 105, 115, 116, 101, 110, 101, 114, 59, 10, 32, 32, 118, 97, 114, 32, 114, 101, 116, 59, 10, 32, 32, 118, 97, 114, 32, 101, 118, 101, 110, 116, 115, 32, 61, 32, 116, 104, 105, 115, 46, 95, 101, 118, 101, 110, 116, 115, 59, 10, 10, 32, 32, 105, 102, 32, 40, 33, 101, 118, 101, 110, 116, 115, 41, 10, 32, 32, 32, 32, 114, 101, 116, 32, 61, 32, 91, 93, 59, 10, 32, 32, 101, 108, 115, 101, 32, 123, 10, 32, 32, 32, 32, 101, 118, 108, 105, 115, 116, 101, 110, 101, 114, 32, 61, 32, 101, 118, 101, 110, 116, 115, 91, 116, 121, 112, 101, 93, 59, 10, 32, 32, 32, 32, 105, 102, 32, 40, 33, 101, 118, 108, 105, 115, 116, 101, 110, 101, 114, 41, 10, 32, 32, 32, 32, 32, 32, 114, 101, 116, 32, 61, 32, 91, 93, 59, 10, 32, 32, 32, 32, 101, 108, 115, 101, 32, 105, 102, 32, 40, 116, 121, 112, 101, 111, 102, 32, 101, 118, 108, 105, 115, 116, 101, 110, 101, 114, 32, 61, 61, 61, 32, 39, 102, 117, 110, 99, 116, 105, 111, 110, 39, 41, 10, 32, 32, 32, 32, 32, 32, 114, 101, 116, 32, 61, 32, 91, 101, 118, 108, 105, 115, 116, 101, 110, 101, 114, 93, 59, 10, 32, 32, 32, 32, 101, 108, 115, 101, 10, 32, 32, 32, 32, 32, 32, 114, 101, 116, 32, 61, 32, 97, 114, 114, 97, 121, 67, 108, 111, 110, 101, 40, 101, 118, 108, 105, 115, 116, 101, 110, 101, 114, 44, 32, 101, 118, 108, 105, 115, 116, 101, 110, 101, 114, 46, 108, 101, 110, 103, 116, 104, 41, 59, 10, 32, 32, 125, 10, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 114, 101, 116, 59, 10, 125, 59, 10, 10, 69, 118, 101, 110, 116, 69, 109, 105, 116, 116, 101, 114, 46, 108, 105, 115, 116, 101, 110, 101, 114, 67, 111, 117, 110, 116, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 101, 109, 105, 116, 116, 101, 114, 44, 32, 116, 121, 112, 101, 41, 32, 123, 10, 32, 32, 105, 102, 32, 40, 116, 121, 112, 101, 111, 102, 32, 101, 109, 105, 116, 116, 101, 114, 46, 108, 105, 115, 116, 101, 110, 101, 114, 67, 111, 117, 110, 116, 32, 61, 61, 61, 32, 39, 102, 117, 110, 99, 116, 105, 111, 110, 39, 41, 32, 123, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 101, 109, 105, 116, 116, 101, 114, 46, 108, 105, 115, 116, 101, 110, 101, 114, 67, 111, 117, 110, 116, 40, 116, 121, 112, 101, 41, 59, 10, 32, 32, 125, 32, 101, 108, 115, 101, 32, 123, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 108, 105, 115, 116, 101, 110, 101, 114, 67, 111, 117, 110, 116, 46, 99, 97, 108, 108, 40, 101, 109, 105, 116, 116, 101, 114, 44, 32, 116, 121, 112, 101, 41, 59, 10, 32, 32, 125, 10, 125, 59, 10, 10, 69, 118, 101, 110, 116, 69, 109, 105, 116, 116, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 108, 105, 115, 116, 101, 110, 101, 114, 67, 111, 117, 110, 116, 32, 61, 32, 108, 105, 115, 116, 101, 110, 101, 114, 67, 111, 117, 110, 116, 59, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 108, 105, 115, 116, 101, 110, 101, 114, 67, 111, 117, 110, 116, 40, 116, 121, 112, 101, 41, 32, 123, 10, 32, 32, 99, 111, 110, 115, 116, 32, 101, 118, 101, 110, 116, 115, 32, 61, 32, 116, 104, 105, 115, 46, 95, 101, 118, 101, 110, 116, 115, 59, 10, 10, 32, 32, 105, 102, 32, 40, 101, 118, 101, 110, 116, 115, 41, 32, 123, 10, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 101, 118, 108, 105, 115, 116, 101, 110, 101, 114, 32, 61, 32, 101, 118, 101, 110, 116, 115, 91, 116, 121, 112, 101, 93, 59, 10, 10, 32, 32, 32, 32, 105, 102, 32, 40, 116, 121, 112, 101, 111, 102, 32, 101, 118, 108, 105, 115, 116, 101, 110, 101, 114, 32, 61, 61, 61, 32, 39, 102, 117, 110, 99, 116, 105, 111, 110, 39, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 49, 59, 10, 32, 32, 32, 32, 125, 32, 101, 108, 115, 101, 32, 105, 102, 32, 40, 101, 118, 108, 105, 115, 116, 101, 110, 101, 114, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 101, 118, 108, 105, 115, 116, 101, 110, 101, 114, 46, 108, 101, 110, 103, 116, 104, 59, 10, 32, 32, 32, 32, 125, 10, 32, 32, 125, 10, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 48, 59, 10, 125, 59, 10, 10, 47, 47, 32, 65, 98, 111, 117, 116, 32, 49, 46, 53, 120, 32, 102, 97, 115, 116, 101, 114, 32, 116, 104, 97, 110, 32, 116, 104, 101, 32, 116, 119, 111, 45, 97, 114, 103, 32, 118, 101, 114, 115, 105, 111, 110, 32, 111, 102, 32, 65, 114, 114, 97, 121, 35, 115, 112, 108, 105, 99, 101, 40, 41, 46, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 115, 112, 108, 105, 99, 101, 79, 110, 101, 40, 108, 105, 115, 116, 44, 32, 105, 110, 100, 101, 120, 41, 32, 123, 10, 32, 32, 102, 111, 114, 32, 40, 118, 97, 114, 32, 105, 32, 61, 32, 105, 110, 100, 101, 120, 44, 32, 107, 32, 61, 32, 105, 32, 43, 32, 49, 44, 32, 110, 32, 61, 32, 108, 105, 115, 116, 46, 108, 101, 110, 103, 116, 104, 59, 32, 107, 32, 60, 32, 110, 59, 32, 105, 32, 43, 61, 32, 49, 44, 32, 107, 32, 43, 61, 32, 49, 41, 10, 32, 32, 32, 32, 108, 105, 115, 116, 91, 105, 93, 32, 61, 32, 108, 105, 115, 116, 91, 107, 93, 59, 10, 32, 32, 108, 105, 115, 116, 46, 112, 111, 112, 40, 41, 59, 10, 125, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 97, 114, 114, 97, 121, 67, 108, 111, 110, 101, 40, 97, 114, 114, 44, 32, 105, 41, 32, 123, 10, 32, 32, 118, 97, 114, 32, 99, 111, 112, 121, 32, 61, 32, 110, 101, 119, 32, 65, 114, 114, 97, 121, 40, 105, 41, 59, 10, 32, 32, 119, 104, 105, 108, 101, 32, 40, 105, 45, 45, 41, 10, 32, 32, 32, 32, 99, 111, 112, 121, 91, 105, 93, 32, 61, 32, 97, 114, 114, 91, 105, 93, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 99, 111, 112, 121, 59, 10, 125, 10, 0 };
 
-  const cef_char_t fs_native[] = { 47, 47, 32, 77, 79, 68, 73, 70, 73, 69, 68, 58, 32, 99, 111, 109, 109, 101, 110, 116, 32, 111, 117, 116, 32, 115, 111, 109, 101, 32, 108, 105, 110, 101, 115, 10, 47, 47, 32, 77, 97, 105, 110, 116, 97, 105, 110, 101, 114, 115, 44, 32, 107, 101, 101, 112, 32, 105, 110, 32, 109, 105, 110, 100, 32, 116, 104, 97, 116, 32, 69, 83, 49, 45, 115, 116, 121, 108, 101, 32, 111, 99, 116, 97, 108, 32, 108, 105, 116, 101, 114, 97, 108, 115, 32, 40, 96, 48, 54, 54, 54, 96, 41, 32, 97, 114, 101, 32, 110, 111, 116, 10, 47, 47, 32, 97, 108, 108, 111, 119, 101, 100, 32, 105, 110, 32, 115, 116, 114, 105, 99, 116, 32, 109, 111, 100, 101, 46, 32, 85, 115, 101, 32, 69, 83, 54, 45, 115, 116, 121, 108, 101, 32, 111, 99, 116, 97, 108, 32, 108, 105, 116, 101, 114, 97, 108, 115, 32, 105, 110, 115, 116, 101, 97, 100, 32, 40, 96, 48, 111, 54, 54, 54, 96, 41, 46, 10, 10, 39, 117, 115, 101, 32, 115, 116, 114, 105, 99, 116, 39, 59, 10, 10, 99, 111, 110, 115, 116, 32, 83, 108, 111, 119, 66, 117, 102, 102, 101, 114, 32, 61, 32, 114, 101, 113, 117, 105, 114, 101, 40, 39, 98, 117, 102, 102, 101, 114, 39, 41, 46, 83, 108, 111, 119, 66, 117, 102, 102, 101, 114, 59, 10, 99, 111, 110, 115, 116, 32, 117, 116, 105, 108, 32, 61, 32, 114, 101, 113, 117, 105, 114, 101, 40, 39, 117, 116, 105, 108, 39, 41, 59, 10, 99, 111, 110, 115, 116, 32, 112, 97, 116, 104, 77, 111, 100, 117, 108, 101, 32, 61, 32, 114, 101, 113, 117, 105, 114, 101, 40, 39, 112, 97, 116, 104, 39, 41, 59, 10, 10, 99, 111, 110, 115, 116, 32, 98, 105, 110, 100, 105, 110, 103, 32, 61, 32, 112, 114, 111, 99, 101, 115, 115, 46, 98, 105, 110, 100, 105, 110, 103, 40, 39, 102, 115, 39, 41, 59, 10, 99, 111, 110, 115, 116, 32, 99, 111, 110, 115, 116, 97, 110, 116, 115, 32, 61, 32, 114, 101, 113, 117, 105, 114, 101, 40, 39, 99, 111, 110, 115, 116, 97, 110, 116, 115, 39, 41, 59, 10, 99, 111, 110, 115, 116, 32, 102, 115, 32, 61, 32, 101, 120, 112, 111, 114, 116, 115, 59, 10, 99, 111, 110, 115, 116, 32, 66, 117, 102, 102, 101, 114, 32, 61, 32, 114, 101, 113, 117, 105, 114, 101, 40, 39, 98, 117, 102, 102, 101, 114, 39, 41, 46, 66, 117, 102, 102, 101, 114, 59, 10, 47, 47, 99, 111, 110, 115, 116, 32, 83, 116, 114, 101, 97, 109, 32, 61, 32, 114, 101, 113, 117, 105, 114, 101, 40, 39, 115, 116, 114, 101, 97, 109, 39, 41, 46, 83, 116, 114, 101, 97, 109, 59, 10, 99, 111, 110, 115, 116, 32, 69, 118, 101, 110, 116, 69, 109, 105, 116, 116, 101, 114, 32, 61, 32, 114, 101, 113, 117, 105, 114, 101, 40, 39, 101, 118, 101, 110, 116, 115, 39, 41, 59, 10, 99, 111, 110, 115, 116, 32, 70, 83, 82, 101, 113, 87, 114, 97, 112, 32, 61, 32, 98, 105, 110, 100, 105, 110, 103, 46, 70, 83, 82, 101, 113, 87, 114, 97, 112, 59, 10, 99, 111, 110, 115, 116, 32, 70, 83, 69, 118, 101, 110, 116, 32, 61, 32, 112, 114, 111, 99, 101, 115, 115, 46, 98, 105, 110, 100, 105, 110, 103, 40, 39, 102, 115, 95, 101, 118, 101, 110, 116, 95, 119, 114, 97, 112, 39, 41, 46, 70, 83, 69, 118, 101, 110, 116, 59, 10, 10, 47, 47, 99, 111, 110, 115, 116, 32, 82, 101, 97, 100, 97, 98, 108, 101, 32, 61, 32, 83, 116, 114, 101, 97, 109, 46, 82, 101, 97, 100, 97, 98, 108, 101, 59, 10, 47, 47, 99, 111, 110, 115, 116, 32, 87, 114, 105, 116, 97, 98, 108, 101, 32, 61, 32, 83, 116, 114, 101, 97, 109, 46, 87, 114, 105, 116, 97, 98, 108, 101, 59, 10, 10, 99, 111, 110, 115, 116, 32, 107, 77, 105, 110, 80, 111, 111, 108, 83, 112, 97, 99, 101, 32, 61, 32, 49, 50, 56, 59, 10, 99, 111, 110, 115, 116, 32, 107, 77, 97, 120, 76, 101, 110, 103, 116, 104, 32, 61, 32, 114, 101, 113, 117, 105, 114, 101, 40, 39, 98, 117, 102, 102, 101, 114, 39, 41, 46, 107, 77, 97, 120, 76, 101, 110, 103, 116, 104, 59, 10, 10, 99, 111, 110, 115, 116, 32, 79, 95, 65, 80, 80, 69, 78, 68, 32, 61, 32, 99, 111, 110, 115, 116, 97, 110, 116, 115, 46, 79, 95, 65, 80, 80, 69, 78, 68, 32, 124, 124, 32, 48, 59, 10, 99, 111, 110, 115, 116, 32, 79, 95, 67, 82, 69, 65, 84, 32, 61, 32, 99, 111, 110, 115, 116, 97, 110, 116, 115, 46, 79, 95, 67, 82, 69, 65, 84, 32, 124, 124, 32, 48, 59, 10, 99, 111, 110, 115, 116, 32, 79, 95, 69, 88, 67, 76, 32, 61, 32, 99, 111, 110, 115, 116, 97, 110, 116, 115, 46, 79, 95, 69, 88, 67, 76, 32, 124, 124, 32, 48, 59, 10, 99, 111, 110, 115, 116, 32, 79, 95, 82, 68, 79, 78, 76, 89, 32, 61, 32, 99, 111, 110, 115, 116, 97, 110, 116, 115, 46, 79, 95, 82, 68, 79, 78, 76, 89, 32, 124, 124, 32, 48, 59, 10, 99, 111, 110, 115, 116, 32, 79, 95, 82, 68, 87, 82, 32, 61, 32, 99, 111, 110, 115, 116, 97, 110, 116, 115, 46, 79, 95, 82, 68, 87, 82, 32, 124, 124, 32, 48, 59, 10, 99, 111, 110, 115, 116, 32, 79, 95, 83, 89, 78, 67, 32, 61, 32, 99, 111, 110, 115, 116, 97, 110, 116, 115, 46, 79, 95, 83, 89, 78, 67, 32, 124, 124, 32, 48, 59, 10, 99, 111, 110, 115, 116, 32, 79, 95, 84, 82, 85, 78, 67, 32, 61, 32, 99, 111, 110, 115, 116, 97, 110, 116, 115, 46, 79, 95, 84, 82, 85, 78, 67, 32, 124, 124, 32, 48, 59, 10, 99, 111, 110, 115, 116, 32, 79, 95, 87, 82, 79, 78, 76, 89, 32, 61, 32, 99, 111, 110, 115, 116, 97, 110, 116, 115, 46, 79, 95, 87, 82, 79, 78, 76, 89, 32, 124, 124, 32, 48, 59, 10, 10, 99, 111, 110, 115, 116, 32, 105, 115, 87, 105, 110, 100, 111, 119, 115, 32, 61, 32, 112, 114, 111, 99, 101, 115, 115, 46, 112, 108, 97, 116, 102, 111, 114, 109, 32, 61, 61, 61, 32, 39, 119, 105, 110, 51, 50, 39, 59, 10, 10, 99, 111, 110, 115, 116, 32, 68, 69, 66, 85, 71, 32, 61, 32, 112, 114, 111, 99, 101, 115, 115, 46, 101, 110, 118, 46, 78, 79, 68, 69, 95, 68, 69, 66, 85, 71, 32, 38, 38, 32, 47, 102, 115, 47, 46, 116, 101, 115, 116, 40, 112, 114, 111, 99, 101, 115, 115, 46, 101, 110, 118, 46, 78, 79, 68, 69, 95, 68, 69, 66, 85, 71, 41, 59, 10, 99, 111, 110, 115, 116, 32, 101, 114, 114, 110, 111, 69, 120, 99, 101, 112, 116, 105, 111, 110, 32, 61, 32, 117, 116, 105, 108, 46, 95, 101, 114, 114, 110, 111, 69, 120, 99, 101, 112, 116, 105, 111, 110, 59, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 116, 104, 114, 111, 119, 79, 112, 116, 105, 111, 110, 115, 69, 114, 114, 111, 114, 40, 111, 112, 116, 105, 111, 110, 115, 41, 32, 123, 10, 32, 32, 116, 104, 114, 111, 119, 32, 110, 101, 119, 32, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 69, 120, 112, 101, 99, 116, 101, 100, 32, 111, 112, 116, 105, 111, 110, 115, 32, 116, 111, 32, 98, 101, 32, 101, 105, 116, 104, 101, 114, 32, 97, 110, 32, 111, 98, 106, 101, 99, 116, 32, 111, 114, 32, 97, 32, 115, 116, 114, 105, 110, 103, 44, 32, 39, 32, 43, 10, 32, 32, 32, 32, 39, 98, 117, 116, 32, 103, 111, 116, 32, 39, 32, 43, 32, 116, 121, 112, 101, 111, 102, 32, 111, 112, 116, 105, 111, 110, 115, 32, 43, 32, 39, 32, 105, 110, 115, 116, 101, 97, 100, 39, 41, 59, 10, 125, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 114, 101, 116, 104, 114, 111, 119, 40, 41, 32, 123, 10, 32, 32, 47, 47, 32, 79, 110, 108, 121, 32, 101, 110, 97, 98, 108, 101, 32, 105, 110, 32, 100, 101, 98, 117, 103, 32, 109, 111, 100, 101, 46, 32, 65, 32, 98, 97, 99, 107, 116, 114, 97, 99, 101, 32, 117, 115, 101, 115, 32, 126, 49, 48, 48, 48, 32, 98, 121, 116, 101, 115, 32, 111, 102, 32, 104, 101, 97, 112, 32, 115, 112, 97, 99, 101, 32, 97, 110, 100, 10, 32, 32, 47, 47, 32, 105, 115, 32, 102, 97, 105, 114, 108, 121, 32, 115, 108, 111, 119, 32, 116, 111, 32, 103, 101, 110, 101, 114, 97, 116, 101, 46, 10, 32, 32, 105, 102, 32, 40, 68, 69, 66, 85, 71, 41, 32, 123, 10, 32, 32, 32, 32, 118, 97, 114, 32, 98, 97, 99, 107, 116, 114, 97, 99, 101, 32, 61, 32, 110, 101, 119, 32, 69, 114, 114, 111, 114, 40, 41, 59, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 101, 114, 114, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 105, 102, 32, 40, 101, 114, 114, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 98, 97, 99, 107, 116, 114, 97, 99, 101, 46, 115, 116, 97, 99, 107, 32, 61, 32, 101, 114, 114, 46, 110, 97, 109, 101, 32, 43, 32, 39, 58, 32, 39, 32, 43, 32, 101, 114, 114, 46, 109, 101, 115, 115, 97, 103, 101, 32, 43, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 98, 97, 99, 107, 116, 114, 97, 99, 101, 46, 115, 116, 97, 99, 107, 46, 115, 117, 98, 115, 116, 114, 40, 98, 97, 99, 107, 116, 114, 97, 99, 101, 46, 110, 97, 109, 101, 46, 108, 101, 110, 103, 116, 104, 41, 59, 10, 32, 32, 32, 32, 32, 32, 32, 32, 116, 104, 114, 111, 119, 32, 98, 97, 99, 107, 116, 114, 97, 99, 101, 59, 10, 32, 32, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 125, 59, 10, 32, 32, 125, 10, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 101, 114, 114, 41, 32, 123, 10, 32, 32, 32, 32, 105, 102, 32, 40, 101, 114, 114, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 116, 104, 114, 111, 119, 32, 101, 114, 114, 59, 32, 32, 47, 47, 32, 70, 111, 114, 103, 111, 116, 32, 97, 32, 99, 97, 108, 108, 98, 97, 99, 107, 32, 98, 117, 116, 32, 100, 111, 110, 39, 116, 32, 107, 110, 111, 119, 32, 119, 104, 101, 114, 101, 63, 32, 85, 115, 101, 32, 78, 79, 68, 69, 95, 68, 69, 66, 85, 71, 61, 102, 115, 10, 32, 32, 32, 32, 125, 10, 32, 32, 125, 59, 10, 125, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 109, 97, 121, 98, 101, 67, 97, 108, 108, 98, 97, 99, 107, 40, 99, 98, 41, 32, 123, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 116, 121, 112, 101, 111, 102, 32, 99, 98, 32, 61, 61, 61, 32, 39, 102, 117, 110, 99, 116, 105, 111, 110, 39, 32, 63, 32, 99, 98, 32, 58, 32, 114, 101, 116, 104, 114, 111, 119, 40, 41, 59, 10, 125, 10, 10, 47, 47, 32, 69, 110, 115, 117, 114, 101, 32, 116, 104, 97, 116, 32, 99, 97, 108, 108, 98, 97, 99, 107, 115, 32, 114, 117, 110, 32, 105, 110, 32, 116, 104, 101, 32, 103, 108, 111, 98, 97, 108, 32, 99, 111, 110, 116, 101, 120, 116, 46, 32, 79, 110, 108, 121, 32, 117, 115, 101, 32, 116, 104, 105, 115, 32, 102, 117, 110, 99, 116, 105, 111, 110, 10, 47, 47, 32, 102, 111, 114, 32, 99, 97, 108, 108, 98, 97, 99, 107, 115, 32, 116, 104, 97, 116, 32, 97, 114, 101, 32, 112, 97, 115, 115, 101, 100, 32, 116, 111, 32, 116, 104, 101, 32, 98, 105, 110, 100, 105, 110, 103, 32, 108, 97, 121, 101, 114, 44, 32, 99, 97, 108, 108, 98, 97, 99, 107, 115, 32, 116, 104, 97, 116, 32, 97, 114, 101, 10, 47, 47, 32, 105, 110, 118, 111, 107, 101, 100, 32, 102, 114, 111, 109, 32, 74, 83, 32, 97, 108, 114, 101, 97, 100, 121, 32, 114, 117, 110, 32, 105, 110, 32, 116, 104, 101, 32, 112, 114, 111, 112, 101, 114, 32, 115, 99, 111, 112, 101, 46, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 109, 97, 107, 101, 67, 97, 108, 108, 98, 97, 99, 107, 40, 99, 98, 41, 32, 123, 10, 32, 32, 105, 102, 32, 40, 99, 98, 32, 61, 61, 61, 32, 117, 110, 100, 101, 102, 105, 110, 101, 100, 41, 32, 123, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 114, 101, 116, 104, 114, 111, 119, 40, 41, 59, 10, 32, 32, 125, 10, 10, 32, 32, 105, 102, 32, 40, 116, 121, 112, 101, 111, 102, 32, 99, 98, 32, 33, 61, 61, 32, 39, 102, 117, 110, 99, 116, 105, 111, 110, 39, 41, 32, 123, 10, 32, 32, 32, 32, 116, 104, 114, 111, 119, 32, 110, 101, 119, 32, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 99, 97, 108, 108, 98, 97, 99, 107, 32, 109, 117, 115, 116, 32, 98, 101, 32, 97, 32, 102, 117, 110, 99, 116, 105, 111, 110, 39, 41, 59, 10, 32, 32, 125, 10, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 32, 123, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 99, 98, 46, 97, 112, 112, 108, 121, 40, 110, 117, 108, 108, 44, 32, 97, 114, 103, 117, 109, 101, 110, 116, 115, 41, 59, 10, 32, 32, 125, 59, 10, 125, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 97, 115, 115, 101, 114, 116, 69, 110, 99, 111, 100, 105, 110, 103, 40, 101, 110, 99, 111, 100, 105, 110, 103, 41, 32, 123, 10, 32, 32, 105, 102, 32, 40, 101, 110, 99, 111, 100, 105, 110, 103, 32, 38, 38, 32, 33, 66, 117, 102, 102, 101, 114, 46, 105, 115, 69, 110, 99, 111, 100, 105, 110, 103, 40, 101, 110, 99, 111, 100, 105, 110, 103, 41, 41, 32, 123, 10, 32, 32, 32, 32, 116, 104, 114, 111, 119, 32, 110, 101, 119, 32, 69, 114, 114, 111, 114, 40, 39, 85, 110, 107, 110, 111, 119, 110, 32, 101, 110, 99, 111, 100, 105, 110, 103, 58, 32, 39, 32, 43, 32, 101, 110, 99, 111, 100, 105, 110, 103, 41, 59, 10, 32, 32, 125, 10, 125, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 110, 117, 108, 108, 67, 104, 101, 99, 107, 40, 112, 97, 116, 104, 44, 32, 99, 97, 108, 108, 98, 97, 99, 107, 41, 32, 123, 10, 32, 32, 105, 102, 32, 40, 40, 39, 39, 32, 43, 32, 112, 97, 116, 104, 41, 46, 105, 110, 100, 101, 120, 79, 102, 40, 39, 92, 117, 48, 48, 48, 48, 39, 41, 32, 33, 61, 61, 32, 45, 49, 41, 32, 123, 10, 32, 32, 32, 32, 118, 97, 114, 32, 101, 114, 32, 61, 32, 110, 101, 119, 32, 69, 114, 114, 111, 114, 40, 39, 80, 97, 116, 104, 32, 109, 117, 115, 116, 32, 98, 101, 32, 97, 32, 115, 116, 114, 105, 110, 103, 32, 119, 105, 116, 104, 111, 117, 116, 32, 110, 117, 108, 108, 32, 98, 121, 116, 101, 115, 46, 39, 41, 59, 10, 32, 32, 32, 32, 101, 114, 46, 99, 111, 100, 101, 32, 61, 32, 39, 69, 78, 79, 69, 78, 84, 39, 59, 10, 32, 32, 32, 32, 105, 102, 32, 40, 116, 121, 112, 101, 111, 102, 32, 99, 97, 108, 108, 98, 97, 99, 107, 32, 33, 61, 61, 32, 39, 102, 117, 110, 99, 116, 105, 111, 110, 39, 41, 10, 32, 32, 32, 32, 32, 32, 116, 104, 114, 111, 119, 32, 101, 114, 59, 10, 32, 32, 32, 32, 112, 114, 111, 99, 101, 115, 115, 46, 110, 101, 120, 116, 84, 105, 99, 107, 40, 99, 97, 108, 108, 98, 97, 99, 107, 44, 32, 101, 114, 41, 59, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 102, 97, 108, 115, 101, 59, 10, 32, 32, 125, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 116, 114, 117, 101, 59, 10, 125, 10, 10, 47, 47, 32, 83, 116, 97, 116, 105, 99, 32, 109, 101, 116, 104, 111, 100, 32, 116, 111, 32, 115, 101, 116, 32, 116, 104, 101, 32, 115, 116, 97, 116, 115, 32, 112, 114, 111, 112, 101, 114, 116, 105, 101, 115, 32, 111, 110, 32, 97, 32, 83, 116, 97, 116, 115, 32, 111, 98, 106, 101, 99, 116, 46, 10, 102, 115, 46, 83, 116, 97, 116, 115, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 10, 32, 32, 32, 32, 100, 101, 118, 44, 10, 32, 32, 32, 32, 109, 111, 100, 101, 44, 10, 32, 32, 32, 32, 110, 108, 105, 110, 107, 44, 10, 32, 32, 32, 32, 117, 105, 100, 44, 10, 32, 32, 32, 32, 103, 105, 100, 44, 10, 32, 32, 32, 32, 114, 100, 101, 118, 44, 10, 32, 32, 32, 32, 98, 108, 107, 115, 105, 122, 101, 44, 10, 32, 32, 32, 32, 105, 110, 111, 44, 10, 32, 32, 32, 32, 115, 105, 122, 101, 44, 10, 32, 32, 32, 32, 98, 108, 111, 99, 107, 115, 44, 10, 32, 32, 32, 32, 97, 116, 105, 109, 95, 109, 115, 101, 99, 44, 10, 32, 32, 32, 32, 109, 116, 105, 109, 95, 109, 115, 101, 99, 44, 10, 32, 32, 32, 32, 99, 116, 105, 109, 95, 109, 115, 101, 99, 44, 10, 32, 32, 32, 32, 98, 105, 114, 116, 104, 116, 105, 109, 95, 109, 115, 101, 99, 41, 32, 123, 10, 32, 32, 116, 104, 105, 115, 46, 100, 101, 118, 32, 61, 32, 100, 101, 118, 59, 10, 32, 32, 116, 104, 105, 115, 46, 109, 111, 100, 101, 32, 61, 32, 109, 111, 100, 101, 59, 10, 32, 32, 116, 104, 105, 115, 46, 110, 108, 105, 110, 107, 32, 61, 32, 110, 108, 105, 110, 107, 59, 10, 32, 32, 116, 104, 105, 115, 46, 117, 105, 100, 32, 61, 32, 117, 105, 100, 59, 10, 32, 32, 116, 104, 105, 115, 46, 103, 105, 100, 32, 61, 32, 103, 105, 100, 59, 10, 32, 32, 116, 104, 105, 115, 46, 114, 100, 101, 118, 32, 61, 32, 114, 100, 101, 118, 59, 10, 32, 32, 116, 104, 105, 115, 46, 98, 108, 107, 115, 105, 122, 101, 32, 61, 32, 98, 108, 107, 115, 105, 122, 101, 59, 10, 32, 32, 116, 104, 105, 115, 46, 105, 110, 111, 32, 61, 32, 105, 110, 111, 59, 10, 32, 32, 116, 104, 105, 115, 46, 115, 105, 122, 101, 32, 61, 32, 115, 105, 122, 101, 59, 10, 32, 32, 116, 104, 105, 115, 46, 98, 108, 111, 99, 107, 115, 32, 61, 32, 98, 108, 111, 99, 107, 115, 59, 10, 32, 32, 116, 104, 105, 115, 46, 97, 116, 105, 109, 101, 32, 61, 32, 110, 101, 119, 32, 68, 97, 116, 101, 40, 97, 116, 105, 109, 95, 109, 115, 101, 99, 41, 59, 10, 32, 32, 116, 104, 105, 115, 46, 109, 116, 105, 109, 101, 32, 61, 32, 110, 101, 119, 32, 68, 97, 116, 101, 40, 109, 116, 105, 109, 95, 109, 115, 101, 99, 41, 59, 10, 32, 32, 116, 104, 105, 115, 46, 99, 116, 105, 109, 101, 32, 61, 32, 110, 101, 119, 32, 68, 97, 116, 101, 40, 99, 116, 105, 109, 95, 109, 115, 101, 99, 41, 59, 10, 32, 32, 116, 104, 105, 115, 46, 98, 105, 114, 116, 104, 116, 105, 109, 101, 32, 61, 32, 110, 101, 119, 32, 68, 97, 116, 101, 40, 98, 105, 114, 116, 104, 116, 105, 109, 95, 109, 115, 101, 99, 41, 59, 10, 125, 59, 10, 10, 47, 47, 32, 67, 114, 101, 97, 116, 101, 32, 97, 32, 67, 43, 43, 32, 98, 105, 110, 100, 105, 110, 103, 32, 116, 111, 32, 116, 104, 101, 32, 102, 117, 110, 99, 116, 105, 111, 110, 32, 119, 104, 105, 99, 104, 32, 99, 114, 101, 97, 116, 101, 115, 32, 97, 32, 83, 116, 97, 116, 115, 32, 111, 98, 106, 101, 99, 116, 46, 10, 98, 105, 110, 100, 105, 110, 103, 46, 70, 83, 73, 110, 105, 116, 105, 97, 108, 105, 122, 101, 40, 102, 115, 46, 83, 116, 97, 116, 115, 41, 59, 10, 10, 102, 115, 46, 83, 116, 97, 116, 115, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 95, 99, 104, 101, 99, 107, 77, 111, 100, 101, 80, 114, 111, 112, 101, 114, 116, 121, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 112, 114, 111, 112, 101, 114, 116, 121, 41, 32, 123, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 40, 40, 116, 104, 105, 115, 46, 109, 111, 100, 101, 32, 38, 32, 99, 111, 110, 115, 116, 97, 110, 116, 115, 46, 83, 95, 73, 70, 77, 84, 41, 32, 61, 61, 61, 32, 112, 114, 111, 112, 101, 114, 116, 121, 41, 59, 10, 125, 59, 10, 10, 102, 115, 46, 83, 116, 97, 116, 115, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 105, 115, 68, 105, 114, 101, 99, 116, 111, 114, 121, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 32, 123, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 46, 95, 99, 104, 101, 99, 107, 77, 111, 100, 101, 80, 114, 111, 112, 101, 114, 116, 121, 40, 99, 111, 110, 115, 116, 97, 110, 116, 115, 46, 83, 95, 73, 70, 68, 73, 82, 41, 59, 10, 125, 59, 10, 10, 102, 115, 46, 83, 116, 97, 116, 115, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 105, 115, 70, 105, 108, 101, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 32, 123, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 46, 95, 99, 104, 101, 99, 107, 77, 111, 100, 101, 80, 114, 111, 112, 101, 114, 116, 121, 40, 99, 111, 110, 115, 116, 97, 110, 116, 115, 46, 83, 95, 73, 70, 82, 69, 71, 41, 59, 10, 125, 59, 10, 10, 102, 115, 46, 83, 116, 97, 116, 115, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 105, 115, 66, 108, 111, 99, 107, 68, 101, 118, 105, 99, 101, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 32, 123, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 46, 95, 99, 104, 101, 99, 107, 77, 111, 100, 101, 80, 114, 111, 112, 101, 114, 116, 121, 40, 99, 111, 110, 115, 116, 97, 110, 116, 115, 46, 83, 95, 73, 70, 66, 76, 75, 41, 59, 10, 125, 59, 10, 10, 102, 115, 46, 83, 116, 97, 116, 115, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 105, 115, 67, 104, 97, 114, 97, 99, 116, 101, 114, 68, 101, 118, 105, 99, 101, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 32, 123, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 46, 95, 99, 104, 101, 99, 107, 77, 111, 100, 101, 80, 114, 111, 112, 101, 114, 116, 121, 40, 99, 111, 110, 115, 116, 97, 110, 116, 115, 46, 83, 95, 73, 70, 67, 72, 82, 41, 59, 10, 125, 59, 10, 10, 102, 115, 46, 83, 116, 97, 116, 115, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 105, 115, 83, 121, 109, 98, 111, 108, 105, 99, 76, 105, 110, 107, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 32, 123, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 46, 95, 99, 104, 101, 99, 107, 77, 111, 100, 101, 80, 114, 111, 112, 101, 114, 116, 121, 40, 99, 111, 110, 115, 116, 97, 110, 116, 115, 46, 83, 95, 73, 70, 76, 78, 75, 41, 59, 10, 125, 59, 10, 10, 102, 115, 46, 83, 116, 97, 116, 115, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 105, 115, 70, 73, 70, 79, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 32, 123, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 46, 95, 99, 104, 101, 99, 107, 77, 111, 100, 101, 80, 114, 111, 112, 101, 114, 116, 121, 40, 99, 111, 110, 115, 116, 97, 110, 116, 115, 46, 83, 95, 73, 70, 73, 70, 79, 41, 59, 10, 125, 59, 10, 10, 102, 115, 46, 83, 116, 97, 116, 115, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 105, 115, 83, 111, 99, 107, 101, 116, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 32, 123, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 46, 95, 99, 104, 101, 99, 107, 77, 111, 100, 101, 80, 114, 111, 112, 101, 114, 116, 121, 40, 99, 111, 110, 115, 116, 97, 110, 116, 115, 46, 83, 95, 73, 70, 83, 79, 67, 75, 41, 59, 10, 125, 59, 10, 10, 47, 47, 32, 68, 111, 110, 39, 116, 32, 97, 108, 108, 111, 119, 32, 109, 111, 100, 101, 32, 116, 111, 32, 97, 99, 99, 105, 100, 101, 110, 116, 97, 108, 108, 121, 32, 98, 101, 32, 111, 118, 101, 114, 119, 114, 105, 116, 116, 101, 110, 46, 10, 91, 39, 70, 95, 79, 75, 39, 44, 32, 39, 82, 95, 79, 75, 39, 44, 32, 39, 87, 95, 79, 75, 39, 44, 32, 39, 88, 95, 79, 75, 39, 93, 46, 102, 111, 114, 69, 97, 99, 104, 40, 102, 117, 110, 99, 116, 105, 111, 110, 40, 107, 101, 121, 41, 32, 123, 10, 32, 32, 79, 98, 106, 101, 99, 116, 46, 100, 101, 102, 105, 110, 101, 80, 114, 111, 112, 101, 114, 116, 121, 40, 102, 115, 44, 32, 107, 101, 121, 44, 32, 123, 10, 32, 32, 32, 32, 101, 110, 117, 109, 101, 114, 97, 98, 108, 101, 58, 32, 116, 114, 117, 101, 44, 32, 118, 97, 108, 117, 101, 58, 32, 99, 111, 110, 115, 116, 97, 110, 116, 115, 91, 107, 101, 121, 93, 32, 124, 124, 32, 48, 44, 32, 119, 114, 105, 116, 97, 98, 108, 101, 58, 32, 102, 97, 108, 115, 101, 10, 32, 32, 125, 41, 59, 10, 125, 41, 59, 10, 10, 102, 115, 46, 97, 99, 99, 101, 115, 115, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 112, 97, 116, 104, 44, 32, 109, 111, 100, 101, 44, 32, 99, 97, 108, 108, 98, 97, 99, 107, 41, 32, 123, 10, 32, 32, 105, 102, 32, 40, 116, 121, 112, 101, 111, 102, 32, 109, 111, 100, 101, 32, 61, 61, 61, 32, 39, 102, 117, 110, 99, 116, 105, 111, 110, 39, 41, 32, 123, 10, 32, 32, 32, 32, 99, 97, 108, 108, 98, 97, 99, 107, 32, 61, 32, 109, 111, 100, 101, 59, 10, 32, 32, 32, 32, 109, 111, 100, 101, 32, 61, 32, 102, 115, 46, 70, 95, 79, 75, 59, 10, 32, 32, 125, 32, 101, 108, 115, 101, 32, 105, 102, 32, 40, 116, 121, 112, 101, 111, 102, 32, 99, 97, 108, 108, 98, 97, 99, 107, 32, 33, 61, 61, 32, 39, 102, 117, 110, 99, 116, 105, 111, 110, 39, 41, 32, 123, 10, 32, 32, 32, 32, 116, 104, 114, 111, 119, 32, 110, 101, 119, 32, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 99, 97, 108, 108, 98, 97, 99, 107, 32, 109, 117, 115, 116, 32, 98, 101, 32, 97, 32, 102, 117, 110, 99, 116, 105, 111, 110, 39, 41, 59, 10, 32, 32, 125, 10, 10, 32, 32, 105, 102, 32, 40, 33, 110, 117, 108, 108, 67, 104, 101, 99, 107, 40, 112, 97, 116, 104, 44, 32, 99, 97, 108, 108, 98, 97, 99, 107, 41, 41, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 59, 10, 10, 32, 32, 109, 111, 100, 101, 32, 61, 32, 109, 111, 100, 101, 32, 124, 32, 48, 59, 10, 32, 32, 118, 97, 114, 32, 114, 101, 113, 32, 61, 32, 110, 101, 119, 32, 70, 83, 82, 101, 113, 87, 114, 97, 112, 40, 41, 59, 10, 32, 32, 114, 101, 113, 46, 111, 110, 99, 111, 109, 112, 108, 101, 116, 101, 32, 61, 32, 109, 97, 107, 101, 67, 97, 108, 108, 98, 97, 99, 107, 40, 99, 97, 108, 108, 98, 97, 99, 107, 41, 59, 10, 32, 32, 98, 105, 110, 100, 105, 110, 103, 46, 97, 99, 99, 101, 115, 115, 40, 112, 97, 116, 104, 77, 111, 100, 117, 108, 101, 46, 95, 109, 97, 107, 101, 76, 111, 110, 103, 40, 112, 97, 116, 104, 41, 44, 32, 109, 111, 100, 101, 44, 32, 114, 101, 113, 41, 59, 10, 125, 59, 10, 10, 102, 115, 46, 97, 99, 99, 101, 115, 115, 83, 121, 110, 99, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 112, 97, 116, 104, 44, 32, 109, 111, 100, 101, 41, 32, 123, 10, 32, 32, 110, 117, 108, 108, 67, 104, 101, 99, 107, 40, 112, 97, 116, 104, 41, 59, 10, 10, 32, 32, 105, 102, 32, 40, 109, 111, 100, 101, 32, 61, 61, 61, 32, 117, 110, 100, 101, 102, 105, 110, 101, 100, 41, 10, 32, 32, 32, 32, 109, 111, 100, 101, 32, 61, 32, 102, 115, 46, 70, 95, 79, 75, 59, 10, 32, 32, 101, 108, 115, 101, 10, 32, 32, 32, 32, 109, 111, 100, 101, 32, 61, 32, 109, 111, 100, 101, 32, 124, 32, 48, 59, 10, 10, 32, 32, 98, 105, 110, 100, 105, 110, 103, 46, 97, 99, 99, 101, 115, 115, 40, 112, 97, 116, 104, 77, 111, 100, 117, 108, 101, 46, 95, 109, 97, 107, 101, 76, 111, 110, 103, 40, 112, 97, 116, 104, 41, 44, 32, 109, 111, 100, 101, 41, 59, 10, 125, 59, 10, 10, 102, 115, 46, 101, 120, 105, 115, 116, 115, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 112, 97, 116, 104, 44, 32, 99, 97, 108, 108, 98, 97, 99, 107, 41, 32, 123, 10, 32, 32, 105, 102, 32, 40, 33, 110, 117, 108, 108, 67, 104, 101, 99, 107, 40, 112, 97, 116, 104, 44, 32, 99, 98, 41, 41, 32, 114, 101, 116, 117, 114, 110, 59, 10, 32, 32, 118, 97, 114, 32, 114, 101, 113, 32, 61, 32, 110, 101, 119, 32, 70, 83, 82, 101, 113, 87, 114, 97, 112, 40, 41, 59, 10, 32, 32, 114, 101, 113, 46, 111, 110, 99, 111, 109, 112, 108, 101, 116, 101, 32, 61, 32, 99, 98, 59, 10, 32, 32, 98, 105, 110, 100, 105, 110, 103, 46, 115, 116, 97, 116, 40, 112, 97, 116, 104, 77, 111, 100, 117, 108, 101, 46, 95, 109, 97, 107, 101, 76, 111, 110, 103, 40, 112, 97, 116, 104, 41, 44, 32, 114, 101, 113, 41, 59, 10, 32, 32, 102, 117, 110, 99, 116, 105, 111, 110, 32, 99, 98, 40, 101, 114, 114, 44, 32, 115, 116, 97, 116, 115, 41, 32, 123, 10, 32, 32, 32, 32, 105, 102, 32, 40, 99, 97, 108, 108, 98, 97, 99, 107, 41, 32, 99, 97, 108, 108, 98, 97, 99, 107, 40, 101, 114, 114, 32, 63, 32, 102, 97, 108, 115, 101, 32, 58, 32, 116, 114, 117, 101, 41, 59, 10, 32, 32, 125, 10, 125, 59, 10, 10, 102, 115, 46, 101, 120, 105, 115, 116, 115, 83, 121, 110, 99, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 112, 97, 116, 104, 41, 32, 123, 10, 32, 32, 116, 114, 121, 32, 123, 10, 32, 32, 32, 32, 110, 117, 108, 108, 67, 104, 101, 99, 107, 40, 112, 97, 116, 104, 41, 59, 10, 32, 32, 32, 32, 98, 105, 110, 100, 105, 110, 103, 46, 115, 116, 97, 116, 40, 112, 97, 116, 104, 77, 111, 100, 117, 108, 101, 46, 95, 109, 97, 107, 101, 76, 111, 110, 103, 40, 112, 97, 116, 104, 41, 41, 59, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 116, 114, 117, 101, 59, 10, 32, 32, 125, 32, 99, 97, 116, 99, 104, 32, 40, 101, 41, 32, 123, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 102, 97, 108, 115, 101, 59, 10, 32, 32, 125, 10, 125, 59, 10, 10, 102, 115, 46, 114, 101, 97, 100, 70, 105, 108, 101, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 112, 97, 116, 104, 44, 32, 111, 112, 116, 105, 111, 110, 115, 44, 32, 99, 97, 108, 108, 98, 97, 99, 107, 95, 41, 32, 123, 10, 32, 32, 118, 97, 114, 32, 99, 97, 108, 108, 98, 97, 99, 107, 32, 61, 32, 109, 97, 121, 98, 101, 67, 97, 108, 108, 98, 97, 99, 107, 40, 97, 114, 103, 117, 109, 101, 110, 116, 115, 91, 97, 114, 103, 117, 109, 101, 110, 116, 115, 46, 108, 101, 110, 103, 116, 104, 32, 45, 32, 49, 93, 41, 59, 10, 10, 32, 32, 105, 102, 32, 40, 33, 111, 112, 116, 105, 111, 110, 115, 32, 124, 124, 32, 116, 121, 112, 101, 111, 102, 32, 111, 112, 116, 105, 111, 110, 115, 32, 61, 61, 61, 32, 39, 102, 117, 110, 99, 116, 105, 111, 110, 39, 41, 32, 123, 10, 32, 32, 32, 32, 111, 112, 116, 105, 111, 110, 115, 32, 61, 32, 123, 32, 101, 110, 99, 111, 100, 105, 110, 103, 58, 32, 110, 117, 108, 108, 44, 32, 102, 108, 97, 103, 58, 32, 39, 114, 39, 32, 125, 59, 10, 32, 32, 125, 32, 101, 108, 115, 101, 32, 105, 102, 32, 40, 116, 121, 112, 101, 111, 102, 32, 111, 112, 116, 105, 111, 110, 115, 32, 61, 61, 61, 32, 39, 115, 116, 114, 105, 110, 103, 39, 41, 32, 123, 10, 32, 32, 32, 32, 111, 112, 116, 105, 111, 110, 115, 32, 61, 32, 123, 32, 101, 110, 99, 111, 100, 105, 110, 103, 58, 32, 111, 112, 116, 105, 111, 110, 115, 44, 32, 102, 108, 97, 103, 58, 32, 39, 114, 39, 32, 125, 59, 10, 32, 32, 125, 32, 101, 108, 115, 101, 32, 105, 102, 32, 40, 116, 121, 112, 101, 111, 102, 32, 111, 112, 116, 105, 111, 110, 115, 32, 33, 61, 61, 32, 39, 111, 98, 106, 101, 99, 116, 39, 41, 32, 123, 10, 32, 32, 32, 32, 116, 104, 114, 111, 119, 79, 112, 116, 105, 111, 110, 115, 69, 114, 114, 111, 114, 40, 111, 112, 116, 105, 111, 110, 115, 41, 59, 10, 32, 32, 125, 10, 10, 32, 32, 118, 97, 114, 32, 101, 110, 99, 111, 100, 105, 110, 103, 32, 61, 32, 111, 112, 116, 105, 111, 110, 115, 46, 101, 110, 99, 111, 100, 105, 110, 103, 59, 10, 32, 32, 97, 115, 115, 101, 114, 116, 69, 110, 99, 111, 100, 105, 110, 103, 40, 101, 110, 99, 111, 100, 105, 110, 103, 41, 59, 10, 10, 32, 32, 118, 97, 114, 32, 102, 108, 97, 103, 32, 61, 32, 111, 112, 116, 105, 111, 110, 115, 46, 102, 108, 97, 103, 32, 124, 124, 32, 39, 114, 39, 59, 10, 10, 32, 32, 105, 102, 32, 40, 33, 110, 117, 108, 108, 67, 104, 101, 99, 107, 40, 112, 97, 116, 104, 44, 32, 99, 97, 108, 108, 98, 97, 99, 107, 41, 41, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 59, 10, 10, 32, 32, 118, 97, 114, 32, 99, 111, 110, 116, 101, 120, 116, 32, 61, 32, 110, 101, 119, 32, 82, 101, 97, 100, 70, 105, 108, 101, 67, 111, 110, 116, 101, 120, 116, 40, 99, 97, 108, 108, 98, 97, 99, 107, 44, 32, 101, 110, 99, 111, 100, 105, 110, 103, 41, 59, 10, 32, 32, 118, 97, 114, 32, 114, 101, 113, 32, 61, 32, 110, 101, 119, 32, 70, 83, 82, 101, 113, 87, 114, 97, 112, 40, 41, 59, 10, 32, 32, 114, 101, 113, 46, 99, 111, 110, 116, 101, 120, 116, 32, 61, 32, 99, 111, 110, 116, 101, 120, 116, 59, 10, 32, 32, 114, 101, 113, 46, 111, 110, 99, 111, 109, 112, 108, 101, 116, 101, 32, 61, 32, 114, 101, 97, 100, 70, 105, 108, 101, 65, 102, 116, 101, 114, 79, 112, 101, 110, 59, 10, 10, 32, 32, 98, 105, 110, 100, 105, 110, 103, 46, 111, 112, 101, 110, 40, 112, 97, 116, 104, 77, 111, 100, 117, 108, 101, 46, 95, 109, 97, 107, 101, 76, 111, 110, 103, 40, 112, 97, 116, 104, 41, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 115, 116, 114, 105, 110, 103, 84, 111, 70, 108, 97, 103, 115, 40, 102, 108, 97, 103, 41, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 48, 111, 54, 54, 54, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 114, 101, 113, 41, 59, 10, 125, 59, 10, 10, 99, 111, 110, 115, 116, 32, 107, 82, 101, 97, 100, 70, 105, 108, 101, 66, 117, 102, 102, 101, 114, 76, 101, 110, 103, 116, 104, 32, 61, 32, 56, 32, 42, 32, 49, 48, 50, 52, 59, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 82, 101, 97, 100, 70, 105, 108, 101, 67, 111, 110, 116, 101, 120, 116, 40, 99, 97, 108, 108, 98, 97, 99, 107, 44, 32, 101, 110, 99, 111, 100, 105, 110, 103, 41, 32, 123, 10, 32, 32, 116, 104, 105, 115, 46, 102, 100, 32, 61, 32, 117, 110, 100, 101, 102, 105, 110, 101, 100, 59, 10, 32, 32, 116, 104, 105, 115, 46, 115, 105, 122, 101, 32, 61, 32, 117, 110, 100, 101, 102, 105, 110, 101, 100, 59, 10, 32, 32, 116, 104, 105, 115, 46, 99, 97, 108, 108, 98, 97, 99, 107, 32, 61, 32, 99, 97, 108, 108, 98, 97, 99, 107, 59, 10, 32, 32, 116, 104, 105, 115, 46, 98, 117, 102, 102, 101, 114, 115, 32, 61, 32, 110, 117, 108, 108, 59, 10, 32, 32, 116, 104, 105, 115, 46, 98, 117, 102, 102, 101, 114, 32, 61, 32, 110, 117, 108, 108, 59, 10, 32, 32, 116, 104, 105, 115, 46, 112, 111, 115, 32, 61, 32, 48, 59, 10, 32, 32, 116, 104, 105, 115, 46, 101, 110, 99, 111, 100, 105, 110, 103, 32, 61, 32, 101, 110, 99, 111, 100, 105, 110, 103, 59, 10, 32, 32, 116, 104, 105, 115, 46, 101, 114, 114, 32, 61, 32, 110, 117, 108, 108, 59, 10, 125, 10, 10, 82, 101, 97, 100, 70, 105, 108, 101, 67, 111, 110, 116, 101, 120, 116, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 114, 101, 97, 100, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 32, 123, 10, 32, 32, 118, 97, 114, 32, 98, 117, 102, 102, 101, 114, 59, 10, 32, 32, 118, 97, 114, 32, 111, 102, 102, 115, 101, 116, 59, 10, 32, 32, 118, 97, 114, 32, 108, 101, 110, 103, 116, 104, 59, 10, 10, 32, 32, 105, 102, 32, 40, 116, 104, 105, 115, 46, 115, 105, 122, 101, 32, 61, 61, 61, 32, 48, 41, 32, 123, 10, 32, 32, 32, 32, 98, 117, 102, 102, 101, 114, 32, 61, 32, 116, 104, 105, 115, 46, 98, 117, 102, 102, 101, 114, 32, 61, 32, 110, 101, 119, 32, 83, 108, 111, 119, 66, 117, 102, 102, 101, 114, 40, 107, 82, 101, 97, 100, 70, 105, 108, 101, 66, 117, 102, 102, 101, 114, 76, 101, 110, 103, 116, 104, 41, 59, 10, 32, 32, 32, 32, 111, 102, 102, 115, 101, 116, 32, 61, 32, 48, 59, 10, 32, 32, 32, 32, 108, 101, 110, 103, 116, 104, 32, 61, 32, 107, 82, 101, 97, 100, 70, 105, 108, 101, 66, 117, 102, 102, 101, 114, 76, 101, 110, 103, 116, 104, 59, 10, 32, 32, 125, 32, 101, 108, 115, 101, 32, 123, 10, 32, 32, 32, 32, 98, 117, 102, 102, 101, 114, 32, 61, 32, 116, 104, 105, 115, 46, 98, 117, 102, 102, 101, 114, 59, 10, 32, 32, 32, 32, 111, 102, 102, 115, 101, 116, 32, 61, 32, 116, 104, 105, 115, 46, 112, 111, 115, 59, 10, 32, 32, 32, 32, 108, 101, 110, 103, 116, 104, 32, 61, 32, 116, 104, 105, 115, 46, 115, 105, 122, 101, 32, 45, 32, 116, 104, 105, 115, 46, 112, 111, 115, 59, 10, 32, 32, 125, 10, 10, 32, 32, 118, 97, 114, 32, 114, 101, 113, 32, 61, 32, 110, 101, 119, 32, 70, 83, 82, 101, 113, 87, 114, 97, 112, 40, 41, 59, 10, 32, 32, 114, 101, 113, 46, 111, 110, 99, 111, 109, 112, 108, 101, 116, 101, 32, 61, 32, 114, 101, 97, 100, 70, 105, 108, 101, 65, 102, 116, 101, 114, 82, 101, 97, 100, 59, 10, 32, 32, 114, 101, 113, 46, 99, 111, 110, 116, 101, 120, 116, 32, 61, 32, 116, 104, 105, 115, 59, 10, 10, 32, 32, 98, 105, 110, 100, 105, 110, 103, 46, 114, 101, 97, 100, 40, 116, 104, 105, 115, 46, 102, 100, 44, 32, 98, 117, 102, 102, 101, 114, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 108, 101, 110, 103, 116, 104, 44, 32, 45, 49, 44, 32, 114, 101, 113, 41, 59, 10, 125, 59, 10, 10, 82, 101, 97, 100, 70, 105, 108, 101, 67, 111, 110, 116, 101, 120, 116, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 99, 108, 111, 115, 101, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 101, 114, 114, 41, 32, 123, 10, 32, 32, 118, 97, 114, 32, 114, 101, 113, 32, 61, 32, 110, 101, 119, 32, 70, 83, 82, 101, 113, 87, 114, 97, 112, 40, 41, 59, 10, 32, 32, 114, 101, 113, 46, 111, 110, 99, 111, 109, 112, 108, 101, 116, 101, 32, 61, 32, 114, 101, 97, 100, 70, 105, 108, 101, 65, 102, 116, 101, 114, 67, 108, 111, 115, 101, 59, 10, 32, 32, 114, 101, 113, 46, 99, 111, 110, 116, 101, 120, 116, 32, 61, 32, 116, 104, 105, 115, 59, 10, 32, 32, 116, 104, 105, 115, 46, 101, 114, 114, 32, 61, 32, 101, 114, 114, 59, 10, 32, 32, 98, 105, 110, 100, 105, 110, 103, 46, 99, 108, 111, 115, 101, 40, 116, 104, 105, 115, 46, 102, 100, 44, 32, 114, 101, 113, 41, 59, 10, 125, 59, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 114, 101, 97, 100, 70, 105, 108, 101, 65, 102, 116, 101, 114, 79, 112, 101, 110, 40, 101, 114, 114, 44, 32, 102, 100, 41, 32, 123, 10, 32, 32, 118, 97, 114, 32, 99, 111, 110, 116, 101, 120, 116, 32, 61, 32, 116, 104, 105, 115, 46, 99, 111, 110, 116, 101, 120, 116, 59, 10, 10, 32, 32, 105, 102, 32, 40, 101, 114, 114, 41, 32, 123, 10, 32, 32, 32, 32, 99, 111, 110, 116, 101, 120, 116, 46, 99, 97, 108, 108, 98, 97, 99, 107, 40, 101, 114, 114, 41, 59, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 59, 10, 32, 32, 125, 10, 10, 32, 32, 99, 111, 110, 116, 101, 120, 116, 46, 102, 100, 32, 61, 32, 102, 100, 59, 10, 10, 32, 32, 118, 97, 114, 32, 114, 101, 113, 32, 61, 32, 110, 101, 119, 32, 70, 83, 82, 101, 113, 87, 114, 97, 112, 40, 41, 59, 10, 32, 32, 114, 101, 113, 46, 111, 110, 99, 111, 109, 112, 108, 101, 116, 101, 32, 61, 32, 114, 101, 97, 100, 70, 105, 108, 101, 65, 102, 116, 101, 114, 83, 116, 97, 116, 59, 10, 32, 32, 114, 101, 113, 46, 99, 111, 110, 116, 101, 120, 116, 32, 61, 32, 99, 111, 110, 116, 101, 120, 116, 59, 10, 32, 32, 98, 105, 110, 100, 105, 110, 103, 46, 102, 115, 116, 97, 116, 40, 102, 100, 44, 32, 114, 101, 113, 41, 59, 10, 125, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 114, 101, 97, 100, 70, 105, 108, 101, 65, 102, 116, 101, 114, 83, 116, 97, 116, 40, 101, 114, 114, 44, 32, 115, 116, 41, 32, 123, 10, 32, 32, 118, 97, 114, 32, 99, 111, 110, 116, 101, 120, 116, 32, 61, 32, 116, 104, 105, 115, 46, 99, 111, 110, 116, 101, 120, 116, 59, 10, 10, 32, 32, 105, 102, 32, 40, 101, 114, 114, 41, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 99, 111, 110, 116, 101, 120, 116, 46, 99, 108, 111, 115, 101, 40, 101, 114, 114, 41, 59, 10, 10, 32, 32, 118, 97, 114, 32, 115, 105, 122, 101, 32, 61, 32, 99, 111, 110, 116, 101, 120, 116, 46, 115, 105, 122, 101, 32, 61, 32, 115, 116, 46, 105, 115, 70, 105, 108, 101, 40, 41, 32, 63, 32, 115, 116, 46, 115, 105, 122, 101, 32, 58, 32, 48, 59, 10, 10, 32, 32, 105, 102, 32, 40, 115, 105, 122, 101, 32, 61, 61, 61, 32, 48, 41, 32, 123, 10, 32, 32, 32, 32, 99, 111, 110, 116, 101, 120, 116, 46, 98, 117, 102, 102, 101, 114, 115, 32, 61, 32, 91, 93, 59, 10, 32, 32, 32, 32, 99, 111, 110, 116, 101, 120, 116, 46, 114, 101, 97, 100, 40, 41, 59, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 59, 10, 32, 32, 125, 10, 10, 32, 32, 105, 102, 32, 40, 115, 105, 122, 101, 32, 62, 32, 107, 77, 97, 120, 76, 101, 110, 103, 116, 104, 41, 32, 123, 10, 32, 32, 32, 32, 101, 114, 114, 32, 61, 32, 110, 101, 119, 32, 82, 97, 110, 103, 101, 69, 114, 114, 111, 114, 40, 39, 70, 105, 108, 101, 32, 115, 105, 122, 101, 32, 105, 115, 32, 103, 114, 101, 97, 116, 101, 114, 32, 116, 104, 97, 110, 32, 112, 111, 115, 115, 105, 98, 108, 101, 32, 66, 117, 102, 102, 101, 114, 58, 32, 39, 32, 43, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 96, 48, 120, 36, 123, 107, 77, 97, 120, 76, 101, 110, 103, 116, 104, 46, 116, 111, 83, 116, 114, 105, 110, 103, 40, 49, 54, 41, 125, 32, 98, 121, 116, 101, 115, 96, 41, 59, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 99, 111, 110, 116, 101, 120, 116, 46, 99, 108, 111, 115, 101, 40, 101, 114, 114, 41, 59, 10, 32, 32, 125, 10, 10, 32, 32, 99, 111, 110, 116, 101, 120, 116, 46, 98, 117, 102, 102, 101, 114, 32, 61, 32, 110, 101, 119, 32, 83, 108, 111, 119, 66, 117, 102, 102, 101, 114, 40, 115, 105, 122, 101, 41, 59, 10, 32, 32, 99, 111, 110, 116, 101, 120, 116, 46, 114, 101, 97, 100, 40, 41, 59, 10, 125, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 114, 101, 97, 100, 70, 105, 108, 101, 65, 102, 116, 101, 114, 82, 101, 97, 100, 40, 101, 114, 114, 44, 32, 98, 121, 116, 101, 115, 82, 101, 97, 100, 41, 32, 123, 10, 32, 32, 118, 97, 114, 32, 99, 111, 110, 116, 101, 120, 116, 32, 61, 32, 116, 104, 105, 115, 46, 99, 111, 110, 116, 101, 120, 116, 59, 10, 10, 32, 32, 105, 102, 32, 40, 101, 114, 114, 41, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 99, 111, 110, 116, 101, 120, 116, 46, 99, 108, 111, 115, 101, 40, 101, 114, 114, 41, 59, 10, 10, 32, 32, 105, 102, 32, 40, 98, 121, 116, 101, 115, 82, 101, 97, 100, 32, 61, 61, 61, 32, 48, 41, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 99, 111, 110, 116, 101, 120, 116, 46, 99, 108, 111, 115, 101, 40, 41, 59, 10, 10, 32, 32, 99, 111, 110, 116, 101, 120, 116, 46, 112, 111, 115, 32, 43, 61, 32, 98, 121, 116, 101, 115, 82, 101, 97, 100, 59, 10, 10, 32, 32, 105, 102, 32, 40, 99, 111, 110, 116, 101, 120, 116, 46, 115, 105, 122, 101, 32, 33, 61, 61, 32, 48, 41, 32, 123, 10, 32, 32, 32, 32, 105, 102, 32, 40, 99, 111, 110, 116, 101, 120, 116, 46, 112, 111, 115, 32, 61, 61, 61, 32, 99, 111, 110, 116, 101, 120, 116, 46, 115, 105, 122, 101, 41, 10, 32, 32, 32, 32, 32, 32, 99, 111, 110, 116, 101, 120, 116, 46, 99, 108, 111, 115, 101, 40, 41, 59, 10, 32, 32, 32, 32, 101, 108, 115, 101, 10, 32, 32, 32, 32, 32, 32, 99, 111, 110, 116, 101, 120, 116, 46, 114, 101, 97, 100, 40, 41, 59, 10, 32, 32, 125, 32, 101, 108, 115, 101, 32, 123, 10, 32, 32, 32, 32, 47, 47, 32, 117, 110, 107, 110, 111, 119, 110, 32, 115, 105, 122, 101, 44, 32, 106, 117, 115, 116, 32, 114, 101, 97, 100, 32, 117, 110, 116, 105, 108, 32, 119, 101, 32, 100, 111, 110, 39, 116, 32, 103, 101, 116, 32, 98, 121, 116, 101, 115, 46, 10, 32, 32, 32, 32, 99, 111, 110, 116, 101, 120, 116, 46, 98, 117, 102, 102, 101, 114, 115, 46, 112, 117, 115, 104, 40, 99, 111, 110, 116, 101, 120, 116, 46, 98, 117, 102, 102, 101, 114, 46, 115, 108, 105, 99, 101, 40, 48, 44, 32, 98, 121, 116, 101, 115, 82, 101, 97, 100, 41, 41, 59, 10, 32, 32, 32, 32, 99, 111, 110, 116, 101, 120, 116, 46, 114, 101, 97, 100, 40, 41, 59, 10, 32, 32, 125, 10, 125, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 114, 101, 97, 100, 70, 105, 108, 101, 65, 102, 116, 101, 114, 67, 108, 111, 115, 101, 40, 101, 114, 114, 41, 32, 123, 10, 32, 32, 118, 97, 114, 32, 99, 111, 110, 116, 101, 120, 116, 32, 61, 32, 116, 104, 105, 115, 46, 99, 111, 110, 116, 101, 120, 116, 59, 10, 32, 32, 118, 97, 114, 32, 98, 117, 102, 102, 101, 114, 32, 61, 32, 110, 117, 108, 108, 59, 10, 32, 32, 118, 97, 114, 32, 99, 97, 108, 108, 98, 97, 99, 107, 32, 61, 32, 99, 111, 110, 116, 101, 120, 116, 46, 99, 97, 108, 108, 98, 97, 99, 107, 59, 10, 10, 32, 32, 105, 102, 32, 40, 99, 111, 110, 116, 101, 120, 116, 46, 101, 114, 114, 41, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 99, 97, 108, 108, 98, 97, 99, 107, 40, 99, 111, 110, 116, 101, 120, 116, 46, 101, 114, 114, 41, 59, 10, 10, 32, 32, 105, 102, 32, 40, 99, 111, 110, 116, 101, 120, 116, 46, 115, 105, 122, 101, 32, 61, 61, 61, 32, 48, 41, 10, 32, 32, 32, 32, 98, 117, 102, 102, 101, 114, 32, 61, 32, 66, 117, 102, 102, 101, 114, 46, 99, 111, 110, 99, 97, 116, 40, 99, 111, 110, 116, 101, 120, 116, 46, 98, 117, 102, 102, 101, 114, 115, 44, 32, 99, 111, 110, 116, 101, 120, 116, 46, 112, 111, 115, 41, 59, 10, 32, 32, 101, 108, 115, 101, 32, 105, 102, 32, 40, 99, 111, 110, 116, 101, 120, 116, 46, 112, 111, 115, 32, 60, 32, 99, 111, 110, 116, 101, 120, 116, 46, 115, 105, 122, 101, 41, 10, 32, 32, 32, 32, 98, 117, 102, 102, 101, 114, 32, 61, 32, 99, 111, 110, 116, 101, 120, 116, 46, 98, 117, 102, 102, 101, 114, 46, 115, 108, 105, 99, 101, 40, 48, 44, 32, 99, 111, 110, 116, 101, 120, 116, 46, 112, 111, 115, 41, 59, 10, 32, 32, 101, 108, 115, 101, 10, 32, 32, 32, 32, 98, 117, 102, 102, 101, 114, 32, 61, 32, 99, 111, 110, 116, 101, 120, 116, 46, 98, 117, 102, 102, 101, 114, 59, 10, 10, 32, 32, 105, 102, 32, 40, 99, 111, 110, 116, 101, 120, 116, 46, 101, 110, 99, 111, 100, 105, 110, 103, 41, 10, 32, 32, 32, 32, 98, 117, 102, 102, 101, 114, 32, 61, 32, 98, 117, 102, 102, 101, 114, 46, 116, 111, 83, 116, 114, 105, 110, 103, 40, 99, 111, 110, 116, 101, 120, 116, 46, 101, 110, 99, 111, 100, 105, 110, 103, 41, 59, 10, 10, 32, 32, 99, 97, 108, 108, 98, 97, 99, 107, 40, 101, 114, 114, 44, 32, 98, 117, 102, 102, 101, 114, 41, 59, 10, 125, 10, 10, 10, 102, 115, 46, 114, 101, 97, 100, 70, 105, 108, 101, 83, 121, 110, 99, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 112, 97, 116, 104, 44, 32, 111, 112, 116, 105, 111, 110, 115, 41, 32, 123, 10, 32, 32, 105, 102, 32, 40, 33, 111, 112, 116, 105, 111, 110, 115, 41, 32, 123, 10, 32, 32, 32, 32, 111, 112, 116, 105, 111, 110, 115, 32, 61, 32, 123, 32, 101, 110, 99, 111, 100, 105, 110, 103, 58, 32, 110, 117, 108, 108, 44, 32, 102, 108, 97, 103, 58, 32, 39, 114, 39, 32, 125, 59, 10, 32, 32, 125, 32, 101, 108, 115, 101, 32, 105, 102, 32, 40, 116, 121, 112, 101, 111, 102, 32, 111, 112, 116, 105, 111, 110, 115, 32, 61, 61, 61, 32, 39, 115, 116, 114, 105, 110, 103, 39, 41, 32, 123, 10, 32, 32, 32, 32, 111, 112, 116, 105, 111, 110, 115, 32, 61, 32, 123, 32, 101, 110, 99, 111, 100, 105, 110, 103, 58, 32, 111, 112, 116, 105, 111, 110, 115, 44, 32, 102, 108, 97, 103, 58, 32, 39, 114, 39, 32, 125, 59, 10, 32, 32, 125, 32, 101, 108, 115, 101, 32, 105, 102, 32, 40, 116, 121, 112, 101, 111, 102, 32, 111, 112, 116, 105, 111, 110, 115, 32, 33, 61, 61, 32, 39, 111, 98, 106, 101, 99, 116, 39, 41, 32, 123, 10, 32, 32, 32, 32, 116, 104, 114, 111, 119, 79, 112, 116, 105, 111, 110, 115, 69, 114, 114, 111, 114, 40, 111, 112, 116, 105, 111, 110, 115, 41, 59, 10, 32, 32, 125, 10, 10, 32, 32, 118, 97, 114, 32, 101, 110, 99, 111, 100, 105, 110, 103, 32, 61, 32, 111, 112, 116, 105, 111, 110, 115, 46, 101, 110, 99, 111, 100, 105, 110, 103, 59, 10, 32, 32, 97, 115, 115, 101, 114, 116, 69, 110, 99, 111, 100, 105, 110, 103, 40, 101, 110, 99, 111, 100, 105, 110, 103, 41, 59, 10, 10, 32, 32, 118, 97, 114, 32, 102, 108, 97, 103, 32, 61, 32, 111, 112, 116, 105, 111, 110, 115, 46, 102, 108, 97, 103, 32, 124, 124, 32, 39, 114, 39, 59, 10, 32, 32, 118, 97, 114, 32, 102, 100, 32, 61, 32, 102, 115, 46, 111, 112, 101, 110, 83, 121, 110, 99, 40, 112, 97, 116, 104, 44, 32, 102, 108, 97, 103, 44, 32, 48, 111, 54, 54, 54, 41, 59, 10, 10, 32, 32, 118, 97, 114, 32, 115, 116, 59, 10, 32, 32, 118, 97, 114, 32, 115, 105, 122, 101, 59, 10, 32, 32, 118, 97, 114, 32, 116, 104, 114, 101, 119, 32, 61, 32, 116, 114, 117, 101, 59, 10, 32, 32, 116, 114, 121, 32, 123, 10, 32, 32, 32, 32, 115, 116, 32, 61, 32, 102, 115, 46, 102, 115, 116, 97, 116, 83, 121, 110, 99, 40, 102, 100, 41, 59, 10, 32, 32, 32, 32, 115, 105, 122, 101, 32, 61, 32, 115, 116, 46, 105, 115, 70, 105, 108, 101, 40, 41, 32, 63, 32, 115, 116, 46, 115, 105, 122, 101, 32, 58, 32, 48, 59, 10, 32, 32, 32, 32, 116, 104, 114, 101, 119, 32, 61, 32, 102, 97, 108, 115, 101, 59, 10, 32, 32, 125, 32, 102, 105, 110, 97, 108, 108, 121, 32, 123, 10, 32, 32, 32, 32, 105, 102, 32, 40, 116, 104, 114, 101, 119, 41, 32, 102, 115, 46, 99, 108, 111, 115, 101, 83, 121, 110, 99, 40, 102, 100, 41, 59, 10, 32, 32, 125, 10, 10, 32, 32, 118, 97, 114, 32, 112, 111, 115, 32, 61, 32, 48, 59, 10, 32, 32, 118, 97, 114, 32, 98, 117, 102, 102, 101, 114, 59, 32, 47, 47, 32, 115, 105, 110, 103, 108, 101, 32, 98, 117, 102, 102, 101, 114, 32, 119, 105, 116, 104, 32, 102, 105, 108, 101, 32, 100, 97, 116, 97, 10, 32, 32, 118, 97, 114, 32, 98, 117, 102, 102, 101, 114, 115, 59, 32, 47, 47, 32, 108, 105, 115, 116, 32, 102, 111, 114, 32, 119, 104, 101, 110, 32, 115, 105, 122, 101, 32, 105, 115, 32, 117, 110, 107, 110, 111, 119, 110, 10, 10, 32, 32, 105, 102, 32, 40, 115, 105, 122, 101, 32, 61, 61, 61, 32, 48, 41, 32, 123, 10, 32, 32, 32, 32, 98, 117, 102, 102, 101, 114, 115, 32, 61, 32, 91, 93, 59, 10, 32, 32, 125, 32, 101, 108, 115, 101, 32, 123, 10, 32, 32, 32, 32, 116, 104, 114, 101, 119, 32, 61, 32, 116, 114, 117, 101, 59, 10, 32, 32, 32, 32, 116, 114, 121, 32, 123, 10, 32, 32, 32, 32, 32, 32, 98, 117, 102, 102, 101, 114, 32, 61, 32, 110, 101, 119, 32, 66, 117, 102, 102, 101, 114, 40, 115, 105, 122, 101, 41, 59, 10, 32, 32, 32, 32, 32, 32, 116, 104, 114, 101, 119, 32, 61, 32, 102, 97, 108, 115, 101, 59, 10, 32, 32, 32, 32, 125, 32, 102, 105, 110, 97, 108, 108, 121, 32, 123, 10, 32, 32, 32, 32, 32, 32, 105, 102, 32, 40, 116, 104, 114, 101, 119, 41, 32, 102, 115, 46, 99, 108, 111, 115, 101, 83, 121, 110, 99, 40, 102, 100, 41, 59, 10, 32, 32, 32, 32, 125, 10, 32, 32, 125, 10, 10, 32, 32, 118, 97, 114, 32, 100, 111, 110, 101, 32, 61, 32, 102, 97, 108, 115, 101, 59, 10, 32, 32, 118, 97, 114, 32, 98, 121, 116, 101, 115, 82, 101, 97, 100, 59, 10, 10, 32, 32, 119, 104, 105, 108, 101, 32, 40, 33, 100, 111, 110, 101, 41, 32, 123, 10, 32, 32, 32, 32, 116, 104, 114, 101, 119, 32, 61, 32, 116, 114, 117, 101, 59, 10, 32, 32, 32, 32, 116, 114, 121, 32, 123, 10, 32, 32, 32, 32, 32, 32, 105, 102, 32, 40, 115, 105, 122, 101, 32, 33, 61, 61, 32, 48, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 98, 121, 116, 101, 115, 82, 101, 97, 100, 32, 61, 32, 102, 115, 46, 114, 101, 97, 100, 83, 121, 110, 99, 40, 102, 100, 44, 32, 98, 117, 102, 102, 101, 114, 44, 32, 112, 111, 115, 44, 32, 115, 105, 122, 101, 32, 45, 32, 112, 111, 115, 41, 59, 10, 32, 32, 32, 32, 32, 32, 125, 32, 101, 108, 115, 101, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 47, 47, 32, 116, 104, 101, 32, 107, 101, 114, 110, 101, 108, 32, 108, 105, 101, 115, 32, 97, 98, 111, 117, 116, 32, 109, 97, 110, 121, 32, 102, 105, 108, 101, 115, 46, 10, 32, 32, 32, 32, 32, 32, 32, 32, 47, 47, 32, 71, 111, 32, 97, 104, 101, 97, 100, 32, 97, 110, 100, 32, 116, 114, 121, 32, 116, 111, 32, 114, 101, 97, 100, 32, 115, 111, 109, 101, 32, 98, 121, 116, 101, 115, 46, 10, 32, 32, 32, 32, 32, 32, 32, 32, 98, 117, 102, 102, 101, 114, 32, 61, 32, 110, 101, 119, 32, 66, 117, 102, 102, 101, 114, 40, 56, 49, 57, 50, 41, 59, 10, 32, 32, 32, 32, 32, 32, 32, 32, 98, 121, 116, 101, 115, 82, 101, 97, 100, 32, 61, 32, 102, 115, 46, 114, 101, 97, 100, 83, 121, 110, 99, 40, 102, 100, 44, 32, 98, 117, 102, 102, 101, 114, 44, 32, 48, 44, 32, 56, 49, 57, 50, 41, 59, 10, 32, 32, 32, 32, 32, 32, 32, 32, 105, 102, 32, 40, 98, 121, 116, 101, 115, 82, 101, 97, 100, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 98, 117, 102, 102, 101, 114, 115, 46, 112, 117, 115, 104, 40, 98, 117, 102, 102, 101, 114, 46, 115, 108, 105, 99, 101, 40, 48, 44, 32, 98, 121, 116, 101, 115, 82, 101, 97, 100, 41, 41, 59, 10, 32, 32, 32, 32, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 32, 32, 116, 104, 114, 101, 119, 32, 61, 32, 102, 97, 108, 115, 101, 59, 10, 32, 32, 32, 32, 125, 32, 102, 105, 110, 97, 108, 108, 121, 32, 123, 10, 32, 32, 32, 32, 32, 32, 105, 102, 32, 40, 116, 104, 114, 101, 119, 41, 32, 102, 115, 46, 99, 108, 111, 115, 101, 83, 121, 110, 99, 40, 102, 100, 41, 59, 10, 32, 32, 32, 32, 125, 10, 10, 32, 32, 32, 32, 112, 111, 115, 32, 43, 61, 32, 98, 121, 116, 101, 115, 82, 101, 97, 100, 59, 10, 32, 32, 32, 32, 100, 111, 110, 101, 32, 61, 32, 40, 98, 121, 116, 101, 115, 82, 101, 97, 100, 32, 61, 61, 61, 32, 48, 41, 32, 124, 124, 32, 40, 115, 105, 122, 101, 32, 33, 61, 61, 32, 48, 32, 38, 38, 32, 112, 111, 115, 32, 62, 61, 32, 115, 105, 122, 101, 41, 59, 10, 32, 32, 125, 10, 10, 32, 32, 102, 115, 46, 99, 108, 111, 115, 101, 83, 121, 110, 99, 40, 102, 100, 41, 59, 10, 10, 32, 32, 105, 102, 32, 40, 115, 105, 122, 101, 32, 61, 61, 61, 32, 48, 41, 32, 123, 10, 32, 32, 32, 32, 47, 47, 32, 100, 97, 116, 97, 32, 119, 97, 115, 32, 99, 111, 108, 108, 101, 99, 116, 101, 100, 32, 105, 110, 116, 111, 32, 116, 104, 101, 32, 98, 117, 102, 102, 101, 114, 115, 32, 108, 105, 115, 116, 46, 10, 32, 32, 32, 32, 98, 117, 102, 102, 101, 114, 32, 61, 32, 66, 117, 102, 102, 101, 114, 46, 99, 111, 110, 99, 97, 116, 40, 98, 117, 102, 102, 101, 114, 115, 44, 32, 112, 111, 115, 41, 59, 10, 32, 32, 125, 32, 101, 108, 115, 101, 32, 105, 102, 32, 40, 112, 111, 115, 32, 60, 32, 115, 105, 122, 101, 41, 32, 123, 10, 32, 32, 32, 32, 98, 117, 102, 102, 101, 114, 32, 61, 32, 98, 117, 102, 102, 101, 114, 46, 115, 108, 105, 99, 101, 40, 48, 44, 32, 112, 111, 115, 41, 59, 10, 32, 32, 125, 10, 10, 32, 32, 105, 102, 32, 40, 101, 110, 99, 111, 100, 105, 110, 103, 41, 32, 98, 117, 102, 102, 101, 114, 32, 61, 32, 98, 117, 102, 102, 101, 114, 46, 116, 111, 83, 116, 114, 105, 110, 103, 40, 101, 110, 99, 111, 100, 105, 110, 103, 41, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 98, 117, 102, 102, 101, 114, 59, 10, 125, 59, 10, 10, 10, 47, 47, 32, 85, 115, 101, 100, 32, 98, 121, 32, 98, 105, 110, 100, 105, 110, 103, 46, 111, 112, 101, 110, 32, 97, 110, 100, 32, 102, 114, 105, 101, 110, 100, 115, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 115, 116, 114, 105, 110, 103, 84, 111, 70, 108, 97, 103, 115, 40, 102, 108, 97, 103, 41, 32, 123, 10, 32, 32, 47, 47, 32, 79, 110, 108, 121, 32, 109, 101, 115, 115, 32, 119, 105, 116, 104, 32, 115, 116, 114, 105, 110, 103, 115, 10, 32, 32, 105, 102, 32, 40, 116, 121, 112, 101, 111, 102, 32, 102, 108, 97, 103, 32, 33, 61, 61, 32, 39, 115, 116, 114, 105, 110, 103, 39, 41, 32, 123, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 102, 108, 97, 103, 59, 10, 32, 32, 125, 10, 10, 32, 32, 115, 119, 105, 116, 99, 104, 32, 40, 102, 108, 97, 103, 41, 32, 123, 10, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 114, 39, 32, 58, 32, 114, 101, 116, 117, 114, 110, 32, 79, 95, 82, 68, 79, 78, 76, 89, 59, 10, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 114, 115, 39, 32, 58, 32, 47, 47, 32, 102, 97, 108, 108, 32, 116, 104, 114, 111, 117, 103, 104, 10, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 115, 114, 39, 32, 58, 32, 114, 101, 116, 117, 114, 110, 32, 79, 95, 82, 68, 79, 78, 76, 89, 32, 124, 32, 79, 95, 83, 89, 78, 67, 59, 10, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 114, 43, 39, 32, 58, 32, 114, 101, 116, 117, 114, 110, 32, 79, 95, 82, 68, 87, 82, 59, 10, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 114, 115, 43, 39, 32, 58, 32, 47, 47, 32, 102, 97, 108, 108, 32, 116, 104, 114, 111, 117, 103, 104, 10, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 115, 114, 43, 39, 32, 58, 32, 114, 101, 116, 117, 114, 110, 32, 79, 95, 82, 68, 87, 82, 32, 124, 32, 79, 95, 83, 89, 78, 67, 59, 10, 10, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 119, 39, 32, 58, 32, 114, 101, 116, 117, 114, 110, 32, 79, 95, 84, 82, 85, 78, 67, 32, 124, 32, 79, 95, 67, 82, 69, 65, 84, 32, 124, 32, 79, 95, 87, 82, 79, 78, 76, 89, 59, 10, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 119, 120, 39, 32, 58, 32, 47, 47, 32, 102, 97, 108, 108, 32, 116, 104, 114, 111, 117, 103, 104, 10, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 120, 119, 39, 32, 58, 32, 114, 101, 116, 117, 114, 110, 32, 79, 95, 84, 82, 85, 78, 67, 32, 124, 32, 79, 95, 67, 82, 69, 65, 84, 32, 124, 32, 79, 95, 87, 82, 79, 78, 76, 89, 32, 124, 32, 79, 95, 69, 88, 67, 76, 59, 10, 10, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 119, 43, 39, 32, 58, 32, 114, 101, 116, 117, 114, 110, 32, 79, 95, 84, 82, 85, 78, 67, 32, 124, 32, 79, 95, 67, 82, 69, 65, 84, 32, 124, 32, 79, 95, 82, 68, 87, 82, 59, 10, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 119, 120, 43, 39, 58, 32, 47, 47, 32, 102, 97, 108, 108, 32, 116, 104, 114, 111, 117, 103, 104, 10, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 120, 119, 43, 39, 58, 32, 114, 101, 116, 117, 114, 110, 32, 79, 95, 84, 82, 85, 78, 67, 32, 124, 32, 79, 95, 67, 82, 69, 65, 84, 32, 124, 32, 79, 95, 82, 68, 87, 82, 32, 124, 32, 79, 95, 69, 88, 67, 76, 59, 10, 10, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 97, 39, 32, 58, 32, 114, 101, 116, 117, 114, 110, 32, 79, 95, 65, 80, 80, 69, 78, 68, 32, 124, 32, 79, 95, 67, 82, 69, 65, 84, 32, 124, 32, 79, 95, 87, 82, 79, 78, 76, 89, 59, 10, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 97, 120, 39, 32, 58, 32, 47, 47, 32, 102, 97, 108, 108, 32, 116, 104, 114, 111, 117, 103, 104, 10, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 120, 97, 39, 32, 58, 32, 114, 101, 116, 117, 114, 110, 32, 79, 95, 65, 80, 80, 69, 78, 68, 32, 124, 32, 79, 95, 67, 82, 69, 65, 84, 32, 124, 32, 79, 95, 87, 82, 79, 78, 76, 89, 32, 124, 32, 79, 95, 69, 88, 67, 76, 59, 10, 10, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 97, 43, 39, 32, 58, 32, 114, 101, 116, 117, 114, 110, 32, 79, 95, 65, 80, 80, 69, 78, 68, 32, 124, 32, 79, 95, 67, 82, 69, 65, 84, 32, 124, 32, 79, 95, 82, 68, 87, 82, 59, 10, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 97, 120, 43, 39, 58, 32, 47, 47, 32, 102, 97, 108, 108, 32, 116, 104, 114, 111, 117, 103, 104, 10, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 120, 97, 43, 39, 58, 32, 114, 101, 116, 117, 114, 110, 32, 79, 95, 65, 80, 80, 69, 78, 68, 32, 124, 32, 79, 95, 67, 82, 69, 65, 84, 32, 124, 32, 79, 95, 82, 68, 87, 82, 32, 124, 32, 79, 95, 69, 88, 67, 76, 59, 10, 32, 32, 125, 10, 10, 32, 32, 116, 104, 114, 111, 119, 32, 110, 101, 119, 32, 69, 114, 114, 111, 114, 40, 39, 85, 110, 107, 110, 111, 119, 110, 32, 102, 105, 108, 101, 32, 111, 112, 101, 110, 32, 102, 108, 97, 103, 58, 32, 39, 32, 43, 32, 102, 108, 97, 103, 41, 59, 10, 125, 10, 10, 47, 47, 32, 101, 120, 112, 111, 114, 116, 101, 100, 32, 98, 117, 116, 32, 104, 105, 100, 100, 101, 110, 44, 32, 111, 110, 108, 121, 32, 117, 115, 101, 100, 32, 98, 121, 32, 116, 101, 115, 116, 47, 115, 105, 109, 112, 108, 101, 47, 116, 101, 115, 116, 45, 102, 115, 45, 111, 112, 101, 110, 45, 102, 108, 97, 103, 115, 46, 106, 115, 10, 79, 98, 106, 101, 99, 116, 46, 100, 101, 102, 105, 110, 101, 80, 114, 111, 112, 101, 114, 116, 121, 40, 101, 120, 112, 111, 114, 116, 115, 44, 32, 39, 95, 115, 116, 114, 105, 110, 103, 84, 111, 70, 108, 97, 103, 115, 39, 44, 32, 123, 10, 32, 32, 101, 110, 117, 109, 101, 114, 97, 98, 108, 101, 58, 32, 102, 97, 108, 115, 101, 44, 10, 32, 32, 118, 97, 108, 117, 101, 58, 32, 115, 116, 114, 105, 110, 103, 84, 111, 70, 108, 97, 103, 115, 10, 125, 41, 59, 10, 10, 10, 47, 47, 32, 89, 101, 115, 44, 32, 116, 104, 101, 32, 102, 111, 108, 108, 111, 119, 32, 99, 111, 117, 108, 100, 32, 98, 101, 32, 101, 97, 115, 105, 108, 121, 32, 68, 82, 89, 101, 100, 32, 117, 112, 32, 98, 117, 116, 32, 73, 32, 112, 114, 111, 118, 105, 100, 101, 32, 116, 104, 101, 32, 101, 120, 112, 108, 105, 99, 105, 116, 10, 47, 47, 32, 108, 105, 115, 116, 32, 116, 111, 32, 109, 97, 107, 101, 32, 116, 104, 101, 32, 97, 114, 103, 117, 109, 101, 110, 116, 115, 32, 99, 108, 101, 97, 114, 46, 10, 10, 102, 115, 46, 99, 108, 111, 115, 101, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 102, 100, 44, 32, 99, 97, 108, 108, 98, 97, 99, 107, 41, 32, 123, 10, 32, 32, 118, 97, 114, 32, 114, 101, 113, 32, 61, 32, 110, 101, 119, 32, 70, 83, 82, 101, 113, 87, 114, 97, 112, 40, 41, 59, 10, 32, 32, 114, 101, 113, 46, 111, 110, 99, 111, 109, 112, 108, 101, 116, 101, 32, 61, 32, 109, 97, 107, 101, 67, 97, 108, 108, 98, 97, 99, 107, 40, 99, 97, 108, 108, 98, 97, 99, 107, 41, 59, 10, 32, 32, 98, 105, 110, 100, 105, 110, 103, 46, 99, 108, 111, 115, 101, 40, 102, 100, 44, 32, 114, 101, 113, 41, 59, 10, 125, 59, 10, 10, 102, 115, 46, 99, 108, 111, 115, 101, 83, 121, 110, 99, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 102, 100, 41, 32, 123, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 98, 105, 110, 100, 105, 110, 103, 46, 99, 108, 111, 115, 101, 40, 102, 100, 41, 59, 10, 125, 59, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 109, 111, 100, 101, 78, 117, 109, 40, 109, 44, 32, 100, 101, 102, 41, 32, 123, 10, 32, 32, 105, 102, 32, 40, 116, 121, 112, 101, 111, 102, 32, 109, 32, 61, 61, 61, 32, 39, 110, 117, 109, 98, 101, 114, 39, 41, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 109, 59, 10, 32, 32, 105, 102, 32, 40, 116, 121, 112, 101, 111, 102, 32, 109, 32, 61, 61, 61, 32, 39, 115, 116, 114, 105, 110, 103, 39, 41, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 112, 97, 114, 115, 101, 73, 110, 116, 40, 109, 44, 32, 56, 41, 59, 10, 32, 32, 105, 102, 32, 40, 100, 101, 102, 41, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 109, 111, 100, 101, 78, 117, 109, 40, 100, 101, 102, 41, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 117, 110, 100, 101, 102, 105, 110, 101, 100, 59, 10, 125, 10, 10, 102, 115, 46, 111, 112, 101, 110, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 112, 97, 116, 104, 44, 32, 102, 108, 97, 103, 115, 44, 32, 109, 111, 100, 101, 44, 32, 99, 97, 108, 108, 98, 97, 99, 107, 95, 41, 32, 123, 10, 32, 32, 118, 97, 114, 32, 99, 97, 108, 108, 98, 97, 99, 107, 32, 61, 32, 109, 97, 107, 101, 67, 97, 108, 108, 98, 97, 99, 107, 40, 97, 114, 103, 117, 109, 101, 110, 116, 115, 91, 97, 114, 103, 117, 109, 101, 110, 116, 115, 46, 108, 101, 110, 103, 116, 104, 32, 45, 32, 49, 93, 41, 59, 10, 32, 32, 109, 111, 100, 101, 32, 61, 32, 109, 111, 100, 101, 78, 117, 109, 40, 109, 111, 100, 101, 44, 32, 48, 111, 54, 54, 54, 41, 59, 10, 10, 32, 32, 105, 102, 32, 40, 33, 110, 117, 108, 108, 67, 104, 101, 99, 107, 40, 112, 97, 116, 104, 44, 32, 99, 97, 108, 108, 98, 97, 99, 107, 41, 41, 32, 114, 101, 116, 117, 114, 110, 59, 10, 10, 32, 32, 118, 97, 114, 32, 114, 101, 113, 32, 61, 32, 110, 101, 119, 32, 70, 83, 82, 101, 113, 87, 114, 97, 112, 40, 41, 59, 10, 32, 32, 114, 101, 113, 46, 111, 110, 99, 111, 109, 112, 108, 101, 116, 101, 32, 61, 32, 99, 97, 108, 108, 98, 97, 99, 107, 59, 10, 10, 32, 32, 98, 105, 110, 100, 105, 110, 103, 46, 111, 112, 101, 110, 40, 112, 97, 116, 104, 77, 111, 100, 117, 108, 101, 46, 95, 109, 97, 107, 101, 76, 111, 110, 103, 40, 112, 97, 116, 104, 41, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 115, 116, 114, 105, 110, 103, 84, 111, 70, 108, 97, 103, 115, 40, 102, 108, 97, 103, 115, 41, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 109, 111, 100, 101, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 114, 101, 113, 41, 59, 10, 125, 59, 10, 10, 102, 115, 46, 111, 112, 101, 110, 83, 121, 110, 99, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 112, 97, 116, 104, 44, 32, 102, 108, 97, 103, 115, 44, 32, 109, 111, 100, 101, 41, 32, 123, 10, 32, 32, 109, 111, 100, 101, 32, 61, 32, 109, 111, 100, 101, 78, 117, 109, 40, 109, 111, 100, 101, 44, 32, 48, 111, 54, 54, 54, 41, 59, 10, 32, 32, 110, 117, 108, 108, 67, 104, 101, 99, 107, 40, 112, 97, 116, 104, 41, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 98, 105, 110, 100, 105, 110, 103, 46, 111, 112, 101, 110, 40, 112, 97, 116, 104, 77, 111, 100, 117, 108, 101, 46, 95, 109, 97, 107, 101, 76, 111, 110, 103, 40, 112, 97, 116, 104, 41, 44, 32, 115, 116, 114, 105, 110, 103, 84, 111, 70, 108, 97, 103, 115, 40, 102, 108, 97, 103, 115, 41, 44, 32, 109, 111, 100, 101, 41, 59, 10, 125, 59, 10, 10, 102, 115, 46, 114, 101, 97, 100, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 102, 100, 44, 32, 98, 117, 102, 102, 101, 114, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 108, 101, 110, 103, 116, 104, 44, 32, 112, 111, 115, 105, 116, 105, 111, 110, 44, 32, 99, 97, 108, 108, 98, 97, 99, 107, 41, 32, 123, 10, 32, 32, 105, 102, 32, 40, 33, 40, 98, 117, 102, 102, 101, 114, 32, 105, 110, 115, 116, 97, 110, 99, 101, 111, 102, 32, 66, 117, 102, 102, 101, 114, 41, 41, 32, 123, 10, 32, 32, 32, 32, 47, 47, 32, 108, 101, 103, 97, 99, 121, 32, 115, 116, 114, 105, 110, 103, 32, 105, 110, 116, 101, 114, 102, 97, 99, 101, 32, 40, 102, 100, 44, 32, 108, 101, 110, 103, 116, 104, 44, 32, 112, 111, 115, 105, 116, 105, 111, 110, 44, 32, 101, 110, 99, 111, 100, 105, 110, 103, 44, 32, 99, 97, 108, 108, 98, 97, 99, 107, 41, 10, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 99, 98, 32, 61, 32, 97, 114, 103, 117, 109, 101, 110, 116, 115, 91, 52, 93, 59, 10, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 101, 110, 99, 111, 100, 105, 110, 103, 32, 61, 32, 97, 114, 103, 117, 109, 101, 110, 116, 115, 91, 51, 93, 59, 10, 10, 32, 32, 32, 32, 97, 115, 115, 101, 114, 116, 69, 110, 99, 111, 100, 105, 110, 103, 40, 101, 110, 99, 111, 100, 105, 110, 103, 41, 59, 10, 10, 32, 32, 32, 32, 112, 111, 115, 105, 116, 105, 111, 110, 32, 61, 32, 97, 114, 103, 117, 109, 101, 110, 116, 115, 91, 50, 93, 59, 10, 32, 32, 32, 32, 108, 101, 110, 103, 116, 104, 32, 61, 32, 97, 114, 103, 117, 109, 101, 110, 116, 115, 91, 49, 93, 59, 10, 32, 32, 32, 32, 98, 117, 102, 102, 101, 114, 32, 61, 32, 110, 101, 119, 32, 66, 117, 102, 102, 101, 114, 40, 108, 101, 110, 103, 116, 104, 41, 59, 10, 32, 32, 32, 32, 111, 102, 102, 115, 101, 116, 32, 61, 32, 48, 59, 10, 10, 32, 32, 32, 32, 99, 97, 108, 108, 98, 97, 99, 107, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 101, 114, 114, 44, 32, 98, 121, 116, 101, 115, 82, 101, 97, 100, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 105, 102, 32, 40, 33, 99, 98, 41, 32, 114, 101, 116, 117, 114, 110, 59, 10, 10, 32, 32, 32, 32, 32, 32, 118, 97, 114, 32, 115, 116, 114, 32, 61, 32, 40, 98, 121, 116, 101, 115, 82, 101, 97, 100, 32, 62, 32, 48, 41, 32, 63, 32, 98, 117, 102, 102, 101, 114, 46, 116, 111, 83, 116, 114, 105, 110, 103, 40, 101, 110, 99, 111, 100, 105, 110, 103, 44, 32, 48, 44, 32, 98, 121, 116, 101, 115, 82, 101, 97, 100, 41, 32, 58, 32, 39, 39, 59, 10, 10, 32, 32, 32, 32, 32, 32, 40, 99, 98, 41, 40, 101, 114, 114, 44, 32, 115, 116, 114, 44, 32, 98, 121, 116, 101, 115, 82, 101, 97, 100, 41, 59, 10, 32, 32, 32, 32, 125, 59, 10, 32, 32, 125, 10, 10, 32, 32, 102, 117, 110, 99, 116, 105, 111, 110, 32, 119, 114, 97, 112, 112, 101, 114, 40, 101, 114, 114, 44, 32, 98, 121, 116, 101, 115, 82, 101, 97, 100, 41, 32, 123, 10, 32, 32, 32, 32, 47, 47, 32, 82, 101, 116, 97, 105, 110, 32, 97, 32, 114, 101, 102, 101, 114, 101, 110, 99, 101, 32, 116, 111, 32, 98, 117, 102, 102, 101, 114, 32, 115, 111, 32, 116, 104, 97, 116, 32, 105, 116, 32, 99, 97, 110, 39, 116, 32, 98, 101, 32, 71, 67, 39, 101, 100, 32, 116, 111, 111, 32, 115, 111, 111, 110, 46, 10, 32, 32, 32, 32, 99, 97, 108, 108, 98, 97, 99, 107, 32, 38, 38, 32, 99, 97, 108, 108, 98, 97, 99, 107, 40, 101, 114, 114, 44, 32, 98, 121, 116, 101, 115, 82, 101, 97, 100, 32, 124, 124, 32, 48, 44, 32, 98, 117, 102, 102, 101, 114, 41, 59, 10, 32, 32, 125, 10, 10, 32, 32, 118, 97, 114, 32, 114, 101, 113, 32, 61, 32, 110, 101, 119, 32, 70, 83, 82, 101, 113, 87, 114, 97, 112, 40, 41, 59, 10, 32, 32, 114, 101, 113, 46, 111, 110, 99, 111, 109, 112, 108, 101, 116, 101, 32, 61, 32, 119, 114, 97, 112, 112, 101, 114, 59, 10, 10, 32, 32, 98, 105, 110, 100, 105, 110, 103, 46, 114, 101, 97, 100, 40, 102, 100, 44, 32, 98, 117, 102, 102, 101, 114, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 108, 101, 110, 103, 116, 104, 44, 32, 112, 111, 115, 105, 116, 105, 111, 110, 44, 32, 114, 101, 113, 41, 59, 10, 125, 59, 10, 10, 102, 115, 46, 114, 101, 97, 100, 83, 121, 110, 99, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 102, 100, 44, 32, 98, 117, 102, 102, 101, 114, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 108, 101, 110, 103, 116, 104, 44, 32, 112, 111, 115, 105, 116, 105, 111, 110, 41, 32, 123, 10, 32, 32, 118, 97, 114, 32, 108, 101, 103, 97, 99, 121, 32, 61, 32, 102, 97, 108, 115, 101, 59, 10, 32, 32, 118, 97, 114, 32, 101, 110, 99, 111, 100, 105, 110, 103, 59, 10, 10, 32, 32, 105, 102, 32, 40, 33, 40, 98, 117, 102, 102, 101, 114, 32, 105, 110, 115, 116, 97, 110, 99, 101, 111, 102, 32, 66, 117, 102, 102, 101, 114, 41, 41, 32, 123, 10, 32, 32, 32, 32, 47, 47, 32, 108, 101, 103, 97, 99, 121, 32, 115, 116, 114, 105, 110, 103, 32, 105, 110, 116, 101, 114, 102, 97, 99, 101, 32, 40, 102, 100, 44, 32, 108, 101, 110, 103, 116, 104, 44, 32, 112, 111, 115, 105, 116, 105, 111, 110, 44, 32, 101, 110, 99, 111, 100, 105, 110, 103, 44, 32, 99, 97, 108, 108, 98, 97, 99, 107, 41, 10, 32, 32, 32, 32, 108, 101, 103, 97, 99, 121, 32, 61, 32, 116, 114, 117, 101, 59, 10, 32, 32, 32, 32, 101, 110, 99, 111, 100, 105, 110, 103, 32, 61, 32, 97, 114, 103, 117, 109, 101, 110, 116, 115, 91, 51, 93, 59, 10, 10, 32, 32, 32, 32, 97, 115, 115, 101, 114, 116, 69, 110, 99, 111, 100, 105, 110, 103, 40, 101, 110, 99, 111, 100, 105, 110, 103, 41, 59, 10, 10, 32, 32, 32, 32, 112, 111, 115, 105, 116, 105, 111, 110, 32, 61, 32, 97, 114, 103, 117, 109, 101, 110, 116, 115, 91, 50, 93, 59, 10, 32, 32, 32, 32, 108, 101, 110, 103, 116, 104, 32, 61, 32, 97, 114, 103, 117, 109, 101, 110, 116, 115, 91, 49, 93, 59, 10, 32, 32, 32, 32, 98, 117, 102, 102, 101, 114, 32, 61, 32, 110, 101, 119, 32, 66, 117, 102, 102, 101, 114, 40, 108, 101, 110, 103, 116, 104, 41, 59, 10, 10, 32, 32, 32, 32, 111, 102, 102, 115, 101, 116, 32, 61, 32, 48, 59, 10, 32, 32, 125, 10, 10, 32, 32, 118, 97, 114, 32, 114, 32, 61, 32, 98, 105, 110, 100, 105, 110, 103, 46, 114, 101, 97, 100, 40, 102, 100, 44, 32, 98, 117, 102, 102, 101, 114, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 108, 101, 110, 103, 116, 104, 44, 32, 112, 111, 115, 105, 116, 105, 111, 110, 41, 59, 10, 32, 32, 105, 102, 32, 40, 33, 108, 101, 103, 97, 99, 121, 41, 32, 123, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 114, 59, 10, 32, 32, 125, 10, 10, 32, 32, 118, 97, 114, 32, 115, 116, 114, 32, 61, 32, 40, 114, 32, 62, 32, 48, 41, 32, 63, 32, 98, 117, 102, 102, 101, 114, 46, 116, 111, 83, 116, 114, 105, 110, 103, 40, 101, 110, 99, 111, 100, 105, 110, 103, 44, 32, 48, 44, 32, 114, 41, 32, 58, 32, 39, 39, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 91, 115, 116, 114, 44, 32, 114, 93, 59, 10, 125, 59, 10, 10, 47, 47, 32, 117, 115, 97, 103, 101, 58, 10, 47, 47, 32, 32, 102, 115, 46, 119, 114, 105, 116, 101, 40, 102, 100, 44, 32, 98, 117, 102, 102, 101, 114, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 108, 101, 110, 103, 116, 104, 91, 44, 32, 112, 111, 115, 105, 116, 105, 111, 110, 93, 44, 32, 99, 97, 108, 108, 98, 97, 99, 107, 41, 59, 10, 47, 47, 32, 79, 82, 10, 47, 47, 32, 32, 102, 115, 46, 119, 114, 105, 116, 101, 40, 102, 100, 44, 32, 115, 116, 114, 105, 110, 103, 91, 44, 32, 112, 111, 115, 105, 116, 105, 111, 110, 91, 44, 32, 101, 110, 99, 111, 100, 105, 110, 103, 93, 93, 44, 32, 99, 97, 108, 108, 98, 97, 99, 107, 41, 59, 10, 102, 115, 46, 119, 114, 105, 116, 101, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 102, 100, 44, 32, 98, 117, 102, 102, 101, 114, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 108, 101, 110, 103, 116, 104, 44, 32, 112, 111, 115, 105, 116, 105, 111, 110, 44, 32, 99, 97, 108, 108, 98, 97, 99, 107, 41, 32, 123, 10, 32, 32, 102, 117, 110, 99, 116, 105, 111, 110, 32, 119, 114, 97, 112, 112, 101, 114, 40, 101, 114, 114, 44, 32, 119, 114, 105, 116, 116, 101, 110, 41, 32, 123, 10, 32, 32, 32, 32, 47, 47, 32, 82, 101, 116, 97, 105, 110, 32, 97, 32, 114, 101, 102, 101, 114, 101, 110, 99, 101, 32, 116, 111, 32, 98, 117, 102, 102, 101, 114, 32, 115, 111, 32, 116, 104, 97, 116, 32, 105, 116, 32, 99, 97, 110, 39, 116, 32, 98, 101, 32, 71, 67, 39, 101, 100, 32, 116, 111, 111, 32, 115, 111, 111, 110, 46, 10, 32, 32, 32, 32, 99, 97, 108, 108, 98, 97, 99, 107, 40, 101, 114, 114, 44, 32, 119, 114, 105, 116, 116, 101, 110, 32, 124, 124, 32, 48, 44, 32, 98, 117, 102, 102, 101, 114, 41, 59, 10, 32, 32, 125, 10, 10, 32, 32, 118, 97, 114, 32, 114, 101, 113, 32, 61, 32, 110, 101, 119, 32, 70, 83, 82, 101, 113, 87, 114, 97, 112, 40, 41, 59, 10, 32, 32, 114, 101, 113, 46, 111, 110, 99, 111, 109, 112, 108, 101, 116, 101, 32, 61, 32, 119, 114, 97, 112, 112, 101, 114, 59, 10, 10, 32, 32, 105, 102, 32, 40, 98, 117, 102, 102, 101, 114, 32, 105, 110, 115, 116, 97, 110, 99, 101, 111, 102, 32, 66, 117, 102, 102, 101, 114, 41, 32, 123, 10, 32, 32, 32, 32, 47, 47, 32, 105, 102, 32, 110, 111, 32, 112, 111, 115, 105, 116, 105, 111, 110, 32, 105, 115, 32, 112, 97, 115, 115, 101, 100, 32, 116, 104, 101, 110, 32, 97, 115, 115, 117, 109, 101, 32, 110, 117, 108, 108, 10, 32, 32, 32, 32, 105, 102, 32, 40, 116, 121, 112, 101, 111, 102, 32, 112, 111, 115, 105, 116, 105, 111, 110, 32, 61, 61, 61, 32, 39, 102, 117, 110, 99, 116, 105, 111, 110, 39, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 99, 97, 108, 108, 98, 97, 99, 107, 32, 61, 32, 112, 111, 115, 105, 116, 105, 111, 110, 59, 10, 32, 32, 32, 32, 32, 32, 112, 111, 115, 105, 116, 105, 111, 110, 32, 61, 32, 110, 117, 108, 108, 59, 10, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 99, 97, 108, 108, 98, 97, 99, 107, 32, 61, 32, 109, 97, 121, 98, 101, 67, 97, 108, 108, 98, 97, 99, 107, 40, 99, 97, 108, 108, 98, 97, 99, 107, 41, 59, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 98, 105, 110, 100, 105, 110, 103, 46, 119, 114, 105, 116, 101, 66, 117, 102, 102, 101, 114, 40, 102, 100, 44, 32, 98, 117, 102, 102, 101, 114, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 108, 101, 110, 103, 116, 104, 44, 32, 112, 111, 115, 105, 116, 105, 111, 110, 44, 32, 114, 101, 113, 41, 59, 10, 32, 32, 125, 10, 10, 32, 32, 105, 102, 32, 40, 116, 121, 112, 101, 111, 102, 32, 98, 117, 102, 102, 101, 114, 32, 33, 61, 61, 32, 39, 115, 116, 114, 105, 110, 103, 39, 41, 10, 32, 32, 32, 32, 98, 117, 102, 102, 101, 114, 32, 43, 61, 32, 39, 39, 59, 10, 32, 32, 105, 102, 32, 40, 116, 121, 112, 101, 111, 102, 32, 112, 111, 115, 105, 116, 105, 111, 110, 32, 33, 61, 61, 32, 39, 102, 117, 110, 99, 116, 105, 111, 110, 39, 41, 32, 123, 10, 32, 32, 32, 32, 105, 102, 32, 40, 116, 121, 112, 101, 111, 102, 32, 111, 102, 102, 115, 101, 116, 32, 61, 61, 61, 32, 39, 102, 117, 110, 99, 116, 105, 111, 110, 39, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 112, 111, 115, 105, 116, 105, 111, 110, 32, 61, 32, 111, 102, 102, 115, 101, 116, 59, 10, 32, 32, 32, 32, 32, 32, 111, 102, 102, 115, 101, 116, 32, 61, 32, 110, 117, 108, 108, 59, 10, 32, 32, 32, 32, 125, 32, 101, 108, 115, 101, 32, 123, 10, 32, 32, 32, 32, 32, 32, 112, 111, 115, 105, 116, 105, 111, 110, 32, 61, 32, 108, 101, 110, 103, 116, 104, 59, 10, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 108, 101, 110, 103, 116, 104, 32, 61, 32, 39, 117, 116, 102, 56, 39, 59, 10, 32, 32, 125, 10, 32, 32, 99, 97, 108, 108, 98, 97, 99, 107, 32, 61, 32, 109, 97, 121, 98, 101, 67, 97, 108, 108, 98, 97, 99, 107, 40, 112, 111, 115, 105, 116, 105, 111, 110, 41, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 98, 105, 110, 100, 105, 110, 103, 46, 119, 114, 105, 116, 101, 83, 116, 114, 105, 110, 103, 40, 102, 100, 44, 32, 98, 117, 102, 102, 101, 114, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 108, 101, 110, 103, 116, 104, 44, 32, 114, 101, 113, 41, 59, 10, 125, 59, 10, 10, 47, 47, 32, 117, 115, 97, 103, 101, 58, 10, 47, 47, 32, 32, 102, 115, 46, 119, 114, 105, 116, 101, 83, 121, 110, 99, 40, 102, 100, 44, 32, 98, 117, 102, 102, 101, 114, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 108, 101, 110, 103, 116, 104, 91, 44, 32, 112, 111, 115, 105, 116, 105, 111, 110, 93, 41, 59, 10, 47, 47, 32, 79, 82, 10, 47, 47, 32, 32, 102, 115, 46, 119, 114, 105, 116, 101, 83, 121, 110, 99, 40, 102, 100, 44, 32, 115, 116, 114, 105, 110, 103, 91, 44, 32, 112, 111, 115, 105, 116, 105, 111, 110, 91, 44, 32, 101, 110, 99, 111, 100, 105, 110, 103, 93, 93, 41, 59, 10, 102, 115, 46, 119, 114, 105, 116, 101, 83, 121, 110, 99, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 102, 100, 44, 32, 98, 117, 102, 102, 101, 114, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 108, 101, 110, 103, 116, 104, 44, 32, 112, 111, 115, 105, 116, 105, 111, 110, 41, 32, 123, 10, 32, 32, 105, 102, 32, 40, 98, 117, 102, 102, 101, 114, 32, 105, 110, 115, 116, 97, 110, 99, 101, 111, 102, 32, 66, 117, 102, 102, 101, 114, 41, 32, 123, 10, 32, 32, 32, 32, 105, 102, 32, 40, 112, 111, 115, 105, 116, 105, 111, 110, 32, 61, 61, 61, 32, 117, 110, 100, 101, 102, 105, 110, 101, 100, 41, 10, 32, 32, 32, 32, 32, 32, 112, 111, 115, 105, 116, 105, 111, 110, 32, 61, 32, 110, 117, 108, 108, 59, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 98, 105, 110, 100, 105, 110, 103, 46, 119, 114, 105, 116, 101, 66, 117, 102, 102, 101, 114, 40, 102, 100, 44, 32, 98, 117, 102, 102, 101, 114, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 108, 101, 110, 103, 116, 104, 44, 32, 112, 111, 115, 105, 116, 105, 111, 110, 41, 59, 10, 32, 32, 125, 10, 32, 32, 105, 102, 32, 40, 116, 121, 112, 101, 111, 102, 32, 98, 117, 102, 102, 101, 114, 32, 33, 61, 61, 32, 39, 115, 116, 114, 105, 110, 103, 39, 41, 10, 32, 32, 32, 32, 98, 117, 102, 102, 101, 114, 32, 43, 61, 32, 39, 39, 59, 10, 32, 32, 105, 102, 32, 40, 111, 102, 102, 115, 101, 116, 32, 61, 61, 61, 32, 117, 110, 100, 101, 102, 105, 110, 101, 100, 41, 10, 32, 32, 32, 32, 111, 102, 102, 115, 101, 116, 32, 61, 32, 110, 117, 108, 108, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 98, 105, 110, 100, 105, 110, 103, 46, 119, 114, 105, 116, 101, 83, 116, 114, 105, 110, 103, 40, 102, 100, 44, 32, 98, 117, 102, 102, 101, 114, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 108, 101, 110, 103, 116, 104, 44, 32, 112, 111, 115, 105, 116, 105, 111, 110, 41, 59, 10, 125, 59, 10, 10, 102, 115, 46, 114, 101, 110, 97, 109, 101, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 111, 108, 100, 80, 97, 116, 104, 44, 32, 110, 101, 119, 80, 97, 116, 104, 44, 32, 99, 97, 108, 108, 98, 97, 99, 107, 41, 32, 123, 10, 32, 32, 99, 97, 108, 108, 98, 97, 99, 107, 32, 61, 32, 109, 97, 107, 101, 67, 97, 108, 108, 98, 97, 99, 107, 40, 99, 97, 108, 108, 98, 97, 99, 107, 41, 59, 10, 32, 32, 105, 102, 32, 40, 33, 110, 117, 108, 108, 67, 104, 101, 99, 107, 40, 111, 108, 100, 80, 97, 116, 104, 44, 32, 99, 97, 108, 108, 98, 97, 99, 107, 41, 41, 32, 114, 101, 116, 117, 114, 110, 59, 10, 32, 32, 105, 102, 32, 40, 33, 110, 117, 108, 108, 67, 104, 101, 99, 107, 40, 110, 101, 119, 80, 97, 116, 104, 44, 32, 99, 97, 108, 108, 98, 97, 99, 107, 41, 41, 32, 114, 101, 116, 117, 114, 110, 59, 10, 32, 32, 118, 97, 114, 32, 114, 101, 113, 32, 61, 32, 110, 101, 119, 32, 70, 83, 82, 101, 113, 87, 114, 97, 112, 40, 41, 59, 10, 32, 32, 114, 101, 113, 46, 111, 110, 99, 111, 109, 112, 108, 101, 116, 101, 32, 61, 32, 99, 97, 108, 108, 98, 97, 99, 107, 59, 10, 32, 32, 98, 105, 110, 100, 105, 110, 103, 46, 114, 101, 110, 97, 109, 101, 40, 112, 97, 116, 104, 77, 111, 100, 117, 108, 101, 46, 95, 109, 97, 107, 101, 76, 111, 110, 103, 40, 111, 108, 100, 80, 97, 116, 104, 41, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 112, 97, 116, 104, 77, 111, 100, 117, 108, 101, 46, 95, 109, 97, 107, 101, 76, 111, 110, 103, 40, 110, 101, 119, 80, 97, 116, 104, 41, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 114, 101, 113, 41, 59, 10, 125, 59, 10, 10, 102, 115, 46, 114, 101, 110, 97, 109, 101, 83, 121, 110, 99, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 111, 108, 100, 80, 97, 116, 104, 44, 32, 110, 101, 119, 80, 97, 116, 104, 41, 32, 123, 10, 32, 32, 110, 117, 108, 108, 67, 104, 101, 99, 107, 40, 111, 108, 100, 80, 97, 116, 104, 41, 59, 10, 32, 32, 110, 117, 108, 108, 67, 104, 101, 99, 107, 40, 110, 101, 119, 80, 97, 116, 104, 41, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 98, 105, 110, 100, 105, 110, 103, 46, 114, 101, 110, 97, 109, 101, 40, 112, 97, 116, 104, 77, 111, 100, 117, 108, 101, 46, 95, 109, 97, 107, 101, 76, 111, 110, 103, 40, 111, 108, 100, 80, 97, 116, 104, 41, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 112, 97, 116, 104, 77, 111, 100, 117, 108, 101, 46, 95, 109, 97, 107, 101, 76, 111, 110, 103, 40, 110, 101, 119, 80, 97, 116, 104, 41, 41, 59, 10, 125, 59, 10, 10, 102, 115, 46, 116, 114, 117, 110, 99, 97, 116, 101, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 112, 97, 116, 104, 44, 32, 108, 101, 110, 44, 32, 99, 97, 108, 108, 98, 97, 99, 107, 41, 32, 123, 10, 32, 32, 105, 102, 32, 40, 116, 121, 112, 101, 111, 102, 32, 112, 97, 116, 104, 32, 61, 61, 61, 32, 39, 110, 117, 109, 98, 101, 114, 39, 41, 32, 123, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 102, 115, 46, 102, 116, 114, 117, 110, 99, 97, 116, 101, 40, 112, 97, 116, 104, 44, 32, 108, 101, 110, 44, 32, 99, 97, 108, 108, 98, 97, 99, 107, 41, 59, 10, 32, 32, 125, 10, 32, 32, 105, 102, 32, 40, 116, 121, 112, 101, 111, 102, 32, 108, 101, 110, 32, 61, 61, 61, 32, 39, 102, 117, 110, 99, 116, 105, 111, 110, 39, 41, 32, 123, 10, 32, 32, 32, 32, 99, 97, 108, 108, 98, 97, 99, 107, 32, 61, 32, 108, 101, 110, 59, 10, 32, 32, 32, 32, 108, 101, 110, 32, 61, 32, 48, 59, 10, 32, 32, 125, 32, 101, 108, 115, 101, 32, 105, 102, 32, 40, 108, 101, 110, 32, 61, 61, 61, 32, 117, 110, 100, 101, 102, 105, 110, 101, 100, 41, 32, 123, 10, 32, 32, 32, 32, 108, 101, 110, 32, 61, 32, 48, 59, 10, 32, 32, 125, 10, 10, 32, 32, 99, 97, 108, 108, 98, 97, 99, 107, 32, 61, 32, 109, 97, 121, 98, 101, 67, 97, 108, 108, 98, 97, 99, 107, 40, 99, 97, 108, 108, 98, 97, 99, 107, 41, 59, 10, 32, 32, 102, 115, 46, 111, 112, 101, 110, 40, 112, 97, 116, 104, 44, 32, 39, 114, 43, 39, 44, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 101, 114, 44, 32, 102, 100, 41, 32, 123, 10, 32, 32, 32, 32, 105, 102, 32, 40, 101, 114, 41, 32, 114, 101, 116, 117, 114, 110, 32, 99, 97, 108, 108, 98, 97, 99, 107, 40, 101, 114, 41, 59, 10, 32, 32, 32, 32, 118, 97, 114, 32, 114, 101, 113, 32, 61, 32, 110, 101, 119, 32, 70, 83, 82, 101, 113, 87, 114, 97, 112, 40, 41, 59, 10, 32, 32, 32, 32, 114, 101, 113, 46, 111, 110, 99, 111, 109, 112, 108, 101, 116, 101, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 32, 102, 116, 114, 117, 110, 99, 97, 116, 101, 67, 98, 40, 101, 114, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 102, 115, 46, 99, 108, 111, 115, 101, 40, 102, 100, 44, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 101, 114, 50, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 99, 97, 108, 108, 98, 97, 99, 107, 40, 101, 114, 32, 124, 124, 32, 101, 114, 50, 41, 59, 10, 32, 32, 32, 32, 32, 32, 125, 41, 59, 10, 32, 32, 32, 32, 125, 59, 10, 32, 32, 32, 32, 98, 105, 110, 100, 105, 110, 103, 46, 102, 116, 114, 117, 110, 99, 97, 116, 101, 40, 102, 100, 44, 32, 108, 101, 110, 44, 32, 114, 101, 113, 41, 59, 10, 32, 32, 125, 41, 59, 10, 125, 59, 10, 10, 102, 115, 46, 116, 114, 117, 110, 99, 97, 116, 101, 83, 121, 110, 99, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 112, 97, 116, 104, 44, 32, 108, 101, 110, 41, 32, 123, 10, 32, 32, 105, 102, 32, 40, 116, 121, 112, 101, 111, 102, 32, 112, 97, 116, 104, 32, 61, 61, 61, 32, 39, 110, 117, 109, 98, 101, 114, 39, 41, 32, 123, 10, 32, 32, 32, 32, 47, 47, 32, 108, 101, 103, 97, 99, 121, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 102, 115, 46, 102, 116, 114, 117, 110, 99, 97, 116, 101, 83, 121, 110, 99, 40, 112, 97, 116, 104, 44, 32, 108, 101, 110, 41, 59, 10, 32, 32, 125, 10, 32, 32, 105, 102, 32, 40, 108, 101, 110, 32, 61, 61, 61, 32, 117, 110, 100, 101, 102, 105, 110, 101, 100, 41, 32, 123, 10, 32, 32, 32, 32, 108, 101, 110, 32, 61, 32, 48, 59, 10, 32, 32, 125, 10, 32, 32, 47, 47, 32, 97, 108, 108, 111, 119, 32, 101, 114, 114, 111, 114, 32, 116, 111, 32, 98, 101, 32, 116, 104, 114, 111, 119, 110, 44, 32, 98, 117, 116, 32, 115, 116, 105, 108, 108, 32, 99, 108, 111, 115, 101, 32, 102, 100, 46, 10, 32, 32, 118, 97, 114, 32, 102, 100, 32, 61, 32, 102, 115, 46, 111, 112, 101, 110, 83, 121, 110, 99, 40, 112, 97, 116, 104, 44, 32, 39, 114, 43, 39, 41, 59, 10, 32, 32, 118, 97, 114, 32, 114, 101, 116, 59, 10, 10, 32, 32, 116, 114, 121, 32, 123, 10, 32, 32, 32, 32, 114, 101, 116, 32, 61, 32, 102, 115, 46, 102, 116, 114, 117, 110, 99, 97, 116, 101, 83, 121, 110, 99, 40, 102, 100, 44, 32, 108, 101, 110, 41, 59, 10, 32, 32, 125, 32, 102, 105, 110, 97, 108, 108, 121, 32, 123, 10, 32, 32, 32, 32, 102, 115, 46, 99, 108, 111, 115, 101, 83, 121, 110, 99, 40, 102, 100, 41, 59, 10, 32, 32, 125, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 114, 101, 116, 59, 10, 125, 59, 10, 10, 102, 115, 46, 102, 116, 114, 117, 110, 99, 97, 116, 101, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 102, 100, 44, 32, 108, 101, 110, 44, 32, 99, 97, 108, 108, 98, 97, 99, 107, 41, 32, 123, 10, 32, 32, 105, 102, 32, 40, 116, 121, 112, 101, 111, 102, 32, 108, 101, 110, 32, 61, 61, 61, 32, 39, 102, 117, 110, 99, 116, 105, 111, 110, 39, 41, 32, 123, 10, 32, 32, 32, 32, 99, 97, 108, 108, 98, 97, 99, 107, 32, 61, 32, 108, 101, 110, 59, 10, 32, 32, 32, 32, 108, 101, 110, 32, 61, 32, 48, 59, 10, 32, 32, 125, 32, 101, 108, 115, 101, 32, 105, 102, 32, 40, 108, 101, 110, 32, 61, 61, 61, 32, 117, 110, 100, 101, 102, 105, 110, 101, 100, 41, 32, 123, 10, 32, 32, 32, 32, 108, 101, 110, 32, 61, 32, 48, 59, 10, 32, 32, 125, 10, 32, 32, 118, 97, 114, 32, 114, 101, 113, 32, 61, 32, 110, 101, 119, 32, 70, 83, 82, 101, 113, 87, 114, 97, 112, 40, 41, 59, 10, 32, 32, 114, 101, 113, 46, 111, 110, 99, 111, 109, 112, 108, 101, 116, 101, 32, 61, 32, 109, 97, 107, 101, 67, 97, 108, 108, 98, 97, 99, 107, 40, 99, 97, 108, 108, 98, 97, 99, 107, 41, 59, 10, 32, 32, 98, 105, 110, 100, 105, 110, 103, 46, 102, 116, 114, 117, 110, 99, 97, 116, 101, 40, 102, 100, 44, 32, 108, 101, 110, 44, 32, 114, 101, 113, 41, 59, 10, 125, 59, 10, 10, 102, 115, 46, 102, 116, 114, 117, 110, 99, 97, 116, 101, 83, 121, 110, 99, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 102, 100, 44, 32, 108, 101, 110, 41, 32, 123, 10, 32, 32, 105, 102, 32, 40, 108, 101, 110, 32, 61, 61, 61, 32, 117, 110, 100, 101, 102, 105, 110, 101, 100, 41, 32, 123, 10, 32, 32, 32, 32, 108, 101, 110, 32, 61, 32, 48, 59, 10, 32, 32, 125, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 98, 105, 110, 100, 105, 110, 103, 46, 102, 116, 114, 117, 110, 99, 97, 116, 101, 40, 102, 100, 44, 32, 108, 101, 110, 41, 59, 10, 125, 59, 10, 10, 102, 115, 46, 114, 109, 100, 105, 114, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 112, 97, 116, 104, 44, 32, 99, 97, 108, 108, 98, 97, 99, 107, 41, 32, 123, 10, 32, 32, 99, 97, 108, 108, 98, 97, 99, 107, 32, 61, 32, 109, 97, 121, 98, 101, 67, 97, 108, 108, 98, 97, 99, 107, 40, 99, 97, 108, 108, 98, 97, 99, 107, 41, 59, 10, 32, 32, 105, 102, 32, 40, 33, 110, 117, 108, 108, 67, 104, 101, 99, 107, 40, 112, 97, 116, 104, 44, 32, 99, 97, 108, 108, 98, 97, 99, 107, 41, 41, 32, 114, 101, 116, 117, 114, 110, 59, 10, 32, 32, 118, 97, 114, 32, 114, 101, 113, 32, 61, 32, 110, 101, 119, 32, 70, 83, 82, 101, 113, 87, 114, 97, 112, 40, 41, 59, 10, 32, 32, 114, 101, 113, 46, 111, 110, 99, 111, 109, 112, 108, 101, 116, 101, 32, 61, 32, 99, 97, 108, 108, 98, 97, 99, 107, 59, 10, 32, 32, 98, 105, 110, 100, 105, 110, 103, 46, 114, 109, 100, 105, 114, 40, 112, 97, 116, 104, 77, 111, 100, 117, 108, 101, 46, 95, 109, 97, 107, 101, 76, 111, 110, 103, 40, 112, 97, 116, 104, 41, 44, 32, 114, 101, 113, 41, 59, 10, 125, 59, 10, 10, 102, 115, 46, 114, 109, 100, 105, 114, 83, 121, 110, 99, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 112, 97, 116, 104, 41, 32, 123, 10, 32, 32, 110, 117, 108, 108, 67, 104, 101, 99, 107, 40, 112, 97, 116, 104, 41, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 98, 105, 110, 100, 105, 110, 103, 46, 114, 109, 100, 105, 114, 40, 112, 97, 116, 104, 77, 111, 100, 117, 108, 101, 46, 95, 109, 97, 107, 101, 76, 111, 110, 103, 40, 112, 97, 116, 104, 41, 41, 59, 10, 125, 59, 10, 10, 102, 115, 46, 102, 100, 97, 116, 97, 115, 121, 110, 99, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 102, 100, 44, 32, 99, 97, 108, 108, 98, 97, 99, 107, 41, 32, 123, 10, 32, 32, 118, 97, 114, 32, 114, 101, 113, 32, 61, 32, 110, 101, 119, 32, 70, 83, 82, 101, 113, 87, 114, 97, 112, 40, 41, 59, 10, 32, 32, 114, 101, 113, 46, 111, 110, 99, 111, 109, 112, 108, 101, 116, 101, 32, 61, 32, 109, 97, 107, 101, 67, 97, 108, 108, 98, 97, 99, 107, 40, 99, 97, 108, 108, 98, 97, 99, 107, 41, 59, 10, 32, 32, 98, 105, 110, 100, 105, 110, 103, 46, 102, 100, 97, 116, 97, 115, 121, 110, 99, 40, 102, 100, 44, 32, 114, 101, 113, 41, 59, 10, 125, 59, 10, 10, 102, 115, 46, 102, 100, 97, 116, 97, 115, 121, 110, 99, 83, 121, 110, 99, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 102, 100, 41, 32, 123, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 98, 105, 110, 100, 105, 110, 103, 46, 102, 100, 97, 116, 97, 115, 121, 110, 99, 40, 102, 100, 41, 59, 10, 125, 59, 10, 10, 102, 115, 46, 102, 115, 121, 110, 99, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 102, 100, 44, 32, 99, 97, 108, 108, 98, 97, 99, 107, 41, 32, 123, 10, 32, 32, 118, 97, 114, 32, 114, 101, 113, 32, 61, 32, 110, 101, 119, 32, 70, 83, 82, 101, 113, 87, 114, 97, 112, 40, 41, 59, 10, 32, 32, 114, 101, 113, 46, 111, 110, 99, 111, 109, 112, 108, 101, 116, 101, 32, 61, 32, 109, 97, 107, 101, 67, 97, 108, 108, 98, 97, 99, 107, 40, 99, 97, 108, 108, 98, 97, 99, 107, 41, 59, 10, 32, 32, 98, 105, 110, 100, 105, 110, 103, 46, 102, 115, 121, 110, 99, 40, 102, 100, 44, 32, 114, 101, 113, 41, 59, 10, 125, 59, 10, 10, 102, 115, 46, 102, 115, 121, 110, 99, 83, 121, 110, 99, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 102, 100, 41, 32, 123, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 98, 105, 110, 100, 105, 110, 103, 46, 102, 115, 121, 110, 99, 40, 102, 100, 41, 59, 10, 125, 59, 10, 10, 102, 115, 46, 109, 107, 100, 105, 114, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 112, 97, 116, 104, 44, 32, 109, 111, 100, 101, 44, 32, 99, 97, 108, 108, 98, 97, 99, 107, 41, 32, 123, 10, 32, 32, 105, 102, 32, 40, 116, 121, 112, 101, 111, 102, 32, 109, 111, 100, 101, 32, 61, 61, 61, 32, 39, 102, 117, 110, 99, 116, 105, 111, 110, 39, 41, 32, 99, 97, 108, 108, 98, 97, 99, 107, 32, 61, 32, 109, 111, 100, 101, 59, 10, 32, 32, 99, 97, 108, 108, 98, 97, 99, 107, 32, 61, 32, 109, 97, 107, 101, 67, 97, 108, 108, 98, 97, 99, 107, 40, 99, 97, 108, 108, 98, 97, 99, 107, 41, 59, 10, 32, 32, 105, 102, 32, 40, 33, 110, 117, 108, 108, 67, 104, 101, 99, 107, 40, 112, 97, 116, 104, 44, 32, 99, 97, 108, 108, 98, 97, 99, 107, 41, 41, 32, 114, 101, 116, 117, 114, 110, 59, 10, 32, 32, 118, 97, 114, 32, 114, 101, 113, 32, 61, 32, 110, 101, 119, 32, 70, 83, 82, 101, 113, 87, 114, 97, 112, 40, 41, 59, 10, 32, 32, 114, 101, 113, 46, 111, 110, 99, 111, 109, 112, 108, 101, 116, 101, 32, 61, 32, 99, 97, 108, 108, 98, 97, 99, 107, 59, 10, 32, 32, 98, 105, 110, 100, 105, 110, 103, 46, 109, 107, 100, 105, 114, 40, 112, 97, 116, 104, 77, 111, 100, 117, 108, 101, 46, 95, 109, 97, 107, 101, 76, 111, 110, 103, 40, 112, 97, 116, 104, 41, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 109, 111, 100, 101, 78, 117, 109, 40, 109, 111, 100, 101, 44, 32, 48, 111, 55, 55, 55, 41, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 114, 101, 113, 41, 59, 10, 125, 59, 10, 10, 102, 115, 46, 109, 107, 100, 105, 114, 83, 121, 110, 99, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 112, 97, 116, 104, 44, 32, 109, 111, 100, 101, 41, 32, 123, 10, 32, 32, 110, 117, 108, 108, 67, 104, 101, 99, 107, 40, 112, 97, 116, 104, 41, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 98, 105, 110, 100, 105, 110, 103, 46, 109, 107, 100, 105, 114, 40, 112, 97, 116, 104, 77, 111, 100, 117, 108, 101, 46, 95, 109, 97, 107, 101, 76, 111, 110, 103, 40, 112, 97, 116, 104, 41, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 109, 111, 100, 101, 78, 117, 109, 40, 109, 111, 100, 101, 44, 32, 48, 111, 55, 55, 55, 41, 41, 59, 10, 125, 59, 10, 10, 102, 115, 46, 114, 101, 97, 100, 100, 105, 114, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 112, 97, 116, 104, 44, 32, 99, 97, 108, 108, 98, 97, 99, 107, 41, 32, 123, 10, 32, 32, 99, 97, 108, 108, 98, 97, 99, 107, 32, 61, 32, 109, 97, 107, 101, 67, 97, 108, 108, 98, 97, 99, 107, 40, 99, 97, 108, 108, 98, 97, 99, 107, 41, 59, 10, 32, 32, 105, 102, 32, 40, 33, 110, 117, 108, 108, 67, 104, 101, 99, 107, 40, 112, 97, 116, 104, 44, 32, 99, 97, 108, 108, 98, 97, 99, 107, 41, 41, 32, 114, 101, 116, 117, 114, 110, 59, 10, 32, 32, 118, 97, 114, 32, 114, 101, 113, 32, 61, 32, 110, 101, 119, 32, 70, 83, 82, 101, 113, 87, 114, 97, 112, 40, 41, 59, 10, 32, 32, 114, 101, 113, 46, 111, 110, 99, 111, 109, 112, 108, 101, 116, 101, 32, 61, 32, 99, 97, 108, 108, 98, 97, 99, 107, 59, 10, 32, 32, 98, 105, 110, 100, 105, 110, 103, 46, 114, 101, 97, 100, 100, 105, 114, 40, 112, 97, 116, 104, 77, 111, 100, 117, 108, 101, 46, 95, 109, 97, 107, 101, 76, 111, 110, 103, 40, 112, 97, 116, 104, 41, 44, 32, 114, 101, 113, 41, 59, 10, 125, 59, 10, 10, 102, 115, 46, 114, 101, 97, 100, 100, 105, 114, 83, 121, 110, 99, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 112, 97, 116, 104, 41, 32, 123, 10, 32, 32, 110, 117, 108, 108, 67, 104, 101, 99, 107, 40, 112, 97, 116, 104, 41, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 98, 105, 110, 100, 105, 110, 103, 46, 114, 101, 97, 100, 100, 105, 114, 40, 112, 97, 116, 104, 77, 111, 100, 117, 108, 101, 46, 95, 109, 97, 107, 101, 76, 111, 110, 103, 40, 112, 97, 116, 104, 41, 41, 59, 10, 125, 59, 10, 10, 102, 115, 46, 102, 115, 116, 97, 116, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 102, 100, 44, 32, 99, 97, 108, 108, 98, 97, 99, 107, 41, 32, 123, 10, 32, 32, 118, 97, 114, 32, 114, 101, 113, 32, 61, 32, 110, 101, 119, 32, 70, 83, 82, 101, 113, 87, 114, 97, 112, 40, 41, 59, 10, 32, 32, 114, 101, 113, 46, 111, 110, 99, 111, 109, 112, 108, 101, 116, 101, 32, 61, 32, 109, 97, 107, 101, 67, 97, 108, 108, 98, 97, 99, 107, 40, 99, 97, 108, 108, 98, 97, 99, 107, 41, 59, 10, 32, 32, 98, 105, 110, 100, 105, 110, 103, 46, 102, 115, 116, 97, 116, 40, 102, 100, 44, 32, 114, 101, 113, 41, 59, 10, 125, 59, 10, 10, 102, 115, 46, 108, 115, 116, 97, 116, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 112, 97, 116, 104, 44, 32, 99, 97, 108, 108, 98, 97, 99, 107, 41, 32, 123, 10, 32, 32, 99, 97, 108, 108, 98, 97, 99, 107, 32, 61, 32, 109, 97, 107, 101, 67, 97, 108, 108, 98, 97, 99, 107, 40, 99, 97, 108, 108, 98, 97, 99, 107, 41, 59, 10, 32, 32, 105, 102, 32, 40, 33, 110, 117, 108, 108, 67, 104, 101, 99, 107, 40, 112, 97, 116, 104, 44, 32, 99, 97, 108, 108, 98, 97, 99, 107, 41, 41, 32, 114, 101, 116, 117, 114, 110, 59, 10, 32, 32, 118, 97, 114, 32, 114, 101, 113, 32, 61, 32, 110, 101, 119, 32, 70, 83, 82, 101, 113, 87, 114, 97, 112, 40, 41, 59, 10, 32, 32, 114, 101, 113, 46, 111, 110, 99, 111, 109, 112, 108, 101, 116, 101, 32, 61, 32, 99, 97, 108, 108, 98, 97, 99, 107, 59, 10, 32, 32, 98, 105, 110, 100, 105, 110, 103, 46, 108, 115, 116, 97, 116, 40, 112, 97, 116, 104, 77, 111, 100, 117, 108, 101, 46, 95, 109, 97, 107, 101, 76, 111, 110, 103, 40, 112, 97, 116, 104, 41, 44, 32, 114, 101, 113, 41, 59, 10, 125, 59, 10, 10, 102, 115, 46, 115, 116, 97, 116, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 112, 97, 116, 104, 44, 32, 99, 97, 108, 108, 98, 97, 99, 107, 41, 32, 123, 10, 32, 32, 99, 97, 108, 108, 98, 97, 99, 107, 32, 61, 32, 109, 97, 107, 101, 67, 97, 108, 108, 98, 97, 99, 107, 40, 99, 97, 108, 108, 98, 97, 99, 107, 41, 59, 10, 32, 32, 105, 102, 32, 40, 33, 110, 117, 108, 108, 67, 104, 101, 99, 107, 40, 112, 97, 116, 104, 44, 32, 99, 97, 108, 108, 98, 97, 99, 107, 41, 41, 32, 114, 101, 116, 117, 114, 110, 59, 10, 32, 32, 118, 97, 114, 32, 114, 101, 113, 32, 61, 32, 110, 101, 119, 32, 70, 83, 82, 101, 113, 87, 114, 97, 112, 40, 41, 59, 10, 32, 32, 114, 101, 113, 46, 111, 110, 99, 111, 109, 112, 108, 101, 116, 101, 32, 61, 32, 99, 97, 108, 108, 98, 97, 99, 107, 59, 10, 32, 32, 98, 105, 110, 100, 105, 110, 103, 46, 115, 116, 97, 116, 40, 112, 97, 116, 104, 77, 111, 100, 117, 108, 101, 46, 95, 109, 97, 107, 101, 76, 111, 110, 103, 40, 112, 97, 116, 104, 41, 44, 32, 114, 101, 113, 41, 59, 10, 125, 59, 10, 10, 102, 115, 46, 102, 115, 116, 97, 116, 83, 121, 110, 99, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 102, 100, 41, 32, 123, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 98, 105, 110, 100, 105, 110, 103, 46, 102, 115, 116, 97, 116, 40, 102, 100, 41, 59, 10, 125, 59, 10, 10, 102, 115, 46, 108, 115, 116, 97, 116, 83, 121, 110, 99, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 112, 97, 116, 104, 41, 32, 123, 10, 32, 32, 110, 117, 108, 108, 67, 104, 101, 99, 107, 40, 112, 97, 116, 104, 41, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 98, 105, 110, 100, 105, 110, 103, 46, 108, 115, 116, 97, 116, 40, 112, 97, 116, 104, 77, 111, 100, 117, 108, 101, 46, 95, 109, 97, 107, 101, 76, 111, 110, 103, 40, 112, 97, 116, 104, 41, 41, 59, 10, 125, 59, 10, 10, 102, 115, 46, 115, 116, 97, 116, 83, 121, 110, 99, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 112, 97, 116, 104, 41, 32, 123, 10, 32, 32, 110, 117, 108, 108, 67, 104, 101, 99, 107, 40, 112, 97, 116, 104, 41, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 98, 105, 110, 100, 105, 110, 103, 46, 115, 116, 97, 116, 40, 112, 97, 116, 104, 77, 111, 100, 117, 108, 101, 46, 95, 109, 97, 107, 101, 76, 111, 110, 103, 40, 112, 97, 116, 104, 41, 41, 59, 10, 125, 59, 10, 10, 102, 115, 46, 114, 101, 97, 100, 108, 105, 110, 107, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 112, 97, 116, 104, 44, 32, 99, 97, 108, 108, 98, 97, 99, 107, 41, 32, 123, 10, 32, 32, 99, 97, 108, 108, 98, 97, 99, 107, 32, 61, 32, 109, 97, 107, 101, 67, 97, 108, 108, 98, 97, 99, 107, 40, 99, 97, 108, 108, 98, 97, 99, 107, 41, 59, 10, 32, 32, 105, 102, 32, 40, 33, 110, 117, 108, 108, 67, 104, 101, 99, 107, 40, 112, 97, 116, 104, 44, 32, 99, 97, 108, 108, 98, 97, 99, 107, 41, 41, 32, 114, 101, 116, 117, 114, 110, 59, 10, 32, 32, 118, 97, 114, 32, 114, 101, 113, 32, 61, 32, 110, 101, 119, 32, 70, 83, 82, 101, 113, 87, 114, 97, 112, 40, 41, 59, 10, 32, 32, 114, 101, 113, 46, 111, 110, 99, 111, 109, 112, 108, 101, 116, 101, 32, 61, 32, 99, 97, 108, 108, 98, 97, 99, 107, 59, 10, 32, 32, 98, 105, 110, 100, 105, 110, 103, 46, 114, 101, 97, 100, 108, 105, 110, 107, 40, 112, 97, 116, 104, 77, 111, 100, 117, 108, 101, 46, 95, 109, 97, 107, 101, 76, 111, 110, 103, 40, 112, 97, 116, 104, 41, 44, 32, 114, 101, 113, 41, 59, 10, 125, 59, 10, 10, 102, 115, 46, 114, 101, 97, 100, 108, 105, 110, 107, 83, 121, 110, 99, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 112, 97, 116, 104, 41, 32, 123, 10, 32, 32, 110, 117, 108, 108, 67, 104, 101, 99, 107, 40, 112, 97, 116, 104, 41, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 98, 105, 110, 100, 105, 110, 103, 46, 114, 101, 97, 100, 108, 105, 110, 107, 40, 112, 97, 116, 104, 77, 111, 100, 117, 108, 101, 46, 95, 109, 97, 107, 101, 76, 111, 110, 103, 40, 112, 97, 116, 104, 41, 41, 59, 10, 125, 59, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 112, 114, 101, 112, 114, 111, 99, 101, 115, 115, 83, 121, 109, 108, 105, 110, 107, 68, 101, 115, 116, 105, 110, 97, 116, 105, 111, 110, 40, 112, 97, 116, 104, 44, 32, 116, 121, 112, 101, 44, 32, 108, 105, 110, 107, 80, 97, 116, 104, 41, 32, 123, 10, 32, 32, 105, 102, 32, 40, 33, 105, 115, 87, 105, 110, 100, 111, 119, 115, 41, 32, 123, 10, 32, 32, 32, 32, 47, 47, 32, 78, 111, 32, 112, 114, 101, 112, 114, 111, 99, 101, 115, 115, 105, 110, 103, 32, 105, 115, 32, 110, 101, 101, 100, 101, 100, 32, 111, 110, 32, 85, 110, 105, 120, 46, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 112, 97, 116, 104, 59, 10, 32, 32, 125, 32, 101, 108, 115, 101, 32, 105, 102, 32, 40, 116, 121, 112, 101, 32, 61, 61, 61, 32, 39, 106, 117, 110, 99, 116, 105, 111, 110, 39, 41, 32, 123, 10, 32, 32, 32, 32, 47, 47, 32, 74, 117, 110, 99, 116, 105, 111, 110, 115, 32, 112, 97, 116, 104, 115, 32, 110, 101, 101, 100, 32, 116, 111, 32, 98, 101, 32, 97, 98, 115, 111, 108, 117, 116, 101, 32, 97, 110, 100, 32, 92, 92, 63, 92, 45, 112, 114, 101, 102, 105, 120, 101, 100, 46, 10, 32, 32, 32, 32, 47, 47, 32, 65, 32, 114, 101, 108, 97, 116, 105, 118, 101, 32, 116, 97, 114, 103, 101, 116, 32, 105, 115, 32, 114, 101, 108, 97, 116, 105, 118, 101, 32, 116, 111, 32, 116, 104, 101, 32, 108, 105, 110, 107, 39, 115, 32, 112, 97, 114, 101, 110, 116, 32, 100, 105, 114, 101, 99, 116, 111, 114, 121, 46, 10, 32, 32, 32, 32, 112, 97, 116, 104, 32, 61, 32, 112, 97, 116, 104, 77, 111, 100, 117, 108, 101, 46, 114, 101, 115, 111, 108, 118, 101, 40, 108, 105, 110, 107, 80, 97, 116, 104, 44, 32, 39, 46, 46, 39, 44, 32, 112, 97, 116, 104, 41, 59, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 112, 97, 116, 104, 77, 111, 100, 117, 108, 101, 46, 95, 109, 97, 107, 101, 76, 111, 110, 103, 40, 112, 97, 116, 104, 41, 59, 10, 32, 32, 125, 32, 101, 108, 115, 101, 32, 123, 10, 32, 32, 32, 32, 47, 47, 32, 87, 105, 110, 100, 111, 119, 115, 32, 115, 121, 109, 108, 105, 110, 107, 115, 32, 100, 111, 110, 39, 116, 32, 116, 111, 108, 101, 114, 97, 116, 101, 32, 102, 111, 114, 119, 97, 114, 100, 32, 115, 108, 97, 115, 104, 101, 115, 46, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 40, 39, 39, 32, 43, 32, 112, 97, 116, 104, 41, 46, 114, 101, 112, 108, 97, 99, 101, 40, 47, 92, 47, 47, 103, 44, 32, 39, 92, 92, 39, 41, 59, 10, 32, 32, 125, 10, 125, 10, 10, 102, 115, 46, 115, 121, 109, 108, 105, 110, 107, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 116, 97, 114, 103, 101, 116, 44, 32, 112, 97, 116, 104, 44, 32, 116, 121, 112, 101, 95, 44, 32, 99, 97, 108, 108, 98, 97, 99, 107, 95, 41, 32, 123, 10, 32, 32, 118, 97, 114, 32, 116, 121, 112, 101, 32, 61, 32, 40, 116, 121, 112, 101, 111, 102, 32, 116, 121, 112, 101, 95, 32, 61, 61, 61, 32, 39, 115, 116, 114, 105, 110, 103, 39, 32, 63, 32, 116, 121, 112, 101, 95, 32, 58, 32, 110, 117, 108, 108, 41, 59, 10, 32, 32, 118, 97, 114, 32, 99, 97, 108, 108, 98, 97, 99, 107, 32, 61, 32, 109, 97, 107, 101, 67, 97, 108, 108, 98, 97, 99, 107, 40, 97, 114, 103, 117, 109, 101, 110, 116, 115, 91, 97, 114, 103, 117, 109, 101, 110, 116, 115, 46, 108, 101, 110, 103, 116, 104, 32, 45, 32, 49, 93, 41, 59, 10, 10, 32, 32, 105, 102, 32, 40, 33, 110, 117, 108, 108, 67, 104, 101, 99, 107, 40, 116, 97, 114, 103, 101, 116, 44, 32, 99, 97, 108, 108, 98, 97, 99, 107, 41, 41, 32, 114, 101, 116, 117, 114, 110, 59, 10, 32, 32, 105, 102, 32, 40, 33, 110, 117, 108, 108, 67, 104, 101, 99, 107, 40, 112, 97, 116, 104, 44, 32, 99, 97, 108, 108, 98, 97, 99, 107, 41, 41, 32, 114, 101, 116, 117, 114, 110, 59, 10, 10, 32, 32, 118, 97, 114, 32, 114, 101, 113, 32, 61, 32, 110, 101, 119, 32, 70, 83, 82, 101, 113, 87, 114, 97, 112, 40, 41, 59, 10, 32, 32, 114, 101, 113, 46, 111, 110, 99, 111, 109, 112, 108, 101, 116, 101, 32, 61, 32, 99, 97, 108, 108, 98, 97, 99, 107, 59, 10, 10, 32, 32, 98, 105, 110, 100, 105, 110, 103, 46, 115, 121, 109, 108, 105, 110, 107, 40, 112, 114, 101, 112, 114, 111, 99, 101, 115, 115, 83, 121, 109, 108, 105, 110, 107, 68, 101, 115, 116, 105, 110, 97, 116, 105, 111, 110, 40, 116, 97, 114, 103, 101, 116, 44, 32, 116, 121, 112, 101, 44, 32, 112, 97, 116, 104, 41, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 112, 97, 116, 104, 77, 111, 100, 117, 108, 101, 46, 95, 109, 97, 107, 101, 76, 111, 110, 103, 40, 112, 97, 116, 104, 41, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 116, 121, 112, 101, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 114, 101, 113, 41, 59, 10, 125, 59, 10, 10, 102, 115, 46, 115, 121, 109, 108, 105, 110, 107, 83, 121, 110, 99, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 116, 97, 114, 103, 101, 116, 44, 32, 112, 97, 116, 104, 44, 32, 116, 121, 112, 101, 41, 32, 123, 10, 32, 32, 116, 121, 112, 101, 32, 61, 32, 40, 116, 121, 112, 101, 111, 102, 32, 116, 121, 112, 101, 32, 61, 61, 61, 32, 39, 115, 116, 114, 105, 110, 103, 39, 32, 63, 32, 116, 121, 112, 101, 32, 58, 32, 110, 117, 108, 108, 41, 59, 10, 10, 32, 32, 110, 117, 108, 108, 67, 104, 101, 99, 107, 40, 116, 97, 114, 103, 101, 116, 41, 59, 10, 32, 32, 110, 117, 108, 108, 67, 104, 101, 99, 107, 40, 112, 97, 116, 104, 41, 59, 10, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 98, 105, 110, 100, 105, 110, 103, 46, 115, 121, 109, 108, 105, 110, 107, 40, 112, 114, 101, 112, 114, 111, 99, 101, 115, 115, 83, 121, 109, 108, 105, 110, 107, 68, 101, 115, 116, 105, 110, 97, 116, 105, 111, 110, 40, 116, 97, 114, 103, 101, 116, 44, 32, 116, 121, 112, 101, 44, 32, 112, 97, 116, 104, 41, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 112, 97, 116, 104, 77, 111, 100, 117, 108, 101, 46, 95, 109, 97, 107, 101, 76, 111, 110, 103, 40, 112, 97, 116, 104, 41, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 116, 121, 112, 101, 41, 59, 10, 125, 59, 10, 10, 102, 115, 46, 108, 105, 110, 107, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 115, 114, 99, 112, 97, 116, 104, 44, 32, 100, 115, 116, 112, 97, 116, 104, 44, 32, 99, 97, 108, 108, 98, 97, 99, 107, 41, 32, 123, 10, 32, 32, 99, 97, 108, 108, 98, 97, 99, 107, 32, 61, 32, 109, 97, 107, 101, 67, 97, 108, 108, 98, 97, 99, 107, 40, 99, 97, 108, 108, 98, 97, 99, 107, 41, 59, 10, 32, 32, 105, 102, 32, 40, 33, 110, 117, 108, 108, 67, 104, 101, 99, 107, 40, 115, 114, 99, 112, 97, 116, 104, 44, 32, 99, 97, 108, 108, 98, 97, 99, 107, 41, 41, 32, 114, 101, 116, 117, 114, 110, 59, 10, 32, 32, 105, 102, 32, 40, 33, 110, 117, 108, 108, 67, 104, 101, 99, 107, 40, 100, 115, 116, 112, 97, 116, 104, 44, 32, 99, 97, 108, 108, 98, 97, 99, 107, 41, 41, 32, 114, 101, 116, 117, 114, 110, 59, 10, 10, 32, 32, 118, 97, 114, 32, 114, 101, 113, 32, 61, 32, 110, 101, 119, 32, 70, 83, 82, 101, 113, 87, 114, 97, 112, 40, 41, 59, 10, 32, 32, 114, 101, 113, 46, 111, 110, 99, 111, 109, 112, 108, 101, 116, 101, 32, 61, 32, 99, 97, 108, 108, 98, 97, 99, 107, 59, 10, 10, 32, 32, 98, 105, 110, 100, 105, 110, 103, 46, 108, 105, 110, 107, 40, 112, 97, 116, 104, 77, 111, 100, 117, 108, 101, 46, 95, 109, 97, 107, 101, 76, 111, 110, 103, 40, 115, 114, 99, 112, 97, 116, 104, 41, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 112, 97, 116, 104, 77, 111, 100, 117, 108, 101, 46, 95, 109, 97, 107, 101, 76, 111, 110, 103, 40, 100, 115, 116, 112, 97, 116, 104, 41, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 114, 101, 113, 41, 59, 10, 125, 59, 10, 10, 102, 115, 46, 108, 105, 110, 107, 83, 121, 110, 99, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 115, 114, 99, 112, 97, 116, 104, 44, 32, 100, 115, 116, 112, 97, 116, 104, 41, 32, 123, 10, 32, 32, 110, 117, 108, 108, 67, 104, 101, 99, 107, 40, 115, 114, 99, 112, 97, 116, 104, 41, 59, 10, 32, 32, 110, 117, 108, 108, 67, 104, 101, 99, 107, 40, 100, 115, 116, 112, 97, 116, 104, 41, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 98, 105, 110, 100, 105, 110, 103, 46, 108, 105, 110, 107, 40, 112, 97, 116, 104, 77, 111, 100, 117, 108, 101, 46, 95, 109, 97, 107, 101, 76, 111, 110, 103, 40, 115, 114, 99, 112, 97, 116, 104, 41, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 112, 97, 116, 104, 77, 111, 100, 117, 108, 101, 46, 95, 109, 97, 107, 101, 76, 111, 110, 103, 40, 100, 115, 116, 112, 97, 116, 104, 41, 41, 59, 10, 125, 59, 10, 10, 102, 115, 46, 117, 110, 108, 105, 110, 107, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 112, 97, 116, 104, 44, 32, 99, 97, 108, 108, 98, 97, 99, 107, 41, 32, 123, 10, 32, 32, 99, 97, 108, 108, 98, 97, 99, 107, 32, 61, 32, 109, 97, 107, 101, 67, 97, 108, 108, 98, 97, 99, 107, 40, 99, 97, 108, 108, 98, 97, 99, 107, 41, 59, 10, 32, 32, 105, 102, 32, 40, 33, 110, 117, 108, 108, 67, 104, 101, 99, 107, 40, 112, 97, 116, 104, 44, 32, 99, 97, 108, 108, 98, 97, 99, 107, 41, 41, 32, 114, 101, 116, 117, 114, 110, 59, 10, 32, 32, 118, 97, 114, 32, 114, 101, 113, 32, 61, 32, 110, 101, 119, 32, 70, 83, 82, 101, 113, 87, 114, 97, 112, 40, 41, 59, 10, 32, 32, 114, 101, 113, 46, 111, 110, 99, 111, 109, 112, 108, 101, 116, 101, 32, 61, 32, 99, 97, 108, 108, 98, 97, 99, 107, 59, 10, 32, 32, 98, 105, 110, 100, 105, 110, 103, 46, 117, 110, 108, 105, 110, 107, 40, 112, 97, 116, 104, 77, 111, 100, 117, 108, 101, 46, 95, 109, 97, 107, 101, 76, 111, 110, 103, 40, 112, 97, 116, 104, 41, 44, 32, 114, 101, 113, 41, 59, 10, 125, 59, 10, 10, 102, 115, 46, 117, 110, 108, 105, 110, 107, 83, 121, 110, 99, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 112, 97, 116, 104, 41, 32, 123, 10, 32, 32, 110, 117, 108, 108, 67, 104, 101, 99, 107, 40, 112, 97, 116, 104, 41, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 98, 105, 110, 100, 105, 110, 103, 46, 117, 110, 108, 105, 110, 107, 40, 112, 97, 116, 104, 77, 111, 100, 117, 108, 101, 46, 95, 109, 97, 107, 101, 76, 111, 110, 103, 40, 112, 97, 116, 104, 41, 41, 59, 10, 125, 59, 10, 10, 102, 115, 46, 102, 99, 104, 109, 111, 100, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 102, 100, 44, 32, 109, 111, 100, 101, 44, 32, 99, 97, 108, 108, 98, 97, 99, 107, 41, 32, 123, 10, 32, 32, 118, 97, 114, 32, 114, 101, 113, 32, 61, 32, 110, 101, 119, 32, 70, 83, 82, 101, 113, 87, 114, 97, 112, 40, 41, 59, 10, 32, 32, 114, 101, 113, 46, 111, 110, 99, 111, 109, 112, 108, 101, 116, 101, 32, 61, 32, 109, 97, 107, 101, 67, 97, 108, 108, 98, 97, 99, 107, 40, 99, 97, 108, 108, 98, 97, 99, 107, 41, 59, 10, 32, 32, 98, 105, 110, 100, 105, 110, 103, 46, 102, 99, 104, 109, 111, 100, 40, 102, 100, 44, 32, 109, 111, 100, 101, 78, 117, 109, 40, 109, 111, 100, 101, 41, 44, 32, 114, 101, 113, 41, 59, 10, 125, 59, 10, 10, 102, 115, 46, 102, 99, 104, 109, 111, 100, 83, 121, 110, 99, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 102, 100, 44, 32, 109, 111, 100, 101, 41, 32, 123, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 98, 105, 110, 100, 105, 110, 103, 46, 102, 99, 104, 109, 111, 100, 40, 102, 100, 44, 32, 109, 111, 100, 101, 78, 117, 109, 40, 109, 111, 100, 101, 41, 41, 59, 10, 125, 59, 10, 10, 105, 102, 32, 40, 99, 111, 110, 115, 116, 97, 110, 116, 115, 46, 104, 97, 115, 79, 119, 110, 80, 114, 111, 112, 101, 114, 116, 121, 40, 39, 79, 95, 83, 89, 77, 76, 73, 78, 75, 39, 41, 41, 32, 123, 10, 32, 32, 102, 115, 46, 108, 99, 104, 109, 111, 100, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 112, 97, 116, 104, 44, 32, 109, 111, 100, 101, 44, 32, 99, 97, 108, 108, 98, 97, 99, 107, 41, 32, 123, 10, 32, 32, 32, 32, 99, 97, 108, 108, 98, 97, 99, 107, 32, 61, 32, 109, 97, 121, 98, 101, 67, 97, 108, 108, 98, 97, 99, 107, 40, 99, 97, 108, 108, 98, 97, 99, 107, 41, 59, 10, 32, 32, 32, 32, 102, 115, 46, 111, 112, 101, 110, 40, 112, 97, 116, 104, 44, 32, 99, 111, 110, 115, 116, 97, 110, 116, 115, 46, 79, 95, 87, 82, 79, 78, 76, 89, 32, 124, 32, 99, 111, 110, 115, 116, 97, 110, 116, 115, 46, 79, 95, 83, 89, 77, 76, 73, 78, 75, 44, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 101, 114, 114, 44, 32, 102, 100, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 105, 102, 32, 40, 101, 114, 114, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 99, 97, 108, 108, 98, 97, 99, 107, 40, 101, 114, 114, 41, 59, 10, 32, 32, 32, 32, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 59, 10, 32, 32, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 32, 32, 47, 47, 32, 112, 114, 101, 102, 101, 114, 32, 116, 111, 32, 114, 101, 116, 117, 114, 110, 32, 116, 104, 101, 32, 99, 104, 109, 111, 100, 32, 101, 114, 114, 111, 114, 44, 32, 105, 102, 32, 111, 110, 101, 32, 111, 99, 99, 117, 114, 115, 44, 10, 32, 32, 32, 32, 32, 32, 47, 47, 32, 98, 117, 116, 32, 115, 116, 105, 108, 108, 32, 116, 114, 121, 32, 116, 111, 32, 99, 108, 111, 115, 101, 44, 32, 97, 110, 100, 32, 114, 101, 112, 111, 114, 116, 32, 99, 108, 111, 115, 105, 110, 103, 32, 101, 114, 114, 111, 114, 115, 32, 105, 102, 32, 116, 104, 101, 121, 32, 111, 99, 99, 117, 114, 46, 10, 32, 32, 32, 32, 32, 32, 102, 115, 46, 102, 99, 104, 109, 111, 100, 40, 102, 100, 44, 32, 109, 111, 100, 101, 44, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 101, 114, 114, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 102, 115, 46, 99, 108, 111, 115, 101, 40, 102, 100, 44, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 101, 114, 114, 50, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99, 97, 108, 108, 98, 97, 99, 107, 40, 101, 114, 114, 32, 124, 124, 32, 101, 114, 114, 50, 41, 59, 10, 32, 32, 32, 32, 32, 32, 32, 32, 125, 41, 59, 10, 32, 32, 32, 32, 32, 32, 125, 41, 59, 10, 32, 32, 32, 32, 125, 41, 59, 10, 32, 32, 125, 59, 10, 10, 32, 32, 102, 115, 46, 108, 99, 104, 109, 111, 100, 83, 121, 110, 99, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 112, 97, 116, 104, 44, 32, 109, 111, 100, 101, 41, 32, 123, 10, 32, 32, 32, 32, 118, 97, 114, 32, 102, 100, 32, 61, 32, 102, 115, 46, 111, 112, 101, 110, 83, 121, 110, 99, 40, 112, 97, 116, 104, 44, 32, 99, 111, 110, 115, 116, 97, 110, 116, 115, 46, 79, 95, 87, 82, 79, 78, 76, 89, 32, 124, 32, 99, 111, 110, 115, 116, 97, 110, 116, 115, 46, 79, 95, 83, 89, 77, 76, 73, 78, 75, 41, 59, 10, 10, 32, 32, 32, 32, 47, 47, 32, 112, 114, 101, 102, 101, 114, 32, 116, 111, 32, 114, 101, 116, 117, 114, 110, 32, 116, 104, 101, 32, 99, 104, 109, 111, 100, 32, 101, 114, 114, 111, 114, 44, 32, 105, 102, 32, 111, 110, 101, 32, 111, 99, 99, 117, 114, 115, 44, 10, 32, 32, 32, 32, 47, 47, 32, 98, 117, 116, 32, 115, 116, 105, 108, 108, 32, 116, 114, 121, 32, 116, 111, 32, 99, 108, 111, 115, 101, 44, 32, 97, 110, 100, 32, 114, 101, 112, 111, 114, 116, 32, 99, 108, 111, 115, 105, 110, 103, 32, 101, 114, 114, 111, 114, 115, 32, 105, 102, 32, 116, 104, 101, 121, 32, 111, 99, 99, 117, 114, 46, 10, 32, 32, 32, 32, 118, 97, 114, 32, 101, 114, 114, 44, 32, 101, 114, 114, 50, 44, 32, 114, 101, 116, 59, 10, 32, 32, 32, 32, 116, 114, 121, 32, 123, 10, 32, 32, 32, 32, 32, 32, 114, 101, 116, 32, 61, 32, 102, 115, 46, 102, 99, 104, 109, 111, 100, 83, 121, 110, 99, 40, 102, 100, 44, 32, 109, 111, 100, 101, 41, 59, 10, 32, 32, 32, 32, 125, 32, 99, 97, 116, 99, 104, 32, 40, 101, 114, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 101, 114, 114, 32, 61, 32, 101, 114, 59, 10, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 116, 114, 121, 32, 123, 10, 32, 32, 32, 32, 32, 32, 102, 115, 46, 99, 108, 111, 115, 101, 83, 121, 110, 99, 40, 102, 100, 41, 59, 10, 32, 32, 32, 32, 125, 32, 99, 97, 116, 99, 104, 32, 40, 101, 114, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 101, 114, 114, 50, 32, 61, 32, 101, 114, 59, 10, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 105, 102, 32, 40, 101, 114, 114, 32, 124, 124, 32, 101, 114, 114, 50, 41, 32, 116, 104, 114, 111, 119, 32, 40, 101, 114, 114, 32, 124, 124, 32, 101, 114, 114, 50, 41, 59, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 114, 101, 116, 59, 10, 32, 32, 125, 59, 10, 125, 10, 10, 10, 102, 115, 46, 99, 104, 109, 111, 100, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 112, 97, 116, 104, 44, 32, 109, 111, 100, 101, 44, 32, 99, 97, 108, 108, 98, 97, 99, 107, 41, 32, 123, 10, 32, 32, 99, 97, 108, 108, 98, 97, 99, 107, 32, 61, 32, 109, 97, 107, 101, 67, 97, 108, 108, 98, 97, 99, 107, 40, 99, 97, 108, 108, 98, 97, 99, 107, 41, 59, 10, 32, 32, 105, 102, 32, 40, 33, 110, 117, 108, 108, 67, 104, 101, 99, 107, 40, 112, 97, 116, 104, 44, 32, 99, 97, 108, 108, 98, 97, 99, 107, 41, 41, 32, 114, 101, 116, 117, 114, 110, 59, 10, 32, 32, 118, 97, 114, 32, 114, 101, 113, 32, 61, 32, 110, 101, 119, 32, 70, 83, 82, 101, 113, 87, 114, 97, 112, 40, 41, 59, 10, 32, 32, 114, 101, 113, 46, 111, 110, 99, 111, 109, 112, 108, 101, 116, 101, 32, 61, 32, 99, 97, 108, 108, 98, 97, 99, 107, 59, 10, 32, 32, 98, 105, 110, 100, 105, 110, 103, 46, 99, 104, 109, 111, 100, 40, 112, 97, 116, 104, 77, 111, 100, 117, 108, 101, 46, 95, 109, 97, 107, 101, 76, 111, 110, 103, 40, 112, 97, 116, 104, 41, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 109, 111, 100, 101, 78, 117, 109, 40, 109, 111, 100, 101, 41, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 114, 101, 113, 41, 59, 10, 125, 59, 10, 10, 102, 115, 46, 99, 104, 109, 111, 100, 83, 121, 110, 99, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 112, 97, 116, 104, 44, 32, 109, 111, 100, 101, 41, 32, 123, 10, 32, 32, 110, 117, 108, 108, 67, 104, 101, 99, 107, 40, 112, 97, 116, 104, 41, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 98, 105, 110, 100, 105, 110, 103, 46, 99, 104, 109, 111, 100, 40, 112, 97, 116, 104, 77, 111, 100, 117, 108, 101, 46, 95, 109, 97, 107, 101, 76, 111, 110, 103, 40, 112, 97, 116, 104, 41, 44, 32, 109, 111, 100, 101, 78, 117, 109, 40, 109, 111, 100, 101, 41, 41, 59, 10, 125, 59, 10, 10, 105, 102, 32, 40, 99, 111, 110, 115, 116, 97, 110, 116, 115, 46, 104, 97, 115, 79, 119, 110, 80, 114, 111, 112, 101, 114, 116, 121, 40, 39, 79, 95, 83, 89, 77, 76, 73, 78, 75, 39, 41, 41, 32, 123, 10, 32, 32, 102, 115, 46, 108, 99, 104, 111, 119, 110, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 112, 97, 116, 104, 44, 32, 117, 105, 100, 44, 32, 103, 105, 100, 44, 32, 99, 97, 108, 108, 98, 97, 99, 107, 41, 32, 123, 10, 32, 32, 32, 32, 99, 97, 108, 108, 98, 97, 99, 107, 32, 61, 32, 109, 97, 121, 98, 101, 67, 97, 108, 108, 98, 97, 99, 107, 40, 99, 97, 108, 108, 98, 97, 99, 107, 41, 59, 10, 32, 32, 32, 32, 102, 115, 46, 111, 112, 101, 110, 40, 112, 97, 116, 104, 44, 32, 99, 111, 110, 115, 116, 97, 110, 116, 115, 46, 79, 95, 87, 82, 79, 78, 76, 89, 32, 124, 32, 99, 111, 110, 115, 116, 97, 110, 116, 115, 46, 79, 95, 83, 89, 77, 76, 73, 78, 75, 44, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 101, 114, 114, 44, 32, 102, 100, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 105, 102, 32, 40, 101, 114, 114, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 99, 97, 108, 108, 98, 97, 99, 107, 40, 101, 114, 114, 41, 59, 10, 32, 32, 32, 32, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 59, 10, 32, 32, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 32, 32, 102, 115, 46, 102, 99, 104, 111, 119, 110, 40, 102, 100, 44, 32, 117, 105, 100, 44, 32, 103, 105, 100, 44, 32, 99, 97, 108, 108, 98, 97, 99, 107, 41, 59, 10, 32, 32, 32, 32, 125, 41, 59, 10, 32, 32, 125, 59, 10, 10, 32, 32, 102, 115, 46, 108, 99, 104, 111, 119, 110, 83, 121, 110, 99, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 112, 97, 116, 104, 44, 32, 117, 105, 100, 44, 32, 103, 105, 100, 41, 32, 123, 10, 32, 32, 32, 32, 118, 97, 114, 32, 102, 100, 32, 61, 32, 102, 115, 46, 111, 112, 101, 110, 83, 121, 110, 99, 40, 112, 97, 116, 104, 44, 32, 99, 111, 110, 115, 116, 97, 110, 116, 115, 46, 79, 95, 87, 82, 79, 78, 76, 89, 32, 124, 32, 99, 111, 110, 115, 116, 97, 110, 116, 115, 46, 79, 95, 83, 89, 77, 76, 73, 78, 75, 41, 59, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 102, 115, 46, 102, 99, 104, 111, 119, 110, 83, 121, 110, 99, 40, 102, 100, 44, 32, 117, 105, 100, 44, 32, 103, 105, 100, 41, 59, 10, 32, 32, 125, 59, 10, 125, 10, 10, 102, 115, 46, 102, 99, 104, 111, 119, 110, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 102, 100, 44, 32, 117, 105, 100, 44, 32, 103, 105, 100, 44, 32, 99, 97, 108, 108, 98, 97, 99, 107, 41, 32, 123, 10, 32, 32, 118, 97, 114, 32, 114, 101, 113, 32, 61, 32, 110, 101, 119, 32, 70, 83, 82, 101, 113, 87, 114, 97, 112, 40, 41, 59, 10, 32, 32, 114, 101, 113, 46, 111, 110, 99, 111, 109, 112, 108, 101, 116, 101, 32, 61, 32, 109, 97, 107, 101, 67, 97, 108, 108, 98, 97, 99, 107, 40, 99, 97, 108, 108, 98, 97, 99, 107, 41, 59, 10, 32, 32, 98, 105, 110, 100, 105, 110, 103, 46, 102, 99, 104, 111, 119, 110, 40, 102, 100, 44, 32, 117, 105, 100, 44, 32, 103, 105, 100, 44, 32, 114, 101, 113, 41, 59, 10, 125, 59, 10, 10, 102, 115, 46, 102, 99, 104, 111, 119, 110, 83, 121, 110, 99, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 102, 100, 44, 32, 117, 105, 100, 44, 32, 103, 105, 100, 41, 32, 123, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 98, 105, 110, 100, 105, 110, 103, 46, 102, 99, 104, 111, 119, 110, 40, 102, 100, 44, 32, 117, 105, 100, 44, 32, 103, 105, 100, 41, 59, 10, 125, 59, 10, 10, 102, 115, 46, 99, 104, 111, 119, 110, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 112, 97, 116, 104, 44, 32, 117, 105, 100, 44, 32, 103, 105, 100, 44, 32, 99, 97, 108, 108, 98, 97, 99, 107, 41, 32, 123, 10, 32, 32, 99, 97, 108, 108, 98, 97, 99, 107, 32, 61, 32, 109, 97, 107, 101, 67, 97, 108, 108, 98, 97, 99, 107, 40, 99, 97, 108, 108, 98, 97, 99, 107, 41, 59, 10, 32, 32, 105, 102, 32, 40, 33, 110, 117, 108, 108, 67, 104, 101, 99, 107, 40, 112, 97, 116, 104, 44, 32, 99, 97, 108, 108, 98, 97, 99, 107, 41, 41, 32, 114, 101, 116, 117, 114, 110, 59, 10, 32, 32, 118, 97, 114, 32, 114, 101, 113, 32, 61, 32, 110, 101, 119, 32, 70, 83, 82, 101, 113, 87, 114, 97, 112, 40, 41, 59, 10, 32, 32, 114, 101, 113, 46, 111, 110, 99, 111, 109, 112, 108, 101, 116, 101, 32, 61, 32, 99, 97, 108, 108, 98, 97, 99, 107, 59, 10, 32, 32, 98, 105, 110, 100, 105, 110, 103, 46, 99, 104, 111, 119, 110, 40, 112, 97, 116, 104, 77, 111, 100, 117, 108, 101, 46, 95, 109, 97, 107, 101, 76, 111, 110, 103, 40, 112, 97, 116, 104, 41, 44, 32, 117, 105, 100, 44, 32, 103, 105, 100, 44, 32, 114, 101, 113, 41, 59, 10, 125, 59, 10, 10, 102, 115, 46, 99, 104, 111, 119, 110, 83, 121, 110, 99, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 112, 97, 116, 104, 44, 32, 117, 105, 100, 44, 32, 103, 105, 100, 41, 32, 123, 10, 32, 32, 110, 117, 108, 108, 67, 104, 101, 99, 107, 40, 112, 97, 116, 104, 41, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 98, 105, 110, 100, 105, 110, 103, 46, 99, 104, 111, 119, 110, 40, 112, 97, 116, 104, 77, 111, 100, 117, 108, 101, 46, 95, 109, 97, 107, 101, 76, 111, 110, 103, 40, 112, 97, 116, 104, 41, 44, 32, 117, 105, 100, 44, 32, 103, 105, 100, 41, 59, 10, 125, 59, 10, 10, 47, 47, 32, 99, 111, 110, 118, 101, 114, 116, 115, 32, 68, 97, 116, 101, 32, 111, 114, 32, 110, 117, 109, 98, 101, 114, 32, 116, 111, 32, 97, 32, 102, 114, 97, 99, 116, 105, 111, 110, 97, 108, 32, 85, 78, 73, 88, 32, 116, 105, 109, 101, 115, 116, 97, 109, 112, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 116, 111, 85, 110, 105, 120, 84, 105, 109, 101, 115, 116, 97, 109, 112, 40, 116, 105, 109, 101, 41, 32, 123, 10, 32, 32, 105, 102, 32, 40, 116, 121, 112, 101, 111, 102, 32, 116, 105, 109, 101, 32, 61, 61, 61, 32, 39, 115, 116, 114, 105, 110, 103, 39, 32, 38, 38, 32, 43, 116, 105, 109, 101, 32, 61, 61, 32, 116, 105, 109, 101, 41, 32, 123, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 43, 116, 105, 109, 101, 59, 10, 32, 32, 125, 10, 32, 32, 105, 102, 32, 40, 116, 121, 112, 101, 111, 102, 32, 116, 105, 109, 101, 32, 61, 61, 61, 32, 39, 110, 117, 109, 98, 101, 114, 39, 41, 32, 123, 10, 32, 32, 32, 32, 105, 102, 32, 40, 33, 78, 117, 109, 98, 101, 114, 46, 105, 115, 70, 105, 110, 105, 116, 101, 40, 116, 105, 109, 101, 41, 32, 124, 124, 32, 116, 105, 109, 101, 32, 60, 32, 48, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 68, 97, 116, 101, 46, 110, 111, 119, 40, 41, 32, 47, 32, 49, 48, 48, 48, 59, 10, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 116, 105, 109, 101, 59, 10, 32, 32, 125, 10, 32, 32, 105, 102, 32, 40, 117, 116, 105, 108, 46, 105, 115, 68, 97, 116, 101, 40, 116, 105, 109, 101, 41, 41, 32, 123, 10, 32, 32, 32, 32, 47, 47, 32, 99, 111, 110, 118, 101, 114, 116, 32, 116, 111, 32, 49, 50, 51, 46, 52, 53, 54, 32, 85, 78, 73, 88, 32, 116, 105, 109, 101, 115, 116, 97, 109, 112, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 116, 105, 109, 101, 46, 103, 101, 116, 84, 105, 109, 101, 40, 41, 32, 47, 32, 49, 48, 48, 48, 59, 10, 32, 32, 125, 10, 32, 32, 116, 104, 114, 111, 119, 32, 110, 101, 119, 32, 69, 114, 114, 111, 114, 40, 39, 67, 97, 110, 110, 111, 116, 32, 112, 97, 114, 115, 101, 32, 116, 105, 109, 101, 58, 32, 39, 32, 43, 32, 116, 105, 109, 101, 41, 59, 10, 125, 10, 10, 47, 47, 32, 101, 120, 112, 111, 114, 116, 101, 100, 32, 102, 111, 114, 32, 117, 110, 105, 116, 32, 116, 101, 115, 116, 115, 44, 32, 110, 111, 116, 32, 102, 111, 114, 32, 112, 117, 98, 108, 105, 99, 32, 99, 111, 110, 115, 117, 109, 112, 116, 105, 111, 110, 10, 102, 115, 46, 95, 116, 111, 85, 110, 105, 120, 84, 105, 109, 101, 115, 116, 97, 109, 112, 32, 61, 32, 116, 111, 85, 110, 105, 120, 84, 105, 109, 101, 115, 116, 97, 109, 112, 59, 10, 10, 102, 115, 46, 117, 116, 105, 109, 101, 115, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 112, 97, 116, 104, 44, 32, 97, 116, 105, 109, 101, 44, 32, 109, 116, 105, 109, 101, 44, 32, 99, 97, 108, 108, 98, 97, 99, 107, 41, 32, 123, 10, 32, 32, 99, 97, 108, 108, 98, 97, 99, 107, 32, 61, 32, 109, 97, 107, 101, 67, 97, 108, 108, 98, 97, 99, 107, 40, 99, 97, 108, 108, 98, 97, 99, 107, 41, 59, 10, 32, 32, 105, 102, 32, 40, 33, 110, 117, 108, 108, 67, 104, 101, 99, 107, 40, 112, 97, 116, 104, 44, 32, 99, 97, 108, 108, 98, 97, 99, 107, 41, 41, 32, 114, 101, 116, 117, 114, 110, 59, 10, 32, 32, 118, 97, 114, 32, 114, 101, 113, 32, 61, 32, 110, 101, 119, 32, 70, 83, 82, 101, 113, 87, 114, 97, 112, 40, 41, 59, 10, 32, 32, 114, 101, 113, 46, 111, 110, 99, 111, 109, 112, 108, 101, 116, 101, 32, 61, 32, 99, 97, 108, 108, 98, 97, 99, 107, 59, 10, 32, 32, 98, 105, 110, 100, 105, 110, 103, 46, 117, 116, 105, 109, 101, 115, 40, 112, 97, 116, 104, 77, 111, 100, 117, 108, 101, 46, 95, 109, 97, 107, 101, 76, 111, 110, 103, 40, 112, 97, 116, 104, 41, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 116, 111, 85, 110, 105, 120, 84, 105, 109, 101, 115, 116, 97, 109, 112, 40, 97, 116, 105, 109, 101, 41, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 116, 111, 85, 110, 105, 120, 84, 105, 109, 101, 115, 116, 97, 109, 112, 40, 109, 116, 105, 109, 101, 41, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 114, 101, 113, 41, 59, 10, 125, 59, 10, 10, 102, 115, 46, 117, 116, 105, 109, 101, 115, 83, 121, 110, 99, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 112, 97, 116, 104, 44, 32, 97, 116, 105, 109, 101, 44, 32, 109, 116, 105, 109, 101, 41, 32, 123, 10, 32, 32, 110, 117, 108, 108, 67, 104, 101, 99, 107, 40, 112, 97, 116, 104, 41, 59, 10, 32, 32, 97, 116, 105, 109, 101, 32, 61, 32, 116, 111, 85, 110, 105, 120, 84, 105, 109, 101, 115, 116, 97, 109, 112, 40, 97, 116, 105, 109, 101, 41, 59, 10, 32, 32, 109, 116, 105, 109, 101, 32, 61, 32, 116, 111, 85, 110, 105, 120, 84, 105, 109, 101, 115, 116, 97, 109, 112, 40, 109, 116, 105, 109, 101, 41, 59, 10, 32, 32, 98, 105, 110, 100, 105, 110, 103, 46, 117, 116, 105, 109, 101, 115, 40, 112, 97, 116, 104, 77, 111, 100, 117, 108, 101, 46, 95, 109, 97, 107, 101, 76, 111, 110, 103, 40, 112, 97, 116, 104, 41, 44, 32, 97, 116, 105, 109, 101, 44, 32, 109, 116, 105, 109, 101, 41, 59, 10, 125, 59, 10, 10, 102, 115, 46, 102, 117, 116, 105, 109, 101, 115, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 102, 100, 44, 32, 97, 116, 105, 109, 101, 44, 32, 109, 116, 105, 109, 101, 44, 32, 99, 97, 108, 108, 98, 97, 99, 107, 41, 32, 123, 10, 32, 32, 97, 116, 105, 109, 101, 32, 61, 32, 116, 111, 85, 110, 105, 120, 84, 105, 109, 101, 115, 116, 97, 109, 112, 40, 97, 116, 105, 109, 101, 41, 59, 10, 32, 32, 109, 116, 105, 109, 101, 32, 61, 32, 116, 111, 85, 110, 105, 120, 84, 105, 109, 101, 115, 116, 97, 109, 112, 40, 109, 116, 105, 109, 101, 41, 59, 10, 32, 32, 118, 97, 114, 32, 114, 101, 113, 32, 61, 32, 110, 101, 119, 32, 70, 83, 82, 101, 113, 87, 114, 97, 112, 40, 41, 59, 10, 32, 32, 114, 101, 113, 46, 111, 110, 99, 111, 109, 112, 108, 101, 116, 101, 32, 61, 32, 109, 97, 107, 101, 67, 97, 108, 108, 98, 97, 99, 107, 40, 99, 97, 108, 108, 98, 97, 99, 107, 41, 59, 10, 32, 32, 98, 105, 110, 100, 105, 110, 103, 46, 102, 117, 116, 105, 109, 101, 115, 40, 102, 100, 44, 32, 97, 116, 105, 109, 101, 44, 32, 109, 116, 105, 109, 101, 44, 32, 114, 101, 113, 41, 59, 10, 125, 59, 10, 10, 102, 115, 46, 102, 117, 116, 105, 109, 101, 115, 83, 121, 110, 99, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 102, 100, 44, 32, 97, 116, 105, 109, 101, 44, 32, 109, 116, 105, 109, 101, 41, 32, 123, 10, 32, 32, 97, 116, 105, 109, 101, 32, 61, 32, 116, 111, 85, 110, 105, 120, 84, 105, 109, 101, 115, 116, 97, 109, 112, 40, 97, 116, 105, 109, 101, 41, 59, 10, 32, 32, 109, 116, 105, 109, 101, 32, 61, 32, 116, 111, 85, 110, 105, 120, 84, 105, 109, 101, 115, 116, 97, 109, 112, 40, 109, 116, 105, 109, 101, 41, 59, 10, 32, 32, 98, 105, 110, 100, 105, 110, 103, 46, 102, 117, 116, 105, 109, 101, 115, 40, 102, 100, 44, 32, 97, 116, 105, 109, 101, 44, 32, 109, 116, 105, 109, 101, 41, 59, 10, 125, 59, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 119, 114, 105, 116, 101, 65, 108, 108, 40, 102, 100, 44, 32, 98, 117, 102, 102, 101, 114, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 108, 101, 110, 103, 116, 104, 44, 32, 112, 111, 115, 105, 116, 105, 111, 110, 44, 32, 99, 97, 108, 108, 98, 97, 99, 107, 95, 41, 32, 123, 10, 32, 32, 118, 97, 114, 32, 99, 97, 108, 108, 98, 97, 99, 107, 32, 61, 32, 109, 97, 121, 98, 101, 67, 97, 108, 108, 98, 97, 99, 107, 40, 97, 114, 103, 117, 109, 101, 110, 116, 115, 91, 97, 114, 103, 117, 109, 101, 110, 116, 115, 46, 108, 101, 110, 103, 116, 104, 32, 45, 32, 49, 93, 41, 59, 10, 10, 32, 32, 47, 47, 32, 119, 114, 105, 116, 101, 40, 102, 100, 44, 32, 98, 117, 102, 102, 101, 114, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 108, 101, 110, 103, 116, 104, 44, 32, 112, 111, 115, 105, 116, 105, 111, 110, 44, 32, 99, 97, 108, 108, 98, 97, 99, 107, 41, 10, 32, 32, 102, 115, 46, 119, 114, 105, 116, 101, 40, 102, 100, 44, 32, 98, 117, 102, 102, 101, 114, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 108, 101, 110, 103, 116, 104, 44, 32, 112, 111, 115, 105, 116, 105, 111, 110, 44, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 119, 114, 105, 116, 101, 69, 114, 114, 44, 32, 119, 114, 105, 116, 116, 101, 110, 41, 32, 123, 10, 32, 32, 32, 32, 105, 102, 32, 40, 119, 114, 105, 116, 101, 69, 114, 114, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 102, 115, 46, 99, 108, 111, 115, 101, 40, 102, 100, 44, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 105, 102, 32, 40, 99, 97, 108, 108, 98, 97, 99, 107, 41, 32, 99, 97, 108, 108, 98, 97, 99, 107, 40, 119, 114, 105, 116, 101, 69, 114, 114, 41, 59, 10, 32, 32, 32, 32, 32, 32, 125, 41, 59, 10, 32, 32, 32, 32, 125, 32, 101, 108, 115, 101, 32, 123, 10, 32, 32, 32, 32, 32, 32, 105, 102, 32, 40, 119, 114, 105, 116, 116, 101, 110, 32, 61, 61, 61, 32, 108, 101, 110, 103, 116, 104, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 102, 115, 46, 99, 108, 111, 115, 101, 40, 102, 100, 44, 32, 99, 97, 108, 108, 98, 97, 99, 107, 41, 59, 10, 32, 32, 32, 32, 32, 32, 125, 32, 101, 108, 115, 101, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 111, 102, 102, 115, 101, 116, 32, 43, 61, 32, 119, 114, 105, 116, 116, 101, 110, 59, 10, 32, 32, 32, 32, 32, 32, 32, 32, 108, 101, 110, 103, 116, 104, 32, 45, 61, 32, 119, 114, 105, 116, 116, 101, 110, 59, 10, 32, 32, 32, 32, 32, 32, 32, 32, 105, 102, 32, 40, 112, 111, 115, 105, 116, 105, 111, 110, 32, 33, 61, 61, 32, 110, 117, 108, 108, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 112, 111, 115, 105, 116, 105, 111, 110, 32, 43, 61, 32, 119, 114, 105, 116, 116, 101, 110, 59, 10, 32, 32, 32, 32, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 32, 32, 32, 32, 119, 114, 105, 116, 101, 65, 108, 108, 40, 102, 100, 44, 32, 98, 117, 102, 102, 101, 114, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 108, 101, 110, 103, 116, 104, 44, 32, 112, 111, 115, 105, 116, 105, 111, 110, 44, 32, 99, 97, 108, 108, 98, 97, 99, 107, 41, 59, 10, 32, 32, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 125, 10, 32, 32, 125, 41, 59, 10, 125, 10, 10, 102, 115, 46, 119, 114, 105, 116, 101, 70, 105, 108, 101, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 112, 97, 116, 104, 44, 32, 100, 97, 116, 97, 44, 32, 111, 112, 116, 105, 111, 110, 115, 44, 32, 99, 97, 108, 108, 98, 97, 99, 107, 95, 41, 32, 123, 10, 32, 32, 118, 97, 114, 32, 99, 97, 108, 108, 98, 97, 99, 107, 32, 61, 32, 109, 97, 121, 98, 101, 67, 97, 108, 108, 98, 97, 99, 107, 40, 97, 114, 103, 117, 109, 101, 110, 116, 115, 91, 97, 114, 103, 117, 109, 101, 110, 116, 115, 46, 108, 101, 110, 103, 116, 104, 32, 45, 32, 49, 93, 41, 59, 10, 10, 32, 32, 105, 102, 32, 40, 33, 111, 112, 116, 105, 111, 110, 115, 32, 124, 124, 32, 116, 121, 112, 101, 111, 102, 32, 111, 112, 116, 105, 111, 110, 115, 32, 61, 61, 61, 32, 39, 102, 117, 110, 99, 116, 105, 111, 110, 39, 41, 32, 123, 10, 32, 32, 32, 32, 111, 112, 116, 105, 111, 110, 115, 32, 61, 32, 123, 32, 101, 110, 99, 111, 100, 105, 110, 103, 58, 32, 39, 117, 116, 102, 56, 39, 44, 32, 109, 111, 100, 101, 58, 32, 48, 111, 54, 54, 54, 44, 32, 102, 108, 97, 103, 58, 32, 39, 119, 39, 32, 125, 59, 10, 32, 32, 125, 32, 101, 108, 115, 101, 32, 105, 102, 32, 40, 116, 121, 112, 101, 111, 102, 32, 111, 112, 116, 105, 111, 110, 115, 32, 61, 61, 61, 32, 39, 115, 116, 114, 105, 110, 103, 39, 41, 32, 123, 10, 32, 32, 32, 32, 111, 112, 116, 105, 111, 110, 115, 32, 61, 32, 123, 32, 101, 110, 99, 111, 100, 105, 110, 103, 58, 32, 111, 112, 116, 105, 111, 110, 115, 44, 32, 109, 111, 100, 101, 58, 32, 48, 111, 54, 54, 54, 44, 32, 102, 108, 97, 103, 58, 32, 39, 119, 39, 32, 125, 59, 10, 32, 32, 125, 32, 101, 108, 115, 101, 32, 105, 102, 32, 40, 116, 121, 112, 101, 111, 102, 32, 111, 112, 116, 105, 111, 110, 115, 32, 33, 61, 61, 32, 39, 111, 98, 106, 101, 99, 116, 39, 41, 32, 123, 10, 32, 32, 32, 32, 116, 104, 114, 111, 119, 79, 112, 116, 105, 111, 110, 115, 69, 114, 114, 111, 114, 40, 111, 112, 116, 105, 111, 110, 115, 41, 59, 10, 32, 32, 125, 10, 10, 32, 32, 97, 115, 115, 101, 114, 116, 69, 110, 99, 111, 100, 105, 110, 103, 40, 111, 112, 116, 105, 111, 110, 115, 46, 101, 110, 99, 111, 100, 105, 110, 103, 41, 59, 10, 10, 32, 32, 118, 97, 114, 32, 102, 108, 97, 103, 32, 61, 32, 111, 112, 116, 105, 111, 110, 115, 46, 102, 108, 97, 103, 32, 124, 124, 32, 39, 119, 39, 59, 10, 32, 32, 102, 115, 46, 111, 112, 101, 110, 40, 112, 97, 116, 104, 44, 32, 102, 108, 97, 103, 44, 32, 111, 112, 116, 105, 111, 110, 115, 46, 109, 111, 100, 101, 44, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 111, 112, 101, 110, 69, 114, 114, 44, 32, 102, 100, 41, 32, 123, 10, 32, 32, 32, 32, 105, 102, 32, 40, 111, 112, 101, 110, 69, 114, 114, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 105, 102, 32, 40, 99, 97, 108, 108, 98, 97, 99, 107, 41, 32, 99, 97, 108, 108, 98, 97, 99, 107, 40, 111, 112, 101, 110, 69, 114, 114, 41, 59, 10, 32, 32, 32, 32, 125, 32, 101, 108, 115, 101, 32, 123, 10, 32, 32, 32, 32, 32, 32, 118, 97, 114, 32, 98, 117, 102, 102, 101, 114, 32, 61, 32, 40, 100, 97, 116, 97, 32, 105, 110, 115, 116, 97, 110, 99, 101, 111, 102, 32, 66, 117, 102, 102, 101, 114, 41, 32, 63, 32, 100, 97, 116, 97, 32, 58, 32, 110, 101, 119, 32, 66, 117, 102, 102, 101, 114, 40, 39, 39, 32, 43, 32, 100, 97, 116, 97, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 111, 112, 116, 105, 111, 110, 115, 46, 101, 110, 99, 111, 100, 105, 110, 103, 32, 124, 124, 32, 39, 117, 116, 102, 56, 39, 41, 59, 10, 32, 32, 32, 32, 32, 32, 118, 97, 114, 32, 112, 111, 115, 105, 116, 105, 111, 110, 32, 61, 32, 47, 97, 47, 46, 116, 101, 115, 116, 40, 102, 108, 97, 103, 41, 32, 63, 32, 110, 117, 108, 108, 32, 58, 32, 48, 59, 10, 32, 32, 32, 32, 32, 32, 119, 114, 105, 116, 101, 65, 108, 108, 40, 102, 100, 44, 32, 98, 117, 102, 102, 101, 114, 44, 32, 48, 44, 32, 98, 117, 102, 102, 101, 114, 46, 108, 101, 110, 103, 116, 104, 44, 32, 112, 111, 115, 105, 116, 105, 111, 110, 44, 32, 99, 97, 108, 108, 98, 97, 99, 107, 41, 59, 10, 32, 32, 32, 32, 125, 10, 32, 32, 125, 41, 59, 10, 125, 59, 10, 10, 102, 115, 46, 119, 114, 105, 116, 101, 70, 105, 108, 101, 83, 121, 110, 99, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 112, 97, 116, 104, 44, 32, 100, 97, 116, 97, 44, 32, 111, 112, 116, 105, 111, 110, 115, 41, 32, 123, 10, 32, 32, 105, 102, 32, 40, 33, 111, 112, 116, 105, 111, 110, 115, 41, 32, 123, 10, 32, 32, 32, 32, 111, 112, 116, 105, 111, 110, 115, 32, 61, 32, 123, 32, 101, 110, 99, 111, 100, 105, 110, 103, 58, 32, 39, 117, 116, 102, 56, 39, 44, 32, 109, 111, 100, 101, 58, 32, 48, 111, 54, 54, 54, 44, 32, 102, 108, 97, 103, 58, 32, 39, 119, 39, 32, 125, 59, 10, 32, 32, 125, 32, 101, 108, 115, 101, 32, 105, 102, 32, 40, 116, 121, 112, 101, 111, 102, 32, 111, 112, 116, 105, 111, 110, 115, 32, 61, 61, 61, 32, 39, 115, 116, 114, 105, 110, 103, 39, 41, 32, 123, 10, 32, 32, 32, 32, 111, 112, 116, 105, 111, 110, 115, 32, 61, 32, 123, 32, 101, 110, 99, 111, 100, 105, 110, 103, 58, 32, 111, 112, 116, 105, 111, 110, 115, 44, 32, 109, 111, 100, 101, 58, 32, 48, 111, 54, 54, 54, 44, 32, 102, 108, 97, 103, 58, 32, 39, 119, 39, 32, 125, 59, 10, 32, 32, 125, 32, 101, 108, 115, 101, 32, 105, 102, 32, 40, 116, 121, 112, 101, 111, 102, 32, 111, 112, 116, 105, 111, 110, 115, 32, 33, 61, 61, 32, 39, 111, 98, 106, 101, 99, 116, 39, 41, 32, 123, 10, 32, 32, 32, 32, 116, 104, 114, 111, 119, 79, 112, 116, 105, 111, 110, 115, 69, 114, 114, 111, 114, 40, 111, 112, 116, 105, 111, 110, 115, 41, 59, 10, 32, 32, 125, 10, 10, 32, 32, 97, 115, 115, 101, 114, 116, 69, 110, 99, 111, 100, 105, 110, 103, 40, 111, 112, 116, 105, 111, 110, 115, 46, 101, 110, 99, 111, 100, 105, 110, 103, 41, 59, 10, 10, 32, 32, 118, 97, 114, 32, 102, 108, 97, 103, 32, 61, 32, 111, 112, 116, 105, 111, 110, 115, 46, 102, 108, 97, 103, 32, 124, 124, 32, 39, 119, 39, 59, 10, 32, 32, 118, 97, 114, 32, 102, 100, 32, 61, 32, 102, 115, 46, 111, 112, 101, 110, 83, 121, 110, 99, 40, 112, 97, 116, 104, 44, 32, 102, 108, 97, 103, 44, 32, 111, 112, 116, 105, 111, 110, 115, 46, 109, 111, 100, 101, 41, 59, 10, 32, 32, 105, 102, 32, 40, 33, 40, 100, 97, 116, 97, 32, 105, 110, 115, 116, 97, 110, 99, 101, 111, 102, 32, 66, 117, 102, 102, 101, 114, 41, 41, 32, 123, 10, 32, 32, 32, 32, 100, 97, 116, 97, 32, 61, 32, 110, 101, 119, 32, 66, 117, 102, 102, 101, 114, 40, 39, 39, 32, 43, 32, 100, 97, 116, 97, 44, 32, 111, 112, 116, 105, 111, 110, 115, 46, 101, 110, 99, 111, 100, 105, 110, 103, 32, 124, 124, 32, 39, 117, 116, 102, 56, 39, 41, 59, 10, 32, 32, 125, 10, 32, 32, 118, 97, 114, 32, 111, 102, 102, 115, 101, 116, 32, 61, 32, 48, 59, 10, 32, 32, 118, 97, 114, 32, 108, 101, 110, 103, 116, 104, 32, 61, 32, 100, 97, 116, 97, 46, 108, 101, 110, 103, 116, 104, 59, 10, 32, 32, 118, 97, 114, 32, 112, 111, 115, 105, 116, 105, 111, 110, 32, 61, 32, 47, 97, 47, 46, 116, 101, 115, 116, 40, 102, 108, 97, 103, 41, 32, 63, 32, 110, 117, 108, 108, 32, 58, 32, 48, 59, 10, 32, 32, 116, 114, 121, 32, 123, 10, 32, 32, 32, 32, 119, 104, 105, 108, 101, 32, 40, 108, 101, 110, 103, 116, 104, 32, 62, 32, 48, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 118, 97, 114, 32, 119, 114, 105, 116, 116, 101, 110, 32, 61, 32, 102, 115, 46, 119, 114, 105, 116, 101, 83, 121, 110, 99, 40, 102, 100, 44, 32, 100, 97, 116, 97, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 108, 101, 110, 103, 116, 104, 44, 32, 112, 111, 115, 105, 116, 105, 111, 110, 41, 59, 10, 32, 32, 32, 32, 32, 32, 111, 102, 102, 115, 101, 116, 32, 43, 61, 32, 119, 114, 105, 116, 116, 101, 110, 59, 10, 32, 32, 32, 32, 32, 32, 108, 101, 110, 103, 116, 104, 32, 45, 61, 32, 119, 114, 105, 116, 116, 101, 110, 59, 10, 32, 32, 32, 32, 32, 32, 105, 102, 32, 40, 112, 111, 115, 105, 116, 105, 111, 110, 32, 33, 61, 61, 32, 110, 117, 108, 108, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 112, 111, 115, 105, 116, 105, 111, 110, 32, 43, 61, 32, 119, 114, 105, 116, 116, 101, 110, 59, 10, 32, 32, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 125, 10, 32, 32, 125, 32, 102, 105, 110, 97, 108, 108, 121, 32, 123, 10, 32, 32, 32, 32, 102, 115, 46, 99, 108, 111, 115, 101, 83, 121, 110, 99, 40, 102, 100, 41, 59, 10, 32, 32, 125, 10, 125, 59, 10, 10, 102, 115, 46, 97, 112, 112, 101, 110, 100, 70, 105, 108, 101, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 112, 97, 116, 104, 44, 32, 100, 97, 116, 97, 44, 32, 111, 112, 116, 105, 111, 110, 115, 44, 32, 99, 97, 108, 108, 98, 97, 99, 107, 95, 41, 32, 123, 10, 32, 32, 118, 97, 114, 32, 99, 97, 108, 108, 98, 97, 99, 107, 32, 61, 32, 109, 97, 121, 98, 101, 67, 97, 108, 108, 98, 97, 99, 107, 40, 97, 114, 103, 117, 109, 101, 110, 116, 115, 91, 97, 114, 103, 117, 109, 101, 110, 116, 115, 46, 108, 101, 110, 103, 116, 104, 32, 45, 32, 49, 93, 41, 59, 10, 10, 32, 32, 105, 102, 32, 40, 33, 111, 112, 116, 105, 111, 110, 115, 32, 124, 124, 32, 116, 121, 112, 101, 111, 102, 32, 111, 112, 116, 105, 111, 110, 115, 32, 61, 61, 61, 32, 39, 102, 117, 110, 99, 116, 105, 111, 110, 39, 41, 32, 123, 10, 32, 32, 32, 32, 111, 112, 116, 105, 111, 110, 115, 32, 61, 32, 123, 32, 101, 110, 99, 111, 100, 105, 110, 103, 58, 32, 39, 117, 116, 102, 56, 39, 44, 32, 109, 111, 100, 101, 58, 32, 48, 111, 54, 54, 54, 44, 32, 102, 108, 97, 103, 58, 32, 39, 97, 39, 32, 125, 59, 10, 32, 32, 125, 32, 101, 108, 115, 101, 32, 105, 102, 32, 40, 116, 121, 112, 101, 111, 102, 32, 111, 112, 116, 105, 111, 110, 115, 32, 61, 61, 61, 32, 39, 115, 116, 114, 105, 110, 103, 39, 41, 32, 123, 10, 32, 32, 32, 32, 111, 112, 116, 105, 111, 110, 115, 32, 61, 32, 123, 32, 101, 110, 99, 111, 100, 105, 110, 103, 58, 32, 111, 112, 116, 105, 111, 110, 115, 44, 32, 109, 111, 100, 101, 58, 32, 48, 111, 54, 54, 54, 44, 32, 102, 108, 97, 103, 58, 32, 39, 97, 39, 32, 125, 59, 10, 32, 32, 125, 32, 101, 108, 115, 101, 32, 105, 102, 32, 40, 116, 121, 112, 101, 111, 102, 32, 111, 112, 116, 105, 111, 110, 115, 32, 33, 61, 61, 32, 39, 111, 98, 106, 101, 99, 116, 39, 41, 32, 123, 10, 32, 32, 32, 32, 116, 104, 114, 111, 119, 79, 112, 116, 105, 111, 110, 115, 69, 114, 114, 111, 114, 40, 111, 112, 116, 105, 111, 110, 115, 41, 59, 10, 32, 32, 125, 10, 10, 32, 32, 105, 102, 32, 40, 33, 111, 112, 116, 105, 111, 110, 115, 46, 102, 108, 97, 103, 41, 10, 32, 32, 32, 32, 111, 112, 116, 105, 111, 110, 115, 32, 61, 32, 117, 116, 105, 108, 46, 95, 101, 120, 116, 101, 110, 100, 40, 123, 32, 102, 108, 97, 103, 58, 32, 39, 97, 39, 32, 125, 44, 32, 111, 112, 116, 105, 111, 110, 115, 41, 59, 10, 32, 32, 102, 115, 46, 119, 114, 105, 116, 101, 70, 105, 108, 101, 40, 112, 97, 116, 104, 44, 32, 100, 97, 116, 97, 44, 32, 111, 112, 116, 105, 111, 110, 115, 44, 32, 99, 97, 108, 108, 98, 97, 99, 107, 41, 59, 10, 125, 59, 10, 10, 102, 115, 46, 97, 112, 112, 101, 110, 100, 70, 105, 108, 101, 83, 121, 110, 99, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 112, 97, 116, 104, 44, 32, 100, 97, 116, 97, 44, 32, 111, 112, 116, 105, 111, 110, 115, 41, 32, 123, 10, 32, 32, 105, 102, 32, 40, 33, 111, 112, 116, 105, 111, 110, 115, 41, 32, 123, 10, 32, 32, 32, 32, 111, 112, 116, 105, 111, 110, 115, 32, 61, 32, 123, 32, 101, 110, 99, 111, 100, 105, 110, 103, 58, 32, 39, 117, 116, 102, 56, 39, 44, 32, 109, 111, 100, 101, 58, 32, 48, 111, 54, 54, 54, 44, 32, 102, 108, 97, 103, 58, 32, 39, 97, 39, 32, 125, 59, 10, 32, 32, 125, 32, 101, 108, 115, 101, 32, 105, 102, 32, 40, 116, 121, 112, 101, 111, 102, 32, 111, 112, 116, 105, 111, 110, 115, 32, 61, 61, 61, 32, 39, 115, 116, 114, 105, 110, 103, 39, 41, 32, 123, 10, 32, 32, 32, 32, 111, 112, 116, 105, 111, 110, 115, 32, 61, 32, 123, 32, 101, 110, 99, 111, 100, 105, 110, 103, 58, 32, 111, 112, 116, 105, 111, 110, 115, 44, 32, 109, 111, 100, 101, 58, 32, 48, 111, 54, 54, 54, 44, 32, 102, 108, 97, 103, 58, 32, 39, 97, 39, 32, 125, 59, 10, 32, 32, 125, 32, 101, 108, 115, 101, 32, 105, 102, 32, 40, 116, 121, 112, 101, 111, 102, 32, 111, 112, 116, 105, 111, 110, 115, 32, 33, 61, 61, 32, 39, 111, 98, 106, 101, 99, 116, 39, 41, 32, 123, 10, 32, 32, 32, 32, 116, 104, 114, 111, 119, 79, 112, 116, 105, 111, 110, 115, 69, 114, 114, 111, 114, 40, 111, 112, 116, 105, 111, 110, 115, 41, 59, 10, 32, 32, 125, 10, 32, 32, 105, 102, 32, 40, 33, 111, 112, 116, 105, 111, 110, 115, 46, 102, 108, 97, 103, 41, 10, 32, 32, 32, 32, 111, 112, 116, 105, 111, 110, 115, 32, 61, 32, 117, 116, 105, 108, 46, 95, 101, 120, 116, 101, 110, 100, 40, 123, 32, 102, 108, 97, 103, 58, 32, 39, 97, 39, 32, 125, 44, 32, 111, 112, 116, 105, 111, 110, 115, 41, 59, 10, 10, 32, 32, 102, 115, 46, 119, 114, 105, 116, 101, 70, 105, 108, 101, 83, 121, 110, 99, 40, 112, 97, 116, 104, 44, 32, 100, 97, 116, 97, 44, 32, 111, 112, 116, 105, 111, 110, 115, 41, 59, 10, 125, 59, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 70, 83, 87, 97, 116, 99, 104, 101, 114, 40, 41, 32, 123, 10, 32, 32, 69, 118, 101, 110, 116, 69, 109, 105, 116, 116, 101, 114, 46, 99, 97, 108, 108, 40, 116, 104, 105, 115, 41, 59, 10, 10, 32, 32, 118, 97, 114, 32, 115, 101, 108, 102, 32, 61, 32, 116, 104, 105, 115, 59, 10, 32, 32, 116, 104, 105, 115, 46, 95, 104, 97, 110, 100, 108, 101, 32, 61, 32, 110, 101, 119, 32, 70, 83, 69, 118, 101, 110, 116, 40, 41, 59, 10, 32, 32, 116, 104, 105, 115, 46, 95, 104, 97, 110, 100, 108, 101, 46, 111, 119, 110, 101, 114, 32, 61, 32, 116, 104, 105, 115, 59, 10, 10, 32, 32, 116, 104, 105, 115, 46, 95, 104, 97, 110, 100, 108, 101, 46, 111, 110, 99, 104, 97, 110, 103, 101, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 115, 116, 97, 116, 117, 115, 44, 32, 101, 118, 101, 110, 116, 44, 32, 102, 105, 108, 101, 110, 97, 109, 101, 41, 32, 123, 10, 32, 32, 32, 32, 105, 102, 32, 40, 115, 116, 97, 116, 117, 115, 32, 60, 32, 48, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 115, 101, 108, 102, 46, 95, 104, 97, 110, 100, 108, 101, 46, 99, 108, 111, 115, 101, 40, 41, 59, 10, 32, 32, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 101, 114, 114, 111, 114, 32, 61, 32, 101, 114, 114, 110, 111, 69, 120, 99, 101, 112, 116, 105, 111, 110, 40, 115, 116, 97, 116, 117, 115, 44, 32, 96, 119, 97, 116, 99, 104, 32, 36, 123, 102, 105, 108, 101, 110, 97, 109, 101, 125, 96, 41, 59, 10, 32, 32, 32, 32, 32, 32, 101, 114, 114, 111, 114, 46, 102, 105, 108, 101, 110, 97, 109, 101, 32, 61, 32, 102, 105, 108, 101, 110, 97, 109, 101, 59, 10, 32, 32, 32, 32, 32, 32, 115, 101, 108, 102, 46, 101, 109, 105, 116, 40, 39, 101, 114, 114, 111, 114, 39, 44, 32, 101, 114, 114, 111, 114, 41, 59, 10, 32, 32, 32, 32, 125, 32, 101, 108, 115, 101, 32, 123, 10, 32, 32, 32, 32, 32, 32, 115, 101, 108, 102, 46, 101, 109, 105, 116, 40, 39, 99, 104, 97, 110, 103, 101, 39, 44, 32, 101, 118, 101, 110, 116, 44, 32, 102, 105, 108, 101, 110, 97, 109, 101, 41, 59, 10, 32, 32, 32, 32, 125, 10, 32, 32, 125, 59, 10, 125, 10, 117, 116, 105, 108, 46, 105, 110, 104, 101, 114, 105, 116, 115, 40, 70, 83, 87, 97, 116, 99, 104, 101, 114, 44, 32, 69, 118, 101, 110, 116, 69, 109, 105, 116, 116, 101, 114, 41, 59, 10, 10, 70, 83, 87, 97, 116, 99, 104, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 115, 116, 97, 114, 116, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 102, 105, 108, 101, 110, 97, 109, 101, 44, 32, 112, 101, 114, 115, 105, 115, 116, 101, 110, 116, 44, 32, 114, 101, 99, 117, 114, 115, 105, 118, 101, 41, 32, 123, 10, 32, 32, 110, 117, 108, 108, 67, 104, 101, 99, 107, 40, 102, 105, 108, 101, 110, 97, 109, 101, 41, 59, 10, 32, 32, 118, 97, 114, 32, 101, 114, 114, 32, 61, 32, 116, 104, 105, 115, 46, 95, 104, 97, 110, 100, 108, 101, 46, 115, 116, 97, 114, 116, 40, 112, 97, 116, 104, 77, 111, 100, 117, 108, 101, 46, 95, 109, 97, 107, 101, 76, 111, 110, 103, 40, 102, 105, 108, 101, 110, 97, 109, 101, 41, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 112, 101, 114, 115, 105, 115, 116, 101, 110, 116, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 114, 101, 99, 117, 114, 115, 105, 118, 101, 41, 59, 10, 32, 32, 105, 102, 32, 40, 101, 114, 114, 41, 32, 123, 10, 32, 32, 32, 32, 116, 104, 105, 115, 46, 95, 104, 97, 110, 100, 108, 101, 46, 99, 108, 111, 115, 101, 40, 41, 59, 10, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 101, 114, 114, 111, 114, 32, 61, 32, 101, 114, 114, 110, 111, 69, 120, 99, 101, 112, 116, 105, 111, 110, 40, 101, 114, 114, 44, 32, 96, 119, 97, 116, 99, 104, 32, 36, 123, 102, 105, 108, 101, 110, 97, 109, 101, 125, 96, 41, 59, 10, 32, 32, 32, 32, 101, 114, 114, 111, 114, 46, 102, 105, 108, 101, 110, 97, 109, 101, 32, 61, 32, 102, 105, 108, 101, 110, 97, 109, 101, 59, 10, 32, 32, 32, 32, 116, 104, 114, 111, 119, 32, 101, 114, 114, 111, 114, 59, 10, 32, 32, 125, 10, 125, 59, 10, 10, 70, 83, 87, 97, 116, 99, 104, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 99, 108, 111, 115, 101, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 32, 123, 10, 32, 32, 116, 104, 105, 115, 46, 95, 104, 97, 110, 100, 108, 101, 46, 99, 108, 111, 115, 101, 40, 41, 59, 10, 125, 59, 10, 10, 102, 115, 46, 119, 97, 116, 99, 104, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 102, 105, 108, 101, 110, 97, 109, 101, 41, 32, 123, 10, 32, 32, 110, 117, 108, 108, 67, 104, 101, 99, 107, 40, 102, 105, 108, 101, 110, 97, 109, 101, 41, 59, 10, 32, 32, 118, 97, 114, 32, 119, 97, 116, 99, 104, 101, 114, 59, 10, 32, 32, 118, 97, 114, 32, 111, 112, 116, 105, 111, 110, 115, 59, 10, 32, 32, 118, 97, 114, 32, 108, 105, 115, 116, 101, 110, 101, 114, 59, 10, 10, 32, 32, 105, 102, 32, 40, 97, 114, 103, 117, 109, 101, 110, 116, 115, 91, 49, 93, 32, 33, 61, 61, 32, 110, 117, 108, 108, 32, 38, 38, 32, 116, 121, 112, 101, 111, 102, 32, 97, 114, 103, 117, 109, 101, 110, 116, 115, 91, 49, 93, 32, 61, 61, 61, 32, 39, 111, 98, 106, 101, 99, 116, 39, 41, 32, 123, 10, 32, 32, 32, 32, 111, 112, 116, 105, 111, 110, 115, 32, 61, 32, 97, 114, 103, 117, 109, 101, 110, 116, 115, 91, 49, 93, 59, 10, 32, 32, 32, 32, 108, 105, 115, 116, 101, 110, 101, 114, 32, 61, 32, 97, 114, 103, 117, 109, 101, 110, 116, 115, 91, 50, 93, 59, 10, 32, 32, 125, 32, 101, 108, 115, 101, 32, 123, 10, 32, 32, 32, 32, 111, 112, 116, 105, 111, 110, 115, 32, 61, 32, 123, 125, 59, 10, 32, 32, 32, 32, 108, 105, 115, 116, 101, 110, 101, 114, 32, 61, 32, 97, 114, 103, 117, 109, 101, 110, 116, 115, 91, 49, 93, 59, 10, 32, 32, 125, 10, 10, 32, 32, 105, 102, 32, 40, 111, 112, 116, 105, 111, 110, 115, 46, 112, 101, 114, 115, 105, 115, 116, 101, 110, 116, 32, 61, 61, 61, 32, 117, 110, 100, 101, 102, 105, 110, 101, 100, 41, 32, 111, 112, 116, 105, 111, 110, 115, 46, 112, 101, 114, 115, 105, 115, 116, 101, 110, 116, 32, 61, 32, 116, 114, 117, 101, 59, 10, 32, 32, 105, 102, 32, 40, 111, 112, 116, 105, 111, 110, 115, 46, 114, 101, 99, 117, 114, 115, 105, 118, 101, 32, 61, 61, 61, 32, 117, 110, 100, 101, 102, 105, 110, 101, 100, 41, 32, 111, 112, 116, 105, 111, 110, 115, 46, 114, 101, 99, 117, 114, 115, 105, 118, 101, 32, 61, 32, 102, 97, 108, 115, 101, 59, 10, 10, 32, 32, 119, 97, 116, 99, 104, 101, 114, 32, 61, 32, 110, 101, 119, 32, 70, 83, 87, 97, 116, 99, 104, 101, 114, 40, 41, 59, 10, 32, 32, 119, 97, 116, 99, 104, 101, 114, 46, 115, 116, 97, 114, 116, 40, 102, 105, 108, 101, 110, 97, 109, 101, 44, 32, 111, 112, 116, 105, 111, 110, 115, 46, 112, 101, 114, 115, 105, 115, 116, 101, 110, 116, 44, 32, 111, 112, 116, 105, 111, 110, 115, 46, 114, 101, 99, 117, 114, 115, 105, 118, 101, 41, 59, 10, 10, 32, 32, 105, 102, 32, 40, 108, 105, 115, 116, 101, 110, 101, 114, 41, 32, 123, 10, 32, 32, 32, 32, 119, 97, 116, 99, 104, 101, 114, 46, 97, 100, 100, 76, 105, 115, 116, 101, 110, 101, 114, 40, 39, 99, 104, 97, 110, 103, 101, 39, 44, 32, 108, 105, 115, 116, 101, 110, 101, 114, 41, 59, 10, 32, 32, 125, 10, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 119, 97, 116, 99, 104, 101, 114, 59, 10, 125, 59, 10, 10, 10, 47, 47, 32, 83, 116, 97, 116, 32, 67, 104, 97, 110, 103, 101, 32, 87, 97, 116, 99, 104, 101, 114, 115, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 83, 116, 97, 116, 87, 97, 116, 99, 104, 101, 114, 40, 41, 32, 123, 10, 32, 32, 69, 118, 101, 110, 116, 69, 109, 105, 116, 116, 101, 114, 46, 99, 97, 108, 108, 40, 116, 104, 105, 115, 41, 59, 10, 10, 32, 32, 118, 97, 114, 32, 115, 101, 108, 102, 32, 61, 32, 116, 104, 105, 115, 59, 10, 32, 32, 116, 104, 105, 115, 46, 95, 104, 97, 110, 100, 108, 101, 32, 61, 32, 110, 101, 119, 32, 98, 105, 110, 100, 105, 110, 103, 46, 83, 116, 97, 116, 87, 97, 116, 99, 104, 101, 114, 40, 41, 59, 10, 10, 32, 32, 47, 47, 32, 117, 118, 95, 102, 115, 95, 112, 111, 108, 108, 32, 105, 115, 32, 97, 32, 108, 105, 116, 116, 108, 101, 32, 109, 111, 114, 101, 32, 112, 111, 119, 101, 114, 102, 117, 108, 32, 116, 104, 97, 110, 32, 101, 118, 95, 115, 116, 97, 116, 32, 98, 117, 116, 32, 119, 101, 32, 99, 117, 114, 98, 32, 105, 116, 32, 102, 111, 114, 10, 32, 32, 47, 47, 32, 116, 104, 101, 32, 115, 97, 107, 101, 32, 111, 102, 32, 98, 97, 99, 107, 119, 97, 114, 100, 115, 32, 99, 111, 109, 112, 97, 116, 105, 98, 105, 108, 105, 116, 121, 10, 32, 32, 118, 97, 114, 32, 111, 108, 100, 83, 116, 97, 116, 117, 115, 32, 61, 32, 45, 49, 59, 10, 10, 32, 32, 116, 104, 105, 115, 46, 95, 104, 97, 110, 100, 108, 101, 46, 111, 110, 99, 104, 97, 110, 103, 101, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 99, 117, 114, 114, 101, 110, 116, 44, 32, 112, 114, 101, 118, 105, 111, 117, 115, 44, 32, 110, 101, 119, 83, 116, 97, 116, 117, 115, 41, 32, 123, 10, 32, 32, 32, 32, 105, 102, 32, 40, 111, 108, 100, 83, 116, 97, 116, 117, 115, 32, 61, 61, 61, 32, 45, 49, 32, 38, 38, 10, 32, 32, 32, 32, 32, 32, 32, 32, 110, 101, 119, 83, 116, 97, 116, 117, 115, 32, 61, 61, 61, 32, 45, 49, 32, 38, 38, 10, 32, 32, 32, 32, 32, 32, 32, 32, 99, 117, 114, 114, 101, 110, 116, 46, 110, 108, 105, 110, 107, 32, 61, 61, 61, 32, 112, 114, 101, 118, 105, 111, 117, 115, 46, 110, 108, 105, 110, 107, 41, 32, 114, 101, 116, 117, 114, 110, 59, 10, 10, 32, 32, 32, 32, 111, 108, 100, 83, 116, 97, 116, 117, 115, 32, 61, 32, 110, 101, 119, 83, 116, 97, 116, 117, 115, 59, 10, 32, 32, 32, 32, 115, 101, 108, 102, 46, 101, 109, 105, 116, 40, 39, 99, 104, 97, 110, 103, 101, 39, 44, 32, 99, 117, 114, 114, 101, 110, 116, 44, 32, 112, 114, 101, 118, 105, 111, 117, 115, 41, 59, 10, 32, 32, 125, 59, 10, 10, 32, 32, 116, 104, 105, 115, 46, 95, 104, 97, 110, 100, 108, 101, 46, 111, 110, 115, 116, 111, 112, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 32, 123, 10, 32, 32, 32, 32, 115, 101, 108, 102, 46, 101, 109, 105, 116, 40, 39, 115, 116, 111, 112, 39, 41, 59, 10, 32, 32, 125, 59, 10, 125, 10, 117, 116, 105, 108, 46, 105, 110, 104, 101, 114, 105, 116, 115, 40, 83, 116, 97, 116, 87, 97, 116, 99, 104, 101, 114, 44, 32, 69, 118, 101, 110, 116, 69, 109, 105, 116, 116, 101, 114, 41, 59, 10, 10, 10, 83, 116, 97, 116, 87, 97, 116, 99, 104, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 115, 116, 97, 114, 116, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 102, 105, 108, 101, 110, 97, 109, 101, 44, 32, 112, 101, 114, 115, 105, 115, 116, 101, 110, 116, 44, 32, 105, 110, 116, 101, 114, 118, 97, 108, 41, 32, 123, 10, 32, 32, 110, 117, 108, 108, 67, 104, 101, 99, 107, 40, 102, 105, 108, 101, 110, 97, 109, 101, 41, 59, 10, 32, 32, 116, 104, 105, 115, 46, 95, 104, 97, 110, 100, 108, 101, 46, 115, 116, 97, 114, 116, 40, 112, 97, 116, 104, 77, 111, 100, 117, 108, 101, 46, 95, 109, 97, 107, 101, 76, 111, 110, 103, 40, 102, 105, 108, 101, 110, 97, 109, 101, 41, 44, 32, 112, 101, 114, 115, 105, 115, 116, 101, 110, 116, 44, 32, 105, 110, 116, 101, 114, 118, 97, 108, 41, 59, 10, 125, 59, 10, 10, 10, 83, 116, 97, 116, 87, 97, 116, 99, 104, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 115, 116, 111, 112, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 32, 123, 10, 32, 32, 116, 104, 105, 115, 46, 95, 104, 97, 110, 100, 108, 101, 46, 115, 116, 111, 112, 40, 41, 59, 10, 125, 59, 10, 10, 10, 99, 111, 110, 115, 116, 32, 115, 116, 97, 116, 87, 97, 116, 99, 104, 101, 114, 115, 32, 61, 32, 110, 101, 119, 32, 77, 97, 112, 40, 41, 59, 10, 10, 102, 115, 46, 119, 97, 116, 99, 104, 70, 105, 108, 101, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 102, 105, 108, 101, 110, 97, 109, 101, 44, 32, 111, 112, 116, 105, 111, 110, 115, 44, 32, 108, 105, 115, 116, 101, 110, 101, 114, 41, 32, 123, 10, 32, 32, 110, 117, 108, 108, 67, 104, 101, 99, 107, 40, 102, 105, 108, 101, 110, 97, 109, 101, 41, 59, 10, 32, 32, 102, 105, 108, 101, 110, 97, 109, 101, 32, 61, 32, 112, 97, 116, 104, 77, 111, 100, 117, 108, 101, 46, 114, 101, 115, 111, 108, 118, 101, 40, 102, 105, 108, 101, 110, 97, 109, 101, 41, 59, 10, 32, 32, 118, 97, 114, 32, 115, 116, 97, 116, 59, 10, 10, 32, 32, 118, 97, 114, 32, 100, 101, 102, 97, 117, 108, 116, 115, 32, 61, 32, 123, 10, 32, 32, 32, 32, 47, 47, 32, 80, 111, 108, 108, 32, 105, 110, 116, 101, 114, 118, 97, 108, 32, 105, 110, 32, 109, 105, 108, 108, 105, 115, 101, 99, 111, 110, 100, 115, 46, 32, 53, 48, 48, 55, 32, 105, 115, 32, 119, 104, 97, 116, 32, 108, 105, 98, 101, 118, 32, 117, 115, 101, 100, 32, 116, 111, 32, 117, 115, 101, 46, 32, 73, 116, 39, 115, 10, 32, 32, 32, 32, 47, 47, 32, 97, 32, 108, 105, 116, 116, 108, 101, 32, 111, 110, 32, 116, 104, 101, 32, 115, 108, 111, 119, 32, 115, 105, 100, 101, 32, 98, 117, 116, 32, 108, 101, 116, 39, 115, 32, 115, 116, 105, 99, 107, 32, 119, 105, 116, 104, 32, 105, 116, 32, 102, 111, 114, 32, 110, 111, 119, 32, 116, 111, 32, 107, 101, 101, 112, 10, 32, 32, 32, 32, 47, 47, 32, 98, 101, 104, 97, 118, 105, 111, 114, 97, 108, 32, 99, 104, 97, 110, 103, 101, 115, 32, 116, 111, 32, 97, 32, 109, 105, 110, 105, 109, 117, 109, 46, 10, 32, 32, 32, 32, 105, 110, 116, 101, 114, 118, 97, 108, 58, 32, 53, 48, 48, 55, 44, 10, 32, 32, 32, 32, 112, 101, 114, 115, 105, 115, 116, 101, 110, 116, 58, 32, 116, 114, 117, 101, 10, 32, 32, 125, 59, 10, 10, 32, 32, 105, 102, 32, 40, 111, 112, 116, 105, 111, 110, 115, 32, 33, 61, 61, 32, 110, 117, 108, 108, 32, 38, 38, 32, 116, 121, 112, 101, 111, 102, 32, 111, 112, 116, 105, 111, 110, 115, 32, 61, 61, 61, 32, 39, 111, 98, 106, 101, 99, 116, 39, 41, 32, 123, 10, 32, 32, 32, 32, 111, 112, 116, 105, 111, 110, 115, 32, 61, 32, 117, 116, 105, 108, 46, 95, 101, 120, 116, 101, 110, 100, 40, 100, 101, 102, 97, 117, 108, 116, 115, 44, 32, 111, 112, 116, 105, 111, 110, 115, 41, 59, 10, 32, 32, 125, 32, 101, 108, 115, 101, 32, 123, 10, 32, 32, 32, 32, 108, 105, 115, 116, 101, 110, 101, 114, 32, 61, 32, 111, 112, 116, 105, 111, 110, 115, 59, 10, 32, 32, 32, 32, 111, 112, 116, 105, 111, 110, 115, 32, 61, 32, 100, 101, 102, 97, 117, 108, 116, 115, 59, 10, 32, 32, 125, 10, 10, 32, 32, 105, 102, 32, 40, 116, 121, 112, 101, 111, 102, 32, 108, 105, 115, 116, 101, 110, 101, 114, 32, 33, 61, 61, 32, 39, 102, 117, 110, 99, 116, 105, 111, 110, 39, 41, 32, 123, 10, 32, 32, 32, 32, 116, 104, 114, 111, 119, 32, 110, 101, 119, 32, 69, 114, 114, 111, 114, 40, 39, 119, 97, 116, 99, 104, 70, 105, 108, 101, 32, 114, 101, 113, 117, 105, 114, 101, 115, 32, 97, 32, 108, 105, 115, 116, 101, 110, 101, 114, 32, 102, 117, 110, 99, 116, 105, 111, 110, 39, 41, 59, 10, 32, 32, 125, 10, 10, 32, 32, 115, 116, 97, 116, 32, 61, 32, 115, 116, 97, 116, 87, 97, 116, 99, 104, 101, 114, 115, 46, 103, 101, 116, 40, 102, 105, 108, 101, 110, 97, 109, 101, 41, 59, 10, 10, 32, 32, 105, 102, 32, 40, 115, 116, 97, 116, 32, 61, 61, 61, 32, 117, 110, 100, 101, 102, 105, 110, 101, 100, 41, 32, 123, 10, 32, 32, 32, 32, 115, 116, 97, 116, 32, 61, 32, 110, 101, 119, 32, 83, 116, 97, 116, 87, 97, 116, 99, 104, 101, 114, 40, 41, 59, 10, 32, 32, 32, 32, 115, 116, 97, 116, 46, 115, 116, 97, 114, 116, 40, 102, 105, 108, 101, 110, 97, 109, 101, 44, 32, 111, 112, 116, 105, 111, 110, 115, 46, 112, 101, 114, 115, 105, 115, 116, 101, 110, 116, 44, 32, 111, 112, 116, 105, 111, 110, 115, 46, 105, 110, 116, 101, 114, 118, 97, 108, 41, 59, 10, 32, 32, 32, 32, 115, 116, 97, 116, 87, 97, 116, 99, 104, 101, 114, 115, 46, 115, 101, 116, 40, 102, 105, 108, 101, 110, 97, 109, 101, 44, 32, 115, 116, 97, 116, 41, 59, 10, 32, 32, 125, 10, 10, 32, 32, 115, 116, 97, 116, 46, 97, 100, 100, 76, 105, 115, 116, 101, 110, 101, 114, 40, 39, 99, 104, 97, 110, 103, 101, 39, 44, 32, 108, 105, 115, 116, 101, 110, 101, 114, 41, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 115, 116, 97, 116, 59, 10, 125, 59, 10, 10, 102, 115, 46, 117, 110, 119, 97, 116, 99, 104, 70, 105, 108, 101, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 102, 105, 108, 101, 110, 97, 109, 101, 44, 32, 108, 105, 115, 116, 101, 110, 101, 114, 41, 32, 123, 10, 32, 32, 110, 117, 108, 108, 67, 104, 101, 99, 107, 40, 102, 105, 108, 101, 110, 97, 109, 101, 41, 59, 10, 32, 32, 102, 105, 108, 101, 110, 97, 109, 101, 32, 61, 32, 112, 97, 116, 104, 77, 111, 100, 117, 108, 101, 46, 114, 101, 115, 111, 108, 118, 101, 40, 102, 105, 108, 101, 110, 97, 109, 101, 41, 59, 10, 32, 32, 118, 97, 114, 32, 115, 116, 97, 116, 32, 61, 32, 115, 116, 97, 116, 87, 97, 116, 99, 104, 101, 114, 115, 46, 103, 101, 116, 40, 102, 105, 108, 101, 110, 97, 109, 101, 41, 59, 10, 10, 32, 32, 105, 102, 32, 40, 115, 116, 97, 116, 32, 61, 61, 61, 32, 117, 110, 100, 101, 102, 105, 110, 101, 100, 41, 32, 114, 101, 116, 117, 114, 110, 59, 10, 10, 32, 32, 105, 102, 32, 40, 116, 121, 112, 101, 111, 102, 32, 108, 105, 115, 116, 101, 110, 101, 114, 32, 61, 61, 61, 32, 39, 102, 117, 110, 99, 116, 105, 111, 110, 39, 41, 32, 123, 10, 32, 32, 32, 32, 115, 116, 97, 116, 46, 114, 101, 109, 111, 118, 101, 76, 105, 115, 116, 101, 110, 101, 114, 40, 39, 99, 104, 97, 110, 103, 101, 39, 44, 32, 108, 105, 115, 116, 101, 110, 101, 114, 41, 59, 10, 32, 32, 125, 32, 101, 108, 115, 101, 32, 123, 10, 32, 32, 32, 32, 115, 116, 97, 116, 46, 114, 101, 109, 111, 118, 101, 65, 108, 108, 76, 105, 115, 116, 101, 110, 101, 114, 115, 40, 39, 99, 104, 97, 110, 103, 101, 39, 41, 59, 10, 32, 32, 125, 10, 10, 32, 32, 105, 102, 32, 40, 115, 116, 97, 116, 46, 108, 105, 115, 116, 101, 110, 101, 114, 67, 111, 117, 110, 116, 40, 39, 99, 104, 97, 110, 103, 101, 39, 41, 32, 61, 61, 61, 32, 48, 41, 32, 123, 10, 32, 32, 32, 32, 115, 116, 97, 116, 46, 115, 116, 111, 112, 40, 41, 59, 10, 32, 32, 32, 32, 115, 116, 97, 116, 87, 97, 116, 99, 104, 101, 114, 115, 46, 100, 101, 108, 101, 116, 101, 40, 102, 105, 108, 101, 110, 97, 109, 101, 41, 59, 10, 32, 32, 125, 10, 125, 59, 10, 10, 47, 47, 32, 82, 101, 103, 101, 120, 112, 32, 116, 104, 97, 116, 32, 102, 105, 110, 100, 115, 32, 116, 104, 101, 32, 110, 101, 120, 116, 32, 112, 97, 114, 116, 105, 111, 110, 32, 111, 102, 32, 97, 32, 40, 112, 97, 114, 116, 105, 97, 108, 41, 32, 112, 97, 116, 104, 10, 47, 47, 32, 114, 101, 115, 117, 108, 116, 32, 105, 115, 32, 91, 98, 97, 115, 101, 95, 119, 105, 116, 104, 95, 115, 108, 97, 115, 104, 44, 32, 98, 97, 115, 101, 93, 44, 32, 101, 46, 103, 46, 32, 91, 39, 115, 111, 109, 101, 100, 105, 114, 47, 39, 44, 32, 39, 115, 111, 109, 101, 100, 105, 114, 39, 93, 10, 105, 102, 32, 40, 105, 115, 87, 105, 110, 100, 111, 119, 115, 41, 32, 123, 10, 32, 32, 118, 97, 114, 32, 110, 101, 120, 116, 80, 97, 114, 116, 82, 101, 32, 61, 32, 47, 40, 46, 42, 63, 41, 40, 63, 58, 91, 92, 47, 92, 92, 93, 43, 124, 36, 41, 47, 103, 59, 10, 125, 32, 101, 108, 115, 101, 32, 123, 10, 32, 32, 118, 97, 114, 32, 110, 101, 120, 116, 80, 97, 114, 116, 82, 101, 32, 61, 32, 47, 40, 46, 42, 63, 41, 40, 63, 58, 91, 92, 47, 93, 43, 124, 36, 41, 47, 103, 59, 10, 125, 10, 10, 47, 47, 32, 82, 101, 103, 101, 120, 32, 116, 111, 32, 102, 105, 110, 100, 32, 116, 104, 101, 32, 100, 101, 118, 105, 99, 101, 32, 114, 111, 111, 116, 44, 32, 105, 110, 99, 108, 117, 100, 105, 110, 103, 32, 116, 114, 97, 105, 108, 105, 110, 103, 32, 115, 108, 97, 115, 104, 46, 32, 69, 46, 103, 46, 32, 39, 99, 58, 92, 92, 39, 46, 10, 105, 102, 32, 40, 105, 115, 87, 105, 110, 100, 111, 119, 115, 41, 32, 123, 10, 32, 32, 118, 97, 114, 32, 115, 112, 108, 105, 116, 82, 111, 111, 116, 82, 101, 32, 61, 32, 47, 94, 40, 63, 58, 91, 97, 45, 122, 65, 45, 90, 93, 58, 124, 91, 92, 92, 92, 47, 93, 123, 50, 125, 91, 94, 92, 92, 92, 47, 93, 43, 91, 92, 92, 92, 47, 93, 91, 94, 92, 92, 92, 47, 93, 43, 41, 63, 91, 92, 92, 92, 47, 93, 42, 47, 59, 10, 125, 32, 101, 108, 115, 101, 32, 123, 10, 32, 32, 118, 97, 114, 32, 115, 112, 108, 105, 116, 82, 111, 111, 116, 82, 101, 32, 61, 32, 47, 94, 91, 92, 47, 93, 42, 47, 59, 10, 125, 10, 10, 102, 115, 46, 114, 101, 97, 108, 112, 97, 116, 104, 83, 121, 110, 99, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 32, 114, 101, 97, 108, 112, 97, 116, 104, 83, 121, 110, 99, 40, 112, 44, 32, 99, 97, 99, 104, 101, 41, 32, 123, 10, 32, 32, 47, 47, 32, 109, 97, 107, 101, 32, 112, 32, 105, 115, 32, 97, 98, 115, 111, 108, 117, 116, 101, 10, 32, 32, 112, 32, 61, 32, 112, 97, 116, 104, 77, 111, 100, 117, 108, 101, 46, 114, 101, 115, 111, 108, 118, 101, 40, 112, 41, 59, 10, 10, 32, 32, 105, 102, 32, 40, 99, 97, 99, 104, 101, 32, 38, 38, 32, 79, 98, 106, 101, 99, 116, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 104, 97, 115, 79, 119, 110, 80, 114, 111, 112, 101, 114, 116, 121, 46, 99, 97, 108, 108, 40, 99, 97, 99, 104, 101, 44, 32, 112, 41, 41, 32, 123, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 99, 97, 99, 104, 101, 91, 112, 93, 59, 10, 32, 32, 125, 10, 10, 32, 32, 99, 111, 110, 115, 116, 32, 111, 114, 105, 103, 105, 110, 97, 108, 32, 61, 32, 112, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 115, 101, 101, 110, 76, 105, 110, 107, 115, 32, 61, 32, 123, 125, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 107, 110, 111, 119, 110, 72, 97, 114, 100, 32, 61, 32, 123, 125, 59, 10, 10, 32, 32, 47, 47, 32, 99, 117, 114, 114, 101, 110, 116, 32, 99, 104, 97, 114, 97, 99, 116, 101, 114, 32, 112, 111, 115, 105, 116, 105, 111, 110, 32, 105, 110, 32, 112, 10, 32, 32, 118, 97, 114, 32, 112, 111, 115, 59, 10, 32, 32, 47, 47, 32, 116, 104, 101, 32, 112, 97, 114, 116, 105, 97, 108, 32, 112, 97, 116, 104, 32, 115, 111, 32, 102, 97, 114, 44, 32, 105, 110, 99, 108, 117, 100, 105, 110, 103, 32, 97, 32, 116, 114, 97, 105, 108, 105, 110, 103, 32, 115, 108, 97, 115, 104, 32, 105, 102, 32, 97, 110, 121, 10, 32, 32, 118, 97, 114, 32, 99, 117, 114, 114, 101, 110, 116, 59, 10, 32, 32, 47, 47, 32, 116, 104, 101, 32, 112, 97, 114, 116, 105, 97, 108, 32, 112, 97, 116, 104, 32, 119, 105, 116, 104, 111, 117, 116, 32, 97, 32, 116, 114, 97, 105, 108, 105, 110, 103, 32, 115, 108, 97, 115, 104, 32, 40, 101, 120, 99, 101, 112, 116, 32, 119, 104, 101, 110, 32, 112, 111, 105, 110, 116, 105, 110, 103, 32, 97, 116, 32, 97, 32, 114, 111, 111, 116, 41, 10, 32, 32, 118, 97, 114, 32, 98, 97, 115, 101, 59, 10, 32, 32, 47, 47, 32, 116, 104, 101, 32, 112, 97, 114, 116, 105, 97, 108, 32, 112, 97, 116, 104, 32, 115, 99, 97, 110, 110, 101, 100, 32, 105, 110, 32, 116, 104, 101, 32, 112, 114, 101, 118, 105, 111, 117, 115, 32, 114, 111, 117, 110, 100, 44, 32, 119, 105, 116, 104, 32, 115, 108, 97, 115, 104, 10, 32, 32, 118, 97, 114, 32, 112, 114, 101, 118, 105, 111, 117, 115, 59, 10, 10, 32, 32, 115, 116, 97, 114, 116, 40, 41, 59, 10, 10, 32, 32, 102, 117, 110, 99, 116, 105, 111, 110, 32, 115, 116, 97, 114, 116, 40, 41, 32, 123, 10, 32, 32, 32, 32, 47, 47, 32, 83, 107, 105, 112, 32, 111, 118, 101, 114, 32, 114, 111, 111, 116, 115, 10, 32, 32, 32, 32, 118, 97, 114, 32, 109, 32, 61, 32, 115, 112, 108, 105, 116, 82, 111, 111, 116, 82, 101, 46, 101, 120, 101, 99, 40, 112, 41, 59, 10, 32, 32, 32, 32, 112, 111, 115, 32, 61, 32, 109, 91, 48, 93, 46, 108, 101, 110, 103, 116, 104, 59, 10, 32, 32, 32, 32, 99, 117, 114, 114, 101, 110, 116, 32, 61, 32, 109, 91, 48, 93, 59, 10, 32, 32, 32, 32, 98, 97, 115, 101, 32, 61, 32, 109, 91, 48, 93, 59, 10, 32, 32, 32, 32, 112, 114, 101, 118, 105, 111, 117, 115, 32, 61, 32, 39, 39, 59, 10, 10, 32, 32, 32, 32, 47, 47, 32, 79, 110, 32, 119, 105, 110, 100, 111, 119, 115, 44, 32, 99, 104, 101, 99, 107, 32, 116, 104, 97, 116, 32, 116, 104, 101, 32, 114, 111, 111, 116, 32, 101, 120, 105, 115, 116, 115, 46, 32, 79, 110, 32, 117, 110, 105, 120, 32, 116, 104, 101, 114, 101, 32, 105, 115, 32, 110, 111, 32, 110, 101, 101, 100, 46, 10, 32, 32, 32, 32, 105, 102, 32, 40, 105, 115, 87, 105, 110, 100, 111, 119, 115, 32, 38, 38, 32, 33, 107, 110, 111, 119, 110, 72, 97, 114, 100, 91, 98, 97, 115, 101, 93, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 102, 115, 46, 108, 115, 116, 97, 116, 83, 121, 110, 99, 40, 98, 97, 115, 101, 41, 59, 10, 32, 32, 32, 32, 32, 32, 107, 110, 111, 119, 110, 72, 97, 114, 100, 91, 98, 97, 115, 101, 93, 32, 61, 32, 116, 114, 117, 101, 59, 10, 32, 32, 32, 32, 125, 10, 32, 32, 125, 10, 10, 32, 32, 47, 47, 32, 119, 97, 108, 107, 32, 100, 111, 119, 110, 32, 116, 104, 101, 32, 112, 97, 116, 104, 44, 32, 115, 119, 97, 112, 112, 105, 110, 103, 32, 111, 117, 116, 32, 108, 105, 110, 107, 101, 100, 32, 112, 97, 116, 104, 112, 97, 114, 116, 115, 32, 102, 111, 114, 32, 116, 104, 101, 105, 114, 32, 114, 101, 97, 108, 10, 32, 32, 47, 47, 32, 118, 97, 108, 117, 101, 115, 10, 32, 32, 47, 47, 32, 78, 66, 58, 32, 112, 46, 108, 101, 110, 103, 116, 104, 32, 99, 104, 97, 110, 103, 101, 115, 46, 10, 32, 32, 119, 104, 105, 108, 101, 32, 40, 112, 111, 115, 32, 60, 32, 112, 46, 108, 101, 110, 103, 116, 104, 41, 32, 123, 10, 32, 32, 32, 32, 47, 47, 32, 102, 105, 110, 100, 32, 116, 104, 101, 32, 110, 101, 120, 116, 32, 112, 97, 114, 116, 10, 32, 32, 32, 32, 110, 101, 120, 116, 80, 97, 114, 116, 82, 101, 46, 108, 97, 115, 116, 73, 110, 100, 101, 120, 32, 61, 32, 112, 111, 115, 59, 10, 32, 32, 32, 32, 118, 97, 114, 32, 114, 101, 115, 117, 108, 116, 32, 61, 32, 110, 101, 120, 116, 80, 97, 114, 116, 82, 101, 46, 101, 120, 101, 99, 40, 112, 41, 59, 10, 32, 32, 32, 32, 112, 114, 101, 118, 105, 111, 117, 115, 32, 61, 32, 99, 117, 114, 114, 101, 110, 116, 59, 10, 32, 32, 32, 32, 99, 117, 114, 114, 101, 110, 116, 32, 43, 61, 32, 114, 101, 115, 117, 108, 116, 91, 48, 93, 59, 10, 32, 32, 32, 32, 98, 97, 115, 101, 32, 61, 32, 112, 114, 101, 118, 105, 111, 117, 115, 32, 43, 32, 114, 101, 115, 117, 108, 116, 91, 49, 93, 59, 10, 32, 32, 32, 32, 112, 111, 115, 32, 61, 32, 110, 101, 120, 116, 80, 97, 114, 116, 82, 101, 46, 108, 97, 115, 116, 73, 110, 100, 101, 120, 59, 10, 10, 32, 32, 32, 32, 47, 47, 32, 99, 111, 110, 116, 105, 110, 117, 101, 32, 105, 102, 32, 110, 111, 116, 32, 97, 32, 115, 121, 109, 108, 105, 110, 107, 10, 32, 32, 32, 32, 105, 102, 32, 40, 107, 110, 111, 119, 110, 72, 97, 114, 100, 91, 98, 97, 115, 101, 93, 32, 124, 124, 32, 40, 99, 97, 99, 104, 101, 32, 38, 38, 32, 99, 97, 99, 104, 101, 91, 98, 97, 115, 101, 93, 32, 61, 61, 61, 32, 98, 97, 115, 101, 41, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 99, 111, 110, 116, 105, 110, 117, 101, 59, 10, 32, 32, 32, 32, 125, 10, 10, 32, 32, 32, 32, 118, 97, 114, 32, 114, 101, 115, 111, 108, 118, 101, 100, 76, 105, 110, 107, 59, 10, 32, 32, 32, 32, 105, 102, 32, 40, 99, 97, 99, 104, 101, 32, 38, 38, 32, 79, 98, 106, 101, 99, 116, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 104, 97, 115, 79, 119, 110, 80, 114, 111, 112, 101, 114, 116, 121, 46, 99, 97, 108, 108, 40, 99, 97, 99, 104, 101, 44, 32, 98, 97, 115, 101, 41, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 47, 47, 32, 115, 111, 109, 101, 32, 107, 110, 111, 119, 110, 32, 115, 121, 109, 98, 111, 108, 105, 99, 32, 108, 105, 110, 107, 46, 32, 32, 110, 111, 32, 110, 101, 101, 100, 32, 116, 111, 32, 115, 116, 97, 116, 32, 97, 103, 97, 105, 110, 46, 10, 32, 32, 32, 32, 32, 32, 114, 101, 115, 111, 108, 118, 101, 100, 76, 105, 110, 107, 32, 61, 32, 99, 97, 99, 104, 101, 91, 98, 97, 115, 101, 93, 59, 10, 32, 32, 32, 32, 125, 32, 101, 108, 115, 101, 32, 123, 10, 32, 32, 32, 32, 32, 32, 118, 97, 114, 32, 115, 116, 97, 116, 32, 61, 32, 102, 115, 46, 108, 115, 116, 97, 116, 83, 121, 110, 99, 40, 98, 97, 115, 101, 41, 59, 10, 32, 32, 32, 32, 32, 32, 105, 102, 32, 40, 33, 115, 116, 97, 116, 46, 105, 115, 83, 121, 109, 98, 111, 108, 105, 99, 76, 105, 110, 107, 40, 41, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 107, 110, 111, 119, 110, 72, 97, 114, 100, 91, 98, 97, 115, 101, 93, 32, 61, 32, 116, 114, 117, 101, 59, 10, 32, 32, 32, 32, 32, 32, 32, 32, 105, 102, 32, 40, 99, 97, 99, 104, 101, 41, 32, 99, 97, 99, 104, 101, 91, 98, 97, 115, 101, 93, 32, 61, 32, 98, 97, 115, 101, 59, 10, 32, 32, 32, 32, 32, 32, 32, 32, 99, 111, 110, 116, 105, 110, 117, 101, 59, 10, 32, 32, 32, 32, 32, 32, 125, 10, 10, 32, 32, 32, 32, 32, 32, 47, 47, 32, 114, 101, 97, 100, 32, 116, 104, 101, 32, 108, 105, 110, 107, 32, 105, 102, 32, 105, 116, 32, 119, 97, 115, 110, 39, 116, 32, 114, 101, 97, 100, 32, 98, 101, 102, 111, 114, 101, 10, 32, 32, 32, 32, 32, 32, 47, 47, 32, 100, 101, 118, 47, 105, 110, 111, 32, 97, 108, 119, 97, 121, 115, 32, 114, 101, 116, 117, 114, 110, 32, 48, 32, 111, 110, 32, 119, 105, 110, 100, 111, 119, 115, 44, 32, 115, 111, 32, 115, 107, 105, 112, 32, 116, 104, 101, 32, 99, 104, 101, 99, 107, 46, 10, 32, 32, 32, 32, 32, 32, 118, 97, 114, 32, 108, 105, 110, 107, 84, 97, 114, 103, 101, 116, 32, 61, 32, 110, 117, 108, 108, 59, 10, 32, 32, 32, 32, 32, 32, 105, 102, 32, 40, 33, 105, 115, 87, 105, 110, 100, 111, 119, 115, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 118, 97, 114, 32, 105, 100, 32, 61, 32, 115, 116, 97, 116, 46, 100, 101, 118, 46, 116, 111, 83, 116, 114, 105, 110, 103, 40, 51, 50, 41, 32, 43, 32, 39, 58, 39, 32, 43, 32, 115, 116, 97, 116, 46, 105, 110, 111, 46, 116, 111, 83, 116, 114, 105, 110, 103, 40, 51, 50, 41, 59, 10, 32, 32, 32, 32, 32, 32, 32, 32, 105, 102, 32, 40, 115, 101, 101, 110, 76, 105, 110, 107, 115, 46, 104, 97, 115, 79, 119, 110, 80, 114, 111, 112, 101, 114, 116, 121, 40, 105, 100, 41, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 108, 105, 110, 107, 84, 97, 114, 103, 101, 116, 32, 61, 32, 115, 101, 101, 110, 76, 105, 110, 107, 115, 91, 105, 100, 93, 59, 10, 32, 32, 32, 32, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 32, 32, 105, 102, 32, 40, 108, 105, 110, 107, 84, 97, 114, 103, 101, 116, 32, 61, 61, 61, 32, 110, 117, 108, 108, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 102, 115, 46, 115, 116, 97, 116, 83, 121, 110, 99, 40, 98, 97, 115, 101, 41, 59, 10, 32, 32, 32, 32, 32, 32, 32, 32, 108, 105, 110, 107, 84, 97, 114, 103, 101, 116, 32, 61, 32, 102, 115, 46, 114, 101, 97, 100, 108, 105, 110, 107, 83, 121, 110, 99, 40, 98, 97, 115, 101, 41, 59, 10, 32, 32, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 32, 32, 114, 101, 115, 111, 108, 118, 101, 100, 76, 105, 110, 107, 32, 61, 32, 112, 97, 116, 104, 77, 111, 100, 117, 108, 101, 46, 114, 101, 115, 111, 108, 118, 101, 40, 112, 114, 101, 118, 105, 111, 117, 115, 44, 32, 108, 105, 110, 107, 84, 97, 114, 103, 101, 116, 41, 59, 10, 32, 32, 32, 32, 32, 32, 47, 47, 32, 116, 114, 97, 99, 107, 32, 116, 104, 105, 115, 44, 32, 105, 102, 32, 103, 105, 118, 101, 110, 32, 97, 32, 99, 97, 99, 104, 101, 46, 10, 32, 32, 32, 32, 32, 32, 105, 102, 32, 40, 99, 97, 99, 104, 101, 41, 32, 99, 97, 99, 104, 101, 91, 98, 97, 115, 101, 93, 32, 61, 32, 114, 101, 115, 111, 108, 118, 101, 100, 76, 105, 110, 107, 59, 10, 32, 32, 32, 32, 32, 32, 105, 102, 32, 40, 33, 105, 115, 87, 105, 110, 100, 111, 119, 115, 41, 32, 115, 101, 101, 110, 76, 105, 110, 107, 115, 91, 105, 100, 93, 32, 61, 32, 108, 105, 110, 107, 84, 97, 114, 103, 101, 116, 59, 10, 32, 32, 32, 32, 125, 10, 10, 32, 32, 32, 32, 47, 47, 32, 114, 101, 115, 111, 108, 118, 101, 32, 116, 104, 101, 32, 108, 105, 110, 107, 44, 32, 116, 104, 101, 110, 32, 115, 116, 97, 114, 116, 32, 111, 118, 101, 114, 10, 32, 32, 32, 32, 112, 32, 61, 32, 112, 97, 116, 104, 77, 111, 100, 117, 108, 101, 46, 114, 101, 115, 111, 108, 118, 101, 40, 114, 101, 115, 111, 108, 118, 101, 100, 76, 105, 110, 107, 44, 32, 112, 46, 115, 108, 105, 99, 101, 40, 112, 111, 115, 41, 41, 59, 10, 32, 32, 32, 32, 115, 116, 97, 114, 116, 40, 41, 59, 10, 32, 32, 125, 10, 10, 32, 32, 105, 102, 32, 40, 99, 97, 99, 104, 101, 41, 32, 99, 97, 99, 104, 101, 91, 111, 114, 105, 103, 105, 110, 97, 108, 93, 32, 61, 32, 112, 59, 10, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 112, 59, 10, 125, 59, 10, 10, 10, 102, 115, 46, 114, 101, 97, 108, 112, 97, 116, 104, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 32, 114, 101, 97, 108, 112, 97, 116, 104, 40, 112, 44, 32, 99, 97, 99, 104, 101, 44, 32, 99, 98, 41, 32, 123, 10, 32, 32, 105, 102, 32, 40, 116, 121, 112, 101, 111, 102, 32, 99, 98, 32, 33, 61, 61, 32, 39, 102, 117, 110, 99, 116, 105, 111, 110, 39, 41, 32, 123, 10, 32, 32, 32, 32, 99, 98, 32, 61, 32, 109, 97, 121, 98, 101, 67, 97, 108, 108, 98, 97, 99, 107, 40, 99, 97, 99, 104, 101, 41, 59, 10, 32, 32, 32, 32, 99, 97, 99, 104, 101, 32, 61, 32, 110, 117, 108, 108, 59, 10, 32, 32, 125, 10, 10, 32, 32, 47, 47, 32, 109, 97, 107, 101, 32, 112, 32, 105, 115, 32, 97, 98, 115, 111, 108, 117, 116, 101, 10, 32, 32, 112, 32, 61, 32, 112, 97, 116, 104, 77, 111, 100, 117, 108, 101, 46, 114, 101, 115, 111, 108, 118, 101, 40, 112, 41, 59, 10, 10, 32, 32, 105, 102, 32, 40, 99, 97, 99, 104, 101, 32, 38, 38, 32, 79, 98, 106, 101, 99, 116, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 104, 97, 115, 79, 119, 110, 80, 114, 111, 112, 101, 114, 116, 121, 46, 99, 97, 108, 108, 40, 99, 97, 99, 104, 101, 44, 32, 112, 41, 41, 32, 123, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 112, 114, 111, 99, 101, 115, 115, 46, 110, 101, 120, 116, 84, 105, 99, 107, 40, 99, 98, 46, 98, 105, 110, 100, 40, 110, 117, 108, 108, 44, 32, 110, 117, 108, 108, 44, 32, 99, 97, 99, 104, 101, 91, 112, 93, 41, 41, 59, 10, 32, 32, 125, 10, 10, 32, 32, 99, 111, 110, 115, 116, 32, 111, 114, 105, 103, 105, 110, 97, 108, 32, 61, 32, 112, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 115, 101, 101, 110, 76, 105, 110, 107, 115, 32, 61, 32, 123, 125, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 107, 110, 111, 119, 110, 72, 97, 114, 100, 32, 61, 32, 123, 125, 59, 10, 10, 32, 32, 47, 47, 32, 99, 117, 114, 114, 101, 110, 116, 32, 99, 104, 97, 114, 97, 99, 116, 101, 114, 32, 112, 111, 115, 105, 116, 105, 111, 110, 32, 105, 110, 32, 112, 10, 32, 32, 118, 97, 114, 32, 112, 111, 115, 59, 10, 32, 32, 47, 47, 32, 116, 104, 101, 32, 112, 97, 114, 116, 105, 97, 108, 32, 112, 97, 116, 104, 32, 115, 111, 32, 102, 97, 114, 44, 32, 105, 110, 99, 108, 117, 100, 105, 110, 103, 32, 97, 32, 116, 114, 97, 105, 108, 105, 110, 103, 32, 115, 108, 97, 115, 104, 32, 105, 102, 32, 97, 110, 121, 10, 32, 32, 118, 97, 114, 32, 99, 117, 114, 114, 101, 110, 116, 59, 10, 32, 32, 47, 47, 32, 116, 104, 101, 32, 112, 97, 114, 116, 105, 97, 108, 32, 112, 97, 116, 104, 32, 119, 105, 116, 104, 111, 117, 116, 32, 97, 32, 116, 114, 97, 105, 108, 105, 110, 103, 32, 115, 108, 97, 115, 104, 32, 40, 101, 120, 99, 101, 112, 116, 32, 119, 104, 101, 110, 32, 112, 111, 105, 110, 116, 105, 110, 103, 32, 97, 116, 32, 97, 32, 114, 111, 111, 116, 41, 10, 32, 32, 118, 97, 114, 32, 98, 97, 115, 101, 59, 10, 32, 32, 47, 47, 32, 116, 104, 101, 32, 112, 97, 114, 116, 105, 97, 108, 32, 112, 97, 116, 104, 32, 115, 99, 97, 110, 110, 101, 100, 32, 105, 110, 32, 116, 104, 101, 32, 112, 114, 101, 118, 105, 111, 117, 115, 32, 114, 111, 117, 110, 100, 44, 32, 119, 105, 116, 104, 32, 115, 108, 97, 115, 104, 10, 32, 32, 118, 97, 114, 32, 112, 114, 101, 118, 105, 111, 117, 115, 59, 10, 10, 32, 32, 115, 116, 97, 114, 116, 40, 41, 59, 10, 10, 32, 32, 102, 117, 110, 99, 116, 105, 111, 110, 32, 115, 116, 97, 114, 116, 40, 41, 32, 123, 10, 32, 32, 32, 32, 47, 47, 32, 83, 107, 105, 112, 32, 111, 118, 101, 114, 32, 114, 111, 111, 116, 115, 10, 32, 32, 32, 32, 118, 97, 114, 32, 109, 32, 61, 32, 115, 112, 108, 105, 116, 82, 111, 111, 116, 82, 101, 46, 101, 120, 101, 99, 40, 112, 41, 59, 10, 32, 32, 32, 32, 112, 111, 115, 32, 61, 32, 109, 91, 48, 93, 46, 108, 101, 110, 103, 116, 104, 59, 10, 32, 32, 32, 32, 99, 117, 114, 114, 101, 110, 116, 32, 61, 32, 109, 91, 48, 93, 59, 10, 32, 32, 32, 32, 98, 97, 115, 101, 32, 61, 32, 109, 91, 48, 93, 59, 10, 32, 32, 32, 32, 112, 114, 101, 118, 105, 111, 117, 115, 32, 61, 32, 39, 39, 59, 10, 10, 32, 32, 32, 32, 47, 47, 32, 79, 110, 32, 119, 105, 110, 100, 111, 119, 115, 44, 32, 99, 104, 101, 99, 107, 32, 116, 104, 97, 116, 32, 116, 104, 101, 32, 114, 111, 111, 116, 32, 101, 120, 105, 115, 116, 115, 46, 32, 79, 110, 32, 117, 110, 105, 120, 32, 116, 104, 101, 114, 101, 32, 105, 115, 32, 110, 111, 32, 110, 101, 101, 100, 46, 10, 32, 32, 32, 32, 105, 102, 32, 40, 105, 115, 87, 105, 110, 100, 111, 119, 115, 32, 38, 38, 32, 33, 107, 110, 111, 119, 110, 72, 97, 114, 100, 91, 98, 97, 115, 101, 93, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 102, 115, 46, 108, 115, 116, 97, 116, 40, 98, 97, 115, 101, 44, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 101, 114, 114, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 105, 102, 32, 40, 101, 114, 114, 41, 32, 114, 101, 116, 117, 114, 110, 32, 99, 98, 40, 101, 114, 114, 41, 59, 10, 32, 32, 32, 32, 32, 32, 32, 32, 107, 110, 111, 119, 110, 72, 97, 114, 100, 91, 98, 97, 115, 101, 93, 32, 61, 32, 116, 114, 117, 101, 59, 10, 32, 32, 32, 32, 32, 32, 32, 32, 76, 79, 79, 80, 40, 41, 59, 10, 32, 32, 32, 32, 32, 32, 125, 41, 59, 10, 32, 32, 32, 32, 125, 32, 101, 108, 115, 101, 32, 123, 10, 32, 32, 32, 32, 32, 32, 112, 114, 111, 99, 101, 115, 115, 46, 110, 101, 120, 116, 84, 105, 99, 107, 40, 76, 79, 79, 80, 41, 59, 10, 32, 32, 32, 32, 125, 10, 32, 32, 125, 10, 10, 32, 32, 47, 47, 32, 119, 97, 108, 107, 32, 100, 111, 119, 110, 32, 116, 104, 101, 32, 112, 97, 116, 104, 44, 32, 115, 119, 97, 112, 112, 105, 110, 103, 32, 111, 117, 116, 32, 108, 105, 110, 107, 101, 100, 32, 112, 97, 116, 104, 112, 97, 114, 116, 115, 32, 102, 111, 114, 32, 116, 104, 101, 105, 114, 32, 114, 101, 97, 108, 10, 32, 32, 47, 47, 32, 118, 97, 108, 117, 101, 115, 10, 32, 32, 102, 117, 110, 99, 116, 105, 111, 110, 32, 76, 79, 79, 80, 40, 41, 32, 123, 10, 32, 32, 32, 32, 47, 47, 32, 115, 116, 111, 112, 32, 105, 102, 32, 115, 99, 97, 110, 110, 101, 100, 32, 112, 97, 115, 116, 32, 101, 110, 100, 32, 111, 102, 32, 112, 97, 116, 104, 10, 32, 32, 32, 32, 105, 102, 32, 40, 112, 111, 115, 32, 62, 61, 32, 112, 46, 108, 101, 110, 103, 116, 104, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 105, 102, 32, 40, 99, 97, 99, 104, 101, 41, 32, 99, 97, 99, 104, 101, 91, 111, 114, 105, 103, 105, 110, 97, 108, 93, 32, 61, 32, 112, 59, 10, 32, 32, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 99, 98, 40, 110, 117, 108, 108, 44, 32, 112, 41, 59, 10, 32, 32, 32, 32, 125, 10, 10, 32, 32, 32, 32, 47, 47, 32, 102, 105, 110, 100, 32, 116, 104, 101, 32, 110, 101, 120, 116, 32, 112, 97, 114, 116, 10, 32, 32, 32, 32, 110, 101, 120, 116, 80, 97, 114, 116, 82, 101, 46, 108, 97, 115, 116, 73, 110, 100, 101, 120, 32, 61, 32, 112, 111, 115, 59, 10, 32, 32, 32, 32, 118, 97, 114, 32, 114, 101, 115, 117, 108, 116, 32, 61, 32, 110, 101, 120, 116, 80, 97, 114, 116, 82, 101, 46, 101, 120, 101, 99, 40, 112, 41, 59, 10, 32, 32, 32, 32, 112, 114, 101, 118, 105, 111, 117, 115, 32, 61, 32, 99, 117, 114, 114, 101, 110, 116, 59, 10, 32, 32, 32, 32, 99, 117, 114, 114, 101, 110, 116, 32, 43, 61, 32, 114, 101, 115, 117, 108, 116, 91, 48, 93, 59, 10, 32, 32, 32, 32, 98, 97, 115, 101, 32, 61, 32, 112, 114, 101, 118, 105, 111, 117, 115, 32, 43, 32, 114, 101, 115, 117, 108, 116, 91, 49, 93, 59, 10, 32, 32, 32, 32, 112, 111, 115, 32, 61, 32, 110, 101, 120, 116, 80, 97, 114, 116, 82, 101, 46, 108, 97, 115, 116, 73, 110, 100, 101, 120, 59, 10, 10, 32, 32, 32, 32, 47, 47, 32, 99, 111, 110, 116, 105, 110, 117, 101, 32, 105, 102, 32, 110, 111, 116, 32, 97, 32, 115, 121, 109, 108, 105, 110, 107, 10, 32, 32, 32, 32, 105, 102, 32, 40, 107, 110, 111, 119, 110, 72, 97, 114, 100, 91, 98, 97, 115, 101, 93, 32, 124, 124, 32, 40, 99, 97, 99, 104, 101, 32, 38, 38, 32, 99, 97, 99, 104, 101, 91, 98, 97, 115, 101, 93, 32, 61, 61, 61, 32, 98, 97, 115, 101, 41, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 112, 114, 111, 99, 101, 115, 115, 46, 110, 101, 120, 116, 84, 105, 99, 107, 40, 76, 79, 79, 80, 41, 59, 10, 32, 32, 32, 32, 125, 10, 10, 32, 32, 32, 32, 105, 102, 32, 40, 99, 97, 99, 104, 101, 32, 38, 38, 32, 79, 98, 106, 101, 99, 116, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 104, 97, 115, 79, 119, 110, 80, 114, 111, 112, 101, 114, 116, 121, 46, 99, 97, 108, 108, 40, 99, 97, 99, 104, 101, 44, 32, 98, 97, 115, 101, 41, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 47, 47, 32, 107, 110, 111, 119, 110, 32, 115, 121, 109, 98, 111, 108, 105, 99, 32, 108, 105, 110, 107, 46, 32, 32, 110, 111, 32, 110, 101, 101, 100, 32, 116, 111, 32, 115, 116, 97, 116, 32, 97, 103, 97, 105, 110, 46, 10, 32, 32, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 103, 111, 116, 82, 101, 115, 111, 108, 118, 101, 100, 76, 105, 110, 107, 40, 99, 97, 99, 104, 101, 91, 98, 97, 115, 101, 93, 41, 59, 10, 32, 32, 32, 32, 125, 10, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 102, 115, 46, 108, 115, 116, 97, 116, 40, 98, 97, 115, 101, 44, 32, 103, 111, 116, 83, 116, 97, 116, 41, 59, 10, 32, 32, 125, 10, 10, 32, 32, 102, 117, 110, 99, 116, 105, 111, 110, 32, 103, 111, 116, 83, 116, 97, 116, 40, 101, 114, 114, 44, 32, 115, 116, 97, 116, 41, 32, 123, 10, 32, 32, 32, 32, 105, 102, 32, 40, 101, 114, 114, 41, 32, 114, 101, 116, 117, 114, 110, 32, 99, 98, 40, 101, 114, 114, 41, 59, 10, 10, 32, 32, 32, 32, 47, 47, 32, 105, 102, 32, 110, 111, 116, 32, 97, 32, 115, 121, 109, 108, 105, 110, 107, 44, 32, 115, 107, 105, 112, 32, 116, 111, 32, 116, 104, 101, 32, 110, 101, 120, 116, 32, 112, 97, 116, 104, 32, 112, 97, 114, 116, 10, 32, 32, 32, 32, 105, 102, 32, 40, 33, 115, 116, 97, 116, 46, 105, 115, 83, 121, 109, 98, 111, 108, 105, 99, 76, 105, 110, 107, 40, 41, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 107, 110, 111, 119, 110, 72, 97, 114, 100, 91, 98, 97, 115, 101, 93, 32, 61, 32, 116, 114, 117, 101, 59, 10, 32, 32, 32, 32, 32, 32, 105, 102, 32, 40, 99, 97, 99, 104, 101, 41, 32, 99, 97, 99, 104, 101, 91, 98, 97, 115, 101, 93, 32, 61, 32, 98, 97, 115, 101, 59, 10, 32, 32, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 112, 114, 111, 99, 101, 115, 115, 46, 110, 101, 120, 116, 84, 105, 99, 107, 40, 76, 79, 79, 80, 41, 59, 10, 32, 32, 32, 32, 125, 10, 10, 32, 32, 32, 32, 47, 47, 32, 115, 116, 97, 116, 32, 38, 32, 114, 101, 97, 100, 32, 116, 104, 101, 32, 108, 105, 110, 107, 32, 105, 102, 32, 110, 111, 116, 32, 114, 101, 97, 100, 32, 98, 101, 102, 111, 114, 101, 10, 32, 32, 32, 32, 47, 47, 32, 99, 97, 108, 108, 32, 103, 111, 116, 84, 97, 114, 103, 101, 116, 32, 97, 115, 32, 115, 111, 111, 110, 32, 97, 115, 32, 116, 104, 101, 32, 108, 105, 110, 107, 32, 116, 97, 114, 103, 101, 116, 32, 105, 115, 32, 107, 110, 111, 119, 110, 10, 32, 32, 32, 32, 47, 47, 32, 100, 101, 118, 47, 105, 110, 111, 32, 97, 108, 119, 97, 121, 115, 32, 114, 101, 116, 117, 114, 110, 32, 48, 32, 111, 110, 32, 119, 105, 110, 100, 111, 119, 115, 44, 32, 115, 111, 32, 115, 107, 105, 112, 32, 116, 104, 101, 32, 99, 104, 101, 99, 107, 46, 10, 32, 32, 32, 32, 105, 102, 32, 40, 33, 105, 115, 87, 105, 110, 100, 111, 119, 115, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 118, 97, 114, 32, 105, 100, 32, 61, 32, 115, 116, 97, 116, 46, 100, 101, 118, 46, 116, 111, 83, 116, 114, 105, 110, 103, 40, 51, 50, 41, 32, 43, 32, 39, 58, 39, 32, 43, 32, 115, 116, 97, 116, 46, 105, 110, 111, 46, 116, 111, 83, 116, 114, 105, 110, 103, 40, 51, 50, 41, 59, 10, 32, 32, 32, 32, 32, 32, 105, 102, 32, 40, 115, 101, 101, 110, 76, 105, 110, 107, 115, 46, 104, 97, 115, 79, 119, 110, 80, 114, 111, 112, 101, 114, 116, 121, 40, 105, 100, 41, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 103, 111, 116, 84, 97, 114, 103, 101, 116, 40, 110, 117, 108, 108, 44, 32, 115, 101, 101, 110, 76, 105, 110, 107, 115, 91, 105, 100, 93, 44, 32, 98, 97, 115, 101, 41, 59, 10, 32, 32, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 102, 115, 46, 115, 116, 97, 116, 40, 98, 97, 115, 101, 44, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 101, 114, 114, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 105, 102, 32, 40, 101, 114, 114, 41, 32, 114, 101, 116, 117, 114, 110, 32, 99, 98, 40, 101, 114, 114, 41, 59, 10, 10, 32, 32, 32, 32, 32, 32, 102, 115, 46, 114, 101, 97, 100, 108, 105, 110, 107, 40, 98, 97, 115, 101, 44, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 101, 114, 114, 44, 32, 116, 97, 114, 103, 101, 116, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 105, 102, 32, 40, 33, 105, 115, 87, 105, 110, 100, 111, 119, 115, 41, 32, 115, 101, 101, 110, 76, 105, 110, 107, 115, 91, 105, 100, 93, 32, 61, 32, 116, 97, 114, 103, 101, 116, 59, 10, 32, 32, 32, 32, 32, 32, 32, 32, 103, 111, 116, 84, 97, 114, 103, 101, 116, 40, 101, 114, 114, 44, 32, 116, 97, 114, 103, 101, 116, 41, 59, 10, 32, 32, 32, 32, 32, 32, 125, 41, 59, 10, 32, 32, 32, 32, 125, 41, 59, 10, 32, 32, 125, 10, 10, 32, 32, 102, 117, 110, 99, 116, 105, 111, 110, 32, 103, 111, 116, 84, 97, 114, 103, 101, 116, 40, 101, 114, 114, 44, 32, 116, 97, 114, 103, 101, 116, 44, 32, 98, 97, 115, 101, 41, 32, 123, 10, 32, 32, 32, 32, 105, 102, 32, 40, 101, 114, 114, 41, 32, 114, 101, 116, 117, 114, 110, 32, 99, 98, 40, 101, 114, 114, 41, 59, 10, 10, 32, 32, 32, 32, 118, 97, 114, 32, 114, 101, 115, 111, 108, 118, 101, 100, 76, 105, 110, 107, 32, 61, 32, 112, 97, 116, 104, 77, 111, 100, 117, 108, 101, 46, 114, 101, 115, 111, 108, 118, 101, 40, 112, 114, 101, 118, 105, 111, 117, 115, 44, 32, 116, 97, 114, 103, 101, 116, 41, 59, 10, 32, 32, 32, 32, 105, 102, 32, 40, 99, 97, 99, 104, 101, 41, 32, 99, 97, 99, 104, 101, 91, 98, 97, 115, 101, 93, 32, 61, 32, 114, 101, 115, 111, 108, 118, 101, 100, 76, 105, 110, 107, 59, 10, 32, 32, 32, 32, 103, 111, 116, 82, 101, 115, 111, 108, 118, 101, 100, 76, 105, 110, 107, 40, 114, 101, 115, 111, 108, 118, 101, 100, 76, 105, 110, 107, 41, 59, 10, 32, 32, 125, 10, 10, 32, 32, 102, 117, 110, 99, 116, 105, 111, 110, 32, 103, 111, 116, 82, 101, 115, 111, 108, 118, 101, 100, 76, 105, 110, 107, 40, 114, 101, 115, 111, 108, 118, 101, 100, 76, 105, 110, 107, 41, 32, 123, 10, 32, 32, 32, 32, 47, 47, 32, 114, 101, 115, 111, 108, 118, 101, 32, 116, 104, 101, 32, 108, 105, 110, 107, 44, 32, 116, 104, 101, 110, 32, 115, 116, 97, 114, 116, 32, 111, 118, 101, 114, 10, 32, 32, 32, 32, 112, 32, 61, 32, 112, 97, 116, 104, 77, 111, 100, 117, 108, 101, 46, 114, 101, 115, 111, 108, 118, 101, 40, 114, 101, 115, 111, 108, 118, 101, 100, 76, 105, 110, 107, 44, 32, 112, 46, 115, 108, 105, 99, 101, 40, 112, 111, 115, 41, 41, 59, 10, 32, 32, 32, 32, 115, 116, 97, 114, 116, 40, 41, 59, 10, 32, 32, 125, 10, 125, 59, 10, 10, 10, 118, 97, 114, 32, 112, 111, 111, 108, 59, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 97, 108, 108, 111, 99, 78, 101, 119, 80, 111, 111, 108, 40, 112, 111, 111, 108, 83, 105, 122, 101, 41, 32, 123, 10, 32, 32, 112, 111, 111, 108, 32, 61, 32, 110, 101, 119, 32, 66, 117, 102, 102, 101, 114, 40, 112, 111, 111, 108, 83, 105, 122, 101, 41, 59, 10, 32, 32, 112, 111, 111, 108, 46, 117, 115, 101, 100, 32, 61, 32, 48, 59, 10, 125, 10, 10, 10, 102, 115, 46, 99, 114, 101, 97, 116, 101, 82, 101, 97, 100, 83, 116, 114, 101, 97, 109, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 112, 97, 116, 104, 44, 32, 111, 112, 116, 105, 111, 110, 115, 41, 32, 123, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 110, 101, 119, 32, 82, 101, 97, 100, 83, 116, 114, 101, 97, 109, 40, 112, 97, 116, 104, 44, 32, 111, 112, 116, 105, 111, 110, 115, 41, 59, 10, 125, 59, 10, 10, 47, 47, 117, 116, 105, 108, 46, 105, 110, 104, 101, 114, 105, 116, 115, 40, 82, 101, 97, 100, 83, 116, 114, 101, 97, 109, 44, 32, 82, 101, 97, 100, 97, 98, 108, 101, 41, 59, 10, 47, 47, 102, 115, 46, 82, 101, 97, 100, 83, 116, 114, 101, 97, 109, 32, 61, 32, 82, 101, 97, 100, 83, 116, 114, 101, 97, 109, 59, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 82, 101, 97, 100, 83, 116, 114, 101, 97, 109, 40, 112, 97, 116, 104, 44, 32, 111, 112, 116, 105, 111, 110, 115, 41, 32, 123, 10, 32, 32, 105, 102, 32, 40, 33, 40, 116, 104, 105, 115, 32, 105, 110, 115, 116, 97, 110, 99, 101, 111, 102, 32, 82, 101, 97, 100, 83, 116, 114, 101, 97, 109, 41, 41, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 110, 101, 119, 32, 82, 101, 97, 100, 83, 116, 114, 101, 97, 109, 40, 112, 97, 116, 104, 44, 32, 111, 112, 116, 105, 111, 110, 115, 41, 59, 10, 10, 32, 32, 105, 102, 32, 40, 111, 112, 116, 105, 111, 110, 115, 32, 61, 61, 61, 32, 117, 110, 100, 101, 102, 105, 110, 101, 100, 41, 10, 32, 32, 32, 32, 111, 112, 116, 105, 111, 110, 115, 32, 61, 32, 123, 125, 59, 10, 32, 32, 101, 108, 115, 101, 32, 105, 102, 32, 40, 116, 121, 112, 101, 111, 102, 32, 111, 112, 116, 105, 111, 110, 115, 32, 61, 61, 61, 32, 39, 115, 116, 114, 105, 110, 103, 39, 41, 10, 32, 32, 32, 32, 111, 112, 116, 105, 111, 110, 115, 32, 61, 32, 123, 32, 101, 110, 99, 111, 100, 105, 110, 103, 58, 32, 111, 112, 116, 105, 111, 110, 115, 32, 125, 59, 10, 32, 32, 101, 108, 115, 101, 32, 105, 102, 32, 40, 111, 112, 116, 105, 111, 110, 115, 32, 61, 61, 61, 32, 110, 117, 108, 108, 32, 124, 124, 32, 116, 121, 112, 101, 111, 102, 32, 111, 112, 116, 105, 111, 110, 115, 32, 33, 61, 61, 32, 39, 111, 98, 106, 101, 99, 116, 39, 41, 10, 32, 32, 32, 32, 116, 104, 114, 111, 119, 32, 110, 101, 119, 32, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 111, 112, 116, 105, 111, 110, 115, 32, 109, 117, 115, 116, 32, 98, 101, 32, 97, 32, 115, 116, 114, 105, 110, 103, 32, 111, 114, 32, 97, 110, 32, 111, 98, 106, 101, 99, 116, 39, 41, 59, 10, 10, 32, 32, 47, 47, 32, 97, 32, 108, 105, 116, 116, 108, 101, 32, 98, 105, 116, 32, 98, 105, 103, 103, 101, 114, 32, 98, 117, 102, 102, 101, 114, 32, 97, 110, 100, 32, 119, 97, 116, 101, 114, 32, 109, 97, 114, 107, 115, 32, 98, 121, 32, 100, 101, 102, 97, 117, 108, 116, 10, 32, 32, 111, 112, 116, 105, 111, 110, 115, 32, 61, 32, 79, 98, 106, 101, 99, 116, 46, 99, 114, 101, 97, 116, 101, 40, 111, 112, 116, 105, 111, 110, 115, 41, 59, 10, 32, 32, 105, 102, 32, 40, 111, 112, 116, 105, 111, 110, 115, 46, 104, 105, 103, 104, 87, 97, 116, 101, 114, 77, 97, 114, 107, 32, 61, 61, 61, 32, 117, 110, 100, 101, 102, 105, 110, 101, 100, 41, 10, 32, 32, 32, 32, 111, 112, 116, 105, 111, 110, 115, 46, 104, 105, 103, 104, 87, 97, 116, 101, 114, 77, 97, 114, 107, 32, 61, 32, 54, 52, 32, 42, 32, 49, 48, 50, 52, 59, 10, 10, 32, 32, 82, 101, 97, 100, 97, 98, 108, 101, 46, 99, 97, 108, 108, 40, 116, 104, 105, 115, 44, 32, 111, 112, 116, 105, 111, 110, 115, 41, 59, 10, 10, 32, 32, 116, 104, 105, 115, 46, 112, 97, 116, 104, 32, 61, 32, 112, 97, 116, 104, 59, 10, 32, 32, 116, 104, 105, 115, 46, 102, 100, 32, 61, 32, 111, 112, 116, 105, 111, 110, 115, 46, 102, 100, 32, 61, 61, 61, 32, 117, 110, 100, 101, 102, 105, 110, 101, 100, 32, 63, 32, 110, 117, 108, 108, 32, 58, 32, 111, 112, 116, 105, 111, 110, 115, 46, 102, 100, 59, 10, 32, 32, 116, 104, 105, 115, 46, 102, 108, 97, 103, 115, 32, 61, 32, 111, 112, 116, 105, 111, 110, 115, 46, 102, 108, 97, 103, 115, 32, 61, 61, 61, 32, 117, 110, 100, 101, 102, 105, 110, 101, 100, 32, 63, 32, 39, 114, 39, 32, 58, 32, 111, 112, 116, 105, 111, 110, 115, 46, 102, 108, 97, 103, 115, 59, 10, 32, 32, 116, 104, 105, 115, 46, 109, 111, 100, 101, 32, 61, 32, 111, 112, 116, 105, 111, 110, 115, 46, 109, 111, 100, 101, 32, 61, 61, 61, 32, 117, 110, 100, 101, 102, 105, 110, 101, 100, 32, 63, 32, 48, 111, 54, 54, 54, 32, 58, 32, 111, 112, 116, 105, 111, 110, 115, 46, 109, 111, 100, 101, 59, 10, 10, 32, 32, 116, 104, 105, 115, 46, 115, 116, 97, 114, 116, 32, 61, 32, 111, 112, 116, 105, 111, 110, 115, 46, 115, 116, 97, 114, 116, 59, 10, 32, 32, 116, 104, 105, 115, 46, 101, 110, 100, 32, 61, 32, 111, 112, 116, 105, 111, 110, 115, 46, 101, 110, 100, 59, 10, 32, 32, 116, 104, 105, 115, 46, 97, 117, 116, 111, 67, 108, 111, 115, 101, 32, 61, 32, 111, 112, 116, 105, 111, 110, 115, 46, 97, 117, 116, 111, 67, 108, 111, 115, 101, 32, 61, 61, 61, 32, 117, 110, 100, 101, 102, 105, 110, 101, 100, 32, 63, 32, 116, 114, 117, 101, 32, 58, 32, 111, 112, 116, 105, 111, 110, 115, 46, 97, 117, 116, 111, 67, 108, 111, 115, 101, 59, 10, 32, 32, 116, 104, 105, 115, 46, 112, 111, 115, 32, 61, 32, 117, 110, 100, 101, 102, 105, 110, 101, 100, 59, 10, 10, 32, 32, 105, 102, 32, 40, 116, 104, 105, 115, 46, 115, 116, 97, 114, 116, 32, 33, 61, 61, 32, 117, 110, 100, 101, 102, 105, 110, 101, 100, 41, 32, 123, 10, 32, 32, 32, 32, 105, 102, 32, 40, 116, 121, 112, 101, 111, 102, 32, 116, 104, 105, 115, 46, 115, 116, 97, 114, 116, 32, 33, 61, 61, 32, 39, 110, 117, 109, 98, 101, 114, 39, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 116, 104, 114, 111, 119, 32, 110, 101, 119, 32, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 115, 116, 97, 114, 116, 32, 109, 117, 115, 116, 32, 98, 101, 32, 97, 32, 78, 117, 109, 98, 101, 114, 39, 41, 59, 10, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 105, 102, 32, 40, 116, 104, 105, 115, 46, 101, 110, 100, 32, 61, 61, 61, 32, 117, 110, 100, 101, 102, 105, 110, 101, 100, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 116, 104, 105, 115, 46, 101, 110, 100, 32, 61, 32, 73, 110, 102, 105, 110, 105, 116, 121, 59, 10, 32, 32, 32, 32, 125, 32, 101, 108, 115, 101, 32, 105, 102, 32, 40, 116, 121, 112, 101, 111, 102, 32, 116, 104, 105, 115, 46, 101, 110, 100, 32, 33, 61, 61, 32, 39, 110, 117, 109, 98, 101, 114, 39, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 116, 104, 114, 111, 119, 32, 110, 101, 119, 32, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 101, 110, 100, 32, 109, 117, 115, 116, 32, 98, 101, 32, 97, 32, 78, 117, 109, 98, 101, 114, 39, 41, 59, 10, 32, 32, 32, 32, 125, 10, 10, 32, 32, 32, 32, 105, 102, 32, 40, 116, 104, 105, 115, 46, 115, 116, 97, 114, 116, 32, 62, 32, 116, 104, 105, 115, 46, 101, 110, 100, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 116, 104, 114, 111, 119, 32, 110, 101, 119, 32, 69, 114, 114, 111, 114, 40, 39, 115, 116, 97, 114, 116, 32, 109, 117, 115, 116, 32, 98, 101, 32, 60, 61, 32, 101, 110, 100, 39, 41, 59, 10, 32, 32, 32, 32, 125, 10, 10, 32, 32, 32, 32, 116, 104, 105, 115, 46, 112, 111, 115, 32, 61, 32, 116, 104, 105, 115, 46, 115, 116, 97, 114, 116, 59, 10, 32, 32, 125, 10, 10, 32, 32, 105, 102, 32, 40, 116, 121, 112, 101, 111, 102, 32, 116, 104, 105, 115, 46, 102, 100, 32, 33, 61, 61, 32, 39, 110, 117, 109, 98, 101, 114, 39, 41, 10, 32, 32, 32, 32, 116, 104, 105, 115, 46, 111, 112, 101, 110, 40, 41, 59, 10, 10, 32, 32, 116, 104, 105, 115, 46, 111, 110, 40, 39, 101, 110, 100, 39, 44, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 32, 123, 10, 32, 32, 32, 32, 105, 102, 32, 40, 116, 104, 105, 115, 46, 97, 117, 116, 111, 67, 108, 111, 115, 101, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 116, 104, 105, 115, 46, 100, 101, 115, 116, 114, 111, 121, 40, 41, 59, 10, 32, 32, 32, 32, 125, 10, 32, 32, 125, 41, 59, 10, 125, 10, 10, 102, 115, 46, 70, 105, 108, 101, 82, 101, 97, 100, 83, 116, 114, 101, 97, 109, 32, 61, 32, 102, 115, 46, 82, 101, 97, 100, 83, 116, 114, 101, 97, 109, 59, 32, 47, 47, 32, 115, 117, 112, 112, 111, 114, 116, 32, 116, 104, 101, 32, 108, 101, 103, 97, 99, 121, 32, 110, 97, 109, 101, 10, 10, 82, 101, 97, 100, 83, 116, 114, 101, 97, 109, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 111, 112, 101, 110, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 32, 123, 10, 32, 32, 118, 97, 114, 32, 115, 101, 108, 102, 32, 61, 32, 116, 104, 105, 115, 59, 10, 32, 32, 102, 115, 46, 111, 112, 101, 110, 40, 116, 104, 105, 115, 46, 112, 97, 116, 104, 44, 32, 116, 104, 105, 115, 46, 102, 108, 97, 103, 115, 44, 32, 116, 104, 105, 115, 46, 109, 111, 100, 101, 44, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 101, 114, 44, 32, 102, 100, 41, 32, 123, 10, 32, 32, 32, 32, 105, 102, 32, 40, 101, 114, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 105, 102, 32, 40, 115, 101, 108, 102, 46, 97, 117, 116, 111, 67, 108, 111, 115, 101, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 115, 101, 108, 102, 46, 100, 101, 115, 116, 114, 111, 121, 40, 41, 59, 10, 32, 32, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 32, 32, 115, 101, 108, 102, 46, 101, 109, 105, 116, 40, 39, 101, 114, 114, 111, 114, 39, 44, 32, 101, 114, 41, 59, 10, 32, 32, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 59, 10, 32, 32, 32, 32, 125, 10, 10, 32, 32, 32, 32, 115, 101, 108, 102, 46, 102, 100, 32, 61, 32, 102, 100, 59, 10, 32, 32, 32, 32, 115, 101, 108, 102, 46, 101, 109, 105, 116, 40, 39, 111, 112, 101, 110, 39, 44, 32, 102, 100, 41, 59, 10, 32, 32, 32, 32, 47, 47, 32, 115, 116, 97, 114, 116, 32, 116, 104, 101, 32, 102, 108, 111, 119, 32, 111, 102, 32, 100, 97, 116, 97, 46, 10, 32, 32, 32, 32, 115, 101, 108, 102, 46, 114, 101, 97, 100, 40, 41, 59, 10, 32, 32, 125, 41, 59, 10, 125, 59, 10, 10, 82, 101, 97, 100, 83, 116, 114, 101, 97, 109, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 95, 114, 101, 97, 100, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 110, 41, 32, 123, 10, 32, 32, 105, 102, 32, 40, 116, 121, 112, 101, 111, 102, 32, 116, 104, 105, 115, 46, 102, 100, 32, 33, 61, 61, 32, 39, 110, 117, 109, 98, 101, 114, 39, 41, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 46, 111, 110, 99, 101, 40, 39, 111, 112, 101, 110, 39, 44, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 116, 104, 105, 115, 46, 95, 114, 101, 97, 100, 40, 110, 41, 59, 10, 32, 32, 32, 32, 125, 41, 59, 10, 10, 32, 32, 105, 102, 32, 40, 116, 104, 105, 115, 46, 100, 101, 115, 116, 114, 111, 121, 101, 100, 41, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 59, 10, 10, 32, 32, 105, 102, 32, 40, 33, 112, 111, 111, 108, 32, 124, 124, 32, 112, 111, 111, 108, 46, 108, 101, 110, 103, 116, 104, 32, 45, 32, 112, 111, 111, 108, 46, 117, 115, 101, 100, 32, 60, 32, 107, 77, 105, 110, 80, 111, 111, 108, 83, 112, 97, 99, 101, 41, 32, 123, 10, 32, 32, 32, 32, 47, 47, 32, 100, 105, 115, 99, 97, 114, 100, 32, 116, 104, 101, 32, 111, 108, 100, 32, 112, 111, 111, 108, 46, 10, 32, 32, 32, 32, 112, 111, 111, 108, 32, 61, 32, 110, 117, 108, 108, 59, 10, 32, 32, 32, 32, 97, 108, 108, 111, 99, 78, 101, 119, 80, 111, 111, 108, 40, 116, 104, 105, 115, 46, 95, 114, 101, 97, 100, 97, 98, 108, 101, 83, 116, 97, 116, 101, 46, 104, 105, 103, 104, 87, 97, 116, 101, 114, 77, 97, 114, 107, 41, 59, 10, 32, 32, 125, 10, 10, 32, 32, 47, 47, 32, 71, 114, 97, 98, 32, 97, 110, 111, 116, 104, 101, 114, 32, 114, 101, 102, 101, 114, 101, 110, 99, 101, 32, 116, 111, 32, 116, 104, 101, 32, 112, 111, 111, 108, 32, 105, 110, 32, 116, 104, 101, 32, 99, 97, 115, 101, 32, 116, 104, 97, 116, 32, 119, 104, 105, 108, 101, 32, 119, 101, 39, 114, 101, 10, 32, 32, 47, 47, 32, 105, 110, 32, 116, 104, 101, 32, 116, 104, 114, 101, 97, 100, 32, 112, 111, 111, 108, 32, 97, 110, 111, 116, 104, 101, 114, 32, 114, 101, 97, 100, 40, 41, 32, 102, 105, 110, 105, 115, 104, 101, 115, 32, 117, 112, 32, 116, 104, 101, 32, 112, 111, 111, 108, 44, 32, 97, 110, 100, 10, 32, 32, 47, 47, 32, 97, 108, 108, 111, 99, 97, 116, 101, 115, 32, 97, 32, 110, 101, 119, 32, 111, 110, 101, 46, 10, 32, 32, 118, 97, 114, 32, 116, 104, 105, 115, 80, 111, 111, 108, 32, 61, 32, 112, 111, 111, 108, 59, 10, 32, 32, 118, 97, 114, 32, 116, 111, 82, 101, 97, 100, 32, 61, 32, 77, 97, 116, 104, 46, 109, 105, 110, 40, 112, 111, 111, 108, 46, 108, 101, 110, 103, 116, 104, 32, 45, 32, 112, 111, 111, 108, 46, 117, 115, 101, 100, 44, 32, 110, 41, 59, 10, 32, 32, 118, 97, 114, 32, 115, 116, 97, 114, 116, 32, 61, 32, 112, 111, 111, 108, 46, 117, 115, 101, 100, 59, 10, 10, 32, 32, 105, 102, 32, 40, 116, 104, 105, 115, 46, 112, 111, 115, 32, 33, 61, 61, 32, 117, 110, 100, 101, 102, 105, 110, 101, 100, 41, 10, 32, 32, 32, 32, 116, 111, 82, 101, 97, 100, 32, 61, 32, 77, 97, 116, 104, 46, 109, 105, 110, 40, 116, 104, 105, 115, 46, 101, 110, 100, 32, 45, 32, 116, 104, 105, 115, 46, 112, 111, 115, 32, 43, 32, 49, 44, 32, 116, 111, 82, 101, 97, 100, 41, 59, 10, 10, 32, 32, 47, 47, 32, 97, 108, 114, 101, 97, 100, 121, 32, 114, 101, 97, 100, 32, 101, 118, 101, 114, 121, 116, 104, 105, 110, 103, 32, 119, 101, 32, 119, 101, 114, 101, 32, 115, 117, 112, 112, 111, 115, 101, 100, 32, 116, 111, 32, 114, 101, 97, 100, 33, 10, 32, 32, 47, 47, 32, 116, 114, 101, 97, 116, 32, 97, 115, 32, 69, 79, 70, 46, 10, 32, 32, 105, 102, 32, 40, 116, 111, 82, 101, 97, 100, 32, 60, 61, 32, 48, 41, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 46, 112, 117, 115, 104, 40, 110, 117, 108, 108, 41, 59, 10, 10, 32, 32, 47, 47, 32, 116, 104, 101, 32, 97, 99, 116, 117, 97, 108, 32, 114, 101, 97, 100, 46, 10, 32, 32, 118, 97, 114, 32, 115, 101, 108, 102, 32, 61, 32, 116, 104, 105, 115, 59, 10, 32, 32, 102, 115, 46, 114, 101, 97, 100, 40, 116, 104, 105, 115, 46, 102, 100, 44, 32, 112, 111, 111, 108, 44, 32, 112, 111, 111, 108, 46, 117, 115, 101, 100, 44, 32, 116, 111, 82, 101, 97, 100, 44, 32, 116, 104, 105, 115, 46, 112, 111, 115, 44, 32, 111, 110, 114, 101, 97, 100, 41, 59, 10, 10, 32, 32, 47, 47, 32, 109, 111, 118, 101, 32, 116, 104, 101, 32, 112, 111, 111, 108, 32, 112, 111, 115, 105, 116, 105, 111, 110, 115, 44, 32, 97, 110, 100, 32, 105, 110, 116, 101, 114, 110, 97, 108, 32, 112, 111, 115, 105, 116, 105, 111, 110, 32, 102, 111, 114, 32, 114, 101, 97, 100, 105, 110, 103, 46, 10, 32, 32, 105, 102, 32, 40, 116, 104, 105, 115, 46, 112, 111, 115, 32, 33, 61, 61, 32, 117, 110, 100, 101, 102, 105, 110, 101, 100, 41, 10, 32, 32, 32, 32, 116, 104, 105, 115, 46, 112, 111, 115, 32, 43, 61, 32, 116, 111, 82, 101, 97, 100, 59, 10, 32, 32, 112, 111, 111, 108, 46, 117, 115, 101, 100, 32, 43, 61, 32, 116, 111, 82, 101, 97, 100, 59, 10, 10, 32, 32, 102, 117, 110, 99, 116, 105, 111, 110, 32, 111, 110, 114, 101, 97, 100, 40, 101, 114, 44, 32, 98, 121, 116, 101, 115, 82, 101, 97, 100, 41, 32, 123, 10, 32, 32, 32, 32, 105, 102, 32, 40, 101, 114, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 105, 102, 32, 40, 115, 101, 108, 102, 46, 97, 117, 116, 111, 67, 108, 111, 115, 101, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 115, 101, 108, 102, 46, 100, 101, 115, 116, 114, 111, 121, 40, 41, 59, 10, 32, 32, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 32, 32, 115, 101, 108, 102, 46, 101, 109, 105, 116, 40, 39, 101, 114, 114, 111, 114, 39, 44, 32, 101, 114, 41, 59, 10, 32, 32, 32, 32, 125, 32, 101, 108, 115, 101, 32, 123, 10, 32, 32, 32, 32, 32, 32, 118, 97, 114, 32, 98, 32, 61, 32, 110, 117, 108, 108, 59, 10, 32, 32, 32, 32, 32, 32, 105, 102, 32, 40, 98, 121, 116, 101, 115, 82, 101, 97, 100, 32, 62, 32, 48, 41, 10, 32, 32, 32, 32, 32, 32, 32, 32, 98, 32, 61, 32, 116, 104, 105, 115, 80, 111, 111, 108, 46, 115, 108, 105, 99, 101, 40, 115, 116, 97, 114, 116, 44, 32, 115, 116, 97, 114, 116, 32, 43, 32, 98, 121, 116, 101, 115, 82, 101, 97, 100, 41, 59, 10, 10, 32, 32, 32, 32, 32, 32, 115, 101, 108, 102, 46, 112, 117, 115, 104, 40, 98, 41, 59, 10, 32, 32, 32, 32, 125, 10, 32, 32, 125, 10, 125, 59, 10, 10, 10, 82, 101, 97, 100, 83, 116, 114, 101, 97, 109, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 100, 101, 115, 116, 114, 111, 121, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 32, 123, 10, 32, 32, 105, 102, 32, 40, 116, 104, 105, 115, 46, 100, 101, 115, 116, 114, 111, 121, 101, 100, 41, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 59, 10, 32, 32, 116, 104, 105, 115, 46, 100, 101, 115, 116, 114, 111, 121, 101, 100, 32, 61, 32, 116, 114, 117, 101, 59, 10, 32, 32, 116, 104, 105, 115, 46, 99, 108, 111, 115, 101, 40, 41, 59, 10, 125, 59, 10, 10, 10, 82, 101, 97, 100, 83, 116, 114, 101, 97, 109, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 99, 108, 111, 115, 101, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 99, 98, 41, 32, 123, 10, 32, 32, 118, 97, 114, 32, 115, 101, 108, 102, 32, 61, 32, 116, 104, 105, 115, 59, 10, 32, 32, 105, 102, 32, 40, 99, 98, 41, 10, 32, 32, 32, 32, 116, 104, 105, 115, 46, 111, 110, 99, 101, 40, 39, 99, 108, 111, 115, 101, 39, 44, 32, 99, 98, 41, 59, 10, 32, 32, 105, 102, 32, 40, 116, 104, 105, 115, 46, 99, 108, 111, 115, 101, 100, 32, 124, 124, 32, 116, 121, 112, 101, 111, 102, 32, 116, 104, 105, 115, 46, 102, 100, 32, 33, 61, 61, 32, 39, 110, 117, 109, 98, 101, 114, 39, 41, 32, 123, 10, 32, 32, 32, 32, 105, 102, 32, 40, 116, 121, 112, 101, 111, 102, 32, 116, 104, 105, 115, 46, 102, 100, 32, 33, 61, 61, 32, 39, 110, 117, 109, 98, 101, 114, 39, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 116, 104, 105, 115, 46, 111, 110, 99, 101, 40, 39, 111, 112, 101, 110, 39, 44, 32, 99, 108, 111, 115, 101, 41, 59, 10, 32, 32, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 59, 10, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 112, 114, 111, 99, 101, 115, 115, 46, 110, 101, 120, 116, 84, 105, 99, 107, 40, 116, 104, 105, 115, 46, 101, 109, 105, 116, 46, 98, 105, 110, 100, 40, 116, 104, 105, 115, 44, 32, 39, 99, 108, 111, 115, 101, 39, 41, 41, 59, 10, 32, 32, 125, 10, 32, 32, 116, 104, 105, 115, 46, 99, 108, 111, 115, 101, 100, 32, 61, 32, 116, 114, 117, 101, 59, 10, 32, 32, 99, 108, 111, 115, 101, 40, 41, 59, 10, 10, 32, 32, 102, 117, 110, 99, 116, 105, 111, 110, 32, 99, 108, 111, 115, 101, 40, 102, 100, 41, 32, 123, 10, 32, 32, 32, 32, 102, 115, 46, 99, 108, 111, 115, 101, 40, 102, 100, 32, 124, 124, 32, 115, 101, 108, 102, 46, 102, 100, 44, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 101, 114, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 105, 102, 32, 40, 101, 114, 41, 10, 32, 32, 32, 32, 32, 32, 32, 32, 115, 101, 108, 102, 46, 101, 109, 105, 116, 40, 39, 101, 114, 114, 111, 114, 39, 44, 32, 101, 114, 41, 59, 10, 32, 32, 32, 32, 32, 32, 101, 108, 115, 101, 10, 32, 32, 32, 32, 32, 32, 32, 32, 115, 101, 108, 102, 46, 101, 109, 105, 116, 40, 39, 99, 108, 111, 115, 101, 39, 41, 59, 10, 32, 32, 32, 32, 125, 41, 59, 10, 32, 32, 32, 32, 115, 101, 108, 102, 46, 102, 100, 32, 61, 32, 110, 117, 108, 108, 59, 10, 32, 32, 125, 10, 125, 59, 10, 10, 10, 102, 115, 46, 99, 114, 101, 97, 116, 101, 87, 114, 105, 116, 101, 83, 116, 114, 101, 97, 109, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 112, 97, 116, 104, 44, 32, 111, 112, 116, 105, 111, 110, 115, 41, 32, 123, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 110, 101, 119, 32, 87, 114, 105, 116, 101, 83, 116, 114, 101, 97, 109, 40, 112, 97, 116, 104, 44, 32, 111, 112, 116, 105, 111, 110, 115, 41, 59, 10, 125, 59, 10, 10, 47, 47, 117, 116, 105, 108, 46, 105, 110, 104, 101, 114, 105, 116, 115, 40, 87, 114, 105, 116, 101, 83, 116, 114, 101, 97, 109, 44, 32, 87, 114, 105, 116, 97, 98, 108, 101, 41, 59, 10, 47, 47, 102, 115, 46, 87, 114, 105, 116, 101, 83, 116, 114, 101, 97, 109, 32, 61, 32, 87, 114, 105, 116, 101, 83, 116, 114, 101, 97, 109, 59, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 87, 114, 105, 116, 101, 83, 116, 114, 101, 97, 109, 40, 112, 97, 116, 104, 44, 32, 111, 112, 116, 105, 111, 110, 115, 41, 32, 123, 10, 32, 32, 105, 102, 32, 40, 33, 40, 116, 104, 105, 115, 32, 105, 110, 115, 116, 97, 110, 99, 101, 111, 102, 32, 87, 114, 105, 116, 101, 83, 116, 114, 101, 97, 109, 41, 41, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 110, 101, 119, 32, 87, 114, 105, 116, 101, 83, 116, 114, 101, 97, 109, 40, 112, 97, 116, 104, 44, 32, 111, 112, 116, 105, 111, 110, 115, 41, 59, 10, 10, 32, 32, 105, 102, 32, 40, 111, 112, 116, 105, 111, 110, 115, 32, 61, 61, 61, 32, 117, 110, 100, 101, 102, 105, 110, 101, 100, 41, 10, 32, 32, 32, 32, 111, 112, 116, 105, 111, 110, 115, 32, 61, 32, 123, 125, 59, 10, 32, 32, 101, 108, 115, 101, 32, 105, 102, 32, 40, 116, 121, 112, 101, 111, 102, 32, 111, 112, 116, 105, 111, 110, 115, 32, 61, 61, 61, 32, 39, 115, 116, 114, 105, 110, 103, 39, 41, 10, 32, 32, 32, 32, 111, 112, 116, 105, 111, 110, 115, 32, 61, 32, 123, 32, 101, 110, 99, 111, 100, 105, 110, 103, 58, 32, 111, 112, 116, 105, 111, 110, 115, 32, 125, 59, 10, 32, 32, 101, 108, 115, 101, 32, 105, 102, 32, 40, 111, 112, 116, 105, 111, 110, 115, 32, 61, 61, 61, 32, 110, 117, 108, 108, 32, 124, 124, 32, 116, 121, 112, 101, 111, 102, 32, 111, 112, 116, 105, 111, 110, 115, 32, 33, 61, 61, 32, 39, 111, 98, 106, 101, 99, 116, 39, 41, 10, 32, 32, 32, 32, 116, 104, 114, 111, 119, 32, 110, 101, 119, 32, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 111, 112, 116, 105, 111, 110, 115, 32, 109, 117, 115, 116, 32, 98, 101, 32, 97, 32, 115, 116, 114, 105, 110, 103, 32, 111, 114, 32, 97, 110, 32, 111, 98, 106, 101, 99, 116, 39, 41, 59, 10, 10, 32, 32, 111, 112, 116, 105, 111, 110, 115, 32, 61, 32, 79, 98, 106, 101, 99, 116, 46, 99, 114, 101, 97, 116, 101, 40, 111, 112, 116, 105, 111, 110, 115, 41, 59, 10, 10, 32, 32, 87, 114, 105, 116, 97, 98, 108, 101, 46, 99, 97, 108, 108, 40, 116, 104, 105, 115, 44, 32, 111, 112, 116, 105, 111, 110, 115, 41, 59, 10, 10, 32, 32, 116, 104, 105, 115, 46, 112, 97, 116, 104, 32, 61, 32, 112, 97, 116, 104, 59, 10, 32, 32, 116, 104, 105, 115, 46, 102, 100, 32, 61, 32, 111, 112, 116, 105, 111, 110, 115, 46, 102, 100, 32, 61, 61, 61, 32, 117, 110, 100, 101, 102, 105, 110, 101, 100, 32, 63, 32, 110, 117, 108, 108, 32, 58, 32, 111, 112, 116, 105, 111, 110, 115, 46, 102, 100, 59, 10, 32, 32, 116, 104, 105, 115, 46, 102, 108, 97, 103, 115, 32, 61, 32, 111, 112, 116, 105, 111, 110, 115, 46, 102, 108, 97, 103, 115, 32, 61, 61, 61, 32, 117, 110, 100, 101, 102, 105, 110, 101, 100, 32, 63, 32, 39, 119, 39, 32, 58, 32, 111, 112, 116, 105, 111, 110, 115, 46, 102, 108, 97, 103, 115, 59, 10, 32, 32, 116, 104, 105, 115, 46, 109, 111, 100, 101, 32, 61, 32, 111, 112, 116, 105, 111, 110, 115, 46, 109, 111, 100, 101, 32, 61, 61, 61, 32, 117, 110, 100, 101, 102, 105, 110, 101, 100, 32, 63, 32, 48, 111, 54, 54, 54, 32, 58, 32, 111, 112, 116, 105, 111, 110, 115, 46, 109, 111, 100, 101, 59, 10, 10, 32, 32, 116, 104, 105, 115, 46, 115, 116, 97, 114, 116, 32, 61, 32, 111, 112, 116, 105, 111, 110, 115, 46, 115, 116, 97, 114, 116, 59, 10, 32, 32, 116, 104, 105, 115, 46, 112, 111, 115, 32, 61, 32, 117, 110, 100, 101, 102, 105, 110, 101, 100, 59, 10, 32, 32, 116, 104, 105, 115, 46, 98, 121, 116, 101, 115, 87, 114, 105, 116, 116, 101, 110, 32, 61, 32, 48, 59, 10, 10, 32, 32, 105, 102, 32, 40, 116, 104, 105, 115, 46, 115, 116, 97, 114, 116, 32, 33, 61, 61, 32, 117, 110, 100, 101, 102, 105, 110, 101, 100, 41, 32, 123, 10, 32, 32, 32, 32, 105, 102, 32, 40, 116, 121, 112, 101, 111, 102, 32, 116, 104, 105, 115, 46, 115, 116, 97, 114, 116, 32, 33, 61, 61, 32, 39, 110, 117, 109, 98, 101, 114, 39, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 116, 104, 114, 111, 119, 32, 110, 101, 119, 32, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 115, 116, 97, 114, 116, 32, 109, 117, 115, 116, 32, 98, 101, 32, 97, 32, 78, 117, 109, 98, 101, 114, 39, 41, 59, 10, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 105, 102, 32, 40, 116, 104, 105, 115, 46, 115, 116, 97, 114, 116, 32, 60, 32, 48, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 116, 104, 114, 111, 119, 32, 110, 101, 119, 32, 69, 114, 114, 111, 114, 40, 39, 115, 116, 97, 114, 116, 32, 109, 117, 115, 116, 32, 98, 101, 32, 62, 61, 32, 122, 101, 114, 111, 39, 41, 59, 10, 32, 32, 32, 32, 125, 10, 10, 32, 32, 32, 32, 116, 104, 105, 115, 46, 112, 111, 115, 32, 61, 32, 116, 104, 105, 115, 46, 115, 116, 97, 114, 116, 59, 10, 32, 32, 125, 10, 10, 32, 32, 105, 102, 32, 40, 111, 112, 116, 105, 111, 110, 115, 46, 101, 110, 99, 111, 100, 105, 110, 103, 41, 10, 32, 32, 32, 32, 116, 104, 105, 115, 46, 115, 101, 116, 68, 101, 102, 97, 117, 108, 116, 69, 110, 99, 111, 100, 105, 110, 103, 40, 111, 112, 116, 105, 111, 110, 115, 46, 101, 110, 99, 111, 100, 105, 110, 103, 41, 59, 10, 10, 32, 32, 105, 102, 32, 40, 116, 121, 112, 101, 111, 102, 32, 116, 104, 105, 115, 46, 102, 100, 32, 33, 61, 61, 32, 39, 110, 117, 109, 98, 101, 114, 39, 41, 10, 32, 32, 32, 32, 116, 104, 105, 115, 46, 111, 112, 101, 110, 40, 41, 59, 10, 10, 32, 32, 47, 47, 32, 100, 105, 115, 112, 111, 115, 101, 32, 111, 110, 32, 102, 105, 110, 105, 115, 104, 46, 10, 32, 32, 116, 104, 105, 115, 46, 111, 110, 99, 101, 40, 39, 102, 105, 110, 105, 115, 104, 39, 44, 32, 116, 104, 105, 115, 46, 99, 108, 111, 115, 101, 41, 59, 10, 125, 10, 10, 102, 115, 46, 70, 105, 108, 101, 87, 114, 105, 116, 101, 83, 116, 114, 101, 97, 109, 32, 61, 32, 102, 115, 46, 87, 114, 105, 116, 101, 83, 116, 114, 101, 97, 109, 59, 32, 47, 47, 32, 115, 117, 112, 112, 111, 114, 116, 32, 116, 104, 101, 32, 108, 101, 103, 97, 99, 121, 32, 110, 97, 109, 101, 10, 10, 10, 87, 114, 105, 116, 101, 83, 116, 114, 101, 97, 109, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 111, 112, 101, 110, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 32, 123, 10, 32, 32, 102, 115, 46, 111, 112, 101, 110, 40, 116, 104, 105, 115, 46, 112, 97, 116, 104, 44, 32, 116, 104, 105, 115, 46, 102, 108, 97, 103, 115, 44, 32, 116, 104, 105, 115, 46, 109, 111, 100, 101, 44, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 101, 114, 44, 32, 102, 100, 41, 32, 123, 10, 32, 32, 32, 32, 105, 102, 32, 40, 101, 114, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 116, 104, 105, 115, 46, 100, 101, 115, 116, 114, 111, 121, 40, 41, 59, 10, 32, 32, 32, 32, 32, 32, 116, 104, 105, 115, 46, 101, 109, 105, 116, 40, 39, 101, 114, 114, 111, 114, 39, 44, 32, 101, 114, 41, 59, 10, 32, 32, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 59, 10, 32, 32, 32, 32, 125, 10, 10, 32, 32, 32, 32, 116, 104, 105, 115, 46, 102, 100, 32, 61, 32, 102, 100, 59, 10, 32, 32, 32, 32, 116, 104, 105, 115, 46, 101, 109, 105, 116, 40, 39, 111, 112, 101, 110, 39, 44, 32, 102, 100, 41, 59, 10, 32, 32, 125, 46, 98, 105, 110, 100, 40, 116, 104, 105, 115, 41, 41, 59, 10, 125, 59, 10, 10, 10, 87, 114, 105, 116, 101, 83, 116, 114, 101, 97, 109, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 95, 119, 114, 105, 116, 101, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 100, 97, 116, 97, 44, 32, 101, 110, 99, 111, 100, 105, 110, 103, 44, 32, 99, 98, 41, 32, 123, 10, 32, 32, 105, 102, 32, 40, 33, 40, 100, 97, 116, 97, 32, 105, 110, 115, 116, 97, 110, 99, 101, 111, 102, 32, 66, 117, 102, 102, 101, 114, 41, 41, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 46, 101, 109, 105, 116, 40, 39, 101, 114, 114, 111, 114, 39, 44, 32, 110, 101, 119, 32, 69, 114, 114, 111, 114, 40, 39, 73, 110, 118, 97, 108, 105, 100, 32, 100, 97, 116, 97, 39, 41, 41, 59, 10, 10, 32, 32, 105, 102, 32, 40, 116, 121, 112, 101, 111, 102, 32, 116, 104, 105, 115, 46, 102, 100, 32, 33, 61, 61, 32, 39, 110, 117, 109, 98, 101, 114, 39, 41, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 46, 111, 110, 99, 101, 40, 39, 111, 112, 101, 110, 39, 44, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 116, 104, 105, 115, 46, 95, 119, 114, 105, 116, 101, 40, 100, 97, 116, 97, 44, 32, 101, 110, 99, 111, 100, 105, 110, 103, 44, 32, 99, 98, 41, 59, 10, 32, 32, 32, 32, 125, 41, 59, 10, 10, 32, 32, 118, 97, 114, 32, 115, 101, 108, 102, 32, 61, 32, 116, 104, 105, 115, 59, 10, 32, 32, 102, 115, 46, 119, 114, 105, 116, 101, 40, 116, 104, 105, 115, 46, 102, 100, 44, 32, 100, 97, 116, 97, 44, 32, 48, 44, 32, 100, 97, 116, 97, 46, 108, 101, 110, 103, 116, 104, 44, 32, 116, 104, 105, 115, 46, 112, 111, 115, 44, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 101, 114, 44, 32, 98, 121, 116, 101, 115, 41, 32, 123, 10, 32, 32, 32, 32, 105, 102, 32, 40, 101, 114, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 115, 101, 108, 102, 46, 100, 101, 115, 116, 114, 111, 121, 40, 41, 59, 10, 32, 32, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 99, 98, 40, 101, 114, 41, 59, 10, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 115, 101, 108, 102, 46, 98, 121, 116, 101, 115, 87, 114, 105, 116, 116, 101, 110, 32, 43, 61, 32, 98, 121, 116, 101, 115, 59, 10, 32, 32, 32, 32, 99, 98, 40, 41, 59, 10, 32, 32, 125, 41, 59, 10, 10, 32, 32, 105, 102, 32, 40, 116, 104, 105, 115, 46, 112, 111, 115, 32, 33, 61, 61, 32, 117, 110, 100, 101, 102, 105, 110, 101, 100, 41, 10, 32, 32, 32, 32, 116, 104, 105, 115, 46, 112, 111, 115, 32, 43, 61, 32, 100, 97, 116, 97, 46, 108, 101, 110, 103, 116, 104, 59, 10, 125, 59, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 119, 114, 105, 116, 101, 118, 40, 102, 100, 44, 32, 99, 104, 117, 110, 107, 115, 44, 32, 112, 111, 115, 105, 116, 105, 111, 110, 44, 32, 99, 97, 108, 108, 98, 97, 99, 107, 41, 32, 123, 10, 32, 32, 102, 117, 110, 99, 116, 105, 111, 110, 32, 119, 114, 97, 112, 112, 101, 114, 40, 101, 114, 114, 44, 32, 119, 114, 105, 116, 116, 101, 110, 41, 32, 123, 10, 32, 32, 32, 32, 47, 47, 32, 82, 101, 116, 97, 105, 110, 32, 97, 32, 114, 101, 102, 101, 114, 101, 110, 99, 101, 32, 116, 111, 32, 99, 104, 117, 110, 107, 115, 32, 115, 111, 32, 116, 104, 97, 116, 32, 116, 104, 101, 121, 32, 99, 97, 110, 39, 116, 32, 98, 101, 32, 71, 67, 39, 101, 100, 32, 116, 111, 111, 32, 115, 111, 111, 110, 46, 10, 32, 32, 32, 32, 99, 97, 108, 108, 98, 97, 99, 107, 40, 101, 114, 114, 44, 32, 119, 114, 105, 116, 116, 101, 110, 32, 124, 124, 32, 48, 44, 32, 99, 104, 117, 110, 107, 115, 41, 59, 10, 32, 32, 125, 10, 10, 32, 32, 99, 111, 110, 115, 116, 32, 114, 101, 113, 32, 61, 32, 110, 101, 119, 32, 70, 83, 82, 101, 113, 87, 114, 97, 112, 40, 41, 59, 10, 32, 32, 114, 101, 113, 46, 111, 110, 99, 111, 109, 112, 108, 101, 116, 101, 32, 61, 32, 119, 114, 97, 112, 112, 101, 114, 59, 10, 32, 32, 98, 105, 110, 100, 105, 110, 103, 46, 119, 114, 105, 116, 101, 66, 117, 102, 102, 101, 114, 115, 40, 102, 100, 44, 32, 99, 104, 117, 110, 107, 115, 44, 32, 112, 111, 115, 105, 116, 105, 111, 110, 44, 32, 114, 101, 113, 41, 59, 10, 125, 10, 10, 10, 87, 114, 105, 116, 101, 83, 116, 114, 101, 97, 109, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 95, 119, 114, 105, 116, 101, 118, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 100, 97, 116, 97, 44, 32, 99, 98, 41, 32, 123, 10, 32, 32, 105, 102, 32, 40, 116, 121, 112, 101, 111, 102, 32, 116, 104, 105, 115, 46, 102, 100, 32, 33, 61, 61, 32, 39, 110, 117, 109, 98, 101, 114, 39, 41, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 46, 111, 110, 99, 101, 40, 39, 111, 112, 101, 110, 39, 44, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 116, 104, 105, 115, 46, 95, 119, 114, 105, 116, 101, 118, 40, 100, 97, 116, 97, 44, 32, 99, 98, 41, 59, 10, 32, 32, 32, 32, 125, 41, 59, 10, 10, 32, 32, 99, 111, 110, 115, 116, 32, 115, 101, 108, 102, 32, 61, 32, 116, 104, 105, 115, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 108, 101, 110, 32, 61, 32, 100, 97, 116, 97, 46, 108, 101, 110, 103, 116, 104, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 99, 104, 117, 110, 107, 115, 32, 61, 32, 110, 101, 119, 32, 65, 114, 114, 97, 121, 40, 108, 101, 110, 41, 59, 10, 32, 32, 118, 97, 114, 32, 115, 105, 122, 101, 32, 61, 32, 48, 59, 10, 10, 32, 32, 102, 111, 114, 32, 40, 118, 97, 114, 32, 105, 32, 61, 32, 48, 59, 32, 105, 32, 60, 32, 108, 101, 110, 59, 32, 105, 43, 43, 41, 32, 123, 10, 32, 32, 32, 32, 118, 97, 114, 32, 99, 104, 117, 110, 107, 32, 61, 32, 100, 97, 116, 97, 91, 105, 93, 46, 99, 104, 117, 110, 107, 59, 10, 10, 32, 32, 32, 32, 99, 104, 117, 110, 107, 115, 91, 105, 93, 32, 61, 32, 99, 104, 117, 110, 107, 59, 10, 32, 32, 32, 32, 115, 105, 122, 101, 32, 43, 61, 32, 99, 104, 117, 110, 107, 46, 108, 101, 110, 103, 116, 104, 59, 10, 32, 32, 125, 10, 10, 32, 32, 119, 114, 105, 116, 101, 118, 40, 116, 104, 105, 115, 46, 102, 100, 44, 32, 99, 104, 117, 110, 107, 115, 44, 32, 116, 104, 105, 115, 46, 112, 111, 115, 44, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 101, 114, 44, 32, 98, 121, 116, 101, 115, 41, 32, 123, 10, 32, 32, 32, 32, 105, 102, 32, 40, 101, 114, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 115, 101, 108, 102, 46, 100, 101, 115, 116, 114, 111, 121, 40, 41, 59, 10, 32, 32, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 99, 98, 40, 101, 114, 41, 59, 10, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 115, 101, 108, 102, 46, 98, 121, 116, 101, 115, 87, 114, 105, 116, 116, 101, 110, 32, 43, 61, 32, 98, 121, 116, 101, 115, 59, 10, 32, 32, 32, 32, 99, 98, 40, 41, 59, 10, 32, 32, 125, 41, 59, 10, 10, 32, 32, 105, 102, 32, 40, 116, 104, 105, 115, 46, 112, 111, 115, 32, 33, 61, 61, 32, 117, 110, 100, 101, 102, 105, 110, 101, 100, 41, 10, 32, 32, 32, 32, 116, 104, 105, 115, 46, 112, 111, 115, 32, 43, 61, 32, 115, 105, 122, 101, 59, 10, 125, 59, 10, 10, 10, 87, 114, 105, 116, 101, 83, 116, 114, 101, 97, 109, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 100, 101, 115, 116, 114, 111, 121, 32, 61, 32, 82, 101, 97, 100, 83, 116, 114, 101, 97, 109, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 100, 101, 115, 116, 114, 111, 121, 59, 10, 87, 114, 105, 116, 101, 83, 116, 114, 101, 97, 109, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 99, 108, 111, 115, 101, 32, 61, 32, 82, 101, 97, 100, 83, 116, 114, 101, 97, 109, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 99, 108, 111, 115, 101, 59, 10, 10, 47, 47, 32, 84, 104, 101, 114, 101, 32, 105, 115, 32, 110, 111, 32, 115, 104, 117, 116, 100, 111, 119, 110, 40, 41, 32, 102, 111, 114, 32, 102, 105, 108, 101, 115, 46, 10, 87, 114, 105, 116, 101, 83, 116, 114, 101, 97, 109, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 100, 101, 115, 116, 114, 111, 121, 83, 111, 111, 110, 32, 61, 32, 87, 114, 105, 116, 101, 83, 116, 114, 101, 97, 109, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 101, 110, 100, 59, 10, 10, 10, 47, 47, 32, 83, 121, 110, 99, 87, 114, 105, 116, 101, 83, 116, 114, 101, 97, 109, 32, 105, 115, 32, 105, 110, 116, 101, 114, 110, 97, 108, 46, 32, 68, 79, 32, 78, 79, 84, 32, 85, 83, 69, 46, 10, 47, 47, 32, 84, 101, 109, 112, 111, 114, 97, 114, 121, 32, 104, 97, 99, 107, 32, 102, 111, 114, 32, 112, 114, 111, 99, 101, 115, 115, 46, 115, 116, 100, 111, 117, 116, 32, 97, 110, 100, 32, 112, 114, 111, 99, 101, 115, 115, 46, 115, 116, 100, 101, 114, 114, 32, 119, 104, 101, 110, 32, 112, 105, 112, 101, 100, 32, 116, 111, 32, 102, 105, 108, 101, 115, 46, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 83, 121, 110, 99, 87, 114, 105, 116, 101, 83, 116, 114, 101, 97, 109, 40, 102, 100, 44, 32, 111, 112, 116, 105, 111, 110, 115, 41, 32, 123, 10, 32, 32, 83, 116, 114, 101, 97, 109, 46, 99, 97, 108, 108, 40, 116, 104, 105, 115, 41, 59, 10, 10, 32, 32, 111, 112, 116, 105, 111, 110, 115, 32, 61, 32, 111, 112, 116, 105, 111, 110, 115, 32, 124, 124, 32, 123, 125, 59, 10, 10, 32, 32, 116, 104, 105, 115, 46, 102, 100, 32, 61, 32, 102, 100, 59, 10, 32, 32, 116, 104, 105, 115, 46, 119, 114, 105, 116, 97, 98, 108, 101, 32, 61, 32, 116, 114, 117, 101, 59, 10, 32, 32, 116, 104, 105, 115, 46, 114, 101, 97, 100, 97, 98, 108, 101, 32, 61, 32, 102, 97, 108, 115, 101, 59, 10, 32, 32, 116, 104, 105, 115, 46, 97, 117, 116, 111, 67, 108, 111, 115, 101, 32, 61, 32, 111, 112, 116, 105, 111, 110, 115, 46, 97, 117, 116, 111, 67, 108, 111, 115, 101, 32, 61, 61, 61, 32, 117, 110, 100, 101, 102, 105, 110, 101, 100, 32, 63, 32, 116, 114, 117, 101, 32, 58, 32, 111, 112, 116, 105, 111, 110, 115, 46, 97, 117, 116, 111, 67, 108, 111, 115, 101, 59, 10, 125, 10, 10, 47, 47, 117, 116, 105, 108, 46, 105, 110, 104, 101, 114, 105, 116, 115, 40, 83, 121, 110, 99, 87, 114, 105, 116, 101, 83, 116, 114, 101, 97, 109, 44, 32, 83, 116, 114, 101, 97, 109, 41, 59, 10, 10, 10, 47, 47, 32, 69, 120, 112, 111, 114, 116, 10, 79, 98, 106, 101, 99, 116, 46, 100, 101, 102, 105, 110, 101, 80, 114, 111, 112, 101, 114, 116, 121, 40, 102, 115, 44, 32, 39, 83, 121, 110, 99, 87, 114, 105, 116, 101, 83, 116, 114, 101, 97, 109, 39, 44, 32, 123, 10, 32, 32, 99, 111, 110, 102, 105, 103, 117, 114, 97, 98, 108, 101, 58, 32, 116, 114, 117, 101, 44, 10, 32, 32, 119, 114, 105, 116, 97, 98, 108, 101, 58, 32, 116, 114, 117, 101, 44, 10, 32, 32, 118, 97, 108, 117, 101, 58, 32, 83, 121, 110, 99, 87, 114, 105, 116, 101, 83, 116, 114, 101, 97, 109, 10, 125, 41, 59, 10, 10, 83, 121, 110, 99, 87, 114, 105, 116, 101, 83, 116, 114, 101, 97, 109, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 119, 114, 105, 116, 101, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 100, 97, 116, 97, 44, 32, 97, 114, 103, 49, 44, 32, 97, 114, 103, 50, 41, 32, 123, 10, 32, 32, 118, 97, 114, 32, 101, 110, 99, 111, 100, 105, 110, 103, 44, 32, 99, 98, 59, 10, 10, 32, 32, 47, 47, 32, 112, 97, 114, 115, 101, 32, 97, 114, 103, 117, 109, 101, 110, 116, 115, 10, 32, 32, 105, 102, 32, 40, 97, 114, 103, 49, 41, 32, 123, 10, 32, 32, 32, 32, 105, 102, 32, 40, 116, 121, 112, 101, 111, 102, 32, 97, 114, 103, 49, 32, 61, 61, 61, 32, 39, 115, 116, 114, 105, 110, 103, 39, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 101, 110, 99, 111, 100, 105, 110, 103, 32, 61, 32, 97, 114, 103, 49, 59, 10, 32, 32, 32, 32, 32, 32, 99, 98, 32, 61, 32, 97, 114, 103, 50, 59, 10, 32, 32, 32, 32, 125, 32, 101, 108, 115, 101, 32, 105, 102, 32, 40, 116, 121, 112, 101, 111, 102, 32, 97, 114, 103, 49, 32, 61, 61, 61, 32, 39, 102, 117, 110, 99, 116, 105, 111, 110, 39, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 99, 98, 32, 61, 32, 97, 114, 103, 49, 59, 10, 32, 32, 32, 32, 125, 32, 101, 108, 115, 101, 32, 123, 10, 32, 32, 32, 32, 32, 32, 116, 104, 114, 111, 119, 32, 110, 101, 119, 32, 69, 114, 114, 111, 114, 40, 39, 98, 97, 100, 32, 97, 114, 103, 39, 41, 59, 10, 32, 32, 32, 32, 125, 10, 32, 32, 125, 10, 32, 32, 97, 115, 115, 101, 114, 116, 69, 110, 99, 111, 100, 105, 110, 103, 40, 101, 110, 99, 111, 100, 105, 110, 103, 41, 59, 10, 10, 32, 32, 47, 47, 32, 67, 104, 97, 110, 103, 101, 32, 115, 116, 114, 105, 110, 103, 115, 32, 116, 111, 32, 98, 117, 102, 102, 101, 114, 115, 46, 32, 83, 76, 79, 87, 10, 32, 32, 105, 102, 32, 40, 116, 121, 112, 101, 111, 102, 32, 100, 97, 116, 97, 32, 61, 61, 61, 32, 39, 115, 116, 114, 105, 110, 103, 39, 41, 32, 123, 10, 32, 32, 32, 32, 100, 97, 116, 97, 32, 61, 32, 110, 101, 119, 32, 66, 117, 102, 102, 101, 114, 40, 100, 97, 116, 97, 44, 32, 101, 110, 99, 111, 100, 105, 110, 103, 41, 59, 10, 32, 32, 125, 10, 10, 32, 32, 102, 115, 46, 119, 114, 105, 116, 101, 83, 121, 110, 99, 40, 116, 104, 105, 115, 46, 102, 100, 44, 32, 100, 97, 116, 97, 44, 32, 48, 44, 32, 100, 97, 116, 97, 46, 108, 101, 110, 103, 116, 104, 41, 59, 10, 10, 32, 32, 105, 102, 32, 40, 99, 98, 41, 32, 123, 10, 32, 32, 32, 32, 112, 114, 111, 99, 101, 115, 115, 46, 110, 101, 120, 116, 84, 105, 99, 107, 40, 99, 98, 41, 59, 10, 32, 32, 125, 10, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 116, 114, 117, 101, 59, 10, 125, 59, 10, 10, 10, 83, 121, 110, 99, 87, 114, 105, 116, 101, 83, 116, 114, 101, 97, 109, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 101, 110, 100, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 100, 97, 116, 97, 44, 32, 97, 114, 103, 49, 44, 32, 97, 114, 103, 50, 41, 32, 123, 10, 32, 32, 105, 102, 32, 40, 100, 97, 116, 97, 41, 32, 123, 10, 32, 32, 32, 32, 116, 104, 105, 115, 46, 119, 114, 105, 116, 101, 40, 100, 97, 116, 97, 44, 32, 97, 114, 103, 49, 44, 32, 97, 114, 103, 50, 41, 59, 10, 32, 32, 125, 10, 32, 32, 116, 104, 105, 115, 46, 100, 101, 115, 116, 114, 111, 121, 40, 41, 59, 10, 125, 59, 10, 10, 10, 83, 121, 110, 99, 87, 114, 105, 116, 101, 83, 116, 114, 101, 97, 109, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 100, 101, 115, 116, 114, 111, 121, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 32, 123, 10, 32, 32, 105, 102, 32, 40, 116, 104, 105, 115, 46, 97, 117, 116, 111, 67, 108, 111, 115, 101, 41, 10, 32, 32, 32, 32, 102, 115, 46, 99, 108, 111, 115, 101, 83, 121, 110, 99, 40, 116, 104, 105, 115, 46, 102, 100, 41, 59, 10, 32, 32, 116, 104, 105, 115, 46, 102, 100, 32, 61, 32, 110, 117, 108, 108, 59, 10, 32, 32, 116, 104, 105, 115, 46, 101, 109, 105, 116, 40, 39, 99, 108, 111, 115, 101, 39, 41, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 116, 114, 117, 101, 59, 10, 125, 59, 10, 10, 83, 121, 110, 99, 87, 114, 105, 116, 101, 83, 116, 114, 101, 97, 109, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 100, 101, 115, 116, 114, 111, 121, 83, 111, 111, 110, 32, 61, 32, 83, 121, 110, 99, 87, 114, 105, 116, 101, 83, 116, 114, 101, 97, 109, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 100, 101, 115, 116, 114, 111, 121, 59, 10, 0 };
+  const cef_char_t fs_native[] = { 47, 47, 32, 77, 79, 68, 73, 70, 73, 69, 68, 58, 32, 99, 111, 109, 109, 101, 110, 116, 32, 111, 117, 116, 32, 115, 111, 109, 101, 32, 108, 105, 110, 101, 115, 10, 47, 47, 32, 77, 97, 105, 110, 116, 97, 105, 110, 101, 114, 115, 44, 32, 107, 101, 101, 112, 32, 105, 110, 32, 109, 105, 110, 100, 32, 116, 104, 97, 116, 32, 69, 83, 49, 45, 115, 116, 121, 108, 101, 32, 111, 99, 116, 97, 108, 32, 108, 105, 116, 101, 114, 97, 108, 115, 32, 40, 96, 48, 54, 54, 54, 96, 41, 32, 97, 114, 101, 32, 110, 111, 116, 10, 47, 47, 32, 97, 108, 108, 111, 119, 101, 100, 32, 105, 110, 32, 115, 116, 114, 105, 99, 116, 32, 109, 111, 100, 101, 46, 32, 85, 115, 101, 32, 69, 83, 54, 45, 115, 116, 121, 108, 101, 32, 111, 99, 116, 97, 108, 32, 108, 105, 116, 101, 114, 97, 108, 115, 32, 105, 110, 115, 116, 101, 97, 100, 32, 40, 96, 48, 111, 54, 54, 54, 96, 41, 46, 10, 10, 39, 117, 115, 101, 32, 115, 116, 114, 105, 99, 116, 39, 59, 10, 10, 99, 111, 110, 115, 116, 32, 83, 108, 111, 119, 66, 117, 102, 102, 101, 114, 32, 61, 32, 114, 101, 113, 117, 105, 114, 101, 40, 39, 98, 117, 102, 102, 101, 114, 39, 41, 46, 83, 108, 111, 119, 66, 117, 102, 102, 101, 114, 59, 10, 99, 111, 110, 115, 116, 32, 117, 116, 105, 108, 32, 61, 32, 114, 101, 113, 117, 105, 114, 101, 40, 39, 117, 116, 105, 108, 39, 41, 59, 10, 99, 111, 110, 115, 116, 32, 112, 97, 116, 104, 77, 111, 100, 117, 108, 101, 32, 61, 32, 114, 101, 113, 117, 105, 114, 101, 40, 39, 112, 97, 116, 104, 39, 41, 59, 10, 10, 99, 111, 110, 115, 116, 32, 98, 105, 110, 100, 105, 110, 103, 32, 61, 32, 112, 114, 111, 99, 101, 115, 115, 46, 98, 105, 110, 100, 105, 110, 103, 40, 39, 102, 115, 39, 41, 59, 10, 99, 111, 110, 115, 116, 32, 99, 111, 110, 115, 116, 97, 110, 116, 115, 32, 61, 32, 114, 101, 113, 117, 105, 114, 101, 40, 39, 99, 111, 110, 115, 116, 97, 110, 116, 115, 39, 41, 59, 10, 99, 111, 110, 115, 116, 32, 102, 115, 32, 61, 32, 101, 120, 112, 111, 114, 116, 115, 59, 10, 99, 111, 110, 115, 116, 32, 66, 117, 102, 102, 101, 114, 32, 61, 32, 114, 101, 113, 117, 105, 114, 101, 40, 39, 98, 117, 102, 102, 101, 114, 39, 41, 46, 66, 117, 102, 102, 101, 114, 59, 10, 47, 47, 99, 111, 110, 115, 116, 32, 83, 116, 114, 101, 97, 109, 32, 61, 32, 114, 101, 113, 117, 105, 114, 101, 40, 39, 115, 116, 114, 101, 97, 109, 39, 41, 46, 83, 116, 114, 101, 97, 109, 59, 10, 99, 111, 110, 115, 116, 32, 69, 118, 101, 110, 116, 69, 109, 105, 116, 116, 101, 114, 32, 61, 32, 114, 101, 113, 117, 105, 114, 101, 40, 39, 101, 118, 101, 110, 116, 115, 39, 41, 59, 10, 99, 111, 110, 115, 116, 32, 70, 83, 82, 101, 113, 87, 114, 97, 112, 32, 61, 32, 98, 105, 110, 100, 105, 110, 103, 46, 70, 83, 82, 101, 113, 87, 114, 97, 112, 59, 10, 99, 111, 110, 115, 116, 32, 70, 83, 69, 118, 101, 110, 116, 32, 61, 32, 112, 114, 111, 99, 101, 115, 115, 46, 98, 105, 110, 100, 105, 110, 103, 40, 39, 102, 115, 95, 101, 118, 101, 110, 116, 95, 119, 114, 97, 112, 39, 41, 46, 70, 83, 69, 118, 101, 110, 116, 59, 10, 10, 47, 47, 99, 111, 110, 115, 116, 32, 82, 101, 97, 100, 97, 98, 108, 101, 32, 61, 32, 83, 116, 114, 101, 97, 109, 46, 82, 101, 97, 100, 97, 98, 108, 101, 59, 10, 47, 47, 99, 111, 110, 115, 116, 32, 87, 114, 105, 116, 97, 98, 108, 101, 32, 61, 32, 83, 116, 114, 101, 97, 109, 46, 87, 114, 105, 116, 97, 98, 108, 101, 59, 10, 10, 99, 111, 110, 115, 116, 32, 107, 77, 105, 110, 80, 111, 111, 108, 83, 112, 97, 99, 101, 32, 61, 32, 49, 50, 56, 59, 10, 99, 111, 110, 115, 116, 32, 107, 77, 97, 120, 76, 101, 110, 103, 116, 104, 32, 61, 32, 114, 101, 113, 117, 105, 114, 101, 40, 39, 98, 117, 102, 102, 101, 114, 39, 41, 46, 107, 77, 97, 120, 76, 101, 110, 103, 116, 104, 59, 10, 10, 99, 111, 110, 115, 116, 32, 79, 95, 65, 80, 80, 69, 78, 68, 32, 61, 32, 99, 111, 110, 115, 116, 97, 110, 116, 115, 46, 79, 95, 65, 80, 80, 69, 78, 68, 32, 124, 124, 32, 48, 59, 10, 99, 111, 110, 115, 116, 32, 79, 95, 67, 82, 69, 65, 84, 32, 61, 32, 99, 111, 110, 115, 116, 97, 110, 116, 115, 46, 79, 95, 67, 82, 69, 65, 84, 32, 124, 124, 32, 48, 59, 10, 99, 111, 110, 115, 116, 32, 79, 95, 69, 88, 67, 76, 32, 61, 32, 99, 111, 110, 115, 116, 97, 110, 116, 115, 46, 79, 95, 69, 88, 67, 76, 32, 124, 124, 32, 48, 59, 10, 99, 111, 110, 115, 116, 32, 79, 95, 82, 68, 79, 78, 76, 89, 32, 61, 32, 99, 111, 110, 115, 116, 97, 110, 116, 115, 46, 79, 95, 82, 68, 79, 78, 76, 89, 32, 124, 124, 32, 48, 59, 10, 99, 111, 110, 115, 116, 32, 79, 95, 82, 68, 87, 82, 32, 61, 32, 99, 111, 110, 115, 116, 97, 110, 116, 115, 46, 79, 95, 82, 68, 87, 82, 32, 124, 124, 32, 48, 59, 10, 99, 111, 110, 115, 116, 32, 79, 95, 83, 89, 78, 67, 32, 61, 32, 99, 111, 110, 115, 116, 97, 110, 116, 115, 46, 79, 95, 83, 89, 78, 67, 32, 124, 124, 32, 48, 59, 10, 99, 111, 110, 115, 116, 32, 79, 95, 84, 82, 85, 78, 67, 32, 61, 32, 99, 111, 110, 115, 116, 97, 110, 116, 115, 46, 79, 95, 84, 82, 85, 78, 67, 32, 124, 124, 32, 48, 59, 10, 99, 111, 110, 115, 116, 32, 79, 95, 87, 82, 79, 78, 76, 89, 32, 61, 32, 99, 111, 110, 115, 116, 97, 110, 116, 115, 46, 79, 95, 87, 82, 79, 78, 76, 89, 32, 124, 124, 32, 48, 59, 10, 10, 99, 111, 110, 115, 116, 32, 105, 115, 87, 105, 110, 100, 111, 119, 115, 32, 61, 32, 112, 114, 111, 99, 101, 115, 115, 46, 112, 108, 97, 116, 102, 111, 114, 109, 32, 61, 61, 61, 32, 39, 119, 105, 110, 51, 50, 39, 59, 10, 10, 99, 111, 110, 115, 116, 32, 68, 69, 66, 85, 71, 32, 61, 32, 112, 114, 111, 99, 101, 115, 115, 46, 101, 110, 118, 46, 78, 79, 68, 69, 95, 68, 69, 66, 85, 71, 32, 38, 38, 32, 47, 102, 115, 47, 46, 116, 101, 115, 116, 40, 112, 114, 111, 99, 101, 115, 115, 46, 101, 110, 118, 46, 78, 79, 68, 69, 95, 68, 69, 66, 85, 71, 41, 59, 10, 99, 111, 110, 115, 116, 32, 101, 114, 114, 110, 111, 69, 120, 99, 101, 112, 116, 105, 111, 110, 32, 61, 32, 117, 116, 105, 108, 46, 95, 101, 114, 114, 110, 111, 69, 120, 99, 101, 112, 116, 105, 111, 110, 59, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 116, 104, 114, 111, 119, 79, 112, 116, 105, 111, 110, 115, 69, 114, 114, 111, 114, 40, 111, 112, 116, 105, 111, 110, 115, 41, 32, 123, 10, 32, 32, 116, 104, 114, 111, 119, 32, 110, 101, 119, 32, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 69, 120, 112, 101, 99, 116, 101, 100, 32, 111, 112, 116, 105, 111, 110, 115, 32, 116, 111, 32, 98, 101, 32, 101, 105, 116, 104, 101, 114, 32, 97, 110, 32, 111, 98, 106, 101, 99, 116, 32, 111, 114, 32, 97, 32, 115, 116, 114, 105, 110, 103, 44, 32, 39, 32, 43, 10, 32, 32, 32, 32, 39, 98, 117, 116, 32, 103, 111, 116, 32, 39, 32, 43, 32, 116, 121, 112, 101, 111, 102, 32, 111, 112, 116, 105, 111, 110, 115, 32, 43, 32, 39, 32, 105, 110, 115, 116, 101, 97, 100, 39, 41, 59, 10, 125, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 114, 101, 116, 104, 114, 111, 119, 40, 41, 32, 123, 10, 32, 32, 47, 47, 32, 79, 110, 108, 121, 32, 101, 110, 97, 98, 108, 101, 32, 105, 110, 32, 100, 101, 98, 117, 103, 32, 109, 111, 100, 101, 46, 32, 65, 32, 98, 97, 99, 107, 116, 114, 97, 99, 101, 32, 117, 115, 101, 115, 32, 126, 49, 48, 48, 48, 32, 98, 121, 116, 101, 115, 32, 111, 102, 32, 104, 101, 97, 112, 32, 115, 112, 97, 99, 101, 32, 97, 110, 100, 10, 32, 32, 47, 47, 32, 105, 115, 32, 102, 97, 105, 114, 108, 121, 32, 115, 108, 111, 119, 32, 116, 111, 32, 103, 101, 110, 101, 114, 97, 116, 101, 46, 10, 32, 32, 105, 102, 32, 40, 68, 69, 66, 85, 71, 41, 32, 123, 10, 32, 32, 32, 32, 118, 97, 114, 32, 98, 97, 99, 107, 116, 114, 97, 99, 101, 32, 61, 32, 110, 101, 119, 32, 69, 114, 114, 111, 114, 40, 41, 59, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 101, 114, 114, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 105, 102, 32, 40, 101, 114, 114, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 98, 97, 99, 107, 116, 114, 97, 99, 101, 46, 115, 116, 97, 99, 107, 32, 61, 32, 101, 114, 114, 46, 110, 97, 109, 101, 32, 43, 32, 39, 58, 32, 39, 32, 43, 32, 101, 114, 114, 46, 109, 101, 115, 115, 97, 103, 101, 32, 43, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 98, 97, 99, 107, 116, 114, 97, 99, 101, 46, 115, 116, 97, 99, 107, 46, 115, 117, 98, 115, 116, 114, 40, 98, 97, 99, 107, 116, 114, 97, 99, 101, 46, 110, 97, 109, 101, 46, 108, 101, 110, 103, 116, 104, 41, 59, 10, 32, 32, 32, 32, 32, 32, 32, 32, 116, 104, 114, 111, 119, 32, 98, 97, 99, 107, 116, 114, 97, 99, 101, 59, 10, 32, 32, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 125, 59, 10, 32, 32, 125, 10, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 101, 114, 114, 41, 32, 123, 10, 32, 32, 32, 32, 105, 102, 32, 40, 101, 114, 114, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 116, 104, 114, 111, 119, 32, 101, 114, 114, 59, 32, 32, 47, 47, 32, 70, 111, 114, 103, 111, 116, 32, 97, 32, 99, 97, 108, 108, 98, 97, 99, 107, 32, 98, 117, 116, 32, 100, 111, 110, 39, 116, 32, 107, 110, 111, 119, 32, 119, 104, 101, 114, 101, 63, 32, 85, 115, 101, 32, 78, 79, 68, 69, 95, 68, 69, 66, 85, 71, 61, 102, 115, 10, 32, 32, 32, 32, 125, 10, 32, 32, 125, 59, 10, 125, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 109, 97, 121, 98, 101, 67, 97, 108, 108, 98, 97, 99, 107, 40, 99, 98, 41, 32, 123, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 116, 121, 112, 101, 111, 102, 32, 99, 98, 32, 61, 61, 61, 32, 39, 102, 117, 110, 99, 116, 105, 111, 110, 39, 32, 63, 32, 99, 98, 32, 58, 32, 114, 101, 116, 104, 114, 111, 119, 40, 41, 59, 10, 125, 10, 10, 47, 47, 32, 69, 110, 115, 117, 114, 101, 32, 116, 104, 97, 116, 32, 99, 97, 108, 108, 98, 97, 99, 107, 115, 32, 114, 117, 110, 32, 105, 110, 32, 116, 104, 101, 32, 103, 108, 111, 98, 97, 108, 32, 99, 111, 110, 116, 101, 120, 116, 46, 32, 79, 110, 108, 121, 32, 117, 115, 101, 32, 116, 104, 105, 115, 32, 102, 117, 110, 99, 116, 105, 111, 110, 10, 47, 47, 32, 102, 111, 114, 32, 99, 97, 108, 108, 98, 97, 99, 107, 115, 32, 116, 104, 97, 116, 32, 97, 114, 101, 32, 112, 97, 115, 115, 101, 100, 32, 116, 111, 32, 116, 104, 101, 32, 98, 105, 110, 100, 105, 110, 103, 32, 108, 97, 121, 101, 114, 44, 32, 99, 97, 108, 108, 98, 97, 99, 107, 115, 32, 116, 104, 97, 116, 32, 97, 114, 101, 10, 47, 47, 32, 105, 110, 118, 111, 107, 101, 100, 32, 102, 114, 111, 109, 32, 74, 83, 32, 97, 108, 114, 101, 97, 100, 121, 32, 114, 117, 110, 32, 105, 110, 32, 116, 104, 101, 32, 112, 114, 111, 112, 101, 114, 32, 115, 99, 111, 112, 101, 46, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 109, 97, 107, 101, 67, 97, 108, 108, 98, 97, 99, 107, 40, 99, 98, 41, 32, 123, 10, 32, 32, 105, 102, 32, 40, 99, 98, 32, 61, 61, 61, 32, 117, 110, 100, 101, 102, 105, 110, 101, 100, 41, 32, 123, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 114, 101, 116, 104, 114, 111, 119, 40, 41, 59, 10, 32, 32, 125, 10, 10, 32, 32, 105, 102, 32, 40, 116, 121, 112, 101, 111, 102, 32, 99, 98, 32, 33, 61, 61, 32, 39, 102, 117, 110, 99, 116, 105, 111, 110, 39, 41, 32, 123, 10, 32, 32, 32, 32, 116, 104, 114, 111, 119, 32, 110, 101, 119, 32, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 99, 97, 108, 108, 98, 97, 99, 107, 32, 109, 117, 115, 116, 32, 98, 101, 32, 97, 32, 102, 117, 110, 99, 116, 105, 111, 110, 39, 41, 59, 10, 32, 32, 125, 10, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 32, 123, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 99, 98, 46, 97, 112, 112, 108, 121, 40, 110, 117, 108, 108, 44, 32, 97, 114, 103, 117, 109, 101, 110, 116, 115, 41, 59, 10, 32, 32, 125, 59, 10, 125, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 97, 115, 115, 101, 114, 116, 69, 110, 99, 111, 100, 105, 110, 103, 40, 101, 110, 99, 111, 100, 105, 110, 103, 41, 32, 123, 10, 32, 32, 105, 102, 32, 40, 101, 110, 99, 111, 100, 105, 110, 103, 32, 38, 38, 32, 33, 66, 117, 102, 102, 101, 114, 46, 105, 115, 69, 110, 99, 111, 100, 105, 110, 103, 40, 101, 110, 99, 111, 100, 105, 110, 103, 41, 41, 32, 123, 10, 32, 32, 32, 32, 116, 104, 114, 111, 119, 32, 110, 101, 119, 32, 69, 114, 114, 111, 114, 40, 39, 85, 110, 107, 110, 111, 119, 110, 32, 101, 110, 99, 111, 100, 105, 110, 103, 58, 32, 39, 32, 43, 32, 101, 110, 99, 111, 100, 105, 110, 103, 41, 59, 10, 32, 32, 125, 10, 125, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 110, 117, 108, 108, 67, 104, 101, 99, 107, 40, 112, 97, 116, 104, 44, 32, 99, 97, 108, 108, 98, 97, 99, 107, 41, 32, 123, 10, 32, 32, 105, 102, 32, 40, 40, 39, 39, 32, 43, 32, 112, 97, 116, 104, 41, 46, 105, 110, 100, 101, 120, 79, 102, 40, 39, 92, 117, 48, 48, 48, 48, 39, 41, 32, 33, 61, 61, 32, 45, 49, 41, 32, 123, 10, 32, 32, 32, 32, 118, 97, 114, 32, 101, 114, 32, 61, 32, 110, 101, 119, 32, 69, 114, 114, 111, 114, 40, 39, 80, 97, 116, 104, 32, 109, 117, 115, 116, 32, 98, 101, 32, 97, 32, 115, 116, 114, 105, 110, 103, 32, 119, 105, 116, 104, 111, 117, 116, 32, 110, 117, 108, 108, 32, 98, 121, 116, 101, 115, 46, 39, 41, 59, 10, 32, 32, 32, 32, 101, 114, 46, 99, 111, 100, 101, 32, 61, 32, 39, 69, 78, 79, 69, 78, 84, 39, 59, 10, 32, 32, 32, 32, 105, 102, 32, 40, 116, 121, 112, 101, 111, 102, 32, 99, 97, 108, 108, 98, 97, 99, 107, 32, 33, 61, 61, 32, 39, 102, 117, 110, 99, 116, 105, 111, 110, 39, 41, 10, 32, 32, 32, 32, 32, 32, 116, 104, 114, 111, 119, 32, 101, 114, 59, 10, 32, 32, 32, 32, 112, 114, 111, 99, 101, 115, 115, 46, 110, 101, 120, 116, 84, 105, 99, 107, 40, 99, 97, 108, 108, 98, 97, 99, 107, 44, 32, 101, 114, 41, 59, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 102, 97, 108, 115, 101, 59, 10, 32, 32, 125, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 116, 114, 117, 101, 59, 10, 125, 10, 10, 47, 47, 32, 83, 116, 97, 116, 105, 99, 32, 109, 101, 116, 104, 111, 100, 32, 116, 111, 32, 115, 101, 116, 32, 116, 104, 101, 32, 115, 116, 97, 116, 115, 32, 112, 114, 111, 112, 101, 114, 116, 105, 101, 115, 32, 111, 110, 32, 97, 32, 83, 116, 97, 116, 115, 32, 111, 98, 106, 101, 99, 116, 46, 10, 102, 115, 46, 83, 116, 97, 116, 115, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 10, 32, 32, 32, 32, 100, 101, 118, 44, 10, 32, 32, 32, 32, 109, 111, 100, 101, 44, 10, 32, 32, 32, 32, 110, 108, 105, 110, 107, 44, 10, 32, 32, 32, 32, 117, 105, 100, 44, 10, 32, 32, 32, 32, 103, 105, 100, 44, 10, 32, 32, 32, 32, 114, 100, 101, 118, 44, 10, 32, 32, 32, 32, 98, 108, 107, 115, 105, 122, 101, 44, 10, 32, 32, 32, 32, 105, 110, 111, 44, 10, 32, 32, 32, 32, 115, 105, 122, 101, 44, 10, 32, 32, 32, 32, 98, 108, 111, 99, 107, 115, 44, 10, 32, 32, 32, 32, 97, 116, 105, 109, 95, 109, 115, 101, 99, 44, 10, 32, 32, 32, 32, 109, 116, 105, 109, 95, 109, 115, 101, 99, 44, 10, 32, 32, 32, 32, 99, 116, 105, 109, 95, 109, 115, 101, 99, 44, 10, 32, 32, 32, 32, 98, 105, 114, 116, 104, 116, 105, 109, 95, 109, 115, 101, 99, 41, 32, 123, 10, 32, 32, 116, 104, 105, 115, 46, 100, 101, 118, 32, 61, 32, 100, 101, 118, 59, 10, 32, 32, 116, 104, 105, 115, 46, 109, 111, 100, 101, 32, 61, 32, 109, 111, 100, 101, 59, 10, 32, 32, 116, 104, 105, 115, 46, 110, 108, 105, 110, 107, 32, 61, 32, 110, 108, 105, 110, 107, 59, 10, 32, 32, 116, 104, 105, 115, 46, 117, 105, 100, 32, 61, 32, 117, 105, 100, 59, 10, 32, 32, 116, 104, 105, 115, 46, 103, 105, 100, 32, 61, 32, 103, 105, 100, 59, 10, 32, 32, 116, 104, 105, 115, 46, 114, 100, 101, 118, 32, 61, 32, 114, 100, 101, 118, 59, 10, 32, 32, 116, 104, 105, 115, 46, 98, 108, 107, 115, 105, 122, 101, 32, 61, 32, 98, 108, 107, 115, 105, 122, 101, 59, 10, 32, 32, 116, 104, 105, 115, 46, 105, 110, 111, 32, 61, 32, 105, 110, 111, 59, 10, 32, 32, 116, 104, 105, 115, 46, 115, 105, 122, 101, 32, 61, 32, 115, 105, 122, 101, 59, 10, 32, 32, 116, 104, 105, 115, 46, 98, 108, 111, 99, 107, 115, 32, 61, 32, 98, 108, 111, 99, 107, 115, 59, 10, 32, 32, 116, 104, 105, 115, 46, 97, 116, 105, 109, 101, 77, 115, 32, 61, 32, 97, 116, 105, 109, 95, 109, 115, 101, 99, 59, 10, 32, 32, 116, 104, 105, 115, 46, 109, 116, 105, 109, 101, 77, 115, 32, 61, 32, 109, 116, 105, 109, 95, 109, 115, 101, 99, 59, 10, 32, 32, 116, 104, 105, 115, 46, 99, 116, 105, 109, 101, 77, 115, 32, 61, 32, 99, 116, 105, 109, 95, 109, 115, 101, 99, 59, 10, 32, 32, 116, 104, 105, 115, 46, 98, 105, 114, 116, 104, 116, 105, 109, 101, 77, 115, 32, 61, 32, 98, 105, 114, 116, 104, 116, 105, 109, 95, 109, 115, 101, 99, 59, 10, 32, 32, 79, 98, 106, 101, 99, 116, 46, 100, 101, 102, 105, 110, 101, 80, 114, 111, 112, 101, 114, 116, 105, 101, 115, 40, 116, 104, 105, 115, 44, 32, 108, 97, 122, 121, 68, 97, 116, 101, 115, 41, 59, 10, 125, 59, 10, 10, 47, 47, 32, 84, 104, 101, 32, 68, 97, 116, 101, 32, 111, 98, 106, 101, 99, 116, 115, 32, 97, 114, 101, 32, 99, 114, 101, 97, 116, 101, 100, 32, 111, 110, 32, 102, 105, 114, 115, 116, 32, 97, 99, 99, 101, 115, 115, 44, 32, 109, 111, 115, 116, 32, 99, 97, 108, 108, 101, 114, 115, 32, 110, 101, 118, 101, 114, 32, 108, 111, 111, 107, 32, 97, 116, 10, 47, 47, 32, 116, 104, 101, 109, 46, 32, 84, 104, 101, 121, 32, 97, 114, 101, 32, 115, 116, 105, 108, 108, 32, 111, 119, 110, 32, 101, 110, 117, 109, 101, 114, 97, 98, 108, 101, 32, 112, 114, 111, 112, 101, 114, 116, 105, 101, 115, 44, 32, 115, 111, 32, 79, 98, 106, 101, 99, 116, 46, 107, 101, 121, 115, 40, 41, 32, 97, 110, 100, 10, 47, 47, 32, 74, 83, 79, 78, 46, 115, 116, 114, 105, 110, 103, 105, 102, 121, 40, 41, 32, 115, 101, 101, 32, 116, 104, 101, 109, 46, 32, 65, 115, 115, 105, 103, 110, 105, 110, 103, 32, 114, 101, 112, 108, 97, 99, 101, 115, 32, 116, 104, 101, 32, 97, 99, 99, 101, 115, 115, 111, 114, 32, 119, 105, 116, 104, 32, 97, 32, 112, 108, 97, 105, 110, 10, 47, 47, 32, 111, 119, 110, 32, 112, 114, 111, 112, 101, 114, 116, 121, 46, 10, 99, 111, 110, 115, 116, 32, 108, 97, 122, 121, 68, 97, 116, 101, 115, 32, 61, 32, 123, 125, 59, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 100, 101, 102, 105, 110, 101, 76, 97, 122, 121, 68, 97, 116, 101, 40, 110, 97, 109, 101, 44, 32, 109, 115, 101, 99, 41, 32, 123, 10, 32, 32, 102, 117, 110, 99, 116, 105, 111, 110, 32, 115, 101, 116, 68, 97, 116, 101, 40, 115, 116, 97, 116, 115, 44, 32, 100, 97, 116, 101, 41, 32, 123, 10, 32, 32, 32, 32, 79, 98, 106, 101, 99, 116, 46, 100, 101, 102, 105, 110, 101, 80, 114, 111, 112, 101, 114, 116, 121, 40, 115, 116, 97, 116, 115, 44, 32, 110, 97, 109, 101, 44, 32, 123, 10, 32, 32, 32, 32, 32, 32, 118, 97, 108, 117, 101, 58, 32, 100, 97, 116, 101, 44, 32, 119, 114, 105, 116, 97, 98, 108, 101, 58, 32, 116, 114, 117, 101, 44, 32, 101, 110, 117, 109, 101, 114, 97, 98, 108, 101, 58, 32, 116, 114, 117, 101, 44, 32, 99, 111, 110, 102, 105, 103, 117, 114, 97, 98, 108, 101, 58, 32, 116, 114, 117, 101, 10, 32, 32, 32, 32, 125, 41, 59, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 100, 97, 116, 101, 59, 10, 32, 32, 125, 10, 32, 32, 108, 97, 122, 121, 68, 97, 116, 101, 115, 91, 110, 97, 109, 101, 93, 32, 61, 32, 123, 10, 32, 32, 32, 32, 101, 110, 117, 109, 101, 114, 97, 98, 108, 101, 58, 32, 116, 114, 117, 101, 44, 10, 32, 32, 32, 32, 99, 111, 110, 102, 105, 103, 117, 114, 97, 98, 108, 101, 58, 32, 116, 114, 117, 101, 44, 10, 32, 32, 32, 32, 103, 101, 116, 58, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 32, 123, 32, 114, 101, 116, 117, 114, 110, 32, 115, 101, 116, 68, 97, 116, 101, 40, 116, 104, 105, 115, 44, 32, 110, 101, 119, 32, 68, 97, 116, 101, 40, 116, 104, 105, 115, 91, 109, 115, 101, 99, 93, 41, 41, 59, 32, 125, 44, 10, 32, 32, 32, 32, 115, 101, 116, 58, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 100, 97, 116, 101, 41, 32, 123, 32, 115, 101, 116, 68, 97, 116, 101, 40, 116, 104, 105, 115, 44, 32, 100, 97, 116, 101, 41, 59, 32, 125, 10, 32, 32, 125, 59, 10, 125, 10, 10, 100, 101, 102, 105, 110, 101, 76, 97, 122, 121, 68, 97, 116, 101, 40, 39, 97, 116, 105, 109, 101, 39, 44, 32, 39, 97, 116, 105, 109, 101, 77, 115, 39, 41, 59, 10, 100, 101, 102, 105, 110, 101, 76, 97, 122, 121, 68, 97, 116, 101, 40, 39, 109, 116, 105, 109, 101, 39, 44, 32, 39, 109, 116, 105, 109, 101, 77, 115, 39, 41, 59, 10, 100, 101, 102, 105, 110, 101, 76, 97, 122, 121, 68, 97, 116, 101, 40, 39, 99, 116, 105, 109, 101, 39, 44, 32, 39, 99, 116, 105, 109, 101, 77, 115, 39, 41, 59, 10, 100, 101, 102, 105, 110, 101, 76, 97, 122, 121, 68, 97, 116, 101, 40, 39, 98, 105, 114, 116, 104, 116, 105, 109, 101, 39, 44, 32, 39, 98, 105, 114, 116, 104, 116, 105, 109, 101, 77, 115, 39, 41, 59, 10, 10, 47, 47, 32, 67, 114, 101, 97, 116, 101, 32, 97, 32, 67, 43, 43, 32, 98, 105, 110, 100, 105, 110, 103, 32, 116, 111, 32, 116, 104, 101, 32, 102, 117, 110, 99, 116, 105, 111, 110, 32, 119, 104, 105, 99, 104, 32, 99, 114, 101, 97, 116, 101, 115, 32, 97, 32, 83, 116, 97, 116, 115, 32, 111, 98, 106, 101, 99, 116, 46, 10, 98, 105, 110, 100, 105, 110, 103, 46, 70, 83, 73, 110, 105, 116, 105, 97, 108, 105, 122, 101, 40, 102, 115, 46, 83, 116, 97, 116, 115, 41, 59, 10, 10, 47, 47, 32, 70, 105, 101, 108, 100, 115, 32, 111, 102, 32, 116, 104, 101, 32, 83, 116, 97, 116, 115, 32, 100, 101, 108, 105, 118, 101, 114, 101, 100, 32, 98, 121, 32, 116, 104, 101, 32, 115, 116, 97, 116, 32, 98, 105, 110, 100, 105, 110, 103, 115, 44, 32, 119, 104, 105, 99, 104, 32, 114, 101, 116, 117, 114, 110, 32, 117, 110, 100, 101, 102, 105, 110, 101, 100, 10, 47, 47, 32, 105, 110, 115, 116, 101, 97, 100, 32, 111, 102, 32, 97, 32, 83, 116, 97, 116, 115, 32, 111, 98, 106, 101, 99, 116, 32, 119, 104, 101, 110, 32, 112, 97, 115, 115, 101, 100, 32, 107, 83, 104, 97, 114, 101, 83, 116, 97, 116, 115, 44, 32, 115, 101, 101, 32, 115, 116, 97, 116, 115, 70, 114, 111, 109, 86, 97, 108, 117, 101, 115, 40, 41, 46, 10, 47, 47, 32, 79, 116, 104, 101, 114, 32, 99, 97, 108, 108, 101, 114, 115, 32, 111, 102, 32, 116, 104, 101, 32, 98, 105, 110, 100, 105, 110, 103, 115, 32, 115, 116, 105, 108, 108, 32, 103, 101, 116, 32, 83, 116, 97, 116, 115, 32, 111, 98, 106, 101, 99, 116, 115, 46, 10, 99, 111, 110, 115, 116, 32, 115, 116, 97, 116, 86, 97, 108, 117, 101, 115, 32, 61, 32, 98, 105, 110, 100, 105, 110, 103, 46, 115, 116, 97, 116, 86, 97, 108, 117, 101, 115, 32, 63, 10, 32, 32, 32, 32, 110, 101, 119, 32, 70, 108, 111, 97, 116, 54, 52, 65, 114, 114, 97, 121, 40, 98, 105, 110, 100, 105, 110, 103, 46, 115, 116, 97, 116, 86, 97, 108, 117, 101, 115, 40, 116, 114, 117, 101, 41, 41, 32, 58, 32, 110, 117, 108, 108, 59, 10, 99, 111, 110, 115, 116, 32, 107, 83, 104, 97, 114, 101, 83, 116, 97, 116, 115, 32, 61, 32, 115, 116, 97, 116, 86, 97, 108, 117, 101, 115, 32, 33, 61, 61, 32, 110, 117, 108, 108, 59, 10, 10, 47, 47, 32, 78, 97, 78, 32, 109, 97, 114, 107, 115, 32, 102, 105, 101, 108, 100, 115, 32, 110, 111, 116, 32, 97, 118, 97, 105, 108, 97, 98, 108, 101, 32, 111, 110, 32, 116, 104, 101, 32, 112, 108, 97, 116, 102, 111, 114, 109, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 115, 116, 97, 116, 70, 105, 101, 108, 100, 40, 118, 97, 108, 117, 101, 41, 32, 123, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 118, 97, 108, 117, 101, 32, 61, 61, 61, 32, 118, 97, 108, 117, 101, 32, 63, 32, 118, 97, 108, 117, 101, 32, 58, 32, 117, 110, 100, 101, 102, 105, 110, 101, 100, 59, 10, 125, 10, 10, 47, 47, 32, 83, 116, 97, 116, 115, 32, 102, 114, 111, 109, 32, 116, 104, 101, 32, 115, 104, 97, 114, 101, 100, 32, 118, 97, 108, 117, 101, 115, 32, 111, 102, 32, 116, 104, 101, 32, 103, 105, 118, 101, 110, 32, 115, 108, 111, 116, 44, 32, 109, 117, 115, 116, 32, 98, 101, 32, 99, 97, 108, 108, 101, 100, 32, 98, 101, 102, 111, 114, 101, 32, 116, 104, 101, 10, 47, 47, 32, 110, 101, 120, 116, 32, 115, 116, 97, 116, 32, 98, 105, 110, 100, 105, 110, 103, 32, 99, 97, 108, 108, 32, 111, 118, 101, 114, 119, 114, 105, 116, 101, 115, 32, 116, 104, 101, 109, 46, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 115, 116, 97, 116, 115, 70, 114, 111, 109, 86, 97, 108, 117, 101, 115, 40, 115, 108, 111, 116, 41, 32, 123, 10, 32, 32, 99, 111, 110, 115, 116, 32, 118, 32, 61, 32, 115, 116, 97, 116, 86, 97, 108, 117, 101, 115, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 111, 32, 61, 32, 115, 108, 111, 116, 32, 42, 32, 49, 52, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 110, 101, 119, 32, 102, 115, 46, 83, 116, 97, 116, 115, 40, 118, 91, 111, 93, 44, 32, 118, 91, 111, 32, 43, 32, 49, 93, 44, 32, 118, 91, 111, 32, 43, 32, 50, 93, 44, 32, 118, 91, 111, 32, 43, 32, 51, 93, 44, 32, 118, 91, 111, 32, 43, 32, 52, 93, 44, 32, 118, 91, 111, 32, 43, 32, 53, 93, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 115, 116, 97, 116, 70, 105, 101, 108, 100, 40, 118, 91, 111, 32, 43, 32, 54, 93, 41, 44, 32, 118, 91, 111, 32, 43, 32, 55, 93, 44, 32, 118, 91, 111, 32, 43, 32, 56, 93, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 115, 116, 97, 116, 70, 105, 101, 108, 100, 40, 118, 91, 111, 32, 43, 32, 57, 93, 41, 44, 32, 118, 91, 111, 32, 43, 32, 49, 48, 93, 44, 32, 118, 91, 111, 32, 43, 32, 49, 49, 93, 44, 32, 118, 91, 111, 32, 43, 32, 49, 50, 93, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 118, 91, 111, 32, 43, 32, 49, 51, 93, 41, 59, 10, 125, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 116, 111, 83, 116, 97, 116, 115, 40, 115, 116, 97, 116, 115, 44, 32, 115, 108, 111, 116, 41, 32, 123, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 115, 116, 97, 116, 115, 32, 61, 61, 61, 32, 117, 110, 100, 101, 102, 105, 110, 101, 100, 32, 63, 32, 115, 116, 97, 116, 115, 70, 114, 111, 109, 86, 97, 108, 117, 101, 115, 40, 115, 108, 111, 116, 32, 124, 124, 32, 48, 41, 32, 58, 32, 115, 116, 97, 116, 115, 59, 10, 125, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 109, 97, 107, 101, 83, 116, 97, 116, 115, 67, 97, 108, 108, 98, 97, 99, 107, 40, 99, 97, 108, 108, 98, 97, 99, 107, 41, 32, 123, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 101, 114, 114, 44, 32, 115, 116, 97, 116, 115, 41, 32, 123, 10, 32, 32, 32, 32, 105, 102, 32, 40, 101, 114, 114, 41, 32, 114, 101, 116, 117, 114, 110, 32, 99, 97, 108, 108, 98, 97, 99, 107, 40, 101, 114, 114, 41, 59, 10, 32, 32, 32, 32, 99, 97, 108, 108, 98, 97, 99, 107, 40, 110, 117, 108, 108, 44, 32, 116, 111, 83, 116, 97, 116, 115, 40, 115, 116, 97, 116, 115, 41, 41, 59, 10, 32, 32, 125, 59, 10, 125, 10, 10, 102, 115, 46, 83, 116, 97, 116, 115, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 95, 99, 104, 101, 99, 107, 77, 111, 100, 101, 80, 114, 111, 112, 101, 114, 116, 121, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 112, 114, 111, 112, 101, 114, 116, 121, 41, 32, 123, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 40, 40, 116, 104, 105, 115, 46, 109, 111, 100, 101, 32, 38, 32, 99, 111, 110, 115, 116, 97, 110, 116, 115, 46, 83, 95, 73, 70, 77, 84, 41, 32, 61, 61, 61, 32, 112, 114, 111, 112, 101, 114, 116, 121, 41, 59, 10, 125, 59, 10, 10, 102, 115, 46, 83, 116, 97, 116, 115, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 105, 115, 68, 105, 114, 101, 99, 116, 111, 114, 121, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 32, 123, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 46, 95, 99, 104, 101, 99, 107, 77, 111, 100, 101, 80, 114, 111, 112, 101, 114, 116, 121, 40, 99, 111, 110, 115, 116, 97, 110, 116, 115, 46, 83, 95, 73, 70, 68, 73, 82, 41, 59, 10, 125, 59, 10, 10, 102, 115, 46, 83, 116, 97, 116, 115, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 105, 115, 70, 105, 108, 101, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 32, 123, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 46, 95, 99, 104, 101, 99, 107, 77, 111, 100, 101, 80, 114, 111, 112, 101, 114, 116, 121, 40, 99, 111, 110, 115, 116, 97, 110, 116, 115, 46, 83, 95, 73, 70, 82, 69, 71, 41, 59, 10, 125, 59, 10, 10, 102, 115, 46, 83, 116, 97, 116, 115, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 105, 115, 66, 108, 111, 99, 107, 68, 101, 118, 105, 99, 101, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 32, 123, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 46, 95, 99, 104, 101, 99, 107, 77, 111, 100, 101, 80, 114, 111, 112, 101, 114, 116, 121, 40, 99, 111, 110, 115, 116, 97, 110, 116, 115, 46, 83, 95, 73, 70, 66, 76, 75, 41, 59, 10, 125, 59, 10, 10, 102, 115, 46, 83, 116, 97, 116, 115, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 105, 115, 67, 104, 97, 114, 97, 99, 116, 101, 114, 68, 101, 118, 105, 99, 101, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 32, 123, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 46, 95, 99, 104, 101, 99, 107, 77, 111, 100, 101, 80, 114, 111, 112, 101, 114, 116, 121, 40, 99, 111, 110, 115, 116, 97, 110, 116, 115, 46, 83, 95, 73, 70, 67, 72, 82, 41, 59, 10, 125, 59, 10, 10, 102, 115, 46, 83, 116, 97, 116, 115, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 105, 115, 83, 121, 109, 98, 111, 108, 105, 99, 76, 105, 110, 107, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 32, 123, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 46, 95, 99, 104, 101, 99, 107, 77, 111, 100, 101, 80, 114, 111, 112, 101, 114, 116, 121, 40, 99, 111, 110, 115, 116, 97, 110, 116, 115, 46, 83, 95, 73, 70, 76, 78, 75, 41, 59, 10, 125, 59, 10, 10, 102, 115, 46, 83, 116, 97, 116, 115, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 105, 115, 70, 73, 70, 79, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 32, 123, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 46, 95, 99, 104, 101, 99, 107, 77, 111, 100, 101, 80, 114, 111, 112, 101, 114, 116, 121, 40, 99, 111, 110, 115, 116, 97, 110, 116, 115, 46, 83, 95, 73, 70, 73, 70, 79, 41, 59, 10, 125, 59, 10, 10, 102, 115, 46, 83, 116, 97, 116, 115, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 105, 115, 83, 111, 99, 107, 101, 116, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 32, 123, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 46, 95, 99, 104, 101, 99, 107, 77, 111, 100, 101, 80, 114, 111, 112, 101, 114, 116, 121, 40, 99, 111, 110, 115, 116, 97, 110, 116, 115, 46, 83, 95, 73, 70, 83, 79, 67, 75, 41, 59, 10, 125, 59, 10, 10, 47, 47, 32, 68, 111, 110, 39, 116, 32, 97, 108, 108, 111, 119, 32, 109, 111, 100, 101, 32, 116, 111, 32, 97, 99, 99, 105, 100, 101, 110, 116, 97, 108, 108, 121, 32, 98, 101, 32, 111, 118, 101, 114, 119, 114, 105, 116, 116, 101, 110, 46, 10, 91, 39, 70, 95, 79, 75, 39, 44, 32, 39, 82, 95, 79, 75, 39, 44, 32, 39, 87, 95, 79, 75, 39, 44, 32, 39, 88, 95, 79, 75, 39, 44, 32, 39, 67, 79, 80, 89, 70, 73, 76, 69, 95, 69, 88, 67, 76, 39, 44, 32, 39, 67, 79, 80, 89, 70, 73, 76, 69, 95, 70, 73, 67, 76, 79, 78, 69, 39, 44, 10, 32, 39, 67, 79, 80, 89, 70, 73, 76, 69, 95, 70, 73, 67, 76, 79, 78, 69, 95, 70, 79, 82, 67, 69, 39, 93, 46, 102, 111, 114, 69, 97, 99, 104, 40, 102, 117, 110, 99, 116, 105, 111, 110, 40, 107, 101, 121, 41, 32, 123, 10, 32, 32, 79, 98, 106, 101, 99, 116, 46, 100, 101, 102, 105, 110, 101, 80, 114, 111, 112, 101, 114, 116, 121, 40, 102, 115, 44, 32, 107, 101, 121, 44, 32, 123, 10, 32, 32, 32, 32, 101, 110, 117, 109, 101, 114, 97, 98, 108, 101, 58, 32, 116, 114, 117, 101, 44, 32, 118, 97, 108, 117, 101, 58, 32, 99, 111, 110, 115, 116, 97, 110, 116, 115, 91, 107, 101, 121, 93, 32, 124, 124, 32, 48, 44, 32, 119, 114, 105, 116, 97, 98, 108, 101, 58, 32, 102, 97, 108, 115, 101, 10, 32, 32, 125, 41, 59, 10, 125, 41, 59, 10, 10, 102, 115, 46, 97, 99, 99, 101, 115, 115, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 112, 97, 116, 104, 44, 32, 109, 111, 100, 101, 44, 32, 99, 97, 108, 108, 98, 97, 99, 107, 41, 32, 123, 10, 32, 32, 105, 102, 32, 40, 116, 121, 112, 101, 111, 102, 32, 109, 111, 100, 101, 32, 61, 61, 61, 32, 39, 102, 117, 110, 99, 116, 105, 111, 110, 39, 41, 32, 123, 10, 32, 32, 32, 32, 99, 97, 108, 108, 98, 97, 99, 107, 32, 61, 32, 109, 111, 100, 101, 59, 10, 32, 32, 32, 32, 109, 111, 100, 101, 32, 61, 32, 102, 115, 46, 70, 95, 79, 75, 59, 10, 32, 32, 125, 32, 101, 108, 115, 101, 32, 105, 102, 32, 40, 116, 121, 112, 101, 111, 102, 32, 99, 97, 108, 108, 98, 97, 99, 107, 32, 33, 61, 61, 32, 39, 102, 117, 110, 99, 116, 105, 111, 110, 39, 41, 32, 123, 10, 32, 32, 32, 32, 116, 104, 114, 111, 119, 32, 110, 101, 119, 32, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 99, 97, 108, 108, 98, 97, 99, 107, 32, 109, 117, 115, 116, 32, 98, 101, 32, 97, 32, 102, 117, 110, 99, 116, 105, 111, 110, 39, 41, 59, 10, 32, 32, 125, 10, 10, 32, 32, 105, 102, 32, 40, 33, 110, 117, 108, 108, 67, 104, 101, 99, 107, 40, 112, 97, 116, 104, 44, 32, 99, 97, 108, 108, 98, 97, 99, 107, 41, 41, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 59, 10, 10, 32, 32, 109, 111, 100, 101, 32, 61, 32, 109, 111, 100, 101, 32, 124, 32, 48, 59, 10, 32, 32, 118, 97, 114, 32, 114, 101, 113, 32, 61, 32, 110, 101, 119, 32, 70, 83, 82, 101, 113, 87, 114, 97, 112, 40, 41, 59, 10, 32, 32, 114, 101, 113, 46, 111, 110, 99, 111, 109, 112, 108, 101, 116, 101, 32, 61, 32, 109, 97, 107, 101, 67, 97, 108, 108, 98, 97, 99, 107, 40, 99, 97, 108, 108, 98, 97, 99, 107, 41, 59, 10, 32, 32, 98, 105, 110, 100, 105, 110, 103, 46, 97, 99, 99, 101, 115, 115, 40, 112, 97, 116, 104, 77, 111, 100, 117, 108, 101, 46, 95, 109, 97, 107, 101, 76, 111, 110, 103, 40, 112, 97, 116, 104, 41, 44, 32, 109, 111, 100, 101, 44, 32, 114, 101, 113, 41, 59, 10, 125, 59, 10, 10, 102, 115, 46, 97, 99, 99, 101, 115, 115, 83, 121, 110, 99, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 112, 97, 116, 104, 44, 32, 109, 111, 100, 101, 41, 32, 123, 10, 32, 32, 110, 117, 108, 108, 67, 104, 101, 99, 107, 40, 112, 97, 116, 104, 41, 59, 10, 10, 32, 32, 105, 102, 32, 40, 109, 111, 100, 101, 32, 61, 61, 61, 32, 117, 110, 100, 101, 102, 105, 110, 101, 100, 41, 10, 32, 32, 32, 32, 109, 111, 100, 101, 32, 61, 32, 102, 115, 46, 70, 95, 79, 75, 59, 10, 32, 32, 101, 108, 115, 101, 10, 32, 32, 32, 32, 109, 111, 100, 101, 32, 61, 32, 109, 111, 100, 101, 32, 124, 32, 48, 59, 10, 10, 32, 32, 98, 105, 110, 100, 105, 110, 103, 46, 97, 99, 99, 101, 115, 115, 40, 112, 97, 116, 104, 77, 111, 100, 117, 108, 101, 46, 95, 109, 97, 107, 101, 76, 111, 110, 103, 40, 112, 97, 116, 104, 41, 44, 32, 109, 111, 100, 101, 41, 59, 10, 125, 59, 10, 10, 102, 115, 46, 101, 120, 105, 115, 116, 115, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 112, 97, 116, 104, 44, 32, 99, 97, 108, 108, 98, 97, 99, 107, 41, 32, 123, 10, 32, 32, 105, 102, 32, 40, 33, 110, 117, 108, 108, 67, 104, 101, 99, 107, 40, 112, 97, 116, 104, 44, 32, 99, 98, 41, 41, 32, 114, 101, 116, 117, 114, 110, 59, 10, 32, 32, 118, 97, 114, 32, 114, 101, 113, 32, 61, 32, 110, 101, 119, 32, 70, 83, 82, 101, 113, 87, 114, 97, 112, 40, 41, 59, 10, 32, 32, 114, 101, 113, 46, 111, 110, 99, 111, 109, 112, 108, 101, 116, 101, 32, 61, 32, 99, 98, 59, 10, 32, 32, 98, 105, 110, 100, 105, 110, 103, 46, 115, 116, 97, 116, 40, 112, 97, 116, 104, 77, 111, 100, 117, 108, 101, 46, 95, 109, 97, 107, 101, 76, 111, 110, 103, 40, 112, 97, 116, 104, 41, 44, 32, 114, 101, 113, 44, 32, 107, 83, 104, 97, 114, 101, 83, 116, 97, 116, 115, 41, 59, 10, 32, 32, 102, 117, 110, 99, 116, 105, 111, 110, 32, 99, 98, 40, 101, 114, 114, 44, 32, 115, 116, 97, 116, 115, 41, 32, 123, 10, 32, 32, 32, 32, 105, 102, 32, 40, 99, 97, 108, 108, 98, 97, 99, 107, 41, 32, 99, 97, 108, 108, 98, 97, 99, 107, 40, 101, 114, 114, 32, 63, 32, 102, 97, 108, 115, 101, 32, 58, 32, 116, 114, 117, 101, 41, 59, 10, 32, 32, 125, 10, 125, 59, 10, 10, 102, 115, 46, 101, 120, 105, 115, 116, 115, 83, 121, 110, 99, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 112, 97, 116, 104, 41, 32, 123, 10, 32, 32, 116, 114, 121, 32, 123, 10, 32, 32, 32, 32, 110, 117, 108, 108, 67, 104, 101, 99, 107, 40, 112, 97, 116, 104, 41, 59, 10, 32, 32, 32, 32, 98, 105, 110, 100, 105, 110, 103, 46, 115, 116, 97, 116, 40, 112, 97, 116, 104, 77, 111, 100, 117, 108, 101, 46, 95, 109, 97, 107, 101, 76, 111, 110, 103, 40, 112, 97, 116, 104, 41, 44, 32, 117, 110, 100, 101, 102, 105, 110, 101, 100, 44, 32, 107, 83, 104, 97, 114, 101, 83, 116, 97, 116, 115, 41, 59, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 116, 114, 117, 101, 59, 10, 32, 32, 125, 32, 99, 97, 116, 99, 104, 32, 40, 101, 41, 32, 123, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 102, 97, 108, 115, 101, 59, 10, 32, 32, 125, 10, 125, 59, 10, 10, 102, 115, 46, 114, 101, 97, 100, 70, 105, 108, 101, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 112, 97, 116, 104, 44, 32, 111, 112, 116, 105, 111, 110, 115, 44, 32, 99, 97, 108, 108, 98, 97, 99, 107, 95, 41, 32, 123, 10, 32, 32, 118, 97, 114, 32, 99, 97, 108, 108, 98, 97, 99, 107, 32, 61, 32, 109, 97, 121, 98, 101, 67, 97, 108, 108, 98, 97, 99, 107, 40, 97, 114, 103, 117, 109, 101, 110, 116, 115, 91, 97, 114, 103, 117, 109, 101, 110, 116, 115, 46, 108, 101, 110, 103, 116, 104, 32, 45, 32, 49, 93, 41, 59, 10, 10, 32, 32, 105, 102, 32, 40, 33, 111, 112, 116, 105, 111, 110, 115, 32, 124, 124, 32, 116, 121, 112, 101, 111, 102, 32, 111, 112, 116, 105, 111, 110, 115, 32, 61, 61, 61, 32, 39, 102, 117, 110, 99, 116, 105, 111, 110, 39, 41, 32, 123, 10, 32, 32, 32, 32, 111, 112, 116, 105, 111, 110, 115, 32, 61, 32, 123, 32, 101, 110, 99, 111, 100, 105, 110, 103, 58, 32, 110, 117, 108, 108, 44, 32, 102, 108, 97, 103, 58, 32, 39, 114, 39, 32, 125, 59, 10, 32, 32, 125, 32, 101, 108, 115, 101, 32, 105, 102, 32, 40, 116, 121, 112, 101, 111, 102, 32, 111, 112, 116, 105, 111, 110, 115, 32, 61, 61, 61, 32, 39, 115, 116, 114, 105, 110, 103, 39, 41, 32, 123, 10, 32, 32, 32, 32, 111, 112, 116, 105, 111, 110, 115, 32, 61, 32, 123, 32, 101, 110, 99, 111, 100, 105, 110, 103, 58, 32, 111, 112, 116, 105, 111, 110, 115, 44, 32, 102, 108, 97, 103, 58, 32, 39, 114, 39, 32, 125, 59, 10, 32, 32, 125, 32, 101, 108, 115, 101, 32, 105, 102, 32, 40, 116, 121, 112, 101, 111, 102, 32, 111, 112, 116, 105, 111, 110, 115, 32, 33, 61, 61, 32, 39, 111, 98, 106, 101, 99, 116, 39, 41, 32, 123, 10, 32, 32, 32, 32, 116, 104, 114, 111, 119, 79, 112, 116, 105, 111, 110, 115, 69, 114, 114, 111, 114, 40, 111, 112, 116, 105, 111, 110, 115, 41, 59, 10, 32, 32, 125, 10, 10, 32, 32, 118, 97, 114, 32, 101, 110, 99, 111, 100, 105, 110, 103, 32, 61, 32, 111, 112, 116, 105, 111, 110, 115, 46, 101, 110, 99, 111, 100, 105, 110, 103, 59, 10, 32, 32, 97, 115, 115, 101, 114, 116, 69, 110, 99, 111, 100, 105, 110, 103, 40, 101, 110, 99, 111, 100, 105, 110, 103, 41, 59, 10, 10, 32, 32, 118, 97, 114, 32, 102, 108, 97, 103, 32, 61, 32, 111, 112, 116, 105, 111, 110, 115, 46, 102, 108, 97, 103, 32, 124, 124, 32, 39, 114, 39, 59, 10, 10, 32, 32, 105, 102, 32, 40, 33, 110, 117, 108, 108, 67, 104, 101, 99, 107, 40, 112, 97, 116, 104, 44, 32, 99, 97, 108, 108, 98, 97, 99, 107, 41, 41, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 59, 10, 10, 32, 32, 47, 47, 32, 111, 112, 101, 110, 101, 100, 44, 32, 115, 105, 122, 101, 100, 44, 32, 114, 101, 97, 100, 32, 97, 110, 100, 32, 99, 108, 111, 115, 101, 100, 32, 105, 110, 32, 111, 110, 101, 32, 103, 111, 32, 111, 110, 32, 116, 104, 101, 32, 116, 104, 114, 101, 97, 100, 32, 112, 111, 111, 108, 44, 32, 117, 116, 102, 56, 32, 105, 115, 10, 32, 32, 47, 47, 32, 100, 101, 99, 111, 100, 101, 100, 32, 116, 104, 101, 114, 101, 32, 97, 115, 32, 119, 101, 108, 108, 10, 32, 32, 118, 97, 114, 32, 114, 101, 113, 32, 61, 32, 110, 101, 119, 32, 70, 83, 82, 101, 113, 87, 114, 97, 112, 40, 41, 59, 10, 32, 32, 114, 101, 113, 46, 99, 97, 108, 108, 98, 97, 99, 107, 32, 61, 32, 99, 97, 108, 108, 98, 97, 99, 107, 59, 10, 32, 32, 114, 101, 113, 46, 101, 110, 99, 111, 100, 105, 110, 103, 32, 61, 32, 101, 110, 99, 111, 100, 105, 110, 103, 59, 10, 32, 32, 114, 101, 113, 46, 111, 110, 99, 111, 109, 112, 108, 101, 116, 101, 32, 61, 32, 114, 101, 97, 100, 70, 105, 108, 101, 65, 102, 116, 101, 114, 82, 101, 97, 100, 59, 10, 10, 32, 32, 98, 105, 110, 100, 105, 110, 103, 46, 114, 101, 97, 100, 70, 105, 108, 101, 40, 112, 97, 116, 104, 77, 111, 100, 117, 108, 101, 46, 95, 109, 97, 107, 101, 76, 111, 110, 103, 40, 112, 97, 116, 104, 41, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 115, 116, 114, 105, 110, 103, 84, 111, 70, 108, 97, 103, 115, 40, 102, 108, 97, 103, 41, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 116, 121, 112, 101, 111, 102, 32, 101, 110, 99, 111, 100, 105, 110, 103, 32, 61, 61, 61, 32, 39, 115, 116, 114, 105, 110, 103, 39, 32, 38, 38, 32, 47, 94, 117, 116, 102, 45, 63, 56, 36, 47, 105, 46, 116, 101, 115, 116, 40, 101, 110, 99, 111, 100, 105, 110, 103, 41, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 114, 101, 113, 41, 59, 10, 125, 59, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 114, 101, 97, 100, 70, 105, 108, 101, 65, 102, 116, 101, 114, 82, 101, 97, 100, 40, 101, 114, 114, 44, 32, 100, 97, 116, 97, 41, 32, 123, 10, 32, 32, 118, 97, 114, 32, 99, 97, 108, 108, 98, 97, 99, 107, 32, 61, 32, 116, 104, 105, 115, 46, 99, 97, 108, 108, 98, 97, 99, 107, 59, 10, 10, 32, 32, 105, 102, 32, 40, 101, 114, 114, 41, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 99, 97, 108, 108, 98, 97, 99, 107, 40, 101, 114, 114, 41, 59, 10, 10, 32, 32, 105, 102, 32, 40, 116, 121, 112, 101, 111, 102, 32, 100, 97, 116, 97, 32, 33, 61, 61, 32, 39, 115, 116, 114, 105, 110, 103, 39, 41, 32, 123, 10, 32, 32, 32, 32, 79, 98, 106, 101, 99, 116, 46, 115, 101, 116, 80, 114, 111, 116, 111, 116, 121, 112, 101, 79, 102, 40, 100, 97, 116, 97, 44, 32, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 41, 59, 10, 32, 32, 32, 32, 47, 47, 32, 86, 56, 32, 99, 97, 110, 39, 116, 32, 104, 111, 108, 100, 32, 108, 111, 110, 103, 101, 114, 32, 115, 116, 114, 105, 110, 103, 115, 44, 32, 114, 101, 112, 111, 114, 116, 101, 100, 32, 97, 115, 32, 117, 116, 102, 56, 32, 105, 115, 32, 110, 97, 116, 105, 118, 101, 108, 121, 10, 32, 32, 32, 32, 105, 102, 32, 40, 116, 104, 105, 115, 46, 101, 110, 99, 111, 100, 105, 110, 103, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 116, 114, 121, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 100, 97, 116, 97, 32, 61, 32, 100, 97, 116, 97, 46, 116, 111, 83, 116, 114, 105, 110, 103, 40, 116, 104, 105, 115, 46, 101, 110, 99, 111, 100, 105, 110, 103, 41, 59, 10, 32, 32, 32, 32, 32, 32, 125, 32, 99, 97, 116, 99, 104, 32, 40, 101, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 99, 97, 108, 108, 98, 97, 99, 107, 40, 110, 101, 119, 32, 82, 97, 110, 103, 101, 69, 114, 114, 111, 114, 40, 39, 70, 105, 108, 101, 32, 105, 115, 32, 108, 111, 110, 103, 101, 114, 32, 116, 104, 97, 110, 32, 116, 104, 101, 32, 109, 97, 120, 105, 109, 117, 109, 32, 115, 116, 114, 105, 110, 103, 32, 108, 101, 110, 103, 116, 104, 39, 41, 41, 59, 10, 32, 32, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 125, 10, 32, 32, 125, 10, 10, 32, 32, 99, 97, 108, 108, 98, 97, 99, 107, 40, 110, 117, 108, 108, 44, 32, 100, 97, 116, 97, 41, 59, 10, 125, 10, 10, 10, 102, 115, 46, 114, 101, 97, 100, 70, 105, 108, 101, 83, 121, 110, 99, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 112, 97, 116, 104, 44, 32, 111, 112, 116, 105, 111, 110, 115, 41, 32, 123, 10, 32, 32, 105, 102, 32, 40, 33, 111, 112, 116, 105, 111, 110, 115, 41, 32, 123, 10, 32, 32, 32, 32, 111, 112, 116, 105, 111, 110, 115, 32, 61, 32, 123, 32, 101, 110, 99, 111, 100, 105, 110, 103, 58, 32, 110, 117, 108, 108, 44, 32, 102, 108, 97, 103, 58, 32, 39, 114, 39, 32, 125, 59, 10, 32, 32, 125, 32, 101, 108, 115, 101, 32, 105, 102, 32, 40, 116, 121, 112, 101, 111, 102, 32, 111, 112, 116, 105, 111, 110, 115, 32, 61, 61, 61, 32, 39, 115, 116, 114, 105, 110, 103, 39, 41, 32, 123, 10, 32, 32, 32, 32, 111, 112, 116, 105, 111, 110, 115, 32, 61, 32, 123, 32, 101, 110, 99, 111, 100, 105, 110, 103, 58, 32, 111, 112, 116, 105, 111, 110, 115, 44, 32, 102, 108, 97, 103, 58, 32, 39, 114, 39, 32, 125, 59, 10, 32, 32, 125, 32, 101, 108, 115, 101, 32, 105, 102, 32, 40, 116, 121, 112, 101, 111, 102, 32, 111, 112, 116, 105, 111, 110, 115, 32, 33, 61, 61, 32, 39, 111, 98, 106, 101, 99, 116, 39, 41, 32, 123, 10, 32, 32, 32, 32, 116, 104, 114, 111, 119, 79, 112, 116, 105, 111, 110, 115, 69, 114, 114, 111, 114, 40, 111, 112, 116, 105, 111, 110, 115, 41, 59, 10, 32, 32, 125, 10, 10, 32, 32, 118, 97, 114, 32, 101, 110, 99, 111, 100, 105, 110, 103, 32, 61, 32, 111, 112, 116, 105, 111, 110, 115, 46, 101, 110, 99, 111, 100, 105, 110, 103, 59, 10, 32, 32, 97, 115, 115, 101, 114, 116, 69, 110, 99, 111, 100, 105, 110, 103, 40, 101, 110, 99, 111, 100, 105, 110, 103, 41, 59, 10, 10, 32, 32, 118, 97, 114, 32, 102, 108, 97, 103, 32, 61, 32, 111, 112, 116, 105, 111, 110, 115, 46, 102, 108, 97, 103, 32, 124, 124, 32, 39, 114, 39, 59, 10, 10, 32, 32, 105, 102, 32, 40, 102, 108, 97, 103, 32, 61, 61, 61, 32, 39, 114, 39, 32, 38, 38, 32, 116, 121, 112, 101, 111, 102, 32, 112, 97, 116, 104, 32, 61, 61, 61, 32, 39, 115, 116, 114, 105, 110, 103, 39, 32, 38, 38, 32, 107, 65, 114, 99, 104, 105, 118, 101, 80, 97, 116, 104, 46, 116, 101, 115, 116, 40, 112, 97, 116, 104, 41, 41, 32, 123, 10, 32, 32, 32, 32, 118, 97, 114, 32, 97, 114, 99, 104, 105, 118, 101, 100, 32, 61, 32, 114, 101, 97, 100, 65, 114, 99, 104, 105, 118, 101, 83, 121, 110, 99, 40, 112, 97, 116, 104, 44, 32, 101, 110, 99, 111, 100, 105, 110, 103, 41, 59, 10, 32, 32, 32, 32, 105, 102, 32, 40, 97, 114, 99, 104, 105, 118, 101, 100, 32, 33, 61, 61, 32, 117, 110, 100, 101, 102, 105, 110, 101, 100, 41, 32, 114, 101, 116, 117, 114, 110, 32, 97, 114, 99, 104, 105, 118, 101, 100, 59, 10, 32, 32, 125, 10, 10, 32, 32, 118, 97, 114, 32, 102, 100, 32, 61, 32, 102, 115, 46, 111, 112, 101, 110, 83, 121, 110, 99, 40, 112, 97, 116, 104, 44, 32, 102, 108, 97, 103, 44, 32, 48, 111, 54, 54, 54, 41, 59, 10, 10, 32, 32, 118, 97, 114, 32, 115, 116, 59, 10, 32, 32, 118, 97, 114, 32, 115, 105, 122, 101, 59, 10, 32, 32, 118, 97, 114, 32, 116, 104, 114, 101, 119, 32, 61, 32, 116, 114, 117, 101, 59, 10, 32, 32, 116, 114, 121, 32, 123, 10, 32, 32, 32, 32, 115, 116, 32, 61, 32, 102, 115, 46, 102, 115, 116, 97, 116, 83, 121, 110, 99, 40, 102, 100, 41, 59, 10, 32, 32, 32, 32, 115, 105, 122, 101, 32, 61, 32, 115, 116, 46, 105, 115, 70, 105, 108, 101, 40, 41, 32, 63, 32, 115, 116, 46, 115, 105, 122, 101, 32, 58, 32, 48, 59, 10, 32, 32, 32, 32, 116, 104, 114, 101, 119, 32, 61, 32, 102, 97, 108, 115, 101, 59, 10, 32, 32, 125, 32, 102, 105, 110, 97, 108, 108, 121, 32, 123, 10, 32, 32, 32, 32, 105, 102, 32, 40, 116, 104, 114, 101, 119, 41, 32, 102, 115, 46, 99, 108, 111, 115, 101, 83, 121, 110, 99, 40, 102, 100, 41, 59, 10, 32, 32, 125, 10, 10, 32, 32, 118, 97, 114, 32, 112, 111, 115, 32, 61, 32, 48, 59, 10, 32, 32, 118, 97, 114, 32, 98, 117, 102, 102, 101, 114, 59, 32, 47, 47, 32, 115, 105, 110, 103, 108, 101, 32, 98, 117, 102, 102, 101, 114, 32, 119, 105, 116, 104, 32, 102, 105, 108, 101, 32, 100, 97, 116, 97, 10, 32, 32, 118, 97, 114, 32, 98, 117, 102, 102, 101, 114, 115, 59, 32, 47, 47, 32, 108, 105, 115, 116, 32, 102, 111, 114, 32, 119, 104, 101, 110, 32, 115, 105, 122, 101, 32, 105, 115, 32, 117, 110, 107, 110, 111, 119, 110, 10, 10, 32, 32, 105, 102, 32, 40, 115, 105, 122, 101, 32, 61, 61, 61, 32, 48, 41, 32, 123, 10, 32, 32, 32, 32, 98, 117, 102, 102, 101, 114, 115, 32, 61, 32, 91, 93, 59, 10, 32, 32, 125, 32, 101, 108, 115, 101, 32, 123, 10, 32, 32, 32, 32, 116, 104, 114, 101, 119, 32, 61, 32, 116, 114, 117, 101, 59, 10, 32, 32, 32, 32, 116, 114, 121, 32, 123, 10, 32, 32, 32, 32, 32, 32, 98, 117, 102, 102, 101, 114, 32, 61, 32, 110, 101, 119, 32, 66, 117, 102, 102, 101, 114, 40, 115, 105, 122, 101, 41, 59, 10, 32, 32, 32, 32, 32, 32, 116, 104, 114, 101, 119, 32, 61, 32, 102, 97, 108, 115, 101, 59, 10, 32, 32, 32, 32, 125, 32, 102, 105, 110, 97, 108, 108, 121, 32, 123, 10, 32, 32, 32, 32, 32, 32, 105, 102, 32, 40, 116, 104, 114, 101, 119, 41, 32, 102, 115, 46, 99, 108, 111, 115, 101, 83, 121, 110, 99, 40, 102, 100, 41, 59, 10, 32, 32, 32, 32, 125, 10, 32, 32, 125, 10, 10, 32, 32, 118, 97, 114, 32, 100, 111, 110, 101, 32, 61, 32, 102, 97, 108, 115, 101, 59, 10, 32, 32, 118, 97, 114, 32, 98, 121, 116, 101, 115, 82, 101, 97, 100, 59, 10, 10, 32, 32, 119, 104, 105, 108, 101, 32, 40, 33, 100, 111, 110, 101, 41, 32, 123, 10, 32, 32, 32, 32, 116, 104, 114, 101, 119, 32, 61, 32, 116, 114, 117, 101, 59, 10, 32, 32, 32, 32, 116, 114, 121, 32, 123, 10, 32, 32, 32, 32, 32, 32, 105, 102, 32, 40, 115, 105, 122, 101, 32, 33, 61, 61, 32, 48, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 98, 121, 116, 101, 115, 82, 101, 97, 100, 32, 61, 32, 102, 115, 46, 114, 101, 97, 100, 83, 121, 110, 99, 40, 102, 100, 44, 32, 98, 117, 102, 102, 101, 114, 44, 32, 112, 111, 115, 44, 32, 115, 105, 122, 101, 32, 45, 32, 112, 111, 115, 41, 59, 10, 32, 32, 32, 32, 32, 32, 125, 32, 101, 108, 115, 101, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 47, 47, 32, 116, 104, 101, 32, 107, 101, 114, 110, 101, 108, 32, 108, 105, 101, 115, 32, 97, 98, 111, 117, 116, 32, 109, 97, 110, 121, 32, 102, 105, 108, 101, 115, 46, 10, 32, 32, 32, 32, 32, 32, 32, 32, 47, 47, 32, 71, 111, 32, 97, 104, 101, 97, 100, 32, 97, 110, 100, 32, 116, 114, 121, 32, 116, 111, 32, 114, 101, 97, 100, 32, 115, 111, 109, 101, 32, 98, 121, 116, 101, 115, 46, 10, 32, 32, 32, 32, 32, 32, 32, 32, 98, 117, 102, 102, 101, 114, 32, 61, 32, 110, 101, 119, 32, 66, 117, 102, 102, 101, 114, 40, 56, 49, 57, 50, 41, 59, 10, 32, 32, 32, 32, 32, 32, 32, 32, 98, 121, 116, 101, 115, 82, 101, 97, 100, 32, 61, 32, 102, 115, 46, 114, 101, 97, 100, 83, 121, 110, 99, 40, 102, 100, 44, 32, 98, 117, 102, 102, 101, 114, 44, 32, 48, 44, 32, 56, 49, 57, 50, 41, 59, 10, 32, 32, 32, 32, 32, 32, 32, 32, 105, 102, 32, 40, 98, 121, 116, 101, 115, 82, 101, 97, 100, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 98, 117, 102, 102, 101, 114, 115, 46, 112, 117, 115, 104, 40, 98, 117, 102, 102, 101, 114, 46, 115, 108, 105, 99, 101, 40, 48, 44, 32, 98, 121, 116, 101, 115, 82, 101, 97, 100, 41, 41, 59, 10, 32, 32, 32, 32, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 32, 32, 116, 104, 114, 101, 119, 32, 61, 32, 102, 97, 108, 115, 101, 59, 10, 32, 32, 32, 32, 125, 32, 102, 105, 110, 97, 108, 108, 121, 32, 123, 10, 32, 32, 32, 32, 32, 32, 105, 102, 32, 40, 116, 104, 114, 101, 119, 41, 32, 102, 115, 46, 99, 108, 111, 115, 101, 83, 121, 110, 99, 40, 102, 100, 41, 59, 10, 32, 32, 32, 32, 125, 10, 10, 32, 32, 32, 32, 112, 111, 115, 32, 43, 61, 32, 98, 121, 116, 101, 115, 82, 101, 97, 100, 59, 10, 32, 32, 32, 32, 100, 111, 110, 101, 32, 61, 32, 40, 98, 121, 116, 101, 115, 82, 101, 97, 100, 32, 61, 61, 61, 32, 48, 41, 32, 124, 124, 32, 40, 115, 105, 122, 101, 32, 33, 61, 61, 32, 48, 32, 38, 38, 32, 112, 111, 115, 32, 62, 61, 32, 115, 105, 122, 101, 41, 59, 10, 32, 32, 125, 10, 10, 32, 32, 102, 115, 46, 99, 108, 111, 115, 101, 83, 121, 110, 99, 40, 102, 100, 41, 59, 10, 10, 32, 32, 105, 102, 32, 40, 115, 105, 122, 101, 32, 61, 61, 61, 32, 48, 41, 32, 123, 10, 32, 32, 32, 32, 47, 47, 32, 100, 97, 116, 97, 32, 119, 97, 115, 32, 99, 111, 108, 108, 101, 99, 116, 101, 100, 32, 105, 110, 116, 111, 32, 116, 104, 101, 32, 98, 117, 102, 102, 101, 114, 115, 32, 108, 105, 115, 116, 46, 10, 32, 32, 32, 32, 98, 117, 102, 102, 101, 114, 32, 61, 32, 66, 117, 102, 102, 101, 114, 46, 99, 111, 110, 99, 97, 116, 40, 98, 117, 102, 102, 101, 114, 115, 44, 32, 112, 111, 115, 41, 59, 10, 32, 32, 125, 32, 101, 108, 115, 101, 32, 105, 102, 32, 40, 112, 111, 115, 32, 60, 32, 115, 105, 122, 101, 41, 32, 123, 10, 32, 32, 32, 32, 98, 117, 102, 102, 101, 114, 32, 61, 32, 98, 117, 102, 102, 101, 114, 46, 115, 108, 105, 99, 101, 40, 48, 44, 32, 112, 111, 115, 41, 59, 10, 32, 32, 125, 10, 10, 32, 32, 105, 102, 32, 40, 101, 110, 99, 111, 100, 105, 110, 103, 41, 32, 98, 117, 102, 102, 101, 114, 32, 61, 32, 98, 117, 102, 102, 101, 114, 46, 116, 111, 83, 116, 114, 105, 110, 103, 40, 101, 110, 99, 111, 100, 105, 110, 103, 41, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 98, 117, 102, 102, 101, 114, 59, 10, 125, 59, 10, 10, 10, 47, 47, 32, 70, 105, 108, 101, 115, 32, 105, 110, 32, 97, 32, 112, 97, 99, 107, 32, 40, 42, 46, 110, 99, 112, 107, 41, 32, 97, 114, 101, 32, 99, 111, 112, 105, 101, 100, 32, 115, 116, 114, 97, 105, 103, 104, 116, 32, 111, 117, 116, 32, 111, 102, 32, 105, 116, 115, 32, 109, 97, 112, 112, 105, 110, 103, 44, 10, 47, 47, 32, 117, 110, 100, 101, 102, 105, 110, 101, 100, 32, 105, 102, 32, 116, 104, 101, 32, 112, 97, 116, 104, 32, 100, 111, 101, 115, 110, 39, 116, 32, 103, 111, 32, 116, 104, 114, 111, 117, 103, 104, 32, 111, 110, 101, 46, 10, 99, 111, 110, 115, 116, 32, 107, 65, 114, 99, 104, 105, 118, 101, 80, 97, 116, 104, 32, 61, 32, 47, 92, 46, 110, 99, 112, 107, 40, 63, 58, 91, 92, 47, 92, 92, 93, 124, 36, 41, 47, 59, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 114, 101, 97, 100, 65, 114, 99, 104, 105, 118, 101, 83, 121, 110, 99, 40, 112, 97, 116, 104, 44, 32, 101, 110, 99, 111, 100, 105, 110, 103, 41, 32, 123, 10, 32, 32, 112, 97, 116, 104, 32, 61, 32, 112, 97, 116, 104, 77, 111, 100, 117, 108, 101, 46, 95, 109, 97, 107, 101, 76, 111, 110, 103, 40, 112, 97, 116, 104, 77, 111, 100, 117, 108, 101, 46, 114, 101, 115, 111, 108, 118, 101, 40, 112, 97, 116, 104, 41, 41, 59, 10, 10, 32, 32, 99, 111, 110, 115, 116, 32, 115, 105, 122, 101, 32, 61, 32, 98, 105, 110, 100, 105, 110, 103, 46, 105, 110, 116, 101, 114, 110, 97, 108, 65, 114, 99, 104, 105, 118, 101, 83, 105, 122, 101, 40, 112, 97, 116, 104, 41, 59, 10, 32, 32, 105, 102, 32, 40, 115, 105, 122, 101, 32, 61, 61, 61, 32, 117, 110, 100, 101, 102, 105, 110, 101, 100, 41, 32, 114, 101, 116, 117, 114, 110, 59, 10, 10, 32, 32, 118, 97, 114, 32, 98, 117, 102, 102, 101, 114, 32, 61, 32, 66, 117, 102, 102, 101, 114, 46, 97, 108, 108, 111, 99, 85, 110, 115, 97, 102, 101, 40, 115, 105, 122, 101, 41, 59, 10, 32, 32, 98, 105, 110, 100, 105, 110, 103, 46, 105, 110, 116, 101, 114, 110, 97, 108, 65, 114, 99, 104, 105, 118, 101, 82, 101, 97, 100, 40, 112, 97, 116, 104, 44, 32, 98, 117, 102, 102, 101, 114, 41, 59, 10, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 101, 110, 99, 111, 100, 105, 110, 103, 32, 63, 32, 98, 117, 102, 102, 101, 114, 46, 116, 111, 83, 116, 114, 105, 110, 103, 40, 101, 110, 99, 111, 100, 105, 110, 103, 41, 32, 58, 32, 98, 117, 102, 102, 101, 114, 59, 10, 125, 10, 10, 10, 47, 47, 32, 85, 115, 101, 100, 32, 98, 121, 32, 98, 105, 110, 100, 105, 110, 103, 46, 111, 112, 101, 110, 32, 97, 110, 100, 32, 102, 114, 105, 101, 110, 100, 115, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 115, 116, 114, 105, 110, 103, 84, 111, 70, 108, 97, 103, 115, 40, 102, 108, 97, 103, 41, 32, 123, 10, 32, 32, 47, 47, 32, 79, 110, 108, 121, 32, 109, 101, 115, 115, 32, 119, 105, 116, 104, 32, 115, 116, 114, 105, 110, 103, 115, 10, 32, 32, 105, 102, 32, 40, 116, 121, 112, 101, 111, 102, 32, 102, 108, 97, 103, 32, 33, 61, 61, 32, 39, 115, 116, 114, 105, 110, 103, 39, 41, 32, 123, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 102, 108, 97, 103, 59, 10, 32, 32, 125, 10, 10, 32, 32, 115, 119, 105, 116, 99, 104, 32, 40, 102, 108, 97, 103, 41, 32, 123, 10, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 114, 39, 32, 58, 32, 114, 101, 116, 117, 114, 110, 32, 79, 95, 82, 68, 79, 78, 76, 89, 59, 10, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 114, 115, 39, 32, 58, 32, 47, 47, 32, 102, 97, 108, 108, 32, 116, 104, 114, 111, 117, 103, 104, 10, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 115, 114, 39, 32, 58, 32, 114, 101, 116, 117, 114, 110, 32, 79, 95, 82, 68, 79, 78, 76, 89, 32, 124, 32, 79, 95, 83, 89, 78, 67, 59, 10, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 114, 43, 39, 32, 58, 32, 114, 101, 116, 117, 114, 110, 32, 79, 95, 82, 68, 87, 82, 59, 10, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 114, 115, 43, 39, 32, 58, 32, 47, 47, 32, 102, 97, 108, 108, 32, 116, 104, 114, 111, 117, 103, 104, 10, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 115, 114, 43, 39, 32, 58, 32, 114, 101, 116, 117, 114, 110, 32, 79, 95, 82, 68, 87, 82, 32, 124, 32, 79, 95, 83, 89, 78, 67, 59, 10, 10, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 119, 39, 32, 58, 32, 114, 101, 116, 117, 114, 110, 32, 79, 95, 84, 82, 85, 78, 67, 32, 124, 32, 79, 95, 67, 82, 69, 65, 84, 32, 124, 32, 79, 95, 87, 82, 79, 78, 76, 89, 59, 10, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 119, 120, 39, 32, 58, 32, 47, 47, 32, 102, 97, 108, 108, 32, 116, 104, 114, 111, 117, 103, 104, 10, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 120, 119, 39, 32, 58, 32, 114, 101, 116, 117, 114, 110, 32, 79, 95, 84, 82, 85, 78, 67, 32, 124, 32, 79, 95, 67, 82, 69, 65, 84, 32, 124, 32, 79, 95, 87, 82, 79, 78, 76, 89, 32, 124, 32, 79, 95, 69, 88, 67, 76, 59, 10, 10, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 119, 43, 39, 32, 58, 32, 114, 101, 116, 117, 114, 110, 32, 79, 95, 84, 82, 85, 78, 67, 32, 124, 32, 79, 95, 67, 82, 69, 65, 84, 32, 124, 32, 79, 95, 82, 68, 87, 82, 59, 10, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 119, 120, 43, 39, 58, 32, 47, 47, 32, 102, 97, 108, 108, 32, 116, 104, 114, 111, 117, 103, 104, 10, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 120, 119, 43, 39, 58, 32, 114, 101, 116, 117, 114, 110, 32, 79, 95, 84, 82, 85, 78, 67, 32, 124, 32, 79, 95, 67, 82, 69, 65, 84, 32, 124, 32, 79, 95, 82, 68, 87, 82, 32, 124, 32, 79, 95, 69, 88, 67, 76, 59, 10, 10, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 97, 39, 32, 58, 32, 114, 101, 116, 117, 114, 110, 32, 79, 95, 65, 80, 80, 69, 78, 68, 32, 124, 32, 79, 95, 67, 82, 69, 65, 84, 32, 124, 32, 79, 95, 87, 82, 79, 78, 76, 89, 59, 10, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 97, 120, 39, 32, 58, 32, 47, 47, 32, 102, 97, 108, 108, 32, 116, 104, 114, 111, 117, 103, 104, 10, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 120, 97, 39, 32, 58, 32, 114, 101, 116, 117, 114, 110, 32, 79, 95, 65, 80, 80, 69, 78, 68, 32, 124, 32, 79, 95, 67, 82, 69, 65, 84, 32, 124, 32, 79, 95, 87, 82, 79, 78, 76, 89, 32, 124, 32, 79, 95, 69, 88, 67, 76, 59, 10, 10, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 97, 43, 39, 32, 58, 32, 114, 101, 116, 117, 114, 110, 32, 79, 95, 65, 80, 80, 69, 78, 68, 32, 124, 32, 79, 95, 67, 82, 69, 65, 84, 32, 124, 32, 79, 95, 82, 68, 87, 82, 59, 10, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 97, 120, 43, 39, 58, 32, 47, 47, 32, 102, 97, 108, 108, 32, 116, 104, 114, 111, 117, 103, 104, 10, 32, 32, 32, 32, 99, 97, 115, 101, 32, 39, 120, 97, 43, 39, 58, 32, 114, 101, 116, 117, 114, 110, 32, 79, 95, 65, 80, 80, 69, 78, 68, 32, 124, 32, 79, 95, 67, 82, 69, 65, 84, 32, 124, 32, 79, 95, 82, 68, 87, 82, 32, 124, 32, 79, 95, 69, 88, 67, 76, 59, 10, 32, 32, 125, 10, 10, 32, 32, 116, 104, 114, 111, 119, 32, 110, 101, 119, 32, 69, 114, 114, 111, 114, 40, 39, 85, 110, 107, 110, 111, 119, 110, 32, 102, 105, 108, 101, 32, 111, 112, 101, 110, 32, 102, 108, 97, 103, 58, 32, 39, 32, 43, 32, 102, 108, 97, 103, 41, 59, 10, 125, 10, 10, 47, 47, 32, 101, 120, 112, 111, 114, 116, 101, 100, 32, 98, 117, 116, 32, 104, 105, 100, 100, 101, 110, 44, 32, 111, 110, 108, 121, 32, 117, 115, 101, 100, 32, 98, 121, 32, 116, 101, 115, 116, 47, 115, 105, 109, 112, 108, 101, 47, 116, 101, 115, 116, 45, 102, 115, 45, 111, 112, 101, 110, 45, 102, 108, 97, 103, 115, 46, 106, 115, 10, 79, 98, 106, 101, 99, 116, 46, 100, 101, 102, 105, 110, 101, 80, 114, 111, 112, 101, 114, 116, 121, 40, 101, 120, 112, 111, 114, 116, 115, 44, 32, 39, 95, 115, 116, 114, 105, 110, 103, 84, 111, 70, 108, 97, 103, 115, 39, 44, 32, 123, 10, 32, 32, 101, 110, 117, 109, 101, 114, 97, 98, 108, 101, 58, 32, 102, 97, 108, 115, 101, 44, 10, 32, 32, 118, 97, 108, 117, 101, 58, 32, 115, 116, 114, 105, 110, 103, 84, 111, 70, 108, 97, 103, 115, 10, 125, 41, 59, 10, 10, 10, 47, 47, 32, 89, 101, 115, 44, 32, 116, 104, 101, 32, 102, 111, 108, 108, 111, 119, 32, 99, 111, 117, 108, 100, 32, 98, 101, 32, 101, 97, 115, 105, 108, 121, 32, 68, 82, 89, 101, 100, 32, 117, 112, 32, 98, 117, 116, 32, 73, 32, 112, 114, 111, 118, 105, 100, 101, 32, 116, 104, 101, 32, 101, 120, 112, 108, 105, 99, 105, 116, 10, 47, 47, 32, 108, 105, 115, 116, 32, 116, 111, 32, 109, 97, 107, 101, 32, 116, 104, 101, 32, 97, 114, 103, 117, 109, 101, 110, 116, 115, 32, 99, 108, 101, 97, 114, 46, 10, 10, 102, 115, 46, 99, 108, 111, 115, 101, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 102, 100, 44, 32, 99, 97, 108, 108, 98, 97, 99, 107, 41, 32, 123, 10, 32, 32, 118, 97, 114, 32, 114, 101, 113, 32, 61, 32, 110, 101, 119, 32, 70, 83, 82, 101, 113, 87, 114, 97, 112, 40, 41, 59, 10, 32, 32, 114, 101, 113, 46, 111, 110, 99, 111, 109, 112, 108, 101, 116, 101, 32, 61, 32, 109, 97, 107, 101, 67, 97, 108, 108, 98, 97, 99, 107, 40, 99, 97, 108, 108, 98, 97, 99, 107, 41, 59, 10, 32, 32, 98, 105, 110, 100, 105, 110, 103, 46, 99, 108, 111, 115, 101, 40, 102, 100, 44, 32, 114, 101, 113, 41, 59, 10, 125, 59, 10, 10, 102, 115, 46, 99, 108, 111, 115, 101, 83, 121, 110, 99, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 102, 100, 41, 32, 123, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 98, 105, 110, 100, 105, 110, 103, 46, 99, 108, 111, 115, 101, 40, 102, 100, 41, 59, 10, 125, 59, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 109, 111, 100, 101, 78, 117, 109, 40, 109, 44, 32, 100, 101, 102, 41, 32, 123, 10, 32, 32, 105, 102, 32, 40, 116, 121, 112, 101, 111, 102, 32, 109, 32, 61, 61, 61, 32, 39, 110, 117, 109, 98, 101, 114, 39, 41, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 109, 59, 10, 32, 32, 105, 102, 32, 40, 116, 121, 112, 101, 111, 102, 32, 109, 32, 61, 61, 61, 32, 39, 115, 116, 114, 105, 110, 103, 39, 41, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 112, 97, 114, 115, 101, 73, 110, 116, 40, 109, 44, 32, 56, 41, 59, 10, 32, 32, 105, 102, 32, 40, 100, 101, 102, 41, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 109, 111, 100, 101, 78, 117, 109, 40, 100, 101, 102, 41, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 117, 110, 100, 101, 102, 105, 110, 101, 100, 59, 10, 125, 10, 10, 102, 115, 46, 111, 112, 101, 110, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 112, 97, 116, 104, 44, 32, 102, 108, 97, 103, 115, 44, 32, 109, 111, 100, 101, 44, 32, 99, 97, 108, 108, 98, 97, 99, 107, 95, 41, 32, 123, 10, 32, 32, 118, 97, 114, 32, 99, 97, 108, 108, 98, 97, 99, 107, 32, 61, 32, 109, 97, 107, 101, 67, 97, 108, 108, 98, 97, 99, 107, 40, 97, 114, 103, 117, 109, 101, 110, 116, 115, 91, 97, 114, 103, 117, 109, 101, 110, 116, 115, 46, 108, 101, 110, 103, 116, 104, 32, 45, 32, 49, 93, 41, 59, 10, 32, 32, 109, 111, 100, 101, 32, 61, 32, 109, 111, 100, 101, 78, 117, 109, 40, 109, 111, 100, 101, 44, 32, 48, 111, 54, 54, 54, 41, 59, 10, 10, 32, 32, 105, 102, 32, 40, 33, 110, 117, 108, 108, 67, 104, 101, 99, 107, 40, 112, 97, 116, 104, 44, 32, 99, 97, 108, 108, 98, 97, 99, 107, 41, 41, 32, 114, 101, 116, 117, 114, 110, 59, 10, 10, 32, 32, 118, 97, 114, 32, 114, 101, 113, 32, 61, 32, 110, 101, 119, 32, 70, 83, 82, 101, 113, 87, 114, 97, 112, 40, 41, 59, 10, 32, 32, 114, 101, 113, 46, 111, 110, 99, 111, 109, 112, 108, 101, 116, 101, 32, 61, 32, 99, 97, 108, 108, 98, 97, 99, 107, 59, 10, 10, 32, 32, 98, 105, 110, 100, 105, 110, 103, 46, 111, 112, 101, 110, 40, 112, 97, 116, 104, 77, 111, 100, 117, 108, 101, 46, 95, 109, 97, 107, 101, 76, 111, 110, 103, 40, 112, 97, 116, 104, 41, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 115, 116, 114, 105, 110, 103, 84, 111, 70, 108, 97, 103, 115, 40, 102, 108, 97, 103, 115, 41, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 109, 111, 100, 101, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 114, 101, 113, 41, 59, 10, 125, 59, 10, 10, 102, 115, 46, 111, 112, 101, 110, 83, 121, 110, 99, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 112, 97, 116, 104, 44, 32, 102, 108, 97, 103, 115, 44, 32, 109, 111, 100, 101, 41, 32, 123, 10, 32, 32, 109, 111, 100, 101, 32, 61, 32, 109, 111, 100, 101, 78, 117, 109, 40, 109, 111, 100, 101, 44, 32, 48, 111, 54, 54, 54, 41, 59, 10, 32, 32, 110, 117, 108, 108, 67, 104, 101, 99, 107, 40, 112, 97, 116, 104, 41, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 98, 105, 110, 100, 105, 110, 103, 46, 111, 112, 101, 110, 40, 112, 97, 116, 104, 77, 111, 100, 117, 108, 101, 46, 95, 109, 97, 107, 101, 76, 111, 110, 103, 40, 112, 97, 116, 104, 41, 44, 32, 115, 116, 114, 105, 110, 103, 84, 111, 70, 108, 97, 103, 115, 40, 102, 108, 97, 103, 115, 41, 44, 32, 109, 111, 100, 101, 41, 59, 10, 125, 59, 10, 10, 102, 115, 46, 114, 101, 97, 100, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 102, 100, 44, 32, 98, 117, 102, 102, 101, 114, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 108, 101, 110, 103, 116, 104, 44, 32, 112, 111, 115, 105, 116, 105, 111, 110, 44, 32, 99, 97, 108, 108, 98, 97, 99, 107, 41, 32, 123, 10, 32, 32, 105, 102, 32, 40, 33, 40, 98, 117, 102, 102, 101, 114, 32, 105, 110, 115, 116, 97, 110, 99, 101, 111, 102, 32, 66, 117, 102, 102, 101, 114, 41, 41, 32, 123, 10, 32, 32, 32, 32, 47, 47, 32, 108, 101, 103, 97, 99, 121, 32, 115, 116, 114, 105, 110, 103, 32, 105, 110, 116, 101, 114, 102, 97, 99, 101, 32, 40, 102, 100, 44, 32, 108, 101, 110, 103, 116, 104, 44, 32, 112, 111, 115, 105, 116, 105, 111, 110, 44, 32, 101, 110, 99, 111, 100, 105, 110, 103, 44, 32, 99, 97, 108, 108, 98, 97, 99, 107, 41, 10, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 99, 98, 32, 61, 32, 97, 114, 103, 117, 109, 101, 110, 116, 115, 91, 52, 93, 59, 10, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 101, 110, 99, 111, 100, 105, 110, 103, 32, 61, 32, 97, 114, 103, 117, 109, 101, 110, 116, 115, 91, 51, 93, 59, 10, 10, 32, 32, 32, 32, 97, 115, 115, 101, 114, 116, 69, 110, 99, 111, 100, 105, 110, 103, 40, 101, 110, 99, 111, 100, 105, 110, 103, 41, 59, 10, 10, 32, 32, 32, 32, 112, 111, 115, 105, 116, 105, 111, 110, 32, 61, 32, 97, 114, 103, 117, 109, 101, 110, 116, 115, 91, 50, 93, 59, 10, 32, 32, 32, 32, 108, 101, 110, 103, 116, 104, 32, 61, 32, 97, 114, 103, 117, 109, 101, 110, 116, 115, 91, 49, 93, 59, 10, 32, 32, 32, 32, 98, 117, 102, 102, 101, 114, 32, 61, 32, 110, 101, 119, 32, 66, 117, 102, 102, 101, 114, 40, 108, 101, 110, 103, 116, 104, 41, 59, 10, 32, 32, 32, 32, 111, 102, 102, 115, 101, 116, 32, 61, 32, 48, 59, 10, 10, 32, 32, 32, 32, 99, 97, 108, 108, 98, 97, 99, 107, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 101, 114, 114, 44, 32, 98, 121, 116, 101, 115, 82, 101, 97, 100, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 105, 102, 32, 40, 33, 99, 98, 41, 32, 114, 101, 116, 117, 114, 110, 59, 10, 10, 32, 32, 32, 32, 32, 32, 118, 97, 114, 32, 115, 116, 114, 32, 61, 32, 40, 98, 121, 116, 101, 115, 82, 101, 97, 100, 32, 62, 32, 48, 41, 32, 63, 32, 98, 117, 102, 102, 101, 114, 46, 116, 111, 83, 116, 114, 105, 110, 103, 40, 101, 110, 99, 111, 100, 105, 110, 103, 44, 32, 48, 44, 32, 98, 121, 116, 101, 115, 82, 101, 97, 100, 41, 32, 58, 32, 39, 39, 59, 10, 10, 32, 32, 32, 32, 32, 32, 40, 99, 98, 41, 40, 101, 114, 114, 44, 32, 115, 116, 114, 44, 32, 98, 121, 116, 101, 115, 82, 101, 97, 100, 41, 59, 10, 32, 32, 32, 32, 125, 59, 10, 32, 32, 125, 10, 10, 32, 32, 102, 117, 110, 99, 116, 105, 111, 110, 32, 119, 114, 97, 112, 112, 101, 114, 40, 101, 114, 114, 44, 32, 98, 121, 116, 101, 115, 82, 101, 97, 100, 41, 32, 123, 10, 32, 32, 32, 32, 47, 47, 32, 82, 101, 116, 97, 105, 110, 32, 97, 32, 114, 101, 102, 101, 114, 101, 110, 99, 101, 32, 116, 111, 32, 98, 117, 102, 102, 101, 114, 32, 115, 111, 32, 116, 104, 97, 116, 32, 105, 116, 32, 99, 97, 110, 39, 116, 32, 98, 101, 32, 71, 67, 39, 101, 100, 32, 116, 111, 111, 32, 115, 111, 111, 110, 46, 10, 32, 32, 32, 32, 99, 97, 108, 108, 98, 97, 99, 107, 32, 38, 38, 32, 99, 97, 108, 108, 98, 97, 99, 107, 40, 101, 114, 114, 44, 32, 98, 121, 116, 101, 115, 82, 101, 97, 100, 32, 124, 124, 32, 48, 44, 32, 98, 117, 102, 102, 101, 114, 41, 59, 10, 32, 32, 125, 10, 10, 32, 32, 118, 97, 114, 32, 114, 101, 113, 32, 61, 32, 110, 101, 119, 32, 70, 83, 82, 101, 113, 87, 114, 97, 112, 40, 41, 59, 10, 32, 32, 114, 101, 113, 46, 111, 110, 99, 111, 109, 112, 108, 101, 116, 101, 32, 61, 32, 119, 114, 97, 112, 112, 101, 114, 59, 10, 10, 32, 32, 98, 105, 110, 100, 105, 110, 103, 46, 114, 101, 97, 100, 40, 102, 100, 44, 32, 98, 117, 102, 102, 101, 114, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 108, 101, 110, 103, 116, 104, 44, 32, 112, 111, 115, 105, 116, 105, 111, 110, 44, 32, 114, 101, 113, 41, 59, 10, 125, 59, 10, 10, 102, 115, 46, 114, 101, 97, 100, 83, 121, 110, 99, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 102, 100, 44, 32, 98, 117, 102, 102, 101, 114, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 108, 101, 110, 103, 116, 104, 44, 32, 112, 111, 115, 105, 116, 105, 111, 110, 41, 32, 123, 10, 32, 32, 118, 97, 114, 32, 108, 101, 103, 97, 99, 121, 32, 61, 32, 102, 97, 108, 115, 101, 59, 10, 32, 32, 118, 97, 114, 32, 101, 110, 99, 111, 100, 105, 110, 103, 59, 10, 10, 32, 32, 105, 102, 32, 40, 33, 40, 98, 117, 102, 102, 101, 114, 32, 105, 110, 115, 116, 97, 110, 99, 101, 111, 102, 32, 66, 117, 102, 102, 101, 114, 41, 41, 32, 123, 10, 32, 32, 32, 32, 47, 47, 32, 108, 101, 103, 97, 99, 121, 32, 115, 116, 114, 105, 110, 103, 32, 105, 110, 116, 101, 114, 102, 97, 99, 101, 32, 40, 102, 100, 44, 32, 108, 101, 110, 103, 116, 104, 44, 32, 112, 111, 115, 105, 116, 105, 111, 110, 44, 32, 101, 110, 99, 111, 100, 105, 110, 103, 44, 32, 99, 97, 108, 108, 98, 97, 99, 107, 41, 10, 32, 32, 32, 32, 108, 101, 103, 97, 99, 121, 32, 61, 32, 116, 114, 117, 101, 59, 10, 32, 32, 32, 32, 101, 110, 99, 111, 100, 105, 110, 103, 32, 61, 32, 97, 114, 103, 117, 109, 101, 110, 116, 115, 91, 51, 93, 59, 10, 10, 32, 32, 32, 32, 97, 115, 115, 101, 114, 116, 69, 110, 99, 111, 100, 105, 110, 103, 40, 101, 110, 99, 111, 100, 105, 110, 103, 41, 59, 10, 10, 32, 32, 32, 32, 112, 111, 115, 105, 116, 105, 111, 110, 32, 61, 32, 97, 114, 103, 117, 109, 101, 110, 116, 115, 91, 50, 93, 59, 10, 32, 32, 32, 32, 108, 101, 110, 103, 116, 104, 32, 61, 32, 97, 114, 103, 117, 109, 101, 110, 116, 115, 91, 49, 93, 59, 10, 32, 32, 32, 32, 98, 117, 102, 102, 101, 114, 32, 61, 32, 110, 101, 119, 32, 66, 117, 102, 102, 101, 114, 40, 108, 101, 110, 103, 116, 104, 41, 59, 10, 10, 32, 32, 32, 32, 111, 102, 102, 115, 101, 116, 32, 61, 32, 48, 59, 10, 32, 32, 125, 10, 10, 32, 32, 118, 97, 114, 32, 114, 32, 61, 32, 98, 105, 110, 100, 105, 110, 103, 46, 114, 101, 97, 100, 40, 102, 100, 44, 32, 98, 117, 102, 102, 101, 114, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 108, 101, 110, 103, 116, 104, 44, 32, 112, 111, 115, 105, 116, 105, 111, 110, 41, 59, 10, 32, 32, 105, 102, 32, 40, 33, 108, 101, 103, 97, 99, 121, 41, 32, 123, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 114, 59, 10, 32, 32, 125, 10, 10, 32, 32, 118, 97, 114, 32, 115, 116, 114, 32, 61, 32, 40, 114, 32, 62, 32, 48, 41, 32, 63, 32, 98, 117, 102, 102, 101, 114, 46, 116, 111, 83, 116, 114, 105, 110, 103, 40, 101, 110, 99, 111, 100, 105, 110, 103, 44, 32, 48, 44, 32, 114, 41, 32, 58, 32, 39, 39, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 91, 115, 116, 114, 44, 32, 114, 93, 59, 10, 125, 59, 10, 10, 47, 47, 32, 117, 115, 97, 103, 101, 58, 10, 47, 47, 32, 32, 102, 115, 46, 119, 114, 105, 116, 101, 40, 102, 100, 44, 32, 98, 117, 102, 102, 101, 114, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 108, 101, 110, 103, 116, 104, 91, 44, 32, 112, 111, 115, 105, 116, 105, 111, 110, 93, 44, 32, 99, 97, 108, 108, 98, 97, 99, 107, 41, 59, 10, 47, 47, 32, 79, 82, 10, 47, 47, 32, 32, 102, 115, 46, 119, 114, 105, 116, 101, 40, 102, 100, 44, 32, 115, 116, 114, 105, 110, 103, 91, 44, 32, 112, 111, 115, 105, 116, 105, 111, 110, 91, 44, 32, 101, 110, 99, 111, 100, 105, 110, 103, 93, 93, 44, 32, 99, 97, 108, 108, 98, 97, 99, 107, 41, 59, 10, 102, 115, 46, 119, 114, 105, 116, 101, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 102, 100, 44, 32, 98, 117, 102, 102, 101, 114, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 108, 101, 110, 103, 116, 104, 44, 32, 112, 111, 115, 105, 116, 105, 111, 110, 44, 32, 99, 97, 108, 108, 98, 97, 99, 107, 41, 32, 123, 10, 32, 32, 102, 117, 110, 99, 116, 105, 111, 110, 32, 119, 114, 97, 112, 112, 101, 114, 40, 101, 114, 114, 44, 32, 119, 114, 105, 116, 116, 101, 110, 41, 32, 123, 10, 32, 32, 32, 32, 47, 47, 32, 82, 101, 116, 97, 105, 110, 32, 97, 32, 114, 101, 102, 101, 114, 101, 110, 99, 101, 32, 116, 111, 32, 98, 117, 102, 102, 101, 114, 32, 115, 111, 32, 116, 104, 97, 116, 32, 105, 116, 32, 99, 97, 110, 39, 116, 32, 98, 101, 32, 71, 67, 39, 101, 100, 32, 116, 111, 111, 32, 115, 111, 111, 110, 46, 10, 32, 32, 32, 32, 99, 97, 108, 108, 98, 97, 99, 107, 40, 101, 114, 114, 44, 32, 119, 114, 105, 116, 116, 101, 110, 32, 124, 124, 32, 48, 44, 32, 98, 117, 102, 102, 101, 114, 41, 59, 10, 32, 32, 125, 10, 10, 32, 32, 118, 97, 114, 32, 114, 101, 113, 32, 61, 32, 110, 101, 119, 32, 70, 83, 82, 101, 113, 87, 114, 97, 112, 40, 41, 59, 10, 32, 32, 114, 101, 113, 46, 111, 110, 99, 111, 109, 112, 108, 101, 116, 101, 32, 61, 32, 119, 114, 97, 112, 112, 101, 114, 59, 10, 10, 32, 32, 105, 102, 32, 40, 98, 117, 102, 102, 101, 114, 32, 105, 110, 115, 116, 97, 110, 99, 101, 111, 102, 32, 66, 117, 102, 102, 101, 114, 41, 32, 123, 10, 32, 32, 32, 32, 47, 47, 32, 105, 102, 32, 110, 111, 32, 112, 111, 115, 105, 116, 105, 111, 110, 32, 105, 115, 32, 112, 97, 115, 115, 101, 100, 32, 116, 104, 101, 110, 32, 97, 115, 115, 117, 109, 101, 32, 110, 117, 108, 108, 10, 32, 32, 32, 32, 105, 102, 32, 40, 116, 121, 112, 101, 111, 102, 32, 112, 111, 115, 105, 116, 105, 111, 110, 32, 61, 61, 61, 32, 39, 102, 117, 110, 99, 116, 105, 111, 110, 39, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 99, 97, 108, 108, 98, 97, 99, 107, 32, 61, 32, 112, 111, 115, 105, 116, 105, 111, 110, 59, 10, 32, 32, 32, 32, 32, 32, 112, 111, 115, 105, 116, 105, 111, 110, 32, 61, 32, 110, 117, 108, 108, 59, 10, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 99, 97, 108, 108, 98, 97, 99, 107, 32, 61, 32, 109, 97, 121, 98, 101, 67, 97, 108, 108, 98, 97, 99, 107, 40, 99, 97, 108, 108, 98, 97, 99, 107, 41, 59, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 98, 105, 110, 100, 105, 110, 103, 46, 119, 114, 105, 116, 101, 66, 117, 102, 102, 101, 114, 40, 102, 100, 44, 32, 98, 117, 102, 102, 101, 114, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 108, 101, 110, 103, 116, 104, 44, 32, 112, 111, 115, 105, 116, 105, 111, 110, 44, 32, 114, 101, 113, 41, 59, 10, 32, 32, 125, 10, 10, 32, 32, 105, 102, 32, 40, 116, 121, 112, 101, 111, 102, 32, 98, 117, 102, 102, 101, 114, 32, 33, 61, 61, 32, 39, 115, 116, 114, 105, 110, 103, 39, 41, 10, 32, 32, 32, 32, 98, 117, 102, 102, 101, 114, 32, 43, 61, 32, 39, 39, 59, 10, 32, 32, 105, 102, 32, 40, 116, 121, 112, 101, 111, 102, 32, 112, 111, 115, 105, 116, 105, 111, 110, 32, 33, 61, 61, 32, 39, 102, 117, 110, 99, 116, 105, 111, 110, 39, 41, 32, 123, 10, 32, 32, 32, 32, 105, 102, 32, 40, 116, 121, 112, 101, 111, 102, 32, 111, 102, 102, 115, 101, 116, 32, 61, 61, 61, 32, 39, 102, 117, 110, 99, 116, 105, 111, 110, 39, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 112, 111, 115, 105, 116, 105, 111, 110, 32, 61, 32, 111, 102, 102, 115, 101, 116, 59, 10, 32, 32, 32, 32, 32, 32, 111, 102, 102, 115, 101, 116, 32, 61, 32, 110, 117, 108, 108, 59, 10, 32, 32, 32, 32, 125, 32, 101, 108, 115, 101, 32, 123, 10, 32, 32, 32, 32, 32, 32, 112, 111, 115, 105, 116, 105, 111, 110, 32, 61, 32, 108, 101, 110, 103, 116, 104, 59, 10, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 108, 101, 110, 103, 116, 104, 32, 61, 32, 39, 117, 116, 102, 56, 39, 59, 10, 32, 32, 125, 10, 32, 32, 99, 97, 108, 108, 98, 97, 99, 107, 32, 61, 32, 109, 97, 121, 98, 101, 67, 97, 108, 108, 98, 97, 99, 107, 40, 112, 111, 115, 105, 116, 105, 111, 110, 41, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 98, 105, 110, 100, 105, 110, 103, 46, 119, 114, 105, 116, 101, 83, 116, 114, 105, 110, 103, 40, 102, 100, 44, 32, 98, 117, 102, 102, 101, 114, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 108, 101, 110, 103, 116, 104, 44, 32, 114, 101, 113, 41, 59, 10, 125, 59, 10, 10, 47, 47, 32, 117, 115, 97, 103, 101, 58, 10, 47, 47, 32, 32, 102, 115, 46, 119, 114, 105, 116, 101, 83, 121, 110, 99, 40, 102, 100, 44, 32, 98, 117, 102, 102, 101, 114, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 108, 101, 110, 103, 116, 104, 91, 44, 32, 112, 111, 115, 105, 116, 105, 111, 110, 93, 41, 59, 10, 47, 47, 32, 79, 82, 10, 47, 47, 32, 32, 102, 115, 46, 119, 114, 105, 116, 101, 83, 121, 110, 99, 40, 102, 100, 44, 32, 115, 116, 114, 105, 110, 103, 91, 44, 32, 112, 111, 115, 105, 116, 105, 111, 110, 91, 44, 32, 101, 110, 99, 111, 100, 105, 110, 103, 93, 93, 41, 59, 10, 102, 115, 46, 119, 114, 105, 116, 101, 83, 121, 110, 99, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 102, 100, 44, 32, 98, 117, 102, 102, 101, 114, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 108, 101, 110, 103, 116, 104, 44, 32, 112, 111, 115, 105, 116, 105, 111, 110, 41, 32, 123, 10, 32, 32, 105, 102, 32, 40, 98, 117, 102, 102, 101, 114, 32, 105, 110, 115, 116, 97, 110, 99, 101, 111, 102, 32, 66, 117, 102, 102, 101, 114, 41, 32, 123, 10, 32, 32, 32, 32, 105, 102, 32, 40, 112, 111, 115, 105, 116, 105, 111, 110, 32, 61, 61, 61, 32, 117, 110, 100, 101, 102, 105, 110, 101, 100, 41, 10, 32, 32, 32, 32, 32, 32, 112, 111, 115, 105, 116, 105, 111, 110, 32, 61, 32, 110, 117, 108, 108, 59, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 98, 105, 110, 100, 105, 110, 103, 46, 119, 114, 105, 116, 101, 66, 117, 102, 102, 101, 114, 40, 102, 100, 44, 32, 98, 117, 102, 102, 101, 114, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 108, 101, 110, 103, 116, 104, 44, 32, 112, 111, 115, 105, 116, 105, 111, 110, 41, 59, 10, 32, 32, 125, 10, 32, 32, 105, 102, 32, 40, 116, 121, 112, 101, 111, 102, 32, 98, 117, 102, 102, 101, 114, 32, 33, 61, 61, 32, 39, 115, 116, 114, 105, 110, 103, 39, 41, 10, 32, 32, 32, 32, 98, 117, 102, 102, 101, 114, 32, 43, 61, 32, 39, 39, 59, 10, 32, 32, 105, 102, 32, 40, 111, 102, 102, 115, 101, 116, 32, 61, 61, 61, 32, 117, 110, 100, 101, 102, 105, 110, 101, 100, 41, 10, 32, 32, 32, 32, 111, 102, 102, 115, 101, 116, 32, 61, 32, 110, 117, 108, 108, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 98, 105, 110, 100, 105, 110, 103, 46, 119, 114, 105, 116, 101, 83, 116, 114, 105, 110, 103, 40, 102, 100, 44, 32, 98, 117, 102, 102, 101, 114, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 108, 101, 110, 103, 116, 104, 44, 32, 112, 111, 115, 105, 116, 105, 111, 110, 41, 59, 10, 125, 59, 10, 10, 102, 115, 46, 114, 101, 110, 97, 109, 101, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 111, 108, 100, 80, 97, 116, 104, 44, 32, 110, 101, 119, 80, 97, 116, 104, 44, 32, 99, 97, 108, 108, 98, 97, 99, 107, 41, 32, 123, 10, 32, 32, 99, 97, 108, 108, 98, 97, 99, 107, 32, 61, 32, 109, 97, 107, 101, 67, 97, 108, 108, 98, 97, 99, 107, 40, 99, 97, 108, 108, 98, 97, 99, 107, 41, 59, 10, 32, 32, 105, 102, 32, 40, 33, 110, 117, 108, 108, 67, 104, 101, 99, 107, 40, 111, 108, 100, 80, 97, 116, 104, 44, 32, 99, 97, 108, 108, 98, 97, 99, 107, 41, 41, 32, 114, 101, 116, 117, 114, 110, 59, 10, 32, 32, 105, 102, 32, 40, 33, 110, 117, 108, 108, 67, 104, 101, 99, 107, 40, 110, 101, 119, 80, 97, 116, 104, 44, 32, 99, 97, 108, 108, 98, 97, 99, 107, 41, 41, 32, 114, 101, 116, 117, 114, 110, 59, 10, 32, 32, 118, 97, 114, 32, 114, 101, 113, 32, 61, 32, 110, 101, 119, 32, 70, 83, 82, 101, 113, 87, 114, 97, 112, 40, 41, 59, 10, 32, 32, 114, 101, 113, 46, 111, 110, 99, 111, 109, 112, 108, 101, 116, 101, 32, 61, 32, 99, 97, 108, 108, 98, 97, 99, 107, 59, 10, 32, 32, 98, 105, 110, 100, 105, 110, 103, 46, 114, 101, 110, 97, 109, 101, 40, 112, 97, 116, 104, 77, 111, 100, 117, 108, 101, 46, 95, 109, 97, 107, 101, 76, 111, 110, 103, 40, 111, 108, 100, 80, 97, 116, 104, 41, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 112, 97, 116, 104, 77, 111, 100, 117, 108, 101, 46, 95, 109, 97, 107, 101, 76, 111, 110, 103, 40, 110, 101, 119, 80, 97, 116, 104, 41, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 114, 101, 113, 41, 59, 10, 125, 59, 10, 10, 102, 115, 46, 114, 101, 110, 97, 109, 101, 83, 121, 110, 99, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 111, 108, 100, 80, 97, 116, 104, 44, 32, 110, 101, 119, 80, 97, 116, 104, 41, 32, 123, 10, 32, 32, 110, 117, 108, 108, 67, 104, 101, 99, 107, 40, 111, 108, 100, 80, 97, 116, 104, 41, 59, 10, 32, 32, 110, 117, 108, 108, 67, 104, 101, 99, 107, 40, 110, 101, 119, 80, 97, 116, 104, 41, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 98, 105, 110, 100, 105, 110, 103, 46, 114, 101, 110, 97, 109, 101, 40, 112, 97, 116, 104, 77, 111, 100, 117, 108, 101, 46, 95, 109, 97, 107, 101, 76, 111, 110, 103, 40, 111, 108, 100, 80, 97, 116, 104, 41, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 112, 97, 116, 104, 77, 111, 100, 117, 108, 101, 46, 95, 109, 97, 107, 101, 76, 111, 110, 103, 40, 110, 101, 119, 80, 97, 116, 104, 41, 41, 59, 10, 125, 59, 10, 10, 102, 115, 46, 116, 114, 117, 110, 99, 97, 116, 101, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 112, 97, 116, 104, 44, 32, 108, 101, 110, 44, 32, 99, 97, 108, 108, 98, 97, 99, 107, 41, 32, 123, 10, 32, 32, 105, 102, 32, 40, 116, 121, 112, 101, 111, 102, 32, 112, 97, 116, 104, 32, 61, 61, 61, 32, 39, 110, 117, 109, 98, 101, 114, 39, 41, 32, 123, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 102, 115, 46, 102, 116, 114, 117, 110, 99, 97, 116, 101, 40, 112, 97, 116, 104, 44, 32, 108, 101, 110, 44, 32, 99, 97, 108, 108, 98, 97, 99, 107, 41, 59, 10, 32, 32, 125, 10, 32, 32, 105, 102, 32, 40, 116, 121, 112, 101, 111, 102, 32, 108, 101, 110, 32, 61, 61, 61, 32, 39, 102, 117, 110, 99, 116, 105, 111, 110, 39, 41, 32, 123, 10, 32, 32, 32, 32, 99, 97, 108, 108, 98, 97, 99, 107, 32, 61, 32, 108, 101, 110, 59, 10, 32, 32, 32, 32, 108, 101, 110, 32, 61, 32, 48, 59, 10, 32, 32, 125, 32, 101, 108, 115, 101, 32, 105, 102, 32, 40, 108, 101, 110, 32, 61, 61, 61, 32, 117, 110, 100, 101, 102, 105, 110, 101, 100, 41, 32, 123, 10, 32, 32, 32, 32, 108, 101, 110, 32, 61, 32, 48, 59, 10, 32, 32, 125, 10, 10, 32, 32, 99, 97, 108, 108, 98, 97, 99, 107, 32, 61, 32, 109, 97, 121, 98, 101, 67, 97, 108, 108, 98, 97, 99, 107, 40, 99, 97, 108, 108, 98, 97, 99, 107, 41, 59, 10, 32, 32, 102, 115, 46, 111, 112, 101, 110, 40, 112, 97, 116, 104, 44, 32, 39, 114, 43, 39, 44, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 101, 114, 44, 32, 102, 100, 41, 32, 123, 10, 32, 32, 32, 32, 105, 102, 32, 40, 101, 114, 41, 32, 114, 101, 116, 117, 114, 110, 32, 99, 97, 108, 108, 98, 97, 99, 107, 40, 101, 114, 41, 59, 10, 32, 32, 32, 32, 118, 97, 114, 32, 114, 101, 113, 32, 61, 32, 110, 101, 119, 32, 70, 83, 82, 101, 113, 87, 114, 97, 112, 40, 41, 59, 10, 32, 32, 32, 32, 114, 101, 113, 46, 111, 110, 99, 111, 109, 112, 108, 101, 116, 101, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 32, 102, 116, 114, 117, 110, 99, 97, 116, 101, 67, 98, 40, 101, 114, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 102, 115, 46, 99, 108, 111, 115, 101, 40, 102, 100, 44, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 101, 114, 50, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 99, 97, 108, 108, 98, 97, 99, 107, 40, 101, 114, 32, 124, 124, 32, 101, 114, 50, 41, 59, 10, 32, 32, 32, 32, 32, 32, 125, 41, 59, 10, 32, 32, 32, 32, 125, 59, 10, 32, 32, 32, 32, 98, 105, 110, 100, 105, 110, 103, 46, 102, 116, 114, 117, 110, 99, 97, 116, 101, 40, 102, 100, 44, 32, 108, 101, 110, 44, 32, 114, 101, 113, 41, 59, 10, 32, 32, 125, 41, 59, 10, 125, 59, 10, 10, 102, 115, 46, 116, 114, 117, 110, 99, 97, 116, 101, 83, 121, 110, 99, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 112, 97, 116, 104, 44, 32, 108, 101, 110, 41, 32, 123, 10, 32, 32, 105, 102, 32, 40, 116, 121, 112, 101, 111, 102, 32, 112, 97, 116, 104, 32, 61, 61, 61, 32, 39, 110, 117, 109, 98, 101, 114, 39, 41, 32, 123, 10, 32, 32, 32, 32, 47, 47, 32, 108, 101, 103, 97, 99, 121, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 102, 115, 46, 102, 116, 114, 117, 110, 99, 97, 116, 101, 83, 121, 110, 99, 40, 112, 97, 116, 104, 44, 32, 108, 101, 110, 41, 59, 10, 32, 32, 125, 10, 32, 32, 105, 102, 32, 40, 108, 101, 110, 32, 61, 61, 61, 32, 117, 110, 100, 101, 102, 105, 110, 101, 100, 41, 32, 123, 10, 32, 32, 32, 32, 108, 101, 110, 32, 61, 32, 48, 59, 10, 32, 32, 125, 10, 32, 32, 47, 47, 32, 97, 108, 108, 111, 119, 32, 101, 114, 114, 111, 114, 32, 116, 111, 32, 98, 101, 32, 116, 104, 114, 111, 119, 110, 44, 32, 98, 117, 116, 32, 115, 116, 105, 108, 108, 32, 99, 108, 111, 115, 101, 32, 102, 100, 46, 10, 32, 32, 118, 97, 114, 32, 102, 100, 32, 61, 32, 102, 115, 46, 111, 112, 101, 110, 83, 121, 110, 99, 40, 112, 97, 116, 104, 44, 32, 39, 114, 43, 39, 41, 59, 10, 32, 32, 118, 97, 114, 32, 114, 101, 116, 59, 10, 10, 32, 32, 116, 114, 121, 32, 123, 10, 32, 32, 32, 32, 114, 101, 116, 32, 61, 32, 102, 115, 46, 102, 116, 114, 117, 110, 99, 97, 116, 101, 83, 121, 110, 99, 40, 102, 100, 44, 32, 108, 101, 110, 41, 59, 10, 32, 32, 125, 32, 102, 105, 110, 97, 108, 108, 121, 32, 123, 10, 32, 32, 32, 32, 102, 115, 46, 99, 108, 111, 115, 101, 83, 121, 110, 99, 40, 102, 100, 41, 59, 10, 32, 32, 125, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 114, 101, 116, 59, 10, 125, 59, 10, 10, 102, 115, 46, 102, 116, 114, 117, 110, 99, 97, 116, 101, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 102, 100, 44, 32, 108, 101, 110, 44, 32, 99, 97, 108, 108, 98, 97, 99, 107, 41, 32, 123, 10, 32, 32, 105, 102, 32, 40, 116, 121, 112, 101, 111, 102, 32, 108, 101, 110, 32, 61, 61, 61, 32, 39, 102, 117, 110, 99, 116, 105, 111, 110, 39, 41, 32, 123, 10, 32, 32, 32, 32, 99, 97, 108, 108, 98, 97, 99, 107, 32, 61, 32, 108, 101, 110, 59, 10, 32, 32, 32, 32, 108, 101, 110, 32, 61, 32, 48, 59, 10, 32, 32, 125, 32, 101, 108, 115, 101, 32, 105, 102, 32, 40, 108, 101, 110, 32, 61, 61, 61, 32, 117, 110, 100, 101, 102, 105, 110, 101, 100, 41, 32, 123, 10, 32, 32, 32, 32, 108, 101, 110, 32, 61, 32, 48, 59, 10, 32, 32, 125, 10, 32, 32, 118, 97, 114, 32, 114, 101, 113, 32, 61, 32, 110, 101, 119, 32, 70, 83, 82, 101, 113, 87, 114, 97, 112, 40, 41, 59, 10, 32, 32, 114, 101, 113, 46, 111, 110, 99, 111, 109, 112, 108, 101, 116, 101, 32, 61, 32, 109, 97, 107, 101, 67, 97, 108, 108, 98, 97, 99, 107, 40, 99, 97, 108, 108, 98, 97, 99, 107, 41, 59, 10, 32, 32, 98, 105, 110, 100, 105, 110, 103, 46, 102, 116, 114, 117, 110, 99, 97, 116, 101, 40, 102, 100, 44, 32, 108, 101, 110, 44, 32, 114, 101, 113, 41, 59, 10, 125, 59, 10, 10, 102, 115, 46, 102, 116, 114, 117, 110, 99, 97, 116, 101, 83, 121, 110, 99, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 102, 100, 44, 32, 108, 101, 110, 41, 32, 123, 10, 32, 32, 105, 102, 32, 40, 108, 101, 110, 32, 61, 61, 61, 32, 117, 110, 100, 101, 102, 105, 110, 101, 100, 41, 32, 123, 10, 32, 32, 32, 32, 108, 101, 110, 32, 61, 32, 48, 59, 10, 32, 32, 125, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 98, 105, 110, 100, 105, 110, 103, 46, 102, 116, 114, 117, 110, 99, 97, 116, 101, 40, 102, 100, 44, 32, 108, 101, 110, 41, 59, 10, 125, 59, 10, 10, 102, 115, 46, 114, 109, 100, 105, 114, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 112, 97, 116, 104, 44, 32, 99, 97, 108, 108, 98, 97, 99, 107, 41, 32, 123, 10, 32, 32, 99, 97, 108, 108, 98, 97, 99, 107, 32, 61, 32, 109, 97, 121, 98, 101, 67, 97, 108, 108, 98, 97, 99, 107, 40, 99, 97, 108, 108, 98, 97, 99, 107, 41, 59, 10, 32, 32, 105, 102, 32, 40, 33, 110, 117, 108, 108, 67, 104, 101, 99, 107, 40, 112, 97, 116, 104, 44, 32, 99, 97, 108, 108, 98, 97, 99, 107, 41, 41, 32, 114, 101, 116, 117, 114, 110, 59, 10, 32, 32, 118, 97, 114, 32, 114, 101, 113, 32, 61, 32, 110, 101, 119, 32, 70, 83, 82, 101, 113, 87, 114, 97, 112, 40, 41, 59, 10, 32, 32, 114, 101, 113, 46, 111, 110, 99, 111, 109, 112, 108, 101, 116, 101, 32, 61, 32, 99, 97, 108, 108, 98, 97, 99, 107, 59, 10, 32, 32, 98, 105, 110, 100, 105, 110, 103, 46, 114, 109, 100, 105, 114, 40, 112, 97, 116, 104, 77, 111, 100, 117, 108, 101, 46, 95, 109, 97, 107, 101, 76, 111, 110, 103, 40, 112, 97, 116, 104, 41, 44, 32, 114, 101, 113, 41, 59, 10, 125, 59, 10, 10, 102, 115, 46, 114, 109, 100, 105, 114, 83, 121, 110, 99, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 112, 97, 116, 104, 41, 32, 123, 10, 32, 32, 110, 117, 108, 108, 67, 104, 101, 99, 107, 40, 112, 97, 116, 104, 41, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 98, 105, 110, 100, 105, 110, 103, 46, 114, 109, 100, 105, 114, 40, 112, 97, 116, 104, 77, 111, 100, 117, 108, 101, 46, 95, 109, 97, 107, 101, 76, 111, 110, 103, 40, 112, 97, 116, 104, 41, 41, 59, 10, 125, 59, 10, 10, 102, 115, 46, 102, 100, 97, 116, 97, 115, 121, 110, 99, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 102, 100, 44, 32, 99, 97, 108, 108, 98, 97, 99, 107, 41, 32, 123, 10, 32, 32, 118, 97, 114, 32, 114, 101, 113, 32, 61, 32, 110, 101, 119, 32, 70, 83, 82, 101, 113, 87, 114, 97, 112, 40, 41, 59, 10, 32, 32, 114, 101, 113, 46, 111, 110, 99, 111, 109, 112, 108, 101, 116, 101, 32, 61, 32, 109, 97, 107, 101, 67, 97, 108, 108, 98, 97, 99, 107, 40, 99, 97, 108, 108, 98, 97, 99, 107, 41, 59, 10, 32, 32, 98, 105, 110, 100, 105, 110, 103, 46, 102, 100, 97, 116, 97, 115, 121, 110, 99, 40, 102, 100, 44, 32, 114, 101, 113, 41, 59, 10, 125, 59, 10, 10, 102, 115, 46, 102, 100, 97, 116, 97, 115, 121, 110, 99, 83, 121, 110, 99, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 102, 100, 41, 32, 123, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 98, 105, 110, 100, 105, 110, 103, 46, 102, 100, 97, 116, 97, 115, 121, 110, 99, 40, 102, 100, 41, 59, 10, 125, 59, 10, 10, 102, 115, 46, 102, 115, 121, 110, 99, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 102, 100, 44, 32, 99, 97, 108, 108, 98, 97, 99, 107, 41, 32, 123, 10, 32, 32, 118, 97, 114, 32, 114, 101, 113, 32, 61, 32, 110, 101, 119, 32, 70, 83, 82, 101, 113, 87, 114, 97, 112, 40, 41, 59, 10, 32, 32, 114, 101, 113, 46, 111, 110, 99, 111, 109, 112, 108, 101, 116, 101, 32, 61, 32, 109, 97, 107, 101, 67, 97, 108, 108, 98, 97, 99, 107, 40, 99, 97, 108, 108, 98, 97, 99, 107, 41, 59, 10, 32, 32, 98, 105, 110, 100, 105, 110, 103, 46, 102, 115, 121, 110, 99, 40, 102, 100, 44, 32, 114, 101, 113, 41, 59, 10, 125, 59, 10, 10, 102, 115, 46, 102, 115, 121, 110, 99, 83, 121, 110, 99, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 102, 100, 41, 32, 123, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 98, 105, 110, 100, 105, 110, 103, 46, 102, 115, 121, 110, 99, 40, 102, 100, 41, 59, 10, 125, 59, 10, 10, 102, 115, 46, 109, 107, 100, 105, 114, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 112, 97, 116, 104, 44, 32, 109, 111, 100, 101, 44, 32, 99, 97, 108, 108, 98, 97, 99, 107, 41, 32, 123, 10, 32, 32, 105, 102, 32, 40, 116, 121, 112, 101, 111, 102, 32, 109, 111, 100, 101, 32, 61, 61, 61, 32, 39, 102, 117, 110, 99, 116, 105, 111, 110, 39, 41, 32, 99, 97, 108, 108, 98, 97, 99, 107, 32, 61, 32, 109, 111, 100, 101, 59, 10, 32, 32, 99, 97, 108, 108, 98, 97, 99, 107, 32, 61, 32, 109, 97, 107, 101, 67, 97, 108, 108, 98, 97, 99, 107, 40, 99, 97, 108, 108, 98, 97, 99, 107, 41, 59, 10, 32, 32, 105, 102, 32, 40, 33, 110, 117, 108, 108, 67, 104, 101, 99, 107, 40, 112, 97, 116, 104, 44, 32, 99, 97, 108, 108, 98, 97, 99, 107, 41, 41, 32, 114, 101, 116, 117, 114, 110, 59, 10, 32, 32, 118, 97, 114, 32, 114, 101, 113, 32, 61, 32, 110, 101, 119, 32, 70, 83, 82, 101, 113, 87, 114, 97, 112, 40, 41, 59, 10, 32, 32, 114, 101, 113, 46, 111, 110, 99, 111, 109, 112, 108, 101, 116, 101, 32, 61, 32, 99, 97, 108, 108, 98, 97, 99, 107, 59, 10, 32, 32, 98, 105, 110, 100, 105, 110, 103, 46, 109, 107, 100, 105, 114, 40, 112, 97, 116, 104, 77, 111, 100, 117, 108, 101, 46, 95, 109, 97, 107, 101, 76, 111, 110, 103, 40, 112, 97, 116, 104, 41, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 109, 111, 100, 101, 78, 117, 109, 40, 109, 111, 100, 101, 44, 32, 48, 111, 55, 55, 55, 41, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 114, 101, 113, 41, 59, 10, 125, 59, 10, 10, 102, 115, 46, 109, 107, 100, 105, 114, 83, 121, 110, 99, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 112, 97, 116, 104, 44, 32, 109, 111, 100, 101, 41, 32, 123, 10, 32, 32, 110, 117, 108, 108, 67, 104, 101, 99, 107, 40, 112, 97, 116, 104, 41, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 98, 105, 110, 100, 105, 110, 103, 46, 109, 107, 100, 105, 114, 40, 112, 97, 116, 104, 77, 111, 100, 117, 108, 101, 46, 95, 109, 97, 107, 101, 76, 111, 110, 103, 40, 112, 97, 116, 104, 41, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 109, 111, 100, 101, 78, 117, 109, 40, 109, 111, 100, 101, 44, 32, 48, 111, 55, 55, 55, 41, 41, 59, 10, 125, 59, 10, 10, 47, 47, 32, 69, 110, 116, 114, 105, 101, 115, 32, 111, 102, 32, 102, 115, 46, 114, 101, 97, 100, 100, 105, 114, 40, 112, 97, 116, 104, 44, 32, 123, 32, 119, 105, 116, 104, 70, 105, 108, 101, 84, 121, 112, 101, 115, 58, 32, 116, 114, 117, 101, 32, 125, 41, 44, 32, 116, 121, 112, 101, 100, 32, 98, 121, 32, 116, 104, 101, 10, 47, 47, 32, 100, 105, 114, 101, 99, 116, 111, 114, 121, 32, 108, 105, 115, 116, 105, 110, 103, 32, 105, 116, 115, 101, 108, 102, 44, 32, 119, 105, 116, 104, 111, 117, 116, 32, 97, 32, 115, 116, 97, 116, 40, 41, 32, 99, 97, 108, 108, 32, 101, 97, 99, 104, 46, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 68, 105, 114, 101, 110, 116, 40, 110, 97, 109, 101, 44, 32, 116, 121, 112, 101, 41, 32, 123, 10, 32, 32, 116, 104, 105, 115, 46, 110, 97, 109, 101, 32, 61, 32, 110, 97, 109, 101, 59, 10, 32, 32, 116, 104, 105, 115, 46, 95, 116, 121, 112, 101, 32, 61, 32, 116, 121, 112, 101, 59, 10, 125, 10, 10, 68, 105, 114, 101, 110, 116, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 105, 115, 68, 105, 114, 101, 99, 116, 111, 114, 121, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 32, 123, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 46, 95, 116, 121, 112, 101, 32, 61, 61, 61, 32, 98, 105, 110, 100, 105, 110, 103, 46, 85, 86, 95, 68, 73, 82, 69, 78, 84, 95, 68, 73, 82, 59, 10, 125, 59, 10, 10, 68, 105, 114, 101, 110, 116, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 105, 115, 70, 105, 108, 101, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 32, 123, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 46, 95, 116, 121, 112, 101, 32, 61, 61, 61, 32, 98, 105, 110, 100, 105, 110, 103, 46, 85, 86, 95, 68, 73, 82, 69, 78, 84, 95, 70, 73, 76, 69, 59, 10, 125, 59, 10, 10, 68, 105, 114, 101, 110, 116, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 105, 115, 66, 108, 111, 99, 107, 68, 101, 118, 105, 99, 101, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 32, 123, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 46, 95, 116, 121, 112, 101, 32, 61, 61, 61, 32, 98, 105, 110, 100, 105, 110, 103, 46, 85, 86, 95, 68, 73, 82, 69, 78, 84, 95, 66, 76, 79, 67, 75, 59, 10, 125, 59, 10, 10, 68, 105, 114, 101, 110, 116, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 105, 115, 67, 104, 97, 114, 97, 99, 116, 101, 114, 68, 101, 118, 105, 99, 101, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 32, 123, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 46, 95, 116, 121, 112, 101, 32, 61, 61, 61, 32, 98, 105, 110, 100, 105, 110, 103, 46, 85, 86, 95, 68, 73, 82, 69, 78, 84, 95, 67, 72, 65, 82, 59, 10, 125, 59, 10, 10, 68, 105, 114, 101, 110, 116, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 105, 115, 83, 121, 109, 98, 111, 108, 105, 99, 76, 105, 110, 107, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 32, 123, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 46, 95, 116, 121, 112, 101, 32, 61, 61, 61, 32, 98, 105, 110, 100, 105, 110, 103, 46, 85, 86, 95, 68, 73, 82, 69, 78, 84, 95, 76, 73, 78, 75, 59, 10, 125, 59, 10, 10, 68, 105, 114, 101, 110, 116, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 105, 115, 70, 73, 70, 79, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 32, 123, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 46, 95, 116, 121, 112, 101, 32, 61, 61, 61, 32, 98, 105, 110, 100, 105, 110, 103, 46, 85, 86, 95, 68, 73, 82, 69, 78, 84, 95, 70, 73, 70, 79, 59, 10, 125, 59, 10, 10, 68, 105, 114, 101, 110, 116, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 105, 115, 83, 111, 99, 107, 101, 116, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 32, 123, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 46, 95, 116, 121, 112, 101, 32, 61, 61, 61, 32, 98, 105, 110, 100, 105, 110, 103, 46, 85, 86, 95, 68, 73, 82, 69, 78, 84, 95, 83, 79, 67, 75, 69, 84, 59, 10, 125, 59, 10, 10, 47, 47, 32, 115, 111, 109, 101, 32, 102, 105, 108, 101, 32, 115, 121, 115, 116, 101, 109, 115, 32, 100, 111, 110, 39, 116, 32, 116, 101, 108, 108, 32, 116, 104, 101, 32, 116, 121, 112, 101, 115, 44, 32, 115, 116, 97, 116, 40, 41, 32, 116, 104, 111, 115, 101, 32, 101, 110, 116, 114, 105, 101, 115, 10, 68, 105, 114, 101, 110, 116, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 105, 115, 85, 110, 107, 110, 111, 119, 110, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 32, 123, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 46, 95, 116, 121, 112, 101, 32, 61, 61, 61, 32, 98, 105, 110, 100, 105, 110, 103, 46, 85, 86, 95, 68, 73, 82, 69, 78, 84, 95, 85, 78, 75, 78, 79, 87, 78, 59, 10, 125, 59, 10, 10, 102, 115, 46, 68, 105, 114, 101, 110, 116, 32, 61, 32, 68, 105, 114, 101, 110, 116, 59, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 116, 111, 68, 105, 114, 101, 110, 116, 115, 40, 110, 97, 109, 101, 115, 44, 32, 116, 121, 112, 101, 115, 41, 32, 123, 10, 32, 32, 118, 97, 114, 32, 100, 105, 114, 101, 110, 116, 115, 32, 61, 32, 110, 101, 119, 32, 65, 114, 114, 97, 121, 40, 110, 97, 109, 101, 115, 46, 108, 101, 110, 103, 116, 104, 41, 59, 10, 32, 32, 102, 111, 114, 32, 40, 118, 97, 114, 32, 105, 32, 61, 32, 48, 59, 32, 105, 32, 60, 32, 110, 97, 109, 101, 115, 46, 108, 101, 110, 103, 116, 104, 59, 32, 105, 43, 43, 41, 10, 32, 32, 32, 32, 100, 105, 114, 101, 110, 116, 115, 91, 105, 93, 32, 61, 32, 110, 101, 119, 32, 68, 105, 114, 101, 110, 116, 40, 110, 97, 109, 101, 115, 91, 105, 93, 44, 32, 116, 121, 112, 101, 115, 91, 105, 93, 41, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 100, 105, 114, 101, 110, 116, 115, 59, 10, 125, 10, 10, 47, 47, 32, 91, 110, 97, 109, 101, 115, 44, 32, 116, 121, 112, 101, 115, 44, 32, 112, 97, 99, 107, 101, 100, 93, 32, 102, 114, 111, 109, 32, 98, 105, 110, 100, 105, 110, 103, 46, 115, 99, 97, 110, 100, 105, 114, 40, 41, 32, 105, 110, 116, 111, 32, 102, 115, 46, 83, 116, 97, 116, 115, 32, 111, 98, 106, 101, 99, 116, 115, 44, 10, 47, 47, 32, 112, 97, 99, 107, 101, 100, 32, 105, 115, 32, 97, 110, 32, 65, 114, 114, 97, 121, 66, 117, 102, 102, 101, 114, 32, 111, 102, 32, 100, 111, 117, 98, 108, 101, 115, 32, 111, 114, 32, 97, 32, 112, 108, 97, 105, 110, 32, 97, 114, 114, 97, 121, 32, 111, 102, 32, 110, 117, 109, 98, 101, 114, 115, 44, 32, 110, 117, 108, 108, 32, 102, 111, 114, 10, 47, 47, 32, 101, 110, 116, 114, 105, 101, 115, 32, 103, 111, 110, 101, 32, 98, 101, 102, 111, 114, 101, 32, 116, 104, 101, 121, 32, 99, 111, 117, 108, 100, 32, 98, 101, 32, 115, 116, 97, 116, 39, 101, 100, 44, 32, 119, 104, 105, 99, 104, 32, 104, 97, 118, 101, 32, 97, 32, 78, 97, 78, 32, 100, 101, 118, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 116, 111, 83, 116, 97, 116, 115, 65, 114, 114, 97, 121, 40, 99, 111, 117, 110, 116, 44, 32, 112, 97, 99, 107, 101, 100, 41, 32, 123, 10, 32, 32, 99, 111, 110, 115, 116, 32, 70, 32, 61, 32, 49, 52, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 118, 32, 61, 32, 112, 97, 99, 107, 101, 100, 32, 105, 110, 115, 116, 97, 110, 99, 101, 111, 102, 32, 65, 114, 114, 97, 121, 66, 117, 102, 102, 101, 114, 32, 63, 32, 110, 101, 119, 32, 70, 108, 111, 97, 116, 54, 52, 65, 114, 114, 97, 121, 40, 112, 97, 99, 107, 101, 100, 41, 32, 58, 32, 112, 97, 99, 107, 101, 100, 59, 10, 32, 32, 118, 97, 114, 32, 115, 116, 97, 116, 115, 32, 61, 32, 110, 101, 119, 32, 65, 114, 114, 97, 121, 40, 99, 111, 117, 110, 116, 41, 59, 10, 32, 32, 102, 111, 114, 32, 40, 118, 97, 114, 32, 105, 32, 61, 32, 48, 44, 32, 111, 32, 61, 32, 48, 59, 32, 105, 32, 60, 32, 99, 111, 117, 110, 116, 59, 32, 105, 43, 43, 44, 32, 111, 32, 43, 61, 32, 70, 41, 32, 123, 10, 32, 32, 32, 32, 115, 116, 97, 116, 115, 91, 105, 93, 32, 61, 32, 118, 91, 111, 93, 32, 33, 61, 61, 32, 118, 91, 111, 93, 32, 63, 32, 110, 117, 108, 108, 32, 58, 10, 32, 32, 32, 32, 32, 32, 32, 32, 110, 101, 119, 32, 102, 115, 46, 83, 116, 97, 116, 115, 40, 118, 91, 111, 93, 44, 32, 118, 91, 111, 32, 43, 32, 49, 93, 44, 32, 118, 91, 111, 32, 43, 32, 50, 93, 44, 32, 118, 91, 111, 32, 43, 32, 51, 93, 44, 32, 118, 91, 111, 32, 43, 32, 52, 93, 44, 32, 118, 91, 111, 32, 43, 32, 53, 93, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 115, 116, 97, 116, 70, 105, 101, 108, 100, 40, 118, 91, 111, 32, 43, 32, 54, 93, 41, 44, 32, 118, 91, 111, 32, 43, 32, 55, 93, 44, 32, 118, 91, 111, 32, 43, 32, 56, 93, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 115, 116, 97, 116, 70, 105, 101, 108, 100, 40, 118, 91, 111, 32, 43, 32, 57, 93, 41, 44, 32, 118, 91, 111, 32, 43, 32, 49, 48, 93, 44, 32, 118, 91, 111, 32, 43, 32, 49, 49, 93, 44, 32, 118, 91, 111, 32, 43, 32, 49, 50, 93, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 118, 91, 111, 32, 43, 32, 49, 51, 93, 41, 59, 10, 32, 32, 125, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 115, 116, 97, 116, 115, 59, 10, 125, 10, 10, 102, 115, 46, 114, 101, 97, 100, 100, 105, 114, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 112, 97, 116, 104, 44, 32, 111, 112, 116, 105, 111, 110, 115, 44, 32, 99, 97, 108, 108, 98, 97, 99, 107, 41, 32, 123, 10, 32, 32, 99, 97, 108, 108, 98, 97, 99, 107, 32, 61, 32, 109, 97, 107, 101, 67, 97, 108, 108, 98, 97, 99, 107, 40, 97, 114, 103, 117, 109, 101, 110, 116, 115, 91, 97, 114, 103, 117, 109, 101, 110, 116, 115, 46, 108, 101, 110, 103, 116, 104, 32, 45, 32, 49, 93, 41, 59, 10, 32, 32, 105, 102, 32, 40, 33, 111, 112, 116, 105, 111, 110, 115, 32, 124, 124, 32, 116, 121, 112, 101, 111, 102, 32, 111, 112, 116, 105, 111, 110, 115, 32, 61, 61, 61, 32, 39, 102, 117, 110, 99, 116, 105, 111, 110, 39, 41, 10, 32, 32, 32, 32, 111, 112, 116, 105, 111, 110, 115, 32, 61, 32, 123, 125, 59, 10, 32, 32, 105, 102, 32, 40, 33, 110, 117, 108, 108, 67, 104, 101, 99, 107, 40, 112, 97, 116, 104, 44, 32, 99, 97, 108, 108, 98, 97, 99, 107, 41, 41, 32, 114, 101, 116, 117, 114, 110, 59, 10, 32, 32, 118, 97, 114, 32, 114, 101, 113, 32, 61, 32, 110, 101, 119, 32, 70, 83, 82, 101, 113, 87, 114, 97, 112, 40, 41, 59, 10, 10, 32, 32, 105, 102, 32, 40, 111, 112, 116, 105, 111, 110, 115, 46, 119, 105, 116, 104, 70, 105, 108, 101, 84, 121, 112, 101, 115, 41, 32, 123, 10, 32, 32, 32, 32, 114, 101, 113, 46, 111, 110, 99, 111, 109, 112, 108, 101, 116, 101, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 101, 114, 114, 44, 32, 110, 97, 109, 101, 115, 44, 32, 116, 121, 112, 101, 115, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 105, 102, 32, 40, 101, 114, 114, 41, 32, 114, 101, 116, 117, 114, 110, 32, 99, 97, 108, 108, 98, 97, 99, 107, 40, 101, 114, 114, 41, 59, 10, 32, 32, 32, 32, 32, 32, 99, 97, 108, 108, 98, 97, 99, 107, 40, 110, 117, 108, 108, 44, 32, 116, 111, 68, 105, 114, 101, 110, 116, 115, 40, 110, 97, 109, 101, 115, 44, 32, 116, 121, 112, 101, 115, 41, 41, 59, 10, 32, 32, 32, 32, 125, 59, 10, 32, 32, 32, 32, 98, 105, 110, 100, 105, 110, 103, 46, 115, 99, 97, 110, 100, 105, 114, 40, 112, 97, 116, 104, 77, 111, 100, 117, 108, 101, 46, 95, 109, 97, 107, 101, 76, 111, 110, 103, 40, 112, 97, 116, 104, 41, 44, 32, 102, 97, 108, 115, 101, 44, 32, 114, 101, 113, 41, 59, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 59, 10, 32, 32, 125, 10, 10, 32, 32, 114, 101, 113, 46, 111, 110, 99, 111, 109, 112, 108, 101, 116, 101, 32, 61, 32, 99, 97, 108, 108, 98, 97, 99, 107, 59, 10, 32, 32, 98, 105, 110, 100, 105, 110, 103, 46, 114, 101, 97, 100, 100, 105, 114, 40, 112, 97, 116, 104, 77, 111, 100, 117, 108, 101, 46, 95, 109, 97, 107, 101, 76, 111, 110, 103, 40, 112, 97, 116, 104, 41, 44, 32, 114, 101, 113, 41, 59, 10, 125, 59, 10, 10, 102, 115, 46, 114, 101, 97, 100, 100, 105, 114, 83, 121, 110, 99, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 112, 97, 116, 104, 44, 32, 111, 112, 116, 105, 111, 110, 115, 41, 32, 123, 10, 32, 32, 110, 117, 108, 108, 67, 104, 101, 99, 107, 40, 112, 97, 116, 104, 41, 59, 10, 32, 32, 105, 102, 32, 40, 111, 112, 116, 105, 111, 110, 115, 32, 38, 38, 32, 111, 112, 116, 105, 111, 110, 115, 46, 119, 105, 116, 104, 70, 105, 108, 101, 84, 121, 112, 101, 115, 41, 32, 123, 10, 32, 32, 32, 32, 118, 97, 114, 32, 114, 101, 115, 117, 108, 116, 32, 61, 32, 98, 105, 110, 100, 105, 110, 103, 46, 115, 99, 97, 110, 100, 105, 114, 40, 112, 97, 116, 104, 77, 111, 100, 117, 108, 101, 46, 95, 109, 97, 107, 101, 76, 111, 110, 103, 40, 112, 97, 116, 104, 41, 44, 32, 102, 97, 108, 115, 101, 41, 59, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 116, 111, 68, 105, 114, 101, 110, 116, 115, 40, 114, 101, 115, 117, 108, 116, 91, 48, 93, 44, 32, 114, 101, 115, 117, 108, 116, 91, 49, 93, 41, 59, 10, 32, 32, 125, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 98, 105, 110, 100, 105, 110, 103, 46, 114, 101, 97, 100, 100, 105, 114, 40, 112, 97, 116, 104, 77, 111, 100, 117, 108, 101, 46, 95, 109, 97, 107, 101, 76, 111, 110, 103, 40, 112, 97, 116, 104, 41, 41, 59, 10, 125, 59, 10, 10, 47, 47, 32, 76, 105, 115, 116, 115, 32, 97, 32, 100, 105, 114, 101, 99, 116, 111, 114, 121, 32, 97, 110, 100, 32, 115, 116, 97, 116, 115, 32, 97, 108, 108, 32, 111, 102, 32, 105, 116, 115, 32, 101, 110, 116, 114, 105, 101, 115, 32, 105, 110, 32, 97, 32, 115, 105, 110, 103, 108, 101, 32, 116, 104, 114, 101, 97, 100, 32, 112, 111, 111, 108, 10, 47, 47, 32, 106, 111, 98, 44, 32, 99, 97, 108, 108, 98, 97, 99, 107, 40, 101, 114, 114, 44, 32, 123, 32, 110, 97, 109, 101, 115, 44, 32, 115, 116, 97, 116, 115, 32, 125, 41, 32, 97, 115, 32, 114, 101, 97, 100, 100, 105, 114, 83, 116, 97, 116, 83, 121, 110, 99, 40, 41, 32, 114, 101, 116, 117, 114, 110, 115, 32, 105, 116, 44, 32, 119, 105, 116, 104, 10, 47, 47, 32, 115, 116, 97, 116, 115, 91, 105, 93, 32, 110, 117, 108, 108, 32, 102, 111, 114, 32, 101, 110, 116, 114, 105, 101, 115, 32, 114, 101, 109, 111, 118, 101, 100, 32, 105, 110, 32, 116, 104, 101, 32, 109, 101, 97, 110, 116, 105, 109, 101, 46, 10, 102, 115, 46, 114, 101, 97, 100, 100, 105, 114, 83, 116, 97, 116, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 112, 97, 116, 104, 44, 32, 99, 97, 108, 108, 98, 97, 99, 107, 41, 32, 123, 10, 32, 32, 99, 97, 108, 108, 98, 97, 99, 107, 32, 61, 32, 109, 97, 107, 101, 67, 97, 108, 108, 98, 97, 99, 107, 40, 99, 97, 108, 108, 98, 97, 99, 107, 41, 59, 10, 32, 32, 105, 102, 32, 40, 33, 110, 117, 108, 108, 67, 104, 101, 99, 107, 40, 112, 97, 116, 104, 44, 32, 99, 97, 108, 108, 98, 97, 99, 107, 41, 41, 32, 114, 101, 116, 117, 114, 110, 59, 10, 32, 32, 118, 97, 114, 32, 114, 101, 113, 32, 61, 32, 110, 101, 119, 32, 70, 83, 82, 101, 113, 87, 114, 97, 112, 40, 41, 59, 10, 32, 32, 114, 101, 113, 46, 111, 110, 99, 111, 109, 112, 108, 101, 116, 101, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 101, 114, 114, 44, 32, 110, 97, 109, 101, 115, 44, 32, 116, 121, 112, 101, 115, 44, 32, 112, 97, 99, 107, 101, 100, 41, 32, 123, 10, 32, 32, 32, 32, 105, 102, 32, 40, 101, 114, 114, 41, 32, 114, 101, 116, 117, 114, 110, 32, 99, 97, 108, 108, 98, 97, 99, 107, 40, 101, 114, 114, 41, 59, 10, 32, 32, 32, 32, 99, 97, 108, 108, 98, 97, 99, 107, 40, 110, 117, 108, 108, 44, 32, 123, 32, 110, 97, 109, 101, 115, 58, 32, 110, 97, 109, 101, 115, 44, 32, 115, 116, 97, 116, 115, 58, 32, 116, 111, 83, 116, 97, 116, 115, 65, 114, 114, 97, 121, 40, 110, 97, 109, 101, 115, 46, 108, 101, 110, 103, 116, 104, 44, 32, 112, 97, 99, 107, 101, 100, 41, 32, 125, 41, 59, 10, 32, 32, 125, 59, 10, 32, 32, 98, 105, 110, 100, 105, 110, 103, 46, 115, 99, 97, 110, 100, 105, 114, 40, 112, 97, 116, 104, 77, 111, 100, 117, 108, 101, 46, 95, 109, 97, 107, 101, 76, 111, 110, 103, 40, 112, 97, 116, 104, 41, 44, 32, 116, 114, 117, 101, 44, 32, 114, 101, 113, 41, 59, 10, 125, 59, 10, 10, 102, 115, 46, 114, 101, 97, 100, 100, 105, 114, 83, 116, 97, 116, 83, 121, 110, 99, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 112, 97, 116, 104, 41, 32, 123, 10, 32, 32, 110, 117, 108, 108, 67, 104, 101, 99, 107, 40, 112, 97, 116, 104, 41, 59, 10, 32, 32, 118, 97, 114, 32, 114, 101, 115, 117, 108, 116, 32, 61, 32, 98, 105, 110, 100, 105, 110, 103, 46, 115, 99, 97, 110, 100, 105, 114, 40, 112, 97, 116, 104, 77, 111, 100, 117, 108, 101, 46, 95, 109, 97, 107, 101, 76, 111, 110, 103, 40, 112, 97, 116, 104, 41, 44, 32, 116, 114, 117, 101, 41, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 123, 32, 110, 97, 109, 101, 115, 58, 32, 114, 101, 115, 117, 108, 116, 91, 48, 93, 44, 32, 115, 116, 97, 116, 115, 58, 32, 116, 111, 83, 116, 97, 116, 115, 65, 114, 114, 97, 121, 40, 114, 101, 115, 117, 108, 116, 91, 48, 93, 46, 108, 101, 110, 103, 116, 104, 44, 32, 114, 101, 115, 117, 108, 116, 91, 50, 93, 41, 32, 125, 59, 10, 125, 59, 10, 10, 47, 47, 32, 87, 97, 108, 107, 115, 32, 97, 32, 100, 105, 114, 101, 99, 116, 111, 114, 121, 32, 116, 114, 101, 101, 32, 111, 110, 32, 116, 104, 101, 32, 116, 104, 114, 101, 97, 100, 32, 112, 111, 111, 108, 44, 32, 101, 109, 105, 116, 115, 32, 39, 101, 110, 116, 114, 105, 101, 115, 39, 32, 119, 105, 116, 104, 32, 97, 114, 114, 97, 121, 115, 32, 111, 102, 10, 47, 47, 32, 68, 105, 114, 101, 110, 116, 115, 32, 110, 97, 109, 101, 100, 32, 114, 101, 108, 97, 116, 105, 118, 101, 32, 116, 111, 32, 114, 111, 111, 116, 44, 32, 39, 115, 107, 105, 112, 39, 32, 102, 111, 114, 32, 116, 104, 101, 32, 100, 105, 114, 101, 99, 116, 111, 114, 105, 101, 115, 32, 116, 104, 97, 116, 32, 99, 111, 117, 108, 100, 110, 39, 116, 10, 47, 47, 32, 98, 101, 32, 114, 101, 97, 100, 44, 32, 39, 101, 114, 114, 111, 114, 39, 32, 105, 102, 32, 114, 111, 111, 116, 32, 105, 116, 115, 101, 108, 102, 32, 99, 111, 117, 108, 100, 110, 39, 116, 44, 32, 116, 104, 101, 110, 32, 39, 101, 110, 100, 39, 46, 32, 79, 112, 116, 105, 111, 110, 115, 58, 10, 47, 47, 32, 32, 32, 100, 101, 112, 116, 104, 32, 32, 32, 32, 32, 32, 32, 32, 108, 101, 118, 101, 108, 115, 32, 111, 102, 32, 101, 110, 116, 114, 105, 101, 115, 32, 98, 101, 108, 111, 119, 32, 114, 111, 111, 116, 32, 116, 111, 32, 108, 105, 115, 116, 44, 32, 49, 32, 102, 111, 114, 32, 116, 104, 101, 32, 101, 110, 116, 114, 105, 101, 115, 10, 47, 47, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 111, 102, 32, 114, 111, 111, 116, 32, 111, 110, 108, 121, 44, 32, 48, 32, 102, 111, 114, 32, 110, 111, 110, 101, 32, 40, 73, 110, 102, 105, 110, 105, 116, 121, 41, 10, 47, 47, 32, 32, 32, 103, 108, 111, 98, 32, 32, 32, 32, 32, 32, 32, 32, 32, 112, 97, 116, 116, 101, 114, 110, 32, 111, 114, 32, 97, 114, 114, 97, 121, 32, 111, 102, 44, 32, 97, 32, 39, 42, 42, 39, 32, 99, 111, 109, 112, 111, 110, 101, 110, 116, 32, 99, 114, 111, 115, 115, 101, 115, 32, 100, 105, 114, 101, 99, 116, 111, 114, 105, 101, 115, 10, 47, 47, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 97, 110, 100, 32, 116, 104, 111, 115, 101, 32, 119, 105, 116, 104, 111, 117, 116, 32, 39, 47, 39, 32, 109, 97, 116, 99, 104, 32, 116, 104, 101, 32, 110, 97, 109, 101, 115, 32, 97, 116, 32, 97, 110, 121, 32, 108, 101, 118, 101, 108, 10, 47, 47, 32, 32, 32, 101, 120, 116, 101, 110, 115, 105, 111, 110, 115, 32, 32, 32, 97, 114, 114, 97, 121, 32, 111, 102, 32, 110, 97, 109, 101, 32, 115, 117, 102, 102, 105, 120, 101, 115, 44, 32, 108, 105, 107, 101, 32, 91, 39, 46, 106, 115, 39, 44, 32, 39, 46, 106, 115, 111, 110, 39, 93, 10, 47, 47, 32, 32, 32, 115, 121, 109, 108, 105, 110, 107, 115, 32, 32, 32, 32, 32, 39, 105, 103, 110, 111, 114, 101, 39, 44, 32, 39, 114, 101, 112, 111, 114, 116, 39, 32, 40, 97, 115, 32, 108, 105, 110, 107, 115, 41, 32, 111, 114, 32, 39, 102, 111, 108, 108, 111, 119, 39, 10, 47, 47, 32, 32, 32, 115, 116, 97, 116, 115, 32, 32, 32, 32, 32, 32, 32, 32, 97, 100, 100, 115, 32, 100, 105, 114, 101, 110, 116, 46, 115, 116, 97, 116, 115, 44, 32, 108, 115, 116, 97, 116, 40, 41, 32, 117, 110, 108, 101, 115, 115, 32, 108, 105, 110, 107, 115, 32, 97, 114, 101, 32, 102, 111, 108, 108, 111, 119, 101, 100, 10, 47, 47, 32, 32, 32, 99, 111, 110, 99, 117, 114, 114, 101, 110, 99, 121, 32, 32, 100, 105, 114, 101, 99, 116, 111, 114, 105, 101, 115, 32, 114, 101, 97, 100, 32, 97, 116, 32, 111, 110, 99, 101, 32, 40, 52, 41, 10, 47, 47, 32, 32, 32, 98, 97, 116, 99, 104, 83, 105, 122, 101, 32, 32, 32, 32, 101, 110, 116, 114, 105, 101, 115, 32, 111, 102, 32, 111, 110, 101, 32, 39, 101, 110, 116, 114, 105, 101, 115, 39, 32, 101, 118, 101, 110, 116, 32, 40, 50, 53, 54, 41, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 87, 97, 108, 107, 101, 114, 40, 114, 111, 111, 116, 41, 32, 123, 10, 32, 32, 69, 118, 101, 110, 116, 69, 109, 105, 116, 116, 101, 114, 46, 99, 97, 108, 108, 40, 116, 104, 105, 115, 41, 59, 10, 32, 32, 116, 104, 105, 115, 46, 114, 111, 111, 116, 32, 61, 32, 114, 111, 111, 116, 59, 10, 32, 32, 116, 104, 105, 115, 46, 99, 108, 111, 115, 101, 100, 32, 61, 32, 102, 97, 108, 115, 101, 59, 10, 125, 10, 117, 116, 105, 108, 46, 105, 110, 104, 101, 114, 105, 116, 115, 40, 87, 97, 108, 107, 101, 114, 44, 32, 69, 118, 101, 110, 116, 69, 109, 105, 116, 116, 101, 114, 41, 59, 10, 10, 47, 47, 32, 110, 111, 116, 104, 105, 110, 103, 32, 109, 111, 114, 101, 32, 105, 115, 32, 101, 109, 105, 116, 116, 101, 100, 44, 32, 116, 104, 101, 32, 119, 97, 108, 107, 32, 115, 116, 111, 112, 115, 32, 119, 105, 116, 104, 32, 116, 104, 101, 32, 98, 97, 116, 99, 104, 32, 98, 101, 105, 110, 103, 32, 114, 101, 97, 100, 10, 87, 97, 108, 107, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 99, 108, 111, 115, 101, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 32, 123, 10, 32, 32, 116, 104, 105, 115, 46, 99, 108, 111, 115, 101, 100, 32, 61, 32, 116, 114, 117, 101, 59, 10, 125, 59, 10, 10, 99, 111, 110, 115, 116, 32, 119, 97, 108, 107, 83, 121, 109, 108, 105, 110, 107, 115, 32, 61, 32, 123, 32, 105, 103, 110, 111, 114, 101, 58, 32, 48, 44, 32, 114, 101, 112, 111, 114, 116, 58, 32, 49, 44, 32, 102, 111, 108, 108, 111, 119, 58, 32, 50, 32, 125, 59, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 116, 111, 65, 114, 114, 97, 121, 40, 118, 97, 108, 117, 101, 41, 32, 123, 10, 32, 32, 105, 102, 32, 40, 118, 97, 108, 117, 101, 32, 61, 61, 61, 32, 117, 110, 100, 101, 102, 105, 110, 101, 100, 32, 124, 124, 32, 118, 97, 108, 117, 101, 32, 61, 61, 61, 32, 110, 117, 108, 108, 41, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 110, 117, 108, 108, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 65, 114, 114, 97, 121, 46, 105, 115, 65, 114, 114, 97, 121, 40, 118, 97, 108, 117, 101, 41, 32, 63, 32, 118, 97, 108, 117, 101, 46, 109, 97, 112, 40, 83, 116, 114, 105, 110, 103, 41, 32, 58, 32, 91, 83, 116, 114, 105, 110, 103, 40, 118, 97, 108, 117, 101, 41, 93, 59, 10, 125, 10, 10, 102, 115, 46, 119, 97, 108, 107, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 114, 111, 111, 116, 44, 32, 111, 112, 116, 105, 111, 110, 115, 41, 32, 123, 10, 32, 32, 110, 117, 108, 108, 67, 104, 101, 99, 107, 40, 114, 111, 111, 116, 41, 59, 10, 32, 32, 111, 112, 116, 105, 111, 110, 115, 32, 61, 32, 111, 112, 116, 105, 111, 110, 115, 32, 124, 124, 32, 123, 125, 59, 10, 10, 32, 32, 99, 111, 110, 115, 116, 32, 115, 121, 109, 108, 105, 110, 107, 115, 32, 61, 32, 119, 97, 108, 107, 83, 121, 109, 108, 105, 110, 107, 115, 91, 111, 112, 116, 105, 111, 110, 115, 46, 115, 121, 109, 108, 105, 110, 107, 115, 32, 124, 124, 32, 39, 114, 101, 112, 111, 114, 116, 39, 93, 59, 10, 32, 32, 105, 102, 32, 40, 115, 121, 109, 108, 105, 110, 107, 115, 32, 61, 61, 61, 32, 117, 110, 100, 101, 102, 105, 110, 101, 100, 41, 10, 32, 32, 32, 32, 116, 104, 114, 111, 119, 32, 110, 101, 119, 32, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 115, 121, 109, 108, 105, 110, 107, 115, 32, 109, 117, 115, 116, 32, 98, 101, 32, 105, 103, 110, 111, 114, 101, 44, 32, 114, 101, 112, 111, 114, 116, 32, 111, 114, 32, 102, 111, 108, 108, 111, 119, 39, 41, 59, 10, 10, 32, 32, 99, 111, 110, 115, 116, 32, 100, 101, 112, 116, 104, 32, 61, 32, 111, 112, 116, 105, 111, 110, 115, 46, 100, 101, 112, 116, 104, 32, 61, 61, 61, 32, 117, 110, 100, 101, 102, 105, 110, 101, 100, 32, 124, 124, 32, 111, 112, 116, 105, 111, 110, 115, 46, 100, 101, 112, 116, 104, 32, 61, 61, 61, 32, 73, 110, 102, 105, 110, 105, 116, 121, 32, 63, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 45, 49, 32, 58, 32, 77, 97, 116, 104, 46, 109, 97, 120, 40, 48, 44, 32, 111, 112, 116, 105, 111, 110, 115, 46, 100, 101, 112, 116, 104, 32, 124, 32, 48, 41, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 101, 120, 116, 101, 110, 115, 105, 111, 110, 115, 32, 61, 32, 116, 111, 65, 114, 114, 97, 121, 40, 111, 112, 116, 105, 111, 110, 115, 46, 101, 120, 116, 101, 110, 115, 105, 111, 110, 115, 41, 59, 10, 32, 32, 105, 102, 32, 40, 101, 120, 116, 101, 110, 115, 105, 111, 110, 115, 41, 32, 123, 10, 32, 32, 32, 32, 102, 111, 114, 32, 40, 118, 97, 114, 32, 105, 32, 61, 32, 48, 59, 32, 105, 32, 60, 32, 101, 120, 116, 101, 110, 115, 105, 111, 110, 115, 46, 108, 101, 110, 103, 116, 104, 59, 32, 105, 43, 43, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 105, 102, 32, 40, 101, 120, 116, 101, 110, 115, 105, 111, 110, 115, 91, 105, 93, 91, 48, 93, 32, 33, 61, 61, 32, 39, 46, 39, 41, 10, 32, 32, 32, 32, 32, 32, 32, 32, 101, 120, 116, 101, 110, 115, 105, 111, 110, 115, 91, 105, 93, 32, 61, 32, 39, 46, 39, 32, 43, 32, 101, 120, 116, 101, 110, 115, 105, 111, 110, 115, 91, 105, 93, 59, 10, 32, 32, 32, 32, 125, 10, 32, 32, 125, 10, 10, 32, 32, 99, 111, 110, 115, 116, 32, 119, 97, 108, 107, 101, 114, 32, 61, 32, 110, 101, 119, 32, 87, 97, 108, 107, 101, 114, 40, 114, 111, 111, 116, 41, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 115, 101, 112, 32, 61, 32, 47, 91, 92, 47, 92, 92, 93, 36, 47, 46, 116, 101, 115, 116, 40, 114, 111, 111, 116, 41, 32, 63, 32, 39, 39, 32, 58, 32, 112, 97, 116, 104, 77, 111, 100, 117, 108, 101, 46, 115, 101, 112, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 114, 101, 113, 32, 61, 32, 110, 101, 119, 32, 70, 83, 82, 101, 113, 87, 114, 97, 112, 40, 41, 59, 10, 10, 32, 32, 114, 101, 113, 46, 111, 110, 101, 110, 116, 114, 105, 101, 115, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 110, 97, 109, 101, 115, 44, 32, 116, 121, 112, 101, 115, 44, 32, 112, 97, 99, 107, 101, 100, 44, 32, 101, 114, 114, 111, 114, 115, 41, 32, 123, 10, 32, 32, 32, 32, 105, 102, 32, 40, 119, 97, 108, 107, 101, 114, 46, 99, 108, 111, 115, 101, 100, 41, 32, 114, 101, 116, 117, 114, 110, 32, 102, 97, 108, 115, 101, 59, 10, 10, 32, 32, 32, 32, 102, 111, 114, 32, 40, 118, 97, 114, 32, 105, 32, 61, 32, 48, 59, 32, 105, 32, 60, 32, 101, 114, 114, 111, 114, 115, 46, 108, 101, 110, 103, 116, 104, 59, 32, 105, 43, 43, 41, 10, 32, 32, 32, 32, 32, 32, 119, 97, 108, 107, 101, 114, 46, 101, 109, 105, 116, 40, 39, 115, 107, 105, 112, 39, 44, 32, 110, 101, 119, 32, 69, 114, 114, 111, 114, 40, 101, 114, 114, 111, 114, 115, 91, 105, 93, 41, 41, 59, 10, 10, 32, 32, 32, 32, 105, 102, 32, 40, 110, 97, 109, 101, 115, 46, 108, 101, 110, 103, 116, 104, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 115, 116, 97, 116, 115, 32, 61, 32, 112, 97, 99, 107, 101, 100, 32, 63, 32, 116, 111, 83, 116, 97, 116, 115, 65, 114, 114, 97, 121, 40, 110, 97, 109, 101, 115, 46, 108, 101, 110, 103, 116, 104, 44, 32, 112, 97, 99, 107, 101, 100, 41, 32, 58, 32, 110, 117, 108, 108, 59, 10, 32, 32, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 100, 105, 114, 101, 110, 116, 115, 32, 61, 32, 116, 111, 68, 105, 114, 101, 110, 116, 115, 40, 110, 97, 109, 101, 115, 44, 32, 116, 121, 112, 101, 115, 41, 59, 10, 32, 32, 32, 32, 32, 32, 102, 111, 114, 32, 40, 118, 97, 114, 32, 106, 32, 61, 32, 48, 59, 32, 106, 32, 60, 32, 100, 105, 114, 101, 110, 116, 115, 46, 108, 101, 110, 103, 116, 104, 59, 32, 106, 43, 43, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 100, 105, 114, 101, 110, 116, 115, 91, 106, 93, 46, 112, 97, 116, 104, 32, 61, 32, 114, 111, 111, 116, 32, 43, 32, 115, 101, 112, 32, 43, 32, 110, 97, 109, 101, 115, 91, 106, 93, 59, 10, 32, 32, 32, 32, 32, 32, 32, 32, 105, 102, 32, 40, 115, 116, 97, 116, 115, 41, 32, 100, 105, 114, 101, 110, 116, 115, 91, 106, 93, 46, 115, 116, 97, 116, 115, 32, 61, 32, 115, 116, 97, 116, 115, 91, 106, 93, 59, 10, 32, 32, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 32, 32, 119, 97, 108, 107, 101, 114, 46, 101, 109, 105, 116, 40, 39, 101, 110, 116, 114, 105, 101, 115, 39, 44, 32, 100, 105, 114, 101, 110, 116, 115, 41, 59, 10, 32, 32, 32, 32, 125, 10, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 33, 119, 97, 108, 107, 101, 114, 46, 99, 108, 111, 115, 101, 100, 59, 10, 32, 32, 125, 59, 10, 10, 32, 32, 114, 101, 113, 46, 111, 110, 99, 111, 109, 112, 108, 101, 116, 101, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 101, 114, 114, 41, 32, 123, 10, 32, 32, 32, 32, 105, 102, 32, 40, 119, 97, 108, 107, 101, 114, 46, 99, 108, 111, 115, 101, 100, 41, 32, 114, 101, 116, 117, 114, 110, 59, 10, 32, 32, 32, 32, 119, 97, 108, 107, 101, 114, 46, 99, 108, 111, 115, 101, 100, 32, 61, 32, 116, 114, 117, 101, 59, 10, 32, 32, 32, 32, 105, 102, 32, 40, 101, 114, 114, 41, 32, 119, 97, 108, 107, 101, 114, 46, 101, 109, 105, 116, 40, 39, 101, 114, 114, 111, 114, 39, 44, 32, 110, 101, 119, 32, 69, 114, 114, 111, 114, 40, 101, 114, 114, 41, 41, 59, 10, 32, 32, 32, 32, 101, 108, 115, 101, 32, 119, 97, 108, 107, 101, 114, 46, 101, 109, 105, 116, 40, 39, 101, 110, 100, 39, 41, 59, 10, 32, 32, 125, 59, 10, 10, 32, 32, 98, 105, 110, 100, 105, 110, 103, 46, 119, 97, 108, 107, 40, 112, 97, 116, 104, 77, 111, 100, 117, 108, 101, 46, 95, 109, 97, 107, 101, 76, 111, 110, 103, 40, 114, 111, 111, 116, 41, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 100, 101, 112, 116, 104, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 116, 111, 65, 114, 114, 97, 121, 40, 111, 112, 116, 105, 111, 110, 115, 46, 103, 108, 111, 98, 41, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 101, 120, 116, 101, 110, 115, 105, 111, 110, 115, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 115, 121, 109, 108, 105, 110, 107, 115, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 33, 33, 111, 112, 116, 105, 111, 110, 115, 46, 115, 116, 97, 116, 115, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 111, 112, 116, 105, 111, 110, 115, 46, 99, 111, 110, 99, 117, 114, 114, 101, 110, 99, 121, 32, 61, 61, 61, 32, 117, 110, 100, 101, 102, 105, 110, 101, 100, 32, 63, 32, 52, 32, 58, 32, 111, 112, 116, 105, 111, 110, 115, 46, 99, 111, 110, 99, 117, 114, 114, 101, 110, 99, 121, 32, 124, 32, 48, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 111, 112, 116, 105, 111, 110, 115, 46, 98, 97, 116, 99, 104, 83, 105, 122, 101, 32, 61, 61, 61, 32, 117, 110, 100, 101, 102, 105, 110, 101, 100, 32, 63, 32, 50, 53, 54, 32, 58, 32, 111, 112, 116, 105, 111, 110, 115, 46, 98, 97, 116, 99, 104, 83, 105, 122, 101, 32, 124, 32, 48, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 114, 101, 113, 41, 59, 10, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 119, 97, 108, 107, 101, 114, 59, 10, 125, 59, 10, 10, 102, 115, 46, 102, 115, 116, 97, 116, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 102, 100, 44, 32, 99, 97, 108, 108, 98, 97, 99, 107, 41, 32, 123, 10, 32, 32, 118, 97, 114, 32, 114, 101, 113, 32, 61, 32, 110, 101, 119, 32, 70, 83, 82, 101, 113, 87, 114, 97, 112, 40, 41, 59, 10, 32, 32, 114, 101, 113, 46, 111, 110, 99, 111, 109, 112, 108, 101, 116, 101, 32, 61, 32, 109, 97, 107, 101, 83, 116, 97, 116, 115, 67, 97, 108, 108, 98, 97, 99, 107, 40, 109, 97, 107, 101, 67, 97, 108, 108, 98, 97, 99, 107, 40, 99, 97, 108, 108, 98, 97, 99, 107, 41, 41, 59, 10, 32, 32, 98, 105, 110, 100, 105, 110, 103, 46, 102, 115, 116, 97, 116, 40, 102, 100, 44, 32, 114, 101, 113, 44, 32, 107, 83, 104, 97, 114, 101, 83, 116, 97, 116, 115, 41, 59, 10, 125, 59, 10, 10, 102, 115, 46, 108, 115, 116, 97, 116, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 112, 97, 116, 104, 44, 32, 99, 97, 108, 108, 98, 97, 99, 107, 41, 32, 123, 10, 32, 32, 99, 97, 108, 108, 98, 97, 99, 107, 32, 61, 32, 109, 97, 107, 101, 67, 97, 108, 108, 98, 97, 99, 107, 40, 99, 97, 108, 108, 98, 97, 99, 107, 41, 59, 10, 32, 32, 105, 102, 32, 40, 33, 110, 117, 108, 108, 67, 104, 101, 99, 107, 40, 112, 97, 116, 104, 44, 32, 99, 97, 108, 108, 98, 97, 99, 107, 41, 41, 32, 114, 101, 116, 117, 114, 110, 59, 10, 32, 32, 118, 97, 114, 32, 114, 101, 113, 32, 61, 32, 110, 101, 119, 32, 70, 83, 82, 101, 113, 87, 114, 97, 112, 40, 41, 59, 10, 32, 32, 114, 101, 113, 46, 111, 110, 99, 111, 109, 112, 108, 101, 116, 101, 32, 61, 32, 109, 97, 107, 101, 83, 116, 97, 116, 115, 67, 97, 108, 108, 98, 97, 99, 107, 40, 99, 97, 108, 108, 98, 97, 99, 107, 41, 59, 10, 32, 32, 98, 105, 110, 100, 105, 110, 103, 46, 108, 115, 116, 97, 116, 40, 112, 97, 116, 104, 77, 111, 100, 117, 108, 101, 46, 95, 109, 97, 107, 101, 76, 111, 110, 103, 40, 112, 97, 116, 104, 41, 44, 32, 114, 101, 113, 44, 32, 107, 83, 104, 97, 114, 101, 83, 116, 97, 116, 115, 41, 59, 10, 125, 59, 10, 10, 102, 115, 46, 115, 116, 97, 116, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 112, 97, 116, 104, 44, 32, 99, 97, 108, 108, 98, 97, 99, 107, 41, 32, 123, 10, 32, 32, 99, 97, 108, 108, 98, 97, 99, 107, 32, 61, 32, 109, 97, 107, 101, 67, 97, 108, 108, 98, 97, 99, 107, 40, 99, 97, 108, 108, 98, 97, 99, 107, 41, 59, 10, 32, 32, 105, 102, 32, 40, 33, 110, 117, 108, 108, 67, 104, 101, 99, 107, 40, 112, 97, 116, 104, 44, 32, 99, 97, 108, 108, 98, 97, 99, 107, 41, 41, 32, 114, 101, 116, 117, 114, 110, 59, 10, 32, 32, 118, 97, 114, 32, 114, 101, 113, 32, 61, 32, 110, 101, 119, 32, 70, 83, 82, 101, 113, 87, 114, 97, 112, 40, 41, 59, 10, 32, 32, 114, 101, 113, 46, 111, 110, 99, 111, 109, 112, 108, 101, 116, 101, 32, 61, 32, 109, 97, 107, 101, 83, 116, 97, 116, 115, 67, 97, 108, 108, 98, 97, 99, 107, 40, 99, 97, 108, 108, 98, 97, 99, 107, 41, 59, 10, 32, 32, 98, 105, 110, 100, 105, 110, 103, 46, 115, 116, 97, 116, 40, 112, 97, 116, 104, 77, 111, 100, 117, 108, 101, 46, 95, 109, 97, 107, 101, 76, 111, 110, 103, 40, 112, 97, 116, 104, 41, 44, 32, 114, 101, 113, 44, 32, 107, 83, 104, 97, 114, 101, 83, 116, 97, 116, 115, 41, 59, 10, 125, 59, 10, 10, 102, 115, 46, 102, 115, 116, 97, 116, 83, 121, 110, 99, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 102, 100, 41, 32, 123, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 116, 111, 83, 116, 97, 116, 115, 40, 98, 105, 110, 100, 105, 110, 103, 46, 102, 115, 116, 97, 116, 40, 102, 100, 44, 32, 117, 110, 100, 101, 102, 105, 110, 101, 100, 44, 32, 107, 83, 104, 97, 114, 101, 83, 116, 97, 116, 115, 41, 41, 59, 10, 125, 59, 10, 10, 102, 115, 46, 108, 115, 116, 97, 116, 83, 121, 110, 99, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 112, 97, 116, 104, 41, 32, 123, 10, 32, 32, 110, 117, 108, 108, 67, 104, 101, 99, 107, 40, 112, 97, 116, 104, 41, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 116, 111, 83, 116, 97, 116, 115, 40, 98, 105, 110, 100, 105, 110, 103, 46, 108, 115, 116, 97, 116, 40, 112, 97, 116, 104, 77, 111, 100, 117, 108, 101, 46, 95, 109, 97, 107, 101, 76, 111, 110, 103, 40, 112, 97, 116, 104, 41, 44, 32, 117, 110, 100, 101, 102, 105, 110, 101, 100, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 107, 83, 104, 97, 114, 101, 83, 116, 97, 116, 115, 41, 41, 59, 10, 125, 59, 10, 10, 102, 115, 46, 115, 116, 97, 116, 83, 121, 110, 99, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 112, 97, 116, 104, 41, 32, 123, 10, 32, 32, 110, 117, 108, 108, 67, 104, 101, 99, 107, 40, 112, 97, 116, 104, 41, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 116, 111, 83, 116, 97, 116, 115, 40, 98, 105, 110, 100, 105, 110, 103, 46, 115, 116, 97, 116, 40, 112, 97, 116, 104, 77, 111, 100, 117, 108, 101, 46, 95, 109, 97, 107, 101, 76, 111, 110, 103, 40, 112, 97, 116, 104, 41, 44, 32, 117, 110, 100, 101, 102, 105, 110, 101, 100, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 107, 83, 104, 97, 114, 101, 83, 116, 97, 116, 115, 41, 41, 59, 10, 125, 59, 10, 10, 102, 115, 46, 114, 101, 97, 100, 108, 105, 110, 107, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 112, 97, 116, 104, 44, 32, 99, 97, 108, 108, 98, 97, 99, 107, 41, 32, 123, 10, 32, 32, 99, 97, 108, 108, 98, 97, 99, 107, 32, 61, 32, 109, 97, 107, 101, 67, 97, 108, 108, 98, 97, 99, 107, 40, 99, 97, 108, 108, 98, 97, 99, 107, 41, 59, 10, 32, 32, 105, 102, 32, 40, 33, 110, 117, 108, 108, 67, 104, 101, 99, 107, 40, 112, 97, 116, 104, 44, 32, 99, 97, 108, 108, 98, 97, 99, 107, 41, 41, 32, 114, 101, 116, 117, 114, 110, 59, 10, 32, 32, 118, 97, 114, 32, 114, 101, 113, 32, 61, 32, 110, 101, 119, 32, 70, 83, 82, 101, 113, 87, 114, 97, 112, 40, 41, 59, 10, 32, 32, 114, 101, 113, 46, 111, 110, 99, 111, 109, 112, 108, 101, 116, 101, 32, 61, 32, 99, 97, 108, 108, 98, 97, 99, 107, 59, 10, 32, 32, 98, 105, 110, 100, 105, 110, 103, 46, 114, 101, 97, 100, 108, 105, 110, 107, 40, 112, 97, 116, 104, 77, 111, 100, 117, 108, 101, 46, 95, 109, 97, 107, 101, 76, 111, 110, 103, 40, 112, 97, 116, 104, 41, 44, 32, 114, 101, 113, 41, 59, 10, 125, 59, 10, 10, 102, 115, 46, 114, 101, 97, 100, 108, 105, 110, 107, 83, 121, 110, 99, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 112, 97, 116, 104, 41, 32, 123, 10, 32, 32, 110, 117, 108, 108, 67, 104, 101, 99, 107, 40, 112, 97, 116, 104, 41, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 98, 105, 110, 100, 105, 110, 103, 46, 114, 101, 97, 100, 108, 105, 110, 107, 40, 112, 97, 116, 104, 77, 111, 100, 117, 108, 101, 46, 95, 109, 97, 107, 101, 76, 111, 110, 103, 40, 112, 97, 116, 104, 41, 41, 59, 10, 125, 59, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 112, 114, 101, 112, 114, 111, 99, 101, 115, 115, 83, 121, 109, 108, 105, 110, 107, 68, 101, 115, 116, 105, 110, 97, 116, 105, 111, 110, 40, 112, 97, 116, 104, 44, 32, 116, 121, 112, 101, 44, 32, 108, 105, 110, 107, 80, 97, 116, 104, 41, 32, 123, 10, 32, 32, 105, 102, 32, 40, 33, 105, 115, 87, 105, 110, 100, 111, 119, 115, 41, 32, 123, 10, 32, 32, 32, 32, 47, 47, 32, 78, 111, 32, 112, 114, 101, 112, 114, 111, 99, 101, 115, 115, 105, 110, 103, 32, 105, 115, 32, 110, 101, 101, 100, 101, 100, 32, 111, 110, 32, 85, 110, 105, 120, 46, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 112, 97, 116, 104, 59, 10, 32, 32, 125, 32, 101, 108, 115, 101, 32, 105, 102, 32, 40, 116, 121, 112, 101, 32, 61, 61, 61, 32, 39, 106, 117, 110, 99, 116, 105, 111, 110, 39, 41, 32, 123, 10, 32, 32, 32, 32, 47, 47, 32, 74, 117, 110, 99, 116, 105, 111, 110, 115, 32, 112, 97, 116, 104, 115, 32, 110, 101, 101, 100, 32, 116, 111, 32, 98, 101, 32, 97, 98, 115, 111, 108, 117, 116, 101, 32, 97, 110, 100, 32, 92, 92, 63, 92, 45, 112, 114, 101, 102, 105, 120, 101, 100, 46, 10, 32, 32, 32, 32, 47, 47, 32, 65, 32, 114, 101, 108, 97, 116, 105, 118, 101, 32, 116, 97, 114, 103, 101, 116, 32, 105, 115, 32, 114, 101, 108, 97, 116, 105, 118, 101, 32, 116, 111, 32, 116, 104, 101, 32, 108, 105, 110, 107, 39, 115, 32, 112, 97, 114, 101, 110, 116, 32, 100, 105, 114, 101, 99, 116, 111, 114, 121, 46, 10, 32, 32, 32, 32, 112, 97, 116, 104, 32, 61, 32, 112, 97, 116, 104, 77, 111, 100, 117, 108, 101, 46, 114, 101, 115, 111, 108, 118, 101, 40, 108, 105, 110, 107, 80, 97, 116, 104, 44, 32, 39, 46, 46, 39, 44, 32, 112, 97, 116, 104, 41, 59, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 112, 97, 116, 104, 77, 111, 100, 117, 108, 101, 46, 95, 109, 97, 107, 101, 76, 111, 110, 103, 40, 112, 97, 116, 104, 41, 59, 10, 32, 32, 125, 32, 101, 108, 115, 101, 32, 123, 10, 32, 32, 32, 32, 47, 47, 32, 87, 105, 110, 100, 111, 119, 115, 32, 115, 121, 109, 108, 105, 110, 107, 115, 32, 100, 111, 110, 39, 116, 32, 116, 111, 108, 101, 114, 97, 116, 101, 32, 102, 111, 114, 119, 97, 114, 100, 32, 115, 108, 97, 115, 104, 101, 115, 46, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 40, 39, 39, 32, 43, 32, 112, 97, 116, 104, 41, 46, 114, 101, 112, 108, 97, 99, 101, 40, 47, 92, 47, 47, 103, 44, 32, 39, 92, 92, 39, 41, 59, 10, 32, 32, 125, 10, 125, 10, 10, 102, 115, 46, 115, 121, 109, 108, 105, 110, 107, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 116, 97, 114, 103, 101, 116, 44, 32, 112, 97, 116, 104, 44, 32, 116, 121, 112, 101, 95, 44, 32, 99, 97, 108, 108, 98, 97, 99, 107, 95, 41, 32, 123, 10, 32, 32, 118, 97, 114, 32, 116, 121, 112, 101, 32, 61, 32, 40, 116, 121, 112, 101, 111, 102, 32, 116, 121, 112, 101, 95, 32, 61, 61, 61, 32, 39, 115, 116, 114, 105, 110, 103, 39, 32, 63, 32, 116, 121, 112, 101, 95, 32, 58, 32, 110, 117, 108, 108, 41, 59, 10, 32, 32, 118, 97, 114, 32, 99, 97, 108, 108, 98, 97, 99, 107, 32, 61, 32, 109, 97, 107, 101, 67, 97, 108, 108, 98, 97, 99, 107, 40, 97, 114, 103, 117, 109, 101, 110, 116, 115, 91, 97, 114, 103, 117, 109, 101, 110, 116, 115, 46, 108, 101, 110, 103, 116, 104, 32, 45, 32, 49, 93, 41, 59, 10, 10, 32, 32, 105, 102, 32, 40, 33, 110, 117, 108, 108, 67, 104, 101, 99, 107, 40, 116, 97, 114, 103, 101, 116, 44, 32, 99, 97, 108, 108, 98, 97, 99, 107, 41, 41, 32, 114, 101, 116, 117, 114, 110, 59, 10, 32, 32, 105, 102, 32, 40, 33, 110, 117, 108, 108, 67, 104, 101, 99, 107, 40, 112, 97, 116, 104, 44, 32, 99, 97, 108, 108, 98, 97, 99, 107, 41, 41, 32, 114, 101, 116, 117, 114, 110, 59, 10, 10, 32, 32, 118, 97, 114, 32, 114, 101, 113, 32, 61, 32, 110, 101, 119, 32, 70, 83, 82, 101, 113, 87, 114, 97, 112, 40, 41, 59, 10, 32, 32, 114, 101, 113, 46, 111, 110, 99, 111, 109, 112, 108, 101, 116, 101, 32, 61, 32, 99, 97, 108, 108, 98, 97, 99, 107, 59, 10, 10, 32, 32, 98, 105, 110, 100, 105, 110, 103, 46, 115, 121, 109, 108, 105, 110, 107, 40, 112, 114, 101, 112, 114, 111, 99, 101, 115, 115, 83, 121, 109, 108, 105, 110, 107, 68, 101, 115, 116, 105, 110, 97, 116, 105, 111, 110, 40, 116, 97, 114, 103, 101, 116, 44, 32, 116, 121, 112, 101, 44, 32, 112, 97, 116, 104, 41, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 112, 97, 116, 104, 77, 111, 100, 117, 108, 101, 46, 95, 109, 97, 107, 101, 76, 111, 110, 103, 40, 112, 97, 116, 104, 41, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 116, 121, 112, 101, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 114, 101, 113, 41, 59, 10, 125, 59, 10, 10, 102, 115, 46, 115, 121, 109, 108, 105, 110, 107, 83, 121, 110, 99, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 116, 97, 114, 103, 101, 116, 44, 32, 112, 97, 116, 104, 44, 32, 116, 121, 112, 101, 41, 32, 123, 10, 32, 32, 116, 121, 112, 101, 32, 61, 32, 40, 116, 121, 112, 101, 111, 102, 32, 116, 121, 112, 101, 32, 61, 61, 61, 32, 39, 115, 116, 114, 105, 110, 103, 39, 32, 63, 32, 116, 121, 112, 101, 32, 58, 32, 110, 117, 108, 108, 41, 59, 10, 10, 32, 32, 110, 117, 108, 108, 67, 104, 101, 99, 107, 40, 116, 97, 114, 103, 101, 116, 41, 59, 10, 32, 32, 110, 117, 108, 108, 67, 104, 101, 99, 107, 40, 112, 97, 116, 104, 41, 59, 10, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 98, 105, 110, 100, 105, 110, 103, 46, 115, 121, 109, 108, 105, 110, 107, 40, 112, 114, 101, 112, 114, 111, 99, 101, 115, 115, 83, 121, 109, 108, 105, 110, 107, 68, 101, 115, 116, 105, 110, 97, 116, 105, 111, 110, 40, 116, 97, 114, 103, 101, 116, 44, 32, 116, 121, 112, 101, 44, 32, 112, 97, 116, 104, 41, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 112, 97, 116, 104, 77, 111, 100, 117, 108, 101, 46, 95, 109, 97, 107, 101, 76, 111, 110, 103, 40, 112, 97, 116, 104, 41, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 116, 121, 112, 101, 41, 59, 10, 125, 59, 10, 10, 102, 115, 46, 108, 105, 110, 107, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 115, 114, 99, 112, 97, 116, 104, 44, 32, 100, 115, 116, 112, 97, 116, 104, 44, 32, 99, 97, 108, 108, 98, 97, 99, 107, 41, 32, 123, 10, 32, 32, 99, 97, 108, 108, 98, 97, 99, 107, 32, 61, 32, 109, 97, 107, 101, 67, 97, 108, 108, 98, 97, 99, 107, 40, 99, 97, 108, 108, 98, 97, 99, 107, 41, 59, 10, 32, 32, 105, 102, 32, 40, 33, 110, 117, 108, 108, 67, 104, 101, 99, 107, 40, 115, 114, 99, 112, 97, 116, 104, 44, 32, 99, 97, 108, 108, 98, 97, 99, 107, 41, 41, 32, 114, 101, 116, 117, 114, 110, 59, 10, 32, 32, 105, 102, 32, 40, 33, 110, 117, 108, 108, 67, 104, 101, 99, 107, 40, 100, 115, 116, 112, 97, 116, 104, 44, 32, 99, 97, 108, 108, 98, 97, 99, 107, 41, 41, 32, 114, 101, 116, 117, 114, 110, 59, 10, 10, 32, 32, 118, 97, 114, 32, 114, 101, 113, 32, 61, 32, 110, 101, 119, 32, 70, 83, 82, 101, 113, 87, 114, 97, 112, 40, 41, 59, 10, 32, 32, 114, 101, 113, 46, 111, 110, 99, 111, 109, 112, 108, 101, 116, 101, 32, 61, 32, 99, 97, 108, 108, 98, 97, 99, 107, 59, 10, 10, 32, 32, 98, 105, 110, 100, 105, 110, 103, 46, 108, 105, 110, 107, 40, 112, 97, 116, 104, 77, 111, 100, 117, 108, 101, 46, 95, 109, 97, 107, 101, 76, 111, 110, 103, 40, 115, 114, 99, 112, 97, 116, 104, 41, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 112, 97, 116, 104, 77, 111, 100, 117, 108, 101, 46, 95, 109, 97, 107, 101, 76, 111, 110, 103, 40, 100, 115, 116, 112, 97, 116, 104, 41, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 114, 101, 113, 41, 59, 10, 125, 59, 10, 10, 102, 115, 46, 108, 105, 110, 107, 83, 121, 110, 99, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 115, 114, 99, 112, 97, 116, 104, 44, 32, 100, 115, 116, 112, 97, 116, 104, 41, 32, 123, 10, 32, 32, 110, 117, 108, 108, 67, 104, 101, 99, 107, 40, 115, 114, 99, 112, 97, 116, 104, 41, 59, 10, 32, 32, 110, 117, 108, 108, 67, 104, 101, 99, 107, 40, 100, 115, 116, 112, 97, 116, 104, 41, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 98, 105, 110, 100, 105, 110, 103, 46, 108, 105, 110, 107, 40, 112, 97, 116, 104, 77, 111, 100, 117, 108, 101, 46, 95, 109, 97, 107, 101, 76, 111, 110, 103, 40, 115, 114, 99, 112, 97, 116, 104, 41, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 112, 97, 116, 104, 77, 111, 100, 117, 108, 101, 46, 95, 109, 97, 107, 101, 76, 111, 110, 103, 40, 100, 115, 116, 112, 97, 116, 104, 41, 41, 59, 10, 125, 59, 10, 10, 102, 115, 46, 117, 110, 108, 105, 110, 107, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 112, 97, 116, 104, 44, 32, 99, 97, 108, 108, 98, 97, 99, 107, 41, 32, 123, 10, 32, 32, 99, 97, 108, 108, 98, 97, 99, 107, 32, 61, 32, 109, 97, 107, 101, 67, 97, 108, 108, 98, 97, 99, 107, 40, 99, 97, 108, 108, 98, 97, 99, 107, 41, 59, 10, 32, 32, 105, 102, 32, 40, 33, 110, 117, 108, 108, 67, 104, 101, 99, 107, 40, 112, 97, 116, 104, 44, 32, 99, 97, 108, 108, 98, 97, 99, 107, 41, 41, 32, 114, 101, 116, 117, 114, 110, 59, 10, 32, 32, 118, 97, 114, 32, 114, 101, 113, 32, 61, 32, 110, 101, 119, 32, 70, 83, 82, 101, 113, 87, 114, 97, 112, 40, 41, 59, 10, 32, 32, 114, 101, 113, 46, 111, 110, 99, 111, 109, 112, 108, 101, 116, 101, 32, 61, 32, 99, 97, 108, 108, 98, 97, 99, 107, 59, 10, 32, 32, 98, 105, 110, 100, 105, 110, 103, 46, 117, 110, 108, 105, 110, 107, 40, 112, 97, 116, 104, 77, 111, 100, 117, 108, 101, 46, 95, 109, 97, 107, 101, 76, 111, 110, 103, 40, 112, 97, 116, 104, 41, 44, 32, 114, 101, 113, 41, 59, 10, 125, 59, 10, 10, 102, 115, 46, 117, 110, 108, 105, 110, 107, 83, 121, 110, 99, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 112, 97, 116, 104, 41, 32, 123, 10, 32, 32, 110, 117, 108, 108, 67, 104, 101, 99, 107, 40, 112, 97, 116, 104, 41, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 98, 105, 110, 100, 105, 110, 103, 46, 117, 110, 108, 105, 110, 107, 40, 112, 97, 116, 104, 77, 111, 100, 117, 108, 101, 46, 95, 109, 97, 107, 101, 76, 111, 110, 103, 40, 112, 97, 116, 104, 41, 41, 59, 10, 125, 59, 10, 10, 102, 115, 46, 102, 99, 104, 109, 111, 100, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 102, 100, 44, 32, 109, 111, 100, 101, 44, 32, 99, 97, 108, 108, 98, 97, 99, 107, 41, 32, 123, 10, 32, 32, 118, 97, 114, 32, 114, 101, 113, 32, 61, 32, 110, 101, 119, 32, 70, 83, 82, 101, 113, 87, 114, 97, 112, 40, 41, 59, 10, 32, 32, 114, 101, 113, 46, 111, 110, 99, 111, 109, 112, 108, 101, 116, 101, 32, 61, 32, 109, 97, 107, 101, 67, 97, 108, 108, 98, 97, 99, 107, 40, 99, 97, 108, 108, 98, 97, 99, 107, 41, 59, 10, 32, 32, 98, 105, 110, 100, 105, 110, 103, 46, 102, 99, 104, 109, 111, 100, 40, 102, 100, 44, 32, 109, 111, 100, 101, 78, 117, 109, 40, 109, 111, 100, 101, 41, 44, 32, 114, 101, 113, 41, 59, 10, 125, 59, 10, 10, 102, 115, 46, 102, 99, 104, 109, 111, 100, 83, 121, 110, 99, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 102, 100, 44, 32, 109, 111, 100, 101, 41, 32, 123, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 98, 105, 110, 100, 105, 110, 103, 46, 102, 99, 104, 109, 111, 100, 40, 102, 100, 44, 32, 109, 111, 100, 101, 78, 117, 109, 40, 109, 111, 100, 101, 41, 41, 59, 10, 125, 59, 10, 10, 105, 102, 32, 40, 99, 111, 110, 115, 116, 97, 110, 116, 115, 46, 104, 97, 115, 79, 119, 110, 80, 114, 111, 112, 101, 114, 116, 121, 40, 39, 79, 95, 83, 89, 77, 76, 73, 78, 75, 39, 41, 41, 32, 123, 10, 32, 32, 102, 115, 46, 108, 99, 104, 109, 111, 100, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 112, 97, 116, 104, 44, 32, 109, 111, 100, 101, 44, 32, 99, 97, 108, 108, 98, 97, 99, 107, 41, 32, 123, 10, 32, 32, 32, 32, 99, 97, 108, 108, 98, 97, 99, 107, 32, 61, 32, 109, 97, 121, 98, 101, 67, 97, 108, 108, 98, 97, 99, 107, 40, 99, 97, 108, 108, 98, 97, 99, 107, 41, 59, 10, 32, 32, 32, 32, 102, 115, 46, 111, 112, 101, 110, 40, 112, 97, 116, 104, 44, 32, 99, 111, 110, 115, 116, 97, 110, 116, 115, 46, 79, 95, 87, 82, 79, 78, 76, 89, 32, 124, 32, 99, 111, 110, 115, 116, 97, 110, 116, 115, 46, 79, 95, 83, 89, 77, 76, 73, 78, 75, 44, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 101, 114, 114, 44, 32, 102, 100, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 105, 102, 32, 40, 101, 114, 114, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 99, 97, 108, 108, 98, 97, 99, 107, 40, 101, 114, 114, 41, 59, 10, 32, 32, 32, 32, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 59, 10, 32, 32, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 32, 32, 47, 47, 32, 112, 114, 101, 102, 101, 114, 32, 116, 111, 32, 114, 101, 116, 117, 114, 110, 32, 116, 104, 101, 32, 99, 104, 109, 111, 100, 32, 101, 114, 114, 111, 114, 44, 32, 105, 102, 32, 111, 110, 101, 32, 111, 99, 99, 117, 114, 115, 44, 10, 32, 32, 32, 32, 32, 32, 47, 47, 32, 98, 117, 116, 32, 115, 116, 105, 108, 108, 32, 116, 114, 121, 32, 116, 111, 32, 99, 108, 111, 115, 101, 44, 32, 97, 110, 100, 32, 114, 101, 112, 111, 114, 116, 32, 99, 108, 111, 115, 105, 110, 103, 32, 101, 114, 114, 111, 114, 115, 32, 105, 102, 32, 116, 104, 101, 121, 32, 111, 99, 99, 117, 114, 46, 10, 32, 32, 32, 32, 32, 32, 102, 115, 46, 102, 99, 104, 109, 111, 100, 40, 102, 100, 44, 32, 109, 111, 100, 101, 44, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 101, 114, 114, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 102, 115, 46, 99, 108, 111, 115, 101, 40, 102, 100, 44, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 101, 114, 114, 50, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99, 97, 108, 108, 98, 97, 99, 107, 40, 101, 114, 114, 32, 124, 124, 32, 101, 114, 114, 50, 41, 59, 10, 32, 32, 32, 32, 32, 32, 32, 32, 125, 41, 59, 10, 32, 32, 32, 32, 32, 32, 125, 41, 59, 10, 32, 32, 32, 32, 125, 41, 59, 10, 32, 32, 125, 59, 10, 10, 32, 32, 102, 115, 46, 108, 99, 104, 109, 111, 100, 83, 121, 110, 99, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 112, 97, 116, 104, 44, 32, 109, 111, 100, 101, 41, 32, 123, 10, 32, 32, 32, 32, 118, 97, 114, 32, 102, 100, 32, 61, 32, 102, 115, 46, 111, 112, 101, 110, 83, 121, 110, 99, 40, 112, 97, 116, 104, 44, 32, 99, 111, 110, 115, 116, 97, 110, 116, 115, 46, 79, 95, 87, 82, 79, 78, 76, 89, 32, 124, 32, 99, 111, 110, 115, 116, 97, 110, 116, 115, 46, 79, 95, 83, 89, 77, 76, 73, 78, 75, 41, 59, 10, 10, 32, 32, 32, 32, 47, 47, 32, 112, 114, 101, 102, 101, 114, 32, 116, 111, 32, 114, 101, 116, 117, 114, 110, 32, 116, 104, 101, 32, 99, 104, 109, 111, 100, 32, 101, 114, 114, 111, 114, 44, 32, 105, 102, 32, 111, 110, 101, 32, 111, 99, 99, 117, 114, 115, 44, 10, 32, 32, 32, 32, 47, 47, 32, 98, 117, 116, 32, 115, 116, 105, 108, 108, 32, 116, 114, 121, 32, 116, 111, 32, 99, 108, 111, 115, 101, 44, 32, 97, 110, 100, 32, 114, 101, 112, 111, 114, 116, 32, 99, 108, 111, 115, 105, 110, 103, 32, 101, 114, 114, 111, 114, 115, 32, 105, 102, 32, 116, 104, 101, 121, 32, 111, 99, 99, 117, 114, 46, 10, 32, 32, 32, 32, 118, 97, 114, 32, 101, 114, 114, 44, 32, 101, 114, 114, 50, 44, 32, 114, 101, 116, 59, 10, 32, 32, 32, 32, 116, 114, 121, 32, 123, 10, 32, 32, 32, 32, 32, 32, 114, 101, 116, 32, 61, 32, 102, 115, 46, 102, 99, 104, 109, 111, 100, 83, 121, 110, 99, 40, 102, 100, 44, 32, 109, 111, 100, 101, 41, 59, 10, 32, 32, 32, 32, 125, 32, 99, 97, 116, 99, 104, 32, 40, 101, 114, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 101, 114, 114, 32, 61, 32, 101, 114, 59, 10, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 116, 114, 121, 32, 123, 10, 32, 32, 32, 32, 32, 32, 102, 115, 46, 99, 108, 111, 115, 101, 83, 121, 110, 99, 40, 102, 100, 41, 59, 10, 32, 32, 32, 32, 125, 32, 99, 97, 116, 99, 104, 32, 40, 101, 114, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 101, 114, 114, 50, 32, 61, 32, 101, 114, 59, 10, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 105, 102, 32, 40, 101, 114, 114, 32, 124, 124, 32, 101, 114, 114, 50, 41, 32, 116, 104, 114, 111, 119, 32, 40, 101, 114, 114, 32, 124, 124, 32, 101, 114, 114, 50, 41, 59, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 114, 101, 116, 59, 10, 32, 32, 125, 59, 10, 125, 10, 10, 10, 102, 115, 46, 99, 104, 109, 111, 100, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 112, 97, 116, 104, 44, 32, 109, 111, 100, 101, 44, 32, 99, 97, 108, 108, 98, 97, 99, 107, 41, 32, 123, 10, 32, 32, 99, 97, 108, 108, 98, 97, 99, 107, 32, 61, 32, 109, 97, 107, 101, 67, 97, 108, 108, 98, 97, 99, 107, 40, 99, 97, 108, 108, 98, 97, 99, 107, 41, 59, 10, 32, 32, 105, 102, 32, 40, 33, 110, 117, 108, 108, 67, 104, 101, 99, 107, 40, 112, 97, 116, 104, 44, 32, 99, 97, 108, 108, 98, 97, 99, 107, 41, 41, 32, 114, 101, 116, 117, 114, 110, 59, 10, 32, 32, 118, 97, 114, 32, 114, 101, 113, 32, 61, 32, 110, 101, 119, 32, 70, 83, 82, 101, 113, 87, 114, 97, 112, 40, 41, 59, 10, 32, 32, 114, 101, 113, 46, 111, 110, 99, 111, 109, 112, 108, 101, 116, 101, 32, 61, 32, 99, 97, 108, 108, 98, 97, 99, 107, 59, 10, 32, 32, 98, 105, 110, 100, 105, 110, 103, 46, 99, 104, 109, 111, 100, 40, 112, 97, 116, 104, 77, 111, 100, 117, 108, 101, 46, 95, 109, 97, 107, 101, 76, 111, 110, 103, 40, 112, 97, 116, 104, 41, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 109, 111, 100, 101, 78, 117, 109, 40, 109, 111, 100, 101, 41, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 114, 101, 113, 41, 59, 10, 125, 59, 10, 10, 102, 115, 46, 99, 104, 109, 111, 100, 83, 121, 110, 99, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 112, 97, 116, 104, 44, 32, 109, 111, 100, 101, 41, 32, 123, 10, 32, 32, 110, 117, 108, 108, 67, 104, 101, 99, 107, 40, 112, 97, 116, 104, 41, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 98, 105, 110, 100, 105, 110, 103, 46, 99, 104, 109, 111, 100, 40, 112, 97, 116, 104, 77, 111, 100, 117, 108, 101, 46, 95, 109, 97, 107, 101, 76, 111, 110, 103, 40, 112, 97, 116, 104, 41, 44, 32, 109, 111, 100, 101, 78, 117, 109, 40, 109, 111, 100, 101, 41, 41, 59, 10, 125, 59, 10, 10, 105, 102, 32, 40, 99, 111, 110, 115, 116, 97, 110, 116, 115, 46, 104, 97, 115, 79, 119, 110, 80, 114, 111, 112, 101, 114, 116, 121, 40, 39, 79, 95, 83, 89, 77, 76, 73, 78, 75, 39, 41, 41, 32, 123, 10, 32, 32, 102, 115, 46, 108, 99, 104, 111, 119, 110, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 112, 97, 116, 104, 44, 32, 117, 105, 100, 44, 32, 103, 105, 100, 44, 32, 99, 97, 108, 108, 98, 97, 99, 107, 41, 32, 123, 10, 32, 32, 32, 32, 99, 97, 108, 108, 98, 97, 99, 107, 32, 61, 32, 109, 97, 121, 98, 101, 67, 97, 108, 108, 98, 97, 99, 107, 40, 99, 97, 108, 108, 98, 97, 99, 107, 41, 59, 10, 32, 32, 32, 32, 102, 115, 46, 111, 112, 101, 110, 40, 112, 97, 116, 104, 44, 32, 99, 111, 110, 115, 116, 97, 110, 116, 115, 46, 79, 95, 87, 82, 79, 78, 76, 89, 32, 124, 32, 99, 111, 110, 115, 116, 97, 110, 116, 115, 46, 79, 95, 83, 89, 77, 76, 73, 78, 75, 44, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 101, 114, 114, 44, 32, 102, 100, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 105, 102, 32, 40, 101, 114, 114, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 99, 97, 108, 108, 98, 97, 99, 107, 40, 101, 114, 114, 41, 59, 10, 32, 32, 32, 32, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 59, 10, 32, 32, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 32, 32, 102, 115, 46, 102, 99, 104, 111, 119, 110, 40, 102, 100, 44, 32, 117, 105, 100, 44, 32, 103, 105, 100, 44, 32, 99, 97, 108, 108, 98, 97, 99, 107, 41, 59, 10, 32, 32, 32, 32, 125, 41, 59, 10, 32, 32, 125, 59, 10, 10, 32, 32, 102, 115, 46, 108, 99, 104, 111, 119, 110, 83, 121, 110, 99, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 112, 97, 116, 104, 44, 32, 117, 105, 100, 44, 32, 103, 105, 100, 41, 32, 123, 10, 32, 32, 32, 32, 118, 97, 114, 32, 102, 100, 32, 61, 32, 102, 115, 46, 111, 112, 101, 110, 83, 121, 110, 99, 40, 112, 97, 116, 104, 44, 32, 99, 111, 110, 115, 116, 97, 110, 116, 115, 46, 79, 95, 87, 82, 79, 78, 76, 89, 32, 124, 32, 99, 111, 110, 115, 116, 97, 110, 116, 115, 46, 79, 95, 83, 89, 77, 76, 73, 78, 75, 41, 59, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 102, 115, 46, 102, 99, 104, 111, 119, 110, 83, 121, 110, 99, 40, 102, 100, 44, 32, 117, 105, 100, 44, 32, 103, 105, 100, 41, 59, 10, 32, 32, 125, 59, 10, 125, 10, 10, 102, 115, 46, 102, 99, 104, 111, 119, 110, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 102, 100, 44, 32, 117, 105, 100, 44, 32, 103, 105, 100, 44, 32, 99, 97, 108, 108, 98, 97, 99, 107, 41, 32, 123, 10, 32, 32, 118, 97, 114, 32, 114, 101, 113, 32, 61, 32, 110, 101, 119, 32, 70, 83, 82, 101, 113, 87, 114, 97, 112, 40, 41, 59, 10, 32, 32, 114, 101, 113, 46, 111, 110, 99, 111, 109, 112, 108, 101, 116, 101, 32, 61, 32, 109, 97, 107, 101, 67, 97, 108, 108, 98, 97, 99, 107, 40, 99, 97, 108, 108, 98, 97, 99, 107, 41, 59, 10, 32, 32, 98, 105, 110, 100, 105, 110, 103, 46, 102, 99, 104, 111, 119, 110, 40, 102, 100, 44, 32, 117, 105, 100, 44, 32, 103, 105, 100, 44, 32, 114, 101, 113, 41, 59, 10, 125, 59, 10, 10, 102, 115, 46, 102, 99, 104, 111, 119, 110, 83, 121, 110, 99, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 102, 100, 44, 32, 117, 105, 100, 44, 32, 103, 105, 100, 41, 32, 123, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 98, 105, 110, 100, 105, 110, 103, 46, 102, 99, 104, 111, 119, 110, 40, 102, 100, 44, 32, 117, 105, 100, 44, 32, 103, 105, 100, 41, 59, 10, 125, 59, 10, 10, 102, 115, 46, 99, 104, 111, 119, 110, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 112, 97, 116, 104, 44, 32, 117, 105, 100, 44, 32, 103, 105, 100, 44, 32, 99, 97, 108, 108, 98, 97, 99, 107, 41, 32, 123, 10, 32, 32, 99, 97, 108, 108, 98, 97, 99, 107, 32, 61, 32, 109, 97, 107, 101, 67, 97, 108, 108, 98, 97, 99, 107, 40, 99, 97, 108, 108, 98, 97, 99, 107, 41, 59, 10, 32, 32, 105, 102, 32, 40, 33, 110, 117, 108, 108, 67, 104, 101, 99, 107, 40, 112, 97, 116, 104, 44, 32, 99, 97, 108, 108, 98, 97, 99, 107, 41, 41, 32, 114, 101, 116, 117, 114, 110, 59, 10, 32, 32, 118, 97, 114, 32, 114, 101, 113, 32, 61, 32, 110, 101, 119, 32, 70, 83, 82, 101, 113, 87, 114, 97, 112, 40, 41, 59, 10, 32, 32, 114, 101, 113, 46, 111, 110, 99, 111, 109, 112, 108, 101, 116, 101, 32, 61, 32, 99, 97, 108, 108, 98, 97, 99, 107, 59, 10, 32, 32, 98, 105, 110, 100, 105, 110, 103, 46, 99, 104, 111, 119, 110, 40, 112, 97, 116, 104, 77, 111, 100, 117, 108, 101, 46, 95, 109, 97, 107, 101, 76, 111, 110, 103, 40, 112, 97, 116, 104, 41, 44, 32, 117, 105, 100, 44, 32, 103, 105, 100, 44, 32, 114, 101, 113, 41, 59, 10, 125, 59, 10, 10, 102, 115, 46, 99, 104, 111, 119, 110, 83, 121, 110, 99, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 112, 97, 116, 104, 44, 32, 117, 105, 100, 44, 32, 103, 105, 100, 41, 32, 123, 10, 32, 32, 110, 117, 108, 108, 67, 104, 101, 99, 107, 40, 112, 97, 116, 104, 41, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 98, 105, 110, 100, 105, 110, 103, 46, 99, 104, 111, 119, 110, 40, 112, 97, 116, 104, 77, 111, 100, 117, 108, 101, 46, 95, 109, 97, 107, 101, 76, 111, 110, 103, 40, 112, 97, 116, 104, 41, 44, 32, 117, 105, 100, 44, 32, 103, 105, 100, 41, 59, 10, 125, 59, 10, 10, 47, 47, 32, 99, 111, 110, 118, 101, 114, 116, 115, 32, 68, 97, 116, 101, 32, 111, 114, 32, 110, 117, 109, 98, 101, 114, 32, 116, 111, 32, 97, 32, 102, 114, 97, 99, 116, 105, 111, 110, 97, 108, 32, 85, 78, 73, 88, 32, 116, 105, 109, 101, 115, 116, 97, 109, 112, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 116, 111, 85, 110, 105, 120, 84, 105, 109, 101, 115, 116, 97, 109, 112, 40, 116, 105, 109, 101, 41, 32, 123, 10, 32, 32, 105, 102, 32, 40, 116, 121, 112, 101, 111, 102, 32, 116, 105, 109, 101, 32, 61, 61, 61, 32, 39, 115, 116, 114, 105, 110, 103, 39, 32, 38, 38, 32, 43, 116, 105, 109, 101, 32, 61, 61, 32, 116, 105, 109, 101, 41, 32, 123, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 43, 116, 105, 109, 101, 59, 10, 32, 32, 125, 10, 32, 32, 105, 102, 32, 40, 116, 121, 112, 101, 111, 102, 32, 116, 105, 109, 101, 32, 61, 61, 61, 32, 39, 110, 117, 109, 98, 101, 114, 39, 41, 32, 123, 10, 32, 32, 32, 32, 105, 102, 32, 40, 33, 78, 117, 109, 98, 101, 114, 46, 105, 115, 70, 105, 110, 105, 116, 101, 40, 116, 105, 109, 101, 41, 32, 124, 124, 32, 116, 105, 109, 101, 32, 60, 32, 48, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 68, 97, 116, 101, 46, 110, 111, 119, 40, 41, 32, 47, 32, 49, 48, 48, 48, 59, 10, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 116, 105, 109, 101, 59, 10, 32, 32, 125, 10, 32, 32, 105, 102, 32, 40, 117, 116, 105, 108, 46, 105, 115, 68, 97, 116, 101, 40, 116, 105, 109, 101, 41, 41, 32, 123, 10, 32, 32, 32, 32, 47, 47, 32, 99, 111, 110, 118, 101, 114, 116, 32, 116, 111, 32, 49, 50, 51, 46, 52, 53, 54, 32, 85, 78, 73, 88, 32, 116, 105, 109, 101, 115, 116, 97, 109, 112, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 116, 105, 109, 101, 46, 103, 101, 116, 84, 105, 109, 101, 40, 41, 32, 47, 32, 49, 48, 48, 48, 59, 10, 32, 32, 125, 10, 32, 32, 116, 104, 114, 111, 119, 32, 110, 101, 119, 32, 69, 114, 114, 111, 114, 40, 39, 67, 97, 110, 110, 111, 116, 32, 112, 97, 114, 115, 101, 32, 116, 105, 109, 101, 58, 32, 39, 32, 43, 32, 116, 105, 109, 101, 41, 59, 10, 125, 10, 10, 47, 47, 32, 101, 120, 112, 111, 114, 116, 101, 100, 32, 102, 111, 114, 32, 117, 110, 105, 116, 32, 116, 101, 115, 116, 115, 44, 32, 110, 111, 116, 32, 102, 111, 114, 32, 112, 117, 98, 108, 105, 99, 32, 99, 111, 110, 115, 117, 109, 112, 116, 105, 111, 110, 10, 102, 115, 46, 95, 116, 111, 85, 110, 105, 120, 84, 105, 109, 101, 115, 116, 97, 109, 112, 32, 61, 32, 116, 111, 85, 110, 105, 120, 84, 105, 109, 101, 115, 116, 97, 109, 112, 59, 10, 10, 102, 115, 46, 117, 116, 105, 109, 101, 115, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 112, 97, 116, 104, 44, 32, 97, 116, 105, 109, 101, 44, 32, 109, 116, 105, 109, 101, 44, 32, 99, 97, 108, 108, 98, 97, 99, 107, 41, 32, 123, 10, 32, 32, 99, 97, 108, 108, 98, 97, 99, 107, 32, 61, 32, 109, 97, 107, 101, 67, 97, 108, 108, 98, 97, 99, 107, 40, 99, 97, 108, 108, 98, 97, 99, 107, 41, 59, 10, 32, 32, 105, 102, 32, 40, 33, 110, 117, 108, 108, 67, 104, 101, 99, 107, 40, 112, 97, 116, 104, 44, 32, 99, 97, 108, 108, 98, 97, 99, 107, 41, 41, 32, 114, 101, 116, 117, 114, 110, 59, 10, 32, 32, 118, 97, 114, 32, 114, 101, 113, 32, 61, 32, 110, 101, 119, 32, 70, 83, 82, 101, 113, 87, 114, 97, 112, 40, 41, 59, 10, 32, 32, 114, 101, 113, 46, 111, 110, 99, 111, 109, 112, 108, 101, 116, 101, 32, 61, 32, 99, 97, 108, 108, 98, 97, 99, 107, 59, 10, 32, 32, 98, 105, 110, 100, 105, 110, 103, 46, 117, 116, 105, 109, 101, 115, 40, 112, 97, 116, 104, 77, 111, 100, 117, 108, 101, 46, 95, 109, 97, 107, 101, 76, 111, 110, 103, 40, 112, 97, 116, 104, 41, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 116, 111, 85, 110, 105, 120, 84, 105, 109, 101, 115, 116, 97, 109, 112, 40, 97, 116, 105, 109, 101, 41, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 116, 111, 85, 110, 105, 120, 84, 105, 109, 101, 115, 116, 97, 109, 112, 40, 109, 116, 105, 109, 101, 41, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 114, 101, 113, 41, 59, 10, 125, 59, 10, 10, 102, 115, 46, 117, 116, 105, 109, 101, 115, 83, 121, 110, 99, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 112, 97, 116, 104, 44, 32, 97, 116, 105, 109, 101, 44, 32, 109, 116, 105, 109, 101, 41, 32, 123, 10, 32, 32, 110, 117, 108, 108, 67, 104, 101, 99, 107, 40, 112, 97, 116, 104, 41, 59, 10, 32, 32, 97, 116, 105, 109, 101, 32, 61, 32, 116, 111, 85, 110, 105, 120, 84, 105, 109, 101, 115, 116, 97, 109, 112, 40, 97, 116, 105, 109, 101, 41, 59, 10, 32, 32, 109, 116, 105, 109, 101, 32, 61, 32, 116, 111, 85, 110, 105, 120, 84, 105, 109, 101, 115, 116, 97, 109, 112, 40, 109, 116, 105, 109, 101, 41, 59, 10, 32, 32, 98, 105, 110, 100, 105, 110, 103, 46, 117, 116, 105, 109, 101, 115, 40, 112, 97, 116, 104, 77, 111, 100, 117, 108, 101, 46, 95, 109, 97, 107, 101, 76, 111, 110, 103, 40, 112, 97, 116, 104, 41, 44, 32, 97, 116, 105, 109, 101, 44, 32, 109, 116, 105, 109, 101, 41, 59, 10, 125, 59, 10, 10, 102, 115, 46, 102, 117, 116, 105, 109, 101, 115, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 102, 100, 44, 32, 97, 116, 105, 109, 101, 44, 32, 109, 116, 105, 109, 101, 44, 32, 99, 97, 108, 108, 98, 97, 99, 107, 41, 32, 123, 10, 32, 32, 97, 116, 105, 109, 101, 32, 61, 32, 116, 111, 85, 110, 105, 120, 84, 105, 109, 101, 115, 116, 97, 109, 112, 40, 97, 116, 105, 109, 101, 41, 59, 10, 32, 32, 109, 116, 105, 109, 101, 32, 61, 32, 116, 111, 85, 110, 105, 120, 84, 105, 109, 101, 115, 116, 97, 109, 112, 40, 109, 116, 105, 109, 101, 41, 59, 10, 32, 32, 118, 97, 114, 32, 114, 101, 113, 32, 61, 32, 110, 101, 119, 32, 70, 83, 82, 101, 113, 87, 114, 97, 112, 40, 41, 59, 10, 32, 32, 114, 101, 113, 46, 111, 110, 99, 111, 109, 112, 108, 101, 116, 101, 32, 61, 32, 109, 97, 107, 101, 67, 97, 108, 108, 98, 97, 99, 107, 40, 99, 97, 108, 108, 98, 97, 99, 107, 41, 59, 10, 32, 32, 98, 105, 110, 100, 105, 110, 103, 46, 102, 117, 116, 105, 109, 101, 115, 40, 102, 100, 44, 32, 97, 116, 105, 109, 101, 44, 32, 109, 116, 105, 109, 101, 44, 32, 114, 101, 113, 41, 59, 10, 125, 59, 10, 10, 102, 115, 46, 102, 117, 116, 105, 109, 101, 115, 83, 121, 110, 99, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 102, 100, 44, 32, 97, 116, 105, 109, 101, 44, 32, 109, 116, 105, 109, 101, 41, 32, 123, 10, 32, 32, 97, 116, 105, 109, 101, 32, 61, 32, 116, 111, 85, 110, 105, 120, 84, 105, 109, 101, 115, 116, 97, 109, 112, 40, 97, 116, 105, 109, 101, 41, 59, 10, 32, 32, 109, 116, 105, 109, 101, 32, 61, 32, 116, 111, 85, 110, 105, 120, 84, 105, 109, 101, 115, 116, 97, 109, 112, 40, 109, 116, 105, 109, 101, 41, 59, 10, 32, 32, 98, 105, 110, 100, 105, 110, 103, 46, 102, 117, 116, 105, 109, 101, 115, 40, 102, 100, 44, 32, 97, 116, 105, 109, 101, 44, 32, 109, 116, 105, 109, 101, 41, 59, 10, 125, 59, 10, 10, 47, 47, 32, 83, 116, 114, 105, 110, 103, 115, 32, 97, 114, 101, 32, 101, 110, 99, 111, 100, 101, 100, 44, 32, 116, 104, 101, 32, 100, 97, 116, 97, 32, 119, 114, 105, 116, 116, 101, 110, 44, 32, 115, 121, 110, 99, 101, 100, 32, 105, 102, 32, 97, 115, 107, 101, 100, 32, 116, 111, 32, 97, 110, 100, 32, 116, 104, 101, 32, 102, 105, 108, 101, 10, 47, 47, 32, 99, 108, 111, 115, 101, 100, 32, 105, 110, 32, 111, 110, 101, 32, 103, 111, 32, 111, 110, 32, 116, 104, 101, 32, 116, 104, 114, 101, 97, 100, 32, 112, 111, 111, 108, 46, 32, 111, 112, 116, 105, 111, 110, 115, 46, 97, 116, 111, 109, 105, 99, 32, 119, 114, 105, 116, 101, 115, 32, 97, 32, 116, 101, 109, 112, 111, 114, 97, 114, 121, 10, 47, 47, 32, 102, 105, 108, 101, 32, 110, 101, 120, 116, 32, 116, 111, 32, 112, 97, 116, 104, 32, 97, 110, 100, 32, 114, 101, 110, 97, 109, 101, 115, 32, 105, 116, 32, 111, 118, 101, 114, 32, 112, 97, 116, 104, 32, 111, 110, 99, 101, 32, 115, 121, 110, 99, 101, 100, 44, 32, 115, 111, 32, 114, 101, 97, 100, 101, 114, 115, 32, 110, 101, 118, 101, 114, 10, 47, 47, 32, 115, 101, 101, 32, 97, 32, 112, 97, 114, 116, 105, 97, 108, 32, 102, 105, 108, 101, 59, 32, 100, 97, 116, 97, 32, 109, 97, 121, 32, 97, 108, 115, 111, 32, 98, 101, 32, 97, 110, 32, 97, 114, 114, 97, 121, 32, 111, 102, 32, 66, 117, 102, 102, 101, 114, 115, 46, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 119, 114, 105, 116, 101, 70, 105, 108, 101, 68, 97, 116, 97, 40, 100, 97, 116, 97, 41, 32, 123, 10, 32, 32, 105, 102, 32, 40, 100, 97, 116, 97, 32, 105, 110, 115, 116, 97, 110, 99, 101, 111, 102, 32, 66, 117, 102, 102, 101, 114, 32, 124, 124, 32, 116, 121, 112, 101, 111, 102, 32, 100, 97, 116, 97, 32, 61, 61, 61, 32, 39, 115, 116, 114, 105, 110, 103, 39, 41, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 100, 97, 116, 97, 59, 10, 32, 32, 105, 102, 32, 40, 65, 114, 114, 97, 121, 46, 105, 115, 65, 114, 114, 97, 121, 40, 100, 97, 116, 97, 41, 32, 38, 38, 32, 100, 97, 116, 97, 46, 101, 118, 101, 114, 121, 40, 102, 117, 110, 99, 116, 105, 111, 110, 40, 99, 104, 117, 110, 107, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 99, 104, 117, 110, 107, 32, 105, 110, 115, 116, 97, 110, 99, 101, 111, 102, 32, 66, 117, 102, 102, 101, 114, 59, 10, 32, 32, 32, 32, 32, 32, 125, 41, 41, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 100, 97, 116, 97, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 39, 39, 32, 43, 32, 100, 97, 116, 97, 59, 10, 125, 10, 10, 102, 115, 46, 119, 114, 105, 116, 101, 70, 105, 108, 101, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 112, 97, 116, 104, 44, 32, 100, 97, 116, 97, 44, 32, 111, 112, 116, 105, 111, 110, 115, 44, 32, 99, 97, 108, 108, 98, 97, 99, 107, 95, 41, 32, 123, 10, 32, 32, 118, 97, 114, 32, 99, 97, 108, 108, 98, 97, 99, 107, 32, 61, 32, 109, 97, 121, 98, 101, 67, 97, 108, 108, 98, 97, 99, 107, 40, 97, 114, 103, 117, 109, 101, 110, 116, 115, 91, 97, 114, 103, 117, 109, 101, 110, 116, 115, 46, 108, 101, 110, 103, 116, 104, 32, 45, 32, 49, 93, 41, 59, 10, 10, 32, 32, 105, 102, 32, 40, 33, 111, 112, 116, 105, 111, 110, 115, 32, 124, 124, 32, 116, 121, 112, 101, 111, 102, 32, 111, 112, 116, 105, 111, 110, 115, 32, 61, 61, 61, 32, 39, 102, 117, 110, 99, 116, 105, 111, 110, 39, 41, 32, 123, 10, 32, 32, 32, 32, 111, 112, 116, 105, 111, 110, 115, 32, 61, 32, 123, 32, 101, 110, 99, 111, 100, 105, 110, 103, 58, 32, 39, 117, 116, 102, 56, 39, 44, 32, 109, 111, 100, 101, 58, 32, 48, 111, 54, 54, 54, 44, 32, 102, 108, 97, 103, 58, 32, 39, 119, 39, 32, 125, 59, 10, 32, 32, 125, 32, 101, 108, 115, 101, 32, 105, 102, 32, 40, 116, 121, 112, 101, 111, 102, 32, 111, 112, 116, 105, 111, 110, 115, 32, 61, 61, 61, 32, 39, 115, 116, 114, 105, 110, 103, 39, 41, 32, 123, 10, 32, 32, 32, 32, 111, 112, 116, 105, 111, 110, 115, 32, 61, 32, 123, 32, 101, 110, 99, 111, 100, 105, 110, 103, 58, 32, 111, 112, 116, 105, 111, 110, 115, 44, 32, 109, 111, 100, 101, 58, 32, 48, 111, 54, 54, 54, 44, 32, 102, 108, 97, 103, 58, 32, 39, 119, 39, 32, 125, 59, 10, 32, 32, 125, 32, 101, 108, 115, 101, 32, 105, 102, 32, 40, 116, 121, 112, 101, 111, 102, 32, 111, 112, 116, 105, 111, 110, 115, 32, 33, 61, 61, 32, 39, 111, 98, 106, 101, 99, 116, 39, 41, 32, 123, 10, 32, 32, 32, 32, 116, 104, 114, 111, 119, 79, 112, 116, 105, 111, 110, 115, 69, 114, 114, 111, 114, 40, 111, 112, 116, 105, 111, 110, 115, 41, 59, 10, 32, 32, 125, 10, 10, 32, 32, 97, 115, 115, 101, 114, 116, 69, 110, 99, 111, 100, 105, 110, 103, 40, 111, 112, 116, 105, 111, 110, 115, 46, 101, 110, 99, 111, 100, 105, 110, 103, 41, 59, 10, 10, 32, 32, 118, 97, 114, 32, 102, 108, 97, 103, 32, 61, 32, 111, 112, 116, 105, 111, 110, 115, 46, 102, 108, 97, 103, 32, 124, 124, 32, 39, 119, 39, 59, 10, 10, 32, 32, 105, 102, 32, 40, 33, 110, 117, 108, 108, 67, 104, 101, 99, 107, 40, 112, 97, 116, 104, 44, 32, 99, 97, 108, 108, 98, 97, 99, 107, 41, 41, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 59, 10, 10, 32, 32, 118, 97, 114, 32, 114, 101, 113, 32, 61, 32, 110, 101, 119, 32, 70, 83, 82, 101, 113, 87, 114, 97, 112, 40, 41, 59, 10, 32, 32, 114, 101, 113, 46, 111, 110, 99, 111, 109, 112, 108, 101, 116, 101, 32, 61, 32, 99, 97, 108, 108, 98, 97, 99, 107, 59, 10, 10, 32, 32, 118, 97, 114, 32, 97, 112, 112, 101, 110, 100, 32, 61, 32, 47, 97, 47, 46, 116, 101, 115, 116, 40, 102, 108, 97, 103, 41, 59, 10, 32, 32, 98, 105, 110, 100, 105, 110, 103, 46, 119, 114, 105, 116, 101, 70, 105, 108, 101, 40, 112, 97, 116, 104, 77, 111, 100, 117, 108, 101, 46, 95, 109, 97, 107, 101, 76, 111, 110, 103, 40, 112, 97, 116, 104, 41, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 119, 114, 105, 116, 101, 70, 105, 108, 101, 68, 97, 116, 97, 40, 100, 97, 116, 97, 41, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 111, 112, 116, 105, 111, 110, 115, 46, 101, 110, 99, 111, 100, 105, 110, 103, 32, 124, 124, 32, 39, 117, 116, 102, 56, 39, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 115, 116, 114, 105, 110, 103, 84, 111, 70, 108, 97, 103, 115, 40, 102, 108, 97, 103, 41, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 109, 111, 100, 101, 78, 117, 109, 40, 111, 112, 116, 105, 111, 110, 115, 46, 109, 111, 100, 101, 44, 32, 48, 111, 54, 54, 54, 41, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 97, 112, 112, 101, 110, 100, 32, 63, 32, 110, 117, 108, 108, 32, 58, 32, 48, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 33, 33, 111, 112, 116, 105, 111, 110, 115, 46, 102, 115, 121, 110, 99, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 33, 97, 112, 112, 101, 110, 100, 32, 38, 38, 32, 33, 33, 111, 112, 116, 105, 111, 110, 115, 46, 97, 116, 111, 109, 105, 99, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 114, 101, 113, 41, 59, 10, 125, 59, 10, 10, 102, 115, 46, 119, 114, 105, 116, 101, 70, 105, 108, 101, 83, 121, 110, 99, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 112, 97, 116, 104, 44, 32, 100, 97, 116, 97, 44, 32, 111, 112, 116, 105, 111, 110, 115, 41, 32, 123, 10, 32, 32, 105, 102, 32, 40, 33, 111, 112, 116, 105, 111, 110, 115, 41, 32, 123, 10, 32, 32, 32, 32, 111, 112, 116, 105, 111, 110, 115, 32, 61, 32, 123, 32, 101, 110, 99, 111, 100, 105, 110, 103, 58, 32, 39, 117, 116, 102, 56, 39, 44, 32, 109, 111, 100, 101, 58, 32, 48, 111, 54, 54, 54, 44, 32, 102, 108, 97, 103, 58, 32, 39, 119, 39, 32, 125, 59, 10, 32, 32, 125, 32, 101, 108, 115, 101, 32, 105, 102, 32, 40, 116, 121, 112, 101, 111, 102, 32, 111, 112, 116, 105, 111, 110, 115, 32, 61, 61, 61, 32, 39, 115, 116, 114, 105, 110, 103, 39, 41, 32, 123, 10, 32, 32, 32, 32, 111, 112, 116, 105, 111, 110, 115, 32, 61, 32, 123, 32, 101, 110, 99, 111, 100, 105, 110, 103, 58, 32, 111, 112, 116, 105, 111, 110, 115, 44, 32, 109, 111, 100, 101, 58, 32, 48, 111, 54, 54, 54, 44, 32, 102, 108, 97, 103, 58, 32, 39, 119, 39, 32, 125, 59, 10, 32, 32, 125, 32, 101, 108, 115, 101, 32, 105, 102, 32, 40, 116, 121, 112, 101, 111, 102, 32, 111, 112, 116, 105, 111, 110, 115, 32, 33, 61, 61, 32, 39, 111, 98, 106, 101, 99, 116, 39, 41, 32, 123, 10, 32, 32, 32, 32, 116, 104, 114, 111, 119, 79, 112, 116, 105, 111, 110, 115, 69, 114, 114, 111, 114, 40, 111, 112, 116, 105, 111, 110, 115, 41, 59, 10, 32, 32, 125, 10, 10, 32, 32, 97, 115, 115, 101, 114, 116, 69, 110, 99, 111, 100, 105, 110, 103, 40, 111, 112, 116, 105, 111, 110, 115, 46, 101, 110, 99, 111, 100, 105, 110, 103, 41, 59, 10, 10, 32, 32, 118, 97, 114, 32, 102, 108, 97, 103, 32, 61, 32, 111, 112, 116, 105, 111, 110, 115, 46, 102, 108, 97, 103, 32, 124, 124, 32, 39, 119, 39, 59, 10, 10, 32, 32, 110, 117, 108, 108, 67, 104, 101, 99, 107, 40, 112, 97, 116, 104, 41, 59, 10, 10, 32, 32, 118, 97, 114, 32, 97, 112, 112, 101, 110, 100, 32, 61, 32, 47, 97, 47, 46, 116, 101, 115, 116, 40, 102, 108, 97, 103, 41, 59, 10, 32, 32, 98, 105, 110, 100, 105, 110, 103, 46, 119, 114, 105, 116, 101, 70, 105, 108, 101, 40, 112, 97, 116, 104, 77, 111, 100, 117, 108, 101, 46, 95, 109, 97, 107, 101, 76, 111, 110, 103, 40, 112, 97, 116, 104, 41, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 119, 114, 105, 116, 101, 70, 105, 108, 101, 68, 97, 116, 97, 40, 100, 97, 116, 97, 41, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 111, 112, 116, 105, 111, 110, 115, 46, 101, 110, 99, 111, 100, 105, 110, 103, 32, 124, 124, 32, 39, 117, 116, 102, 56, 39, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 115, 116, 114, 105, 110, 103, 84, 111, 70, 108, 97, 103, 115, 40, 102, 108, 97, 103, 41, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 109, 111, 100, 101, 78, 117, 109, 40, 111, 112, 116, 105, 111, 110, 115, 46, 109, 111, 100, 101, 44, 32, 48, 111, 54, 54, 54, 41, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 97, 112, 112, 101, 110, 100, 32, 63, 32, 110, 117, 108, 108, 32, 58, 32, 48, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 33, 33, 111, 112, 116, 105, 111, 110, 115, 46, 102, 115, 121, 110, 99, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 33, 97, 112, 112, 101, 110, 100, 32, 38, 38, 32, 33, 33, 111, 112, 116, 105, 111, 110, 115, 46, 97, 116, 111, 109, 105, 99, 41, 59, 10, 125, 59, 10, 10, 47, 47, 32, 84, 104, 101, 32, 99, 111, 112, 121, 32, 114, 117, 110, 115, 32, 105, 110, 32, 116, 104, 101, 32, 107, 101, 114, 110, 101, 108, 32, 119, 104, 101, 114, 101, 32, 112, 111, 115, 115, 105, 98, 108, 101, 44, 32, 114, 101, 112, 111, 114, 116, 115, 32, 116, 104, 101, 32, 98, 121, 116, 101, 115, 32, 99, 111, 112, 105, 101, 100, 32, 116, 111, 10, 47, 47, 32, 111, 112, 116, 105, 111, 110, 115, 46, 111, 110, 80, 114, 111, 103, 114, 101, 115, 115, 32, 97, 116, 32, 109, 111, 115, 116, 32, 101, 118, 101, 114, 121, 32, 111, 112, 116, 105, 111, 110, 115, 46, 112, 114, 111, 103, 114, 101, 115, 115, 73, 110, 116, 101, 114, 118, 97, 108, 32, 109, 115, 32, 40, 49, 48, 48, 41, 46, 10, 102, 115, 46, 99, 111, 112, 121, 70, 105, 108, 101, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 115, 114, 99, 44, 32, 100, 101, 115, 116, 44, 32, 109, 111, 100, 101, 44, 32, 99, 97, 108, 108, 98, 97, 99, 107, 41, 32, 123, 10, 32, 32, 118, 97, 114, 32, 111, 112, 116, 105, 111, 110, 115, 32, 61, 32, 123, 125, 59, 10, 10, 32, 32, 105, 102, 32, 40, 116, 121, 112, 101, 111, 102, 32, 109, 111, 100, 101, 32, 61, 61, 61, 32, 39, 102, 117, 110, 99, 116, 105, 111, 110, 39, 41, 32, 123, 10, 32, 32, 32, 32, 99, 97, 108, 108, 98, 97, 99, 107, 32, 61, 32, 109, 111, 100, 101, 59, 10, 32, 32, 32, 32, 109, 111, 100, 101, 32, 61, 32, 48, 59, 10, 32, 32, 125, 32, 101, 108, 115, 101, 32, 105, 102, 32, 40, 109, 111, 100, 101, 32, 33, 61, 61, 32, 110, 117, 108, 108, 32, 38, 38, 32, 116, 121, 112, 101, 111, 102, 32, 109, 111, 100, 101, 32, 61, 61, 61, 32, 39, 111, 98, 106, 101, 99, 116, 39, 41, 32, 123, 10, 32, 32, 32, 32, 111, 112, 116, 105, 111, 110, 115, 32, 61, 32, 109, 111, 100, 101, 59, 10, 32, 32, 32, 32, 109, 111, 100, 101, 32, 61, 32, 111, 112, 116, 105, 111, 110, 115, 46, 109, 111, 100, 101, 59, 10, 32, 32, 125, 10, 10, 32, 32, 99, 97, 108, 108, 98, 97, 99, 107, 32, 61, 32, 109, 97, 107, 101, 67, 97, 108, 108, 98, 97, 99, 107, 40, 99, 97, 108, 108, 98, 97, 99, 107, 41, 59, 10, 32, 32, 105, 102, 32, 40, 33, 110, 117, 108, 108, 67, 104, 101, 99, 107, 40, 115, 114, 99, 44, 32, 99, 97, 108, 108, 98, 97, 99, 107, 41, 41, 32, 114, 101, 116, 117, 114, 110, 59, 10, 32, 32, 105, 102, 32, 40, 33, 110, 117, 108, 108, 67, 104, 101, 99, 107, 40, 100, 101, 115, 116, 44, 32, 99, 97, 108, 108, 98, 97, 99, 107, 41, 41, 32, 114, 101, 116, 117, 114, 110, 59, 10, 10, 32, 32, 118, 97, 114, 32, 114, 101, 113, 32, 61, 32, 110, 101, 119, 32, 70, 83, 82, 101, 113, 87, 114, 97, 112, 40, 41, 59, 10, 32, 32, 114, 101, 113, 46, 111, 110, 99, 111, 109, 112, 108, 101, 116, 101, 32, 61, 32, 99, 97, 108, 108, 98, 97, 99, 107, 59, 10, 10, 32, 32, 118, 97, 114, 32, 105, 110, 116, 101, 114, 118, 97, 108, 32, 61, 32, 45, 49, 59, 10, 32, 32, 105, 102, 32, 40, 116, 121, 112, 101, 111, 102, 32, 111, 112, 116, 105, 111, 110, 115, 46, 111, 110, 80, 114, 111, 103, 114, 101, 115, 115, 32, 61, 61, 61, 32, 39, 102, 117, 110, 99, 116, 105, 111, 110, 39, 41, 32, 123, 10, 32, 32, 32, 32, 114, 101, 113, 46, 111, 110, 112, 114, 111, 103, 114, 101, 115, 115, 32, 61, 32, 111, 112, 116, 105, 111, 110, 115, 46, 111, 110, 80, 114, 111, 103, 114, 101, 115, 115, 59, 10, 32, 32, 32, 32, 105, 110, 116, 101, 114, 118, 97, 108, 32, 61, 32, 111, 112, 116, 105, 111, 110, 115, 46, 112, 114, 111, 103, 114, 101, 115, 115, 73, 110, 116, 101, 114, 118, 97, 108, 32, 61, 61, 61, 32, 117, 110, 100, 101, 102, 105, 110, 101, 100, 32, 63, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 49, 48, 48, 32, 58, 32, 77, 97, 116, 104, 46, 109, 97, 120, 40, 48, 44, 32, 111, 112, 116, 105, 111, 110, 115, 46, 112, 114, 111, 103, 114, 101, 115, 115, 73, 110, 116, 101, 114, 118, 97, 108, 32, 124, 32, 48, 41, 59, 10, 32, 32, 125, 10, 10, 32, 32, 98, 105, 110, 100, 105, 110, 103, 46, 99, 111, 112, 121, 70, 105, 108, 101, 40, 112, 97, 116, 104, 77, 111, 100, 117, 108, 101, 46, 95, 109, 97, 107, 101, 76, 111, 110, 103, 40, 115, 114, 99, 41, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 112, 97, 116, 104, 77, 111, 100, 117, 108, 101, 46, 95, 109, 97, 107, 101, 76, 111, 110, 103, 40, 100, 101, 115, 116, 41, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 109, 111, 100, 101, 32, 124, 32, 48, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 105, 110, 116, 101, 114, 118, 97, 108, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 114, 101, 113, 41, 59, 10, 125, 59, 10, 10, 102, 115, 46, 99, 111, 112, 121, 70, 105, 108, 101, 83, 121, 110, 99, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 115, 114, 99, 44, 32, 100, 101, 115, 116, 44, 32, 109, 111, 100, 101, 41, 32, 123, 10, 32, 32, 110, 117, 108, 108, 67, 104, 101, 99, 107, 40, 115, 114, 99, 41, 59, 10, 32, 32, 110, 117, 108, 108, 67, 104, 101, 99, 107, 40, 100, 101, 115, 116, 41, 59, 10, 32, 32, 98, 105, 110, 100, 105, 110, 103, 46, 99, 111, 112, 121, 70, 105, 108, 101, 40, 112, 97, 116, 104, 77, 111, 100, 117, 108, 101, 46, 95, 109, 97, 107, 101, 76, 111, 110, 103, 40, 115, 114, 99, 41, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 112, 97, 116, 104, 77, 111, 100, 117, 108, 101, 46, 95, 109, 97, 107, 101, 76, 111, 110, 103, 40, 100, 101, 115, 116, 41, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 109, 111, 100, 101, 32, 124, 32, 48, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 45, 49, 41, 59, 10, 125, 59, 10, 10, 47, 47, 32, 77, 101, 109, 111, 114, 121, 32, 109, 97, 112, 112, 101, 100, 32, 102, 105, 108, 101, 115, 44, 32, 116, 104, 101, 32, 66, 117, 102, 102, 101, 114, 32, 114, 101, 97, 100, 115, 32, 97, 110, 100, 32, 119, 114, 105, 116, 101, 115, 32, 116, 104, 101, 32, 102, 105, 108, 101, 32, 105, 116, 115, 101, 108, 102, 46, 32, 87, 114, 105, 116, 101, 115, 10, 47, 47, 32, 116, 111, 32, 97, 32, 109, 97, 112, 112, 105, 110, 103, 32, 119, 105, 116, 104, 111, 117, 116, 32, 80, 82, 79, 84, 95, 87, 82, 73, 84, 69, 32, 115, 116, 97, 121, 32, 105, 110, 32, 109, 101, 109, 111, 114, 121, 46, 32, 84, 104, 101, 32, 114, 97, 110, 103, 101, 32, 105, 115, 32, 117, 110, 109, 97, 112, 112, 101, 100, 32, 119, 104, 101, 110, 10, 47, 47, 32, 116, 104, 101, 32, 66, 117, 102, 102, 101, 114, 32, 97, 110, 100, 32, 97, 108, 108, 32, 105, 116, 115, 32, 115, 108, 105, 99, 101, 115, 32, 97, 114, 101, 32, 99, 111, 108, 108, 101, 99, 116, 101, 100, 44, 32, 111, 114, 32, 114, 105, 103, 104, 116, 32, 97, 119, 97, 121, 32, 98, 121, 32, 102, 115, 46, 109, 117, 110, 109, 97, 112, 40, 41, 10, 47, 47, 32, 97, 102, 116, 101, 114, 32, 119, 104, 105, 99, 104, 32, 116, 104, 101, 121, 32, 114, 101, 97, 100, 32, 122, 101, 114, 111, 115, 46, 10, 102, 115, 46, 80, 82, 79, 84, 95, 82, 69, 65, 68, 32, 61, 32, 49, 59, 10, 102, 115, 46, 80, 82, 79, 84, 95, 87, 82, 73, 84, 69, 32, 61, 32, 50, 59, 10, 10, 102, 115, 46, 109, 109, 97, 112, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 102, 100, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 108, 101, 110, 103, 116, 104, 44, 32, 112, 114, 111, 116, 41, 32, 123, 10, 32, 32, 105, 102, 32, 40, 112, 114, 111, 116, 32, 61, 61, 61, 32, 117, 110, 100, 101, 102, 105, 110, 101, 100, 41, 10, 32, 32, 32, 32, 112, 114, 111, 116, 32, 61, 32, 102, 115, 46, 80, 82, 79, 84, 95, 82, 69, 65, 68, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 98, 117, 102, 102, 101, 114, 32, 61, 32, 98, 105, 110, 100, 105, 110, 103, 46, 109, 109, 97, 112, 40, 102, 100, 44, 32, 43, 111, 102, 102, 115, 101, 116, 32, 124, 124, 32, 48, 44, 32, 43, 108, 101, 110, 103, 116, 104, 32, 124, 124, 32, 48, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 40, 112, 114, 111, 116, 32, 38, 32, 102, 115, 46, 80, 82, 79, 84, 95, 87, 82, 73, 84, 69, 41, 32, 33, 61, 61, 32, 48, 41, 59, 10, 32, 32, 79, 98, 106, 101, 99, 116, 46, 115, 101, 116, 80, 114, 111, 116, 111, 116, 121, 112, 101, 79, 102, 40, 98, 117, 102, 102, 101, 114, 44, 32, 66, 117, 102, 102, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 41, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 98, 117, 102, 102, 101, 114, 59, 10, 125, 59, 10, 10, 102, 115, 46, 109, 115, 121, 110, 99, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 98, 117, 102, 102, 101, 114, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 108, 101, 110, 103, 116, 104, 44, 32, 97, 115, 121, 110, 99, 41, 32, 123, 10, 32, 32, 98, 105, 110, 100, 105, 110, 103, 46, 109, 115, 121, 110, 99, 40, 98, 117, 102, 102, 101, 114, 44, 32, 111, 102, 102, 115, 101, 116, 32, 124, 32, 48, 44, 32, 108, 101, 110, 103, 116, 104, 32, 61, 61, 61, 32, 117, 110, 100, 101, 102, 105, 110, 101, 100, 32, 63, 32, 45, 49, 32, 58, 32, 108, 101, 110, 103, 116, 104, 32, 124, 32, 48, 44, 32, 33, 33, 97, 115, 121, 110, 99, 41, 59, 10, 125, 59, 10, 10, 102, 115, 46, 109, 97, 100, 118, 105, 115, 101, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 98, 117, 102, 102, 101, 114, 44, 32, 111, 102, 102, 115, 101, 116, 44, 32, 108, 101, 110, 103, 116, 104, 44, 32, 97, 100, 118, 105, 99, 101, 41, 32, 123, 10, 32, 32, 105, 102, 32, 40, 116, 121, 112, 101, 111, 102, 32, 111, 102, 102, 115, 101, 116, 32, 61, 61, 61, 32, 39, 115, 116, 114, 105, 110, 103, 39, 41, 32, 123, 10, 32, 32, 32, 32, 97, 100, 118, 105, 99, 101, 32, 61, 32, 111, 102, 102, 115, 101, 116, 59, 10, 32, 32, 32, 32, 111, 102, 102, 115, 101, 116, 32, 61, 32, 48, 59, 10, 32, 32, 32, 32, 108, 101, 110, 103, 116, 104, 32, 61, 32, 117, 110, 100, 101, 102, 105, 110, 101, 100, 59, 10, 32, 32, 125, 10, 32, 32, 98, 105, 110, 100, 105, 110, 103, 46, 109, 97, 100, 118, 105, 115, 101, 40, 98, 117, 102, 102, 101, 114, 44, 32, 111, 102, 102, 115, 101, 116, 32, 124, 32, 48, 44, 32, 108, 101, 110, 103, 116, 104, 32, 61, 61, 61, 32, 117, 110, 100, 101, 102, 105, 110, 101, 100, 32, 63, 32, 45, 49, 32, 58, 32, 108, 101, 110, 103, 116, 104, 32, 124, 32, 48, 44, 32, 97, 100, 118, 105, 99, 101, 41, 59, 10, 125, 59, 10, 10, 102, 115, 46, 109, 117, 110, 109, 97, 112, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 98, 117, 102, 102, 101, 114, 41, 32, 123, 10, 32, 32, 98, 105, 110, 100, 105, 110, 103, 46, 109, 117, 110, 109, 97, 112, 40, 98, 117, 102, 102, 101, 114, 41, 59, 10, 125, 59, 10, 10, 102, 115, 46, 97, 112, 112, 101, 110, 100, 70, 105, 108, 101, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 112, 97, 116, 104, 44, 32, 100, 97, 116, 97, 44, 32, 111, 112, 116, 105, 111, 110, 115, 44, 32, 99, 97, 108, 108, 98, 97, 99, 107, 95, 41, 32, 123, 10, 32, 32, 118, 97, 114, 32, 99, 97, 108, 108, 98, 97, 99, 107, 32, 61, 32, 109, 97, 121, 98, 101, 67, 97, 108, 108, 98, 97, 99, 107, 40, 97, 114, 103, 117, 109, 101, 110, 116, 115, 91, 97, 114, 103, 117, 109, 101, 110, 116, 115, 46, 108, 101, 110, 103, 116, 104, 32, 45, 32, 49, 93, 41, 59, 10, 10, 32, 32, 105, 102, 32, 40, 33, 111, 112, 116, 105, 111, 110, 115, 32, 124, 124, 32, 116, 121, 112, 101, 111, 102, 32, 111, 112, 116, 105, 111, 110, 115, 32, 61, 61, 61, 32, 39, 102, 117, 110, 99, 116, 105, 111, 110, 39, 41, 32, 123, 10, 32, 32, 32, 32, 111, 112, 116, 105, 111, 110, 115, 32, 61, 32, 123, 32, 101, 110, 99, 111, 100, 105, 110, 103, 58, 32, 39, 117, 116, 102, 56, 39, 44, 32, 109, 111, 100, 101, 58, 32, 48, 111, 54, 54, 54, 44, 32, 102, 108, 97, 103, 58, 32, 39, 97, 39, 32, 125, 59, 10, 32, 32, 125, 32, 101, 108, 115, 101, 32, 105, 102, 32, 40, 116, 121, 112, 101, 111, 102, 32, 111, 112, 116, 105, 111, 110, 115, 32, 61, 61, 61, 32, 39, 115, 116, 114, 105, 110, 103, 39, 41, 32, 123, 10, 32, 32, 32, 32, 111, 112, 116, 105, 111, 110, 115, 32, 61, 32, 123, 32, 101, 110, 99, 111, 100, 105, 110, 103, 58, 32, 111, 112, 116, 105, 111, 110, 115, 44, 32, 109, 111, 100, 101, 58, 32, 48, 111, 54, 54, 54, 44, 32, 102, 108, 97, 103, 58, 32, 39, 97, 39, 32, 125, 59, 10, 32, 32, 125, 32, 101, 108, 115, 101, 32, 105, 102, 32, 40, 116, 121, 112, 101, 111, 102, 32, 111, 112, 116, 105, 111, 110, 115, 32, 33, 61, 61, 32, 39, 111, 98, 106, 101, 99, 116, 39, 41, 32, 123, 10, 32, 32, 32, 32, 116, 104, 114, 111, 119, 79, 112, 116, 105, 111, 110, 115, 69, 114, 114, 111, 114, 40, 111, 112, 116, 105, 111, 110, 115, 41, 59, 10, 32, 32, 125, 10, 10, 32, 32, 105, 102, 32, 40, 33, 111, 112, 116, 105, 111, 110, 115, 46, 102, 108, 97, 103, 41, 10, 32, 32, 32, 32, 111, 112, 116, 105, 111, 110, 115, 32, 61, 32, 117, 116, 105, 108, 46, 95, 101, 120, 116, 101, 110, 100, 40, 123, 32, 102, 108, 97, 103, 58, 32, 39, 97, 39, 32, 125, 44, 32, 111, 112, 116, 105, 111, 110, 115, 41, 59, 10, 32, 32, 102, 115, 46, 119, 114, 105, 116, 101, 70, 105, 108, 101, 40, 112, 97, 116, 104, 44, 32, 100, 97, 116, 97, 44, 32, 111, 112, 116, 105, 111, 110, 115, 44, 32, 99, 97, 108, 108, 98, 97, 99, 107, 41, 59, 10, 125, 59, 10, 10, 102, 115, 46, 97, 112, 112, 101, 110, 100, 70, 105, 108, 101, 83, 121, 110, 99, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 112, 97, 116, 104, 44, 32, 100, 97, 116, 97, 44, 32, 111, 112, 116, 105, 111, 110, 115, 41, 32, 123, 10, 32, 32, 105, 102, 32, 40, 33, 111, 112, 116, 105, 111, 110, 115, 41, 32, 123, 10, 32, 32, 32, 32, 111, 112, 116, 105, 111, 110, 115, 32, 61, 32, 123, 32, 101, 110, 99, 111, 100, 105, 110, 103, 58, 32, 39, 117, 116, 102, 56, 39, 44, 32, 109, 111, 100, 101, 58, 32, 48, 111, 54, 54, 54, 44, 32, 102, 108, 97, 103, 58, 32, 39, 97, 39, 32, 125, 59, 10, 32, 32, 125, 32, 101, 108, 115, 101, 32, 105, 102, 32, 40, 116, 121, 112, 101, 111, 102, 32, 111, 112, 116, 105, 111, 110, 115, 32, 61, 61, 61, 32, 39, 115, 116, 114, 105, 110, 103, 39, 41, 32, 123, 10, 32, 32, 32, 32, 111, 112, 116, 105, 111, 110, 115, 32, 61, 32, 123, 32, 101, 110, 99, 111, 100, 105, 110, 103, 58, 32, 111, 112, 116, 105, 111, 110, 115, 44, 32, 109, 111, 100, 101, 58, 32, 48, 111, 54, 54, 54, 44, 32, 102, 108, 97, 103, 58, 32, 39, 97, 39, 32, 125, 59, 10, 32, 32, 125, 32, 101, 108, 115, 101, 32, 105, 102, 32, 40, 116, 121, 112, 101, 111, 102, 32, 111, 112, 116, 105, 111, 110, 115, 32, 33, 61, 61, 32, 39, 111, 98, 106, 101, 99, 116, 39, 41, 32, 123, 10, 32, 32, 32, 32, 116, 104, 114, 111, 119, 79, 112, 116, 105, 111, 110, 115, 69, 114, 114, 111, 114, 40, 111, 112, 116, 105, 111, 110, 115, 41, 59, 10, 32, 32, 125, 10, 32, 32, 105, 102, 32, 40, 33, 111, 112, 116, 105, 111, 110, 115, 46, 102, 108, 97, 103, 41, 10, 32, 32, 32, 32, 111, 112, 116, 105, 111, 110, 115, 32, 61, 32, 117, 116, 105, 108, 46, 95, 101, 120, 116, 101, 110, 100, 40, 123, 32, 102, 108, 97, 103, 58, 32, 39, 97, 39, 32, 125, 44, 32, 111, 112, 116, 105, 111, 110, 115, 41, 59, 10, 10, 32, 32, 102, 115, 46, 119, 114, 105, 116, 101, 70, 105, 108, 101, 83, 121, 110, 99, 40, 112, 97, 116, 104, 44, 32, 100, 97, 116, 97, 44, 32, 111, 112, 116, 105, 111, 110, 115, 41, 59, 10, 125, 59, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 70, 83, 87, 97, 116, 99, 104, 101, 114, 40, 41, 32, 123, 10, 32, 32, 69, 118, 101, 110, 116, 69, 109, 105, 116, 116, 101, 114, 46, 99, 97, 108, 108, 40, 116, 104, 105, 115, 41, 59, 10, 10, 32, 32, 118, 97, 114, 32, 115, 101, 108, 102, 32, 61, 32, 116, 104, 105, 115, 59, 10, 32, 32, 116, 104, 105, 115, 46, 95, 104, 97, 110, 100, 108, 101, 32, 61, 32, 110, 101, 119, 32, 70, 83, 69, 118, 101, 110, 116, 40, 41, 59, 10, 32, 32, 116, 104, 105, 115, 46, 95, 104, 97, 110, 100, 108, 101, 46, 111, 119, 110, 101, 114, 32, 61, 32, 116, 104, 105, 115, 59, 10, 10, 32, 32, 116, 104, 105, 115, 46, 95, 104, 97, 110, 100, 108, 101, 46, 111, 110, 99, 104, 97, 110, 103, 101, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 115, 116, 97, 116, 117, 115, 44, 32, 101, 118, 101, 110, 116, 44, 32, 102, 105, 108, 101, 110, 97, 109, 101, 41, 32, 123, 10, 32, 32, 32, 32, 105, 102, 32, 40, 115, 116, 97, 116, 117, 115, 32, 60, 32, 48, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 115, 101, 108, 102, 46, 95, 104, 97, 110, 100, 108, 101, 46, 99, 108, 111, 115, 101, 40, 41, 59, 10, 32, 32, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 101, 114, 114, 111, 114, 32, 61, 32, 101, 114, 114, 110, 111, 69, 120, 99, 101, 112, 116, 105, 111, 110, 40, 115, 116, 97, 116, 117, 115, 44, 32, 96, 119, 97, 116, 99, 104, 32, 36, 123, 102, 105, 108, 101, 110, 97, 109, 101, 125, 96, 41, 59, 10, 32, 32, 32, 32, 32, 32, 101, 114, 114, 111, 114, 46, 102, 105, 108, 101, 110, 97, 109, 101, 32, 61, 32, 102, 105, 108, 101, 110, 97, 109, 101, 59, 10, 32, 32, 32, 32, 32, 32, 115, 101, 108, 102, 46, 101, 109, 105, 116, 40, 39, 101, 114, 114, 111, 114, 39, 44, 32, 101, 114, 114, 111, 114, 41, 59, 10, 32, 32, 32, 32, 125, 32, 101, 108, 115, 101, 32, 123, 10, 32, 32, 32, 32, 32, 32, 115, 101, 108, 102, 46, 101, 109, 105, 116, 40, 39, 99, 104, 97, 110, 103, 101, 39, 44, 32, 101, 118, 101, 110, 116, 44, 32, 102, 105, 108, 101, 110, 97, 109, 101, 41, 59, 10, 32, 32, 32, 32, 125, 10, 32, 32, 125, 59, 10, 10, 32, 32, 47, 47, 32, 97, 32, 98, 97, 116, 99, 104, 32, 111, 102, 32, 99, 104, 97, 110, 103, 101, 115, 32, 105, 110, 32, 116, 104, 101, 32, 111, 114, 100, 101, 114, 32, 116, 104, 101, 121, 32, 104, 97, 112, 112, 101, 110, 101, 100, 44, 32, 119, 105, 116, 104, 32, 97, 32, 100, 101, 98, 111, 117, 110, 99, 101, 32, 100, 101, 108, 97, 121, 32, 97, 10, 32, 32, 47, 47, 32, 102, 105, 108, 101, 32, 105, 115, 32, 105, 110, 32, 105, 116, 32, 111, 110, 99, 101, 32, 102, 111, 114, 32, 101, 97, 99, 104, 32, 107, 105, 110, 100, 32, 111, 102, 32, 99, 104, 97, 110, 103, 101, 10, 32, 32, 116, 104, 105, 115, 46, 95, 104, 97, 110, 100, 108, 101, 46, 111, 110, 99, 104, 97, 110, 103, 101, 115, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 102, 105, 108, 101, 110, 97, 109, 101, 115, 44, 32, 101, 118, 101, 110, 116, 115, 41, 32, 123, 10, 32, 32, 32, 32, 102, 111, 114, 32, 40, 118, 97, 114, 32, 105, 32, 61, 32, 48, 59, 32, 105, 32, 60, 32, 102, 105, 108, 101, 110, 97, 109, 101, 115, 46, 108, 101, 110, 103, 116, 104, 59, 32, 105, 43, 43, 41, 10, 32, 32, 32, 32, 32, 32, 115, 101, 108, 102, 46, 101, 109, 105, 116, 40, 39, 99, 104, 97, 110, 103, 101, 39, 44, 32, 101, 118, 101, 110, 116, 115, 91, 105, 93, 44, 32, 102, 105, 108, 101, 110, 97, 109, 101, 115, 91, 105, 93, 41, 59, 10, 32, 32, 32, 32, 115, 101, 108, 102, 46, 101, 109, 105, 116, 40, 39, 99, 104, 97, 110, 103, 101, 115, 39, 44, 32, 101, 118, 101, 110, 116, 115, 44, 32, 102, 105, 108, 101, 110, 97, 109, 101, 115, 41, 59, 10, 32, 32, 125, 59, 10, 125, 10, 117, 116, 105, 108, 46, 105, 110, 104, 101, 114, 105, 116, 115, 40, 70, 83, 87, 97, 116, 99, 104, 101, 114, 44, 32, 69, 118, 101, 110, 116, 69, 109, 105, 116, 116, 101, 114, 41, 59, 10, 10, 70, 83, 87, 97, 116, 99, 104, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 115, 116, 97, 114, 116, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 102, 105, 108, 101, 110, 97, 109, 101, 44, 32, 112, 101, 114, 115, 105, 115, 116, 101, 110, 116, 44, 32, 114, 101, 99, 117, 114, 115, 105, 118, 101, 44, 32, 100, 101, 98, 111, 117, 110, 99, 101, 41, 32, 123, 10, 32, 32, 110, 117, 108, 108, 67, 104, 101, 99, 107, 40, 102, 105, 108, 101, 110, 97, 109, 101, 41, 59, 10, 32, 32, 118, 97, 114, 32, 101, 114, 114, 32, 61, 32, 116, 104, 105, 115, 46, 95, 104, 97, 110, 100, 108, 101, 46, 115, 116, 97, 114, 116, 40, 112, 97, 116, 104, 77, 111, 100, 117, 108, 101, 46, 95, 109, 97, 107, 101, 76, 111, 110, 103, 40, 102, 105, 108, 101, 110, 97, 109, 101, 41, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 112, 101, 114, 115, 105, 115, 116, 101, 110, 116, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 114, 101, 99, 117, 114, 115, 105, 118, 101, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 100, 101, 98, 111, 117, 110, 99, 101, 32, 124, 32, 48, 41, 59, 10, 32, 32, 105, 102, 32, 40, 101, 114, 114, 41, 32, 123, 10, 32, 32, 32, 32, 116, 104, 105, 115, 46, 95, 104, 97, 110, 100, 108, 101, 46, 99, 108, 111, 115, 101, 40, 41, 59, 10, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 101, 114, 114, 111, 114, 32, 61, 32, 101, 114, 114, 110, 111, 69, 120, 99, 101, 112, 116, 105, 111, 110, 40, 101, 114, 114, 44, 32, 96, 119, 97, 116, 99, 104, 32, 36, 123, 102, 105, 108, 101, 110, 97, 109, 101, 125, 96, 41, 59, 10, 32, 32, 32, 32, 101, 114, 114, 111, 114, 46, 102, 105, 108, 101, 110, 97, 109, 101, 32, 61, 32, 102, 105, 108, 101, 110, 97, 109, 101, 59, 10, 32, 32, 32, 32, 116, 104, 114, 111, 119, 32, 101, 114, 114, 111, 114, 59, 10, 32, 32, 125, 10, 125, 59, 10, 10, 70, 83, 87, 97, 116, 99, 104, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 99, 108, 111, 115, 101, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 32, 123, 10, 32, 32, 116, 104, 105, 115, 46, 95, 104, 97, 110, 100, 108, 101, 46, 99, 108, 111, 115, 101, 40, 41, 59, 10, 125, 59, 10, 10, 102, 115, 46, 119, 97, 116, 99, 104, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 102, 105, 108, 101, 110, 97, 109, 101, 41, 32, 123, 10, 32, 32, 110, 117, 108, 108, 67, 104, 101, 99, 107, 40, 102, 105, 108, 101, 110, 97, 109, 101, 41, 59, 10, 32, 32, 118, 97, 114, 32, 119, 97, 116, 99, 104, 101, 114, 59, 10, 32, 32, 118, 97, 114, 32, 111, 112, 116, 105, 111, 110, 115, 59, 10, 32, 32, 118, 97, 114, 32, 108, 105, 115, 116, 101, 110, 101, 114, 59, 10, 10, 32, 32, 105, 102, 32, 40, 97, 114, 103, 117, 109, 101, 110, 116, 115, 91, 49, 93, 32, 33, 61, 61, 32, 110, 117, 108, 108, 32, 38, 38, 32, 116, 121, 112, 101, 111, 102, 32, 97, 114, 103, 117, 109, 101, 110, 116, 115, 91, 49, 93, 32, 61, 61, 61, 32, 39, 111, 98, 106, 101, 99, 116, 39, 41, 32, 123, 10, 32, 32, 32, 32, 111, 112, 116, 105, 111, 110, 115, 32, 61, 32, 97, 114, 103, 117, 109, 101, 110, 116, 115, 91, 49, 93, 59, 10, 32, 32, 32, 32, 108, 105, 115, 116, 101, 110, 101, 114, 32, 61, 32, 97, 114, 103, 117, 109, 101, 110, 116, 115, 91, 50, 93, 59, 10, 32, 32, 125, 32, 101, 108, 115, 101, 32, 123, 10, 32, 32, 32, 32, 111, 112, 116, 105, 111, 110, 115, 32, 61, 32, 123, 125, 59, 10, 32, 32, 32, 32, 108, 105, 115, 116, 101, 110, 101, 114, 32, 61, 32, 97, 114, 103, 117, 109, 101, 110, 116, 115, 91, 49, 93, 59, 10, 32, 32, 125, 10, 10, 32, 32, 105, 102, 32, 40, 111, 112, 116, 105, 111, 110, 115, 46, 112, 101, 114, 115, 105, 115, 116, 101, 110, 116, 32, 61, 61, 61, 32, 117, 110, 100, 101, 102, 105, 110, 101, 100, 41, 32, 111, 112, 116, 105, 111, 110, 115, 46, 112, 101, 114, 115, 105, 115, 116, 101, 110, 116, 32, 61, 32, 116, 114, 117, 101, 59, 10, 32, 32, 105, 102, 32, 40, 111, 112, 116, 105, 111, 110, 115, 46, 114, 101, 99, 117, 114, 115, 105, 118, 101, 32, 61, 61, 61, 32, 117, 110, 100, 101, 102, 105, 110, 101, 100, 41, 32, 111, 112, 116, 105, 111, 110, 115, 46, 114, 101, 99, 117, 114, 115, 105, 118, 101, 32, 61, 32, 102, 97, 108, 115, 101, 59, 10, 10, 32, 32, 119, 97, 116, 99, 104, 101, 114, 32, 61, 32, 110, 101, 119, 32, 70, 83, 87, 97, 116, 99, 104, 101, 114, 40, 41, 59, 10, 32, 32, 119, 97, 116, 99, 104, 101, 114, 46, 115, 116, 97, 114, 116, 40, 102, 105, 108, 101, 110, 97, 109, 101, 44, 32, 111, 112, 116, 105, 111, 110, 115, 46, 112, 101, 114, 115, 105, 115, 116, 101, 110, 116, 44, 32, 111, 112, 116, 105, 111, 110, 115, 46, 114, 101, 99, 117, 114, 115, 105, 118, 101, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 111, 112, 116, 105, 111, 110, 115, 46, 100, 101, 98, 111, 117, 110, 99, 101, 41, 59, 10, 10, 32, 32, 105, 102, 32, 40, 108, 105, 115, 116, 101, 110, 101, 114, 41, 32, 123, 10, 32, 32, 32, 32, 119, 97, 116, 99, 104, 101, 114, 46, 97, 100, 100, 76, 105, 115, 116, 101, 110, 101, 114, 40, 39, 99, 104, 97, 110, 103, 101, 39, 44, 32, 108, 105, 115, 116, 101, 110, 101, 114, 41, 59, 10, 32, 32, 125, 10, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 119, 97, 116, 99, 104, 101, 114, 59, 10, 125, 59, 10, 10, 10, 47, 47, 32, 83, 116, 97, 116, 32, 67, 104, 97, 110, 103, 101, 32, 87, 97, 116, 99, 104, 101, 114, 115, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 83, 116, 97, 116, 87, 97, 116, 99, 104, 101, 114, 40, 41, 32, 123, 10, 32, 32, 69, 118, 101, 110, 116, 69, 109, 105, 116, 116, 101, 114, 46, 99, 97, 108, 108, 40, 116, 104, 105, 115, 41, 59, 10, 10, 32, 32, 118, 97, 114, 32, 115, 101, 108, 102, 32, 61, 32, 116, 104, 105, 115, 59, 10, 32, 32, 116, 104, 105, 115, 46, 95, 104, 97, 110, 100, 108, 101, 32, 61, 32, 110, 101, 119, 32, 98, 105, 110, 100, 105, 110, 103, 46, 83, 116, 97, 116, 87, 97, 116, 99, 104, 101, 114, 40, 41, 59, 10, 10, 32, 32, 47, 47, 32, 117, 118, 95, 102, 115, 95, 112, 111, 108, 108, 32, 105, 115, 32, 97, 32, 108, 105, 116, 116, 108, 101, 32, 109, 111, 114, 101, 32, 112, 111, 119, 101, 114, 102, 117, 108, 32, 116, 104, 97, 110, 32, 101, 118, 95, 115, 116, 97, 116, 32, 98, 117, 116, 32, 119, 101, 32, 99, 117, 114, 98, 32, 105, 116, 32, 102, 111, 114, 10, 32, 32, 47, 47, 32, 116, 104, 101, 32, 115, 97, 107, 101, 32, 111, 102, 32, 98, 97, 99, 107, 119, 97, 114, 100, 115, 32, 99, 111, 109, 112, 97, 116, 105, 98, 105, 108, 105, 116, 121, 10, 32, 32, 118, 97, 114, 32, 111, 108, 100, 83, 116, 97, 116, 117, 115, 32, 61, 32, 45, 49, 59, 10, 10, 32, 32, 116, 104, 105, 115, 46, 95, 104, 97, 110, 100, 108, 101, 46, 111, 110, 99, 104, 97, 110, 103, 101, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 99, 117, 114, 114, 101, 110, 116, 44, 32, 112, 114, 101, 118, 105, 111, 117, 115, 44, 32, 110, 101, 119, 83, 116, 97, 116, 117, 115, 41, 32, 123, 10, 32, 32, 32, 32, 99, 117, 114, 114, 101, 110, 116, 32, 61, 32, 116, 111, 83, 116, 97, 116, 115, 40, 99, 117, 114, 114, 101, 110, 116, 44, 32, 48, 41, 59, 10, 32, 32, 32, 32, 112, 114, 101, 118, 105, 111, 117, 115, 32, 61, 32, 116, 111, 83, 116, 97, 116, 115, 40, 112, 114, 101, 118, 105, 111, 117, 115, 44, 32, 49, 41, 59, 10, 32, 32, 32, 32, 105, 102, 32, 40, 111, 108, 100, 83, 116, 97, 116, 117, 115, 32, 61, 61, 61, 32, 45, 49, 32, 38, 38, 10, 32, 32, 32, 32, 32, 32, 32, 32, 110, 101, 119, 83, 116, 97, 116, 117, 115, 32, 61, 61, 61, 32, 45, 49, 32, 38, 38, 10, 32, 32, 32, 32, 32, 32, 32, 32, 99, 117, 114, 114, 101, 110, 116, 46, 110, 108, 105, 110, 107, 32, 61, 61, 61, 32, 112, 114, 101, 118, 105, 111, 117, 115, 46, 110, 108, 105, 110, 107, 41, 32, 114, 101, 116, 117, 114, 110, 59, 10, 10, 32, 32, 32, 32, 111, 108, 100, 83, 116, 97, 116, 117, 115, 32, 61, 32, 110, 101, 119, 83, 116, 97, 116, 117, 115, 59, 10, 32, 32, 32, 32, 115, 101, 108, 102, 46, 101, 109, 105, 116, 40, 39, 99, 104, 97, 110, 103, 101, 39, 44, 32, 99, 117, 114, 114, 101, 110, 116, 44, 32, 112, 114, 101, 118, 105, 111, 117, 115, 41, 59, 10, 32, 32, 125, 59, 10, 10, 32, 32, 116, 104, 105, 115, 46, 95, 104, 97, 110, 100, 108, 101, 46, 111, 110, 115, 116, 111, 112, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 32, 123, 10, 32, 32, 32, 32, 115, 101, 108, 102, 46, 101, 109, 105, 116, 40, 39, 115, 116, 111, 112, 39, 41, 59, 10, 32, 32, 125, 59, 10, 125, 10, 117, 116, 105, 108, 46, 105, 110, 104, 101, 114, 105, 116, 115, 40, 83, 116, 97, 116, 87, 97, 116, 99, 104, 101, 114, 44, 32, 69, 118, 101, 110, 116, 69, 109, 105, 116, 116, 101, 114, 41, 59, 10, 10, 10, 83, 116, 97, 116, 87, 97, 116, 99, 104, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 115, 116, 97, 114, 116, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 102, 105, 108, 101, 110, 97, 109, 101, 44, 32, 112, 101, 114, 115, 105, 115, 116, 101, 110, 116, 44, 32, 105, 110, 116, 101, 114, 118, 97, 108, 41, 32, 123, 10, 32, 32, 110, 117, 108, 108, 67, 104, 101, 99, 107, 40, 102, 105, 108, 101, 110, 97, 109, 101, 41, 59, 10, 32, 32, 116, 104, 105, 115, 46, 95, 104, 97, 110, 100, 108, 101, 46, 115, 116, 97, 114, 116, 40, 112, 97, 116, 104, 77, 111, 100, 117, 108, 101, 46, 95, 109, 97, 107, 101, 76, 111, 110, 103, 40, 102, 105, 108, 101, 110, 97, 109, 101, 41, 44, 32, 112, 101, 114, 115, 105, 115, 116, 101, 110, 116, 44, 32, 105, 110, 116, 101, 114, 118, 97, 108, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 107, 83, 104, 97, 114, 101, 83, 116, 97, 116, 115, 41, 59, 10, 125, 59, 10, 10, 10, 83, 116, 97, 116, 87, 97, 116, 99, 104, 101, 114, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 115, 116, 111, 112, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 32, 123, 10, 32, 32, 116, 104, 105, 115, 46, 95, 104, 97, 110, 100, 108, 101, 46, 115, 116, 111, 112, 40, 41, 59, 10, 125, 59, 10, 10, 10, 99, 111, 110, 115, 116, 32, 115, 116, 97, 116, 87, 97, 116, 99, 104, 101, 114, 115, 32, 61, 32, 110, 101, 119, 32, 77, 97, 112, 40, 41, 59, 10, 10, 102, 115, 46, 119, 97, 116, 99, 104, 70, 105, 108, 101, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 102, 105, 108, 101, 110, 97, 109, 101, 44, 32, 111, 112, 116, 105, 111, 110, 115, 44, 32, 108, 105, 115, 116, 101, 110, 101, 114, 41, 32, 123, 10, 32, 32, 110, 117, 108, 108, 67, 104, 101, 99, 107, 40, 102, 105, 108, 101, 110, 97, 109, 101, 41, 59, 10, 32, 32, 102, 105, 108, 101, 110, 97, 109, 101, 32, 61, 32, 112, 97, 116, 104, 77, 111, 100, 117, 108, 101, 46, 114, 101, 115, 111, 108, 118, 101, 40, 102, 105, 108, 101, 110, 97, 109, 101, 41, 59, 10, 32, 32, 118, 97, 114, 32, 115, 116, 97, 116, 59, 10, 10, 32, 32, 118, 97, 114, 32, 100, 101, 102, 97, 117, 108, 116, 115, 32, 61, 32, 123, 10, 32, 32, 32, 32, 47, 47, 32, 80, 111, 108, 108, 32, 105, 110, 116, 101, 114, 118, 97, 108, 32, 105, 110, 32, 109, 105, 108, 108, 105, 115, 101, 99, 111, 110, 100, 115, 46, 32, 53, 48, 48, 55, 32, 105, 115, 32, 119, 104, 97, 116, 32, 108, 105, 98, 101, 118, 32, 117, 115, 101, 100, 32, 116, 111, 32, 117, 115, 101, 46, 32, 73, 116, 39, 115, 10, 32, 32, 32, 32, 47, 47, 32, 97, 32, 108, 105, 116, 116, 108, 101, 32, 111, 110, 32, 116, 104, 101, 32, 115, 108, 111, 119, 32, 115, 105, 100, 101, 32, 98, 117, 116, 32, 108, 101, 116, 39, 115, 32, 115, 116, 105, 99, 107, 32, 119, 105, 116, 104, 32, 105, 116, 32, 102, 111, 114, 32, 110, 111, 119, 32, 116, 111, 32, 107, 101, 101, 112, 10, 32, 32, 32, 32, 47, 47, 32, 98, 101, 104, 97, 118, 105, 111, 114, 97, 108, 32, 99, 104, 97, 110, 103, 101, 115, 32, 116, 111, 32, 97, 32, 109, 105, 110, 105, 109, 117, 109, 46, 10, 32, 32, 32, 32, 105, 110, 116, 101, 114, 118, 97, 108, 58, 32, 53, 48, 48, 55, 44, 10, 32, 32, 32, 32, 112, 101, 114, 115, 105, 115, 116, 101, 110, 116, 58, 32, 116, 114, 117, 101, 10, 32, 32, 125, 59, 10, 10, 32, 32, 105, 102, 32, 40, 111, 112, 116, 105, 111, 110, 115, 32, 33, 61, 61, 32, 110, 117, 108, 108, 32, 38, 38, 32, 116, 121, 112, 101, 111, 102, 32, 111, 112, 116, 105, 111, 110, 115, 32, 61, 61, 61, 32, 39, 111, 98, 106, 101, 99, 116, 39, 41, 32, 123, 10, 32, 32, 32, 32, 111, 112, 116, 105, 111, 110, 115, 32, 61, 32, 117, 116, 105, 108, 46, 95, 101, 120, 116, 101, 110, 100, 40, 100, 101, 102, 97, 117, 108, 116, 115, 44, 32, 111, 112, 116, 105, 111, 110, 115, 41, 59, 10, 32, 32, 125, 32, 101, 108, 115, 101, 32, 123, 10, 32, 32, 32, 32, 108, 105, 115, 116, 101, 110, 101, 114, 32, 61, 32, 111, 112, 116, 105, 111, 110, 115, 59, 10, 32, 32, 32, 32, 111, 112, 116, 105, 111, 110, 115, 32, 61, 32, 100, 101, 102, 97, 117, 108, 116, 115, 59, 10, 32, 32, 125, 10, 10, 32, 32, 105, 102, 32, 40, 116, 121, 112, 101, 111, 102, 32, 108, 105, 115, 116, 101, 110, 101, 114, 32, 33, 61, 61, 32, 39, 102, 117, 110, 99, 116, 105, 111, 110, 39, 41, 32, 123, 10, 32, 32, 32, 32, 116, 104, 114, 111, 119, 32, 110, 101, 119, 32, 69, 114, 114, 111, 114, 40, 39, 119, 97, 116, 99, 104, 70, 105, 108, 101, 32, 114, 101, 113, 117, 105, 114, 101, 115, 32, 97, 32, 108, 105, 115, 116, 101, 110, 101, 114, 32, 102, 117, 110, 99, 116, 105, 111, 110, 39, 41, 59, 10, 32, 32, 125, 10, 10, 32, 32, 115, 116, 97, 116, 32, 61, 32, 115, 116, 97, 116, 87, 97, 116, 99, 104, 101, 114, 115, 46, 103, 101, 116, 40, 102, 105, 108, 101, 110, 97, 109, 101, 41, 59, 10, 10, 32, 32, 105, 102, 32, 40, 115, 116, 97, 116, 32, 61, 61, 61, 32, 117, 110, 100, 101, 102, 105, 110, 101, 100, 41, 32, 123, 10, 32, 32, 32, 32, 115, 116, 97, 116, 32, 61, 32, 110, 101, 119, 32, 83, 116, 97, 116, 87, 97, 116, 99, 104, 101, 114, 40, 41, 59, 10, 32, 32, 32, 32, 115, 116, 97, 116, 46, 115, 116, 97, 114, 116, 40, 102, 105, 108, 101, 110, 97, 109, 101, 44, 32, 111, 112, 116, 105, 111, 110, 115, 46, 112, 101, 114, 115, 105, 115, 116, 101, 110, 116, 44, 32, 111, 112, 116, 105, 111, 110, 115, 46, 105, 110, 116, 101, 114, 118, 97, 108, 41, 59, 10, 32, 32, 32, 32, 115, 116, 97, 116, 87, 97, 116, 99, 104, 101, 114, 115, 46, 115, 101, 116, 40, 102, 105, 108, 101, 110, 97, 109, 101, 44, 32, 115, 116, 97, 116, 41, 59, 10, 32, 32, 125, 10, 10, 32, 32, 115, 116, 97, 116, 46, 97, 100, 100, 76, 105, 115, 116, 101, 110, 101, 114, 40, 39, 99, 104, 97, 110, 103, 101, 39, 44, 32, 108, 105, 115, 116, 101, 110, 101, 114, 41, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 115, 116, 97, 116, 59, 10, 125, 59, 10, 10, 102, 115, 46, 117, 110, 119, 97, 116, 99, 104, 70, 105, 108, 101, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 102, 105, 108, 101, 110, 97, 109, 101, 44, 32, 108, 105, 115, 116, 101, 110, 101, 114, 41, 32, 123, 10, 32, 32, 110, 117, 108, 108, 67, 104, 101, 99, 107, 40, 102, 105, 108, 101, 110, 97, 109, 101, 41, 59, 10, 32, 32, 102, 105, 108, 101, 110, 97, 109, 101, 32, 61, 32, 112, 97, 116, 104, 77, 111, 100, 117, 108, 101, 46, 114, 101, 115, 111, 108, 118, 101, 40, 102, 105, 108, 101, 110, 97, 109, 101, 41, 59, 10, 32, 32, 118, 97, 114, 32, 115, 116, 97, 116, 32, 61, 32, 115, 116, 97, 116, 87, 97, 116, 99, 104, 101, 114, 115, 46, 103, 101, 116, 40, 102, 105, 108, 101, 110, 97, 109, 101, 41, 59, 10, 10, 32, 32, 105, 102, 32, 40, 115, 116, 97, 116, 32, 61, 61, 61, 32, 117, 110, 100, 101, 102, 105, 110, 101, 100, 41, 32, 114, 101, 116, 117, 114, 110, 59, 10, 10, 32, 32, 105, 102, 32, 40, 116, 121, 112, 101, 111, 102, 32, 108, 105, 115, 116, 101, 110, 101, 114, 32, 61, 61, 61, 32, 39, 102, 117, 110, 99, 116, 105, 111, 110, 39, 41, 32, 123, 10, 32, 32, 32, 32, 115, 116, 97, 116, 46, 114, 101, 109, 111, 118, 101, 76, 105, 115, 116, 101, 110, 101, 114, 40, 39, 99, 104, 97, 110, 103, 101, 39, 44, 32, 108, 105, 115, 116, 101, 110, 101, 114, 41, 59, 10, 32, 32, 125, 32, 101, 108, 115, 101, 32, 123, 10, 32, 32, 32, 32, 115, 116, 97, 116, 46, 114, 101, 109, 111, 118, 101, 65, 108, 108, 76, 105, 115, 116, 101, 110, 101, 114, 115, 40, 39, 99, 104, 97, 110, 103, 101, 39, 41, 59, 10, 32, 32, 125, 10, 10, 32, 32, 105, 102, 32, 40, 115, 116, 97, 116, 46, 108, 105, 115, 116, 101, 110, 101, 114, 67, 111, 117, 110, 116, 40, 39, 99, 104, 97, 110, 103, 101, 39, 41, 32, 61, 61, 61, 32, 48, 41, 32, 123, 10, 32, 32, 32, 32, 115, 116, 97, 116, 46, 115, 116, 111, 112, 40, 41, 59, 10, 32, 32, 32, 32, 115, 116, 97, 116, 87, 97, 116, 99, 104, 101, 114, 115, 46, 100, 101, 108, 101, 116, 101, 40, 102, 105, 108, 101, 110, 97, 109, 101, 41, 59, 10, 32, 32, 125, 10, 125, 59, 10, 10, 47, 47, 32, 82, 101, 115, 111, 108, 118, 101, 100, 32, 98, 121, 32, 114, 101, 97, 108, 112, 97, 116, 104, 40, 41, 32, 111, 102, 32, 116, 104, 101, 32, 112, 108, 97, 116, 102, 111, 114, 109, 46, 32, 65, 32, 99, 97, 99, 104, 101, 32, 111, 98, 106, 101, 99, 116, 32, 105, 115, 32, 108, 111, 111, 107, 101, 100, 32, 117, 112, 32, 97, 110, 100, 10, 47, 47, 32, 102, 105, 108, 108, 101, 100, 32, 105, 110, 32, 97, 115, 32, 98, 101, 102, 111, 114, 101, 44, 32, 116, 104, 101, 32, 99, 97, 99, 104, 101, 32, 110, 97, 116, 105, 118, 101, 32, 99, 111, 100, 101, 32, 115, 104, 97, 114, 101, 115, 32, 119, 105, 116, 104, 32, 101, 118, 101, 114, 121, 32, 99, 111, 110, 116, 101, 120, 116, 32, 105, 115, 10, 47, 47, 32, 110, 101, 118, 101, 114, 32, 117, 115, 101, 100, 32, 104, 101, 114, 101, 46, 10, 102, 115, 46, 114, 101, 97, 108, 112, 97, 116, 104, 83, 121, 110, 99, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 32, 114, 101, 97, 108, 112, 97, 116, 104, 83, 121, 110, 99, 40, 112, 44, 32, 99, 97, 99, 104, 101, 41, 32, 123, 10, 32, 32, 47, 47, 32, 109, 97, 107, 101, 32, 112, 32, 105, 115, 32, 97, 98, 115, 111, 108, 117, 116, 101, 10, 32, 32, 112, 32, 61, 32, 112, 97, 116, 104, 77, 111, 100, 117, 108, 101, 46, 114, 101, 115, 111, 108, 118, 101, 40, 112, 41, 59, 10, 10, 32, 32, 105, 102, 32, 40, 99, 97, 99, 104, 101, 32, 38, 38, 32, 79, 98, 106, 101, 99, 116, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 104, 97, 115, 79, 119, 110, 80, 114, 111, 112, 101, 114, 116, 121, 46, 99, 97, 108, 108, 40, 99, 97, 99, 104, 101, 44, 32, 112, 41, 41, 32, 123, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 99, 97, 99, 104, 101, 91, 112, 93, 59, 10, 32, 32, 125, 10, 10, 32, 32, 110, 117, 108, 108, 67, 104, 101, 99, 107, 40, 112, 41, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 114, 101, 97, 108, 32, 61, 32, 98, 105, 110, 100, 105, 110, 103, 46, 114, 101, 97, 108, 112, 97, 116, 104, 40, 112, 97, 116, 104, 77, 111, 100, 117, 108, 101, 46, 95, 109, 97, 107, 101, 76, 111, 110, 103, 40, 112, 41, 44, 32, 102, 97, 108, 115, 101, 41, 59, 10, 32, 32, 105, 102, 32, 40, 99, 97, 99, 104, 101, 41, 32, 99, 97, 99, 104, 101, 91, 112, 93, 32, 61, 32, 114, 101, 97, 108, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 114, 101, 97, 108, 59, 10, 125, 59, 10, 10, 10, 102, 115, 46, 114, 101, 97, 108, 112, 97, 116, 104, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 32, 114, 101, 97, 108, 112, 97, 116, 104, 40, 112, 44, 32, 99, 97, 99, 104, 101, 44, 32, 99, 98, 41, 32, 123, 10, 32, 32, 105, 102, 32, 40, 116, 121, 112, 101, 111, 102, 32, 99, 98, 32, 33, 61, 61, 32, 39, 102, 117, 110, 99, 116, 105, 111, 110, 39, 41, 32, 123, 10, 32, 32, 32, 32, 99, 98, 32, 61, 32, 109, 97, 121, 98, 101, 67, 97, 108, 108, 98, 97, 99, 107, 40, 99, 97, 99, 104, 101, 41, 59, 10, 32, 32, 32, 32, 99, 97, 99, 104, 101, 32, 61, 32, 110, 117, 108, 108, 59, 10, 32, 32, 125, 10, 10, 32, 32, 47, 47, 32, 109, 97, 107, 101, 32, 112, 32, 105, 115, 32, 97, 98, 115, 111, 108, 117, 116, 101, 10, 32, 32, 112, 32, 61, 32, 112, 97, 116, 104, 77, 111, 100, 117, 108, 101, 46, 114, 101, 115, 111, 108, 118, 101, 40, 112, 41, 59, 10, 10, 32, 32, 105, 102, 32, 40, 99, 97, 99, 104, 101, 32, 38, 38, 32, 79, 98, 106, 101, 99, 116, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 104, 97, 115, 79, 119, 110, 80, 114, 111, 112, 101, 114, 116, 121, 46, 99, 97, 108, 108, 40, 99, 97, 99, 104, 101, 44, 32, 112, 41, 41, 32, 123, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 112, 114, 111, 99, 101, 115, 115, 46, 110, 101, 120, 116, 84, 105, 99, 107, 40, 99, 98, 46, 98, 105, 110, 100, 40, 110, 117, 108, 108, 44, 32, 110, 117, 108, 108, 44, 32, 99, 97, 99, 104, 101, 91, 112, 93, 41, 41, 59, 10, 32, 32, 125, 10, 10, 32, 32, 105, 102, 32, 40, 33, 110, 117, 108, 108, 67, 104, 101, 99, 107, 40, 112, 44, 32, 99, 98, 41, 41, 32, 114, 101, 116, 117, 114, 110, 59, 10, 32, 32, 118, 97, 114, 32, 114, 101, 113, 32, 61, 32, 110, 101, 119, 32, 70, 83, 82, 101, 113, 87, 114, 97, 112, 40, 41, 59, 10, 32, 32, 114, 101, 113, 46, 111, 110, 99, 111, 109, 112, 108, 101, 116, 101, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 101, 114, 114, 44, 32, 114, 101, 97, 108, 41, 32, 123, 10, 32, 32, 32, 32, 105, 102, 32, 40, 101, 114, 114, 41, 32, 114, 101, 116, 117, 114, 110, 32, 99, 98, 40, 101, 114, 114, 41, 59, 10, 32, 32, 32, 32, 105, 102, 32, 40, 99, 97, 99, 104, 101, 41, 32, 99, 97, 99, 104, 101, 91, 112, 93, 32, 61, 32, 114, 101, 97, 108, 59, 10, 32, 32, 32, 32, 99, 98, 40, 110, 117, 108, 108, 44, 32, 114, 101, 97, 108, 41, 59, 10, 32, 32, 125, 59, 10, 32, 32, 98, 105, 110, 100, 105, 110, 103, 46, 114, 101, 97, 108, 112, 97, 116, 104, 40, 112, 97, 116, 104, 77, 111, 100, 117, 108, 101, 46, 95, 109, 97, 107, 101, 76, 111, 110, 103, 40, 112, 41, 44, 32, 102, 97, 108, 115, 101, 44, 32, 114, 101, 113, 41, 59, 10, 125, 59, 10, 10, 10, 118, 97, 114, 32, 112, 111, 111, 108, 59, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 97, 108, 108, 111, 99, 78, 101, 119, 80, 111, 111, 108, 40, 112, 111, 111, 108, 83, 105, 122, 101, 41, 32, 123, 10, 32, 32, 112, 111, 111, 108, 32, 61, 32, 110, 101, 119, 32, 66, 117, 102, 102, 101, 114, 40, 112, 111, 111, 108, 83, 105, 122, 101, 41, 59, 10, 32, 32, 112, 111, 111, 108, 46, 117, 115, 101, 100, 32, 61, 32, 48, 59, 10, 125, 10, 10, 10, 102, 115, 46, 99, 114, 101, 97, 116, 101, 82, 101, 97, 100, 83, 116, 114, 101, 97, 109, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 112, 97, 116, 104, 44, 32, 111, 112, 116, 105, 111, 110, 115, 41, 32, 123, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 110, 101, 119, 32, 82, 101, 97, 100, 83, 116, 114, 101, 97, 109, 40, 112, 97, 116, 104, 44, 32, 111, 112, 116, 105, 111, 110, 115, 41, 59, 10, 125, 59, 10, 10, 47, 47, 117, 116, 105, 108, 46, 105, 110, 104, 101, 114, 105, 116, 115, 40, 82, 101, 97, 100, 83, 116, 114, 101, 97, 109, 44, 32, 82, 101, 97, 100, 97, 98, 108, 101, 41, 59, 10, 47, 47, 102, 115, 46, 82, 101, 97, 100, 83, 116, 114, 101, 97, 109, 32, 61, 32, 82, 101, 97, 100, 83, 116, 114, 101, 97, 109, 59, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 82, 101, 97, 100, 83, 116, 114, 101, 97, 109, 40, 112, 97, 116, 104, 44, 32, 111, 112, 116, 105, 111, 110, 115, 41, 32, 123, 10, 32, 32, 105, 102, 32, 40, 33, 40, 116, 104, 105, 115, 32, 105, 110, 115, 116, 97, 110, 99, 101, 111, 102, 32, 82, 101, 97, 100, 83, 116, 114, 101, 97, 109, 41, 41, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 110, 101, 119, 32, 82, 101, 97, 100, 83, 116, 114, 101, 97, 109, 40, 112, 97, 116, 104, 44, 32, 111, 112, 116, 105, 111, 110, 115, 41, 59, 10, 10, 32, 32, 105, 102, 32, 40, 111, 112, 116, 105, 111, 110, 115, 32, 61, 61, 61, 32, 117, 110, 100, 101, 102, 105, 110, 101, 100, 41, 10, 32, 32, 32, 32, 111, 112, 116, 105, 111, 110, 115, 32, 61, 32, 123, 125, 59, 10, 32, 32, 101, 108, 115, 101, 32, 105, 102, 32, 40, 116, 121, 112, 101, 111, 102, 32, 111, 112, 116, 105, 111, 110, 115, 32, 61, 61, 61, 32, 39, 115, 116, 114, 105, 110, 103, 39, 41, 10, 32, 32, 32, 32, 111, 112, 116, 105, 111, 110, 115, 32, 61, 32, 123, 32, 101, 110, 99, 111, 100, 105, 110, 103, 58, 32, 111, 112, 116, 105, 111, 110, 115, 32, 125, 59, 10, 32, 32, 101, 108, 115, 101, 32, 105, 102, 32, 40, 111, 112, 116, 105, 111, 110, 115, 32, 61, 61, 61, 32, 110, 117, 108, 108, 32, 124, 124, 32, 116, 121, 112, 101, 111, 102, 32, 111, 112, 116, 105, 111, 110, 115, 32, 33, 61, 61, 32, 39, 111, 98, 106, 101, 99, 116, 39, 41, 10, 32, 32, 32, 32, 116, 104, 114, 111, 119, 32, 110, 101, 119, 32, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 111, 112, 116, 105, 111, 110, 115, 32, 109, 117, 115, 116, 32, 98, 101, 32, 97, 32, 115, 116, 114, 105, 110, 103, 32, 111, 114, 32, 97, 110, 32, 111, 98, 106, 101, 99, 116, 39, 41, 59, 10, 10, 32, 32, 47, 47, 32, 97, 32, 108, 105, 116, 116, 108, 101, 32, 98, 105, 116, 32, 98, 105, 103, 103, 101, 114, 32, 98, 117, 102, 102, 101, 114, 32, 97, 110, 100, 32, 119, 97, 116, 101, 114, 32, 109, 97, 114, 107, 115, 32, 98, 121, 32, 100, 101, 102, 97, 117, 108, 116, 10, 32, 32, 111, 112, 116, 105, 111, 110, 115, 32, 61, 32, 79, 98, 106, 101, 99, 116, 46, 99, 114, 101, 97, 116, 101, 40, 111, 112, 116, 105, 111, 110, 115, 41, 59, 10, 32, 32, 105, 102, 32, 40, 111, 112, 116, 105, 111, 110, 115, 46, 104, 105, 103, 104, 87, 97, 116, 101, 114, 77, 97, 114, 107, 32, 61, 61, 61, 32, 117, 110, 100, 101, 102, 105, 110, 101, 100, 41, 10, 32, 32, 32, 32, 111, 112, 116, 105, 111, 110, 115, 46, 104, 105, 103, 104, 87, 97, 116, 101, 114, 77, 97, 114, 107, 32, 61, 32, 54, 52, 32, 42, 32, 49, 48, 50, 52, 59, 10, 10, 32, 32, 82, 101, 97, 100, 97, 98, 108, 101, 46, 99, 97, 108, 108, 40, 116, 104, 105, 115, 44, 32, 111, 112, 116, 105, 111, 110, 115, 41, 59, 10, 10, 32, 32, 116, 104, 105, 115, 46, 112, 97, 116, 104, 32, 61, 32, 112, 97, 116, 104, 59, 10, 32, 32, 116, 104, 105, 115, 46, 102, 100, 32, 61, 32, 111, 112, 116, 105, 111, 110, 115, 46, 102, 100, 32, 61, 61, 61, 32, 117, 110, 100, 101, 102, 105, 110, 101, 100, 32, 63, 32, 110, 117, 108, 108, 32, 58, 32, 111, 112, 116, 105, 111, 110, 115, 46, 102, 100, 59, 10, 32, 32, 116, 104, 105, 115, 46, 102, 108, 97, 103, 115, 32, 61, 32, 111, 112, 116, 105, 111, 110, 115, 46, 102, 108, 97, 103, 115, 32, 61, 61, 61, 32, 117, 110, 100, 101, 102, 105, 110, 101, 100, 32, 63, 32, 39, 114, 39, 32, 58, 32, 111, 112, 116, 105, 111, 110, 115, 46, 102, 108, 97, 103, 115, 59, 10, 32, 32, 116, 104, 105, 115, 46, 109, 111, 100, 101, 32, 61, 32, 111, 112, 116, 105, 111, 110, 115, 46, 109, 111, 100, 101, 32, 61, 61, 61, 32, 117, 110, 100, 101, 102, 105, 110, 101, 100, 32, 63, 32, 48, 111, 54, 54, 54, 32, 58, 32, 111, 112, 116, 105, 111, 110, 115, 46, 109, 111, 100, 101, 59, 10, 10, 32, 32, 116, 104, 105, 115, 46, 115, 116, 97, 114, 116, 32, 61, 32, 111, 112, 116, 105, 111, 110, 115, 46, 115, 116, 97, 114, 116, 59, 10, 32, 32, 116, 104, 105, 115, 46, 101, 110, 100, 32, 61, 32, 111, 112, 116, 105, 111, 110, 115, 46, 101, 110, 100, 59, 10, 32, 32, 116, 104, 105, 115, 46, 97, 117, 116, 111, 67, 108, 111, 115, 101, 32, 61, 32, 111, 112, 116, 105, 111, 110, 115, 46, 97, 117, 116, 111, 67, 108, 111, 115, 101, 32, 61, 61, 61, 32, 117, 110, 100, 101, 102, 105, 110, 101, 100, 32, 63, 32, 116, 114, 117, 101, 32, 58, 32, 111, 112, 116, 105, 111, 110, 115, 46, 97, 117, 116, 111, 67, 108, 111, 115, 101, 59, 10, 32, 32, 116, 104, 105, 115, 46, 112, 111, 115, 32, 61, 32, 117, 110, 100, 101, 102, 105, 110, 101, 100, 59, 10, 10, 32, 32, 105, 102, 32, 40, 116, 104, 105, 115, 46, 115, 116, 97, 114, 116, 32, 33, 61, 61, 32, 117, 110, 100, 101, 102, 105, 110, 101, 100, 41, 32, 123, 10, 32, 32, 32, 32, 105, 102, 32, 40, 116, 121, 112, 101, 111, 102, 32, 116, 104, 105, 115, 46, 115, 116, 97, 114, 116, 32, 33, 61, 61, 32, 39, 110, 117, 109, 98, 101, 114, 39, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 116, 104, 114, 111, 119, 32, 110, 101, 119, 32, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 115, 116, 97, 114, 116, 32, 109, 117, 115, 116, 32, 98, 101, 32, 97, 32, 78, 117, 109, 98, 101, 114, 39, 41, 59, 10, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 105, 102, 32, 40, 116, 104, 105, 115, 46, 101, 110, 100, 32, 61, 61, 61, 32, 117, 110, 100, 101, 102, 105, 110, 101, 100, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 116, 104, 105, 115, 46, 101, 110, 100, 32, 61, 32, 73, 110, 102, 105, 110, 105, 116, 121, 59, 10, 32, 32, 32, 32, 125, 32, 101, 108, 115, 101, 32, 105, 102, 32, 40, 116, 121, 112, 101, 111, 102, 32, 116, 104, 105, 115, 46, 101, 110, 100, 32, 33, 61, 61, 32, 39, 110, 117, 109, 98, 101, 114, 39, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 116, 104, 114, 111, 119, 32, 110, 101, 119, 32, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 101, 110, 100, 32, 109, 117, 115, 116, 32, 98, 101, 32, 97, 32, 78, 117, 109, 98, 101, 114, 39, 41, 59, 10, 32, 32, 32, 32, 125, 10, 10, 32, 32, 32, 32, 105, 102, 32, 40, 116, 104, 105, 115, 46, 115, 116, 97, 114, 116, 32, 62, 32, 116, 104, 105, 115, 46, 101, 110, 100, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 116, 104, 114, 111, 119, 32, 110, 101, 119, 32, 69, 114, 114, 111, 114, 40, 39, 115, 116, 97, 114, 116, 32, 109, 117, 115, 116, 32, 98, 101, 32, 60, 61, 32, 101, 110, 100, 39, 41, 59, 10, 32, 32, 32, 32, 125, 10, 10, 32, 32, 32, 32, 116, 104, 105, 115, 46, 112, 111, 115, 32, 61, 32, 116, 104, 105, 115, 46, 115, 116, 97, 114, 116, 59, 10, 32, 32, 125, 10, 10, 32, 32, 105, 102, 32, 40, 116, 121, 112, 101, 111, 102, 32, 116, 104, 105, 115, 46, 102, 100, 32, 33, 61, 61, 32, 39, 110, 117, 109, 98, 101, 114, 39, 41, 10, 32, 32, 32, 32, 116, 104, 105, 115, 46, 111, 112, 101, 110, 40, 41, 59, 10, 10, 32, 32, 116, 104, 105, 115, 46, 111, 110, 40, 39, 101, 110, 100, 39, 44, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 32, 123, 10, 32, 32, 32, 32, 105, 102, 32, 40, 116, 104, 105, 115, 46, 97, 117, 116, 111, 67, 108, 111, 115, 101, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 116, 104, 105, 115, 46, 100, 101, 115, 116, 114, 111, 121, 40, 41, 59, 10, 32, 32, 32, 32, 125, 10, 32, 32, 125, 41, 59, 10, 125, 10, 10, 102, 115, 46, 70, 105, 108, 101, 82, 101, 97, 100, 83, 116, 114, 101, 97, 109, 32, 61, 32, 102, 115, 46, 82, 101, 97, 100, 83, 116, 114, 101, 97, 109, 59, 32, 47, 47, 32, 115, 117, 112, 112, 111, 114, 116, 32, 116, 104, 101, 32, 108, 101, 103, 97, 99, 121, 32, 110, 97, 109, 101, 10, 10, 82, 101, 97, 100, 83, 116, 114, 101, 97, 109, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 111, 112, 101, 110, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 32, 123, 10, 32, 32, 118, 97, 114, 32, 115, 101, 108, 102, 32, 61, 32, 116, 104, 105, 115, 59, 10, 32, 32, 102, 115, 46, 111, 112, 101, 110, 40, 116, 104, 105, 115, 46, 112, 97, 116, 104, 44, 32, 116, 104, 105, 115, 46, 102, 108, 97, 103, 115, 44, 32, 116, 104, 105, 115, 46, 109, 111, 100, 101, 44, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 101, 114, 44, 32, 102, 100, 41, 32, 123, 10, 32, 32, 32, 32, 105, 102, 32, 40, 101, 114, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 105, 102, 32, 40, 115, 101, 108, 102, 46, 97, 117, 116, 111, 67, 108, 111, 115, 101, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 115, 101, 108, 102, 46, 100, 101, 115, 116, 114, 111, 121, 40, 41, 59, 10, 32, 32, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 32, 32, 115, 101, 108, 102, 46, 101, 109, 105, 116, 40, 39, 101, 114, 114, 111, 114, 39, 44, 32, 101, 114, 41, 59, 10, 32, 32, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 59, 10, 32, 32, 32, 32, 125, 10, 10, 32, 32, 32, 32, 115, 101, 108, 102, 46, 102, 100, 32, 61, 32, 102, 100, 59, 10, 32, 32, 32, 32, 115, 101, 108, 102, 46, 101, 109, 105, 116, 40, 39, 111, 112, 101, 110, 39, 44, 32, 102, 100, 41, 59, 10, 32, 32, 32, 32, 47, 47, 32, 115, 116, 97, 114, 116, 32, 116, 104, 101, 32, 102, 108, 111, 119, 32, 111, 102, 32, 100, 97, 116, 97, 46, 10, 32, 32, 32, 32, 115, 101, 108, 102, 46, 114, 101, 97, 100, 40, 41, 59, 10, 32, 32, 125, 41, 59, 10, 125, 59, 10, 10, 82, 101, 97, 100, 83, 116, 114, 101, 97, 109, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 95, 114, 101, 97, 100, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 110, 41, 32, 123, 10, 32, 32, 105, 102, 32, 40, 116, 121, 112, 101, 111, 102, 32, 116, 104, 105, 115, 46, 102, 100, 32, 33, 61, 61, 32, 39, 110, 117, 109, 98, 101, 114, 39, 41, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 46, 111, 110, 99, 101, 40, 39, 111, 112, 101, 110, 39, 44, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 116, 104, 105, 115, 46, 95, 114, 101, 97, 100, 40, 110, 41, 59, 10, 32, 32, 32, 32, 125, 41, 59, 10, 10, 32, 32, 105, 102, 32, 40, 116, 104, 105, 115, 46, 100, 101, 115, 116, 114, 111, 121, 101, 100, 41, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 59, 10, 10, 32, 32, 105, 102, 32, 40, 33, 112, 111, 111, 108, 32, 124, 124, 32, 112, 111, 111, 108, 46, 108, 101, 110, 103, 116, 104, 32, 45, 32, 112, 111, 111, 108, 46, 117, 115, 101, 100, 32, 60, 32, 107, 77, 105, 110, 80, 111, 111, 108, 83, 112, 97, 99, 101, 41, 32, 123, 10, 32, 32, 32, 32, 47, 47, 32, 100, 105, 115, 99, 97, 114, 100, 32, 116, 104, 101, 32, 111, 108, 100, 32, 112, 111, 111, 108, 46, 10, 32, 32, 32, 32, 112, 111, 111, 108, 32, 61, 32, 110, 117, 108, 108, 59, 10, 32, 32, 32, 32, 97, 108, 108, 111, 99, 78, 101, 119, 80, 111, 111, 108, 40, 116, 104, 105, 115, 46, 95, 114, 101, 97, 100, 97, 98, 108, 101, 83, 116, 97, 116, 101, 46, 104, 105, 103, 104, 87, 97, 116, 101, 114, 77, 97, 114, 107, 41, 59, 10, 32, 32, 125, 10, 10, 32, 32, 47, 47, 32, 71, 114, 97, 98, 32, 97, 110, 111, 116, 104, 101, 114, 32, 114, 101, 102, 101, 114, 101, 110, 99, 101, 32, 116, 111, 32, 116, 104, 101, 32, 112, 111, 111, 108, 32, 105, 110, 32, 116, 104, 101, 32, 99, 97, 115, 101, 32, 116, 104, 97, 116, 32, 119, 104, 105, 108, 101, 32, 119, 101, 39, 114, 101, 10, 32, 32, 47, 47, 32, 105, 110, 32, 116, 104, 101, 32, 116, 104, 114, 101, 97, 100, 32, 112, 111, 111, 108, 32, 97, 110, 111, 116, 104, 101, 114, 32, 114, 101, 97, 100, 40, 41, 32, 102, 105, 110, 105, 115, 104, 101, 115, 32, 117, 112, 32, 116, 104, 101, 32, 112, 111, 111, 108, 44, 32, 97, 110, 100, 10, 32, 32, 47, 47, 32, 97, 108, 108, 111, 99, 97, 116, 101, 115, 32, 97, 32, 110, 101, 119, 32, 111, 110, 101, 46, 10, 32, 32, 118, 97, 114, 32, 116, 104, 105, 115, 80, 111, 111, 108, 32, 61, 32, 112, 111, 111, 108, 59, 10, 32, 32, 118, 97, 114, 32, 116, 111, 82, 101, 97, 100, 32, 61, 32, 77, 97, 116, 104, 46, 109, 105, 110, 40, 112, 111, 111, 108, 46, 108, 101, 110, 103, 116, 104, 32, 45, 32, 112, 111, 111, 108, 46, 117, 115, 101, 100, 44, 32, 110, 41, 59, 10, 32, 32, 118, 97, 114, 32, 115, 116, 97, 114, 116, 32, 61, 32, 112, 111, 111, 108, 46, 117, 115, 101, 100, 59, 10, 10, 32, 32, 105, 102, 32, 40, 116, 104, 105, 115, 46, 112, 111, 115, 32, 33, 61, 61, 32, 117, 110, 100, 101, 102, 105, 110, 101, 100, 41, 10, 32, 32, 32, 32, 116, 111, 82, 101, 97, 100, 32, 61, 32, 77, 97, 116, 104, 46, 109, 105, 110, 40, 116, 104, 105, 115, 46, 101, 110, 100, 32, 45, 32, 116, 104, 105, 115, 46, 112, 111, 115, 32, 43, 32, 49, 44, 32, 116, 111, 82, 101, 97, 100, 41, 59, 10, 10, 32, 32, 47, 47, 32, 97, 108, 114, 101, 97, 100, 121, 32, 114, 101, 97, 100, 32, 101, 118, 101, 114, 121, 116, 104, 105, 110, 103, 32, 119, 101, 32, 119, 101, 114, 101, 32, 115, 117, 112, 112, 111, 115, 101, 100, 32, 116, 111, 32, 114, 101, 97, 100, 33, 10, 32, 32, 47, 47, 32, 116, 114, 101, 97, 116, 32, 97, 115, 32, 69, 79, 70, 46, 10, 32, 32, 105, 102, 32, 40, 116, 111, 82, 101, 97, 100, 32, 60, 61, 32, 48, 41, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 46, 112, 117, 115, 104, 40, 110, 117, 108, 108, 41, 59, 10, 10, 32, 32, 47, 47, 32, 116, 104, 101, 32, 97, 99, 116, 117, 97, 108, 32, 114, 101, 97, 100, 46, 10, 32, 32, 118, 97, 114, 32, 115, 101, 108, 102, 32, 61, 32, 116, 104, 105, 115, 59, 10, 32, 32, 102, 115, 46, 114, 101, 97, 100, 40, 116, 104, 105, 115, 46, 102, 100, 44, 32, 112, 111, 111, 108, 44, 32, 112, 111, 111, 108, 46, 117, 115, 101, 100, 44, 32, 116, 111, 82, 101, 97, 100, 44, 32, 116, 104, 105, 115, 46, 112, 111, 115, 44, 32, 111, 110, 114, 101, 97, 100, 41, 59, 10, 10, 32, 32, 47, 47, 32, 109, 111, 118, 101, 32, 116, 104, 101, 32, 112, 111, 111, 108, 32, 112, 111, 115, 105, 116, 105, 111, 110, 115, 44, 32, 97, 110, 100, 32, 105, 110, 116, 101, 114, 110, 97, 108, 32, 112, 111, 115, 105, 116, 105, 111, 110, 32, 102, 111, 114, 32, 114, 101, 97, 100, 105, 110, 103, 46, 10, 32, 32, 105, 102, 32, 40, 116, 104, 105, 115, 46, 112, 111, 115, 32, 33, 61, 61, 32, 117, 110, 100, 101, 102, 105, 110, 101, 100, 41, 10, 32, 32, 32, 32, 116, 104, 105, 115, 46, 112, 111, 115, 32, 43, 61, 32, 116, 111, 82, 101, 97, 100, 59, 10, 32, 32, 112, 111, 111, 108, 46, 117, 115, 101, 100, 32, 43, 61, 32, 116, 111, 82, 101, 97, 100, 59, 10, 10, 32, 32, 102, 117, 110, 99, 116, 105, 111, 110, 32, 111, 110, 114, 101, 97, 100, 40, 101, 114, 44, 32, 98, 121, 116, 101, 115, 82, 101, 97, 100, 41, 32, 123, 10, 32, 32, 32, 32, 105, 102, 32, 40, 101, 114, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 105, 102, 32, 40, 115, 101, 108, 102, 46, 97, 117, 116, 111, 67, 108, 111, 115, 101, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 115, 101, 108, 102, 46, 100, 101, 115, 116, 114, 111, 121, 40, 41, 59, 10, 32, 32, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 32, 32, 115, 101, 108, 102, 46, 101, 109, 105, 116, 40, 39, 101, 114, 114, 111, 114, 39, 44, 32, 101, 114, 41, 59, 10, 32, 32, 32, 32, 125, 32, 101, 108, 115, 101, 32, 123, 10, 32, 32, 32, 32, 32, 32, 118, 97, 114, 32, 98, 32, 61, 32, 110, 117, 108, 108, 59, 10, 32, 32, 32, 32, 32, 32, 105, 102, 32, 40, 98, 121, 116, 101, 115, 82, 101, 97, 100, 32, 62, 32, 48, 41, 10, 32, 32, 32, 32, 32, 32, 32, 32, 98, 32, 61, 32, 116, 104, 105, 115, 80, 111, 111, 108, 46, 115, 108, 105, 99, 101, 40, 115, 116, 97, 114, 116, 44, 32, 115, 116, 97, 114, 116, 32, 43, 32, 98, 121, 116, 101, 115, 82, 101, 97, 100, 41, 59, 10, 10, 32, 32, 32, 32, 32, 32, 115, 101, 108, 102, 46, 112, 117, 115, 104, 40, 98, 41, 59, 10, 32, 32, 32, 32, 125, 10, 32, 32, 125, 10, 125, 59, 10, 10, 10, 82, 101, 97, 100, 83, 116, 114, 101, 97, 109, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 100, 101, 115, 116, 114, 111, 121, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 32, 123, 10, 32, 32, 105, 102, 32, 40, 116, 104, 105, 115, 46, 100, 101, 115, 116, 114, 111, 121, 101, 100, 41, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 59, 10, 32, 32, 116, 104, 105, 115, 46, 100, 101, 115, 116, 114, 111, 121, 101, 100, 32, 61, 32, 116, 114, 117, 101, 59, 10, 32, 32, 116, 104, 105, 115, 46, 99, 108, 111, 115, 101, 40, 41, 59, 10, 125, 59, 10, 10, 10, 82, 101, 97, 100, 83, 116, 114, 101, 97, 109, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 99, 108, 111, 115, 101, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 99, 98, 41, 32, 123, 10, 32, 32, 118, 97, 114, 32, 115, 101, 108, 102, 32, 61, 32, 116, 104, 105, 115, 59, 10, 32, 32, 105, 102, 32, 40, 99, 98, 41, 10, 32, 32, 32, 32, 116, 104, 105, 115, 46, 111, 110, 99, 101, 40, 39, 99, 108, 111, 115, 101, 39, 44, 32, 99, 98, 41, 59, 10, 32, 32, 105, 102, 32, 40, 116, 104, 105, 115, 46, 99, 108, 111, 115, 101, 100, 32, 124, 124, 32, 116, 121, 112, 101, 111, 102, 32, 116, 104, 105, 115, 46, 102, 100, 32, 33, 61, 61, 32, 39, 110, 117, 109, 98, 101, 114, 39, 41, 32, 123, 10, 32, 32, 32, 32, 105, 102, 32, 40, 116, 121, 112, 101, 111, 102, 32, 116, 104, 105, 115, 46, 102, 100, 32, 33, 61, 61, 32, 39, 110, 117, 109, 98, 101, 114, 39, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 116, 104, 105, 115, 46, 111, 110, 99, 101, 40, 39, 111, 112, 101, 110, 39, 44, 32, 99, 108, 111, 115, 101, 41, 59, 10, 32, 32, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 59, 10, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 112, 114, 111, 99, 101, 115, 115, 46, 110, 101, 120, 116, 84, 105, 99, 107, 40, 116, 104, 105, 115, 46, 101, 109, 105, 116, 46, 98, 105, 110, 100, 40, 116, 104, 105, 115, 44, 32, 39, 99, 108, 111, 115, 101, 39, 41, 41, 59, 10, 32, 32, 125, 10, 32, 32, 116, 104, 105, 115, 46, 99, 108, 111, 115, 101, 100, 32, 61, 32, 116, 114, 117, 101, 59, 10, 32, 32, 99, 108, 111, 115, 101, 40, 41, 59, 10, 10, 32, 32, 102, 117, 110, 99, 116, 105, 111, 110, 32, 99, 108, 111, 115, 101, 40, 102, 100, 41, 32, 123, 10, 32, 32, 32, 32, 102, 115, 46, 99, 108, 111, 115, 101, 40, 102, 100, 32, 124, 124, 32, 115, 101, 108, 102, 46, 102, 100, 44, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 101, 114, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 105, 102, 32, 40, 101, 114, 41, 10, 32, 32, 32, 32, 32, 32, 32, 32, 115, 101, 108, 102, 46, 101, 109, 105, 116, 40, 39, 101, 114, 114, 111, 114, 39, 44, 32, 101, 114, 41, 59, 10, 32, 32, 32, 32, 32, 32, 101, 108, 115, 101, 10, 32, 32, 32, 32, 32, 32, 32, 32, 115, 101, 108, 102, 46, 101, 109, 105, 116, 40, 39, 99, 108, 111, 115, 101, 39, 41, 59, 10, 32, 32, 32, 32, 125, 41, 59, 10, 32, 32, 32, 32, 115, 101, 108, 102, 46, 102, 100, 32, 61, 32, 110, 117, 108, 108, 59, 10, 32, 32, 125, 10, 125, 59, 10, 10, 10, 102, 115, 46, 99, 114, 101, 97, 116, 101, 87, 114, 105, 116, 101, 83, 116, 114, 101, 97, 109, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 112, 97, 116, 104, 44, 32, 111, 112, 116, 105, 111, 110, 115, 41, 32, 123, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 110, 101, 119, 32, 87, 114, 105, 116, 101, 83, 116, 114, 101, 97, 109, 40, 112, 97, 116, 104, 44, 32, 111, 112, 116, 105, 111, 110, 115, 41, 59, 10, 125, 59, 10, 10, 47, 47, 117, 116, 105, 108, 46, 105, 110, 104, 101, 114, 105, 116, 115, 40, 87, 114, 105, 116, 101, 83, 116, 114, 101, 97, 109, 44, 32, 87, 114, 105, 116, 97, 98, 108, 101, 41, 59, 10, 47, 47, 102, 115, 46, 87, 114, 105, 116, 101, 83, 116, 114, 101, 97, 109, 32, 61, 32, 87, 114, 105, 116, 101, 83, 116, 114, 101, 97, 109, 59, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 87, 114, 105, 116, 101, 83, 116, 114, 101, 97, 109, 40, 112, 97, 116, 104, 44, 32, 111, 112, 116, 105, 111, 110, 115, 41, 32, 123, 10, 32, 32, 105, 102, 32, 40, 33, 40, 116, 104, 105, 115, 32, 105, 110, 115, 116, 97, 110, 99, 101, 111, 102, 32, 87, 114, 105, 116, 101, 83, 116, 114, 101, 97, 109, 41, 41, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 110, 101, 119, 32, 87, 114, 105, 116, 101, 83, 116, 114, 101, 97, 109, 40, 112, 97, 116, 104, 44, 32, 111, 112, 116, 105, 111, 110, 115, 41, 59, 10, 10, 32, 32, 105, 102, 32, 40, 111, 112, 116, 105, 111, 110, 115, 32, 61, 61, 61, 32, 117, 110, 100, 101, 102, 105, 110, 101, 100, 41, 10, 32, 32, 32, 32, 111, 112, 116, 105, 111, 110, 115, 32, 61, 32, 123, 125, 59, 10, 32, 32, 101, 108, 115, 101, 32, 105, 102, 32, 40, 116, 121, 112, 101, 111, 102, 32, 111, 112, 116, 105, 111, 110, 115, 32, 61, 61, 61, 32, 39, 115, 116, 114, 105, 110, 103, 39, 41, 10, 32, 32, 32, 32, 111, 112, 116, 105, 111, 110, 115, 32, 61, 32, 123, 32, 101, 110, 99, 111, 100, 105, 110, 103, 58, 32, 111, 112, 116, 105, 111, 110, 115, 32, 125, 59, 10, 32, 32, 101, 108, 115, 101, 32, 105, 102, 32, 40, 111, 112, 116, 105, 111, 110, 115, 32, 61, 61, 61, 32, 110, 117, 108, 108, 32, 124, 124, 32, 116, 121, 112, 101, 111, 102, 32, 111, 112, 116, 105, 111, 110, 115, 32, 33, 61, 61, 32, 39, 111, 98, 106, 101, 99, 116, 39, 41, 10, 32, 32, 32, 32, 116, 104, 114, 111, 119, 32, 110, 101, 119, 32, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 111, 112, 116, 105, 111, 110, 115, 32, 109, 117, 115, 116, 32, 98, 101, 32, 97, 32, 115, 116, 114, 105, 110, 103, 32, 111, 114, 32, 97, 110, 32, 111, 98, 106, 101, 99, 116, 39, 41, 59, 10, 10, 32, 32, 111, 112, 116, 105, 111, 110, 115, 32, 61, 32, 79, 98, 106, 101, 99, 116, 46, 99, 114, 101, 97, 116, 101, 40, 111, 112, 116, 105, 111, 110, 115, 41, 59, 10, 10, 32, 32, 87, 114, 105, 116, 97, 98, 108, 101, 46, 99, 97, 108, 108, 40, 116, 104, 105, 115, 44, 32, 111, 112, 116, 105, 111, 110, 115, 41, 59, 10, 10, 32, 32, 116, 104, 105, 115, 46, 112, 97, 116, 104, 32, 61, 32, 112, 97, 116, 104, 59, 10, 32, 32, 116, 104, 105, 115, 46, 102, 100, 32, 61, 32, 111, 112, 116, 105, 111, 110, 115, 46, 102, 100, 32, 61, 61, 61, 32, 117, 110, 100, 101, 102, 105, 110, 101, 100, 32, 63, 32, 110, 117, 108, 108, 32, 58, 32, 111, 112, 116, 105, 111, 110, 115, 46, 102, 100, 59, 10, 32, 32, 116, 104, 105, 115, 46, 102, 108, 97, 103, 115, 32, 61, 32, 111, 112, 116, 105, 111, 110, 115, 46, 102, 108, 97, 103, 115, 32, 61, 61, 61, 32, 117, 110, 100, 101, 102, 105, 110, 101, 100, 32, 63, 32, 39, 119, 39, 32, 58, 32, 111, 112, 116, 105, 111, 110, 115, 46, 102, 108, 97, 103, 115, 59, 10, 32, 32, 116, 104, 105, 115, 46, 109, 111, 100, 101, 32, 61, 32, 111, 112, 116, 105, 111, 110, 115, 46, 109, 111, 100, 101, 32, 61, 61, 61, 32, 117, 110, 100, 101, 102, 105, 110, 101, 100, 32, 63, 32, 48, 111, 54, 54, 54, 32, 58, 32, 111, 112, 116, 105, 111, 110, 115, 46, 109, 111, 100, 101, 59, 10, 10, 32, 32, 116, 104, 105, 115, 46, 115, 116, 97, 114, 116, 32, 61, 32, 111, 112, 116, 105, 111, 110, 115, 46, 115, 116, 97, 114, 116, 59, 10, 32, 32, 116, 104, 105, 115, 46, 112, 111, 115, 32, 61, 32, 117, 110, 100, 101, 102, 105, 110, 101, 100, 59, 10, 32, 32, 116, 104, 105, 115, 46, 98, 121, 116, 101, 115, 87, 114, 105, 116, 116, 101, 110, 32, 61, 32, 48, 59, 10, 10, 32, 32, 105, 102, 32, 40, 116, 104, 105, 115, 46, 115, 116, 97, 114, 116, 32, 33, 61, 61, 32, 117, 110, 100, 101, 102, 105, 110, 101, 100, 41, 32, 123, 10, 32, 32, 32, 32, 105, 102, 32, 40, 116, 121, 112, 101, 111, 102, 32, 116, 104, 105, 115, 46, 115, 116, 97, 114, 116, 32, 33, 61, 61, 32, 39, 110, 117, 109, 98, 101, 114, 39, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 116, 104, 114, 111, 119, 32, 110, 101, 119, 32, 84, 121, 112, 101, 69, 114, 114, 111, 114, 40, 39, 115, 116, 97, 114, 116, 32, 109, 117, 115, 116, 32, 98, 101, 32, 97, 32, 78, 117, 109, 98, 101, 114, 39, 41, 59, 10, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 105, 102, 32, 40, 116, 104, 105, 115, 46, 115, 116, 97, 114, 116, 32, 60, 32, 48, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 116, 104, 114, 111, 119, 32, 110, 101, 119, 32, 69, 114, 114, 111, 114, 40, 39, 115, 116, 97, 114, 116, 32, 109, 117, 115, 116, 32, 98, 101, 32, 62, 61, 32, 122, 101, 114, 111, 39, 41, 59, 10, 32, 32, 32, 32, 125, 10, 10, 32, 32, 32, 32, 116, 104, 105, 115, 46, 112, 111, 115, 32, 61, 32, 116, 104, 105, 115, 46, 115, 116, 97, 114, 116, 59, 10, 32, 32, 125, 10, 10, 32, 32, 105, 102, 32, 40, 111, 112, 116, 105, 111, 110, 115, 46, 101, 110, 99, 111, 100, 105, 110, 103, 41, 10, 32, 32, 32, 32, 116, 104, 105, 115, 46, 115, 101, 116, 68, 101, 102, 97, 117, 108, 116, 69, 110, 99, 111, 100, 105, 110, 103, 40, 111, 112, 116, 105, 111, 110, 115, 46, 101, 110, 99, 111, 100, 105, 110, 103, 41, 59, 10, 10, 32, 32, 105, 102, 32, 40, 116, 121, 112, 101, 111, 102, 32, 116, 104, 105, 115, 46, 102, 100, 32, 33, 61, 61, 32, 39, 110, 117, 109, 98, 101, 114, 39, 41, 10, 32, 32, 32, 32, 116, 104, 105, 115, 46, 111, 112, 101, 110, 40, 41, 59, 10, 10, 32, 32, 47, 47, 32, 100, 105, 115, 112, 111, 115, 101, 32, 111, 110, 32, 102, 105, 110, 105, 115, 104, 46, 10, 32, 32, 116, 104, 105, 115, 46, 111, 110, 99, 101, 40, 39, 102, 105, 110, 105, 115, 104, 39, 44, 32, 116, 104, 105, 115, 46, 99, 108, 111, 115, 101, 41, 59, 10, 125, 10, 10, 102, 115, 46, 70, 105, 108, 101, 87, 114, 105, 116, 101, 83, 116, 114, 101, 97, 109, 32, 61, 32, 102, 115, 46, 87, 114, 105, 116, 101, 83, 116, 114, 101, 97, 109, 59, 32, 47, 47, 32, 115, 117, 112, 112, 111, 114, 116, 32, 116, 104, 101, 32, 108, 101, 103, 97, 99, 121, 32, 110, 97, 109, 101, 10, 10, 10, 87, 114, 105, 116, 101, 83, 116, 114, 101, 97, 109, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 111, 112, 101, 110, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 32, 123, 10, 32, 32, 102, 115, 46, 111, 112, 101, 110, 40, 116, 104, 105, 115, 46, 112, 97, 116, 104, 44, 32, 116, 104, 105, 115, 46, 102, 108, 97, 103, 115, 44, 32, 116, 104, 105, 115, 46, 109, 111, 100, 101, 44, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 101, 114, 44, 32, 102, 100, 41, 32, 123, 10, 32, 32, 32, 32, 105, 102, 32, 40, 101, 114, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 116, 104, 105, 115, 46, 100, 101, 115, 116, 114, 111, 121, 40, 41, 59, 10, 32, 32, 32, 32, 32, 32, 116, 104, 105, 115, 46, 101, 109, 105, 116, 40, 39, 101, 114, 114, 111, 114, 39, 44, 32, 101, 114, 41, 59, 10, 32, 32, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 59, 10, 32, 32, 32, 32, 125, 10, 10, 32, 32, 32, 32, 116, 104, 105, 115, 46, 102, 100, 32, 61, 32, 102, 100, 59, 10, 32, 32, 32, 32, 116, 104, 105, 115, 46, 101, 109, 105, 116, 40, 39, 111, 112, 101, 110, 39, 44, 32, 102, 100, 41, 59, 10, 32, 32, 125, 46, 98, 105, 110, 100, 40, 116, 104, 105, 115, 41, 41, 59, 10, 125, 59, 10, 10, 10, 87, 114, 105, 116, 101, 83, 116, 114, 101, 97, 109, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 95, 119, 114, 105, 116, 101, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 100, 97, 116, 97, 44, 32, 101, 110, 99, 111, 100, 105, 110, 103, 44, 32, 99, 98, 41, 32, 123, 10, 32, 32, 105, 102, 32, 40, 33, 40, 100, 97, 116, 97, 32, 105, 110, 115, 116, 97, 110, 99, 101, 111, 102, 32, 66, 117, 102, 102, 101, 114, 41, 41, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 46, 101, 109, 105, 116, 40, 39, 101, 114, 114, 111, 114, 39, 44, 32, 110, 101, 119, 32, 69, 114, 114, 111, 114, 40, 39, 73, 110, 118, 97, 108, 105, 100, 32, 100, 97, 116, 97, 39, 41, 41, 59, 10, 10, 32, 32, 105, 102, 32, 40, 116, 121, 112, 101, 111, 102, 32, 116, 104, 105, 115, 46, 102, 100, 32, 33, 61, 61, 32, 39, 110, 117, 109, 98, 101, 114, 39, 41, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 46, 111, 110, 99, 101, 40, 39, 111, 112, 101, 110, 39, 44, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 116, 104, 105, 115, 46, 95, 119, 114, 105, 116, 101, 40, 100, 97, 116, 97, 44, 32, 101, 110, 99, 111, 100, 105, 110, 103, 44, 32, 99, 98, 41, 59, 10, 32, 32, 32, 32, 125, 41, 59, 10, 10, 32, 32, 118, 97, 114, 32, 115, 101, 108, 102, 32, 61, 32, 116, 104, 105, 115, 59, 10, 32, 32, 102, 115, 46, 119, 114, 105, 116, 101, 40, 116, 104, 105, 115, 46, 102, 100, 44, 32, 100, 97, 116, 97, 44, 32, 48, 44, 32, 100, 97, 116, 97, 46, 108, 101, 110, 103, 116, 104, 44, 32, 116, 104, 105, 115, 46, 112, 111, 115, 44, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 101, 114, 44, 32, 98, 121, 116, 101, 115, 41, 32, 123, 10, 32, 32, 32, 32, 105, 102, 32, 40, 101, 114, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 115, 101, 108, 102, 46, 100, 101, 115, 116, 114, 111, 121, 40, 41, 59, 10, 32, 32, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 99, 98, 40, 101, 114, 41, 59, 10, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 115, 101, 108, 102, 46, 98, 121, 116, 101, 115, 87, 114, 105, 116, 116, 101, 110, 32, 43, 61, 32, 98, 121, 116, 101, 115, 59, 10, 32, 32, 32, 32, 99, 98, 40, 41, 59, 10, 32, 32, 125, 41, 59, 10, 10, 32, 32, 105, 102, 32, 40, 116, 104, 105, 115, 46, 112, 111, 115, 32, 33, 61, 61, 32, 117, 110, 100, 101, 102, 105, 110, 101, 100, 41, 10, 32, 32, 32, 32, 116, 104, 105, 115, 46, 112, 111, 115, 32, 43, 61, 32, 100, 97, 116, 97, 46, 108, 101, 110, 103, 116, 104, 59, 10, 125, 59, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 119, 114, 105, 116, 101, 118, 40, 102, 100, 44, 32, 99, 104, 117, 110, 107, 115, 44, 32, 112, 111, 115, 105, 116, 105, 111, 110, 44, 32, 99, 97, 108, 108, 98, 97, 99, 107, 41, 32, 123, 10, 32, 32, 102, 117, 110, 99, 116, 105, 111, 110, 32, 119, 114, 97, 112, 112, 101, 114, 40, 101, 114, 114, 44, 32, 119, 114, 105, 116, 116, 101, 110, 41, 32, 123, 10, 32, 32, 32, 32, 47, 47, 32, 82, 101, 116, 97, 105, 110, 32, 97, 32, 114, 101, 102, 101, 114, 101, 110, 99, 101, 32, 116, 111, 32, 99, 104, 117, 110, 107, 115, 32, 115, 111, 32, 116, 104, 97, 116, 32, 116, 104, 101, 121, 32, 99, 97, 110, 39, 116, 32, 98, 101, 32, 71, 67, 39, 101, 100, 32, 116, 111, 111, 32, 115, 111, 111, 110, 46, 10, 32, 32, 32, 32, 99, 97, 108, 108, 98, 97, 99, 107, 40, 101, 114, 114, 44, 32, 119, 114, 105, 116, 116, 101, 110, 32, 124, 124, 32, 48, 44, 32, 99, 104, 117, 110, 107, 115, 41, 59, 10, 32, 32, 125, 10, 10, 32, 32, 99, 111, 110, 115, 116, 32, 114, 101, 113, 32, 61, 32, 110, 101, 119, 32, 70, 83, 82, 101, 113, 87, 114, 97, 112, 40, 41, 59, 10, 32, 32, 114, 101, 113, 46, 111, 110, 99, 111, 109, 112, 108, 101, 116, 101, 32, 61, 32, 119, 114, 97, 112, 112, 101, 114, 59, 10, 32, 32, 98, 105, 110, 100, 105, 110, 103, 46, 119, 114, 105, 116, 101, 66, 117, 102, 102, 101, 114, 115, 40, 102, 100, 44, 32, 99, 104, 117, 110, 107, 115, 44, 32, 112, 111, 115, 105, 116, 105, 111, 110, 44, 32, 114, 101, 113, 41, 59, 10, 125, 10, 10, 10, 87, 114, 105, 116, 101, 83, 116, 114, 101, 97, 109, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 95, 119, 114, 105, 116, 101, 118, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 100, 97, 116, 97, 44, 32, 99, 98, 41, 32, 123, 10, 32, 32, 105, 102, 32, 40, 116, 121, 112, 101, 111, 102, 32, 116, 104, 105, 115, 46, 102, 100, 32, 33, 61, 61, 32, 39, 110, 117, 109, 98, 101, 114, 39, 41, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 116, 104, 105, 115, 46, 111, 110, 99, 101, 40, 39, 111, 112, 101, 110, 39, 44, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 116, 104, 105, 115, 46, 95, 119, 114, 105, 116, 101, 118, 40, 100, 97, 116, 97, 44, 32, 99, 98, 41, 59, 10, 32, 32, 32, 32, 125, 41, 59, 10, 10, 32, 32, 99, 111, 110, 115, 116, 32, 115, 101, 108, 102, 32, 61, 32, 116, 104, 105, 115, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 108, 101, 110, 32, 61, 32, 100, 97, 116, 97, 46, 108, 101, 110, 103, 116, 104, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 99, 104, 117, 110, 107, 115, 32, 61, 32, 110, 101, 119, 32, 65, 114, 114, 97, 121, 40, 108, 101, 110, 41, 59, 10, 32, 32, 118, 97, 114, 32, 115, 105, 122, 101, 32, 61, 32, 48, 59, 10, 10, 32, 32, 102, 111, 114, 32, 40, 118, 97, 114, 32, 105, 32, 61, 32, 48, 59, 32, 105, 32, 60, 32, 108, 101, 110, 59, 32, 105, 43, 43, 41, 32, 123, 10, 32, 32, 32, 32, 118, 97, 114, 32, 99, 104, 117, 110, 107, 32, 61, 32, 100, 97, 116, 97, 91, 105, 93, 46, 99, 104, 117, 110, 107, 59, 10, 10, 32, 32, 32, 32, 99, 104, 117, 110, 107, 115, 91, 105, 93, 32, 61, 32, 99, 104, 117, 110, 107, 59, 10, 32, 32, 32, 32, 115, 105, 122, 101, 32, 43, 61, 32, 99, 104, 117, 110, 107, 46, 108, 101, 110, 103, 116, 104, 59, 10, 32, 32, 125, 10, 10, 32, 32, 119, 114, 105, 116, 101, 118, 40, 116, 104, 105, 115, 46, 102, 100, 44, 32, 99, 104, 117, 110, 107, 115, 44, 32, 116, 104, 105, 115, 46, 112, 111, 115, 44, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 101, 114, 44, 32, 98, 121, 116, 101, 115, 41, 32, 123, 10, 32, 32, 32, 32, 105, 102, 32, 40, 101, 114, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 115, 101, 108, 102, 46, 100, 101, 115, 116, 114, 111, 121, 40, 41, 59, 10, 32, 32, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 99, 98, 40, 101, 114, 41, 59, 10, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 115, 101, 108, 102, 46, 98, 121, 116, 101, 115, 87, 114, 105, 116, 116, 101, 110, 32, 43, 61, 32, 98, 121, 116, 101, 115, 59, 10, 32, 32, 32, 32, 99, 98, 40, 41, 59, 10, 32, 32, 125, 41, 59, 10, 10, 32, 32, 105, 102, 32, 40, 116, 104, 105, 115, 46, 112, 111, 115, 32, 33, 61, 61, 32, 117, 110, 100, 101, 102, 105, 110, 101, 100, 41, 10, 32, 32, 32, 32, 116, 104, 105, 115, 46, 112, 111, 115, 32, 43, 61, 32, 115, 105, 122, 101, 59, 10, 125, 59, 10, 10, 10, 87, 114, 105, 116, 101, 83, 116, 114, 101, 97, 109, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 100, 101, 115, 116, 114, 111, 121, 32, 61, 32, 82, 101, 97, 100, 83, 116, 114, 101, 97, 109, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 100, 101, 115, 116, 114, 111, 121, 59, 10, 87, 114, 105, 116, 101, 83, 116, 114, 101, 97, 109, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 99, 108, 111, 115, 101, 32, 61, 32, 82, 101, 97, 100, 83, 116, 114, 101, 97, 109, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 99, 108, 111, 115, 101, 59, 10, 10, 47, 47, 32, 84, 104, 101, 114, 101, 32, 105, 115, 32, 110, 111, 32, 115, 104, 117, 116, 100, 111, 119, 110, 40, 41, 32, 102, 111, 114, 32, 102, 105, 108, 101, 115, 46, 10, 87, 114, 105, 116, 101, 83, 116, 114, 101, 97, 109, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 100, 101, 115, 116, 114, 111, 121, 83, 111, 111, 110, 32, 61, 32, 87, 114, 105, 116, 101, 83, 116, 114, 101, 97, 109, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 101, 110, 100, 59, 10, 10, 10, 47, 47, 32, 83, 121, 110, 99, 87, 114, 105, 116, 101, 83, 116, 114, 101, 97, 109, 32, 105, 115, 32, 105, 110, 116, 101, 114, 110, 97, 108, 46, 32, 68, 79, 32, 78, 79, 84, 32, 85, 83, 69, 46, 10, 47, 47, 32, 84, 101, 109, 112, 111, 114, 97, 114, 121, 32, 104, 97, 99, 107, 32, 102, 111, 114, 32, 112, 114, 111, 99, 101, 115, 115, 46, 115, 116, 100, 111, 117, 116, 32, 97, 110, 100, 32, 112, 114, 111, 99, 101, 115, 115, 46, 115, 116, 100, 101, 114, 114, 32, 119, 104, 101, 110, 32, 112, 105, 112, 101, 100, 32, 116, 111, 32, 102, 105, 108, 101, 115, 46, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 83, 121, 110, 99, 87, 114, 105, 116, 101, 83, 116, 114, 101, 97, 109, 40, 102, 100, 44, 32, 111, 112, 116, 105, 111, 110, 115, 41, 32, 123, 10, 32, 32, 83, 116, 114, 101, 97, 109, 46, 99, 97, 108, 108, 40, 116, 104, 105, 115, 41, 59, 10, 10, 32, 32, 111, 112, 116, 105, 111, 110, 115, 32, 61, 32, 111, 112, 116, 105, 111, 110, 115, 32, 124, 124, 32, 123, 125, 59, 10, 10, 32, 32, 116, 104, 105, 115, 46, 102, 100, 32, 61, 32, 102, 100, 59, 10, 32, 32, 116, 104, 105, 115, 46, 119, 114, 105, 116, 97, 98, 108, 101, 32, 61, 32, 116, 114, 117, 101, 59, 10, 32, 32, 116, 104, 105, 115, 46, 114, 101, 97, 100, 97, 98, 108, 101, 32, 61, 32, 102, 97, 108, 115, 101, 59, 10, 32, 32, 116, 104, 105, 115, 46, 97, 117, 116, 111, 67, 108, 111, 115, 101, 32, 61, 32, 111, 112, 116, 105, 111, 110, 115, 46, 97, 117, 116, 111, 67, 108, 111, 115, 101, 32, 61, 61, 61, 32, 117, 110, 100, 101, 102, 105, 110, 101, 100, 32, 63, 32, 116, 114, 117, 101, 32, 58, 32, 111, 112, 116, 105, 111, 110, 115, 46, 97, 117, 116, 111, 67, 108, 111, 115, 101, 59, 10, 125, 10, 10, 47, 47, 117, 116, 105, 108, 46, 105, 110, 104, 101, 114, 105, 116, 115, 40, 83, 121, 110, 99, 87, 114, 105, 116, 101, 83, 116, 114, 101, 97, 109, 44, 32, 83, 116, 114, 101, 97, 109, 41, 59, 10, 10, 10, 47, 47, 32, 69, 120, 112, 111, 114, 116, 10, 79, 98, 106, 101, 99, 116, 46, 100, 101, 102, 105, 110, 101, 80, 114, 111, 112, 101, 114, 116, 121, 40, 102, 115, 44, 32, 39, 83, 121, 110, 99, 87, 114, 105, 116, 101, 83, 116, 114, 101, 97, 109, 39, 44, 32, 123, 10, 32, 32, 99, 111, 110, 102, 105, 103, 117, 114, 97, 98, 108, 101, 58, 32, 116, 114, 117, 101, 44, 10, 32, 32, 119, 114, 105, 116, 97, 98, 108, 101, 58, 32, 116, 114, 117, 101, 44, 10, 32, 32, 118, 97, 108, 117, 101, 58, 32, 83, 121, 110, 99, 87, 114, 105, 116, 101, 83, 116, 114, 101, 97, 109, 10, 125, 41, 59, 10, 10, 83, 121, 110, 99, 87, 114, 105, 116, 101, 83, 116, 114, 101, 97, 109, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 119, 114, 105, 116, 101, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 100, 97, 116, 97, 44, 32, 97, 114, 103, 49, 44, 32, 97, 114, 103, 50, 41, 32, 123, 10, 32, 32, 118, 97, 114, 32, 101, 110, 99, 111, 100, 105, 110, 103, 44, 32, 99, 98, 59, 10, 10, 32, 32, 47, 47, 32, 112, 97, 114, 115, 101, 32, 97, 114, 103, 117, 109, 101, 110, 116, 115, 10, 32, 32, 105, 102, 32, 40, 97, 114, 103, 49, 41, 32, 123, 10, 32, 32, 32, 32, 105, 102, 32, 40, 116, 121, 112, 101, 111, 102, 32, 97, 114, 103, 49, 32, 61, 61, 61, 32, 39, 115, 116, 114, 105, 110, 103, 39, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 101, 110, 99, 111, 100, 105, 110, 103, 32, 61, 32, 97, 114, 103, 49, 59, 10, 32, 32, 32, 32, 32, 32, 99, 98, 32, 61, 32, 97, 114, 103, 50, 59, 10, 32, 32, 32, 32, 125, 32, 101, 108, 115, 101, 32, 105, 102, 32, 40, 116, 121, 112, 101, 111, 102, 32, 97, 114, 103, 49, 32, 61, 61, 61, 32, 39, 102, 117, 110, 99, 116, 105, 111, 110, 39, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 99, 98, 32, 61, 32, 97, 114, 103, 49, 59, 10, 32, 32, 32, 32, 125, 32, 101, 108, 115, 101, 32, 123, 10, 32, 32, 32, 32, 32, 32, 116, 104, 114, 111, 119, 32, 110, 101, 119, 32, 69, 114, 114, 111, 114, 40, 39, 98, 97, 100, 32, 97, 114, 103, 39, 41, 59, 10, 32, 32, 32, 32, 125, 10, 32, 32, 125, 10, 32, 32, 97, 115, 115, 101, 114, 116, 69, 110, 99, 111, 100, 105, 110, 103, 40, 101, 110, 99, 111, 100, 105, 110, 103, 41, 59, 10, 10, 32, 32, 47, 47, 32, 67, 104, 97, 110, 103, 101, 32, 115, 116, 114, 105, 110, 103, 115, 32, 116, 111, 32, 98, 117, 102, 102, 101, 114, 115, 46, 32, 83, 76, 79, 87, 10, 32, 32, 105, 102, 32, 40, 116, 121, 112, 101, 111, 102, 32, 100, 97, 116, 97, 32, 61, 61, 61, 32, 39, 115, 116, 114, 105, 110, 103, 39, 41, 32, 123, 10, 32, 32, 32, 32, 100, 97, 116, 97, 32, 61, 32, 110, 101, 119, 32, 66, 117, 102, 102, 101, 114, 40, 100, 97, 116, 97, 44, 32, 101, 110, 99, 111, 100, 105, 110, 103, 41, 59, 10, 32, 32, 125, 10, 10, 32, 32, 102, 115, 46, 119, 114, 105, 116, 101, 83, 121, 110, 99, 40, 116, 104, 105, 115, 46, 102, 100, 44, 32, 100, 97, 116, 97, 44, 32, 48, 44, 32, 100, 97, 116, 97, 46, 108, 101, 110, 103, 116, 104, 41, 59, 10, 10, 32, 32, 105, 102, 32, 40, 99, 98, 41, 32, 123, 10, 32, 32, 32, 32, 112, 114, 111, 99, 101, 115, 115, 46, 110, 101, 120, 116, 84, 105, 99, 107, 40, 99, 98, 41, 59, 10, 32, 32, 125, 10, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 116, 114, 117, 101, 59, 10, 125, 59, 10, 10, 10, 83, 121, 110, 99, 87, 114, 105, 116, 101, 83, 116, 114, 101, 97, 109, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 101, 110, 100, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 100, 97, 116, 97, 44, 32, 97, 114, 103, 49, 44, 32, 97, 114, 103, 50, 41, 32, 123, 10, 32, 32, 105, 102, 32, 40, 100, 97, 116, 97, 41, 32, 123, 10, 32, 32, 32, 32, 116, 104, 105, 115, 46, 119, 114, 105, 116, 101, 40, 100, 97, 116, 97, 44, 32, 97, 114, 103, 49, 44, 32, 97, 114, 103, 50, 41, 59, 10, 32, 32, 125, 10, 32, 32, 116, 104, 105, 115, 46, 100, 101, 115, 116, 114, 111, 121, 40, 41, 59, 10, 125, 59, 10, 10, 10, 83, 121, 110, 99, 87, 114, 105, 116, 101, 83, 116, 114, 101, 97, 109, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 100, 101, 115, 116, 114, 111, 121, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 32, 123, 10, 32, 32, 105, 102, 32, 40, 116, 104, 105, 115, 46, 97, 117, 116, 111, 67, 108, 111, 115, 101, 41, 10, 32, 32, 32, 32, 102, 115, 46, 99, 108, 111, 115, 101, 83, 121, 110, 99, 40, 116, 104, 105, 115, 46, 102, 100, 41, 59, 10, 32, 32, 116, 104, 105, 115, 46, 102, 100, 32, 61, 32, 110, 117, 108, 108, 59, 10, 32, 32, 116, 104, 105, 115, 46, 101, 109, 105, 116, 40, 39, 99, 108, 111, 115, 101, 39, 41, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 116, 114, 117, 101, 59, 10, 125, 59, 10, 10, 83, 121, 110, 99, 87, 114, 105, 116, 101, 83, 116, 114, 101, 97, 109, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 100, 101, 115, 116, 114, 111, 121, 83, 111, 111, 110, 32, 61, 32, 83, 121, 110, 99, 87, 114, 105, 116, 101, 83, 116, 114, 101, 97, 109, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 100, 101, 115, 116, 114, 111, 121, 59, 10, 0 };
 
-  const cef_char_t module_native[] = { 47, 47, 32, 77, 79, 68, 73, 70, 73, 69, 68, 58, 32, 99, 104, 97, 110, 103, 101, 32, 115, 101, 97, 114, 99, 104, 105, 110, 103, 32, 112, 97, 116, 104, 32, 102, 111, 114, 32, 103, 108, 111, 98, 97, 108, 32, 109, 111, 100, 117, 108, 101, 115, 32, 35, 52, 53, 54, 10, 39, 117, 115, 101, 32, 115, 116, 114, 105, 99, 116, 39, 59, 10, 10, 99, 111, 110, 115, 116, 32, 78, 97, 116, 105, 118, 101, 77, 111, 100, 117, 108, 101, 32, 61, 32, 114, 101, 113, 117, 105, 114, 101, 40, 39, 110, 97, 116, 105, 118, 101, 95, 109, 111, 100, 117, 108, 101, 39, 41, 59, 10, 99, 111, 110, 115, 116, 32, 117, 116, 105, 108, 32, 61, 32, 114, 101, 113, 117, 105, 114, 101, 40, 39, 117, 116, 105, 108, 39, 41, 59, 10, 99, 111, 110, 115, 116, 32, 105, 110, 116, 101, 114, 110, 97, 108, 77, 111, 100, 117, 108, 101, 32, 61, 32, 114, 101, 113, 117, 105, 114, 101, 40, 39, 105, 110, 116, 101, 114, 110, 97, 108, 47, 109, 111, 100, 117, 108, 101, 39, 41, 59, 10, 99, 111, 110, 115, 116, 32, 105, 110, 116, 101, 114, 110, 97, 108, 85, 116, 105, 108, 32, 61, 32, 114, 101, 113, 117, 105, 114, 101, 40, 39, 105, 110, 116, 101, 114, 110, 97, 108, 47, 117, 116, 105, 108, 39, 41, 59, 10, 99, 111, 110, 115, 116, 32, 114, 117, 110, 73, 110, 84, 104, 105, 115, 67, 111, 110, 116, 101, 120, 116, 32, 61, 32, 114, 101, 113, 117, 105, 114, 101, 40, 39, 118, 109, 39, 41, 46, 114, 117, 110, 73, 110, 84, 104, 105, 115, 67, 111, 110, 116, 101, 120, 116, 59, 10, 99, 111, 110, 115, 116, 32, 97, 115, 115, 101, 114, 116, 32, 61, 32, 114, 101, 113, 117, 105, 114, 101, 40, 39, 97, 115, 115, 101, 114, 116, 39, 41, 46, 111, 107, 59, 10, 99, 111, 110, 115, 116, 32, 102, 115, 32, 61, 32, 114, 101, 113, 117, 105, 114, 101, 40, 39, 102, 115, 39, 41, 59, 10, 99, 111, 110, 115, 116, 32, 112, 97, 116, 104, 32, 61, 32, 114, 101, 113, 117, 105, 114, 101, 40, 39, 112, 97, 116, 104, 39, 41, 59, 10, 99, 111, 110, 115, 116, 32, 105, 110, 116, 101, 114, 110, 97, 108, 77, 111, 100, 117, 108, 101, 82, 101, 97, 100, 70, 105, 108, 101, 32, 61, 32, 112, 114, 111, 99, 101, 115, 115, 46, 98, 105, 110, 100, 105, 110, 103, 40, 39, 102, 115, 39, 41, 46, 105, 110, 116, 101, 114, 110, 97, 108, 77, 111, 100, 117, 108, 101, 82, 101, 97, 100, 70, 105, 108, 101, 59, 10, 99, 111, 110, 115, 116, 32, 105, 110, 116, 101, 114, 110, 97, 108, 77, 111, 100, 117, 108, 101, 83, 116, 97, 116, 32, 61, 32, 112, 114, 111, 99, 101, 115, 115, 46, 98, 105, 110, 100, 105, 110, 103, 40, 39, 102, 115, 39, 41, 46, 105, 110, 116, 101, 114, 110, 97, 108, 77, 111, 100, 117, 108, 101, 83, 116, 97, 116, 59, 10, 10, 99, 111, 110, 115, 116, 32, 115, 112, 108, 105, 116, 82, 101, 32, 61, 32, 112, 114, 111, 99, 101, 115, 115, 46, 112, 108, 97, 116, 102, 111, 114, 109, 32, 61, 61, 61, 32, 39, 119, 105, 110, 51, 50, 39, 32, 63, 32, 47, 91, 92, 47, 92, 92, 93, 47, 32, 58, 32, 47, 92, 47, 47, 59, 10, 99, 111, 110, 115, 116, 32, 105, 115, 73, 110, 100, 101, 120, 82, 101, 32, 61, 32, 47, 94, 105, 110, 100, 101, 120, 92, 46, 92, 119, 43, 63, 36, 47, 59, 10, 99, 111, 110, 115, 116, 32, 115, 104, 101, 98, 97, 110, 103, 82, 101, 32, 61, 32, 47, 94, 92, 35, 92, 33, 46, 42, 47, 59, 10, 10, 47, 47, 32, 73, 102, 32, 111, 98, 106, 46, 104, 97, 115, 79, 119, 110, 80, 114, 111, 112, 101, 114, 116, 121, 32, 104, 97, 115, 32, 98, 101, 101, 110, 32, 111, 118, 101, 114, 114, 105, 100, 100, 101, 110, 44, 32, 116, 104, 101, 110, 32, 99, 97, 108, 108, 105, 110, 103, 10, 47, 47, 32, 111, 98, 106, 46, 104, 97, 115, 79, 119, 110, 80, 114, 111, 112, 101, 114, 116, 121, 40, 112, 114, 111, 112, 41, 32, 119, 105, 108, 108, 32, 98, 114, 101, 97, 107, 46, 10, 47, 47, 32, 83, 101, 101, 58, 32, 104, 116, 116, 112, 115, 58, 47, 47, 103, 105, 116, 104, 117, 98, 46, 99, 111, 109, 47, 106, 111, 121, 101, 110, 116, 47, 110, 111, 100, 101, 47, 105, 115, 115, 117, 101, 115, 47, 49, 55, 48, 55, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 104, 97, 115, 79, 119, 110, 80, 114, 111, 112, 101, 114, 116, 121, 40, 111, 98, 106, 44, 32, 112, 114, 111, 112, 41, 32, 123, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 79, 98, 106, 101, 99, 116, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 104, 97, 115, 79, 119, 110, 80, 114, 111, 112, 101, 114, 116, 121, 46, 99, 97, 108, 108, 40, 111, 98, 106, 44, 32, 112, 114, 111, 112, 41, 59, 10, 125, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 77, 111, 100, 117, 108, 101, 40, 105, 100, 44, 32, 112, 97, 114, 101, 110, 116, 41, 32, 123, 10, 32, 32, 116, 104, 105, 115, 46, 105, 100, 32, 61, 32, 105, 100, 59, 10, 32, 32, 116, 104, 105, 115, 46, 101, 120, 112, 111, 114, 116, 115, 32, 61, 32, 123, 125, 59, 10, 32, 32, 116, 104, 105, 115, 46, 112, 97, 114, 101, 110, 116, 32, 61, 32, 112, 97, 114, 101, 110, 116, 59, 10, 32, 32, 105, 102, 32, 40, 112, 97, 114, 101, 110, 116, 32, 38, 38, 32, 112, 97, 114, 101, 110, 116, 46, 99, 104, 105, 108, 100, 114, 101, 110, 41, 32, 123, 10, 32, 32, 32, 32, 112, 97, 114, 101, 110, 116, 46, 99, 104, 105, 108, 100, 114, 101, 110, 46, 112, 117, 115, 104, 40, 116, 104, 105, 115, 41, 59, 10, 32, 32, 125, 10, 10, 32, 32, 116, 104, 105, 115, 46, 102, 105, 108, 101, 110, 97, 109, 101, 32, 61, 32, 110, 117, 108, 108, 59, 10, 32, 32, 116, 104, 105, 115, 46, 108, 111, 97, 100, 101, 100, 32, 61, 32, 102, 97, 108, 115, 101, 59, 10, 32, 32, 116, 104, 105, 115, 46, 99, 104, 105, 108, 100, 114, 101, 110, 32, 61, 32, 91, 93, 59, 10, 125, 10, 109, 111, 100, 117, 108, 101, 46, 101, 120, 112, 111, 114, 116, 115, 32, 61, 32, 77, 111, 100, 117, 108, 101, 59, 10, 10, 77, 111, 100, 117, 108, 101, 46, 95, 99, 97, 99, 104, 101, 32, 61, 32, 123, 125, 59, 10, 77, 111, 100, 117, 108, 101, 46, 95, 112, 97, 116, 104, 67, 97, 99, 104, 101, 32, 61, 32, 123, 125, 59, 10, 77, 111, 100, 117, 108, 101, 46, 95, 101, 120, 116, 101, 110, 115, 105, 111, 110, 115, 32, 61, 32, 123, 125, 59, 10, 118, 97, 114, 32, 109, 111, 100, 117, 108, 101, 80, 97, 116, 104, 115, 32, 61, 32, 91, 93, 59, 10, 77, 111, 100, 117, 108, 101, 46, 103, 108, 111, 98, 97, 108, 80, 97, 116, 104, 115, 32, 61, 32, 91, 93, 59, 10, 10, 77, 111, 100, 117, 108, 101, 46, 119, 114, 97, 112, 112, 101, 114, 32, 61, 32, 78, 97, 116, 105, 118, 101, 77, 111, 100, 117, 108, 101, 46, 119, 114, 97, 112, 112, 101, 114, 59, 10, 77, 111, 100, 117, 108, 101, 46, 119, 114, 97, 112, 32, 61, 32, 78, 97, 116, 105, 118, 101, 77, 111, 100, 117, 108, 101, 46, 119, 114, 97, 112, 59, 10, 77, 111, 100, 117, 108, 101, 46, 95, 100, 101, 98, 117, 103, 32, 61, 32, 117, 116, 105, 108, 46, 100, 101, 98, 117, 103, 108, 111, 103, 40, 39, 109, 111, 100, 117, 108, 101, 39, 41, 59, 10, 10, 47, 47, 32, 87, 101, 32, 117, 115, 101, 32, 116, 104, 105, 115, 32, 97, 108, 105, 97, 115, 32, 102, 111, 114, 32, 116, 104, 101, 32, 112, 114, 101, 112, 114, 111, 99, 101, 115, 115, 111, 114, 32, 116, 104, 97, 116, 32, 102, 105, 108, 116, 101, 114, 115, 32, 105, 116, 32, 111, 117, 116, 10, 99, 111, 110, 115, 116, 32, 100, 101, 98, 117, 103, 32, 61, 32, 77, 111, 100, 117, 108, 101, 46, 95, 100, 101, 98, 117, 103, 59, 10, 10, 10, 47, 47, 32, 103, 105, 118, 101, 110, 32, 97, 32, 109, 111, 100, 117, 108, 101, 32, 110, 97, 109, 101, 44, 32, 97, 110, 100, 32, 97, 32, 108, 105, 115, 116, 32, 111, 102, 32, 112, 97, 116, 104, 115, 32, 116, 111, 32, 116, 101, 115, 116, 44, 32, 114, 101, 116, 117, 114, 110, 115, 32, 116, 104, 101, 32, 102, 105, 114, 115, 116, 10, 47, 47, 32, 109, 97, 116, 99, 104, 105, 110, 103, 32, 102, 105, 108, 101, 32, 105, 110, 32, 116, 104, 101, 32, 102, 111, 108, 108, 111, 119, 105, 110, 103, 32, 112, 114, 101, 99, 101, 100, 101, 110, 99, 101, 46, 10, 47, 47, 10, 47, 47, 32, 114, 101, 113, 117, 105, 114, 101, 40, 34, 97, 46, 60, 101, 120, 116, 62, 34, 41, 10, 47, 47, 32, 32, 32, 45, 62, 32, 97, 46, 60, 101, 120, 116, 62, 10, 47, 47, 10, 47, 47, 32, 114, 101, 113, 117, 105, 114, 101, 40, 34, 97, 34, 41, 10, 47, 47, 32, 32, 32, 45, 62, 32, 97, 10, 47, 47, 32, 32, 32, 45, 62, 32, 97, 46, 60, 101, 120, 116, 62, 10, 47, 47, 32, 32, 32, 45, 62, 32, 97, 47, 105, 110, 100, 101, 120, 46, 60, 101, 120, 116, 62, 10, 10, 47, 47, 32, 99, 104, 101, 99, 107, 32, 105, 102, 32, 116, 104, 101, 32, 100, 105, 114, 101, 99, 116, 111, 114, 121, 32, 105, 115, 32, 97, 32, 112, 97, 99, 107, 97, 103, 101, 46, 106, 115, 111, 110, 32, 100, 105, 114, 10, 99, 111, 110, 115, 116, 32, 112, 97, 99, 107, 97, 103, 101, 77, 97, 105, 110, 67, 97, 99, 104, 101, 32, 61, 32, 123, 125, 59, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 114, 101, 97, 100, 80, 97, 99, 107, 97, 103, 101, 40, 114, 101, 113, 117, 101, 115, 116, 80, 97, 116, 104, 41, 32, 123, 10, 32, 32, 105, 102, 32, 40, 104, 97, 115, 79, 119, 110, 80, 114, 111, 112, 101, 114, 116, 121, 40, 112, 97, 99, 107, 97, 103, 101, 77, 97, 105, 110, 67, 97, 99, 104, 101, 44, 32, 114, 101, 113, 117, 101, 115, 116, 80, 97, 116, 104, 41, 41, 32, 123, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 112, 97, 99, 107, 97, 103, 101, 77, 97, 105, 110, 67, 97, 99, 104, 101, 91, 114, 101, 113, 117, 101, 115, 116, 80, 97, 116, 104, 93, 59, 10, 32, 32, 125, 10, 10, 32, 32, 118, 97, 114, 32, 106, 115, 111, 110, 80, 97, 116, 104, 32, 61, 32, 112, 97, 116, 104, 46, 114, 101, 115, 111, 108, 118, 101, 40, 114, 101, 113, 117, 101, 115, 116, 80, 97, 116, 104, 44, 32, 39, 112, 97, 99, 107, 97, 103, 101, 46, 106, 115, 111, 110, 39, 41, 59, 10, 32, 32, 118, 97, 114, 32, 106, 115, 111, 110, 32, 61, 32, 105, 110, 116, 101, 114, 110, 97, 108, 77, 111, 100, 117, 108, 101, 82, 101, 97, 100, 70, 105, 108, 101, 40, 112, 97, 116, 104, 46, 95, 109, 97, 107, 101, 76, 111, 110, 103, 40, 106, 115, 111, 110, 80, 97, 116, 104, 41, 41, 59, 10, 10, 32, 32, 105, 102, 32, 40, 106, 115, 111, 110, 32, 61, 61, 61, 32, 117, 110, 100, 101, 102, 105, 110, 101, 100, 41, 32, 123, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 102, 97, 108, 115, 101, 59, 10, 32, 32, 125, 10, 10, 32, 32, 116, 114, 121, 32, 123, 10, 32, 32, 32, 32, 118, 97, 114, 32, 112, 107, 103, 32, 61, 32, 112, 97, 99, 107, 97, 103, 101, 77, 97, 105, 110, 67, 97, 99, 104, 101, 91, 114, 101, 113, 117, 101, 115, 116, 80, 97, 116, 104, 93, 32, 61, 32, 74, 83, 79, 78, 46, 112, 97, 114, 115, 101, 40, 106, 115, 111, 110, 41, 46, 109, 97, 105, 110, 59, 10, 32, 32, 125, 32, 99, 97, 116, 99, 104, 32, 40, 101, 41, 32, 123, 10, 32, 32, 32, 32, 101, 46, 112, 97, 116, 104, 32, 61, 32, 106, 115, 111, 110, 80, 97, 116, 104, 59, 10, 32, 32, 32, 32, 101, 46, 109, 101, 115, 115, 97, 103, 101, 32, 61, 32, 39, 69, 114, 114, 111, 114, 32, 112, 97, 114, 115, 105, 110, 103, 32, 39, 32, 43, 32, 106, 115, 111, 110, 80, 97, 116, 104, 32, 43, 32, 39, 58, 32, 39, 32, 43, 32, 101, 46, 109, 101, 115, 115, 97, 103, 101, 59, 10, 32, 32, 32, 32, 116, 104, 114, 111, 119, 32, 101, 59, 10, 32, 32, 125, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 112, 107, 103, 59, 10, 125, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 116, 114, 121, 80, 97, 99, 107, 97, 103, 101, 40, 114, 101, 113, 117, 101, 115, 116, 80, 97, 116, 104, 44, 32, 101, 120, 116, 115, 41, 32, 123, 10, 32, 32, 118, 97, 114, 32, 112, 107, 103, 32, 61, 32, 114, 101, 97, 100, 80, 97, 99, 107, 97, 103, 101, 40, 114, 101, 113, 117, 101, 115, 116, 80, 97, 116, 104, 41, 59, 10, 10, 32, 32, 105, 102, 32, 40, 33, 112, 107, 103, 41, 32, 114, 101, 116, 117, 114, 110, 32, 102, 97, 108, 115, 101, 59, 10, 10, 32, 32, 118, 97, 114, 32, 102, 105, 108, 101, 110, 97, 109, 101, 32, 61, 32, 112, 97, 116, 104, 46, 114, 101, 115, 111, 108, 118, 101, 40, 114, 101, 113, 117, 101, 115, 116, 80, 97, 116, 104, 44, 32, 112, 107, 103, 41, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 116, 114, 121, 70, 105, 108, 101, 40, 102, 105, 108, 101, 110, 97, 109, 101, 41, 32, 124, 124, 32, 116, 114, 121, 69, 120, 116, 101, 110, 115, 105, 111, 110, 115, 40, 102, 105, 108, 101, 110, 97, 109, 101, 44, 32, 101, 120, 116, 115, 41, 32, 124, 124, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 116, 114, 121, 69, 120, 116, 101, 110, 115, 105, 111, 110, 115, 40, 112, 97, 116, 104, 46, 114, 101, 115, 111, 108, 118, 101, 40, 102, 105, 108, 101, 110, 97, 109, 101, 44, 32, 39, 105, 110, 100, 101, 120, 39, 41, 44, 32, 101, 120, 116, 115, 41, 59, 10, 125, 10, 10, 47, 47, 32, 73, 110, 32, 111, 114, 100, 101, 114, 32, 116, 111, 32, 109, 105, 110, 105, 109, 105, 122, 101, 32, 117, 110, 110, 101, 99, 101, 115, 115, 97, 114, 121, 32, 108, 115, 116, 97, 116, 40, 41, 32, 99, 97, 108, 108, 115, 44, 10, 47, 47, 32, 116, 104, 105, 115, 32, 99, 97, 99, 104, 101, 32, 105, 115, 32, 97, 32, 108, 105, 115, 116, 32, 111, 102, 32, 107, 110, 111, 119, 110, 45, 114, 101, 97, 108, 32, 112, 97, 116, 104, 115, 46, 10, 47, 47, 32, 83, 101, 116, 32, 116, 111, 32, 97, 110, 32, 101, 109, 112, 116, 121, 32, 111, 98, 106, 101, 99, 116, 32, 116, 111, 32, 114, 101, 115, 101, 116, 46, 10, 77, 111, 100, 117, 108, 101, 46, 95, 114, 101, 97, 108, 112, 97, 116, 104, 67, 97, 99, 104, 101, 32, 61, 32, 123, 125, 59, 10, 10, 47, 47, 32, 99, 104, 101, 99, 107, 32, 105, 102, 32, 116, 104, 101, 32, 102, 105, 108, 101, 32, 101, 120, 105, 115, 116, 115, 32, 97, 110, 100, 32, 105, 115, 32, 110, 111, 116, 32, 97, 32, 100, 105, 114, 101, 99, 116, 111, 114, 121, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 116, 114, 121, 70, 105, 108, 101, 40, 114, 101, 113, 117, 101, 115, 116, 80, 97, 116, 104, 41, 32, 123, 10, 32, 32, 99, 111, 110, 115, 116, 32, 114, 99, 32, 61, 32, 105, 110, 116, 101, 114, 110, 97, 108, 77, 111, 100, 117, 108, 101, 83, 116, 97, 116, 40, 112, 97, 116, 104, 46, 95, 109, 97, 107, 101, 76, 111, 110, 103, 40, 114, 101, 113, 117, 101, 115, 116, 80, 97, 116, 104, 41, 41, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 114, 99, 32, 61, 61, 61, 32, 48, 32, 38, 38, 32, 116, 111, 82, 101, 97, 108, 80, 97, 116, 104, 40, 114, 101, 113, 117, 101, 115, 116, 80, 97, 116, 104, 41, 59, 10, 125, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 116, 111, 82, 101, 97, 108, 80, 97, 116, 104, 40, 114, 101, 113, 117, 101, 115, 116, 80, 97, 116, 104, 41, 32, 123, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 102, 115, 46, 114, 101, 97, 108, 112, 97, 116, 104, 83, 121, 110, 99, 40, 114, 101, 113, 117, 101, 115, 116, 80, 97, 116, 104, 44, 32, 77, 111, 100, 117, 108, 101, 46, 95, 114, 101, 97, 108, 112, 97, 116, 104, 67, 97, 99, 104, 101, 41, 59, 10, 125, 10, 10, 47, 47, 32, 103, 105, 118, 101, 110, 32, 97, 32, 112, 97, 116, 104, 32, 99, 104, 101, 99, 107, 32, 97, 32, 116, 104, 101, 32, 102, 105, 108, 101, 32, 101, 120, 105, 115, 116, 115, 32, 119, 105, 116, 104, 32, 97, 110, 121, 32, 111, 102, 32, 116, 104, 101, 32, 115, 101, 116, 32, 101, 120, 116, 101, 110, 115, 105, 111, 110, 115, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 116, 114, 121, 69, 120, 116, 101, 110, 115, 105, 111, 110, 115, 40, 112, 44, 32, 101, 120, 116, 115, 41, 32, 123, 10, 32, 32, 102, 111, 114, 32, 40, 118, 97, 114, 32, 105, 32, 61, 32, 48, 44, 32, 69, 76, 32, 61, 32, 101, 120, 116, 115, 46, 108, 101, 110, 103, 116, 104, 59, 32, 105, 32, 60, 32, 69, 76, 59, 32, 105, 43, 43, 41, 32, 123, 10, 32, 32, 32, 32, 118, 97, 114, 32, 102, 105, 108, 101, 110, 97, 109, 101, 32, 61, 32, 116, 114, 121, 70, 105, 108, 101, 40, 112, 32, 43, 32, 101, 120, 116, 115, 91, 105, 93, 41, 59, 10, 10, 32, 32, 32, 32, 105, 102, 32, 40, 102, 105, 108, 101, 110, 97, 109, 101, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 102, 105, 108, 101, 110, 97, 109, 101, 59, 10, 32, 32, 32, 32, 125, 10, 32, 32, 125, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 102, 97, 108, 115, 101, 59, 10, 125, 10, 10, 118, 97, 114, 32, 119, 97, 114, 110, 101, 100, 32, 61, 32, 102, 97, 108, 115, 101, 59, 10, 77, 111, 100, 117, 108, 101, 46, 95, 102, 105, 110, 100, 80, 97, 116, 104, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 114, 101, 113, 117, 101, 115, 116, 44, 32, 112, 97, 116, 104, 115, 41, 32, 123, 10, 32, 32, 105, 102, 32, 40, 112, 97, 116, 104, 46, 105, 115, 65, 98, 115, 111, 108, 117, 116, 101, 40, 114, 101, 113, 117, 101, 115, 116, 41, 41, 32, 123, 10, 32, 32, 32, 32, 112, 97, 116, 104, 115, 32, 61, 32, 91, 39, 39, 93, 59, 10, 32, 32, 125, 10, 10, 32, 32, 118, 97, 114, 32, 99, 97, 99, 104, 101, 75, 101, 121, 32, 61, 32, 74, 83, 79, 78, 46, 115, 116, 114, 105, 110, 103, 105, 102, 121, 40, 123, 114, 101, 113, 117, 101, 115, 116, 58, 32, 114, 101, 113, 117, 101, 115, 116, 44, 32, 112, 97, 116, 104, 115, 58, 32, 112, 97, 116, 104, 115, 125, 41, 59, 10, 32, 32, 105, 102, 32, 40, 77, 111, 100, 117, 108, 101, 46, 95, 112, 97, 116, 104, 67, 97, 99, 104, 101, 91, 99, 97, 99, 104, 101, 75, 101, 121, 93, 41, 32, 123, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 77, 111, 100, 117, 108, 101, 46, 95, 112, 97, 116, 104, 67, 97, 99, 104, 101, 91, 99, 97, 99, 104, 101, 75, 101, 121, 93, 59, 10, 32, 32, 125, 10, 10, 32, 32, 99, 111, 110, 115, 116, 32, 101, 120, 116, 115, 32, 61, 32, 79, 98, 106, 101, 99, 116, 46, 107, 101, 121, 115, 40, 77, 111, 100, 117, 108, 101, 46, 95, 101, 120, 116, 101, 110, 115, 105, 111, 110, 115, 41, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 116, 114, 97, 105, 108, 105, 110, 103, 83, 108, 97, 115, 104, 32, 61, 32, 114, 101, 113, 117, 101, 115, 116, 46, 115, 108, 105, 99, 101, 40, 45, 49, 41, 32, 61, 61, 61, 32, 39, 47, 39, 59, 10, 10, 32, 32, 47, 47, 32, 70, 111, 114, 32, 101, 97, 99, 104, 32, 112, 97, 116, 104, 10, 32, 32, 102, 111, 114, 32, 40, 118, 97, 114, 32, 105, 32, 61, 32, 48, 44, 32, 80, 76, 32, 61, 32, 112, 97, 116, 104, 115, 46, 108, 101, 110, 103, 116, 104, 59, 32, 105, 32, 60, 32, 80, 76, 59, 32, 105, 43, 43, 41, 32, 123, 10, 32, 32, 32, 32, 47, 47, 32, 68, 111, 110, 39, 116, 32, 115, 101, 97, 114, 99, 104, 32, 102, 117, 114, 116, 104, 101, 114, 32, 105, 102, 32, 112, 97, 116, 104, 32, 100, 111, 101, 115, 110, 39, 116, 32, 101, 120, 105, 115, 116, 10, 32, 32, 32, 32, 105, 102, 32, 40, 112, 97, 116, 104, 115, 91, 105, 93, 32, 38, 38, 32, 105, 110, 116, 101, 114, 110, 97, 108, 77, 111, 100, 117, 108, 101, 83, 116, 97, 116, 40, 112, 97, 116, 104, 46, 95, 109, 97, 107, 101, 76, 111, 110, 103, 40, 112, 97, 116, 104, 115, 91, 105, 93, 41, 41, 32, 60, 32, 49, 41, 32, 99, 111, 110, 116, 105, 110, 117, 101, 59, 10, 32, 32, 32, 32, 118, 97, 114, 32, 98, 97, 115, 101, 80, 97, 116, 104, 32, 61, 32, 112, 97, 116, 104, 46, 114, 101, 115, 111, 108, 118, 101, 40, 112, 97, 116, 104, 115, 91, 105, 93, 44, 32, 114, 101, 113, 117, 101, 115, 116, 41, 59, 10, 32, 32, 32, 32, 118, 97, 114, 32, 102, 105, 108, 101, 110, 97, 109, 101, 59, 10, 10, 32, 32, 32, 32, 105, 102, 32, 40, 33, 116, 114, 97, 105, 108, 105, 110, 103, 83, 108, 97, 115, 104, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 114, 99, 32, 61, 32, 105, 110, 116, 101, 114, 110, 97, 108, 77, 111, 100, 117, 108, 101, 83, 116, 97, 116, 40, 112, 97, 116, 104, 46, 95, 109, 97, 107, 101, 76, 111, 110, 103, 40, 98, 97, 115, 101, 80, 97, 116, 104, 41, 41, 59, 10, 32, 32, 32, 32, 32, 32, 105, 102, 32, 40, 114, 99, 32, 61, 61, 61, 32, 48, 41, 32, 123, 32, 32, 47, 47, 32, 70, 105, 108, 101, 46, 10, 32, 32, 32, 32, 32, 32, 32, 32, 102, 105, 108, 101, 110, 97, 109, 101, 32, 61, 32, 116, 111, 82, 101, 97, 108, 80, 97, 116, 104, 40, 98, 97, 115, 101, 80, 97, 116, 104, 41, 59, 10, 32, 32, 32, 32, 32, 32, 125, 32, 101, 108, 115, 101, 32, 105, 102, 32, 40, 114, 99, 32, 61, 61, 61, 32, 49, 41, 32, 123, 32, 32, 47, 47, 32, 68, 105, 114, 101, 99, 116, 111, 114, 121, 46, 10, 32, 32, 32, 32, 32, 32, 32, 32, 102, 105, 108, 101, 110, 97, 109, 101, 32, 61, 32, 116, 114, 121, 80, 97, 99, 107, 97, 103, 101, 40, 98, 97, 115, 101, 80, 97, 116, 104, 44, 32, 101, 120, 116, 115, 41, 59, 10, 32, 32, 32, 32, 32, 32, 125, 10, 10, 32, 32, 32, 32, 32, 32, 105, 102, 32, 40, 33, 102, 105, 108, 101, 110, 97, 109, 101, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 47, 47, 32, 116, 114, 121, 32, 105, 116, 32, 119, 105, 116, 104, 32, 101, 97, 99, 104, 32, 111, 102, 32, 116, 104, 101, 32, 101, 120, 116, 101, 110, 115, 105, 111, 110, 115, 10, 32, 32, 32, 32, 32, 32, 32, 32, 102, 105, 108, 101, 110, 97, 109, 101, 32, 61, 32, 116, 114, 121, 69, 120, 116, 101, 110, 115, 105, 111, 110, 115, 40, 98, 97, 115, 101, 80, 97, 116, 104, 44, 32, 101, 120, 116, 115, 41, 59, 10, 32, 32, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 125, 10, 10, 32, 32, 32, 32, 105, 102, 32, 40, 33, 102, 105, 108, 101, 110, 97, 109, 101, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 102, 105, 108, 101, 110, 97, 109, 101, 32, 61, 32, 116, 114, 121, 80, 97, 99, 107, 97, 103, 101, 40, 98, 97, 115, 101, 80, 97, 116, 104, 44, 32, 101, 120, 116, 115, 41, 59, 10, 32, 32, 32, 32, 125, 10, 10, 32, 32, 32, 32, 105, 102, 32, 40, 33, 102, 105, 108, 101, 110, 97, 109, 101, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 47, 47, 32, 116, 114, 121, 32, 105, 116, 32, 119, 105, 116, 104, 32, 101, 97, 99, 104, 32, 111, 102, 32, 116, 104, 101, 32, 101, 120, 116, 101, 110, 115, 105, 111, 110, 115, 32, 97, 116, 32, 34, 105, 110, 100, 101, 120, 34, 10, 32, 32, 32, 32, 32, 32, 102, 105, 108, 101, 110, 97, 109, 101, 32, 61, 32, 116, 114, 121, 69, 120, 116, 101, 110, 115, 105, 111, 110, 115, 40, 112, 97, 116, 104, 46, 114, 101, 115, 111, 108, 118, 101, 40, 98, 97, 115, 101, 80, 97, 116, 104, 44, 32, 39, 105, 110, 100, 101, 120, 39, 41, 44, 32, 101, 120, 116, 115, 41, 59, 10, 32, 32, 32, 32, 125, 10, 10, 32, 32, 32, 32, 105, 102, 32, 40, 102, 105, 108, 101, 110, 97, 109, 101, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 47, 47, 32, 87, 97, 114, 110, 32, 111, 110, 99, 101, 32, 105, 102, 32, 39, 46, 39, 32, 114, 101, 115, 111, 108, 118, 101, 100, 32, 111, 117, 116, 115, 105, 100, 101, 32, 116, 104, 101, 32, 109, 111, 100, 117, 108, 101, 32, 100, 105, 114, 10, 32, 32, 32, 32, 32, 32, 105, 102, 32, 40, 114, 101, 113, 117, 101, 115, 116, 32, 61, 61, 61, 32, 39, 46, 39, 32, 38, 38, 32, 105, 32, 62, 32, 48, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 119, 97, 114, 110, 101, 100, 32, 61, 32, 105, 110, 116, 101, 114, 110, 97, 108, 85, 116, 105, 108, 46, 112, 114, 105, 110, 116, 68, 101, 112, 114, 101, 99, 97, 116, 105, 111, 110, 77, 101, 115, 115, 97, 103, 101, 40, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 39, 119, 97, 114, 110, 105, 110, 103, 58, 32, 114, 101, 113, 117, 105, 114, 101, 40, 92, 39, 46, 92, 39, 41, 32, 114, 101, 115, 111, 108, 118, 101, 100, 32, 111, 117, 116, 115, 105, 100, 101, 32, 116, 104, 101, 32, 112, 97, 99, 107, 97, 103, 101, 32, 39, 32, 43, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 39, 100, 105, 114, 101, 99, 116, 111, 114, 121, 46, 32, 84, 104, 105, 115, 32, 102, 117, 110, 99, 116, 105, 111, 110, 97, 108, 105, 116, 121, 32, 105, 115, 32, 100, 101, 112, 114, 101, 99, 97, 116, 101, 100, 32, 97, 110, 100, 32, 119, 105, 108, 108, 32, 98, 101, 32, 114, 101, 109, 111, 118, 101, 100, 32, 39, 32, 43, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 39, 115, 111, 111, 110, 46, 39, 44, 32, 119, 97, 114, 110, 101, 100, 41, 59, 10, 32, 32, 32, 32, 32, 32, 125, 10, 10, 32, 32, 32, 32, 32, 32, 77, 111, 100, 117, 108, 101, 46, 95, 112, 97, 116, 104, 67, 97, 99, 104, 101, 91, 99, 97, 99, 104, 101, 75, 101, 121, 93, 32, 61, 32, 102, 105, 108, 101, 110, 97, 109, 101, 59, 10, 32, 32, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 102, 105, 108, 101, 110, 97, 109, 101, 59, 10, 32, 32, 32, 32, 125, 10, 32, 32, 125, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 102, 97, 108, 115, 101, 59, 10, 125, 59, 10, 10, 47, 47, 32, 39, 102, 114, 111, 109, 39, 32, 105, 115, 32, 116, 104, 101, 32, 95, 95, 100, 105, 114, 110, 97, 109, 101, 32, 111, 102, 32, 116, 104, 101, 32, 109, 111, 100, 117, 108, 101, 46, 10, 77, 111, 100, 117, 108, 101, 46, 95, 110, 111, 100, 101, 77, 111, 100, 117, 108, 101, 80, 97, 116, 104, 115, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 102, 114, 111, 109, 41, 32, 123, 10, 32, 32, 47, 47, 32, 103, 117, 97, 114, 97, 110, 116, 101, 101, 32, 116, 104, 97, 116, 32, 39, 102, 114, 111, 109, 39, 32, 105, 115, 32, 97, 98, 115, 111, 108, 117, 116, 101, 46, 10, 32, 32, 102, 114, 111, 109, 32, 61, 32, 112, 97, 116, 104, 46, 114, 101, 115, 111, 108, 118, 101, 40, 102, 114, 111, 109, 41, 59, 10, 10, 32, 32, 47, 47, 32, 110, 111, 116, 101, 58, 32, 116, 104, 105, 115, 32, 97, 112, 112, 114, 111, 97, 99, 104, 32, 42, 111, 110, 108, 121, 42, 32, 119, 111, 114, 107, 115, 32, 119, 104, 101, 110, 32, 116, 104, 101, 32, 112, 97, 116, 104, 32, 105, 115, 32, 103, 117, 97, 114, 97, 110, 116, 101, 101, 100, 10, 32, 32, 47, 47, 32, 116, 111, 32, 98, 101, 32, 97, 98, 115, 111, 108, 117, 116, 101, 46, 32, 32, 68, 111, 105, 110, 103, 32, 97, 32, 102, 117, 108, 108, 121, 45, 101, 100, 103, 101, 45, 99, 97, 115, 101, 45, 99, 111, 114, 114, 101, 99, 116, 32, 112, 97, 116, 104, 46, 115, 112, 108, 105, 116, 10, 32, 32, 47, 47, 32, 116, 104, 97, 116, 32, 119, 111, 114, 107, 115, 32, 111, 110, 32, 98, 111, 116, 104, 32, 87, 105, 110, 100, 111, 119, 115, 32, 97, 110, 100, 32, 80, 111, 115, 105, 120, 32, 105, 115, 32, 110, 111, 110, 45, 116, 114, 105, 118, 105, 97, 108, 46, 10, 32, 32, 118, 97, 114, 32, 112, 97, 116, 104, 115, 32, 61, 32, 91, 93, 59, 10, 32, 32, 118, 97, 114, 32, 112, 97, 114, 116, 115, 32, 61, 32, 102, 114, 111, 109, 46, 115, 112, 108, 105, 116, 40, 115, 112, 108, 105, 116, 82, 101, 41, 59, 10, 10, 32, 32, 102, 111, 114, 32, 40, 118, 97, 114, 32, 116, 105, 112, 32, 61, 32, 112, 97, 114, 116, 115, 46, 108, 101, 110, 103, 116, 104, 32, 45, 32, 49, 59, 32, 116, 105, 112, 32, 62, 61, 32, 48, 59, 32, 116, 105, 112, 45, 45, 41, 32, 123, 10, 32, 32, 32, 32, 47, 47, 32, 100, 111, 110, 39, 116, 32, 115, 101, 97, 114, 99, 104, 32, 105, 110, 32, 46, 46, 46, 47, 110, 111, 100, 101, 95, 109, 111, 100, 117, 108, 101, 115, 47, 110, 111, 100, 101, 95, 109, 111, 100, 117, 108, 101, 115, 10, 32, 32, 32, 32, 105, 102, 32, 40, 112, 97, 114, 116, 115, 91, 116, 105, 112, 93, 32, 61, 61, 61, 32, 39, 110, 111, 100, 101, 95, 109, 111, 100, 117, 108, 101, 115, 39, 41, 32, 99, 111, 110, 116, 105, 110, 117, 101, 59, 10, 32, 32, 32, 32, 118, 97, 114, 32, 100, 105, 114, 32, 61, 32, 112, 97, 114, 116, 115, 46, 115, 108, 105, 99, 101, 40, 48, 44, 32, 116, 105, 112, 32, 43, 32, 49, 41, 46, 99, 111, 110, 99, 97, 116, 40, 39, 110, 111, 100, 101, 95, 109, 111, 100, 117, 108, 101, 115, 39, 41, 46, 106, 111, 105, 110, 40, 112, 97, 116, 104, 46, 115, 101, 112, 41, 59, 10, 32, 32, 32, 32, 112, 97, 116, 104, 115, 46, 112, 117, 115, 104, 40, 100, 105, 114, 41, 59, 10, 32, 32, 125, 10, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 112, 97, 116, 104, 115, 59, 10, 125, 59, 10, 10, 10, 77, 111, 100, 117, 108, 101, 46, 95, 114, 101, 115, 111, 108, 118, 101, 76, 111, 111, 107, 117, 112, 80, 97, 116, 104, 115, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 114, 101, 113, 117, 101, 115, 116, 44, 32, 112, 97, 114, 101, 110, 116, 41, 32, 123, 10, 32, 32, 105, 102, 32, 40, 78, 97, 116, 105, 118, 101, 77, 111, 100, 117, 108, 101, 46, 110, 111, 110, 73, 110, 116, 101, 114, 110, 97, 108, 69, 120, 105, 115, 116, 115, 40, 114, 101, 113, 117, 101, 115, 116, 41, 41, 32, 123, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 91, 114, 101, 113, 117, 101, 115, 116, 44, 32, 91, 93, 93, 59, 10, 32, 32, 125, 10, 10, 32, 32, 118, 97, 114, 32, 115, 116, 97, 114, 116, 32, 61, 32, 114, 101, 113, 117, 101, 115, 116, 46, 115, 117, 98, 115, 116, 114, 105, 110, 103, 40, 48, 44, 32, 50, 41, 59, 10, 32, 32, 105, 102, 32, 40, 115, 116, 97, 114, 116, 32, 33, 61, 61, 32, 39, 46, 47, 39, 32, 38, 38, 32, 115, 116, 97, 114, 116, 32, 33, 61, 61, 32, 39, 46, 46, 39, 41, 32, 123, 10, 32, 32, 32, 32, 118, 97, 114, 32, 112, 97, 116, 104, 115, 32, 61, 32, 109, 111, 100, 117, 108, 101, 80, 97, 116, 104, 115, 59, 10, 32, 32, 32, 32, 105, 102, 32, 40, 112, 97, 114, 101, 110, 116, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 105, 102, 32, 40, 33, 112, 97, 114, 101, 110, 116, 46, 112, 97, 116, 104, 115, 41, 32, 112, 97, 114, 101, 110, 116, 46, 112, 97, 116, 104, 115, 32, 61, 32, 91, 93, 59, 10, 32, 32, 32, 32, 32, 32, 112, 97, 116, 104, 115, 32, 61, 32, 112, 97, 114, 101, 110, 116, 46, 112, 97, 116, 104, 115, 46, 99, 111, 110, 99, 97, 116, 40, 112, 97, 116, 104, 115, 41, 59, 10, 32, 32, 32, 32, 125, 10, 10, 32, 32, 32, 32, 47, 47, 32, 77, 97, 105, 110, 116, 97, 105, 110, 32, 98, 97, 99, 107, 119, 97, 114, 100, 115, 32, 99, 111, 109, 112, 97, 116, 32, 119, 105, 116, 104, 32, 99, 101, 114, 116, 97, 105, 110, 32, 98, 114, 111, 107, 101, 110, 32, 117, 115, 101, 115, 32, 111, 102, 32, 114, 101, 113, 117, 105, 114, 101, 40, 39, 46, 39, 41, 10, 32, 32, 32, 32, 47, 47, 32, 98, 121, 32, 112, 117, 116, 116, 105, 110, 103, 32, 116, 104, 101, 32, 109, 111, 100, 117, 108, 101, 39, 115, 32, 100, 105, 114, 101, 99, 116, 111, 114, 121, 32, 105, 110, 32, 102, 114, 111, 110, 116, 32, 111, 102, 32, 116, 104, 101, 32, 108, 111, 111, 107, 117, 112, 32, 112, 97, 116, 104, 115, 46, 10, 32, 32, 32, 32, 105, 102, 32, 40, 114, 101, 113, 117, 101, 115, 116, 32, 61, 61, 61, 32, 39, 46, 39, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 105, 102, 32, 40, 112, 97, 114, 101, 110, 116, 32, 38, 38, 32, 112, 97, 114, 101, 110, 116, 46, 102, 105, 108, 101, 110, 97, 109, 101, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 112, 97, 116, 104, 115, 46, 115, 112, 108, 105, 99, 101, 40, 48, 44, 32, 48, 44, 32, 112, 97, 116, 104, 46, 100, 105, 114, 110, 97, 109, 101, 40, 112, 97, 114, 101, 110, 116, 46, 102, 105, 108, 101, 110, 97, 109, 101, 41, 41, 59, 10, 32, 32, 32, 32, 32, 32, 125, 32, 101, 108, 115, 101, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 112, 97, 116, 104, 115, 46, 115, 112, 108, 105, 99, 101, 40, 48, 44, 32, 48, 44, 32, 112, 97, 116, 104, 46, 114, 101, 115, 111, 108, 118, 101, 40, 114, 101, 113, 117, 101, 115, 116, 41, 41, 59, 10, 32, 32, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 125, 10, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 91, 114, 101, 113, 117, 101, 115, 116, 44, 32, 112, 97, 116, 104, 115, 93, 59, 10, 32, 32, 125, 10, 10, 32, 32, 47, 47, 32, 119, 105, 116, 104, 32, 45, 45, 101, 118, 97, 108, 44, 32, 112, 97, 114, 101, 110, 116, 46, 105, 100, 32, 105, 115, 32, 110, 111, 116, 32, 115, 101, 116, 32, 97, 110, 100, 32, 112, 97, 114, 101, 110, 116, 46, 102, 105, 108, 101, 110, 97, 109, 101, 32, 105, 115, 32, 110, 117, 108, 108, 10, 32, 32, 105, 102, 32, 40, 33, 112, 97, 114, 101, 110, 116, 32, 124, 124, 32, 33, 112, 97, 114, 101, 110, 116, 46, 105, 100, 32, 124, 124, 32, 33, 112, 97, 114, 101, 110, 116, 46, 102, 105, 108, 101, 110, 97, 109, 101, 41, 32, 123, 10, 32, 32, 32, 32, 47, 47, 32, 109, 97, 107, 101, 32, 114, 101, 113, 117, 105, 114, 101, 40, 39, 46, 47, 112, 97, 116, 104, 47, 116, 111, 47, 102, 111, 111, 39, 41, 32, 119, 111, 114, 107, 32, 45, 32, 110, 111, 114, 109, 97, 108, 108, 121, 32, 116, 104, 101, 32, 112, 97, 116, 104, 32, 105, 115, 32, 116, 97, 107, 101, 110, 10, 32, 32, 32, 32, 47, 47, 32, 102, 114, 111, 109, 32, 114, 101, 97, 108, 112, 97, 116, 104, 40, 95, 95, 102, 105, 108, 101, 110, 97, 109, 101, 41, 32, 98, 117, 116, 32, 119, 105, 116, 104, 32, 101, 118, 97, 108, 32, 116, 104, 101, 114, 101, 32, 105, 115, 32, 110, 111, 32, 102, 105, 108, 101, 110, 97, 109, 101, 10, 32, 32, 32, 32, 118, 97, 114, 32, 109, 97, 105, 110, 80, 97, 116, 104, 115, 32, 61, 32, 91, 39, 46, 39, 93, 46, 99, 111, 110, 99, 97, 116, 40, 109, 111, 100, 117, 108, 101, 80, 97, 116, 104, 115, 41, 59, 10, 32, 32, 32, 32, 109, 97, 105, 110, 80, 97, 116, 104, 115, 32, 61, 32, 77, 111, 100, 117, 108, 101, 46, 95, 110, 111, 100, 101, 77, 111, 100, 117, 108, 101, 80, 97, 116, 104, 115, 40, 39, 46, 39, 41, 46, 99, 111, 110, 99, 97, 116, 40, 109, 97, 105, 110, 80, 97, 116, 104, 115, 41, 59, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 91, 114, 101, 113, 117, 101, 115, 116, 44, 32, 109, 97, 105, 110, 80, 97, 116, 104, 115, 93, 59, 10, 32, 32, 125, 10, 10, 32, 32, 47, 47, 32, 73, 115, 32, 116, 104, 101, 32, 112, 97, 114, 101, 110, 116, 32, 97, 110, 32, 105, 110, 100, 101, 120, 32, 109, 111, 100, 117, 108, 101, 63, 10, 32, 32, 47, 47, 32, 87, 101, 32, 99, 97, 110, 32, 97, 115, 115, 117, 109, 101, 32, 116, 104, 101, 32, 112, 97, 114, 101, 110, 116, 32, 104, 97, 115, 32, 97, 32, 118, 97, 108, 105, 100, 32, 101, 120, 116, 101, 110, 115, 105, 111, 110, 44, 10, 32, 32, 47, 47, 32, 97, 115, 32, 105, 116, 32, 97, 108, 114, 101, 97, 100, 121, 32, 104, 97, 115, 32, 98, 101, 101, 110, 32, 97, 99, 99, 101, 112, 116, 101, 100, 32, 97, 115, 32, 97, 32, 109, 111, 100, 117, 108, 101, 46, 10, 32, 32, 118, 97, 114, 32, 105, 115, 73, 110, 100, 101, 120, 32, 61, 32, 105, 115, 73, 110, 100, 101, 120, 82, 101, 46, 116, 101, 115, 116, 40, 112, 97, 116, 104, 46, 98, 97, 115, 101, 110, 97, 109, 101, 40, 112, 97, 114, 101, 110, 116, 46, 102, 105, 108, 101, 110, 97, 109, 101, 41, 41, 59, 10, 32, 32, 118, 97, 114, 32, 112, 97, 114, 101, 110, 116, 73, 100, 80, 97, 116, 104, 32, 61, 32, 105, 115, 73, 110, 100, 101, 120, 32, 63, 32, 112, 97, 114, 101, 110, 116, 46, 105, 100, 32, 58, 32, 112, 97, 116, 104, 46, 100, 105, 114, 110, 97, 109, 101, 40, 112, 97, 114, 101, 110, 116, 46, 105, 100, 41, 59, 10, 32, 32, 118, 97, 114, 32, 105, 100, 32, 61, 32, 112, 97, 116, 104, 46, 114, 101, 115, 111, 108, 118, 101, 40, 112, 97, 114, 101, 110, 116, 73, 100, 80, 97, 116, 104, 44, 32, 114, 101, 113, 117, 101, 115, 116, 41, 59, 10, 10, 32, 32, 47, 47, 32, 109, 97, 107, 101, 32, 115, 117, 114, 101, 32, 114, 101, 113, 117, 105, 114, 101, 40, 39, 46, 47, 112, 97, 116, 104, 39, 41, 32, 97, 110, 100, 32, 114, 101, 113, 117, 105, 114, 101, 40, 39, 112, 97, 116, 104, 39, 41, 32, 103, 101, 116, 32, 100, 105, 115, 116, 105, 110, 99, 116, 32, 105, 100, 115, 44, 32, 101, 118, 101, 110, 10, 32, 32, 47, 47, 32, 119, 104, 101, 110, 32, 99, 97, 108, 108, 101, 100, 32, 102, 114, 111, 109, 32, 116, 104, 101, 32, 116, 111, 112, 108, 101, 118, 101, 108, 32, 106, 115, 32, 102, 105, 108, 101, 10, 32, 32, 105, 102, 32, 40, 112, 97, 114, 101, 110, 116, 73, 100, 80, 97, 116, 104, 32, 61, 61, 61, 32, 39, 46, 39, 32, 38, 38, 32, 105, 100, 46, 105, 110, 100, 101, 120, 79, 102, 40, 39, 47, 39, 41, 32, 61, 61, 61, 32, 45, 49, 41, 32, 123, 10, 32, 32, 32, 32, 105, 100, 32, 61, 32, 39, 46, 47, 39, 32, 43, 32, 105, 100, 59, 10, 32, 32, 125, 10, 10, 32, 32, 100, 101, 98, 117, 103, 40, 39, 82, 69, 76, 65, 84, 73, 86, 69, 58, 32, 114, 101, 113, 117, 101, 115, 116, 101, 100, 58, 32, 37, 115, 32, 115, 101, 116, 32, 73, 68, 32, 116, 111, 58, 32, 37, 115, 32, 102, 114, 111, 109, 32, 37, 115, 39, 44, 32, 114, 101, 113, 117, 101, 115, 116, 44, 32, 105, 100, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 112, 97, 114, 101, 110, 116, 46, 105, 100, 41, 59, 10, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 91, 105, 100, 44, 32, 91, 112, 97, 116, 104, 46, 100, 105, 114, 110, 97, 109, 101, 40, 112, 97, 114, 101, 110, 116, 46, 102, 105, 108, 101, 110, 97, 109, 101, 41, 93, 93, 59, 10, 125, 59, 10, 10, 10, 47, 47, 32, 67, 104, 101, 99, 107, 32, 116, 104, 101, 32, 99, 97, 99, 104, 101, 32, 102, 111, 114, 32, 116, 104, 101, 32, 114, 101, 113, 117, 101, 115, 116, 101, 100, 32, 102, 105, 108, 101, 46, 10, 47, 47, 32, 49, 46, 32, 73, 102, 32, 97, 32, 109, 111, 100, 117, 108, 101, 32, 97, 108, 114, 101, 97, 100, 121, 32, 101, 120, 105, 115, 116, 115, 32, 105, 110, 32, 116, 104, 101, 32, 99, 97, 99, 104, 101, 58, 32, 114, 101, 116, 117, 114, 110, 32, 105, 116, 115, 32, 101, 120, 112, 111, 114, 116, 115, 32, 111, 98, 106, 101, 99, 116, 46, 10, 47, 47, 32, 50, 46, 32, 73, 102, 32, 116, 104, 101, 32, 109, 111, 100, 117, 108, 101, 32, 105, 115, 32, 110, 97, 116, 105, 118, 101, 58, 32, 99, 97, 108, 108, 32, 96, 78, 97, 116, 105, 118, 101, 77, 111, 100, 117, 108, 101, 46, 114, 101, 113, 117, 105, 114, 101, 40, 41, 96, 32, 119, 105, 116, 104, 32, 116, 104, 101, 10, 47, 47, 32, 32, 32, 32, 102, 105, 108, 101, 110, 97, 109, 101, 32, 97, 110, 100, 32, 114, 101, 116, 117, 114, 110, 32, 116, 104, 101, 32, 114, 101, 115, 117, 108, 116, 46, 10, 47, 47, 32, 51, 46, 32, 79, 116, 104, 101, 114, 119, 105, 115, 101, 44, 32, 99, 114, 101, 97, 116, 101, 32, 97, 32, 110, 101, 119, 32, 109, 111, 100, 117, 108, 101, 32, 102, 111, 114, 32, 116, 104, 101, 32, 102, 105, 108, 101, 32, 97, 110, 100, 32, 115, 97, 118, 101, 32, 105, 116, 32, 116, 111, 32, 116, 104, 101, 32, 99, 97, 99, 104, 101, 46, 10, 47, 47, 32, 32, 32, 32, 84, 104, 101, 110, 32, 104, 97, 118, 101, 32, 105, 116, 32, 108, 111, 97, 100, 32, 32, 116, 104, 101, 32, 102, 105, 108, 101, 32, 99, 111, 110, 116, 101, 110, 116, 115, 32, 98, 101, 102, 111, 114, 101, 32, 114, 101, 116, 117, 114, 110, 105, 110, 103, 32, 105, 116, 115, 32, 101, 120, 112, 111, 114, 116, 115, 10, 47, 47, 32, 32, 32, 32, 111, 98, 106, 101, 99, 116, 46, 10, 77, 111, 100, 117, 108, 101, 46, 95, 108, 111, 97, 100, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 114, 101, 113, 117, 101, 115, 116, 44, 32, 112, 97, 114, 101, 110, 116, 44, 32, 105, 115, 77, 97, 105, 110, 41, 32, 123, 10, 32, 32, 105, 102, 32, 40, 112, 97, 114, 101, 110, 116, 41, 32, 123, 10, 32, 32, 32, 32, 100, 101, 98, 117, 103, 40, 39, 77, 111, 100, 117, 108, 101, 46, 95, 108, 111, 97, 100, 32, 82, 69, 81, 85, 69, 83, 84, 32, 37, 115, 32, 112, 97, 114, 101, 110, 116, 58, 32, 37, 115, 39, 44, 32, 114, 101, 113, 117, 101, 115, 116, 44, 32, 112, 97, 114, 101, 110, 116, 46, 105, 100, 41, 59, 10, 32, 32, 125, 10, 10, 32, 32, 118, 97, 114, 32, 102, 105, 108, 101, 110, 97, 109, 101, 32, 61, 32, 77, 111, 100, 117, 108, 101, 46, 95, 114, 101, 115, 111, 108, 118, 101, 70, 105, 108, 101, 110, 97, 109, 101, 40, 114, 101, 113, 117, 101, 115, 116, 44, 32, 112, 97, 114, 101, 110, 116, 41, 59, 10, 10, 32, 32, 118, 97, 114, 32, 99, 97, 99, 104, 101, 100, 77, 111, 100, 117, 108, 101, 32, 61, 32, 77, 111, 100, 117, 108, 101, 46, 95, 99, 97, 99, 104, 101, 91, 102, 105, 108, 101, 110, 97, 109, 101, 93, 59, 10, 32, 32, 105, 102, 32, 40, 99, 97, 99, 104, 101, 100, 77, 111, 100, 117, 108, 101, 41, 32, 123, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 99, 97, 99, 104, 101, 100, 77, 111, 100, 117, 108, 101, 46, 101, 120, 112, 111, 114, 116, 115, 59, 10, 32, 32, 125, 10, 10, 32, 32, 105, 102, 32, 40, 78, 97, 116, 105, 118, 101, 77, 111, 100, 117, 108, 101, 46, 110, 111, 110, 73, 110, 116, 101, 114, 110, 97, 108, 69, 120, 105, 115, 116, 115, 40, 102, 105, 108, 101, 110, 97, 109, 101, 41, 41, 32, 123, 10, 32, 32, 32, 32, 100, 101, 98, 117, 103, 40, 39, 108, 111, 97, 100, 32, 110, 97, 116, 105, 118, 101, 32, 109, 111, 100, 117, 108, 101, 32, 37, 115, 39, 44, 32, 114, 101, 113, 117, 101, 115, 116, 41, 59, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 78, 97, 116, 105, 118, 101, 77, 111, 100, 117, 108, 101, 46, 114, 101, 113, 117, 105, 114, 101, 40, 102, 105, 108, 101, 110, 97, 109, 101, 41, 59, 10, 32, 32, 125, 10, 10, 32, 32, 118, 97, 114, 32, 109, 111, 100, 117, 108, 101, 32, 61, 32, 110, 101, 119, 32, 77, 111, 100, 117, 108, 101, 40, 102, 105, 108, 101, 110, 97, 109, 101, 44, 32, 112, 97, 114, 101, 110, 116, 41, 59, 10, 10, 32, 32, 105, 102, 32, 40, 105, 115, 77, 97, 105, 110, 41, 32, 123, 10, 32, 32, 32, 32, 112, 114, 111, 99, 101, 115, 115, 46, 109, 97, 105, 110, 77, 111, 100, 117, 108, 101, 32, 61, 32, 109, 111, 100, 117, 108, 101, 59, 10, 32, 32, 32, 32, 109, 111, 100, 117, 108, 101, 46, 105, 100, 32, 61, 32, 39, 46, 39, 59, 10, 32, 32, 125, 10, 10, 32, 32, 77, 111, 100, 117, 108, 101, 46, 95, 99, 97, 99, 104, 101, 91, 102, 105, 108, 101, 110, 97, 109, 101, 93, 32, 61, 32, 109, 111, 100, 117, 108, 101, 59, 10, 10, 32, 32, 118, 97, 114, 32, 104, 97, 100, 69, 120, 99, 101, 112, 116, 105, 111, 110, 32, 61, 32, 116, 114, 117, 101, 59, 10, 10, 32, 32, 116, 114, 121, 32, 123, 10, 32, 32, 32, 32, 109, 111, 100, 117, 108, 101, 46, 108, 111, 97, 100, 40, 102, 105, 108, 101, 110, 97, 109, 101, 41, 59, 10, 32, 32, 32, 32, 104, 97, 100, 69, 120, 99, 101, 112, 116, 105, 111, 110, 32, 61, 32, 102, 97, 108, 115, 101, 59, 10, 32, 32, 125, 32, 102, 105, 110, 97, 108, 108, 121, 32, 123, 10, 32, 32, 32, 32, 105, 102, 32, 40, 104, 97, 100, 69, 120, 99, 101, 112, 116, 105, 111, 110, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 100, 101, 108, 101, 116, 101, 32, 77, 111, 100, 117, 108, 101, 46, 95, 99, 97, 99, 104, 101, 91, 102, 105, 108, 101, 110, 97, 109, 101, 93, 59, 10, 32, 32, 32, 32, 125, 10, 32, 32, 125, 10, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 109, 111, 100, 117, 108, 101, 46, 101, 120, 112, 111, 114, 116, 115, 59, 10, 125, 59, 10, 10, 77, 111, 100, 117, 108, 101, 46, 95, 114, 101, 115, 111, 108, 118, 101, 70, 105, 108, 101, 110, 97, 109, 101, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 114, 101, 113, 117, 101, 115, 116, 44, 32, 112, 97, 114, 101, 110, 116, 41, 32, 123, 10, 32, 32, 105, 102, 32, 40, 78, 97, 116, 105, 118, 101, 77, 111, 100, 117, 108, 101, 46, 110, 111, 110, 73, 110, 116, 101, 114, 110, 97, 108, 69, 120, 105, 115, 116, 115, 40, 114, 101, 113, 117, 101, 115, 116, 41, 41, 32, 123, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 114, 101, 113, 117, 101, 115, 116, 59, 10, 32, 32, 125, 10, 10, 32, 32, 118, 97, 114, 32, 114, 101, 115, 111, 108, 118, 101, 100, 77, 111, 100, 117, 108, 101, 32, 61, 32, 77, 111, 100, 117, 108, 101, 46, 95, 114, 101, 115, 111, 108, 118, 101, 76, 111, 111, 107, 117, 112, 80, 97, 116, 104, 115, 40, 114, 101, 113, 117, 101, 115, 116, 44, 32, 112, 97, 114, 101, 110, 116, 41, 59, 10, 32, 32, 118, 97, 114, 32, 105, 100, 32, 61, 32, 114, 101, 115, 111, 108, 118, 101, 100, 77, 111, 100, 117, 108, 101, 91, 48, 93, 59, 10, 32, 32, 118, 97, 114, 32, 112, 97, 116, 104, 115, 32, 61, 32, 114, 101, 115, 111, 108, 118, 101, 100, 77, 111, 100, 117, 108, 101, 91, 49, 93, 59, 10, 10, 32, 32, 47, 47, 32, 108, 111, 111, 107, 32, 117, 112, 32, 116, 104, 101, 32, 102, 105, 108, 101, 110, 97, 109, 101, 32, 102, 105, 114, 115, 116, 44, 32, 115, 105, 110, 99, 101, 32, 116, 104, 97, 116, 39, 115, 32, 116, 104, 101, 32, 99, 97, 99, 104, 101, 32, 107, 101, 121, 46, 10, 32, 32, 100, 101, 98, 117, 103, 40, 39, 108, 111, 111, 107, 105, 110, 103, 32, 102, 111, 114, 32, 37, 106, 32, 105, 110, 32, 37, 106, 39, 44, 32, 105, 100, 44, 32, 112, 97, 116, 104, 115, 41, 59, 10, 10, 32, 32, 118, 97, 114, 32, 102, 105, 108, 101, 110, 97, 109, 101, 32, 61, 32, 77, 111, 100, 117, 108, 101, 46, 95, 102, 105, 110, 100, 80, 97, 116, 104, 40, 114, 101, 113, 117, 101, 115, 116, 44, 32, 112, 97, 116, 104, 115, 41, 59, 10, 32, 32, 105, 102, 32, 40, 33, 102, 105, 108, 101, 110, 97, 109, 101, 41, 32, 123, 10, 32, 32, 32, 32, 118, 97, 114, 32, 101, 114, 114, 32, 61, 32, 110, 101, 119, 32, 69, 114, 114, 111, 114, 40, 34, 67, 97, 110, 110, 111, 116, 32, 102, 105, 110, 100, 32, 109, 111, 100, 117, 108, 101, 32, 39, 34, 32, 43, 32, 114, 101, 113, 117, 101, 115, 116, 32, 43, 32, 34, 39, 34, 41, 59, 10, 32, 32, 32, 32, 101, 114, 114, 46, 99, 111, 100, 101, 32, 61, 32, 39, 77, 79, 68, 85, 76, 69, 95, 78, 79, 84, 95, 70, 79, 85, 78, 68, 39, 59, 10, 32, 32, 32, 32, 116, 104, 114, 111, 119, 32, 101, 114, 114, 59, 10, 32, 32, 125, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 102, 105, 108, 101, 110, 97, 109, 101, 59, 10, 125, 59, 10, 10, 10, 47, 47, 32, 71, 105, 118, 101, 110, 32, 97, 32, 102, 105, 108, 101, 32, 110, 97, 109, 101, 44, 32, 112, 97, 115, 115, 32, 105, 116, 32, 116, 111, 32, 116, 104, 101, 32, 112, 114, 111, 112, 101, 114, 32, 101, 120, 116, 101, 110, 115, 105, 111, 110, 32, 104, 97, 110, 100, 108, 101, 114, 46, 10, 77, 111, 100, 117, 108, 101, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 108, 111, 97, 100, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 102, 105, 108, 101, 110, 97, 109, 101, 41, 32, 123, 10, 32, 32, 100, 101, 98, 117, 103, 40, 39, 108, 111, 97, 100, 32, 37, 106, 32, 102, 111, 114, 32, 109, 111, 100, 117, 108, 101, 32, 37, 106, 39, 44, 32, 102, 105, 108, 101, 110, 97, 109, 101, 44, 32, 116, 104, 105, 115, 46, 105, 100, 41, 59, 10, 10, 32, 32, 97, 115, 115, 101, 114, 116, 40, 33, 116, 104, 105, 115, 46, 108, 111, 97, 100, 101, 100, 41, 59, 10, 32, 32, 116, 104, 105, 115, 46, 102, 105, 108, 101, 110, 97, 109, 101, 32, 61, 32, 102, 105, 108, 101, 110, 97, 109, 101, 59, 10, 32, 32, 116, 104, 105, 115, 46, 112, 97, 116, 104, 115, 32, 61, 32, 77, 111, 100, 117, 108, 101, 46, 95, 110, 111, 100, 101, 77, 111, 100, 117, 108, 101, 80, 97, 116, 104, 115, 40, 112, 97, 116, 104, 46, 100, 105, 114, 110, 97, 109, 101, 40, 102, 105, 108, 101, 110, 97, 109, 101, 41, 41, 59, 10, 10, 32, 32, 118, 97, 114, 32, 101, 120, 116, 101, 110, 115, 105, 111, 110, 32, 61, 32, 112, 97, 116, 104, 46, 101, 120, 116, 110, 97, 109, 101, 40, 102, 105, 108, 101, 110, 97, 109, 101, 41, 32, 124, 124, 32, 39, 46, 106, 115, 39, 59, 10, 32, 32, 105, 102, 32, 40, 33, 77, 111, 100, 117, 108, 101, 46, 95, 101, 120, 116, 101, 110, 115, 105, 111, 110, 115, 91, 101, 120, 116, 101, 110, 115, 105, 111, 110, 93, 41, 32, 101, 120, 116, 101, 110, 115, 105, 111, 110, 32, 61, 32, 39, 46, 106, 115, 39, 59, 10, 32, 32, 77, 111, 100, 117, 108, 101, 46, 95, 101, 120, 116, 101, 110, 115, 105, 111, 110, 115, 91, 101, 120, 116, 101, 110, 115, 105, 111, 110, 93, 40, 116, 104, 105, 115, 44, 32, 102, 105, 108, 101, 110, 97, 109, 101, 41, 59, 10, 32, 32, 116, 104, 105, 115, 46, 108, 111, 97, 100, 101, 100, 32, 61, 32, 116, 114, 117, 101, 59, 10, 125, 59, 10, 10, 10, 47, 47, 32, 76, 111, 97, 100, 115, 32, 97, 32, 109, 111, 100, 117, 108, 101, 32, 97, 116, 32, 116, 104, 101, 32, 103, 105, 118, 101, 110, 32, 102, 105, 108, 101, 32, 112, 97, 116, 104, 46, 32, 82, 101, 116, 117, 114, 110, 115, 32, 116, 104, 97, 116, 32, 109, 111, 100, 117, 108, 101, 39, 115, 10, 47, 47, 32, 96, 101, 120, 112, 111, 114, 116, 115, 96, 32, 112, 114, 111, 112, 101, 114, 116, 121, 46, 10, 77, 111, 100, 117, 108, 101, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 114, 101, 113, 117, 105, 114, 101, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 112, 97, 116, 104, 41, 32, 123, 10, 32, 32, 97, 115, 115, 101, 114, 116, 40, 112, 97, 116, 104, 44, 32, 39, 109, 105, 115, 115, 105, 110, 103, 32, 112, 97, 116, 104, 39, 41, 59, 10, 32, 32, 97, 115, 115, 101, 114, 116, 40, 116, 121, 112, 101, 111, 102, 32, 112, 97, 116, 104, 32, 61, 61, 61, 32, 39, 115, 116, 114, 105, 110, 103, 39, 44, 32, 39, 112, 97, 116, 104, 32, 109, 117, 115, 116, 32, 98, 101, 32, 97, 32, 115, 116, 114, 105, 110, 103, 39, 41, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 77, 111, 100, 117, 108, 101, 46, 95, 108, 111, 97, 100, 40, 112, 97, 116, 104, 44, 32, 116, 104, 105, 115, 41, 59, 10, 125, 59, 10, 10, 10, 47, 47, 32, 82, 101, 115, 111, 108, 118, 101, 100, 32, 112, 97, 116, 104, 32, 116, 111, 32, 112, 114, 111, 99, 101, 115, 115, 46, 97, 114, 103, 118, 91, 49, 93, 32, 119, 105, 108, 108, 32, 98, 101, 32, 108, 97, 122, 105, 108, 121, 32, 112, 108, 97, 99, 101, 100, 32, 104, 101, 114, 101, 10, 47, 47, 32, 40, 110, 101, 101, 100, 101, 100, 32, 102, 111, 114, 32, 115, 101, 116, 116, 105, 110, 103, 32, 98, 114, 101, 97, 107, 112, 111, 105, 110, 116, 32, 119, 104, 101, 110, 32, 99, 97, 108, 108, 101, 100, 32, 119, 105, 116, 104, 32, 45, 45, 100, 101, 98, 117, 103, 45, 98, 114, 107, 41, 10, 118, 97, 114, 32, 114, 101, 115, 111, 108, 118, 101, 100, 65, 114, 103, 118, 59, 10, 10, 10, 47, 47, 32, 82, 117, 110, 32, 116, 104, 101, 32, 102, 105, 108, 101, 32, 99, 111, 110, 116, 101, 110, 116, 115, 32, 105, 110, 32, 116, 104, 101, 32, 99, 111, 114, 114, 101, 99, 116, 32, 115, 99, 111, 112, 101, 32, 111, 114, 32, 115, 97, 110, 100, 98, 111, 120, 46, 32, 69, 120, 112, 111, 115, 101, 10, 47, 47, 32, 116, 104, 101, 32, 99, 111, 114, 114, 101, 99, 116, 32, 104, 101, 108, 112, 101, 114, 32, 118, 97, 114, 105, 97, 98, 108, 101, 115, 32, 40, 114, 101, 113, 117, 105, 114, 101, 44, 32, 109, 111, 100, 117, 108, 101, 44, 32, 101, 120, 112, 111, 114, 116, 115, 41, 32, 116, 111, 10, 47, 47, 32, 116, 104, 101, 32, 102, 105, 108, 101, 46, 10, 47, 47, 32, 82, 101, 116, 117, 114, 110, 115, 32, 101, 120, 99, 101, 112, 116, 105, 111, 110, 44, 32, 105, 102, 32, 97, 110, 121, 46, 10, 77, 111, 100, 117, 108, 101, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 95, 99, 111, 109, 112, 105, 108, 101, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 99, 111, 110, 116, 101, 110, 116, 44, 32, 102, 105, 108, 101, 110, 97, 109, 101, 41, 32, 123, 10, 32, 32, 47, 47, 32, 114, 101, 109, 111, 118, 101, 32, 115, 104, 101, 98, 97, 110, 103, 10, 32, 32, 99, 111, 110, 116, 101, 110, 116, 32, 61, 32, 99, 111, 110, 116, 101, 110, 116, 46, 114, 101, 112, 108, 97, 99, 101, 40, 115, 104, 101, 98, 97, 110, 103, 82, 101, 44, 32, 39, 39, 41, 59, 10, 10, 32, 32, 47, 47, 32, 99, 114, 101, 97, 116, 101, 32, 119, 114, 97, 112, 112, 101, 114, 32, 102, 117, 110, 99, 116, 105, 111, 110, 10, 32, 32, 118, 97, 114, 32, 119, 114, 97, 112, 112, 101, 114, 32, 61, 32, 77, 111, 100, 117, 108, 101, 46, 119, 114, 97, 112, 40, 99, 111, 110, 116, 101, 110, 116, 41, 59, 10, 10, 32, 32, 118, 97, 114, 32, 99, 111, 109, 112, 105, 108, 101, 100, 87, 114, 97, 112, 112, 101, 114, 32, 61, 32, 114, 117, 110, 73, 110, 84, 104, 105, 115, 67, 111, 110, 116, 101, 120, 116, 40, 119, 114, 97, 112, 112, 101, 114, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 32, 102, 105, 108, 101, 110, 97, 109, 101, 58, 32, 102, 105, 108, 101, 110, 97, 109, 101, 44, 32, 108, 105, 110, 101, 79, 102, 102, 115, 101, 116, 58, 32, 48, 32, 125, 41, 59, 10, 32, 32, 105, 102, 32, 40, 103, 108, 111, 98, 97, 108, 46, 118, 56, 100, 101, 98, 117, 103, 41, 32, 123, 10, 32, 32, 32, 32, 105, 102, 32, 40, 33, 114, 101, 115, 111, 108, 118, 101, 100, 65, 114, 103, 118, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 47, 47, 32, 119, 101, 32, 101, 110, 116, 101, 114, 32, 116, 104, 101, 32, 114, 101, 112, 108, 32, 105, 102, 32, 119, 101, 39, 114, 101, 32, 110, 111, 116, 32, 103, 105, 118, 101, 110, 32, 97, 32, 102, 105, 108, 101, 110, 97, 109, 101, 32, 97, 114, 103, 117, 109, 101, 110, 116, 46, 10, 32, 32, 32, 32, 32, 32, 105, 102, 32, 40, 112, 114, 111, 99, 101, 115, 115, 46, 97, 114, 103, 118, 91, 49, 93, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 114, 101, 115, 111, 108, 118, 101, 100, 65, 114, 103, 118, 32, 61, 32, 77, 111, 100, 117, 108, 101, 46, 95, 114, 101, 115, 111, 108, 118, 101, 70, 105, 108, 101, 110, 97, 109, 101, 40, 112, 114, 111, 99, 101, 115, 115, 46, 97, 114, 103, 118, 91, 49, 93, 44, 32, 110, 117, 108, 108, 41, 59, 10, 32, 32, 32, 32, 32, 32, 125, 32, 101, 108, 115, 101, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 114, 101, 115, 111, 108, 118, 101, 100, 65, 114, 103, 118, 32, 61, 32, 39, 114, 101, 112, 108, 39, 59, 10, 32, 32, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 125, 10, 10, 32, 32, 32, 32, 47, 47, 32, 83, 101, 116, 32, 98, 114, 101, 97, 107, 112, 111, 105, 110, 116, 32, 111, 110, 32, 109, 111, 100, 117, 108, 101, 32, 115, 116, 97, 114, 116, 10, 32, 32, 32, 32, 105, 102, 32, 40, 102, 105, 108, 101, 110, 97, 109, 101, 32, 61, 61, 61, 32, 114, 101, 115, 111, 108, 118, 101, 100, 65, 114, 103, 118, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 47, 47, 32, 73, 110, 115, 116, 97, 108, 108, 105, 110, 103, 32, 116, 104, 105, 115, 32, 100, 117, 109, 109, 121, 32, 100, 101, 98, 117, 103, 32, 101, 118, 101, 110, 116, 32, 108, 105, 115, 116, 101, 110, 101, 114, 32, 116, 101, 108, 108, 115, 32, 86, 56, 32, 116, 111, 32, 115, 116, 97, 114, 116, 10, 32, 32, 32, 32, 32, 32, 47, 47, 32, 116, 104, 101, 32, 100, 101, 98, 117, 103, 103, 101, 114, 46, 32, 32, 87, 105, 116, 104, 111, 117, 116, 32, 105, 116, 44, 32, 116, 104, 101, 32, 115, 101, 116, 66, 114, 101, 97, 107, 80, 111, 105, 110, 116, 40, 41, 32, 102, 97, 105, 108, 115, 32, 119, 105, 116, 104, 32, 97, 110, 10, 32, 32, 32, 32, 32, 32, 47, 47, 32, 39, 105, 108, 108, 101, 103, 97, 108, 32, 97, 99, 99, 101, 115, 115, 39, 32, 101, 114, 114, 111, 114, 46, 10, 32, 32, 32, 32, 32, 32, 103, 108, 111, 98, 97, 108, 46, 118, 56, 100, 101, 98, 117, 103, 46, 68, 101, 98, 117, 103, 46, 115, 101, 116, 76, 105, 115, 116, 101, 110, 101, 114, 40, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 32, 123, 125, 41, 59, 10, 32, 32, 32, 32, 32, 32, 103, 108, 111, 98, 97, 108, 46, 118, 56, 100, 101, 98, 117, 103, 46, 68, 101, 98, 117, 103, 46, 115, 101, 116, 66, 114, 101, 97, 107, 80, 111, 105, 110, 116, 40, 99, 111, 109, 112, 105, 108, 101, 100, 87, 114, 97, 112, 112, 101, 114, 44, 32, 48, 44, 32, 48, 41, 59, 10, 32, 32, 32, 32, 125, 10, 32, 32, 125, 10, 32, 32, 99, 111, 110, 115, 116, 32, 100, 105, 114, 110, 97, 109, 101, 32, 61, 32, 112, 97, 116, 104, 46, 100, 105, 114, 110, 97, 109, 101, 40, 102, 105, 108, 101, 110, 97, 109, 101, 41, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 114, 101, 113, 117, 105, 114, 101, 32, 61, 32, 105, 110, 116, 101, 114, 110, 97, 108, 77, 111, 100, 117, 108, 101, 46, 109, 97, 107, 101, 82, 101, 113, 117, 105, 114, 101, 70, 117, 110, 99, 116, 105, 111, 110, 46, 99, 97, 108, 108, 40, 116, 104, 105, 115, 41, 59, 10, 10, 32, 32, 79, 98, 106, 101, 99, 116, 46, 100, 101, 102, 105, 110, 101, 80, 114, 111, 112, 101, 114, 116, 121, 40, 114, 101, 113, 117, 105, 114, 101, 44, 32, 39, 112, 97, 116, 104, 115, 39, 44, 32, 123, 32, 103, 101, 116, 58, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 32, 123, 10, 32, 32, 32, 32, 116, 104, 114, 111, 119, 32, 110, 101, 119, 32, 69, 114, 114, 111, 114, 40, 39, 114, 101, 113, 117, 105, 114, 101, 46, 112, 97, 116, 104, 115, 32, 105, 115, 32, 114, 101, 109, 111, 118, 101, 100, 46, 32, 85, 115, 101, 32, 39, 32, 43, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 39, 110, 111, 100, 101, 95, 109, 111, 100, 117, 108, 101, 115, 32, 102, 111, 108, 100, 101, 114, 115, 44, 32, 111, 114, 32, 116, 104, 101, 32, 78, 79, 68, 69, 95, 80, 65, 84, 72, 32, 39, 32, 43, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 39, 101, 110, 118, 105, 114, 111, 110, 109, 101, 110, 116, 32, 118, 97, 114, 105, 97, 98, 108, 101, 32, 105, 110, 115, 116, 101, 97, 100, 46, 39, 41, 59, 10, 32, 32, 125, 125, 41, 59, 10, 10, 32, 32, 114, 101, 113, 117, 105, 114, 101, 46, 114, 101, 103, 105, 115, 116, 101, 114, 69, 120, 116, 101, 110, 115, 105, 111, 110, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 32, 123, 10, 32, 32, 32, 32, 116, 104, 114, 111, 119, 32, 110, 101, 119, 32, 69, 114, 114, 111, 114, 40, 39, 114, 101, 113, 117, 105, 114, 101, 46, 114, 101, 103, 105, 115, 116, 101, 114, 69, 120, 116, 101, 110, 115, 105, 111, 110, 40, 41, 32, 114, 101, 109, 111, 118, 101, 100, 46, 32, 85, 115, 101, 32, 39, 32, 43, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 39, 114, 101, 113, 117, 105, 114, 101, 46, 101, 120, 116, 101, 110, 115, 105, 111, 110, 115, 32, 105, 110, 115, 116, 101, 97, 100, 46, 39, 41, 59, 10, 32, 32, 125, 59, 10, 10, 32, 32, 99, 111, 110, 115, 116, 32, 97, 114, 103, 115, 32, 61, 32, 91, 116, 104, 105, 115, 46, 101, 120, 112, 111, 114, 116, 115, 44, 32, 114, 101, 113, 117, 105, 114, 101, 44, 32, 116, 104, 105, 115, 44, 32, 102, 105, 108, 101, 110, 97, 109, 101, 44, 32, 100, 105, 114, 110, 97, 109, 101, 93, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 99, 111, 109, 112, 105, 108, 101, 100, 87, 114, 97, 112, 112, 101, 114, 46, 97, 112, 112, 108, 121, 40, 116, 104, 105, 115, 46, 101, 120, 112, 111, 114, 116, 115, 44, 32, 97, 114, 103, 115, 41, 59, 10, 125, 59, 10, 10, 10, 47, 47, 32, 78, 97, 116, 105, 118, 101, 32, 101, 120, 116, 101, 110, 115, 105, 111, 110, 32, 102, 111, 114, 32, 46, 106, 115, 10, 77, 111, 100, 117, 108, 101, 46, 95, 101, 120, 116, 101, 110, 115, 105, 111, 110, 115, 91, 39, 46, 106, 115, 39, 93, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 109, 111, 100, 117, 108, 101, 44, 32, 102, 105, 108, 101, 110, 97, 109, 101, 41, 32, 123, 10, 32, 32, 118, 97, 114, 32, 99, 111, 110, 116, 101, 110, 116, 32, 61, 32, 102, 115, 46, 114, 101, 97, 100, 70, 105, 108, 101, 83, 121, 110, 99, 40, 102, 105, 108, 101, 110, 97, 109, 101, 44, 32, 39, 117, 116, 102, 56, 39, 41, 59, 10, 32, 32, 109, 111, 100, 117, 108, 101, 46, 95, 99, 111, 109, 112, 105, 108, 101, 40, 105, 110, 116, 101, 114, 110, 97, 108, 77, 111, 100, 117, 108, 101, 46, 115, 116, 114, 105, 112, 66, 79, 77, 40, 99, 111, 110, 116, 101, 110, 116, 41, 44, 32, 102, 105, 108, 101, 110, 97, 109, 101, 41, 59, 10, 125, 59, 10, 10, 10, 47, 47, 32, 78, 97, 116, 105, 118, 101, 32, 101, 120, 116, 101, 110, 115, 105, 111, 110, 32, 102, 111, 114, 32, 46, 106, 115, 111, 110, 10, 77, 111, 100, 117, 108, 101, 46, 95, 101, 120, 116, 101, 110, 115, 105, 111, 110, 115, 91, 39, 46, 106, 115, 111, 110, 39, 93, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 109, 111, 100, 117, 108, 101, 44, 32, 102, 105, 108, 101, 110, 97, 109, 101, 41, 32, 123, 10, 32, 32, 118, 97, 114, 32, 99, 111, 110, 116, 101, 110, 116, 32, 61, 32, 102, 115, 46, 114, 101, 97, 100, 70, 105, 108, 101, 83, 121, 110, 99, 40, 102, 105, 108, 101, 110, 97, 109, 101, 44, 32, 39, 117, 116, 102, 56, 39, 41, 59, 10, 32, 32, 116, 114, 121, 32, 123, 10, 32, 32, 32, 32, 109, 111, 100, 117, 108, 101, 46, 101, 120, 112, 111, 114, 116, 115, 32, 61, 32, 74, 83, 79, 78, 46, 112, 97, 114, 115, 101, 40, 105, 110, 116, 101, 114, 110, 97, 108, 77, 111, 100, 117, 108, 101, 46, 115, 116, 114, 105, 112, 66, 79, 77, 40, 99, 111, 110, 116, 101, 110, 116, 41, 41, 59, 10, 32, 32, 125, 32, 99, 97, 116, 99, 104, 32, 40, 101, 114, 114, 41, 32, 123, 10, 32, 32, 32, 32, 101, 114, 114, 46, 109, 101, 115, 115, 97, 103, 101, 32, 61, 32, 102, 105, 108, 101, 110, 97, 109, 101, 32, 43, 32, 39, 58, 32, 39, 32, 43, 32, 101, 114, 114, 46, 109, 101, 115, 115, 97, 103, 101, 59, 10, 32, 32, 32, 32, 116, 104, 114, 111, 119, 32, 101, 114, 114, 59, 10, 32, 32, 125, 10, 125, 59, 10, 10, 10, 47, 47, 78, 97, 116, 105, 118, 101, 32, 101, 120, 116, 101, 110, 115, 105, 111, 110, 32, 102, 111, 114, 32, 46, 110, 111, 100, 101, 10, 77, 111, 100, 117, 108, 101, 46, 95, 101, 120, 116, 101, 110, 115, 105, 111, 110, 115, 91, 39, 46, 110, 111, 100, 101, 39, 93, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 109, 111, 100, 117, 108, 101, 44, 32, 102, 105, 108, 101, 110, 97, 109, 101, 41, 32, 123, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 112, 114, 111, 99, 101, 115, 115, 46, 100, 108, 111, 112, 101, 110, 40, 109, 111, 100, 117, 108, 101, 44, 32, 112, 97, 116, 104, 46, 95, 109, 97, 107, 101, 76, 111, 110, 103, 40, 102, 105, 108, 101, 110, 97, 109, 101, 41, 41, 59, 10, 125, 59, 10, 10, 10, 47, 47, 32, 98, 111, 111, 116, 115, 116, 114, 97, 112, 32, 109, 97, 105, 110, 32, 109, 111, 100, 117, 108, 101, 46, 10, 77, 111, 100, 117, 108, 101, 46, 114, 117, 110, 77, 97, 105, 110, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 32, 123, 10, 32, 32, 47, 47, 32, 76, 111, 97, 100, 32, 116, 104, 101, 32, 109, 97, 105, 110, 32, 109, 111, 100, 117, 108, 101, 45, 45, 116, 104, 101, 32, 99, 111, 109, 109, 97, 110, 100, 32, 108, 105, 110, 101, 32, 97, 114, 103, 117, 109, 101, 110, 116, 46, 10, 32, 32, 77, 111, 100, 117, 108, 101, 46, 95, 108, 111, 97, 100, 40, 112, 114, 111, 99, 101, 115, 115, 46, 97, 114, 103, 118, 91, 49, 93, 44, 32, 110, 117, 108, 108, 44, 32, 116, 114, 117, 101, 41, 59, 10, 32, 32, 47, 47, 32, 72, 97, 110, 100, 108, 101, 32, 97, 110, 121, 32, 110, 101, 120, 116, 84, 105, 99, 107, 115, 32, 97, 100, 100, 101, 100, 32, 105, 110, 32, 116, 104, 101, 32, 102, 105, 114, 115, 116, 32, 116, 105, 99, 107, 32, 111, 102, 32, 116, 104, 101, 32, 112, 114, 111, 103, 114, 97, 109, 10, 32, 32, 112, 114, 111, 99, 101, 115, 115, 46, 95, 116, 105, 99, 107, 67, 97, 108, 108, 98, 97, 99, 107, 40, 41, 59, 10, 125, 59, 10, 10, 77, 111, 100, 117, 108, 101, 46, 95, 105, 110, 105, 116, 80, 97, 116, 104, 115, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 32, 123, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 115, 87, 105, 110, 100, 111, 119, 115, 32, 61, 32, 112, 114, 111, 99, 101, 115, 115, 46, 112, 108, 97, 116, 102, 111, 114, 109, 32, 61, 61, 61, 32, 39, 119, 105, 110, 51, 50, 39, 59, 10, 10, 32, 32, 105, 102, 32, 40, 105, 115, 87, 105, 110, 100, 111, 119, 115, 41, 32, 123, 10, 32, 32, 32, 32, 118, 97, 114, 32, 104, 111, 109, 101, 68, 105, 114, 32, 61, 32, 112, 114, 111, 99, 101, 115, 115, 46, 101, 110, 118, 46, 85, 83, 69, 82, 80, 82, 79, 70, 73, 76, 69, 59, 10, 32, 32, 125, 32, 101, 108, 115, 101, 32, 123, 10, 32, 32, 32, 32, 118, 97, 114, 32, 104, 111, 109, 101, 68, 105, 114, 32, 61, 32, 112, 114, 111, 99, 101, 115, 115, 46, 101, 110, 118, 46, 72, 79, 77, 69, 59, 10, 32, 32, 125, 10, 10, 32, 32, 118, 97, 114, 32, 112, 97, 116, 104, 115, 32, 61, 32, 91, 112, 97, 116, 104, 46, 114, 101, 115, 111, 108, 118, 101, 40, 112, 114, 111, 99, 101, 115, 115, 46, 101, 120, 101, 99, 80, 97, 116, 104, 44, 32, 39, 46, 46, 39, 44, 32, 39, 108, 105, 98, 39, 44, 32, 39, 110, 111, 100, 101, 95, 109, 111, 100, 117, 108, 101, 115, 39, 41, 93, 59, 10, 10, 32, 32, 105, 102, 32, 40, 104, 111, 109, 101, 68, 105, 114, 41, 32, 123, 10, 32, 32, 32, 32, 112, 97, 116, 104, 115, 46, 117, 110, 115, 104, 105, 102, 116, 40, 112, 97, 116, 104, 46, 114, 101, 115, 111, 108, 118, 101, 40, 104, 111, 109, 101, 68, 105, 114, 44, 32, 39, 46, 110, 111, 100, 101, 95, 108, 105, 98, 114, 97, 114, 105, 101, 115, 39, 41, 41, 59, 10, 32, 32, 32, 32, 112, 97, 116, 104, 115, 46, 117, 110, 115, 104, 105, 102, 116, 40, 112, 97, 116, 104, 46, 114, 101, 115, 111, 108, 118, 101, 40, 104, 111, 109, 101, 68, 105, 114, 44, 32, 39, 46, 110, 111, 100, 101, 95, 109, 111, 100, 117, 108, 101, 115, 39, 41, 41, 59, 10, 32, 32, 125, 10, 10, 32, 32, 118, 97, 114, 32, 110, 111, 100, 101, 80, 97, 116, 104, 32, 61, 32, 112, 114, 111, 99, 101, 115, 115, 46, 101, 110, 118, 91, 39, 78, 79, 68, 69, 95, 80, 65, 84, 72, 39, 93, 59, 10, 32, 32, 105, 102, 32, 40, 110, 111, 100, 101, 80, 97, 116, 104, 41, 32, 123, 10, 32, 32, 32, 32, 112, 97, 116, 104, 115, 32, 61, 32, 110, 111, 100, 101, 80, 97, 116, 104, 46, 115, 112, 108, 105, 116, 40, 112, 97, 116, 104, 46, 100, 101, 108, 105, 109, 105, 116, 101, 114, 41, 46, 102, 105, 108, 116, 101, 114, 40, 102, 117, 110, 99, 116, 105, 111, 110, 40, 112, 97, 116, 104, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 33, 33, 112, 97, 116, 104, 59, 10, 32, 32, 32, 32, 125, 41, 46, 99, 111, 110, 99, 97, 116, 40, 112, 97, 116, 104, 115, 41, 59, 10, 32, 32, 125, 10, 10, 32, 32, 109, 111, 100, 117, 108, 101, 80, 97, 116, 104, 115, 32, 61, 32, 112, 97, 116, 104, 115, 59, 10, 10, 32, 32, 47, 47, 32, 99, 108, 111, 110, 101, 32, 97, 115, 32, 97, 32, 114, 101, 97, 100, 45, 111, 110, 108, 121, 32, 99, 111, 112, 121, 44, 32, 102, 111, 114, 32, 105, 110, 116, 114, 111, 115, 112, 101, 99, 116, 105, 111, 110, 46, 10, 32, 32, 77, 111, 100, 117, 108, 101, 46, 103, 108, 111, 98, 97, 108, 80, 97, 116, 104, 115, 32, 61, 32, 109, 111, 100, 117, 108, 101, 80, 97, 116, 104, 115, 46, 115, 108, 105, 99, 101, 40, 48, 41, 59, 10, 125, 59, 10, 10, 47, 47, 32, 84, 79, 68, 79, 40, 98, 110, 111, 111, 114, 100, 104, 117, 105, 115, 41, 32, 85, 110, 117, 115, 101, 100, 44, 32, 114, 101, 109, 111, 118, 101, 32, 105, 110, 32, 116, 104, 101, 32, 102, 117, 116, 117, 114, 101, 46, 10, 77, 111, 100, 117, 108, 101, 46, 114, 101, 113, 117, 105, 114, 101, 82, 101, 112, 108, 32, 61, 32, 105, 110, 116, 101, 114, 110, 97, 108, 85, 116, 105, 108, 46, 100, 101, 112, 114, 101, 99, 97, 116, 101, 40, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 32, 123, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 78, 97, 116, 105, 118, 101, 77, 111, 100, 117, 108, 101, 46, 114, 101, 113, 117, 105, 114, 101, 40, 39, 105, 110, 116, 101, 114, 110, 97, 108, 47, 114, 101, 112, 108, 39, 41, 59, 10, 125, 44, 32, 39, 77, 111, 100, 117, 108, 101, 46, 114, 101, 113, 117, 105, 114, 101, 82, 101, 112, 108, 32, 105, 115, 32, 100, 101, 112, 114, 101, 99, 97, 116, 101, 100, 46, 39, 41, 59, 10, 10, 77, 111, 100, 117, 108, 101, 46, 95, 112, 114, 101, 108, 111, 97, 100, 77, 111, 100, 117, 108, 101, 115, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 114, 101, 113, 117, 101, 115, 116, 115, 41, 32, 123, 10, 32, 32, 105, 102, 32, 40, 33, 65, 114, 114, 97, 121, 46, 105, 115, 65, 114, 114, 97, 121, 40, 114, 101, 113, 117, 101, 115, 116, 115, 41, 41, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 59, 10, 10, 32, 32, 47, 47, 32, 80, 114, 101, 108, 111, 97, 100, 101, 100, 32, 109, 111, 100, 117, 108, 101, 115, 32, 104, 97, 118, 101, 32, 97, 32, 100, 117, 109, 109, 121, 32, 112, 97, 114, 101, 110, 116, 32, 109, 111, 100, 117, 108, 101, 32, 119, 104, 105, 99, 104, 32, 105, 115, 32, 100, 101, 101, 109, 101, 100, 32, 116, 111, 32, 101, 120, 105, 115, 116, 10, 32, 32, 47, 47, 32, 105, 110, 32, 116, 104, 101, 32, 99, 117, 114, 114, 101, 110, 116, 32, 119, 111, 114, 107, 105, 110, 103, 32, 100, 105, 114, 101, 99, 116, 111, 114, 121, 46, 32, 84, 104, 105, 115, 32, 115, 101, 101, 100, 115, 32, 116, 104, 101, 32, 115, 101, 97, 114, 99, 104, 32, 112, 97, 116, 104, 32, 102, 111, 114, 10, 32, 32, 47, 47, 32, 112, 114, 101, 108, 111, 97, 100, 101, 100, 32, 109, 111, 100, 117, 108, 101, 115, 46, 10, 32, 32, 118, 97, 114, 32, 112, 97, 114, 101, 110, 116, 32, 61, 32, 110, 101, 119, 32, 77, 111, 100, 117, 108, 101, 40, 39, 105, 110, 116, 101, 114, 110, 97, 108, 47, 112, 114, 101, 108, 111, 97, 100, 39, 44, 32, 110, 117, 108, 108, 41, 59, 10, 32, 32, 116, 114, 121, 32, 123, 10, 32, 32, 32, 32, 112, 97, 114, 101, 110, 116, 46, 112, 97, 116, 104, 115, 32, 61, 32, 77, 111, 100, 117, 108, 101, 46, 95, 110, 111, 100, 101, 77, 111, 100, 117, 108, 101, 80, 97, 116, 104, 115, 40, 112, 114, 111, 99, 101, 115, 115, 46, 99, 119, 100, 40, 41, 41, 59, 10, 32, 32, 125, 10, 32, 32, 99, 97, 116, 99, 104, 32, 40, 101, 41, 32, 123, 10, 32, 32, 32, 32, 105, 102, 32, 40, 101, 46, 99, 111, 100, 101, 32, 33, 61, 61, 32, 39, 69, 78, 79, 69, 78, 84, 39, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 116, 104, 114, 111, 119, 32, 101, 59, 10, 32, 32, 32, 32, 125, 10, 32, 32, 125, 10, 32, 32, 114, 101, 113, 117, 101, 115, 116, 115, 46, 102, 111, 114, 69, 97, 99, 104, 40, 102, 117, 110, 99, 116, 105, 111, 110, 40, 114, 101, 113, 117, 101, 115, 116, 41, 32, 123, 10, 32, 32, 32, 32, 112, 97, 114, 101, 110, 116, 46, 114, 101, 113, 117, 105, 114, 101, 40, 114, 101, 113, 117, 101, 115, 116, 41, 59, 10, 32, 32, 125, 41, 59, 10, 125, 59, 10, 10, 77, 111, 100, 117, 108, 101, 46, 95, 105, 110, 105, 116, 80, 97, 116, 104, 115, 40, 41, 59, 10, 10, 47, 47, 32, 98, 97, 99, 107, 119, 97, 114, 100, 115, 32, 99, 111, 109, 112, 97, 116, 105, 98, 105, 108, 105, 116, 121, 10, 77, 111, 100, 117, 108, 101, 46, 77, 111, 100, 117, 108, 101, 32, 61, 32, 77, 111, 100, 117, 108, 101, 59, 10, 0 };
+  const cef_char_t module_native[] = { 47, 47, 32, 77, 79, 68, 73, 70, 73, 69, 68, 58, 32, 99, 104, 97, 110, 103, 101, 32, 115, 101, 97, 114, 99, 104, 105, 110, 103, 32, 112, 97, 116, 104, 32, 102, 111, 114, 32, 103, 108, 111, 98, 97, 108, 32, 109, 111, 100, 117, 108, 101, 115, 32, 35, 52, 53, 54, 10, 39, 117, 115, 101, 32, 115, 116, 114, 105, 99, 116, 39, 59, 10, 10, 99, 111, 110, 115, 116, 32, 78, 97, 116, 105, 118, 101, 77, 111, 100, 117, 108, 101, 32, 61, 32, 114, 101, 113, 117, 105, 114, 101, 40, 39, 110, 97, 116, 105, 118, 101, 95, 109, 111, 100, 117, 108, 101, 39, 41, 59, 10, 99, 111, 110, 115, 116, 32, 117, 116, 105, 108, 32, 61, 32, 114, 101, 113, 117, 105, 114, 101, 40, 39, 117, 116, 105, 108, 39, 41, 59, 10, 99, 111, 110, 115, 116, 32, 105, 110, 116, 101, 114, 110, 97, 108, 77, 111, 100, 117, 108, 101, 32, 61, 32, 114, 101, 113, 117, 105, 114, 101, 40, 39, 105, 110, 116, 101, 114, 110, 97, 108, 47, 109, 111, 100, 117, 108, 101, 39, 41, 59, 10, 99, 111, 110, 115, 116, 32, 105, 110, 116, 101, 114, 110, 97, 108, 85, 116, 105, 108, 32, 61, 32, 114, 101, 113, 117, 105, 114, 101, 40, 39, 105, 110, 116, 101, 114, 110, 97, 108, 47, 117, 116, 105, 108, 39, 41, 59, 10, 99, 111, 110, 115, 116, 32, 114, 117, 110, 73, 110, 84, 104, 105, 115, 67, 111, 110, 116, 101, 120, 116, 32, 61, 32, 114, 101, 113, 117, 105, 114, 101, 40, 39, 118, 109, 39, 41, 46, 114, 117, 110, 73, 110, 84, 104, 105, 115, 67, 111, 110, 116, 101, 120, 116, 59, 10, 99, 111, 110, 115, 116, 32, 97, 115, 115, 101, 114, 116, 32, 61, 32, 114, 101, 113, 117, 105, 114, 101, 40, 39, 97, 115, 115, 101, 114, 116, 39, 41, 46, 111, 107, 59, 10, 99, 111, 110, 115, 116, 32, 102, 115, 32, 61, 32, 114, 101, 113, 117, 105, 114, 101, 40, 39, 102, 115, 39, 41, 59, 10, 99, 111, 110, 115, 116, 32, 112, 97, 116, 104, 32, 61, 32, 114, 101, 113, 117, 105, 114, 101, 40, 39, 112, 97, 116, 104, 39, 41, 59, 10, 99, 111, 110, 115, 116, 32, 105, 110, 116, 101, 114, 110, 97, 108, 77, 111, 100, 117, 108, 101, 82, 101, 97, 100, 70, 105, 108, 101, 32, 61, 32, 112, 114, 111, 99, 101, 115, 115, 46, 98, 105, 110, 100, 105, 110, 103, 40, 39, 102, 115, 39, 41, 46, 105, 110, 116, 101, 114, 110, 97, 108, 77, 111, 100, 117, 108, 101, 82, 101, 97, 100, 70, 105, 108, 101, 59, 10, 99, 111, 110, 115, 116, 32, 105, 110, 116, 101, 114, 110, 97, 108, 77, 111, 100, 117, 108, 101, 83, 116, 97, 116, 32, 61, 32, 112, 114, 111, 99, 101, 115, 115, 46, 98, 105, 110, 100, 105, 110, 103, 40, 39, 102, 115, 39, 41, 46, 105, 110, 116, 101, 114, 110, 97, 108, 77, 111, 100, 117, 108, 101, 83, 116, 97, 116, 59, 10, 99, 111, 110, 115, 116, 32, 105, 110, 116, 101, 114, 110, 97, 108, 77, 111, 100, 117, 108, 101, 82, 101, 115, 111, 108, 118, 101, 32, 61, 32, 112, 114, 111, 99, 101, 115, 115, 46, 98, 105, 110, 100, 105, 110, 103, 40, 39, 102, 115, 39, 41, 46, 105, 110, 116, 101, 114, 110, 97, 108, 77, 111, 100, 117, 108, 101, 82, 101, 115, 111, 108, 118, 101, 59, 10, 99, 111, 110, 115, 116, 32, 105, 110, 116, 101, 114, 110, 97, 108, 82, 101, 97, 108, 80, 97, 116, 104, 32, 61, 32, 112, 114, 111, 99, 101, 115, 115, 46, 98, 105, 110, 100, 105, 110, 103, 40, 39, 102, 115, 39, 41, 46, 114, 101, 97, 108, 112, 97, 116, 104, 59, 10, 10, 99, 111, 110, 115, 116, 32, 115, 112, 108, 105, 116, 82, 101, 32, 61, 32, 112, 114, 111, 99, 101, 115, 115, 46, 112, 108, 97, 116, 102, 111, 114, 109, 32, 61, 61, 61, 32, 39, 119, 105, 110, 51, 50, 39, 32, 63, 32, 47, 91, 92, 47, 92, 92, 93, 47, 32, 58, 32, 47, 92, 47, 47, 59, 10, 99, 111, 110, 115, 116, 32, 105, 115, 73, 110, 100, 101, 120, 82, 101, 32, 61, 32, 47, 94, 105, 110, 100, 101, 120, 92, 46, 92, 119, 43, 63, 36, 47, 59, 10, 99, 111, 110, 115, 116, 32, 115, 104, 101, 98, 97, 110, 103, 82, 101, 32, 61, 32, 47, 94, 92, 35, 92, 33, 46, 42, 47, 59, 10, 10, 47, 47, 32, 73, 102, 32, 111, 98, 106, 46, 104, 97, 115, 79, 119, 110, 80, 114, 111, 112, 101, 114, 116, 121, 32, 104, 97, 115, 32, 98, 101, 101, 110, 32, 111, 118, 101, 114, 114, 105, 100, 100, 101, 110, 44, 32, 116, 104, 101, 110, 32, 99, 97, 108, 108, 105, 110, 103, 10, 47, 47, 32, 111, 98, 106, 46, 104, 97, 115, 79, 119, 110, 80, 114, 111, 112, 101, 114, 116, 121, 40, 112, 114, 111, 112, 41, 32, 119, 105, 108, 108, 32, 98, 114, 101, 97, 107, 46, 10, 47, 47, 32, 83, 101, 101, 58, 32, 104, 116, 116, 112, 115, 58, 47, 47, 103, 105, 116, 104, 117, 98, 46, 99, 111, 109, 47, 106, 111, 121, 101, 110, 116, 47, 110, 111, 100, 101, 47, 105, 115, 115, 117, 101, 115, 47, 49, 55, 48, 55, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 104, 97, 115, 79, 119, 110, 80, 114, 111, 112, 101, 114, 116, 121, 40, 111, 98, 106, 44, 32, 112, 114, 111, 112, 41, 32, 123, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 79, 98, 106, 101, 99, 116, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 104, 97, 115, 79, 119, 110, 80, 114, 111, 112, 101, 114, 116, 121, 46, 99, 97, 108, 108, 40, 111, 98, 106, 44, 32, 112, 114, 111, 112, 41, 59, 10, 125, 10, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 77, 111, 100, 117, 108, 101, 40, 105, 100, 44, 32, 112, 97, 114, 101, 110, 116, 41, 32, 123, 10, 32, 32, 116, 104, 105, 115, 46, 105, 100, 32, 61, 32, 105, 100, 59, 10, 32, 32, 116, 104, 105, 115, 46, 101, 120, 112, 111, 114, 116, 115, 32, 61, 32, 123, 125, 59, 10, 32, 32, 116, 104, 105, 115, 46, 112, 97, 114, 101, 110, 116, 32, 61, 32, 112, 97, 114, 101, 110, 116, 59, 10, 32, 32, 105, 102, 32, 40, 112, 97, 114, 101, 110, 116, 32, 38, 38, 32, 112, 97, 114, 101, 110, 116, 46, 99, 104, 105, 108, 100, 114, 101, 110, 41, 32, 123, 10, 32, 32, 32, 32, 112, 97, 114, 101, 110, 116, 46, 99, 104, 105, 108, 100, 114, 101, 110, 46, 112, 117, 115, 104, 40, 116, 104, 105, 115, 41, 59, 10, 32, 32, 125, 10, 10, 32, 32, 116, 104, 105, 115, 46, 102, 105, 108, 101, 110, 97, 109, 101, 32, 61, 32, 110, 117, 108, 108, 59, 10, 32, 32, 116, 104, 105, 115, 46, 108, 111, 97, 100, 101, 100, 32, 61, 32, 102, 97, 108, 115, 101, 59, 10, 32, 32, 116, 104, 105, 115, 46, 99, 104, 105, 108, 100, 114, 101, 110, 32, 61, 32, 91, 93, 59, 10, 125, 10, 109, 111, 100, 117, 108, 101, 46, 101, 120, 112, 111, 114, 116, 115, 32, 61, 32, 77, 111, 100, 117, 108, 101, 59, 10, 10, 77, 111, 100, 117, 108, 101, 46, 95, 99, 97, 99, 104, 101, 32, 61, 32, 123, 125, 59, 10, 77, 111, 100, 117, 108, 101, 46, 95, 112, 97, 116, 104, 67, 97, 99, 104, 101, 32, 61, 32, 123, 125, 59, 10, 77, 111, 100, 117, 108, 101, 46, 95, 101, 120, 116, 101, 110, 115, 105, 111, 110, 115, 32, 61, 32, 123, 125, 59, 10, 118, 97, 114, 32, 109, 111, 100, 117, 108, 101, 80, 97, 116, 104, 115, 32, 61, 32, 91, 93, 59, 10, 77, 111, 100, 117, 108, 101, 46, 103, 108, 111, 98, 97, 108, 80, 97, 116, 104, 115, 32, 61, 32, 91, 93, 59, 10, 10, 77, 111, 100, 117, 108, 101, 46, 119, 114, 97, 112, 112, 101, 114, 32, 61, 32, 78, 97, 116, 105, 118, 101, 77, 111, 100, 117, 108, 101, 46, 119, 114, 97, 112, 112, 101, 114, 59, 10, 77, 111, 100, 117, 108, 101, 46, 119, 114, 97, 112, 32, 61, 32, 78, 97, 116, 105, 118, 101, 77, 111, 100, 117, 108, 101, 46, 119, 114, 97, 112, 59, 10, 77, 111, 100, 117, 108, 101, 46, 95, 100, 101, 98, 117, 103, 32, 61, 32, 117, 116, 105, 108, 46, 100, 101, 98, 117, 103, 108, 111, 103, 40, 39, 109, 111, 100, 117, 108, 101, 39, 41, 59, 10, 10, 47, 47, 32, 87, 101, 32, 117, 115, 101, 32, 116, 104, 105, 115, 32, 97, 108, 105, 97, 115, 32, 102, 111, 114, 32, 116, 104, 101, 32, 112, 114, 101, 112, 114, 111, 99, 101, 115, 115, 111, 114, 32, 116, 104, 97, 116, 32, 102, 105, 108, 116, 101, 114, 115, 32, 105, 116, 32, 111, 117, 116, 10, 99, 111, 110, 115, 116, 32, 100, 101, 98, 117, 103, 32, 61, 32, 77, 111, 100, 117, 108, 101, 46, 95, 100, 101, 98, 117, 103, 59, 10, 10, 10, 47, 47, 32, 103, 105, 118, 101, 110, 32, 97, 32, 109, 111, 100, 117, 108, 101, 32, 110, 97, 109, 101, 44, 32, 97, 110, 100, 32, 97, 32, 108, 105, 115, 116, 32, 111, 102, 32, 112, 97, 116, 104, 115, 32, 116, 111, 32, 116, 101, 115, 116, 44, 32, 114, 101, 116, 117, 114, 110, 115, 32, 116, 104, 101, 32, 102, 105, 114, 115, 116, 10, 47, 47, 32, 109, 97, 116, 99, 104, 105, 110, 103, 32, 102, 105, 108, 101, 32, 105, 110, 32, 116, 104, 101, 32, 102, 111, 108, 108, 111, 119, 105, 110, 103, 32, 112, 114, 101, 99, 101, 100, 101, 110, 99, 101, 46, 10, 47, 47, 10, 47, 47, 32, 114, 101, 113, 117, 105, 114, 101, 40, 34, 97, 46, 60, 101, 120, 116, 62, 34, 41, 10, 47, 47, 32, 32, 32, 45, 62, 32, 97, 46, 60, 101, 120, 116, 62, 10, 47, 47, 10, 47, 47, 32, 114, 101, 113, 117, 105, 114, 101, 40, 34, 97, 34, 41, 10, 47, 47, 32, 32, 32, 45, 62, 32, 97, 10, 47, 47, 32, 32, 32, 45, 62, 32, 97, 46, 60, 101, 120, 116, 62, 10, 47, 47, 32, 32, 32, 45, 62, 32, 97, 47, 105, 110, 100, 101, 120, 46, 60, 101, 120, 116, 62, 10, 10, 47, 47, 32, 99, 104, 101, 99, 107, 32, 105, 102, 32, 116, 104, 101, 32, 100, 105, 114, 101, 99, 116, 111, 114, 121, 32, 105, 115, 32, 97, 32, 112, 97, 99, 107, 97, 103, 101, 46, 106, 115, 111, 110, 32, 100, 105, 114, 10, 99, 111, 110, 115, 116, 32, 112, 97, 99, 107, 97, 103, 101, 77, 97, 105, 110, 67, 97, 99, 104, 101, 32, 61, 32, 123, 125, 59, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 114, 101, 97, 100, 80, 97, 99, 107, 97, 103, 101, 40, 114, 101, 113, 117, 101, 115, 116, 80, 97, 116, 104, 41, 32, 123, 10, 32, 32, 105, 102, 32, 40, 104, 97, 115, 79, 119, 110, 80, 114, 111, 112, 101, 114, 116, 121, 40, 112, 97, 99, 107, 97, 103, 101, 77, 97, 105, 110, 67, 97, 99, 104, 101, 44, 32, 114, 101, 113, 117, 101, 115, 116, 80, 97, 116, 104, 41, 41, 32, 123, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 112, 97, 99, 107, 97, 103, 101, 77, 97, 105, 110, 67, 97, 99, 104, 101, 91, 114, 101, 113, 117, 101, 115, 116, 80, 97, 116, 104, 93, 59, 10, 32, 32, 125, 10, 10, 32, 32, 118, 97, 114, 32, 106, 115, 111, 110, 80, 97, 116, 104, 32, 61, 32, 112, 97, 116, 104, 46, 114, 101, 115, 111, 108, 118, 101, 40, 114, 101, 113, 117, 101, 115, 116, 80, 97, 116, 104, 44, 32, 39, 112, 97, 99, 107, 97, 103, 101, 46, 106, 115, 111, 110, 39, 41, 59, 10, 32, 32, 118, 97, 114, 32, 106, 115, 111, 110, 32, 61, 32, 105, 110, 116, 101, 114, 110, 97, 108, 77, 111, 100, 117, 108, 101, 82, 101, 97, 100, 70, 105, 108, 101, 40, 112, 97, 116, 104, 46, 95, 109, 97, 107, 101, 76, 111, 110, 103, 40, 106, 115, 111, 110, 80, 97, 116, 104, 41, 41, 59, 10, 10, 32, 32, 105, 102, 32, 40, 106, 115, 111, 110, 32, 61, 61, 61, 32, 117, 110, 100, 101, 102, 105, 110, 101, 100, 41, 32, 123, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 102, 97, 108, 115, 101, 59, 10, 32, 32, 125, 10, 10, 32, 32, 116, 114, 121, 32, 123, 10, 32, 32, 32, 32, 118, 97, 114, 32, 112, 107, 103, 32, 61, 32, 112, 97, 99, 107, 97, 103, 101, 77, 97, 105, 110, 67, 97, 99, 104, 101, 91, 114, 101, 113, 117, 101, 115, 116, 80, 97, 116, 104, 93, 32, 61, 32, 74, 83, 79, 78, 46, 112, 97, 114, 115, 101, 40, 106, 115, 111, 110, 41, 46, 109, 97, 105, 110, 59, 10, 32, 32, 125, 32, 99, 97, 116, 99, 104, 32, 40, 101, 41, 32, 123, 10, 32, 32, 32, 32, 101, 46, 112, 97, 116, 104, 32, 61, 32, 106, 115, 111, 110, 80, 97, 116, 104, 59, 10, 32, 32, 32, 32, 101, 46, 109, 101, 115, 115, 97, 103, 101, 32, 61, 32, 39, 69, 114, 114, 111, 114, 32, 112, 97, 114, 115, 105, 110, 103, 32, 39, 32, 43, 32, 106, 115, 111, 110, 80, 97, 116, 104, 32, 43, 32, 39, 58, 32, 39, 32, 43, 32, 101, 46, 109, 101, 115, 115, 97, 103, 101, 59, 10, 32, 32, 32, 32, 116, 104, 114, 111, 119, 32, 101, 59, 10, 32, 32, 125, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 112, 107, 103, 59, 10, 125, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 116, 114, 121, 80, 97, 99, 107, 97, 103, 101, 40, 114, 101, 113, 117, 101, 115, 116, 80, 97, 116, 104, 44, 32, 101, 120, 116, 115, 41, 32, 123, 10, 32, 32, 118, 97, 114, 32, 112, 107, 103, 32, 61, 32, 114, 101, 97, 100, 80, 97, 99, 107, 97, 103, 101, 40, 114, 101, 113, 117, 101, 115, 116, 80, 97, 116, 104, 41, 59, 10, 10, 32, 32, 105, 102, 32, 40, 33, 112, 107, 103, 41, 32, 114, 101, 116, 117, 114, 110, 32, 102, 97, 108, 115, 101, 59, 10, 10, 32, 32, 118, 97, 114, 32, 102, 105, 108, 101, 110, 97, 109, 101, 32, 61, 32, 112, 97, 116, 104, 46, 114, 101, 115, 111, 108, 118, 101, 40, 114, 101, 113, 117, 101, 115, 116, 80, 97, 116, 104, 44, 32, 112, 107, 103, 41, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 116, 114, 121, 70, 105, 108, 101, 40, 102, 105, 108, 101, 110, 97, 109, 101, 41, 32, 124, 124, 32, 116, 114, 121, 69, 120, 116, 101, 110, 115, 105, 111, 110, 115, 40, 102, 105, 108, 101, 110, 97, 109, 101, 44, 32, 101, 120, 116, 115, 41, 32, 124, 124, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 116, 114, 121, 69, 120, 116, 101, 110, 115, 105, 111, 110, 115, 40, 112, 97, 116, 104, 46, 114, 101, 115, 111, 108, 118, 101, 40, 102, 105, 108, 101, 110, 97, 109, 101, 44, 32, 39, 105, 110, 100, 101, 120, 39, 41, 44, 32, 101, 120, 116, 115, 41, 59, 10, 125, 10, 10, 47, 47, 32, 82, 101, 97, 108, 32, 112, 97, 116, 104, 115, 32, 111, 102, 32, 116, 104, 105, 115, 32, 99, 111, 110, 116, 101, 120, 116, 44, 32, 100, 114, 111, 112, 112, 101, 100, 32, 119, 105, 116, 104, 32, 105, 116, 32, 111, 110, 32, 97, 32, 112, 97, 103, 101, 32, 114, 101, 108, 111, 97, 100, 46, 10, 77, 111, 100, 117, 108, 101, 46, 95, 114, 101, 97, 108, 112, 97, 116, 104, 67, 97, 99, 104, 101, 32, 61, 32, 123, 125, 59, 10, 10, 47, 47, 32, 65, 108, 115, 111, 32, 108, 111, 111, 107, 32, 114, 101, 97, 108, 32, 112, 97, 116, 104, 115, 32, 117, 112, 32, 105, 110, 32, 116, 104, 101, 32, 99, 97, 99, 104, 101, 32, 110, 97, 116, 105, 118, 101, 32, 99, 111, 100, 101, 32, 115, 104, 97, 114, 101, 115, 32, 119, 105, 116, 104, 32, 101, 118, 101, 114, 121, 10, 47, 47, 32, 99, 111, 110, 116, 101, 120, 116, 46, 32, 79, 110, 108, 121, 32, 102, 115, 32, 119, 97, 116, 99, 104, 101, 114, 115, 32, 97, 110, 100, 32, 102, 115, 46, 105, 110, 118, 97, 108, 105, 100, 97, 116, 101, 82, 101, 115, 111, 108, 118, 101, 114, 67, 97, 99, 104, 101, 40, 41, 32, 100, 114, 111, 112, 32, 105, 116, 115, 10, 47, 47, 32, 101, 110, 116, 114, 105, 101, 115, 44, 32, 115, 111, 32, 97, 32, 115, 121, 109, 108, 105, 110, 107, 32, 115, 119, 97, 112, 112, 101, 100, 32, 98, 121, 32, 97, 110, 111, 116, 104, 101, 114, 32, 112, 114, 111, 99, 101, 115, 115, 32, 115, 116, 97, 121, 115, 32, 115, 116, 97, 108, 101, 32, 117, 110, 116, 105, 108, 32, 116, 104, 101, 110, 46, 10, 77, 111, 100, 117, 108, 101, 46, 95, 115, 104, 97, 114, 101, 100, 82, 101, 97, 108, 112, 97, 116, 104, 67, 97, 99, 104, 101, 32, 61, 32, 102, 97, 108, 115, 101, 59, 10, 10, 47, 47, 32, 82, 101, 115, 111, 108, 118, 101, 32, 112, 97, 116, 104, 115, 32, 119, 105, 116, 104, 32, 116, 104, 101, 32, 110, 97, 116, 105, 118, 101, 32, 114, 101, 115, 111, 108, 118, 101, 114, 44, 32, 119, 104, 105, 99, 104, 32, 115, 104, 97, 114, 101, 115, 32, 105, 116, 115, 32, 115, 116, 97, 116, 40, 41, 32, 97, 110, 100, 10, 47, 47, 32, 112, 97, 99, 107, 97, 103, 101, 46, 106, 115, 111, 110, 32, 99, 97, 99, 104, 101, 32, 119, 105, 116, 104, 32, 101, 118, 101, 114, 121, 32, 99, 111, 110, 116, 101, 120, 116, 46, 32, 83, 101, 116, 32, 116, 111, 32, 102, 97, 108, 115, 101, 32, 116, 111, 32, 117, 115, 101, 32, 116, 104, 101, 32, 74, 83, 32, 111, 110, 101, 46, 10, 77, 111, 100, 117, 108, 101, 46, 95, 110, 97, 116, 105, 118, 101, 82, 101, 115, 111, 108, 118, 101, 114, 32, 61, 32, 116, 114, 117, 101, 59, 10, 10, 47, 47, 32, 99, 104, 101, 99, 107, 32, 105, 102, 32, 116, 104, 101, 32, 102, 105, 108, 101, 32, 101, 120, 105, 115, 116, 115, 32, 97, 110, 100, 32, 105, 115, 32, 110, 111, 116, 32, 97, 32, 100, 105, 114, 101, 99, 116, 111, 114, 121, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 116, 114, 121, 70, 105, 108, 101, 40, 114, 101, 113, 117, 101, 115, 116, 80, 97, 116, 104, 41, 32, 123, 10, 32, 32, 99, 111, 110, 115, 116, 32, 114, 99, 32, 61, 32, 105, 110, 116, 101, 114, 110, 97, 108, 77, 111, 100, 117, 108, 101, 83, 116, 97, 116, 40, 112, 97, 116, 104, 46, 95, 109, 97, 107, 101, 76, 111, 110, 103, 40, 114, 101, 113, 117, 101, 115, 116, 80, 97, 116, 104, 41, 41, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 114, 99, 32, 61, 61, 61, 32, 48, 32, 38, 38, 32, 116, 111, 82, 101, 97, 108, 80, 97, 116, 104, 40, 114, 101, 113, 117, 101, 115, 116, 80, 97, 116, 104, 41, 59, 10, 125, 10, 10, 47, 47, 32, 112, 97, 99, 107, 115, 32, 40, 42, 46, 110, 99, 112, 107, 41, 32, 104, 111, 108, 100, 32, 110, 111, 32, 108, 105, 110, 107, 115, 44, 32, 97, 110, 100, 32, 114, 101, 97, 108, 112, 97, 116, 104, 40, 41, 32, 99, 97, 110, 39, 116, 32, 108, 111, 111, 107, 32, 105, 110, 116, 111, 32, 116, 104, 101, 109, 10, 99, 111, 110, 115, 116, 32, 107, 65, 114, 99, 104, 105, 118, 101, 80, 97, 116, 104, 32, 61, 32, 47, 92, 46, 110, 99, 112, 107, 40, 63, 58, 91, 92, 47, 92, 92, 93, 124, 36, 41, 47, 59, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 116, 111, 82, 101, 97, 108, 80, 97, 116, 104, 40, 114, 101, 113, 117, 101, 115, 116, 80, 97, 116, 104, 41, 32, 123, 10, 32, 32, 114, 101, 113, 117, 101, 115, 116, 80, 97, 116, 104, 32, 61, 32, 112, 97, 116, 104, 46, 114, 101, 115, 111, 108, 118, 101, 40, 114, 101, 113, 117, 101, 115, 116, 80, 97, 116, 104, 41, 59, 10, 32, 32, 105, 102, 32, 40, 107, 65, 114, 99, 104, 105, 118, 101, 80, 97, 116, 104, 46, 116, 101, 115, 116, 40, 114, 101, 113, 117, 101, 115, 116, 80, 97, 116, 104, 41, 41, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 114, 101, 113, 117, 101, 115, 116, 80, 97, 116, 104, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 99, 97, 99, 104, 101, 32, 61, 32, 77, 111, 100, 117, 108, 101, 46, 95, 114, 101, 97, 108, 112, 97, 116, 104, 67, 97, 99, 104, 101, 59, 10, 32, 32, 105, 102, 32, 40, 79, 98, 106, 101, 99, 116, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 104, 97, 115, 79, 119, 110, 80, 114, 111, 112, 101, 114, 116, 121, 46, 99, 97, 108, 108, 40, 99, 97, 99, 104, 101, 44, 32, 114, 101, 113, 117, 101, 115, 116, 80, 97, 116, 104, 41, 41, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 99, 97, 99, 104, 101, 91, 114, 101, 113, 117, 101, 115, 116, 80, 97, 116, 104, 93, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 99, 97, 99, 104, 101, 91, 114, 101, 113, 117, 101, 115, 116, 80, 97, 116, 104, 93, 32, 61, 32, 105, 110, 116, 101, 114, 110, 97, 108, 82, 101, 97, 108, 80, 97, 116, 104, 40, 112, 97, 116, 104, 46, 95, 109, 97, 107, 101, 76, 111, 110, 103, 40, 114, 101, 113, 117, 101, 115, 116, 80, 97, 116, 104, 41, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 33, 33, 77, 111, 100, 117, 108, 101, 46, 95, 115, 104, 97, 114, 101, 100, 82, 101, 97, 108, 112, 97, 116, 104, 67, 97, 99, 104, 101, 41, 59, 10, 125, 10, 10, 47, 47, 32, 103, 105, 118, 101, 110, 32, 97, 32, 112, 97, 116, 104, 32, 99, 104, 101, 99, 107, 32, 97, 32, 116, 104, 101, 32, 102, 105, 108, 101, 32, 101, 120, 105, 115, 116, 115, 32, 119, 105, 116, 104, 32, 97, 110, 121, 32, 111, 102, 32, 116, 104, 101, 32, 115, 101, 116, 32, 101, 120, 116, 101, 110, 115, 105, 111, 110, 115, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 116, 114, 121, 69, 120, 116, 101, 110, 115, 105, 111, 110, 115, 40, 112, 44, 32, 101, 120, 116, 115, 41, 32, 123, 10, 32, 32, 102, 111, 114, 32, 40, 118, 97, 114, 32, 105, 32, 61, 32, 48, 44, 32, 69, 76, 32, 61, 32, 101, 120, 116, 115, 46, 108, 101, 110, 103, 116, 104, 59, 32, 105, 32, 60, 32, 69, 76, 59, 32, 105, 43, 43, 41, 32, 123, 10, 32, 32, 32, 32, 118, 97, 114, 32, 102, 105, 108, 101, 110, 97, 109, 101, 32, 61, 32, 116, 114, 121, 70, 105, 108, 101, 40, 112, 32, 43, 32, 101, 120, 116, 115, 91, 105, 93, 41, 59, 10, 10, 32, 32, 32, 32, 105, 102, 32, 40, 102, 105, 108, 101, 110, 97, 109, 101, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 102, 105, 108, 101, 110, 97, 109, 101, 59, 10, 32, 32, 32, 32, 125, 10, 32, 32, 125, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 102, 97, 108, 115, 101, 59, 10, 125, 10, 10, 118, 97, 114, 32, 119, 97, 114, 110, 101, 100, 32, 61, 32, 102, 97, 108, 115, 101, 59, 10, 77, 111, 100, 117, 108, 101, 46, 95, 102, 105, 110, 100, 80, 97, 116, 104, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 114, 101, 113, 117, 101, 115, 116, 44, 32, 112, 97, 116, 104, 115, 41, 32, 123, 10, 32, 32, 105, 102, 32, 40, 112, 97, 116, 104, 46, 105, 115, 65, 98, 115, 111, 108, 117, 116, 101, 40, 114, 101, 113, 117, 101, 115, 116, 41, 41, 32, 123, 10, 32, 32, 32, 32, 112, 97, 116, 104, 115, 32, 61, 32, 91, 39, 39, 93, 59, 10, 32, 32, 125, 10, 10, 32, 32, 118, 97, 114, 32, 99, 97, 99, 104, 101, 75, 101, 121, 32, 61, 32, 74, 83, 79, 78, 46, 115, 116, 114, 105, 110, 103, 105, 102, 121, 40, 123, 114, 101, 113, 117, 101, 115, 116, 58, 32, 114, 101, 113, 117, 101, 115, 116, 44, 32, 112, 97, 116, 104, 115, 58, 32, 112, 97, 116, 104, 115, 125, 41, 59, 10, 32, 32, 105, 102, 32, 40, 77, 111, 100, 117, 108, 101, 46, 95, 112, 97, 116, 104, 67, 97, 99, 104, 101, 91, 99, 97, 99, 104, 101, 75, 101, 121, 93, 41, 32, 123, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 77, 111, 100, 117, 108, 101, 46, 95, 112, 97, 116, 104, 67, 97, 99, 104, 101, 91, 99, 97, 99, 104, 101, 75, 101, 121, 93, 59, 10, 32, 32, 125, 10, 10, 32, 32, 99, 111, 110, 115, 116, 32, 101, 120, 116, 115, 32, 61, 32, 79, 98, 106, 101, 99, 116, 46, 107, 101, 121, 115, 40, 77, 111, 100, 117, 108, 101, 46, 95, 101, 120, 116, 101, 110, 115, 105, 111, 110, 115, 41, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 116, 114, 97, 105, 108, 105, 110, 103, 83, 108, 97, 115, 104, 32, 61, 32, 114, 101, 113, 117, 101, 115, 116, 46, 115, 108, 105, 99, 101, 40, 45, 49, 41, 32, 61, 61, 61, 32, 39, 47, 39, 59, 10, 10, 32, 32, 118, 97, 114, 32, 105, 44, 32, 80, 76, 59, 10, 10, 32, 32, 105, 102, 32, 40, 77, 111, 100, 117, 108, 101, 46, 95, 110, 97, 116, 105, 118, 101, 82, 101, 115, 111, 108, 118, 101, 114, 41, 32, 123, 10, 32, 32, 32, 32, 118, 97, 114, 32, 98, 97, 115, 101, 115, 32, 61, 32, 91, 93, 59, 10, 32, 32, 32, 32, 102, 111, 114, 32, 40, 105, 32, 61, 32, 48, 44, 32, 80, 76, 32, 61, 32, 112, 97, 116, 104, 115, 46, 108, 101, 110, 103, 116, 104, 59, 32, 105, 32, 60, 32, 80, 76, 59, 32, 105, 43, 43, 41, 10, 32, 32, 32, 32, 32, 32, 98, 97, 115, 101, 115, 46, 112, 117, 115, 104, 40, 112, 97, 116, 104, 46, 114, 101, 115, 111, 108, 118, 101, 40, 112, 97, 116, 104, 115, 91, 105, 93, 44, 32, 114, 101, 113, 117, 101, 115, 116, 41, 41, 59, 10, 10, 32, 32, 32, 32, 47, 47, 32, 117, 110, 100, 101, 102, 105, 110, 101, 100, 32, 108, 101, 97, 118, 101, 115, 32, 112, 97, 99, 107, 97, 103, 101, 46, 106, 115, 111, 110, 32, 102, 105, 108, 101, 115, 32, 105, 116, 32, 99, 97, 110, 39, 116, 32, 104, 97, 110, 100, 108, 101, 32, 116, 111, 32, 116, 104, 101, 32, 74, 83, 32, 111, 110, 101, 10, 32, 32, 32, 32, 118, 97, 114, 32, 102, 111, 117, 110, 100, 32, 61, 32, 105, 110, 116, 101, 114, 110, 97, 108, 77, 111, 100, 117, 108, 101, 82, 101, 115, 111, 108, 118, 101, 40, 112, 97, 116, 104, 115, 44, 32, 98, 97, 115, 101, 115, 44, 32, 101, 120, 116, 115, 44, 32, 116, 114, 97, 105, 108, 105, 110, 103, 83, 108, 97, 115, 104, 41, 59, 10, 32, 32, 32, 32, 105, 102, 32, 40, 102, 111, 117, 110, 100, 32, 61, 61, 61, 32, 102, 97, 108, 115, 101, 41, 10, 32, 32, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 102, 97, 108, 115, 101, 59, 10, 32, 32, 32, 32, 105, 102, 32, 40, 102, 111, 117, 110, 100, 32, 33, 61, 61, 32, 117, 110, 100, 101, 102, 105, 110, 101, 100, 41, 10, 32, 32, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 99, 97, 99, 104, 101, 70, 111, 117, 110, 100, 80, 97, 116, 104, 40, 114, 101, 113, 117, 101, 115, 116, 44, 32, 99, 97, 99, 104, 101, 75, 101, 121, 44, 32, 116, 111, 82, 101, 97, 108, 80, 97, 116, 104, 40, 102, 111, 117, 110, 100, 91, 48, 93, 41, 44, 32, 102, 111, 117, 110, 100, 91, 49, 93, 41, 59, 10, 32, 32, 125, 10, 10, 32, 32, 47, 47, 32, 70, 111, 114, 32, 101, 97, 99, 104, 32, 112, 97, 116, 104, 10, 32, 32, 102, 111, 114, 32, 40, 105, 32, 61, 32, 48, 44, 32, 80, 76, 32, 61, 32, 112, 97, 116, 104, 115, 46, 108, 101, 110, 103, 116, 104, 59, 32, 105, 32, 60, 32, 80, 76, 59, 32, 105, 43, 43, 41, 32, 123, 10, 32, 32, 32, 32, 47, 47, 32, 68, 111, 110, 39, 116, 32, 115, 101, 97, 114, 99, 104, 32, 102, 117, 114, 116, 104, 101, 114, 32, 105, 102, 32, 112, 97, 116, 104, 32, 100, 111, 101, 115, 110, 39, 116, 32, 101, 120, 105, 115, 116, 10, 32, 32, 32, 32, 105, 102, 32, 40, 112, 97, 116, 104, 115, 91, 105, 93, 32, 38, 38, 32, 105, 110, 116, 101, 114, 110, 97, 108, 77, 111, 100, 117, 108, 101, 83, 116, 97, 116, 40, 112, 97, 116, 104, 46, 95, 109, 97, 107, 101, 76, 111, 110, 103, 40, 112, 97, 116, 104, 115, 91, 105, 93, 41, 41, 32, 60, 32, 49, 41, 32, 99, 111, 110, 116, 105, 110, 117, 101, 59, 10, 32, 32, 32, 32, 118, 97, 114, 32, 98, 97, 115, 101, 80, 97, 116, 104, 32, 61, 32, 112, 97, 116, 104, 46, 114, 101, 115, 111, 108, 118, 101, 40, 112, 97, 116, 104, 115, 91, 105, 93, 44, 32, 114, 101, 113, 117, 101, 115, 116, 41, 59, 10, 32, 32, 32, 32, 118, 97, 114, 32, 102, 105, 108, 101, 110, 97, 109, 101, 59, 10, 10, 32, 32, 32, 32, 105, 102, 32, 40, 33, 116, 114, 97, 105, 108, 105, 110, 103, 83, 108, 97, 115, 104, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 114, 99, 32, 61, 32, 105, 110, 116, 101, 114, 110, 97, 108, 77, 111, 100, 117, 108, 101, 83, 116, 97, 116, 40, 112, 97, 116, 104, 46, 95, 109, 97, 107, 101, 76, 111, 110, 103, 40, 98, 97, 115, 101, 80, 97, 116, 104, 41, 41, 59, 10, 32, 32, 32, 32, 32, 32, 105, 102, 32, 40, 114, 99, 32, 61, 61, 61, 32, 48, 41, 32, 123, 32, 32, 47, 47, 32, 70, 105, 108, 101, 46, 10, 32, 32, 32, 32, 32, 32, 32, 32, 102, 105, 108, 101, 110, 97, 109, 101, 32, 61, 32, 116, 111, 82, 101, 97, 108, 80, 97, 116, 104, 40, 98, 97, 115, 101, 80, 97, 116, 104, 41, 59, 10, 32, 32, 32, 32, 32, 32, 125, 32, 101, 108, 115, 101, 32, 105, 102, 32, 40, 114, 99, 32, 61, 61, 61, 32, 49, 41, 32, 123, 32, 32, 47, 47, 32, 68, 105, 114, 101, 99, 116, 111, 114, 121, 46, 10, 32, 32, 32, 32, 32, 32, 32, 32, 102, 105, 108, 101, 110, 97, 109, 101, 32, 61, 32, 116, 114, 121, 80, 97, 99, 107, 97, 103, 101, 40, 98, 97, 115, 101, 80, 97, 116, 104, 44, 32, 101, 120, 116, 115, 41, 59, 10, 32, 32, 32, 32, 32, 32, 125, 10, 10, 32, 32, 32, 32, 32, 32, 105, 102, 32, 40, 33, 102, 105, 108, 101, 110, 97, 109, 101, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 47, 47, 32, 116, 114, 121, 32, 105, 116, 32, 119, 105, 116, 104, 32, 101, 97, 99, 104, 32, 111, 102, 32, 116, 104, 101, 32, 101, 120, 116, 101, 110, 115, 105, 111, 110, 115, 10, 32, 32, 32, 32, 32, 32, 32, 32, 102, 105, 108, 101, 110, 97, 109, 101, 32, 61, 32, 116, 114, 121, 69, 120, 116, 101, 110, 115, 105, 111, 110, 115, 40, 98, 97, 115, 101, 80, 97, 116, 104, 44, 32, 101, 120, 116, 115, 41, 59, 10, 32, 32, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 125, 10, 10, 32, 32, 32, 32, 105, 102, 32, 40, 33, 102, 105, 108, 101, 110, 97, 109, 101, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 102, 105, 108, 101, 110, 97, 109, 101, 32, 61, 32, 116, 114, 121, 80, 97, 99, 107, 97, 103, 101, 40, 98, 97, 115, 101, 80, 97, 116, 104, 44, 32, 101, 120, 116, 115, 41, 59, 10, 32, 32, 32, 32, 125, 10, 10, 32, 32, 32, 32, 105, 102, 32, 40, 33, 102, 105, 108, 101, 110, 97, 109, 101, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 47, 47, 32, 116, 114, 121, 32, 105, 116, 32, 119, 105, 116, 104, 32, 101, 97, 99, 104, 32, 111, 102, 32, 116, 104, 101, 32, 101, 120, 116, 101, 110, 115, 105, 111, 110, 115, 32, 97, 116, 32, 34, 105, 110, 100, 101, 120, 34, 10, 32, 32, 32, 32, 32, 32, 102, 105, 108, 101, 110, 97, 109, 101, 32, 61, 32, 116, 114, 121, 69, 120, 116, 101, 110, 115, 105, 111, 110, 115, 40, 112, 97, 116, 104, 46, 114, 101, 115, 111, 108, 118, 101, 40, 98, 97, 115, 101, 80, 97, 116, 104, 44, 32, 39, 105, 110, 100, 101, 120, 39, 41, 44, 32, 101, 120, 116, 115, 41, 59, 10, 32, 32, 32, 32, 125, 10, 10, 32, 32, 32, 32, 105, 102, 32, 40, 102, 105, 108, 101, 110, 97, 109, 101, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 99, 97, 99, 104, 101, 70, 111, 117, 110, 100, 80, 97, 116, 104, 40, 114, 101, 113, 117, 101, 115, 116, 44, 32, 99, 97, 99, 104, 101, 75, 101, 121, 44, 32, 102, 105, 108, 101, 110, 97, 109, 101, 44, 32, 105, 41, 59, 10, 32, 32, 32, 32, 125, 10, 32, 32, 125, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 102, 97, 108, 115, 101, 59, 10, 125, 59, 10, 10, 102, 117, 110, 99, 116, 105, 111, 110, 32, 99, 97, 99, 104, 101, 70, 111, 117, 110, 100, 80, 97, 116, 104, 40, 114, 101, 113, 117, 101, 115, 116, 44, 32, 99, 97, 99, 104, 101, 75, 101, 121, 44, 32, 102, 105, 108, 101, 110, 97, 109, 101, 44, 32, 105, 110, 100, 101, 120, 41, 32, 123, 10, 32, 32, 47, 47, 32, 87, 97, 114, 110, 32, 111, 110, 99, 101, 32, 105, 102, 32, 39, 46, 39, 32, 114, 101, 115, 111, 108, 118, 101, 100, 32, 111, 117, 116, 115, 105, 100, 101, 32, 116, 104, 101, 32, 109, 111, 100, 117, 108, 101, 32, 100, 105, 114, 10, 32, 32, 105, 102, 32, 40, 114, 101, 113, 117, 101, 115, 116, 32, 61, 61, 61, 32, 39, 46, 39, 32, 38, 38, 32, 105, 110, 100, 101, 120, 32, 62, 32, 48, 41, 32, 123, 10, 32, 32, 32, 32, 119, 97, 114, 110, 101, 100, 32, 61, 32, 105, 110, 116, 101, 114, 110, 97, 108, 85, 116, 105, 108, 46, 112, 114, 105, 110, 116, 68, 101, 112, 114, 101, 99, 97, 116, 105, 111, 110, 77, 101, 115, 115, 97, 103, 101, 40, 10, 32, 32, 32, 32, 32, 32, 39, 119, 97, 114, 110, 105, 110, 103, 58, 32, 114, 101, 113, 117, 105, 114, 101, 40, 92, 39, 46, 92, 39, 41, 32, 114, 101, 115, 111, 108, 118, 101, 100, 32, 111, 117, 116, 115, 105, 100, 101, 32, 116, 104, 101, 32, 112, 97, 99, 107, 97, 103, 101, 32, 39, 32, 43, 10, 32, 32, 32, 32, 32, 32, 39, 100, 105, 114, 101, 99, 116, 111, 114, 121, 46, 32, 84, 104, 105, 115, 32, 102, 117, 110, 99, 116, 105, 111, 110, 97, 108, 105, 116, 121, 32, 105, 115, 32, 100, 101, 112, 114, 101, 99, 97, 116, 101, 100, 32, 97, 110, 100, 32, 119, 105, 108, 108, 32, 98, 101, 32, 114, 101, 109, 111, 118, 101, 100, 32, 39, 32, 43, 10, 32, 32, 32, 32, 32, 32, 39, 115, 111, 111, 110, 46, 39, 44, 32, 119, 97, 114, 110, 101, 100, 41, 59, 10, 32, 32, 125, 10, 10, 32, 32, 77, 111, 100, 117, 108, 101, 46, 95, 112, 97, 116, 104, 67, 97, 99, 104, 101, 91, 99, 97, 99, 104, 101, 75, 101, 121, 93, 32, 61, 32, 102, 105, 108, 101, 110, 97, 109, 101, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 102, 105, 108, 101, 110, 97, 109, 101, 59, 10, 125, 10, 10, 47, 47, 32, 39, 102, 114, 111, 109, 39, 32, 105, 115, 32, 116, 104, 101, 32, 95, 95, 100, 105, 114, 110, 97, 109, 101, 32, 111, 102, 32, 116, 104, 101, 32, 109, 111, 100, 117, 108, 101, 46, 10, 77, 111, 100, 117, 108, 101, 46, 95, 110, 111, 100, 101, 77, 111, 100, 117, 108, 101, 80, 97, 116, 104, 115, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 102, 114, 111, 109, 41, 32, 123, 10, 32, 32, 47, 47, 32, 103, 117, 97, 114, 97, 110, 116, 101, 101, 32, 116, 104, 97, 116, 32, 39, 102, 114, 111, 109, 39, 32, 105, 115, 32, 97, 98, 115, 111, 108, 117, 116, 101, 46, 10, 32, 32, 102, 114, 111, 109, 32, 61, 32, 112, 97, 116, 104, 46, 114, 101, 115, 111, 108, 118, 101, 40, 102, 114, 111, 109, 41, 59, 10, 10, 32, 32, 47, 47, 32, 110, 111, 116, 101, 58, 32, 116, 104, 105, 115, 32, 97, 112, 112, 114, 111, 97, 99, 104, 32, 42, 111, 110, 108, 121, 42, 32, 119, 111, 114, 107, 115, 32, 119, 104, 101, 110, 32, 116, 104, 101, 32, 112, 97, 116, 104, 32, 105, 115, 32, 103, 117, 97, 114, 97, 110, 116, 101, 101, 100, 10, 32, 32, 47, 47, 32, 116, 111, 32, 98, 101, 32, 97, 98, 115, 111, 108, 117, 116, 101, 46, 32, 32, 68, 111, 105, 110, 103, 32, 97, 32, 102, 117, 108, 108, 121, 45, 101, 100, 103, 101, 45, 99, 97, 115, 101, 45, 99, 111, 114, 114, 101, 99, 116, 32, 112, 97, 116, 104, 46, 115, 112, 108, 105, 116, 10, 32, 32, 47, 47, 32, 116, 104, 97, 116, 32, 119, 111, 114, 107, 115, 32, 111, 110, 32, 98, 111, 116, 104, 32, 87, 105, 110, 100, 111, 119, 115, 32, 97, 110, 100, 32, 80, 111, 115, 105, 120, 32, 105, 115, 32, 110, 111, 110, 45, 116, 114, 105, 118, 105, 97, 108, 46, 10, 32, 32, 118, 97, 114, 32, 112, 97, 116, 104, 115, 32, 61, 32, 91, 93, 59, 10, 32, 32, 118, 97, 114, 32, 112, 97, 114, 116, 115, 32, 61, 32, 102, 114, 111, 109, 46, 115, 112, 108, 105, 116, 40, 115, 112, 108, 105, 116, 82, 101, 41, 59, 10, 10, 32, 32, 102, 111, 114, 32, 40, 118, 97, 114, 32, 116, 105, 112, 32, 61, 32, 112, 97, 114, 116, 115, 46, 108, 101, 110, 103, 116, 104, 32, 45, 32, 49, 59, 32, 116, 105, 112, 32, 62, 61, 32, 48, 59, 32, 116, 105, 112, 45, 45, 41, 32, 123, 10, 32, 32, 32, 32, 47, 47, 32, 100, 111, 110, 39, 116, 32, 115, 101, 97, 114, 99, 104, 32, 105, 110, 32, 46, 46, 46, 47, 110, 111, 100, 101, 95, 109, 111, 100, 117, 108, 101, 115, 47, 110, 111, 100, 101, 95, 109, 111, 100, 117, 108, 101, 115, 10, 32, 32, 32, 32, 105, 102, 32, 40, 112, 97, 114, 116, 115, 91, 116, 105, 112, 93, 32, 61, 61, 61, 32, 39, 110, 111, 100, 101, 95, 109, 111, 100, 117, 108, 101, 115, 39, 41, 32, 99, 111, 110, 116, 105, 110, 117, 101, 59, 10, 32, 32, 32, 32, 118, 97, 114, 32, 100, 105, 114, 32, 61, 32, 112, 97, 114, 116, 115, 46, 115, 108, 105, 99, 101, 40, 48, 44, 32, 116, 105, 112, 32, 43, 32, 49, 41, 46, 99, 111, 110, 99, 97, 116, 40, 39, 110, 111, 100, 101, 95, 109, 111, 100, 117, 108, 101, 115, 39, 41, 46, 106, 111, 105, 110, 40, 112, 97, 116, 104, 46, 115, 101, 112, 41, 59, 10, 32, 32, 32, 32, 112, 97, 116, 104, 115, 46, 112, 117, 115, 104, 40, 100, 105, 114, 41, 59, 10, 32, 32, 125, 10, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 112, 97, 116, 104, 115, 59, 10, 125, 59, 10, 10, 10, 77, 111, 100, 117, 108, 101, 46, 95, 114, 101, 115, 111, 108, 118, 101, 76, 111, 111, 107, 117, 112, 80, 97, 116, 104, 115, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 114, 101, 113, 117, 101, 115, 116, 44, 32, 112, 97, 114, 101, 110, 116, 41, 32, 123, 10, 32, 32, 105, 102, 32, 40, 78, 97, 116, 105, 118, 101, 77, 111, 100, 117, 108, 101, 46, 110, 111, 110, 73, 110, 116, 101, 114, 110, 97, 108, 69, 120, 105, 115, 116, 115, 40, 114, 101, 113, 117, 101, 115, 116, 41, 41, 32, 123, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 91, 114, 101, 113, 117, 101, 115, 116, 44, 32, 91, 93, 93, 59, 10, 32, 32, 125, 10, 10, 32, 32, 118, 97, 114, 32, 115, 116, 97, 114, 116, 32, 61, 32, 114, 101, 113, 117, 101, 115, 116, 46, 115, 117, 98, 115, 116, 114, 105, 110, 103, 40, 48, 44, 32, 50, 41, 59, 10, 32, 32, 105, 102, 32, 40, 115, 116, 97, 114, 116, 32, 33, 61, 61, 32, 39, 46, 47, 39, 32, 38, 38, 32, 115, 116, 97, 114, 116, 32, 33, 61, 61, 32, 39, 46, 46, 39, 41, 32, 123, 10, 32, 32, 32, 32, 118, 97, 114, 32, 112, 97, 116, 104, 115, 32, 61, 32, 109, 111, 100, 117, 108, 101, 80, 97, 116, 104, 115, 59, 10, 32, 32, 32, 32, 105, 102, 32, 40, 112, 97, 114, 101, 110, 116, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 105, 102, 32, 40, 33, 112, 97, 114, 101, 110, 116, 46, 112, 97, 116, 104, 115, 41, 32, 112, 97, 114, 101, 110, 116, 46, 112, 97, 116, 104, 115, 32, 61, 32, 91, 93, 59, 10, 32, 32, 32, 32, 32, 32, 112, 97, 116, 104, 115, 32, 61, 32, 112, 97, 114, 101, 110, 116, 46, 112, 97, 116, 104, 115, 46, 99, 111, 110, 99, 97, 116, 40, 112, 97, 116, 104, 115, 41, 59, 10, 32, 32, 32, 32, 125, 10, 10, 32, 32, 32, 32, 47, 47, 32, 77, 97, 105, 110, 116, 97, 105, 110, 32, 98, 97, 99, 107, 119, 97, 114, 100, 115, 32, 99, 111, 109, 112, 97, 116, 32, 119, 105, 116, 104, 32, 99, 101, 114, 116, 97, 105, 110, 32, 98, 114, 111, 107, 101, 110, 32, 117, 115, 101, 115, 32, 111, 102, 32, 114, 101, 113, 117, 105, 114, 101, 40, 39, 46, 39, 41, 10, 32, 32, 32, 32, 47, 47, 32, 98, 121, 32, 112, 117, 116, 116, 105, 110, 103, 32, 116, 104, 101, 32, 109, 111, 100, 117, 108, 101, 39, 115, 32, 100, 105, 114, 101, 99, 116, 111, 114, 121, 32, 105, 110, 32, 102, 114, 111, 110, 116, 32, 111, 102, 32, 116, 104, 101, 32, 108, 111, 111, 107, 117, 112, 32, 112, 97, 116, 104, 115, 46, 10, 32, 32, 32, 32, 105, 102, 32, 40, 114, 101, 113, 117, 101, 115, 116, 32, 61, 61, 61, 32, 39, 46, 39, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 105, 102, 32, 40, 112, 97, 114, 101, 110, 116, 32, 38, 38, 32, 112, 97, 114, 101, 110, 116, 46, 102, 105, 108, 101, 110, 97, 109, 101, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 112, 97, 116, 104, 115, 46, 115, 112, 108, 105, 99, 101, 40, 48, 44, 32, 48, 44, 32, 112, 97, 116, 104, 46, 100, 105, 114, 110, 97, 109, 101, 40, 112, 97, 114, 101, 110, 116, 46, 102, 105, 108, 101, 110, 97, 109, 101, 41, 41, 59, 10, 32, 32, 32, 32, 32, 32, 125, 32, 101, 108, 115, 101, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 112, 97, 116, 104, 115, 46, 115, 112, 108, 105, 99, 101, 40, 48, 44, 32, 48, 44, 32, 112, 97, 116, 104, 46, 114, 101, 115, 111, 108, 118, 101, 40, 114, 101, 113, 117, 101, 115, 116, 41, 41, 59, 10, 32, 32, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 125, 10, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 91, 114, 101, 113, 117, 101, 115, 116, 44, 32, 112, 97, 116, 104, 115, 93, 59, 10, 32, 32, 125, 10, 10, 32, 32, 47, 47, 32, 119, 105, 116, 104, 32, 45, 45, 101, 118, 97, 108, 44, 32, 112, 97, 114, 101, 110, 116, 46, 105, 100, 32, 105, 115, 32, 110, 111, 116, 32, 115, 101, 116, 32, 97, 110, 100, 32, 112, 97, 114, 101, 110, 116, 46, 102, 105, 108, 101, 110, 97, 109, 101, 32, 105, 115, 32, 110, 117, 108, 108, 10, 32, 32, 105, 102, 32, 40, 33, 112, 97, 114, 101, 110, 116, 32, 124, 124, 32, 33, 112, 97, 114, 101, 110, 116, 46, 105, 100, 32, 124, 124, 32, 33, 112, 97, 114, 101, 110, 116, 46, 102, 105, 108, 101, 110, 97, 109, 101, 41, 32, 123, 10, 32, 32, 32, 32, 47, 47, 32, 109, 97, 107, 101, 32, 114, 101, 113, 117, 105, 114, 101, 40, 39, 46, 47, 112, 97, 116, 104, 47, 116, 111, 47, 102, 111, 111, 39, 41, 32, 119, 111, 114, 107, 32, 45, 32, 110, 111, 114, 109, 97, 108, 108, 121, 32, 116, 104, 101, 32, 112, 97, 116, 104, 32, 105, 115, 32, 116, 97, 107, 101, 110, 10, 32, 32, 32, 32, 47, 47, 32, 102, 114, 111, 109, 32, 114, 101, 97, 108, 112, 97, 116, 104, 40, 95, 95, 102, 105, 108, 101, 110, 97, 109, 101, 41, 32, 98, 117, 116, 32, 119, 105, 116, 104, 32, 101, 118, 97, 108, 32, 116, 104, 101, 114, 101, 32, 105, 115, 32, 110, 111, 32, 102, 105, 108, 101, 110, 97, 109, 101, 10, 32, 32, 32, 32, 118, 97, 114, 32, 109, 97, 105, 110, 80, 97, 116, 104, 115, 32, 61, 32, 91, 39, 46, 39, 93, 46, 99, 111, 110, 99, 97, 116, 40, 109, 111, 100, 117, 108, 101, 80, 97, 116, 104, 115, 41, 59, 10, 32, 32, 32, 32, 109, 97, 105, 110, 80, 97, 116, 104, 115, 32, 61, 32, 77, 111, 100, 117, 108, 101, 46, 95, 110, 111, 100, 101, 77, 111, 100, 117, 108, 101, 80, 97, 116, 104, 115, 40, 39, 46, 39, 41, 46, 99, 111, 110, 99, 97, 116, 40, 109, 97, 105, 110, 80, 97, 116, 104, 115, 41, 59, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 91, 114, 101, 113, 117, 101, 115, 116, 44, 32, 109, 97, 105, 110, 80, 97, 116, 104, 115, 93, 59, 10, 32, 32, 125, 10, 10, 32, 32, 47, 47, 32, 73, 115, 32, 116, 104, 101, 32, 112, 97, 114, 101, 110, 116, 32, 97, 110, 32, 105, 110, 100, 101, 120, 32, 109, 111, 100, 117, 108, 101, 63, 10, 32, 32, 47, 47, 32, 87, 101, 32, 99, 97, 110, 32, 97, 115, 115, 117, 109, 101, 32, 116, 104, 101, 32, 112, 97, 114, 101, 110, 116, 32, 104, 97, 115, 32, 97, 32, 118, 97, 108, 105, 100, 32, 101, 120, 116, 101, 110, 115, 105, 111, 110, 44, 10, 32, 32, 47, 47, 32, 97, 115, 32, 105, 116, 32, 97, 108, 114, 101, 97, 100, 121, 32, 104, 97, 115, 32, 98, 101, 101, 110, 32, 97, 99, 99, 101, 112, 116, 101, 100, 32, 97, 115, 32, 97, 32, 109, 111, 100, 117, 108, 101, 46, 10, 32, 32, 118, 97, 114, 32, 105, 115, 73, 110, 100, 101, 120, 32, 61, 32, 105, 115, 73, 110, 100, 101, 120, 82, 101, 46, 116, 101, 115, 116, 40, 112, 97, 116, 104, 46, 98, 97, 115, 101, 110, 97, 109, 101, 40, 112, 97, 114, 101, 110, 116, 46, 102, 105, 108, 101, 110, 97, 109, 101, 41, 41, 59, 10, 32, 32, 118, 97, 114, 32, 112, 97, 114, 101, 110, 116, 73, 100, 80, 97, 116, 104, 32, 61, 32, 105, 115, 73, 110, 100, 101, 120, 32, 63, 32, 112, 97, 114, 101, 110, 116, 46, 105, 100, 32, 58, 32, 112, 97, 116, 104, 46, 100, 105, 114, 110, 97, 109, 101, 40, 112, 97, 114, 101, 110, 116, 46, 105, 100, 41, 59, 10, 32, 32, 118, 97, 114, 32, 105, 100, 32, 61, 32, 112, 97, 116, 104, 46, 114, 101, 115, 111, 108, 118, 101, 40, 112, 97, 114, 101, 110, 116, 73, 100, 80, 97, 116, 104, 44, 32, 114, 101, 113, 117, 101, 115, 116, 41, 59, 10, 10, 32, 32, 47, 47, 32, 109, 97, 107, 101, 32, 115, 117, 114, 101, 32, 114, 101, 113, 117, 105, 114, 101, 40, 39, 46, 47, 112, 97, 116, 104, 39, 41, 32, 97, 110, 100, 32, 114, 101, 113, 117, 105, 114, 101, 40, 39, 112, 97, 116, 104, 39, 41, 32, 103, 101, 116, 32, 100, 105, 115, 116, 105, 110, 99, 116, 32, 105, 100, 115, 44, 32, 101, 118, 101, 110, 10, 32, 32, 47, 47, 32, 119, 104, 101, 110, 32, 99, 97, 108, 108, 101, 100, 32, 102, 114, 111, 109, 32, 116, 104, 101, 32, 116, 111, 112, 108, 101, 118, 101, 108, 32, 106, 115, 32, 102, 105, 108, 101, 10, 32, 32, 105, 102, 32, 40, 112, 97, 114, 101, 110, 116, 73, 100, 80, 97, 116, 104, 32, 61, 61, 61, 32, 39, 46, 39, 32, 38, 38, 32, 105, 100, 46, 105, 110, 100, 101, 120, 79, 102, 40, 39, 47, 39, 41, 32, 61, 61, 61, 32, 45, 49, 41, 32, 123, 10, 32, 32, 32, 32, 105, 100, 32, 61, 32, 39, 46, 47, 39, 32, 43, 32, 105, 100, 59, 10, 32, 32, 125, 10, 10, 32, 32, 100, 101, 98, 117, 103, 40, 39, 82, 69, 76, 65, 84, 73, 86, 69, 58, 32, 114, 101, 113, 117, 101, 115, 116, 101, 100, 58, 32, 37, 115, 32, 115, 101, 116, 32, 73, 68, 32, 116, 111, 58, 32, 37, 115, 32, 102, 114, 111, 109, 32, 37, 115, 39, 44, 32, 114, 101, 113, 117, 101, 115, 116, 44, 32, 105, 100, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 112, 97, 114, 101, 110, 116, 46, 105, 100, 41, 59, 10, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 91, 105, 100, 44, 32, 91, 112, 97, 116, 104, 46, 100, 105, 114, 110, 97, 109, 101, 40, 112, 97, 114, 101, 110, 116, 46, 102, 105, 108, 101, 110, 97, 109, 101, 41, 93, 93, 59, 10, 125, 59, 10, 10, 10, 47, 47, 32, 67, 104, 101, 99, 107, 32, 116, 104, 101, 32, 99, 97, 99, 104, 101, 32, 102, 111, 114, 32, 116, 104, 101, 32, 114, 101, 113, 117, 101, 115, 116, 101, 100, 32, 102, 105, 108, 101, 46, 10, 47, 47, 32, 49, 46, 32, 73, 102, 32, 97, 32, 109, 111, 100, 117, 108, 101, 32, 97, 108, 114, 101, 97, 100, 121, 32, 101, 120, 105, 115, 116, 115, 32, 105, 110, 32, 116, 104, 101, 32, 99, 97, 99, 104, 101, 58, 32, 114, 101, 116, 117, 114, 110, 32, 105, 116, 115, 32, 101, 120, 112, 111, 114, 116, 115, 32, 111, 98, 106, 101, 99, 116, 46, 10, 47, 47, 32, 50, 46, 32, 73, 102, 32, 116, 104, 101, 32, 109, 111, 100, 117, 108, 101, 32, 105, 115, 32, 110, 97, 116, 105, 118, 101, 58, 32, 99, 97, 108, 108, 32, 96, 78, 97, 116, 105, 118, 101, 77, 111, 100, 117, 108, 101, 46, 114, 101, 113, 117, 105, 114, 101, 40, 41, 96, 32, 119, 105, 116, 104, 32, 116, 104, 101, 10, 47, 47, 32, 32, 32, 32, 102, 105, 108, 101, 110, 97, 109, 101, 32, 97, 110, 100, 32, 114, 101, 116, 117, 114, 110, 32, 116, 104, 101, 32, 114, 101, 115, 117, 108, 116, 46, 10, 47, 47, 32, 51, 46, 32, 79, 116, 104, 101, 114, 119, 105, 115, 101, 44, 32, 99, 114, 101, 97, 116, 101, 32, 97, 32, 110, 101, 119, 32, 109, 111, 100, 117, 108, 101, 32, 102, 111, 114, 32, 116, 104, 101, 32, 102, 105, 108, 101, 32, 97, 110, 100, 32, 115, 97, 118, 101, 32, 105, 116, 32, 116, 111, 32, 116, 104, 101, 32, 99, 97, 99, 104, 101, 46, 10, 47, 47, 32, 32, 32, 32, 84, 104, 101, 110, 32, 104, 97, 118, 101, 32, 105, 116, 32, 108, 111, 97, 100, 32, 32, 116, 104, 101, 32, 102, 105, 108, 101, 32, 99, 111, 110, 116, 101, 110, 116, 115, 32, 98, 101, 102, 111, 114, 101, 32, 114, 101, 116, 117, 114, 110, 105, 110, 103, 32, 105, 116, 115, 32, 101, 120, 112, 111, 114, 116, 115, 10, 47, 47, 32, 32, 32, 32, 111, 98, 106, 101, 99, 116, 46, 10, 77, 111, 100, 117, 108, 101, 46, 95, 108, 111, 97, 100, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 114, 101, 113, 117, 101, 115, 116, 44, 32, 112, 97, 114, 101, 110, 116, 44, 32, 105, 115, 77, 97, 105, 110, 41, 32, 123, 10, 32, 32, 105, 102, 32, 40, 112, 97, 114, 101, 110, 116, 41, 32, 123, 10, 32, 32, 32, 32, 100, 101, 98, 117, 103, 40, 39, 77, 111, 100, 117, 108, 101, 46, 95, 108, 111, 97, 100, 32, 82, 69, 81, 85, 69, 83, 84, 32, 37, 115, 32, 112, 97, 114, 101, 110, 116, 58, 32, 37, 115, 39, 44, 32, 114, 101, 113, 117, 101, 115, 116, 44, 32, 112, 97, 114, 101, 110, 116, 46, 105, 100, 41, 59, 10, 32, 32, 125, 10, 10, 32, 32, 118, 97, 114, 32, 102, 105, 108, 101, 110, 97, 109, 101, 32, 61, 32, 77, 111, 100, 117, 108, 101, 46, 95, 114, 101, 115, 111, 108, 118, 101, 70, 105, 108, 101, 110, 97, 109, 101, 40, 114, 101, 113, 117, 101, 115, 116, 44, 32, 112, 97, 114, 101, 110, 116, 41, 59, 10, 10, 32, 32, 118, 97, 114, 32, 99, 97, 99, 104, 101, 100, 77, 111, 100, 117, 108, 101, 32, 61, 32, 77, 111, 100, 117, 108, 101, 46, 95, 99, 97, 99, 104, 101, 91, 102, 105, 108, 101, 110, 97, 109, 101, 93, 59, 10, 32, 32, 105, 102, 32, 40, 99, 97, 99, 104, 101, 100, 77, 111, 100, 117, 108, 101, 41, 32, 123, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 99, 97, 99, 104, 101, 100, 77, 111, 100, 117, 108, 101, 46, 101, 120, 112, 111, 114, 116, 115, 59, 10, 32, 32, 125, 10, 10, 32, 32, 105, 102, 32, 40, 78, 97, 116, 105, 118, 101, 77, 111, 100, 117, 108, 101, 46, 110, 111, 110, 73, 110, 116, 101, 114, 110, 97, 108, 69, 120, 105, 115, 116, 115, 40, 102, 105, 108, 101, 110, 97, 109, 101, 41, 41, 32, 123, 10, 32, 32, 32, 32, 100, 101, 98, 117, 103, 40, 39, 108, 111, 97, 100, 32, 110, 97, 116, 105, 118, 101, 32, 109, 111, 100, 117, 108, 101, 32, 37, 115, 39, 44, 32, 114, 101, 113, 117, 101, 115, 116, 41, 59, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 78, 97, 116, 105, 118, 101, 77, 111, 100, 117, 108, 101, 46, 114, 101, 113, 117, 105, 114, 101, 40, 102, 105, 108, 101, 110, 97, 109, 101, 41, 59, 10, 32, 32, 125, 10, 10, 32, 32, 118, 97, 114, 32, 109, 111, 100, 117, 108, 101, 32, 61, 32, 110, 101, 119, 32, 77, 111, 100, 117, 108, 101, 40, 102, 105, 108, 101, 110, 97, 109, 101, 44, 32, 112, 97, 114, 101, 110, 116, 41, 59, 10, 10, 32, 32, 105, 102, 32, 40, 105, 115, 77, 97, 105, 110, 41, 32, 123, 10, 32, 32, 32, 32, 112, 114, 111, 99, 101, 115, 115, 46, 109, 97, 105, 110, 77, 111, 100, 117, 108, 101, 32, 61, 32, 109, 111, 100, 117, 108, 101, 59, 10, 32, 32, 32, 32, 109, 111, 100, 117, 108, 101, 46, 105, 100, 32, 61, 32, 39, 46, 39, 59, 10, 32, 32, 125, 10, 10, 32, 32, 77, 111, 100, 117, 108, 101, 46, 95, 99, 97, 99, 104, 101, 91, 102, 105, 108, 101, 110, 97, 109, 101, 93, 32, 61, 32, 109, 111, 100, 117, 108, 101, 59, 10, 10, 32, 32, 118, 97, 114, 32, 104, 97, 100, 69, 120, 99, 101, 112, 116, 105, 111, 110, 32, 61, 32, 116, 114, 117, 101, 59, 10, 10, 32, 32, 116, 114, 121, 32, 123, 10, 32, 32, 32, 32, 109, 111, 100, 117, 108, 101, 46, 108, 111, 97, 100, 40, 102, 105, 108, 101, 110, 97, 109, 101, 41, 59, 10, 32, 32, 32, 32, 104, 97, 100, 69, 120, 99, 101, 112, 116, 105, 111, 110, 32, 61, 32, 102, 97, 108, 115, 101, 59, 10, 32, 32, 125, 32, 102, 105, 110, 97, 108, 108, 121, 32, 123, 10, 32, 32, 32, 32, 105, 102, 32, 40, 104, 97, 100, 69, 120, 99, 101, 112, 116, 105, 111, 110, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 100, 101, 108, 101, 116, 101, 32, 77, 111, 100, 117, 108, 101, 46, 95, 99, 97, 99, 104, 101, 91, 102, 105, 108, 101, 110, 97, 109, 101, 93, 59, 10, 32, 32, 32, 32, 125, 10, 32, 32, 125, 10, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 109, 111, 100, 117, 108, 101, 46, 101, 120, 112, 111, 114, 116, 115, 59, 10, 125, 59, 10, 10, 77, 111, 100, 117, 108, 101, 46, 95, 114, 101, 115, 111, 108, 118, 101, 70, 105, 108, 101, 110, 97, 109, 101, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 114, 101, 113, 117, 101, 115, 116, 44, 32, 112, 97, 114, 101, 110, 116, 41, 32, 123, 10, 32, 32, 105, 102, 32, 40, 78, 97, 116, 105, 118, 101, 77, 111, 100, 117, 108, 101, 46, 110, 111, 110, 73, 110, 116, 101, 114, 110, 97, 108, 69, 120, 105, 115, 116, 115, 40, 114, 101, 113, 117, 101, 115, 116, 41, 41, 32, 123, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 114, 101, 113, 117, 101, 115, 116, 59, 10, 32, 32, 125, 10, 10, 32, 32, 118, 97, 114, 32, 114, 101, 115, 111, 108, 118, 101, 100, 77, 111, 100, 117, 108, 101, 32, 61, 32, 77, 111, 100, 117, 108, 101, 46, 95, 114, 101, 115, 111, 108, 118, 101, 76, 111, 111, 107, 117, 112, 80, 97, 116, 104, 115, 40, 114, 101, 113, 117, 101, 115, 116, 44, 32, 112, 97, 114, 101, 110, 116, 41, 59, 10, 32, 32, 118, 97, 114, 32, 105, 100, 32, 61, 32, 114, 101, 115, 111, 108, 118, 101, 100, 77, 111, 100, 117, 108, 101, 91, 48, 93, 59, 10, 32, 32, 118, 97, 114, 32, 112, 97, 116, 104, 115, 32, 61, 32, 114, 101, 115, 111, 108, 118, 101, 100, 77, 111, 100, 117, 108, 101, 91, 49, 93, 59, 10, 10, 32, 32, 47, 47, 32, 108, 111, 111, 107, 32, 117, 112, 32, 116, 104, 101, 32, 102, 105, 108, 101, 110, 97, 109, 101, 32, 102, 105, 114, 115, 116, 44, 32, 115, 105, 110, 99, 101, 32, 116, 104, 97, 116, 39, 115, 32, 116, 104, 101, 32, 99, 97, 99, 104, 101, 32, 107, 101, 121, 46, 10, 32, 32, 100, 101, 98, 117, 103, 40, 39, 108, 111, 111, 107, 105, 110, 103, 32, 102, 111, 114, 32, 37, 106, 32, 105, 110, 32, 37, 106, 39, 44, 32, 105, 100, 44, 32, 112, 97, 116, 104, 115, 41, 59, 10, 10, 32, 32, 118, 97, 114, 32, 102, 105, 108, 101, 110, 97, 109, 101, 32, 61, 32, 77, 111, 100, 117, 108, 101, 46, 95, 102, 105, 110, 100, 80, 97, 116, 104, 40, 114, 101, 113, 117, 101, 115, 116, 44, 32, 112, 97, 116, 104, 115, 41, 59, 10, 32, 32, 105, 102, 32, 40, 33, 102, 105, 108, 101, 110, 97, 109, 101, 41, 32, 123, 10, 32, 32, 32, 32, 118, 97, 114, 32, 101, 114, 114, 32, 61, 32, 110, 101, 119, 32, 69, 114, 114, 111, 114, 40, 34, 67, 97, 110, 110, 111, 116, 32, 102, 105, 110, 100, 32, 109, 111, 100, 117, 108, 101, 32, 39, 34, 32, 43, 32, 114, 101, 113, 117, 101, 115, 116, 32, 43, 32, 34, 39, 34, 41, 59, 10, 32, 32, 32, 32, 101, 114, 114, 46, 99, 111, 100, 101, 32, 61, 32, 39, 77, 79, 68, 85, 76, 69, 95, 78, 79, 84, 95, 70, 79, 85, 78, 68, 39, 59, 10, 32, 32, 32, 32, 116, 104, 114, 111, 119, 32, 101, 114, 114, 59, 10, 32, 32, 125, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 102, 105, 108, 101, 110, 97, 109, 101, 59, 10, 125, 59, 10, 10, 10, 47, 47, 32, 71, 105, 118, 101, 110, 32, 97, 32, 102, 105, 108, 101, 32, 110, 97, 109, 101, 44, 32, 112, 97, 115, 115, 32, 105, 116, 32, 116, 111, 32, 116, 104, 101, 32, 112, 114, 111, 112, 101, 114, 32, 101, 120, 116, 101, 110, 115, 105, 111, 110, 32, 104, 97, 110, 100, 108, 101, 114, 46, 10, 77, 111, 100, 117, 108, 101, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 108, 111, 97, 100, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 102, 105, 108, 101, 110, 97, 109, 101, 41, 32, 123, 10, 32, 32, 100, 101, 98, 117, 103, 40, 39, 108, 111, 97, 100, 32, 37, 106, 32, 102, 111, 114, 32, 109, 111, 100, 117, 108, 101, 32, 37, 106, 39, 44, 32, 102, 105, 108, 101, 110, 97, 109, 101, 44, 32, 116, 104, 105, 115, 46, 105, 100, 41, 59, 10, 10, 32, 32, 97, 115, 115, 101, 114, 116, 40, 33, 116, 104, 105, 115, 46, 108, 111, 97, 100, 101, 100, 41, 59, 10, 32, 32, 116, 104, 105, 115, 46, 102, 105, 108, 101, 110, 97, 109, 101, 32, 61, 32, 102, 105, 108, 101, 110, 97, 109, 101, 59, 10, 32, 32, 116, 104, 105, 115, 46, 112, 97, 116, 104, 115, 32, 61, 32, 77, 111, 100, 117, 108, 101, 46, 95, 110, 111, 100, 101, 77, 111, 100, 117, 108, 101, 80, 97, 116, 104, 115, 40, 112, 97, 116, 104, 46, 100, 105, 114, 110, 97, 109, 101, 40, 102, 105, 108, 101, 110, 97, 109, 101, 41, 41, 59, 10, 10, 32, 32, 118, 97, 114, 32, 101, 120, 116, 101, 110, 115, 105, 111, 110, 32, 61, 32, 112, 97, 116, 104, 46, 101, 120, 116, 110, 97, 109, 101, 40, 102, 105, 108, 101, 110, 97, 109, 101, 41, 32, 124, 124, 32, 39, 46, 106, 115, 39, 59, 10, 32, 32, 105, 102, 32, 40, 33, 77, 111, 100, 117, 108, 101, 46, 95, 101, 120, 116, 101, 110, 115, 105, 111, 110, 115, 91, 101, 120, 116, 101, 110, 115, 105, 111, 110, 93, 41, 32, 101, 120, 116, 101, 110, 115, 105, 111, 110, 32, 61, 32, 39, 46, 106, 115, 39, 59, 10, 32, 32, 77, 111, 100, 117, 108, 101, 46, 95, 101, 120, 116, 101, 110, 115, 105, 111, 110, 115, 91, 101, 120, 116, 101, 110, 115, 105, 111, 110, 93, 40, 116, 104, 105, 115, 44, 32, 102, 105, 108, 101, 110, 97, 109, 101, 41, 59, 10, 32, 32, 116, 104, 105, 115, 46, 108, 111, 97, 100, 101, 100, 32, 61, 32, 116, 114, 117, 101, 59, 10, 125, 59, 10, 10, 10, 47, 47, 32, 76, 111, 97, 100, 115, 32, 97, 32, 109, 111, 100, 117, 108, 101, 32, 97, 116, 32, 116, 104, 101, 32, 103, 105, 118, 101, 110, 32, 102, 105, 108, 101, 32, 112, 97, 116, 104, 46, 32, 82, 101, 116, 117, 114, 110, 115, 32, 116, 104, 97, 116, 32, 109, 111, 100, 117, 108, 101, 39, 115, 10, 47, 47, 32, 96, 101, 120, 112, 111, 114, 116, 115, 96, 32, 112, 114, 111, 112, 101, 114, 116, 121, 46, 10, 77, 111, 100, 117, 108, 101, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 114, 101, 113, 117, 105, 114, 101, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 112, 97, 116, 104, 41, 32, 123, 10, 32, 32, 97, 115, 115, 101, 114, 116, 40, 112, 97, 116, 104, 44, 32, 39, 109, 105, 115, 115, 105, 110, 103, 32, 112, 97, 116, 104, 39, 41, 59, 10, 32, 32, 97, 115, 115, 101, 114, 116, 40, 116, 121, 112, 101, 111, 102, 32, 112, 97, 116, 104, 32, 61, 61, 61, 32, 39, 115, 116, 114, 105, 110, 103, 39, 44, 32, 39, 112, 97, 116, 104, 32, 109, 117, 115, 116, 32, 98, 101, 32, 97, 32, 115, 116, 114, 105, 110, 103, 39, 41, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 77, 111, 100, 117, 108, 101, 46, 95, 108, 111, 97, 100, 40, 112, 97, 116, 104, 44, 32, 116, 104, 105, 115, 41, 59, 10, 125, 59, 10, 10, 10, 47, 47, 32, 82, 101, 115, 111, 108, 118, 101, 100, 32, 112, 97, 116, 104, 32, 116, 111, 32, 112, 114, 111, 99, 101, 115, 115, 46, 97, 114, 103, 118, 91, 49, 93, 32, 119, 105, 108, 108, 32, 98, 101, 32, 108, 97, 122, 105, 108, 121, 32, 112, 108, 97, 99, 101, 100, 32, 104, 101, 114, 101, 10, 47, 47, 32, 40, 110, 101, 101, 100, 101, 100, 32, 102, 111, 114, 32, 115, 101, 116, 116, 105, 110, 103, 32, 98, 114, 101, 97, 107, 112, 111, 105, 110, 116, 32, 119, 104, 101, 110, 32, 99, 97, 108, 108, 101, 100, 32, 119, 105, 116, 104, 32, 45, 45, 100, 101, 98, 117, 103, 45, 98, 114, 107, 41, 10, 118, 97, 114, 32, 114, 101, 115, 111, 108, 118, 101, 100, 65, 114, 103, 118, 59, 10, 10, 10, 47, 47, 32, 82, 117, 110, 32, 116, 104, 101, 32, 102, 105, 108, 101, 32, 99, 111, 110, 116, 101, 110, 116, 115, 32, 105, 110, 32, 116, 104, 101, 32, 99, 111, 114, 114, 101, 99, 116, 32, 115, 99, 111, 112, 101, 32, 111, 114, 32, 115, 97, 110, 100, 98, 111, 120, 46, 32, 69, 120, 112, 111, 115, 101, 10, 47, 47, 32, 116, 104, 101, 32, 99, 111, 114, 114, 101, 99, 116, 32, 104, 101, 108, 112, 101, 114, 32, 118, 97, 114, 105, 97, 98, 108, 101, 115, 32, 40, 114, 101, 113, 117, 105, 114, 101, 44, 32, 109, 111, 100, 117, 108, 101, 44, 32, 101, 120, 112, 111, 114, 116, 115, 41, 32, 116, 111, 10, 47, 47, 32, 116, 104, 101, 32, 102, 105, 108, 101, 46, 10, 47, 47, 32, 82, 101, 116, 117, 114, 110, 115, 32, 101, 120, 99, 101, 112, 116, 105, 111, 110, 44, 32, 105, 102, 32, 97, 110, 121, 46, 10, 77, 111, 100, 117, 108, 101, 46, 112, 114, 111, 116, 111, 116, 121, 112, 101, 46, 95, 99, 111, 109, 112, 105, 108, 101, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 99, 111, 110, 116, 101, 110, 116, 44, 32, 102, 105, 108, 101, 110, 97, 109, 101, 41, 32, 123, 10, 32, 32, 47, 47, 32, 114, 101, 109, 111, 118, 101, 32, 115, 104, 101, 98, 97, 110, 103, 10, 32, 32, 99, 111, 110, 116, 101, 110, 116, 32, 61, 32, 99, 111, 110, 116, 101, 110, 116, 46, 114, 101, 112, 108, 97, 99, 101, 40, 115, 104, 101, 98, 97, 110, 103, 82, 101, 44, 32, 39, 39, 41, 59, 10, 10, 32, 32, 47, 47, 32, 99, 114, 101, 97, 116, 101, 32, 119, 114, 97, 112, 112, 101, 114, 32, 102, 117, 110, 99, 116, 105, 111, 110, 10, 32, 32, 118, 97, 114, 32, 119, 114, 97, 112, 112, 101, 114, 32, 61, 32, 77, 111, 100, 117, 108, 101, 46, 119, 114, 97, 112, 40, 99, 111, 110, 116, 101, 110, 116, 41, 59, 10, 10, 32, 32, 118, 97, 114, 32, 99, 111, 109, 112, 105, 108, 101, 100, 87, 114, 97, 112, 112, 101, 114, 32, 61, 32, 114, 117, 110, 73, 110, 84, 104, 105, 115, 67, 111, 110, 116, 101, 120, 116, 40, 119, 114, 97, 112, 112, 101, 114, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 32, 102, 105, 108, 101, 110, 97, 109, 101, 58, 32, 102, 105, 108, 101, 110, 97, 109, 101, 44, 32, 108, 105, 110, 101, 79, 102, 102, 115, 101, 116, 58, 32, 48, 32, 125, 41, 59, 10, 32, 32, 105, 102, 32, 40, 103, 108, 111, 98, 97, 108, 46, 118, 56, 100, 101, 98, 117, 103, 41, 32, 123, 10, 32, 32, 32, 32, 105, 102, 32, 40, 33, 114, 101, 115, 111, 108, 118, 101, 100, 65, 114, 103, 118, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 47, 47, 32, 119, 101, 32, 101, 110, 116, 101, 114, 32, 116, 104, 101, 32, 114, 101, 112, 108, 32, 105, 102, 32, 119, 101, 39, 114, 101, 32, 110, 111, 116, 32, 103, 105, 118, 101, 110, 32, 97, 32, 102, 105, 108, 101, 110, 97, 109, 101, 32, 97, 114, 103, 117, 109, 101, 110, 116, 46, 10, 32, 32, 32, 32, 32, 32, 105, 102, 32, 40, 112, 114, 111, 99, 101, 115, 115, 46, 97, 114, 103, 118, 91, 49, 93, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 114, 101, 115, 111, 108, 118, 101, 100, 65, 114, 103, 118, 32, 61, 32, 77, 111, 100, 117, 108, 101, 46, 95, 114, 101, 115, 111, 108, 118, 101, 70, 105, 108, 101, 110, 97, 109, 101, 40, 112, 114, 111, 99, 101, 115, 115, 46, 97, 114, 103, 118, 91, 49, 93, 44, 32, 110, 117, 108, 108, 41, 59, 10, 32, 32, 32, 32, 32, 32, 125, 32, 101, 108, 115, 101, 32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 114, 101, 115, 111, 108, 118, 101, 100, 65, 114, 103, 118, 32, 61, 32, 39, 114, 101, 112, 108, 39, 59, 10, 32, 32, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 125, 10, 10, 32, 32, 32, 32, 47, 47, 32, 83, 101, 116, 32, 98, 114, 101, 97, 107, 112, 111, 105, 110, 116, 32, 111, 110, 32, 109, 111, 100, 117, 108, 101, 32, 115, 116, 97, 114, 116, 10, 32, 32, 32, 32, 105, 102, 32, 40, 102, 105, 108, 101, 110, 97, 109, 101, 32, 61, 61, 61, 32, 114, 101, 115, 111, 108, 118, 101, 100, 65, 114, 103, 118, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 47, 47, 32, 73, 110, 115, 116, 97, 108, 108, 105, 110, 103, 32, 116, 104, 105, 115, 32, 100, 117, 109, 109, 121, 32, 100, 101, 98, 117, 103, 32, 101, 118, 101, 110, 116, 32, 108, 105, 115, 116, 101, 110, 101, 114, 32, 116, 101, 108, 108, 115, 32, 86, 56, 32, 116, 111, 32, 115, 116, 97, 114, 116, 10, 32, 32, 32, 32, 32, 32, 47, 47, 32, 116, 104, 101, 32, 100, 101, 98, 117, 103, 103, 101, 114, 46, 32, 32, 87, 105, 116, 104, 111, 117, 116, 32, 105, 116, 44, 32, 116, 104, 101, 32, 115, 101, 116, 66, 114, 101, 97, 107, 80, 111, 105, 110, 116, 40, 41, 32, 102, 97, 105, 108, 115, 32, 119, 105, 116, 104, 32, 97, 110, 10, 32, 32, 32, 32, 32, 32, 47, 47, 32, 39, 105, 108, 108, 101, 103, 97, 108, 32, 97, 99, 99, 101, 115, 115, 39, 32, 101, 114, 114, 111, 114, 46, 10, 32, 32, 32, 32, 32, 32, 103, 108, 111, 98, 97, 108, 46, 118, 56, 100, 101, 98, 117, 103, 46, 68, 101, 98, 117, 103, 46, 115, 101, 116, 76, 105, 115, 116, 101, 110, 101, 114, 40, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 32, 123, 125, 41, 59, 10, 32, 32, 32, 32, 32, 32, 103, 108, 111, 98, 97, 108, 46, 118, 56, 100, 101, 98, 117, 103, 46, 68, 101, 98, 117, 103, 46, 115, 101, 116, 66, 114, 101, 97, 107, 80, 111, 105, 110, 116, 40, 99, 111, 109, 112, 105, 108, 101, 100, 87, 114, 97, 112, 112, 101, 114, 44, 32, 48, 44, 32, 48, 41, 59, 10, 32, 32, 32, 32, 125, 10, 32, 32, 125, 10, 32, 32, 99, 111, 110, 115, 116, 32, 100, 105, 114, 110, 97, 109, 101, 32, 61, 32, 112, 97, 116, 104, 46, 100, 105, 114, 110, 97, 109, 101, 40, 102, 105, 108, 101, 110, 97, 109, 101, 41, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 114, 101, 113, 117, 105, 114, 101, 32, 61, 32, 105, 110, 116, 101, 114, 110, 97, 108, 77, 111, 100, 117, 108, 101, 46, 109, 97, 107, 101, 82, 101, 113, 117, 105, 114, 101, 70, 117, 110, 99, 116, 105, 111, 110, 46, 99, 97, 108, 108, 40, 116, 104, 105, 115, 41, 59, 10, 10, 32, 32, 79, 98, 106, 101, 99, 116, 46, 100, 101, 102, 105, 110, 101, 80, 114, 111, 112, 101, 114, 116, 121, 40, 114, 101, 113, 117, 105, 114, 101, 44, 32, 39, 112, 97, 116, 104, 115, 39, 44, 32, 123, 32, 103, 101, 116, 58, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 32, 123, 10, 32, 32, 32, 32, 116, 104, 114, 111, 119, 32, 110, 101, 119, 32, 69, 114, 114, 111, 114, 40, 39, 114, 101, 113, 117, 105, 114, 101, 46, 112, 97, 116, 104, 115, 32, 105, 115, 32, 114, 101, 109, 111, 118, 101, 100, 46, 32, 85, 115, 101, 32, 39, 32, 43, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 39, 110, 111, 100, 101, 95, 109, 111, 100, 117, 108, 101, 115, 32, 102, 111, 108, 100, 101, 114, 115, 44, 32, 111, 114, 32, 116, 104, 101, 32, 78, 79, 68, 69, 95, 80, 65, 84, 72, 32, 39, 32, 43, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 39, 101, 110, 118, 105, 114, 111, 110, 109, 101, 110, 116, 32, 118, 97, 114, 105, 97, 98, 108, 101, 32, 105, 110, 115, 116, 101, 97, 100, 46, 39, 41, 59, 10, 32, 32, 125, 125, 41, 59, 10, 10, 32, 32, 114, 101, 113, 117, 105, 114, 101, 46, 114, 101, 103, 105, 115, 116, 101, 114, 69, 120, 116, 101, 110, 115, 105, 111, 110, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 32, 123, 10, 32, 32, 32, 32, 116, 104, 114, 111, 119, 32, 110, 101, 119, 32, 69, 114, 114, 111, 114, 40, 39, 114, 101, 113, 117, 105, 114, 101, 46, 114, 101, 103, 105, 115, 116, 101, 114, 69, 120, 116, 101, 110, 115, 105, 111, 110, 40, 41, 32, 114, 101, 109, 111, 118, 101, 100, 46, 32, 85, 115, 101, 32, 39, 32, 43, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 39, 114, 101, 113, 117, 105, 114, 101, 46, 101, 120, 116, 101, 110, 115, 105, 111, 110, 115, 32, 105, 110, 115, 116, 101, 97, 100, 46, 39, 41, 59, 10, 32, 32, 125, 59, 10, 10, 32, 32, 99, 111, 110, 115, 116, 32, 97, 114, 103, 115, 32, 61, 32, 91, 116, 104, 105, 115, 46, 101, 120, 112, 111, 114, 116, 115, 44, 32, 114, 101, 113, 117, 105, 114, 101, 44, 32, 116, 104, 105, 115, 44, 32, 102, 105, 108, 101, 110, 97, 109, 101, 44, 32, 100, 105, 114, 110, 97, 109, 101, 93, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 99, 111, 109, 112, 105, 108, 101, 100, 87, 114, 97, 112, 112, 101, 114, 46, 97, 112, 112, 108, 121, 40, 116, 104, 105, 115, 46, 101, 120, 112, 111, 114, 116, 115, 44, 32, 97, 114, 103, 115, 41, 59, 10, 125, 59, 10, 10, 10, 47, 47, 32, 78, 97, 116, 105, 118, 101, 32, 101, 120, 116, 101, 110, 115, 105, 111, 110, 32, 102, 111, 114, 32, 46, 106, 115, 10, 77, 111, 100, 117, 108, 101, 46, 95, 101, 120, 116, 101, 110, 115, 105, 111, 110, 115, 91, 39, 46, 106, 115, 39, 93, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 109, 111, 100, 117, 108, 101, 44, 32, 102, 105, 108, 101, 110, 97, 109, 101, 41, 32, 123, 10, 32, 32, 47, 47, 32, 83, 104, 97, 114, 101, 100, 32, 98, 121, 32, 101, 118, 101, 114, 121, 32, 102, 114, 97, 109, 101, 44, 32, 102, 115, 46, 114, 101, 97, 100, 70, 105, 108, 101, 83, 121, 110, 99, 40, 41, 32, 114, 101, 112, 111, 114, 116, 115, 32, 116, 104, 101, 32, 101, 114, 114, 111, 114, 115, 46, 10, 32, 32, 118, 97, 114, 32, 99, 111, 110, 116, 101, 110, 116, 32, 61, 32, 105, 110, 116, 101, 114, 110, 97, 108, 77, 111, 100, 117, 108, 101, 82, 101, 97, 100, 70, 105, 108, 101, 40, 112, 97, 116, 104, 46, 95, 109, 97, 107, 101, 76, 111, 110, 103, 40, 102, 105, 108, 101, 110, 97, 109, 101, 41, 41, 59, 10, 32, 32, 105, 102, 32, 40, 99, 111, 110, 116, 101, 110, 116, 32, 61, 61, 61, 32, 117, 110, 100, 101, 102, 105, 110, 101, 100, 41, 10, 32, 32, 32, 32, 99, 111, 110, 116, 101, 110, 116, 32, 61, 32, 105, 110, 116, 101, 114, 110, 97, 108, 77, 111, 100, 117, 108, 101, 46, 115, 116, 114, 105, 112, 66, 79, 77, 40, 102, 115, 46, 114, 101, 97, 100, 70, 105, 108, 101, 83, 121, 110, 99, 40, 102, 105, 108, 101, 110, 97, 109, 101, 44, 32, 39, 117, 116, 102, 56, 39, 41, 41, 59, 10, 32, 32, 109, 111, 100, 117, 108, 101, 46, 95, 99, 111, 109, 112, 105, 108, 101, 40, 99, 111, 110, 116, 101, 110, 116, 44, 32, 102, 105, 108, 101, 110, 97, 109, 101, 41, 59, 10, 125, 59, 10, 10, 10, 47, 47, 32, 78, 97, 116, 105, 118, 101, 32, 101, 120, 116, 101, 110, 115, 105, 111, 110, 32, 102, 111, 114, 32, 46, 106, 115, 111, 110, 10, 77, 111, 100, 117, 108, 101, 46, 95, 101, 120, 116, 101, 110, 115, 105, 111, 110, 115, 91, 39, 46, 106, 115, 111, 110, 39, 93, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 109, 111, 100, 117, 108, 101, 44, 32, 102, 105, 108, 101, 110, 97, 109, 101, 41, 32, 123, 10, 32, 32, 118, 97, 114, 32, 99, 111, 110, 116, 101, 110, 116, 32, 61, 32, 105, 110, 116, 101, 114, 110, 97, 108, 77, 111, 100, 117, 108, 101, 82, 101, 97, 100, 70, 105, 108, 101, 40, 112, 97, 116, 104, 46, 95, 109, 97, 107, 101, 76, 111, 110, 103, 40, 102, 105, 108, 101, 110, 97, 109, 101, 41, 41, 59, 10, 32, 32, 105, 102, 32, 40, 99, 111, 110, 116, 101, 110, 116, 32, 61, 61, 61, 32, 117, 110, 100, 101, 102, 105, 110, 101, 100, 41, 10, 32, 32, 32, 32, 99, 111, 110, 116, 101, 110, 116, 32, 61, 32, 105, 110, 116, 101, 114, 110, 97, 108, 77, 111, 100, 117, 108, 101, 46, 115, 116, 114, 105, 112, 66, 79, 77, 40, 102, 115, 46, 114, 101, 97, 100, 70, 105, 108, 101, 83, 121, 110, 99, 40, 102, 105, 108, 101, 110, 97, 109, 101, 44, 32, 39, 117, 116, 102, 56, 39, 41, 41, 59, 10, 32, 32, 116, 114, 121, 32, 123, 10, 32, 32, 32, 32, 109, 111, 100, 117, 108, 101, 46, 101, 120, 112, 111, 114, 116, 115, 32, 61, 32, 74, 83, 79, 78, 46, 112, 97, 114, 115, 101, 40, 99, 111, 110, 116, 101, 110, 116, 41, 59, 10, 32, 32, 125, 32, 99, 97, 116, 99, 104, 32, 40, 101, 114, 114, 41, 32, 123, 10, 32, 32, 32, 32, 101, 114, 114, 46, 109, 101, 115, 115, 97, 103, 101, 32, 61, 32, 102, 105, 108, 101, 110, 97, 109, 101, 32, 43, 32, 39, 58, 32, 39, 32, 43, 32, 101, 114, 114, 46, 109, 101, 115, 115, 97, 103, 101, 59, 10, 32, 32, 32, 32, 116, 104, 114, 111, 119, 32, 101, 114, 114, 59, 10, 32, 32, 125, 10, 125, 59, 10, 10, 10, 47, 47, 78, 97, 116, 105, 118, 101, 32, 101, 120, 116, 101, 110, 115, 105, 111, 110, 32, 102, 111, 114, 32, 46, 110, 111, 100, 101, 10, 77, 111, 100, 117, 108, 101, 46, 95, 101, 120, 116, 101, 110, 115, 105, 111, 110, 115, 91, 39, 46, 110, 111, 100, 101, 39, 93, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 109, 111, 100, 117, 108, 101, 44, 32, 102, 105, 108, 101, 110, 97, 109, 101, 41, 32, 123, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 112, 114, 111, 99, 101, 115, 115, 46, 100, 108, 111, 112, 101, 110, 40, 109, 111, 100, 117, 108, 101, 44, 32, 112, 97, 116, 104, 46, 95, 109, 97, 107, 101, 76, 111, 110, 103, 40, 102, 105, 108, 101, 110, 97, 109, 101, 41, 41, 59, 10, 125, 59, 10, 10, 10, 47, 47, 32, 98, 111, 111, 116, 115, 116, 114, 97, 112, 32, 109, 97, 105, 110, 32, 109, 111, 100, 117, 108, 101, 46, 10, 77, 111, 100, 117, 108, 101, 46, 114, 117, 110, 77, 97, 105, 110, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 32, 123, 10, 32, 32, 47, 47, 32, 76, 111, 97, 100, 32, 116, 104, 101, 32, 109, 97, 105, 110, 32, 109, 111, 100, 117, 108, 101, 45, 45, 116, 104, 101, 32, 99, 111, 109, 109, 97, 110, 100, 32, 108, 105, 110, 101, 32, 97, 114, 103, 117, 109, 101, 110, 116, 46, 10, 32, 32, 77, 111, 100, 117, 108, 101, 46, 95, 108, 111, 97, 100, 40, 112, 114, 111, 99, 101, 115, 115, 46, 97, 114, 103, 118, 91, 49, 93, 44, 32, 110, 117, 108, 108, 44, 32, 116, 114, 117, 101, 41, 59, 10, 32, 32, 47, 47, 32, 72, 97, 110, 100, 108, 101, 32, 97, 110, 121, 32, 110, 101, 120, 116, 84, 105, 99, 107, 115, 32, 97, 100, 100, 101, 100, 32, 105, 110, 32, 116, 104, 101, 32, 102, 105, 114, 115, 116, 32, 116, 105, 99, 107, 32, 111, 102, 32, 116, 104, 101, 32, 112, 114, 111, 103, 114, 97, 109, 10, 32, 32, 112, 114, 111, 99, 101, 115, 115, 46, 95, 116, 105, 99, 107, 67, 97, 108, 108, 98, 97, 99, 107, 40, 41, 59, 10, 125, 59, 10, 10, 77, 111, 100, 117, 108, 101, 46, 95, 105, 110, 105, 116, 80, 97, 116, 104, 115, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 32, 123, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 115, 87, 105, 110, 100, 111, 119, 115, 32, 61, 32, 112, 114, 111, 99, 101, 115, 115, 46, 112, 108, 97, 116, 102, 111, 114, 109, 32, 61, 61, 61, 32, 39, 119, 105, 110, 51, 50, 39, 59, 10, 10, 32, 32, 105, 102, 32, 40, 105, 115, 87, 105, 110, 100, 111, 119, 115, 41, 32, 123, 10, 32, 32, 32, 32, 118, 97, 114, 32, 104, 111, 109, 101, 68, 105, 114, 32, 61, 32, 112, 114, 111, 99, 101, 115, 115, 46, 101, 110, 118, 46, 85, 83, 69, 82, 80, 82, 79, 70, 73, 76, 69, 59, 10, 32, 32, 125, 32, 101, 108, 115, 101, 32, 123, 10, 32, 32, 32, 32, 118, 97, 114, 32, 104, 111, 109, 101, 68, 105, 114, 32, 61, 32, 112, 114, 111, 99, 101, 115, 115, 46, 101, 110, 118, 46, 72, 79, 77, 69, 59, 10, 32, 32, 125, 10, 10, 32, 32, 118, 97, 114, 32, 112, 97, 116, 104, 115, 32, 61, 32, 91, 112, 97, 116, 104, 46, 114, 101, 115, 111, 108, 118, 101, 40, 112, 114, 111, 99, 101, 115, 115, 46, 101, 120, 101, 99, 80, 97, 116, 104, 44, 32, 39, 46, 46, 39, 44, 32, 39, 108, 105, 98, 39, 44, 32, 39, 110, 111, 100, 101, 95, 109, 111, 100, 117, 108, 101, 115, 39, 41, 93, 59, 10, 10, 32, 32, 105, 102, 32, 40, 104, 111, 109, 101, 68, 105, 114, 41, 32, 123, 10, 32, 32, 32, 32, 112, 97, 116, 104, 115, 46, 117, 110, 115, 104, 105, 102, 116, 40, 112, 97, 116, 104, 46, 114, 101, 115, 111, 108, 118, 101, 40, 104, 111, 109, 101, 68, 105, 114, 44, 32, 39, 46, 110, 111, 100, 101, 95, 108, 105, 98, 114, 97, 114, 105, 101, 115, 39, 41, 41, 59, 10, 32, 32, 32, 32, 112, 97, 116, 104, 115, 46, 117, 110, 115, 104, 105, 102, 116, 40, 112, 97, 116, 104, 46, 114, 101, 115, 111, 108, 118, 101, 40, 104, 111, 109, 101, 68, 105, 114, 44, 32, 39, 46, 110, 111, 100, 101, 95, 109, 111, 100, 117, 108, 101, 115, 39, 41, 41, 59, 10, 32, 32, 125, 10, 10, 32, 32, 118, 97, 114, 32, 110, 111, 100, 101, 80, 97, 116, 104, 32, 61, 32, 112, 114, 111, 99, 101, 115, 115, 46, 101, 110, 118, 91, 39, 78, 79, 68, 69, 95, 80, 65, 84, 72, 39, 93, 59, 10, 32, 32, 105, 102, 32, 40, 110, 111, 100, 101, 80, 97, 116, 104, 41, 32, 123, 10, 32, 32, 32, 32, 112, 97, 116, 104, 115, 32, 61, 32, 110, 111, 100, 101, 80, 97, 116, 104, 46, 115, 112, 108, 105, 116, 40, 112, 97, 116, 104, 46, 100, 101, 108, 105, 109, 105, 116, 101, 114, 41, 46, 102, 105, 108, 116, 101, 114, 40, 102, 117, 110, 99, 116, 105, 111, 110, 40, 112, 97, 116, 104, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 33, 33, 112, 97, 116, 104, 59, 10, 32, 32, 32, 32, 125, 41, 46, 99, 111, 110, 99, 97, 116, 40, 112, 97, 116, 104, 115, 41, 59, 10, 32, 32, 125, 10, 10, 32, 32, 109, 111, 100, 117, 108, 101, 80, 97, 116, 104, 115, 32, 61, 32, 112, 97, 116, 104, 115, 59, 10, 10, 32, 32, 47, 47, 32, 99, 108, 111, 110, 101, 32, 97, 115, 32, 97, 32, 114, 101, 97, 100, 45, 111, 110, 108, 121, 32, 99, 111, 112, 121, 44, 32, 102, 111, 114, 32, 105, 110, 116, 114, 111, 115, 112, 101, 99, 116, 105, 111, 110, 46, 10, 32, 32, 77, 111, 100, 117, 108, 101, 46, 103, 108, 111, 98, 97, 108, 80, 97, 116, 104, 115, 32, 61, 32, 109, 111, 100, 117, 108, 101, 80, 97, 116, 104, 115, 46, 115, 108, 105, 99, 101, 40, 48, 41, 59, 10, 125, 59, 10, 10, 47, 47, 32, 84, 79, 68, 79, 40, 98, 110, 111, 111, 114, 100, 104, 117, 105, 115, 41, 32, 85, 110, 117, 115, 101, 100, 44, 32, 114, 101, 109, 111, 118, 101, 32, 105, 110, 32, 116, 104, 101, 32, 102, 117, 116, 117, 114, 101, 46, 10, 77, 111, 100, 117, 108, 101, 46, 114, 101, 113, 117, 105, 114, 101, 82, 101, 112, 108, 32, 61, 32, 105, 110, 116, 101, 114, 110, 97, 108, 85, 116, 105, 108, 46, 100, 101, 112, 114, 101, 99, 97, 116, 101, 40, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 32, 123, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 78, 97, 116, 105, 118, 101, 77, 111, 100, 117, 108, 101, 46, 114, 101, 113, 117, 105, 114, 101, 40, 39, 105, 110, 116, 101, 114, 110, 97, 108, 47, 114, 101, 112, 108, 39, 41, 59, 10, 125, 44, 32, 39, 77, 111, 100, 117, 108, 101, 46, 114, 101, 113, 117, 105, 114, 101, 82, 101, 112, 108, 32, 105, 115, 32, 100, 101, 112, 114, 101, 99, 97, 116, 101, 100, 46, 39, 41, 59, 10, 10, 77, 111, 100, 117, 108, 101, 46, 95, 112, 114, 101, 108, 111, 97, 100, 77, 111, 100, 117, 108, 101, 115, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 114, 101, 113, 117, 101, 115, 116, 115, 41, 32, 123, 10, 32, 32, 105, 102, 32, 40, 33, 65, 114, 114, 97, 121, 46, 105, 115, 65, 114, 114, 97, 121, 40, 114, 101, 113, 117, 101, 115, 116, 115, 41, 41, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 59, 10, 10, 32, 32, 47, 47, 32, 80, 114, 101, 108, 111, 97, 100, 101, 100, 32, 109, 111, 100, 117, 108, 101, 115, 32, 104, 97, 118, 101, 32, 97, 32, 100, 117, 109, 109, 121, 32, 112, 97, 114, 101, 110, 116, 32, 109, 111, 100, 117, 108, 101, 32, 119, 104, 105, 99, 104, 32, 105, 115, 32, 100, 101, 101, 109, 101, 100, 32, 116, 111, 32, 101, 120, 105, 115, 116, 10, 32, 32, 47, 47, 32, 105, 110, 32, 116, 104, 101, 32, 99, 117, 114, 114, 101, 110, 116, 32, 119, 111, 114, 107, 105, 110, 103, 32, 100, 105, 114, 101, 99, 116, 111, 114, 121, 46, 32, 84, 104, 105, 115, 32, 115, 101, 101, 100, 115, 32, 116, 104, 101, 32, 115, 101, 97, 114, 99, 104, 32, 112, 97, 116, 104, 32, 102, 111, 114, 10, 32, 32, 47, 47, 32, 112, 114, 101, 108, 111, 97, 100, 101, 100, 32, 109, 111, 100, 117, 108, 101, 115, 46, 10, 32, 32, 118, 97, 114, 32, 112, 97, 114, 101, 110, 116, 32, 61, 32, 110, 101, 119, 32, 77, 111, 100, 117, 108, 101, 40, 39, 105, 110, 116, 101, 114, 110, 97, 108, 47, 112, 114, 101, 108, 111, 97, 100, 39, 44, 32, 110, 117, 108, 108, 41, 59, 10, 32, 32, 116, 114, 121, 32, 123, 10, 32, 32, 32, 32, 112, 97, 114, 101, 110, 116, 46, 112, 97, 116, 104, 115, 32, 61, 32, 77, 111, 100, 117, 108, 101, 46, 95, 110, 111, 100, 101, 77, 111, 100, 117, 108, 101, 80, 97, 116, 104, 115, 40, 112, 114, 111, 99, 101, 115, 115, 46, 99, 119, 100, 40, 41, 41, 59, 10, 32, 32, 125, 10, 32, 32, 99, 97, 116, 99, 104, 32, 40, 101, 41, 32, 123, 10, 32, 32, 32, 32, 105, 102, 32, 40, 101, 46, 99, 111, 100, 101, 32, 33, 61, 61, 32, 39, 69, 78, 79, 69, 78, 84, 39, 41, 32, 123, 10, 32, 32, 32, 32, 32, 32, 116, 104, 114, 111, 119, 32, 101, 59, 10, 32, 32, 32, 32, 125, 10, 32, 32, 125, 10, 32, 32, 114, 101, 113, 117, 101, 115, 116, 115, 46, 102, 111, 114, 69, 97, 99, 104, 40, 102, 117, 110, 99, 116, 105, 111, 110, 40, 114, 101, 113, 117, 101, 115, 116, 41, 32, 123, 10, 32, 32, 32, 32, 112, 97, 114, 101, 110, 116, 46, 114, 101, 113, 117, 105, 114, 101, 40, 114, 101, 113, 117, 101, 115, 116, 41, 59, 10, 32, 32, 125, 41, 59, 10, 125, 59, 10, 10, 77, 111, 100, 117, 108, 101, 46, 95, 105, 110, 105, 116, 80, 97, 116, 104, 115, 40, 41, 59, 10, 10, 47, 47, 32, 98, 97, 99, 107, 119, 97, 114, 100, 115, 32, 99, 111, 109, 112, 97, 116, 105, 98, 105, 108, 105, 116, 121, 10, 77, 111, 100, 117, 108, 101, 46, 77, 111, 100, 117, 108, 101, 32, 61, 32, 77, 111, 100, 117, 108, 101, 59, 10, 0 };
 
   const cef_char_t os_native[] = { 39, 117, 115, 101, 32, 115, 116, 114, 105, 99, 116, 39, 59, 10, 10, 99, 111, 110, 115, 116, 32, 98, 105, 110, 100, 105, 110, 103, 32, 61, 32, 112, 114, 111, 99, 101, 115, 115, 46, 98, 105, 110, 100, 105, 110, 103, 40, 39, 111, 115, 39, 41, 59, 10, 99, 111, 110, 115, 116, 32, 105, 110, 116, 101, 114, 110, 97, 108, 85, 116, 105, 108, 32, 61, 32, 114, 101, 113, 117, 105, 114, 101, 40, 39, 105, 110, 116, 101, 114, 110, 97, 108, 47, 117, 116, 105, 108, 39, 41, 59, 10, 99, 111, 110, 115, 116, 32, 105, 115, 87, 105, 110, 100, 111, 119, 115, 32, 61, 32, 112, 114, 111, 99, 101, 115, 115, 46, 112, 108, 97, 116, 102, 111, 114, 109, 32, 61, 61, 61, 32, 39, 119, 105, 110, 51, 50, 39, 59, 10, 10, 101, 120, 112, 111, 114, 116, 115, 46, 104, 111, 115, 116, 110, 97, 109, 101, 32, 61, 32, 98, 105, 110, 100, 105, 110, 103, 46, 103, 101, 116, 72, 111, 115, 116, 110, 97, 109, 101, 59, 10, 101, 120, 112, 111, 114, 116, 115, 46, 108, 111, 97, 100, 97, 118, 103, 32, 61, 32, 98, 105, 110, 100, 105, 110, 103, 46, 103, 101, 116, 76, 111, 97, 100, 65, 118, 103, 59, 10, 101, 120, 112, 111, 114, 116, 115, 46, 117, 112, 116, 105, 109, 101, 32, 61, 32, 98, 105, 110, 100, 105, 110, 103, 46, 103, 101, 116, 85, 112, 116, 105, 109, 101, 59, 10, 101, 120, 112, 111, 114, 116, 115, 46, 102, 114, 101, 101, 109, 101, 109, 32, 61, 32, 98, 105, 110, 100, 105, 110, 103, 46, 103, 101, 116, 70, 114, 101, 101, 77, 101, 109, 59, 10, 101, 120, 112, 111, 114, 116, 115, 46, 116, 111, 116, 97, 108, 109, 101, 109, 32, 61, 32, 98, 105, 110, 100, 105, 110, 103, 46, 103, 101, 116, 84, 111, 116, 97, 108, 77, 101, 109, 59, 10, 101, 120, 112, 111, 114, 116, 115, 46, 99, 112, 117, 115, 32, 61, 32, 98, 105, 110, 100, 105, 110, 103, 46, 103, 101, 116, 67, 80, 85, 115, 59, 10, 101, 120, 112, 111, 114, 116, 115, 46, 116, 121, 112, 101, 32, 61, 32, 98, 105, 110, 100, 105, 110, 103, 46, 103, 101, 116, 79, 83, 84, 121, 112, 101, 59, 10, 101, 120, 112, 111, 114, 116, 115, 46, 114, 101, 108, 101, 97, 115, 101, 32, 61, 32, 98, 105, 110, 100, 105, 110, 103, 46, 103, 101, 116, 79, 83, 82, 101, 108, 101, 97, 115, 101, 59, 10, 101, 120, 112, 111, 114, 116, 115, 46, 110, 101, 116, 119, 111, 114, 107, 73, 110, 116, 101, 114, 102, 97, 99, 101, 115, 32, 61, 32, 98, 105, 110, 100, 105, 110, 103, 46, 103, 101, 116, 73, 110, 116, 101, 114, 102, 97, 99, 101, 65, 100, 100, 114, 101, 115, 115, 101, 115, 59, 10, 101, 120, 112, 111, 114, 116, 115, 46, 104, 111, 109, 101, 100, 105, 114, 32, 61, 32, 98, 105, 110, 100, 105, 110, 103, 46, 103, 101, 116, 72, 111, 109, 101, 68, 105, 114, 101, 99, 116, 111, 114, 121, 59, 10, 10, 10, 101, 120, 112, 111, 114, 116, 115, 46, 97, 114, 99, 104, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 32, 123, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 112, 114, 111, 99, 101, 115, 115, 46, 97, 114, 99, 104, 59, 10, 125, 59, 10, 10, 101, 120, 112, 111, 114, 116, 115, 46, 112, 108, 97, 116, 102, 111, 114, 109, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 32, 123, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 112, 114, 111, 99, 101, 115, 115, 46, 112, 108, 97, 116, 102, 111, 114, 109, 59, 10, 125, 59, 10, 10, 99, 111, 110, 115, 116, 32, 116, 114, 97, 105, 108, 105, 110, 103, 83, 108, 97, 115, 104, 82, 101, 32, 61, 32, 105, 115, 87, 105, 110, 100, 111, 119, 115, 32, 63, 32, 47, 91, 94, 58, 93, 92, 92, 36, 47, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 58, 32, 47, 46, 92, 47, 36, 47, 59, 10, 10, 101, 120, 112, 111, 114, 116, 115, 46, 116, 109, 112, 100, 105, 114, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 32, 123, 10, 32, 32, 118, 97, 114, 32, 112, 97, 116, 104, 59, 10, 32, 32, 105, 102, 32, 40, 105, 115, 87, 105, 110, 100, 111, 119, 115, 41, 32, 123, 10, 32, 32, 32, 32, 112, 97, 116, 104, 32, 61, 32, 112, 114, 111, 99, 101, 115, 115, 46, 101, 110, 118, 46, 84, 69, 77, 80, 32, 124, 124, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 112, 114, 111, 99, 101, 115, 115, 46, 101, 110, 118, 46, 84, 77, 80, 32, 124, 124, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 40, 112, 114, 111, 99, 101, 115, 115, 46, 101, 110, 118, 46, 83, 121, 115, 116, 101, 109, 82, 111, 111, 116, 32, 124, 124, 32, 112, 114, 111, 99, 101, 115, 115, 46, 101, 110, 118, 46, 119, 105, 110, 100, 105, 114, 41, 32, 43, 32, 39, 92, 92, 116, 101, 109, 112, 39, 59, 10, 32, 32, 125, 32, 101, 108, 115, 101, 32, 123, 10, 32, 32, 32, 32, 112, 97, 116, 104, 32, 61, 32, 112, 114, 111, 99, 101, 115, 115, 46, 101, 110, 118, 46, 84, 77, 80, 68, 73, 82, 32, 124, 124, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 112, 114, 111, 99, 101, 115, 115, 46, 101, 110, 118, 46, 84, 77, 80, 32, 124, 124, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 112, 114, 111, 99, 101, 115, 115, 46, 101, 110, 118, 46, 84, 69, 77, 80, 32, 124, 124, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 39, 47, 116, 109, 112, 39, 59, 10, 32, 32, 125, 10, 32, 32, 105, 102, 32, 40, 116, 114, 97, 105, 108, 105, 110, 103, 83, 108, 97, 115, 104, 82, 101, 46, 116, 101, 115, 116, 40, 112, 97, 116, 104, 41, 41, 10, 32, 32, 32, 32, 112, 97, 116, 104, 32, 61, 32, 112, 97, 116, 104, 46, 115, 108, 105, 99, 101, 40, 48, 44, 32, 45, 49, 41, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 112, 97, 116, 104, 59, 10, 125, 59, 10, 10, 101, 120, 112, 111, 114, 116, 115, 46, 116, 109, 112, 68, 105, 114, 32, 61, 32, 101, 120, 112, 111, 114, 116, 115, 46, 116, 109, 112, 100, 105, 114, 59, 10, 10, 101, 120, 112, 111, 114, 116, 115, 46, 103, 101, 116, 78, 101, 116, 119, 111, 114, 107, 73, 110, 116, 101, 114, 102, 97, 99, 101, 115, 32, 61, 32, 105, 110, 116, 101, 114, 110, 97, 108, 85, 116, 105, 108, 46, 100, 101, 112, 114, 101, 99, 97, 116, 101, 40, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 32, 123, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 101, 120, 112, 111, 114, 116, 115, 46, 110, 101, 116, 119, 111, 114, 107, 73, 110, 116, 101, 114, 102, 97, 99, 101, 115, 40, 41, 59, 10, 125, 44, 32, 39, 111, 115, 46, 103, 101, 116, 78, 101, 116, 119, 111, 114, 107, 73, 110, 116, 101, 114, 102, 97, 99, 101, 115, 32, 105, 115, 32, 100, 101, 112, 114, 101, 99, 97, 116, 101, 100, 46, 32, 39, 32, 43, 10, 32, 32, 32, 39, 85, 115, 101, 32, 111, 115, 46, 110, 101, 116, 119, 111, 114, 107, 73, 110, 116, 101, 114, 102, 97, 99, 101, 115, 32, 105, 110, 115, 116, 101, 97, 100, 46, 39, 41, 59, 10, 10, 101, 120, 112, 111, 114, 116, 115, 46, 69, 79, 76, 32, 61, 32, 105, 115, 87, 105, 110, 100, 111, 119, 115, 32, 63, 32, 39, 92, 114, 92, 110, 39, 32, 58, 32, 39, 92, 110, 39, 59, 10, 10, 105, 102, 32, 40, 98, 105, 110, 100, 105, 110, 103, 46, 105, 115, 66, 105, 103, 69, 110, 100, 105, 97, 110, 41, 10, 32, 32, 101, 120, 112, 111, 114, 116, 115, 46, 101, 110, 100, 105, 97, 110, 110, 101, 115, 115, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 32, 123, 32, 114, 101, 116, 117, 114, 110, 32, 39, 66, 69, 39, 59, 32, 125, 59, 10, 101, 108, 115, 101, 10, 32, 32, 101, 120, 112, 111, 114, 116, 115, 46, 101, 110, 100, 105, 97, 110, 110, 101, 115, 115, 32, 61, 32, 102, 117, 110, 99, 116, 105, 111, 110, 40, 41, 32, 123, 32, 114, 101, 116, 117, 114, 110, 32, 39, 76, 69, 39, 59, 32, 125, 59, 10, 0 };
 
@@ -0,0 +1,476 @@
+
+/***************************************************************
+ * Name:      Allocator.cpp
+ * Purpose:   Codes for Node-CEF Allocator Class
+ * Author:    Joshua GPBeta (studiocghibli@gmail.com)
+ * Created:   2016-08-08
+ * Copyright: Studio GPBeta (www.gpbeta.com)
+ * License:
+ **************************************************************/
+
+/// ============================================================================
+/// declarations
+/// ============================================================================
+
+#define _WINSOCKAPI_    // stops windows.h including winsock.h
+
+/// ----------------------------------------------------------------------------
+/// Headers
+/// ----------------------------------------------------------------------------
+
+#include "ncjs/Allocator.h"
+
+#include "ncjs/base.h"
+
+#include <uv.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#endif
+
+#include <assert.h>
+#include <signal.h>
+#include <stdlib.h>
+#include <string.h>
+
+namespace ncjs {
+
+/// ----------------------------------------------------------------------------
+/// variables
+/// ----------------------------------------------------------------------------
+
+// Every block starts with a header, which keeps the data aligned like
+// malloc() does. A slab is a single system allocation holding the slab
+// descriptor followed by blocksPerSlab blocks of the same class. Blocks
+// from the system at or above the map threshold get their own anonymous
+// mapping, the system hands them out zeroed and takes them back at once.
+
+static const size_t HEADER_SIZE = 16;
+static const size_t MIN_BLOCK   = 16;       // usable bytes of the first class
+static const unsigned CLASSES   = 13;       // 16 bytes to 64 KB
+static const size_t SLAB_BYTES  = 65536;
+static const unsigned MIN_BLOCKS_PER_SLAB = 4;
+static const size_t PAGE_SIZE   = 4096;
+static const size_t DEFAULT_MAP_THRESHOLD = 1048576;
+
+// a class keeps one empty slab at least
+static const unsigned RETAINED_EMPTY_SLABS = 1;
+
+static const unsigned LARGE     = CLASSES;  // class of the system blocks
+static const unsigned UNTRACKED = ~0u;      // allocated before Initialize()
+
+struct Slab;
+
+struct Header {
+    Slab* slab;         // NULL for system blocks, MAPPED for mapped ones
+    unsigned cls;
+    unsigned size;      // requested size
+};
+
+struct Slab {
+    Slab* prev;         // in the list of slabs with free blocks
+    Slab* next;
+    char* freeList;     // freed blocks, linked through their data
+    char* unused;       // blocks never handed out start here
+    unsigned used;
+};
+
+struct SizeClass {
+    uv_mutex_t mutex;
+    size_t blockSize;       // header included
+    unsigned blocksPerSlab;
+
+    // guarded by mutex
+
+    Slab* head;         // slabs with free blocks, the empty ones at the tail
+    Slab* tail;
+    unsigned slabs;
+    unsigned emptySlabs;
+    unsigned freeBlocks;
+    unsigned mapped;
+    unsigned used;
+    unsigned highWater;
+    double allocations;
+    double frees;
+    double requested;
+    double reserved;    // system blocks only, slabs are counted by number
+};
+
+static SizeClass s_classes[CLASSES + 1];
+static bool s_initialized = false;
+
+static size_t s_mapThreshold = DEFAULT_MAP_THRESHOLD;
+
+// placeholder slab of the mapped blocks
+static Slab s_mappedSlab;
+static Slab* const MAPPED = &s_mappedSlab;
+
+static const char* s_names[Allocator::MODE_COUNT] = { "system", "slab" };
+
+Allocator::Mode Allocator::s_mode = Allocator::SYSTEM;
+
+/// ============================================================================
+/// implementation
+/// ============================================================================
+
+static inline Header* GetHeader(void* data)
+{
+    return To<Header*>(static_cast<char*>(data) - HEADER_SIZE);
+}
+
+static inline size_t MappingSize(size_t size)
+{
+    return (HEADER_SIZE + size + PAGE_SIZE - 1) / PAGE_SIZE * PAGE_SIZE;
+}
+
+static char* MapBlock(size_t bytes)
+{
+#ifdef _WIN32
+    return static_cast<char*>(VirtualAlloc(NULL, bytes, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE));
+#else
+    void* memory = mmap(NULL, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    return memory != MAP_FAILED ? static_cast<char*>(memory) : NULL;
+#endif
+}
+
+static void UnmapBlock(char* block, size_t bytes)
+{
+#ifdef _WIN32
+    VirtualFree(block, 0, MEM_RELEASE);
+#else
+    munmap(block, bytes);
+#endif
+}
+
+static inline unsigned ClassOf(size_t size)
+{
+    unsigned cls = 0;
+
+    for (size_t block = MIN_BLOCK; block < size && cls < LARGE; block <<= 1)
+        cls += 1;
+
+    return cls;
+}
+
+static inline size_t SlabSize(const SizeClass& sc)
+{
+    return HEADER_SIZE * ((sizeof(Slab) + HEADER_SIZE - 1) / HEADER_SIZE) +
+           sc.blockSize * sc.blocksPerSlab;
+}
+
+static inline void Unlink(SizeClass& sc, Slab* slab)
+{
+    (slab->prev ? slab->prev->next : sc.head) = slab->next;
+    (slab->next ? slab->next->prev : sc.tail) = slab->prev;
+    slab->prev = slab->next = NULL;
+}
+
+static inline void PushFront(SizeClass& sc, Slab* slab)
+{
+    slab->prev = NULL;
+    slab->next = sc.head;
+    (sc.head ? sc.head->prev : sc.tail) = slab;
+    sc.head = slab;
+}
+
+static inline void PushBack(SizeClass& sc, Slab* slab)
+{
+    slab->prev = sc.tail;
+    slab->next = NULL;
+    (sc.tail ? sc.tail->next : sc.head) = slab;
+    sc.tail = slab;
+}
+
+static Slab* CreateSlab(SizeClass& sc)
+{
+    char* memory = static_cast<char*>(malloc(SlabSize(sc)));
+
+    if (memory == NULL)
+        return NULL;
+
+    Slab* slab = To<Slab*>(memory);
+    slab->prev = slab->next = NULL;
+    slab->freeList = NULL;
+    slab->unused = memory + SlabSize(sc) - sc.blockSize * sc.blocksPerSlab;
+    slab->used = 0;
+
+    sc.slabs += 1;
+    sc.emptySlabs += 1;
+    sc.freeBlocks += sc.blocksPerSlab;
+    PushBack(sc, slab);
+
+    return slab;
+}
+
+// the caller holds the lock of the class
+static char* TakeBlock(SizeClass& sc)
+{
+    Slab* slab = sc.head;
+
+    if (slab == NULL && (slab = CreateSlab(sc)) == NULL)
+        return NULL;
+
+    char* block;
+
+    if (slab->freeList) {
+        block = slab->freeList;
+        slab->freeList = *To<char**>(block + HEADER_SIZE);
+    } else {
+        block = slab->unused;
+        slab->unused += sc.blockSize;
+    }
+
+    if (slab->used++ == 0)
+        sc.emptySlabs -= 1;
+
+    sc.freeBlocks -= 1;
+
+    if (slab->used == sc.blocksPerSlab)
+        Unlink(sc, slab);
+
+    To<Header*>(block)->slab = slab;
+
+    return block;
+}
+
+// the caller holds the lock of the class
+static void ReturnBlock(SizeClass& sc, Slab* slab, char* block)
+{
+    *To<char**>(block + HEADER_SIZE) = slab->freeList;
+    slab->freeList = block;
+    sc.freeBlocks += 1;
+
+    // a full slab has free blocks again, prefer it to the empty ones
+    if (slab->used-- == sc.blocksPerSlab)
+        PushFront(sc, slab);
+
+    if (slab->used)
+        return;
+
+    // Empty slabs move to the tail, so the blocks are taken from the
+    // fullest slabs first. Beyond the retained ones, an empty slab goes
+    // back to the system when the class caches more free blocks than half
+    // of its high water mark, which then decays to the current use.
+    if (sc.emptySlabs >= RETAINED_EMPTY_SLABS && sc.freeBlocks > sc.highWater / 2) {
+        Unlink(sc, slab);
+        free(slab);
+        sc.slabs -= 1;
+        sc.freeBlocks -= sc.blocksPerSlab;
+        sc.highWater = sc.used;
+    } else {
+        Unlink(sc, slab);
+        PushBack(sc, slab);
+        sc.emptySlabs += 1;
+    }
+}
+
+/// ----------------------------------------------------------------------------
+/// static functions
+/// ----------------------------------------------------------------------------
+
+void* Allocator::Allocate(size_t size, bool zeroFill)
+{
+    // the header keeps 32-bit sizes, Buffer never asks for more anyway
+    if (size > size_t(unsigned(-1)) - HEADER_SIZE)
+        return NULL;
+
+    const unsigned cls = s_initialized ? ClassOf(size) : UNTRACKED;
+    char* block = NULL;
+
+    if (cls < LARGE && s_mode == SLAB) {
+        SizeClass& sc = s_classes[cls];
+
+        uv_mutex_lock(&sc.mutex);
+
+        if ((block = TakeBlock(sc)) != NULL) {
+            sc.used += 1;
+            sc.highWater = Max(sc.highWater, sc.used);
+            sc.allocations += 1;
+            sc.requested += double(size);
+        }
+
+        uv_mutex_unlock(&sc.mutex);
+    } else {
+        size_t reserved = 0;
+        Slab* origin = NULL;
+
+        if (cls != UNTRACKED && s_mapThreshold && size >= s_mapThreshold) {
+            reserved = MappingSize(size);
+            if ((block = MapBlock(reserved)) != NULL)
+                origin = MAPPED;
+        }
+
+        if (block == NULL) {
+            reserved = HEADER_SIZE + size;
+            block = static_cast<char*>(zeroFill ? calloc(reserved, 1) : malloc(reserved));
+            if (block == NULL)
+                return NULL;
+        }
+
+        To<Header*>(block)->slab = origin;
+
+        if (cls != UNTRACKED) {
+            SizeClass& sc = s_classes[cls];
+
+            uv_mutex_lock(&sc.mutex);
+            sc.used += 1;
+            sc.highWater = Max(sc.highWater, sc.used);
+            sc.allocations += 1;
+            sc.requested += double(size);
+            sc.reserved += double(reserved);
+            if (origin == MAPPED)
+                sc.mapped += 1;
+            uv_mutex_unlock(&sc.mutex);
+        }
+
+        // both are zeroed already
+        zeroFill = false;
+    }
+
+    if (block == NULL)
+        return NULL;
+
+    Header* header = To<Header*>(block);
+    header->cls = cls;
+    header->size = unsigned(size);
+
+    if (zeroFill)
+        memset(block + HEADER_SIZE, 0, size);
+
+    return block + HEADER_SIZE;
+}
+
+void Allocator::Free(void* data)
+{
+    if (data == NULL)
+        return;
+
+    Header* header = GetHeader(data);
+
+    if (header->cls == UNTRACKED)
+        return free(header);
+
+    SizeClass& sc = s_classes[header->cls];
+    Slab* origin = header->slab;
+    size_t reserved = 0;
+
+    uv_mutex_lock(&sc.mutex);
+
+    sc.used -= 1;
+    sc.frees += 1;
+    sc.requested -= double(header->size);
+
+    if (origin == MAPPED) {
+        reserved = MappingSize(header->size);
+        sc.reserved -= double(reserved);
+        sc.mapped -= 1;
+    } else if (origin == NULL) {
+        sc.reserved -= double(HEADER_SIZE + header->size);
+    } else {
+        ReturnBlock(sc, origin, To<char*>(header));
+    }
+
+    uv_mutex_unlock(&sc.mutex);
+
+    // system calls out of the lock
+    if (origin == MAPPED)
+        UnmapBlock(To<char*>(header), reserved);
+    else if (origin == NULL)
+        free(header);
+}
+
+const char* Allocator::GetModeName(Mode mode)
+{
+    return mode < MODE_COUNT ? s_names[mode] : "";
+}
+
+Allocator::Mode Allocator::FindMode(const char* name)
+{
+    for (int i = 0; i < MODE_COUNT; ++i) {
+        if (strcmp(name, s_names[i]) == 0)
+            return Mode(i);
+    }
+
+    return MODE_COUNT;
+}
+
+size_t Allocator::GetMapThreshold()
+{
+    return s_mapThreshold;
+}
+
+void Allocator::SetMapThreshold(size_t bytes)
+{
+    s_mapThreshold = bytes;
+}
+
+unsigned Allocator::GetClassCount()
+{
+    return CLASSES + 1;
+}
+
+void Allocator::GetStats(unsigned cls, Stats& stats)
+{
+    NCJS_ASSERT(cls <= LARGE);
+
+    stats = Stats();
+
+    if (!s_initialized || cls > LARGE)
+        return;
+
+    SizeClass& sc = s_classes[cls];
+
+    uv_mutex_lock(&sc.mutex);
+
+    stats.blockSize = cls < LARGE ? sc.blockSize - HEADER_SIZE : 0;
+    stats.slabs = sc.slabs;
+    stats.used = sc.used;
+    stats.free = sc.freeBlocks;
+    stats.mapped = sc.mapped;
+    stats.highWater = sc.highWater;
+    stats.allocations = sc.allocations;
+    stats.frees = sc.frees;
+    stats.requested = sc.requested;
+    stats.reserved = double(sc.slabs) * double(SlabSize(sc)) + sc.reserved;
+
+    uv_mutex_unlock(&sc.mutex);
+}
+
+bool Allocator::Initialize(Mode mode)
+{
+    if (s_initialized) {
+        s_mode = mode < MODE_COUNT ? mode : SLAB;
+        return true;
+    }
+
+    for (unsigned i = 0; i <= LARGE; ++i) {
+        SizeClass& sc = s_classes[i];
+
+        NCJS_CHK_EQ(uv_mutex_init(&sc.mutex), 0);
+
+        sc.blockSize = HEADER_SIZE + (MIN_BLOCK << i);
+        sc.blocksPerSlab = unsigned(Max(SLAB_BYTES / sc.blockSize, size_t(MIN_BLOCKS_PER_SLAB)));
+        sc.head = sc.tail = NULL;
+        sc.slabs = 0;
+        sc.emptySlabs = 0;
+        sc.freeBlocks = 0;
+        sc.mapped = 0;
+        sc.used = 0;
+        sc.highWater = 0;
+        sc.allocations = 0;
+        sc.frees = 0;
+        sc.requested = 0;
+        sc.reserved = 0;
+    }
+
+    s_mode = mode < MODE_COUNT ? mode : SLAB;
+    s_initialized = true;
+
+    // Slabs stay alive after shutdown, buffers may still be referenced
+    // by V8 objects when the process goes down.
+    return true;
+}
+
+} // ncjs
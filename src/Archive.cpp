@@ -0,0 +1,501 @@
+
+/***************************************************************
+ * Name:      Archive.cpp
+ * Purpose:   Codes for Node-CEF Archive Class
+ * Author:    Joshua GPBeta (studiocghibli@gmail.com)
+ * Created:   2016-08-12
+ * Copyright: Studio GPBeta (www.gpbeta.com)
+ * License:
+ **************************************************************/
+
+/// ============================================================================
+/// declarations
+/// ============================================================================
+
+#define _WINSOCKAPI_    // stops windows.h including winsock.h
+
+/// ----------------------------------------------------------------------------
+/// Headers
+/// ----------------------------------------------------------------------------
+
+#include "ncjs/Archive.h"
+
+#include "ncjs/base.h"
+
+#include <uv.h>
+
+#ifdef _WIN32
+#include <io.h>
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#endif
+
+#include <string.h>
+
+#include <map>
+#include <string>
+
+namespace ncjs {
+
+/// ----------------------------------------------------------------------------
+/// variables
+/// ----------------------------------------------------------------------------
+
+// Layout of a pack, all numbers are little endian:
+//
+//   Header      magic, version, entry count, where the names and data start
+//   Entry[]     sorted by name, compared byte by byte
+//   names       relative paths separated by '/', not terminated
+//   data        contents of the files, stored or compressed
+
+static const char MAGIC[8] = { 'N', 'C', 'J', 'S', 'P', 'A', 'C', 'K' };
+static const unsigned VERSION = 1;
+
+static const char EXTENSION[] = ".ncpk";
+static const size_t EXTENSION_LEN = sizeof(EXTENSION) - 1;
+
+enum {
+    FLAG_DIRECTORY = 1,
+    FLAG_LZ4 = 2
+};
+
+struct Header {
+    char magic[8];
+    unsigned version;
+    unsigned count;
+    unsigned namesOffset;
+    unsigned namesSize;
+    unsigned dataOffset;
+    unsigned reserved;
+};
+
+struct Entry {
+    unsigned nameOffset;    // in the names
+    unsigned nameLength;
+    unsigned flags;
+    unsigned offset;        // in the data
+    unsigned stored;        // bytes in the pack
+    unsigned size;          // bytes of the file
+};
+
+struct Pack {
+    const char* base;
+    size_t size;
+    const Entry* entries;
+    unsigned count;
+    const char* names;
+    const char* data;
+};
+
+// NULL for directories named like a pack
+typedef std::map<std::string, Pack*> PackMap;
+
+static uv_mutex_t s_mutex;
+static bool s_initialized = false;
+
+// guarded by s_mutex
+
+static PackMap s_packs;
+static double s_mapped = 0;
+static double s_reads = 0;
+
+/// ============================================================================
+/// implementation
+/// ============================================================================
+
+static inline bool IsSep(char c)
+{
+#ifdef _WIN32
+    return c == '\\' || c == '/';
+#else
+    return c == '/';
+#endif
+}
+
+static const char* MapFile(uv_file fd, size_t size)
+{
+#ifdef _WIN32
+    HANDLE file = reinterpret_cast<HANDLE>(_get_osfhandle(fd));
+    HANDLE mapping = CreateFileMappingW(file, NULL, PAGE_READONLY, 0, 0, NULL);
+
+    if (mapping == NULL)
+        return NULL;
+
+    // the view keeps the mapping alive
+    const char* data = static_cast<const char*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, size));
+    CloseHandle(mapping);
+
+    return data;
+#else
+    void* data = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    return data != MAP_FAILED ? static_cast<const char*>(data) : NULL;
+#endif
+}
+
+static void UnmapFile(const char* data, size_t size)
+{
+#ifdef _WIN32
+    UnmapViewOfFile(data);
+#else
+    munmap(const_cast<char*>(data), size);
+#endif
+}
+
+static inline int CompareName(const Pack& pack, const Entry& entry, const char* name, size_t len)
+{
+    const int rc = memcmp(pack.names + entry.nameOffset, name, Min(size_t(entry.nameLength), len));
+    return rc ? rc : (entry.nameLength < len ? -1 : entry.nameLength > len ? 1 : 0);
+}
+
+// checks every entry once, so lookups and reads can trust the index
+static bool Validate(Pack& pack)
+{
+    if (pack.size < sizeof(Header))
+        return false;
+
+    const Header& header = *To<const Header*>(pack.base);
+
+    if (memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0 || header.version != VERSION)
+        return false;
+
+    const size_t indexEnd = sizeof(Header) + size_t(header.count) * sizeof(Entry);
+
+    if (header.count > pack.size / sizeof(Entry) || indexEnd > header.namesOffset ||
+        header.namesOffset > pack.size || header.namesSize > pack.size - header.namesOffset ||
+        header.dataOffset > pack.size)
+        return false;
+
+    pack.entries = To<const Entry*>(pack.base + sizeof(Header));
+    pack.count = header.count;
+    pack.names = pack.base + header.namesOffset;
+    pack.data = pack.base + header.dataOffset;
+
+    const size_t dataSize = pack.size - header.dataOffset;
+
+    for (unsigned i = 0; i < pack.count; ++i) {
+        const Entry& entry = pack.entries[i];
+
+        if (entry.nameOffset > header.namesSize || entry.nameLength > header.namesSize - entry.nameOffset ||
+            entry.offset > dataSize || entry.stored > dataSize - entry.offset ||
+            (!(entry.flags & FLAG_LZ4) && entry.stored != entry.size))
+            return false;
+
+        if (i && CompareName(pack, pack.entries[i - 1],
+                             pack.names + entry.nameOffset, entry.nameLength) >= 0)
+            return false;
+    }
+
+    return true;
+}
+
+// call with s_mutex locked, returns NULL if the path is not a pack
+static Pack* Load(const std::string& path)
+{
+    PackMap::const_iterator it = s_packs.find(path);
+
+    if (it != s_packs.end())
+        return it->second;
+
+    uv_loop_t* loop = uv_default_loop();
+    uv_fs_t req;
+
+    const int fd = uv_fs_open(loop, &req, path.c_str(), O_RDONLY, 0, NULL);
+    uv_fs_req_cleanup(&req);
+
+    // a directory named like a pack can't be opened everywhere,
+    // missing files are not remembered, they may show up later
+    if (fd < 0) {
+        if (fd == UV_EISDIR)
+            s_packs[path] = NULL;
+        return NULL;
+    }
+
+    Pack* pack = NULL;
+
+    if (uv_fs_fstat(loop, &req, fd, NULL) == 0) {
+        if ((req.statbuf.st_mode & S_IFMT) != S_IFREG) {
+            s_packs[path] = NULL;
+        } else if (const char* base = MapFile(fd, size_t(req.statbuf.st_size))) {
+            pack = new Pack;
+            pack->base = base;
+            pack->size = size_t(req.statbuf.st_size);
+
+            if (Validate(*pack)) {
+                s_packs[path] = pack;
+                s_mapped += double(pack->size);
+            } else {
+                UnmapFile(base, pack->size);
+                delete pack;
+                pack = NULL;
+            }
+        }
+    }
+
+    uv_fs_req_cleanup(&req);
+
+    uv_fs_close(loop, &req, fd, NULL);
+    uv_fs_req_cleanup(&req);
+
+    return pack;
+}
+
+// finds the pack the path goes through and the name of the entry,
+// the pack itself is the root directory with an empty name
+static Pack* Find(const char* path, std::string& name)
+{
+    const size_t len = strlen(path);
+
+    for (const char* p = strstr(path, EXTENSION); p; p = strstr(p + 1, EXTENSION)) {
+        const size_t end = size_t(p - path) + EXTENSION_LEN;
+
+        if (end < len && !IsSep(path[end]))
+            continue;
+
+        uv_mutex_lock(&s_mutex);
+        Pack* pack = Load(std::string(path, end));
+        uv_mutex_unlock(&s_mutex);
+
+        if (pack == NULL)
+            continue;
+
+        name.clear();
+
+        // names use '/' and never start or end with it
+        for (size_t i = end; i < len; ++i) {
+            if (!IsSep(path[i]))
+                name += path[i];
+            else if (!name.empty() && name[name.size() - 1] != '/')
+                name += '/';
+        }
+
+        if (!name.empty() && name[name.size() - 1] == '/')
+            name.resize(name.size() - 1);
+
+        return pack;
+    }
+
+    return NULL;
+}
+
+static const Entry* Lookup(const Pack& pack, const std::string& name)
+{
+    unsigned low = 0;
+    unsigned high = pack.count;
+
+    while (low < high) {
+        const unsigned mid = low + (high - low) / 2;
+        const int rc = CompareName(pack, pack.entries[mid], name.c_str(), name.size());
+
+        if (rc == 0)
+            return &pack.entries[mid];
+
+        if (rc < 0)
+            low = mid + 1;
+        else
+            high = mid;
+    }
+
+    return NULL;
+}
+
+// LZ4 block format, checks every length against both ends
+static bool DecodeLz4(const unsigned char* src, size_t srcLen, char* dst, size_t dstLen)
+{
+    const unsigned char* const srcEnd = src + srcLen;
+    char* const dstStart = dst;
+    char* const dstEnd = dst + dstLen;
+
+    while (src < srcEnd) {
+        const unsigned token = *src++;
+        size_t literals = token >> 4;
+
+        if (literals == 15) {
+            unsigned char c;
+            do {
+                if (src == srcEnd)
+                    return false;
+                literals += c = *src++;
+            } while (c == 255);
+        }
+
+        if (literals > size_t(srcEnd - src) || literals > size_t(dstEnd - dst))
+            return false;
+
+        memcpy(dst, src, literals);
+        src += literals;
+        dst += literals;
+
+        // the last sequence has literals only
+        if (src == srcEnd)
+            break;
+
+        if (srcEnd - src < 2)
+            return false;
+
+        const size_t offset = size_t(src[0]) | size_t(src[1]) << 8;
+        src += 2;
+
+        if (offset == 0 || offset > size_t(dst - dstStart))
+            return false;
+
+        size_t length = token & 15;
+
+        if (length == 15) {
+            unsigned char c;
+            do {
+                if (src == srcEnd)
+                    return false;
+                length += c = *src++;
+            } while (c == 255);
+        }
+
+        length += 4;
+
+        if (length > size_t(dstEnd - dst))
+            return false;
+
+        // matches may overlap what they copy
+        const char* match = dst - offset;
+        while (length--)
+            *dst++ = *match++;
+    }
+
+    return dst == dstEnd;
+}
+
+static int ReadEntry(const Pack& pack, const Entry& entry, char* dst)
+{
+    const char* src = pack.data + entry.offset;
+
+    if (!(entry.flags & FLAG_LZ4)) {
+        memcpy(dst, src, entry.size);
+        return 0;
+    }
+
+    return DecodeLz4(To<const unsigned char*>(src), entry.stored, dst, entry.size) ? 0 : UV_EIO;
+}
+
+// returns the entry of a file or sets err
+static const Entry* FindFile(const Pack& pack, const std::string& name, int& err)
+{
+    const Entry* entry = name.empty() ? NULL : Lookup(pack, name);
+
+    if (name.empty() || (entry && (entry->flags & FLAG_DIRECTORY)))
+        err = UV_EISDIR;
+    else if (entry == NULL)
+        err = UV_ENOENT;
+    else
+        err = 0;
+
+    return err ? NULL : entry;
+}
+
+/// ----------------------------------------------------------------------------
+/// static functions
+/// ----------------------------------------------------------------------------
+
+bool Archive::Stat(const char* path, int& rc, size_t* size)
+{
+    NCJS_ASSERT(s_initialized);
+
+    std::string name;
+    const Pack* pack = Find(path, name);
+
+    if (pack == NULL)
+        return false;
+
+    if (name.empty()) {
+        rc = 1;
+    } else if (const Entry* entry = Lookup(*pack, name)) {
+        rc = (entry->flags & FLAG_DIRECTORY) ? 1 : 0;
+        if (size && rc == 0)
+            *size = entry->size;
+    } else {
+        rc = UV_ENOENT;
+    }
+
+    return true;
+}
+
+bool Archive::Read(const char* path, const char*& data, size_t& size,
+                   std::vector<char>& buffer, int& err)
+{
+    NCJS_ASSERT(s_initialized);
+
+    std::string name;
+    const Pack* pack = Find(path, name);
+
+    if (pack == NULL)
+        return false;
+
+    if (const Entry* entry = FindFile(*pack, name, err)) {
+        size = entry->size;
+
+        if (entry->flags & FLAG_LZ4) {
+            buffer.resize(entry->size + 1);
+            data = &buffer[0];
+            err = ReadEntry(*pack, *entry, &buffer[0]);
+        } else {
+            data = pack->data + entry->offset;
+        }
+
+        uv_mutex_lock(&s_mutex);
+        s_reads += 1;
+        uv_mutex_unlock(&s_mutex);
+    }
+
+    return true;
+}
+
+bool Archive::Read(const char* path, char* dst, size_t& size, int& err)
+{
+    NCJS_ASSERT(s_initialized);
+
+    std::string name;
+    const Pack* pack = Find(path, name);
+
+    if (pack == NULL)
+        return false;
+
+    if (const Entry* entry = FindFile(*pack, name, err)) {
+        err = size >= entry->size ? ReadEntry(*pack, *entry, dst) : UV_ENOBUFS;
+        size = entry->size;
+
+        uv_mutex_lock(&s_mutex);
+        s_reads += 1;
+        uv_mutex_unlock(&s_mutex);
+    }
+
+    return true;
+}
+
+void Archive::GetStats(Stats& stats)
+{
+    stats = Stats();
+
+    if (!s_initialized)
+        return;
+
+    uv_mutex_lock(&s_mutex);
+
+    for (PackMap::const_iterator it = s_packs.begin(); it != s_packs.end(); ++it)
+        stats.archives += it->second ? 1 : 0;
+
+    stats.mapped = s_mapped;
+    stats.reads = s_reads;
+
+    uv_mutex_unlock(&s_mutex);
+}
+
+bool Archive::Initialize()
+{
+    if (!s_initialized) {
+        NCJS_CHK_EQ(uv_mutex_init(&s_mutex), 0);
+        s_initialized = true;
+    }
+
+    return true;
+}
+
+} // ncjs
@@ -0,0 +1,1355 @@
+
+/***************************************************************
+ * Name:      Codec.cpp
+ * Purpose:   Codes for Node-CEF Codec Class
+ * Author:    Joshua GPBeta (studiocghibli@gmail.com)
+ * Created:   2016-08-07
+ * Copyright: Studio GPBeta (www.gpbeta.com)
+ * License:
+ **************************************************************/
+
+/// ============================================================================
+/// declarations
+/// ============================================================================
+
+#if defined(_M_IX86) || defined(_M_X64) || defined(__i386__) || defined(__x86_64__)
+#define NCJS_CODEC_X86
+#endif
+
+#ifdef NCJS_CODEC_X86
+#ifdef _MSC_VER
+// MSVC emits any instruction set, callers check the CPU before using them
+#define NCJS_TARGET(_ISA)
+#define NCJS_HAVE_SSSE3 (_MSC_VER >= 1500) // VS2008
+#define NCJS_HAVE_AVX2  (_MSC_VER >= 1700) // VS2012
+#else
+#define NCJS_TARGET(_ISA) __attribute__((target(_ISA)))
+#define NCJS_HAVE_SSSE3 1
+#define NCJS_HAVE_AVX2  1
+#endif
+#endif // NCJS_CODEC_X86
+
+/// ----------------------------------------------------------------------------
+/// Headers
+/// ----------------------------------------------------------------------------
+
+#include "ncjs/Codec.h"
+
+#include "ncjs/base.h"
+
+#include <string.h>
+
+#ifdef NCJS_CODEC_X86
+#include <emmintrin.h>
+#if NCJS_HAVE_SSSE3
+#include <tmmintrin.h>
+#endif
+#if NCJS_HAVE_AVX2
+#include <immintrin.h>
+#endif
+#ifdef _MSC_VER
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#endif // NCJS_CODEC_X86
+
+namespace ncjs {
+
+typedef Codec::char16 char16;
+
+/// ----------------------------------------------------------------------------
+/// variables
+/// ----------------------------------------------------------------------------
+
+Codec::Level Codec::s_level = Codec::SCALAR;
+
+static const char* s_names[Codec::LEVEL_COUNT] = { "scalar", "sse2", "ssse3", "avx2" };
+
+static const char HEX[] = "0123456789abcdef";
+
+static const char BASE64[] =
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+// 64 marks invalid characters, '-' and '_' are the URL-safe 62 and 63
+static const unsigned char UNBASE64[256] = {
+    64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+    64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+    64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 62, 64, 62, 64, 63,
+    52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 64, 64, 64, 64, 64, 64,
+    64,  0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14,
+    15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 64, 64, 64, 64, 63,
+    64, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40,
+    41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 64, 64, 64, 64, 64,
+    64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+    64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+    64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+    64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+    64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+    64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+    64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+    64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64
+};
+
+/// ============================================================================
+/// implementation
+/// ============================================================================
+
+/// ----------------------------------------------------------------------------
+/// scalar
+/// ----------------------------------------------------------------------------
+
+static inline unsigned Unhex(char16 c)
+{
+    if (c >= '0' && c <= '9')
+        return c - '0';
+    if (c >= 'A' && c <= 'F')
+        return 10 + (c - 'A');
+    if (c >= 'a' && c <= 'f')
+        return 10 + (c - 'a');
+    return 16;
+}
+
+static inline unsigned Unbase64(char16 c)
+{
+    return c < 256 ? UNBASE64[c] : 64;
+}
+
+static void HexEncodeScalar(const unsigned char* src, size_t len, char16* dst)
+{
+    for (size_t i = 0; i < len; ++i) {
+        *dst++ = HEX[src[i] >> 4];
+        *dst++ = HEX[src[i] & 15];
+    }
+}
+
+static size_t HexDecodeScalar(const char16* src, size_t len, unsigned char* dst)
+{
+    const size_t size = len / 2;
+
+    for (size_t i = 0; i < size; ++i, src += 2) {
+        const unsigned hi = Unhex(src[0]);
+        const unsigned lo = Unhex(src[1]);
+        if ((hi | lo) > 15)
+            return i;
+        dst[i] = (hi << 4) | lo;
+    }
+
+    return size;
+}
+
+static void Base64EncodeScalar(const unsigned char* src, size_t len, char16* dst)
+{
+    size_t i = 0;
+
+    for (; i + 3 <= len; i += 3, dst += 4) {
+        const unsigned v = (src[i] << 16) | (src[i + 1] << 8) | src[i + 2];
+        dst[0] = BASE64[v >> 18];
+        dst[1] = BASE64[(v >> 12) & 63];
+        dst[2] = BASE64[(v >> 6) & 63];
+        dst[3] = BASE64[v & 63];
+    }
+
+    if (const size_t rest = len - i) {
+        const unsigned v = (src[i] << 16) | (rest > 1 ? src[i + 1] << 8 : 0);
+        dst[0] = BASE64[v >> 18];
+        dst[1] = BASE64[(v >> 12) & 63];
+        dst[2] = rest > 1 ? BASE64[(v >> 6) & 63] : '=';
+        dst[3] = '=';
+    }
+}
+
+// continues at src[i] and dst[k], the vectorized loops leave the rest here
+static size_t Base64DecodeScalar(const char16* src, size_t len, unsigned char* dst,
+                                 size_t size, size_t i, size_t k)
+{
+    // fast path, groups of 4 valid characters
+    for (; i + 4 <= len && k + 3 <= size; i += 4, k += 3) {
+        const unsigned a = Unbase64(src[i]);
+        const unsigned b = Unbase64(src[i + 1]);
+        const unsigned c = Unbase64(src[i + 2]);
+        const unsigned d = Unbase64(src[i + 3]);
+        if ((a | b | c | d) & 64)
+            break;
+        dst[k]     = (a << 2) | (b >> 4);
+        dst[k + 1] = (b << 4) | (c >> 2);
+        dst[k + 2] = (c << 6) | d;
+    }
+
+    // slow path, skips invalid characters and stops at '='
+    unsigned group[4];
+    unsigned n = 0;
+
+    for (; i < len && k < size && src[i] != '='; ++i) {
+        const unsigned v = Unbase64(src[i]);
+        if (v & 64)
+            continue;
+
+        group[n++] = v;
+        if (n < 4)
+            continue;
+
+        dst[k++] = (group[0] << 2) | (group[1] >> 4);
+        if (k < size)
+            dst[k++] = (group[1] << 4) | (group[2] >> 2);
+        if (k < size)
+            dst[k++] = (group[2] << 6) | group[3];
+        n = 0;
+    }
+
+    // trailing partial group
+    if (n > 1 && k < size)
+        dst[k++] = (group[0] << 2) | (group[1] >> 4);
+    if (n > 2 && k < size)
+        dst[k++] = (group[1] << 4) | (group[2] >> 2);
+
+    return k;
+}
+
+static inline size_t Utf8LengthScalar(const char16* src, size_t len, size_t& i)
+{
+    const unsigned c = src[i++];
+
+    if (c < 0x80)
+        return 1;
+    if (c < 0x800)
+        return 2;
+    if (c >= 0xd800 && c < 0xdc00 && i < len && (src[i] & 0xfc00) == 0xdc00) {
+        i += 1;
+        return 4; // surrogate pair
+    }
+
+    return 3;
+}
+
+// returns false if the character doesn't fit
+static inline bool Utf8EncodeScalar(const char16* src, size_t len, unsigned char* dst,
+                                    size_t size, size_t& i, size_t& k)
+{
+    unsigned c = src[i];
+    size_t units = 1;
+
+    if ((c & 0xf800) == 0xd800) {
+        if (c < 0xdc00 && i + 1 < len && (src[i + 1] & 0xfc00) == 0xdc00) {
+            c = 0x10000 + ((c - 0xd800) << 10) + (src[i + 1] - 0xdc00);
+            units = 2;
+        } else {
+            c = 0xfffd; // lone surrogate
+        }
+    }
+
+    unsigned char* out = dst + k;
+
+    if (c < 0x80) {
+        if (k + 1 > size)
+            return false;
+        out[0] = c;
+        k += 1;
+    } else if (c < 0x800) {
+        if (k + 2 > size)
+            return false;
+        out[0] = 0xc0 | (c >> 6);
+        out[1] = 0x80 | (c & 0x3f);
+        k += 2;
+    } else if (c < 0x10000) {
+        if (k + 3 > size)
+            return false;
+        out[0] = 0xe0 | (c >> 12);
+        out[1] = 0x80 | ((c >> 6) & 0x3f);
+        out[2] = 0x80 | (c & 0x3f);
+        k += 3;
+    } else {
+        if (k + 4 > size)
+            return false;
+        out[0] = 0xf0 | (c >> 18);
+        out[1] = 0x80 | ((c >> 12) & 0x3f);
+        out[2] = 0x80 | ((c >> 6) & 0x3f);
+        out[3] = 0x80 | (c & 0x3f);
+        k += 4;
+    }
+
+    i += units;
+
+    return true;
+}
+
+// an invalid sequence is replaced by one U+FFFD per maximal subpart, so
+// the output never has more characters than the input has bytes
+static inline void Utf8DecodeScalar(const unsigned char* src, size_t len, char16* dst,
+                                    size_t& i, size_t& k)
+{
+    const unsigned lead = src[i++];
+
+    if (lead < 0x80) {
+        dst[k++] = char16(lead);
+        return;
+    }
+
+    unsigned c, need;
+    unsigned lo = 0x80, hi = 0xbf; // range of the next byte
+
+    if (lead >= 0xc2 && lead <= 0xdf) {
+        c = lead & 0x1f;
+        need = 1;
+    } else if (lead >= 0xe0 && lead <= 0xef) {
+        c = lead & 0x0f;
+        need = 2;
+        if (lead == 0xe0)
+            lo = 0xa0; // overlong
+        else if (lead == 0xed)
+            hi = 0x9f; // surrogates
+    } else if (lead >= 0xf0 && lead <= 0xf4) {
+        c = lead & 0x07;
+        need = 3;
+        if (lead == 0xf0)
+            lo = 0x90; // overlong
+        else if (lead == 0xf4)
+            hi = 0x8f; // above U+10FFFF
+    } else {
+        dst[k++] = 0xfffd;
+        return;
+    }
+
+    for (; need; --need, lo = 0x80, hi = 0xbf) {
+        if (i >= len || src[i] < lo || src[i] > hi) {
+            dst[k++] = 0xfffd;
+            return;
+        }
+        c = (c << 6) | (src[i++] & 0x3f);
+    }
+
+    if (c < 0x10000) {
+        dst[k++] = char16(c);
+    } else {
+        c -= 0x10000;
+        dst[k++] = char16(0xd800 | (c >> 10));
+        dst[k++] = char16(0xdc00 | (c & 0x3ff));
+    }
+}
+
+#ifdef NCJS_CODEC_X86
+
+/// ----------------------------------------------------------------------------
+/// SSE2
+/// ----------------------------------------------------------------------------
+
+NCJS_TARGET("sse2")
+static inline __m128i HexDigitsSSE2(__m128i nibbles)
+{
+    const __m128i alpha = _mm_cmpgt_epi8(nibbles, _mm_set1_epi8(9));
+    return _mm_add_epi8(_mm_add_epi8(nibbles, _mm_set1_epi8('0')),
+                        _mm_and_si128(alpha, _mm_set1_epi8('a' - '0' - 10)));
+}
+
+// chars 0..255 to nibbles, valid gets 0xff for hex digits
+NCJS_TARGET("sse2")
+static inline __m128i UnhexSSE2(__m128i chars, __m128i& valid)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i lower = _mm_or_si128(chars, _mm_set1_epi8(0x20));
+    const __m128i digit = _mm_cmpeq_epi8(zero,
+        _mm_or_si128(_mm_subs_epu8(chars, _mm_set1_epi8('9')),
+                     _mm_subs_epu8(_mm_set1_epi8('0'), chars)));
+    const __m128i alpha = _mm_cmpeq_epi8(zero,
+        _mm_or_si128(_mm_subs_epu8(lower, _mm_set1_epi8('f')),
+                     _mm_subs_epu8(_mm_set1_epi8('a'), lower)));
+
+    valid = _mm_or_si128(digit, alpha);
+
+    return _mm_or_si128(
+        _mm_and_si128(digit, _mm_sub_epi8(chars, _mm_set1_epi8('0'))),
+        _mm_and_si128(alpha, _mm_sub_epi8(lower, _mm_set1_epi8('a' - 10))));
+}
+
+// pairs of nibbles, high nibble first, to bytes in the low half of each word
+NCJS_TARGET("sse2")
+static inline __m128i JoinNibblesSSE2(__m128i nibbles)
+{
+    return _mm_or_si128(_mm_slli_epi16(_mm_and_si128(nibbles, _mm_set1_epi16(0x00ff)), 4),
+                        _mm_srli_epi16(nibbles, 8));
+}
+
+NCJS_TARGET("sse2")
+static inline __m128i InRangeSSE2(__m128i chars, char lo, char hi)
+{
+    return _mm_and_si128(_mm_cmpgt_epi8(chars, _mm_set1_epi8(lo - 1)),
+                         _mm_cmplt_epi8(chars, _mm_set1_epi8(hi + 1)));
+}
+
+// chars 0..255 to 6-bit values, valid gets 0xff for base64 characters
+NCJS_TARGET("sse2")
+static inline __m128i Unbase64SSE2(__m128i chars, __m128i& valid)
+{
+    const __m128i upper = InRangeSSE2(chars, 'A', 'Z');
+    const __m128i lower = InRangeSSE2(chars, 'a', 'z');
+    const __m128i digit = InRangeSSE2(chars, '0', '9');
+    const __m128i c62 = _mm_or_si128(_mm_cmpeq_epi8(chars, _mm_set1_epi8('+')),
+                                     _mm_cmpeq_epi8(chars, _mm_set1_epi8('-')));
+    const __m128i c63 = _mm_or_si128(_mm_cmpeq_epi8(chars, _mm_set1_epi8('/')),
+                                     _mm_cmpeq_epi8(chars, _mm_set1_epi8('_')));
+    const __m128i alnum = _mm_or_si128(_mm_or_si128(upper, lower), digit);
+
+    valid = _mm_or_si128(alnum, _mm_or_si128(c62, c63));
+
+    const __m128i shift = _mm_or_si128(
+        _mm_or_si128(_mm_and_si128(upper, _mm_set1_epi8(-'A')),
+                     _mm_and_si128(lower, _mm_set1_epi8(26 - 'a'))),
+        _mm_and_si128(digit, _mm_set1_epi8(52 - '0')));
+
+    return _mm_or_si128(
+        _mm_and_si128(alnum, _mm_add_epi8(chars, shift)),
+        _mm_or_si128(_mm_and_si128(c62, _mm_set1_epi8(62)),
+                     _mm_and_si128(c63, _mm_set1_epi8(63))));
+}
+
+// every 4 values to a 24-bit number in the low bytes of each dword
+NCJS_TARGET("sse2")
+static inline __m128i JoinSextetsSSE2(__m128i values)
+{
+    const __m128i pairs = _mm_or_si128(
+        _mm_slli_epi16(_mm_and_si128(values, _mm_set1_epi16(0x00ff)), 6),
+        _mm_srli_epi16(values, 8));
+
+    return _mm_or_si128(_mm_slli_epi32(_mm_and_si128(pairs, _mm_set1_epi32(0xffff)), 12),
+                        _mm_srli_epi32(pairs, 16));
+}
+
+NCJS_TARGET("sse2")
+static size_t HexEncodeSSE2(const unsigned char* src, size_t len, char16* dst)
+{
+    const __m128i low = _mm_set1_epi8(0x0f);
+    const __m128i zero = _mm_setzero_si128();
+    size_t i = 0;
+
+    for (; i + 16 <= len; i += 16, dst += 32) {
+        const __m128i bytes = _mm_loadu_si128(To<const __m128i*>(src + i));
+        const __m128i hi = HexDigitsSSE2(_mm_and_si128(_mm_srli_epi16(bytes, 4), low));
+        const __m128i lo = HexDigitsSSE2(_mm_and_si128(bytes, low));
+        const __m128i a = _mm_unpacklo_epi8(hi, lo);
+        const __m128i b = _mm_unpackhi_epi8(hi, lo);
+
+        __m128i* out = To<__m128i*>(dst);
+        _mm_storeu_si128(out,     _mm_unpacklo_epi8(a, zero));
+        _mm_storeu_si128(out + 1, _mm_unpackhi_epi8(a, zero));
+        _mm_storeu_si128(out + 2, _mm_unpacklo_epi8(b, zero));
+        _mm_storeu_si128(out + 3, _mm_unpackhi_epi8(b, zero));
+    }
+
+    return i;
+}
+
+NCJS_TARGET("sse2")
+static size_t HexDecodeSSE2(const char16* src, size_t len, unsigned char* dst)
+{
+    size_t i = 0;
+
+    for (; i + 32 <= len; i += 32, dst += 16) {
+        const __m128i* in = To<const __m128i*>(src + i);
+        // characters above 0xff saturate to 0x00 or 0xff, both invalid
+        const __m128i c0 = _mm_packus_epi16(_mm_loadu_si128(in), _mm_loadu_si128(in + 1));
+        const __m128i c1 = _mm_packus_epi16(_mm_loadu_si128(in + 2), _mm_loadu_si128(in + 3));
+
+        __m128i v0, v1;
+        const __m128i n0 = UnhexSSE2(c0, v0);
+        const __m128i n1 = UnhexSSE2(c1, v1);
+
+        if (_mm_movemask_epi8(_mm_and_si128(v0, v1)) != 0xffff)
+            break; // let the scalar loop find the invalid pair
+
+        _mm_storeu_si128(To<__m128i*>(dst),
+                         _mm_packus_epi16(JoinNibblesSSE2(n0), JoinNibblesSSE2(n1)));
+    }
+
+    return i;
+}
+
+NCJS_TARGET("sse2")
+static void Base64DecodeSSE2(const char16* src, size_t len, unsigned char* dst,
+                             size_t size, size_t& i, size_t& k)
+{
+    for (; i + 16 <= len && k + 12 <= size; i += 16, k += 12) {
+        const __m128i* in = To<const __m128i*>(src + i);
+        const __m128i chars = _mm_packus_epi16(_mm_loadu_si128(in), _mm_loadu_si128(in + 1));
+
+        __m128i valid;
+        const __m128i values = Unbase64SSE2(chars, valid);
+
+        if (_mm_movemask_epi8(valid) != 0xffff)
+            break;
+
+        unsigned words[4];
+        _mm_storeu_si128(To<__m128i*>(&words[0]), JoinSextetsSSE2(values));
+
+        for (unsigned n = 0; n < 4; ++n) {
+            unsigned char* out = dst + k + n * 3;
+            out[0] = static_cast<unsigned char>(words[n] >> 16);
+            out[1] = static_cast<unsigned char>(words[n] >> 8);
+            out[2] = static_cast<unsigned char>(words[n]);
+        }
+    }
+}
+
+// The UTF-8 kernels convert a block of ASCII characters at once, otherwise
+// they keep its ASCII prefix and convert the following non-ASCII run with
+// the scalar code, so a sparse non-ASCII text stays vectorized. Utf8Length
+// leaves a block with surrogates to the scalar code. Utf8Encode must not
+// touch the target bytes past the characters written, so near the end of
+// the target a partial block is copied byte by byte.
+
+// index of the lowest set bit, mask must not be zero
+static inline unsigned LowestBit(unsigned mask)
+{
+#ifdef _MSC_VER
+    unsigned long index;
+    _BitScanForward(&index, mask);
+    return unsigned(index);
+#else
+    return unsigned(__builtin_ctz(mask));
+#endif
+}
+
+NCJS_TARGET("sse2")
+static size_t Utf8LengthSSE2(const char16* src, size_t len)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i ones = _mm_set1_epi16(1);
+    __m128i extra = zero;
+    size_t bytes = 0;
+    size_t i = 0;
+
+    while (i + 8 <= len) {
+        const __m128i units = _mm_loadu_si128(To<const __m128i*>(src + i));
+        const __m128i top = _mm_and_si128(units, _mm_set1_epi16(short(0xf800)));
+
+        if (_mm_movemask_epi8(_mm_cmpeq_epi16(top, _mm_set1_epi16(short(0xd800))))) {
+            for (const size_t end = i + 8; i < end;)
+                bytes += Utf8LengthScalar(src, len, i);
+            continue;
+        }
+
+        // 3 bytes per unit, minus one below U+0800 and one more below U+0080
+        const __m128i ascii = _mm_cmpeq_epi16(_mm_and_si128(units, _mm_set1_epi16(short(0xff80))), zero);
+        const __m128i latin = _mm_cmpeq_epi16(top, zero);
+        extra = _mm_add_epi32(extra, _mm_madd_epi16(_mm_add_epi16(ascii, latin), ones));
+
+        bytes += 24;
+        i += 8;
+    }
+
+    int sums[4];
+    _mm_storeu_si128(To<__m128i*>(&sums[0]), extra);
+    bytes += sums[0] + sums[1] + sums[2] + sums[3];
+
+    while (i < len)
+        bytes += Utf8LengthScalar(src, len, i);
+
+    return bytes;
+}
+
+NCJS_TARGET("sse2")
+static void Utf8EncodeSSE2(const char16* src, size_t len, unsigned char* dst,
+                           size_t size, size_t& i, size_t& k)
+{
+    const __m128i high = _mm_set1_epi16(short(0xff80));
+    const __m128i zero = _mm_setzero_si128();
+
+    while (i + 16 <= len && k + 16 <= size) {
+        const __m128i* in = To<const __m128i*>(src + i);
+        const __m128i a = _mm_loadu_si128(in);
+        const __m128i b = _mm_loadu_si128(in + 1);
+        // one bit per unit above U+007F
+        const unsigned mask = ~_mm_movemask_epi8(_mm_packs_epi16(
+            _mm_cmpeq_epi16(_mm_and_si128(a, high), zero),
+            _mm_cmpeq_epi16(_mm_and_si128(b, high), zero))) & 0xffff;
+
+        // the rest of the block overwrites the non-ASCII bytes
+        // when its characters fit in any case
+        const bool room = k + 16 * 3 <= size;
+
+        if (!mask || room)
+            _mm_storeu_si128(To<__m128i*>(dst + k), _mm_packus_epi16(a, b));
+
+        if (!mask) {
+            i += 16;
+            k += 16;
+            continue;
+        }
+
+        if (room) {
+            const unsigned ascii = LowestBit(mask);
+            i += ascii;
+            k += ascii;
+        } else {
+            for (const size_t end = i + LowestBit(mask); i < end;)
+                dst[k++] = static_cast<unsigned char>(src[i++]);
+        }
+
+        do {
+            if (!Utf8EncodeScalar(src, len, dst, size, i, k))
+                return;
+        } while (i < len && src[i] >= 0x80);
+    }
+}
+
+NCJS_TARGET("sse2")
+static void Utf8DecodeSSE2(const unsigned char* src, size_t len, char16* dst,
+                           size_t& i, size_t& k)
+{
+    const __m128i zero = _mm_setzero_si128();
+
+    // k never passes i, so a whole block always fits in dst
+    while (i + 16 <= len) {
+        const __m128i bytes = _mm_loadu_si128(To<const __m128i*>(src + i));
+        const unsigned mask = _mm_movemask_epi8(bytes);
+        __m128i* out = To<__m128i*>(dst + k);
+
+        _mm_storeu_si128(out,     _mm_unpacklo_epi8(bytes, zero));
+        _mm_storeu_si128(out + 1, _mm_unpackhi_epi8(bytes, zero));
+
+        if (!mask) {
+            i += 16;
+            k += 16;
+            continue;
+        }
+
+        const unsigned ascii = LowestBit(mask);
+        i += ascii;
+        k += ascii;
+
+        do {
+            Utf8DecodeScalar(src, len, dst, i, k);
+        } while (i < len && src[i] >= 0x80);
+    }
+}
+
+#if NCJS_HAVE_SSSE3
+
+/// ----------------------------------------------------------------------------
+/// SSSE3
+/// ----------------------------------------------------------------------------
+
+// 12 bytes to 16 base64 characters, see Wojciech Mula's "Base64 encoding
+// with SIMD instructions"
+NCJS_TARGET("ssse3")
+static inline __m128i Base64CharsSSSE3(__m128i bytes)
+{
+    const __m128i in = _mm_shuffle_epi8(bytes,
+        _mm_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1));
+
+    const __m128i t0 = _mm_and_si128(in, _mm_set1_epi32(0x0fc0fc00));
+    const __m128i t1 = _mm_mulhi_epu16(t0, _mm_set1_epi32(0x04000040));
+    const __m128i t2 = _mm_and_si128(in, _mm_set1_epi32(0x003f03f0));
+    const __m128i t3 = _mm_mullo_epi16(t2, _mm_set1_epi32(0x01000010));
+    const __m128i values = _mm_or_si128(t1, t3);
+
+    // 0..25 -> 13, 26..51 -> 0, 52..61 -> 1..10, 62 -> 11, 63 -> 12
+    __m128i index = _mm_subs_epu8(values, _mm_set1_epi8(51));
+    index = _mm_or_si128(index, _mm_and_si128(_mm_cmpgt_epi8(_mm_set1_epi8(26), values),
+                                              _mm_set1_epi8(13)));
+
+    const __m128i shift = _mm_setr_epi8(
+        'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+        '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0);
+
+    return _mm_add_epi8(_mm_shuffle_epi8(shift, index), values);
+}
+
+NCJS_TARGET("ssse3")
+static inline __m128i PackTriplesSSSE3(__m128i words)
+{
+    return _mm_shuffle_epi8(words,
+        _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+}
+
+NCJS_TARGET("ssse3")
+static size_t Base64EncodeSSSE3(const unsigned char* src, size_t len, char16* dst)
+{
+    const __m128i zero = _mm_setzero_si128();
+    size_t i = 0;
+
+    // loads 16 bytes, uses 12 of them
+    for (; i + 16 <= len; i += 12, dst += 16) {
+        const __m128i chars = Base64CharsSSSE3(_mm_loadu_si128(To<const __m128i*>(src + i)));
+
+        __m128i* out = To<__m128i*>(dst);
+        _mm_storeu_si128(out,     _mm_unpacklo_epi8(chars, zero));
+        _mm_storeu_si128(out + 1, _mm_unpackhi_epi8(chars, zero));
+    }
+
+    return i;
+}
+
+// the low 12 bytes, size is only an upper bound of the decoded length and
+// the caller's bytes past it must stay untouched
+static inline void Store12SSE2(unsigned char* dst, __m128i bytes)
+{
+    const int last = _mm_cvtsi128_si32(_mm_srli_si128(bytes, 8));
+
+    _mm_storel_epi64(To<__m128i*>(dst), bytes);
+    memcpy(dst + 8, &last, 4);
+}
+
+NCJS_TARGET("ssse3")
+static void Base64DecodeSSSE3(const char16* src, size_t len, unsigned char* dst,
+                              size_t size, size_t& i, size_t& k)
+{
+    for (; i + 16 <= len && k + 12 <= size; i += 16, k += 12) {
+        const __m128i* in = To<const __m128i*>(src + i);
+        const __m128i chars = _mm_packus_epi16(_mm_loadu_si128(in), _mm_loadu_si128(in + 1));
+
+        __m128i valid;
+        const __m128i values = Unbase64SSE2(chars, valid);
+
+        if (_mm_movemask_epi8(valid) != 0xffff)
+            break;
+
+        Store12SSE2(dst + k, PackTriplesSSSE3(JoinSextetsSSE2(values)));
+    }
+}
+
+#endif // NCJS_HAVE_SSSE3
+
+#if NCJS_HAVE_AVX2
+
+/// ----------------------------------------------------------------------------
+/// AVX2
+/// ----------------------------------------------------------------------------
+
+// The AVX2 kernels leave the tail to the SSE kernels, clear the upper halves
+// of the registers first to avoid the AVX-SSE transition penalty.
+
+NCJS_TARGET("avx2")
+static inline __m256i HexDigitsAVX2(__m256i nibbles)
+{
+    const __m256i alpha = _mm256_cmpgt_epi8(nibbles, _mm256_set1_epi8(9));
+    return _mm256_add_epi8(_mm256_add_epi8(nibbles, _mm256_set1_epi8('0')),
+                           _mm256_and_si256(alpha, _mm256_set1_epi8('a' - '0' - 10)));
+}
+
+NCJS_TARGET("avx2")
+static inline __m256i UnhexAVX2(__m256i chars, __m256i& valid)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i lower = _mm256_or_si256(chars, _mm256_set1_epi8(0x20));
+    const __m256i digit = _mm256_cmpeq_epi8(zero,
+        _mm256_or_si256(_mm256_subs_epu8(chars, _mm256_set1_epi8('9')),
+                        _mm256_subs_epu8(_mm256_set1_epi8('0'), chars)));
+    const __m256i alpha = _mm256_cmpeq_epi8(zero,
+        _mm256_or_si256(_mm256_subs_epu8(lower, _mm256_set1_epi8('f')),
+                        _mm256_subs_epu8(_mm256_set1_epi8('a'), lower)));
+
+    valid = _mm256_or_si256(digit, alpha);
+
+    return _mm256_or_si256(
+        _mm256_and_si256(digit, _mm256_sub_epi8(chars, _mm256_set1_epi8('0'))),
+        _mm256_and_si256(alpha, _mm256_sub_epi8(lower, _mm256_set1_epi8('a' - 10))));
+}
+
+NCJS_TARGET("avx2")
+static inline __m256i JoinNibblesAVX2(__m256i nibbles)
+{
+    return _mm256_or_si256(
+        _mm256_slli_epi16(_mm256_and_si256(nibbles, _mm256_set1_epi16(0x00ff)), 4),
+        _mm256_srli_epi16(nibbles, 8));
+}
+
+// packus works within 128-bit lanes, restore the order of the qwords
+NCJS_TARGET("avx2")
+static inline __m256i PackWordsAVX2(__m256i a, __m256i b)
+{
+    return _mm256_permute4x64_epi64(_mm256_packus_epi16(a, b), 0xd8);
+}
+
+NCJS_TARGET("avx2")
+static inline __m256i InRangeAVX2(__m256i chars, char lo, char hi)
+{
+    return _mm256_and_si256(_mm256_cmpgt_epi8(chars, _mm256_set1_epi8(lo - 1)),
+                            _mm256_cmpgt_epi8(_mm256_set1_epi8(hi + 1), chars));
+}
+
+NCJS_TARGET("avx2")
+static inline __m256i Unbase64AVX2(__m256i chars, __m256i& valid)
+{
+    const __m256i upper = InRangeAVX2(chars, 'A', 'Z');
+    const __m256i lower = InRangeAVX2(chars, 'a', 'z');
+    const __m256i digit = InRangeAVX2(chars, '0', '9');
+    const __m256i c62 = _mm256_or_si256(_mm256_cmpeq_epi8(chars, _mm256_set1_epi8('+')),
+                                        _mm256_cmpeq_epi8(chars, _mm256_set1_epi8('-')));
+    const __m256i c63 = _mm256_or_si256(_mm256_cmpeq_epi8(chars, _mm256_set1_epi8('/')),
+                                        _mm256_cmpeq_epi8(chars, _mm256_set1_epi8('_')));
+    const __m256i alnum = _mm256_or_si256(_mm256_or_si256(upper, lower), digit);
+
+    valid = _mm256_or_si256(alnum, _mm256_or_si256(c62, c63));
+
+    const __m256i shift = _mm256_or_si256(
+        _mm256_or_si256(_mm256_and_si256(upper, _mm256_set1_epi8(-'A')),
+                        _mm256_and_si256(lower, _mm256_set1_epi8(26 - 'a'))),
+        _mm256_and_si256(digit, _mm256_set1_epi8(52 - '0')));
+
+    return _mm256_or_si256(
+        _mm256_and_si256(alnum, _mm256_add_epi8(chars, shift)),
+        _mm256_or_si256(_mm256_and_si256(c62, _mm256_set1_epi8(62)),
+                        _mm256_and_si256(c63, _mm256_set1_epi8(63))));
+}
+
+NCJS_TARGET("avx2")
+static inline __m256i JoinSextetsAVX2(__m256i values)
+{
+    const __m256i pairs = _mm256_or_si256(
+        _mm256_slli_epi16(_mm256_and_si256(values, _mm256_set1_epi16(0x00ff)), 6),
+        _mm256_srli_epi16(values, 8));
+
+    return _mm256_or_si256(
+        _mm256_slli_epi32(_mm256_and_si256(pairs, _mm256_set1_epi32(0xffff)), 12),
+        _mm256_srli_epi32(pairs, 16));
+}
+
+NCJS_TARGET("avx2")
+static size_t HexEncodeAVX2(const unsigned char* src, size_t len, char16* dst)
+{
+    const __m256i low = _mm256_set1_epi8(0x0f);
+    size_t i = 0;
+
+    for (; i + 32 <= len; i += 32, dst += 64) {
+        const __m256i bytes = _mm256_loadu_si256(To<const __m256i*>(src + i));
+        const __m256i hi = HexDigitsAVX2(_mm256_and_si256(_mm256_srli_epi16(bytes, 4), low));
+        const __m256i lo = HexDigitsAVX2(_mm256_and_si256(bytes, low));
+        // a: bytes 0..7 | 16..23, b: bytes 8..15 | 24..31
+        const __m256i a = _mm256_unpacklo_epi8(hi, lo);
+        const __m256i b = _mm256_unpackhi_epi8(hi, lo);
+
+        __m256i* out = To<__m256i*>(dst);
+        _mm256_storeu_si256(out,     _mm256_cvtepu8_epi16(_mm256_castsi256_si128(a)));
+        _mm256_storeu_si256(out + 1, _mm256_cvtepu8_epi16(_mm256_castsi256_si128(b)));
+        _mm256_storeu_si256(out + 2, _mm256_cvtepu8_epi16(_mm256_extracti128_si256(a, 1)));
+        _mm256_storeu_si256(out + 3, _mm256_cvtepu8_epi16(_mm256_extracti128_si256(b, 1)));
+    }
+
+    return i;
+}
+
+NCJS_TARGET("avx2")
+static size_t HexDecodeAVX2(const char16* src, size_t len, unsigned char* dst)
+{
+    size_t i = 0;
+
+    for (; i + 64 <= len; i += 64, dst += 32) {
+        const __m256i* in = To<const __m256i*>(src + i);
+        const __m256i c0 = PackWordsAVX2(_mm256_loadu_si256(in), _mm256_loadu_si256(in + 1));
+        const __m256i c1 = PackWordsAVX2(_mm256_loadu_si256(in + 2), _mm256_loadu_si256(in + 3));
+
+        __m256i v0, v1;
+        const __m256i n0 = UnhexAVX2(c0, v0);
+        const __m256i n1 = UnhexAVX2(c1, v1);
+
+        if (_mm256_movemask_epi8(_mm256_and_si256(v0, v1)) != -1)
+            break;
+
+        _mm256_storeu_si256(To<__m256i*>(dst),
+                            PackWordsAVX2(JoinNibblesAVX2(n0), JoinNibblesAVX2(n1)));
+    }
+
+    return i;
+}
+
+NCJS_TARGET("avx2")
+static size_t Base64EncodeAVX2(const unsigned char* src, size_t len, char16* dst)
+{
+    const __m256i spread = _mm256_setr_epi8(
+        1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10,
+        1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10);
+    const __m256i shift = _mm256_setr_epi8(
+        'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+        '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0,
+        'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+        '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0);
+    size_t i = 0;
+
+    // 12 bytes per lane, the second load reads 4 bytes past the block
+    for (; i + 28 <= len; i += 24, dst += 32) {
+        const __m256i bytes = _mm256_inserti128_si256(
+            _mm256_castsi128_si256(_mm_loadu_si128(To<const __m128i*>(src + i))),
+            _mm_loadu_si128(To<const __m128i*>(src + i + 12)), 1);
+
+        const __m256i in = _mm256_shuffle_epi8(bytes, spread);
+        const __m256i t0 = _mm256_and_si256(in, _mm256_set1_epi32(0x0fc0fc00));
+        const __m256i t1 = _mm256_mulhi_epu16(t0, _mm256_set1_epi32(0x04000040));
+        const __m256i t2 = _mm256_and_si256(in, _mm256_set1_epi32(0x003f03f0));
+        const __m256i t3 = _mm256_mullo_epi16(t2, _mm256_set1_epi32(0x01000010));
+        const __m256i values = _mm256_or_si256(t1, t3);
+
+        __m256i index = _mm256_subs_epu8(values, _mm256_set1_epi8(51));
+        index = _mm256_or_si256(index,
+            _mm256_and_si256(_mm256_cmpgt_epi8(_mm256_set1_epi8(26), values),
+                             _mm256_set1_epi8(13)));
+
+        const __m256i chars = _mm256_add_epi8(_mm256_shuffle_epi8(shift, index), values);
+
+        __m256i* out = To<__m256i*>(dst);
+        _mm256_storeu_si256(out,     _mm256_cvtepu8_epi16(_mm256_castsi256_si128(chars)));
+        _mm256_storeu_si256(out + 1, _mm256_cvtepu8_epi16(_mm256_extracti128_si256(chars, 1)));
+    }
+
+    return i;
+}
+
+NCJS_TARGET("avx2")
+static void Base64DecodeAVX2(const char16* src, size_t len, unsigned char* dst,
+                             size_t size, size_t& i, size_t& k)
+{
+    const __m256i pack = _mm256_setr_epi8(
+        2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1,
+        2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1);
+
+    // 12 bytes per lane
+    for (; i + 32 <= len && k + 24 <= size; i += 32, k += 24) {
+        const __m256i* in = To<const __m256i*>(src + i);
+        const __m256i chars = PackWordsAVX2(_mm256_loadu_si256(in), _mm256_loadu_si256(in + 1));
+
+        __m256i valid;
+        const __m256i values = Unbase64AVX2(chars, valid);
+
+        if (_mm256_movemask_epi8(valid) != -1)
+            break;
+
+        const __m256i bytes = _mm256_shuffle_epi8(JoinSextetsAVX2(values), pack);
+        Store12SSE2(dst + k, _mm256_castsi256_si128(bytes));
+        Store12SSE2(dst + k + 12, _mm256_extracti128_si256(bytes, 1));
+    }
+
+    _mm256_zeroupper();
+    Base64DecodeSSSE3(src, len, dst, size, i, k);
+}
+
+NCJS_TARGET("avx2")
+static size_t Utf8LengthAVX2(const char16* src, size_t len)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i ones = _mm256_set1_epi16(1);
+    __m256i extra = zero;
+    size_t bytes = 0;
+    size_t i = 0;
+
+    while (i + 16 <= len) {
+        const __m256i units = _mm256_loadu_si256(To<const __m256i*>(src + i));
+        const __m256i top = _mm256_and_si256(units, _mm256_set1_epi16(short(0xf800)));
+
+        if (_mm256_movemask_epi8(_mm256_cmpeq_epi16(top, _mm256_set1_epi16(short(0xd800))))) {
+            for (const size_t end = i + 16; i < end;)
+                bytes += Utf8LengthScalar(src, len, i);
+            continue;
+        }
+
+        const __m256i ascii = _mm256_cmpeq_epi16(
+            _mm256_and_si256(units, _mm256_set1_epi16(short(0xff80))), zero);
+        const __m256i latin = _mm256_cmpeq_epi16(top, zero);
+        extra = _mm256_add_epi32(extra, _mm256_madd_epi16(_mm256_add_epi16(ascii, latin), ones));
+
+        bytes += 48;
+        i += 16;
+    }
+
+    int sums[8];
+    _mm256_storeu_si256(To<__m256i*>(&sums[0]), extra);
+    for (int n = 0; n < 8; ++n)
+        bytes += sums[n];
+
+    _mm256_zeroupper();
+    return bytes + Utf8LengthSSE2(src + i, len - i);
+}
+
+NCJS_TARGET("avx2")
+static void Utf8EncodeAVX2(const char16* src, size_t len, unsigned char* dst,
+                           size_t size, size_t& i, size_t& k)
+{
+    const __m256i high = _mm256_set1_epi16(short(0xff80));
+    const __m256i zero = _mm256_setzero_si256();
+
+    while (i + 32 <= len && k + 32 <= size) {
+        const __m256i* in = To<const __m256i*>(src + i);
+        const __m256i a = _mm256_loadu_si256(in);
+        const __m256i b = _mm256_loadu_si256(in + 1);
+        // one bit per unit above U+007F, in the order of PackWordsAVX2
+        const unsigned mask = ~unsigned(_mm256_movemask_epi8(_mm256_permute4x64_epi64(
+            _mm256_packs_epi16(_mm256_cmpeq_epi16(_mm256_and_si256(a, high), zero),
+                               _mm256_cmpeq_epi16(_mm256_and_si256(b, high), zero)), 0xd8)));
+
+        // the rest of the block overwrites the non-ASCII bytes
+        // when its characters fit in any case
+        const bool room = k + 32 * 3 <= size;
+
+        if (!mask || room)
+            _mm256_storeu_si256(To<__m256i*>(dst + k), PackWordsAVX2(a, b));
+
+        if (!mask) {
+            i += 32;
+            k += 32;
+            continue;
+        }
+
+        if (room) {
+            const unsigned ascii = LowestBit(mask);
+            i += ascii;
+            k += ascii;
+        } else {
+            for (const size_t end = i + LowestBit(mask); i < end;)
+                dst[k++] = static_cast<unsigned char>(src[i++]);
+        }
+
+        do {
+            if (!Utf8EncodeScalar(src, len, dst, size, i, k))
+                return;
+        } while (i < len && src[i] >= 0x80);
+    }
+
+    _mm256_zeroupper();
+    Utf8EncodeSSE2(src, len, dst, size, i, k);
+}
+
+NCJS_TARGET("avx2")
+static void Utf8DecodeAVX2(const unsigned char* src, size_t len, char16* dst,
+                           size_t& i, size_t& k)
+{
+    while (i + 32 <= len) {
+        const __m256i bytes = _mm256_loadu_si256(To<const __m256i*>(src + i));
+
+        const unsigned mask = unsigned(_mm256_movemask_epi8(bytes));
+        __m256i* out = To<__m256i*>(dst + k);
+
+        _mm256_storeu_si256(out,     _mm256_cvtepu8_epi16(_mm256_castsi256_si128(bytes)));
+        _mm256_storeu_si256(out + 1, _mm256_cvtepu8_epi16(_mm256_extracti128_si256(bytes, 1)));
+
+        if (!mask) {
+            i += 32;
+            k += 32;
+            continue;
+        }
+
+        const unsigned ascii = LowestBit(mask);
+        i += ascii;
+        k += ascii;
+
+        do {
+            Utf8DecodeScalar(src, len, dst, i, k);
+        } while (i < len && src[i] >= 0x80);
+    }
+
+    _mm256_zeroupper();
+    Utf8DecodeSSE2(src, len, dst, i, k);
+}
+
+#endif // NCJS_HAVE_AVX2
+
+/// ----------------------------------------------------------------------------
+/// CPU detection
+/// ----------------------------------------------------------------------------
+
+static void CpuId(unsigned leaf, unsigned (&regs)[4])
+{
+#ifdef _MSC_VER
+    int info[4];
+#if NCJS_HAVE_AVX2
+    __cpuidex(info, int(leaf), 0);
+#else
+    __cpuid(info, int(leaf));
+#endif
+    for (int i = 0; i < 4; ++i)
+        regs[i] = unsigned(info[i]);
+#else
+    __cpuid_count(leaf, 0, regs[0], regs[1], regs[2], regs[3]);
+#endif
+}
+
+static Codec::Level DetectLevel()
+{
+    unsigned regs[4];
+
+    CpuId(0, regs);
+    const unsigned maxLeaf = regs[0];
+
+    if (maxLeaf < 1)
+        return Codec::SCALAR;
+
+    CpuId(1, regs);
+
+    if (!(regs[3] & (1 << 26)))
+        return Codec::SCALAR;
+
+#if NCJS_HAVE_SSSE3
+    if (!(regs[2] & (1 << 9)))
+        return Codec::SSE2;
+#else
+    return Codec::SSE2;
+#endif
+
+#if NCJS_HAVE_AVX2
+    // the OS must save the YMM registers too
+    const unsigned osxsave = 1 << 27;
+    const unsigned avx = 1 << 28;
+
+    if ((regs[2] & (osxsave | avx)) != (osxsave | avx) || maxLeaf < 7)
+        return Codec::SSSE3;
+
+#ifdef _MSC_VER
+    const unsigned long long xcr0 = _xgetbv(0);
+#else
+    unsigned eax, edx;
+    __asm__ ("xgetbv" : "=a" (eax), "=d" (edx) : "c" (0));
+    const unsigned long long xcr0 = eax | ((unsigned long long)edx << 32);
+#endif
+
+    if ((xcr0 & 6) != 6)
+        return Codec::SSSE3;
+
+    CpuId(7, regs);
+
+    return (regs[1] & (1 << 5)) ? Codec::AVX2 : Codec::SSSE3;
+#else
+    return Codec::SSSE3;
+#endif
+}
+
+#endif // NCJS_CODEC_X86
+
+/// ----------------------------------------------------------------------------
+/// static functions
+/// ----------------------------------------------------------------------------
+
+void Codec::HexEncode(const char* src, size_t len, char16* dst)
+{
+    const unsigned char* bytes = To<const unsigned char*>(src);
+    size_t i = 0;
+
+    switch (s_level) {
+#ifdef NCJS_CODEC_X86
+#if NCJS_HAVE_AVX2
+    case AVX2:
+        i = HexEncodeAVX2(bytes, len, dst);
+        i += HexEncodeSSE2(bytes + i, len - i, dst + i * 2);    // the tail
+        break;
+#endif
+    case SSSE3:
+    case SSE2:
+        i += HexEncodeSSE2(bytes + i, len - i, dst + i * 2);
+        break;
+#endif
+    default:
+        break;
+    }
+
+    HexEncodeScalar(bytes + i, len - i, dst + i * 2);
+}
+
+size_t Codec::HexDecode(const char16* src, size_t len, char* dst)
+{
+    unsigned char* bytes = To<unsigned char*>(dst);
+    size_t i = 0;
+
+    switch (s_level) {
+#ifdef NCJS_CODEC_X86
+#if NCJS_HAVE_AVX2
+    case AVX2:
+        i = HexDecodeAVX2(src, len, bytes);
+        i += HexDecodeSSE2(src + i, len - i, bytes + i / 2);    // the tail
+        break;
+#endif
+    case SSSE3:
+    case SSE2:
+        i += HexDecodeSSE2(src + i, len - i, bytes + i / 2);
+        break;
+#endif
+    default:
+        break;
+    }
+
+    return i / 2 + HexDecodeScalar(src + i, len - i, bytes + i / 2);
+}
+
+size_t Codec::Base64DecodedSize(const char16* src, size_t len)
+{
+    if (len < 2)
+        return 0;
+
+    if (src[len - 1] == '=') {
+        len -= 1;
+        if (src[len - 1] == '=')
+            len -= 1;
+    }
+
+    const size_t rest = len % 4;
+    size_t size = len / 4 * 3;
+
+    // a single trailing character can't be decoded
+    if (rest && (size || rest > 1))
+        size += rest == 3 ? 2 : 1;
+
+    return size;
+}
+
+void Codec::Base64Encode(const char* src, size_t len, char16* dst)
+{
+    const unsigned char* bytes = To<const unsigned char*>(src);
+    size_t i = 0;
+
+    switch (s_level) {
+#ifdef NCJS_CODEC_X86
+#if NCJS_HAVE_AVX2
+    case AVX2:
+        i = Base64EncodeAVX2(bytes, len, dst);
+#if NCJS_HAVE_SSSE3
+        i += Base64EncodeSSSE3(bytes + i, len - i, dst + i / 3 * 4);    // the tail
+#endif
+        break;
+#endif
+#if NCJS_HAVE_SSSE3
+    case SSSE3:
+        i += Base64EncodeSSSE3(bytes + i, len - i, dst + i / 3 * 4);
+        break;
+#endif
+#endif
+    default:
+        break;
+    }
+
+    Base64EncodeScalar(bytes + i, len - i, dst + i / 3 * 4);
+}
+
+size_t Codec::Base64Decode(const char16* src, size_t len, char* dst, size_t size)
+{
+    unsigned char* bytes = To<unsigned char*>(dst);
+    size_t i = 0;
+    size_t k = 0;
+
+    switch (s_level) {
+#ifdef NCJS_CODEC_X86
+#if NCJS_HAVE_AVX2
+    case AVX2:
+        Base64DecodeAVX2(src, len, bytes, size, i, k);
+        break;
+#endif
+#if NCJS_HAVE_SSSE3
+    case SSSE3:
+        Base64DecodeSSSE3(src, len, bytes, size, i, k);
+        break;
+#endif
+    case SSE2:
+        Base64DecodeSSE2(src, len, bytes, size, i, k);
+        break;
+#endif
+    default:
+        break;
+    }
+
+    return Base64DecodeScalar(src, len, bytes, size, i, k);
+}
+
+size_t Codec::Utf8Length(const char16* src, size_t len)
+{
+    switch (s_level) {
+#ifdef NCJS_CODEC_X86
+#if NCJS_HAVE_AVX2
+    case AVX2:
+        return Utf8LengthAVX2(src, len);
+#endif
+    case SSSE3:
+    case SSE2:
+        return Utf8LengthSSE2(src, len);
+#endif
+    default:
+        break;
+    }
+
+    size_t bytes = 0;
+
+    for (size_t i = 0; i < len;)
+        bytes += Utf8LengthScalar(src, len, i);
+
+    return bytes;
+}
+
+size_t Codec::Utf8Encode(const char16* src, size_t len, char* dst, size_t size)
+{
+    unsigned char* bytes = To<unsigned char*>(dst);
+    size_t i = 0;
+    size_t k = 0;
+
+    switch (s_level) {
+#ifdef NCJS_CODEC_X86
+#if NCJS_HAVE_AVX2
+    case AVX2:
+        Utf8EncodeAVX2(src, len, bytes, size, i, k);
+        break;
+#endif
+    case SSSE3:
+    case SSE2:
+        Utf8EncodeSSE2(src, len, bytes, size, i, k);
+        break;
+#endif
+    default:
+        break;
+    }
+
+    while (i < len && Utf8EncodeScalar(src, len, bytes, size, i, k)) {}
+
+    return k;
+}
+
+size_t Codec::Utf8Decode(const char* src, size_t len, char16* dst)
+{
+    const unsigned char* bytes = To<const unsigned char*>(src);
+    size_t i = 0;
+    size_t k = 0;
+
+    switch (s_level) {
+#ifdef NCJS_CODEC_X86
+#if NCJS_HAVE_AVX2
+    case AVX2:
+        Utf8DecodeAVX2(bytes, len, dst, i, k);
+        break;
+#endif
+    case SSSE3:
+    case SSE2:
+        Utf8DecodeSSE2(bytes, len, dst, i, k);
+        break;
+#endif
+    default:
+        break;
+    }
+
+    while (i < len)
+        Utf8DecodeScalar(bytes, len, dst, i, k);
+
+    return k;
+}
+
+Codec::Level Codec::GetSupportedLevel()
+{
+#ifdef NCJS_CODEC_X86
+    static const Level level = DetectLevel();
+    return level;
+#else
+    return SCALAR;
+#endif
+}
+
+const char* Codec::GetLevelName(Level level)
+{
+    return level < LEVEL_COUNT ? s_names[level] : "";
+}
+
+Codec::Level Codec::FindLevel(const char* name)
+{
+    for (int i = 0; i < LEVEL_COUNT; ++i) {
+        if (!strcmp(name, s_names[i]))
+            return Level(i);
+    }
+
+    return LEVEL_COUNT;
+}
+
+Codec::Level Codec::SetLevel(Level max)
+{
+    return s_level = Min(max, GetSupportedLevel());
+}
+
+} // ncjs
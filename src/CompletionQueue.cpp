@@ -0,0 +1,219 @@
+
+/***************************************************************
+ * Name:      CompletionQueue.cpp
+ * Purpose:   Codes for Node-CEF Completion Queue Class
+ * Author:    Joshua GPBeta (studiocghibli@gmail.com)
+ * Created:   2016-08-04
+ * Copyright: Studio GPBeta (www.gpbeta.com)
+ * License:
+ **************************************************************/
+
+/// ============================================================================
+/// declarations
+/// ============================================================================
+
+#define _WINSOCKAPI_    // stops windows.h including winsock.h
+
+/// ----------------------------------------------------------------------------
+/// Headers
+/// ----------------------------------------------------------------------------
+
+#include "ncjs/CompletionQueue.h"
+
+#include "ncjs/base.h"
+#include "ncjs/Environment.h"
+
+#include <include/base/cef_bind.h>
+#include <include/wrapper/cef_closure_task.h>
+#include <uv.h>
+
+#include <vector>
+
+namespace ncjs {
+
+/// ----------------------------------------------------------------------------
+/// variables
+/// ----------------------------------------------------------------------------
+
+struct Completion {
+    CefRefPtr<CefV8Context> context;
+    CompletionQueue::Task task;
+};
+
+typedef std::vector<Completion> CompletionList;
+
+unsigned CompletionQueue::s_maxBatch = 64;
+unsigned CompletionQueue::s_latency = 0;
+
+static uv_mutex_t s_mutex;
+static CompletionList s_pending; // guarded by s_mutex
+static bool s_scheduled = false; // guarded by s_mutex
+static bool s_initialized = false;
+
+// renderer thread only
+static CompletionQueue::Stats s_stats;
+
+/// ============================================================================
+/// implementation
+/// ============================================================================
+
+/// ----------------------------------------------------------------------------
+/// static functions
+/// ----------------------------------------------------------------------------
+
+void CompletionQueue::Post(const CefRefPtr<CefV8Context>& context, const Task& task)
+{
+    NCJS_ASSERT(s_initialized);
+
+    Completion completion;
+    completion.context = context;
+    completion.task = task;
+
+    bool post = false;
+    bool delay = false;
+    {
+        uv_mutex_lock(&s_mutex);
+
+        s_pending.push_back(completion);
+
+        if (!s_scheduled) {
+            // first completion of a batch
+            s_scheduled = post = true;
+            delay = s_latency > 0;
+        } else if (s_pending.size() % s_maxBatch == 0) {
+            // batch is full, don't wait for the latency timer
+            post = true;
+        }
+
+        uv_mutex_unlock(&s_mutex);
+    }
+
+    if (!post)
+        return;
+
+    if (delay)
+        CefPostDelayedTask(TID_RENDERER, base::Bind(&CompletionQueue::Flush), s_latency);
+    else
+        CefPostTask(TID_RENDERER, base::Bind(&CompletionQueue::Flush));
+}
+
+void CompletionQueue::GetStats(Stats& stats)
+{
+    stats = s_stats;
+
+    uv_mutex_lock(&s_mutex);
+    stats.pending = unsigned(s_pending.size());
+    uv_mutex_unlock(&s_mutex);
+}
+
+void CompletionQueue::Flush()
+{
+    CompletionList batch;
+    bool full = false;
+    {
+        uv_mutex_lock(&s_mutex);
+
+        if (s_pending.size() > s_maxBatch) {
+            // deliver the first s_maxBatch ones, leave the rest to a new task
+            CompletionList::iterator end = s_pending.begin() + s_maxBatch;
+            batch.assign(s_pending.begin(), end);
+            s_pending.erase(s_pending.begin(), end);
+            full = true;
+        } else {
+            batch.swap(s_pending);
+            s_scheduled = false;
+        }
+
+        uv_mutex_unlock(&s_mutex);
+    }
+
+    if (full)
+        CefPostTask(TID_RENDERER, base::Bind(&CompletionQueue::Flush));
+
+    const size_t size = batch.size();
+
+    if (size == 0)
+        return; // already delivered by a previous task
+
+    s_stats.batches += 1;
+    s_stats.completions += double(size);
+    s_stats.fullBatches += full ? 1 : 0;
+    s_stats.largest = Max(s_stats.largest, unsigned(size));
+
+    // run completions context by context, keeping the posting order
+    // for completions of the same context
+    std::vector<bool> done(size, false);
+
+    for (size_t i = 0; i < size; ++i) {
+        if (done[i])
+            continue;
+
+        const CefRefPtr<CefV8Context>& context = batch[i].context;
+        Environment* env = NULL;
+
+        // entered first, so the environment key of the context can be read
+        if (context->IsValid() && context->Enter()) {
+            env = Environment::Get(context);
+
+            if (env)
+                s_stats.entries += 1;
+            else
+                context->Exit();
+        }
+
+        for (size_t k = i; k < size; ++k) {
+            if (done[k] || (k != i && !batch[k].context->IsSame(context)))
+                continue;
+
+            batch[k].task.Run(env);
+            done[k] = true;
+        }
+
+        if (env)
+            context->Exit();
+    }
+}
+
+bool CompletionQueue::Initialize(unsigned maxBatch, unsigned latency)
+{
+    if (s_initialized)
+        return true;
+
+    if (uv_mutex_init(&s_mutex))
+        return false;
+
+    s_maxBatch = Max(maxBatch, 1u);
+    s_latency = latency;
+    s_scheduled = false;
+
+    memset(&s_stats, 0, sizeof(s_stats));
+
+    s_initialized = true;
+
+    return true;
+}
+
+void CompletionQueue::Shutdown()
+{
+    if (!s_initialized)
+        return;
+
+    CompletionList pending;
+    {
+        uv_mutex_lock(&s_mutex);
+
+        pending.swap(s_pending);
+        s_scheduled = false;
+
+        uv_mutex_unlock(&s_mutex);
+    }
+
+    // let the tasks clean up themselves
+    for (CompletionList::const_iterator it = pending.begin(); it != pending.end(); ++it)
+        it->task.Run(NULL);
+
+    s_initialized = false;
+    uv_mutex_destroy(&s_mutex);
+}
+
+} // ncjs
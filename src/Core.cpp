@@ -17,8 +17,16 @@
 /// ----------------------------------------------------------------------------
 
 #include "ncjs/Core.h"
+#include "ncjs/Allocator.h"
+#include "ncjs/Archive.h"
+#include "ncjs/Codec.h"
+#include "ncjs/CompletionQueue.h"
+#include "ncjs/IoRing.h"
 #include "ncjs/Process.h"
+#include "ncjs/ThreadPool.h"
 #include "ncjs/ModuleManager.h"
+#include "ncjs/ModuleResolver.h"
+#include "ncjs/SourceCache.h"
 #include "ncjs/module.h"
 #include "ncjs/constants.h"
 
@@ -27,6 +35,8 @@
 
 #include <sstream>
 
+#include <stdlib.h>
+
 namespace ncjs {
 
 /// ----------------------------------------------------------------------------
@@ -56,6 +66,24 @@ uv_loop_t* s_loop = NULL;
 static CefRefPtr<CefCommandLine> s_argsNode;
 static CefRefPtr<CefCommandLine> s_argsExec;
 
+// command line switches, set them in RenderProcessHandler::OnNodeCefCreated()
+static const char* SWITCH_ALLOCATOR          = "ncjs-allocator";
+static const char* SWITCH_ASYNC_LOOPS        = "ncjs-async-loops";
+static const char* SWITCH_COMPLETION_BATCH   = "ncjs-completion-batch";
+static const char* SWITCH_COMPLETION_LATENCY = "ncjs-completion-latency";
+static const char* SWITCH_IO_URING           = "ncjs-io-uring";
+static const char* SWITCH_MMAP_THRESHOLD     = "ncjs-mmap-threshold";
+static const char* SWITCH_RESOLVER_CACHE     = "ncjs-resolver-cache";
+static const char* SWITCH_UV_THREADPOOL_SIZE = "ncjs-uv-threadpool-size";
+static const char* SWITCH_SIMD               = "ncjs-simd";
+static const char* SWITCH_SOURCE_CACHE       = "ncjs-source-cache";
+
+static const char* SWITCH_POOL_THREADS[ThreadPool::CLASS_COUNT] = {
+    "ncjs-fs-metadata-threads",
+    "ncjs-fs-data-threads",
+    "ncjs-fs-slow-threads"
+};
+
 static CefString s_extension(L"\'use strict\'\n\
 Object.defineProperty(this, \"ncjs\", {\n\
     get: function() {\n\
@@ -96,6 +124,53 @@ static inline bool Url2Path(const CefString& url, CefString& filePath)
     return true;
 }
 
+static inline unsigned GetSwitchUInt(const CefRefPtr<CefCommandLine>& cmd,
+                                     const char* name, unsigned def)
+{
+    if (!cmd->HasSwitch(name))
+        return def;
+
+    std::istringstream value(cmd->GetSwitchValue(name).ToString());
+    unsigned result;
+
+    return (value >> result) ? result : def;
+}
+
+static inline Allocator::Mode GetAllocatorMode(const CefRefPtr<CefCommandLine>& cmd)
+{
+    // unknown names select the slab allocator
+    if (!cmd->HasSwitch(SWITCH_ALLOCATOR))
+        return Allocator::SLAB;
+
+    return Allocator::FindMode(cmd->GetSwitchValue(SWITCH_ALLOCATOR).ToString().c_str());
+}
+
+static inline void SetCodecLevel(const CefRefPtr<CefCommandLine>& cmd)
+{
+    // unknown names select the best level supported by the CPU
+    Codec::Level level = Codec::LEVEL_COUNT;
+
+    if (cmd->HasSwitch(SWITCH_SIMD))
+        level = Codec::FindLevel(cmd->GetSwitchValue(SWITCH_SIMD).ToString().c_str());
+
+    Codec::SetLevel(level);
+}
+
+static inline void SetUvThreadpoolSize(const CefRefPtr<CefCommandLine>& cmd)
+{
+    // libuv reads it once when the first work is submitted,
+    // i.e. for uv_fs_poll_t handles only, fs requests use ThreadPool
+    if (!cmd->HasSwitch(SWITCH_UV_THREADPOOL_SIZE))
+        return;
+
+    const std::string size = cmd->GetSwitchValue(SWITCH_UV_THREADPOOL_SIZE).ToString();
+#ifdef _WIN32
+    _putenv_s("UV_THREADPOOL_SIZE", size.c_str());
+#else
+    setenv("UV_THREADPOOL_SIZE", size.c_str(), 1);
+#endif
+}
+
 static class ExtensionHandler : public CefV8Handler {
 public:
     virtual bool Execute(const CefString& name, CefRefPtr<CefV8Value> object,
@@ -165,6 +240,8 @@ Core::~Core()
     if (this == s_instance) {
         ModuleManager::Reset();
         Environment::Shutdown();
+        ThreadPool::Shutdown();
+        CompletionQueue::Shutdown();
 
         s_instance = NULL;
     }
@@ -190,9 +267,63 @@ bool Core::Initialize(const CefRefPtr<CefCommandLine>& cmd)
     if (!cmd.get())
         return false;
 
-    if (!Environment::Initialize())
+    // before any buffer is created, the threshold is given in KB
+    const unsigned mapThreshold = GetSwitchUInt(cmd, SWITCH_MMAP_THRESHOLD,
+                                                unsigned(Allocator::GetMapThreshold() / 1024));
+    Allocator::SetMapThreshold(size_t(mapThreshold) * 1024);
+
+    if (!Allocator::Initialize(GetAllocatorMode(cmd)))
+        return false;
+
+    if (!Archive::Initialize())
         return false;
 
+    // in KB as well, 0 disables the cache
+    const unsigned sourceCache = GetSwitchUInt(cmd, SWITCH_SOURCE_CACHE,
+                                               unsigned(SourceCache::GetCapacity() / 1024));
+
+    if (!SourceCache::Initialize(size_t(sourceCache) * 1024))
+        return false;
+
+    const unsigned resolverCache = GetSwitchUInt(cmd, SWITCH_RESOLVER_CACHE,
+                                                 ModuleResolver::GetCapacity());
+
+    if (!ModuleResolver::Initialize(resolverCache))
+        return false;
+
+    // entries of the io_uring of each loop, 0 disables rings
+    const unsigned ringEntries = GetSwitchUInt(cmd, SWITCH_IO_URING, IoRing::GetEntries());
+
+    if (!IoRing::Initialize(ringEntries))
+        return false;
+
+    const unsigned loops = GetSwitchUInt(cmd, SWITCH_ASYNC_LOOPS, 1);
+
+    if (!Environment::Initialize(loops))
+        return false;
+
+    const unsigned batch = GetSwitchUInt(cmd, SWITCH_COMPLETION_BATCH,
+                                         CompletionQueue::GetMaxBatchSize());
+    const unsigned latency = GetSwitchUInt(cmd, SWITCH_COMPLETION_LATENCY,
+                                           CompletionQueue::GetLatency());
+
+    if (!CompletionQueue::Initialize(batch, latency))
+        return false;
+
+    unsigned threads[ThreadPool::CLASS_COUNT];
+
+    for (int i = 0; i < ThreadPool::CLASS_COUNT; ++i) {
+        const ThreadPool::Class cls = ThreadPool::Class(i);
+        threads[i] = GetSwitchUInt(cmd, SWITCH_POOL_THREADS[i],
+                                   ThreadPool::GetDefaultThreads(cls));
+    }
+
+    if (!ThreadPool::Initialize(threads))
+        return false;
+
+    SetUvThreadpoolSize(cmd);
+    SetCodecLevel(cmd);
+
     // store command line arguments
     // TODO: add command line options support
     s_argsNode = cmd->Copy();
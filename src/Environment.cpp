@@ -22,6 +22,7 @@
 #include "ncjs/string.h"
 #include "ncjs/constants.h"
 #include "ncjs/EventLoop.h"
+#include "ncjs/UserData.h"
 
 #include <uv.h>
 
@@ -34,11 +35,19 @@ namespace ncjs {
 /// ----------------------------------------------------------------------------
 
 uv_loop_t* Environment::s_loopSync = NULL;
-EventLoop Environment::s_loopAsync;
+EventLoop* Environment::s_loopAsync = NULL;
+unsigned* Environment::s_loopLoad = NULL;
+unsigned Environment::s_loopCount = 0;
+unsigned Environment::s_loopNext = 0;
+
+static const unsigned MAX_ASYNC_LOOPS = 64;
 
 const double Environment::s_startTime = double(uv_now(uv_default_loop()));
 
 Environment::EnvMap Environment::s_map;
+Environment* Environment::s_last = NULL;
+
+static const NCJS_DEFINE_REFTEXT(s_keyEnvironment, "__ncjs_environment");
 
 
 static const NCJS_DEFINE_REFTEXT(s_scriptNew, "(function() {\n\
@@ -55,6 +64,27 @@ static const NCJS_DEFINE_REFTEXT(s_scriptThrow, "(function(str) {\n\
     throw new Error(str);\n\
 });");
 
+/// ----------------------------------------------------------------------------
+/// \class EnvironmentKey
+/// Stored on the global object of a context to find its environment without
+/// comparing the context with every registered one. Reset once the context
+/// is released, the global object may outlive it.
+/// ----------------------------------------------------------------------------
+class EnvironmentKey : public UserData<EnvironmentKey, USER_DATA::ENVIRONMENT> {
+public:
+
+    explicit EnvironmentKey(Environment* env) : m_env(env) {}
+
+    Environment* Get() const { return m_env; }
+    void Reset() { m_env = NULL; }
+
+private:
+
+    Environment* m_env;
+
+    IMPLEMENT_REFCOUNTING(EnvironmentKey);
+};
+
 /// ============================================================================
 /// implementation
 /// ============================================================================
@@ -100,6 +130,11 @@ void Environment::Setup(const CefString& execPath, const CefString& pagePath,
     binding->SetValue(consts::str_cache, m_object.binding_cache, V8_PROPERTY_ATTRIBUTE_NONE);
 }
 
+unsigned Environment::GetAsyncLoopIndex() const
+{
+    return unsigned(m_loopAsync - s_loopAsync);
+}
+
 /// ----------------------------------------------------------------------------
 /// constructor & destructor
 /// ----------------------------------------------------------------------------
@@ -110,7 +145,7 @@ Environment::BufferObjectInfo::BufferObjectInfo()
         m_fields[i] = 0;
 }
 
-Environment::Environment()
+Environment::Environment() : m_statValues(NULL), m_loopAsync(NULL)
 {
 }
 
@@ -448,20 +483,66 @@ static inline const char* GetErrorString(int errorno) {
     return "";
 }
 
-inline bool Environment::FindEnvironment(const CefRefPtr<CefV8Context>& context, EnvMap::iterator& it)
+Environment* Environment::FindEnvironment(const CefRefPtr<CefV8Context>& context)
+{
+    // the key can only be read from inside the context, others are never
+    // entered just for a lookup, they may be in the middle of a release
+    CefRefPtr<CefV8Context> current = CefV8Context::GetCurrentContext();
+
+    if (!(current.get() && current->IsSame(context)))
+        return ScanEnvironment(context);
+
+    Environment* env = NULL;
+    CefRefPtr<CefV8Value> key = context->GetGlobal()->GetValue(s_keyEnvironment);
+
+    if (key.get() && key->IsObject()) {
+        if (EnvironmentKey* data = EnvironmentKey::Unwrap(key))
+            env = data->Get();
+    }
+
+    // scripts may copy the key around, the owner has the final word
+    if (env && env->m_context->IsSame(context))
+        return env;
+
+    return ScanEnvironment(context);
+}
+
+Environment* Environment::ScanEnvironment(const CefRefPtr<CefV8Context>& context)
+{
+    for (EnvMap::iterator it = s_map.begin(); it != s_map.end(); ++it) {
+        if (it->second->m_context->IsSame(context))
+            return it->second;
+    }
+    return NULL;
+}
+
+EventLoop* Environment::AssignAsyncLoop()
 {
-    // really need a map?
-    for (it = s_map.begin(); it != s_map.end(); ++it) {
-        if (it->first->IsSame(context))
-            return true;
+    // least loaded loop, starting from the one next to the last assigned
+    // so that loops with the same load are picked round-robin
+    unsigned index = s_loopNext % s_loopCount;
+
+    for (unsigned i = 1; i < s_loopCount; ++i) {
+        const unsigned k = (s_loopNext + i) % s_loopCount;
+        if (s_loopLoad[k] < s_loopLoad[index])
+            index = k;
     }
-    return false;
+
+    s_loopLoad[index] += 1;
+    s_loopNext = index + 1;
+
+    return &s_loopAsync[index];
 }
 
 /// ----------------------------------------------------------------------------
 /// static functions
 /// ----------------------------------------------------------------------------
 
+unsigned Environment::GetAsyncLoopLoad(unsigned index)
+{
+    return index < s_loopCount ? s_loopLoad[index] : 0;
+}
+
 void Environment::ErrorException(int err, const char* syscall, const char* msg, CefString& except)
 {
     std::ostringstream format(GetErrorString(err));
@@ -501,8 +582,14 @@ void Environment::UvException(int err, const char* syscall, const char* msg,
 
 Environment* Environment::Get(const CefRefPtr<CefV8Context>& context)
 {
-    EnvMap::iterator it;
-    return FindEnvironment(context, it) ? it->second : NULL;
+    // consecutive calls mostly come from the same context
+    if (s_last && s_last->m_context->IsSame(context))
+        return s_last;
+
+    if (Environment* env = FindEnvironment(context))
+        return s_last = env;
+
+    return NULL;
 }
 
 Environment* Environment::Create(CefRefPtr<CefV8Context> context)
@@ -511,7 +598,17 @@ Environment* Environment::Create(CefRefPtr<CefV8Context> context)
     CefRefPtr<CefV8Value> global = context->GetGlobal();
 
     // register context and store environment object
-    s_map[context] = env;
+    s_map[context.get()] = env;
+
+    env->m_context = context;
+    env->m_key = new EnvironmentKey(env);
+
+    CefRefPtr<CefV8Value> key = CefV8Value::CreateObject(NULL);
+    env->m_key->Wrap(key);
+    global->SetValue(s_keyEnvironment, key, cef_v8_propertyattribute_t(
+        V8_PROPERTY_ATTRIBUTE_READONLY | V8_PROPERTY_ATTRIBUTE_DONTENUM | V8_PROPERTY_ATTRIBUTE_DONTDELETE));
+
+    env->m_loopAsync = AssignAsyncLoop();
 
     // comile functions
     CefRefPtr<CefV8Exception> except;
@@ -527,22 +624,27 @@ Environment* Environment::Create(CefRefPtr<CefV8Context> context)
 
 void Environment::InvalidateContext(const CefRefPtr<CefV8Context>& context)
 {
-    EnvMap::iterator itMap;
-
-    if (FindEnvironment(context, itMap)) {
+    // the context is being torn down, don't read its global
+    if (CefRefPtr<Environment> env = ScanEnvironment(context)) {
         ListenerList list;
-        list.swap(itMap->second->m_listener);
+        list.swap(env->m_listener);
 
         for (ListenerList::const_iterator it = list.begin(); it != list.end(); ++it)
             (*it)->OnContextReleased(context);
 
-        s_map.erase(itMap);
+        if (s_last == env)
+            s_last = NULL;
+
+        env->m_key->Reset();
+
+        s_loopLoad[env->GetAsyncLoopIndex()] -= 1;
+        s_map.erase(env->m_context.get());
     }
 }
 
-bool Environment::Initialize()
+bool Environment::Initialize(unsigned asyncLoops)
 {
-    if (s_loopAsync.IsRunning())
+    if (s_loopAsync && s_loopAsync[0].IsRunning())
         return true;
 
     // initialize synchronous uv event loop
@@ -550,15 +652,34 @@ bool Environment::Initialize()
 
     NCJS_CHECK(s_loopSync);
 
-    return s_loopAsync.Start();
+    // handle wraps keep references to their loops,
+    // so the pool is never released once created
+    if (s_loopAsync == NULL) {
+        s_loopCount = Max(Min(asyncLoops, MAX_ASYNC_LOOPS), 1u);
+        s_loopAsync = new EventLoop[s_loopCount];
+        s_loopLoad = new unsigned[s_loopCount];
+    }
+
+    for (unsigned i = 0; i < s_loopCount; ++i) {
+        s_loopLoad[i] = 0;
+
+        if (!s_loopAsync[i].Start())
+            return false;
+    }
+
+    s_loopNext = 0;
+
+    return true;
 }
 
 void Environment::Shutdown()
 {
-    if (!s_loopAsync.IsRunning())
+    if (!(s_loopAsync && s_loopAsync[0].IsRunning()))
         return;
 
-    s_loopAsync.Stop();
+    for (unsigned i = 0; i < s_loopCount; ++i)
+        s_loopAsync[i].Stop();
+
     s_loopSync = NULL;
 }
 
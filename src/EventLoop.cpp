@@ -26,6 +26,9 @@
 #include "ncjs/EventLoop.h"
 
 #include "ncjs/base.h"
+#include "ncjs/atomic.h"
+#include "ncjs/IoRing.h"
+#include "ncjs/MpscQueue.h"
 
 #include <include/base/cef_bind.h>
 #include <uv.h>
@@ -40,11 +43,16 @@ namespace ncjs {
 
 class EventLoopImpl : public uv_loop_t {
 
-    typedef std::vector<base::Closure> TaskQueue;
+    typedef MpscQueue<base::Closure> TaskQueue;
+    typedef std::vector<base::Closure> TaskList;
+
+    // tasks go to the overflow list only if the ring is full
+    enum { QUEUE_CAPACITY = 1 << 12 };
 
 public:
 
     bool Queue(const base::Closure& work);
+    bool QueueIo(const IoRequest& req);
 
     /// Constructors & Destructor
     /// --------------------------------------------------------------
@@ -62,15 +70,30 @@ private:
     static void AsyncStop(uv_async_t* async);
     static void AsyncQueue(uv_async_t* async);
 
+    static void PrepareIo(IoRing* ring, const IoRequest& req);
+
+    /// Utilities Functions
+    /// --------------------------------------------------------------
+
+    void Wakeup();
+    bool QueueOverflow(const base::Closure& work);
+    void RunOverflow();
+
     /// Declarations
     /// -----------------
 
-    uv_mutex_t m_mutex;
+    uv_mutex_t m_mutex; // guards m_overflow only
     uv_thread_t m_thread;
     uv_async_t m_asyncStop;
     uv_async_t m_asyncQueue;
 
     TaskQueue m_queue;
+    TaskList m_overflow;
+
+    IoRing* m_ring; // NULL if io_uring is not available
+
+    volatile atomic::Word m_overflowed;
+    volatile atomic::Word m_signaled;
 };
 
 /// ============================================================================
@@ -79,20 +102,67 @@ private:
 
 bool EventLoopImpl::Queue(const base::Closure& work)
 {
-    bool idling;
+    // once a task went to the overflow list, keep following tasks there
+    // as well so that tasks from the same producer never get reordered
+    if (atomic::Load(&m_overflowed) || !m_queue.Push(work))
+        QueueOverflow(work);
+
+    Wakeup();
+
+    return true;
+}
+
+inline void EventLoopImpl::Wakeup()
+{
+    // only the first producer after the work thread went idle pays for
+    // uv_async_send(), the rest are coalesced into the same wake up
+    if (atomic::Exchange(&m_signaled, 1) == 0)
+        uv_async_send(&m_asyncQueue);
+}
+
+bool EventLoopImpl::QueueOverflow(const base::Closure& work)
+{
+    uv_mutex_lock(&m_mutex);
+
+    m_overflow.push_back(work);
+    atomic::Store(&m_overflowed, 1);
+
+    uv_mutex_unlock(&m_mutex);
+
+    return true;
+}
+
+bool EventLoopImpl::QueueIo(const IoRequest& req)
+{
+    if (m_ring == NULL)
+        return false;
+
+    return Queue(base::Bind(&EventLoopImpl::PrepareIo, m_ring, req));
+}
+
+void EventLoopImpl::RunOverflow()
+{
+    if (!atomic::Load(&m_overflowed))
+        return;
+
+    // tasks reserved in the ring before the overflow must run first
+    if (!m_queue.IsIdle()) {
+        uv_async_send(&m_asyncQueue);
+        return;
+    }
+
+    TaskList list;
     {
         uv_mutex_lock(&m_mutex);
 
-        idling = m_queue.empty();
-        m_queue.push_back(work);
+        list.swap(m_overflow);
+        atomic::Store(&m_overflowed, 0);
 
         uv_mutex_unlock(&m_mutex);
     }
 
-    if (idling) // wake up work thread
-        uv_async_send(&m_asyncQueue);
-
-    return true;
+    for (TaskList::const_iterator it = list.begin(); it != list.end(); ++it)
+        it->Run();
 }
 
 bool EventLoop::Start()
@@ -124,13 +194,23 @@ bool EventLoop::Queue(const base::Closure& work)
     return m_impl->Queue(work);
 }
 
+bool EventLoop::QueueIo(const IoRequest& req)
+{
+    if (m_impl == NULL)
+        return false;
+
+    return m_impl->QueueIo(req);
+}
+
 /// ----------------------------------------------------------------------------
 /// constructor & destructor
 /// ----------------------------------------------------------------------------
 
-EventLoopImpl::EventLoopImpl()
+EventLoopImpl::EventLoopImpl() :
+    m_queue(QUEUE_CAPACITY), m_ring(NULL), m_overflowed(0), m_signaled(0)
 {
     NCJS_CHK_EQ(uv_loop_init(this), 0);
+    m_ring = IoRing::Create(this);
     NCJS_CHK_EQ(uv_mutex_init(&m_mutex), 0);
     NCJS_CHK_EQ(uv_async_init(this, &m_asyncStop, &AsyncStop), 0);
     NCJS_CHK_EQ(uv_async_init(this, &m_asyncQueue, &AsyncQueue), 0);
@@ -142,6 +222,9 @@ EventLoopImpl::~EventLoopImpl()
     uv_async_send(&m_asyncStop);
     uv_thread_join(&m_thread);
 
+    // waits for requests in the kernel, the ring is deleted by uv_run()
+    IoRing::Destroy(m_ring);
+
     uv_close(reinterpret_cast<uv_handle_t*>(&m_asyncStop), NULL);
     uv_close(reinterpret_cast<uv_handle_t*>(&m_asyncQueue), NULL);
 
@@ -184,18 +267,24 @@ void EventLoopImpl::AsyncQueue(uv_async_t* async)
 
     EventLoopImpl* impl = CONTAINER_OF(async, EventLoopImpl, m_asyncQueue);
 
-    TaskQueue queue;
+    // reset before draining, any task pushed from now on sends a new signal
+    atomic::Exchange(&impl->m_signaled, 0);
 
-    {
-        uv_mutex_lock(&impl->m_mutex);
+    base::Closure task;
 
-        queue.swap(impl->m_queue);
+    while (impl->m_queue.Pop(task))
+        task.Run();
 
-        uv_mutex_unlock(&impl->m_mutex);
-    }
+    impl->RunOverflow();
 
-    for (TaskQueue::const_iterator it = queue.begin(); it != queue.end(); ++it)
-        it->Run();
+    // everything the tasks prepared goes with one io_uring_enter()
+    if (impl->m_ring)
+        impl->m_ring->Submit();
+}
+
+void EventLoopImpl::PrepareIo(IoRing* ring, const IoRequest& req)
+{
+    ring->Prepare(req);
 }
 
 } // ncjs
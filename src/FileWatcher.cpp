@@ -0,0 +1,459 @@
+/***************************************************************
+ * Name:      FileWatcher.cpp
+ * Purpose:   Codes for Node-CEF File Watcher Class
+ * Author:    Joshua GPBeta (studiocghibli@gmail.com)
+ * Created:   2016-09-12
+ * Copyright: Studio GPBeta (www.gpbeta.com)
+ * License:
+ **************************************************************/
+
+/// ============================================================================
+/// declarations
+/// ============================================================================
+
+#define _WINSOCKAPI_    // stops windows.h including winsock.h
+
+/// ----------------------------------------------------------------------------
+/// Headers
+/// ----------------------------------------------------------------------------
+
+#include "ncjs/FileWatcher.h"
+
+#include "ncjs/base.h"
+
+#ifdef __linux__
+#include <sys/inotify.h>
+#include <errno.h>
+#include <limits.h>
+#include <unistd.h>
+#endif
+
+#include <string.h>
+
+namespace ncjs {
+
+/// ----------------------------------------------------------------------------
+/// variables
+/// ----------------------------------------------------------------------------
+
+#ifdef __linux__
+
+// what uv_fs_event_t asks for
+static const uint32_t WATCH_MASK = IN_ATTRIB | IN_CREATE | IN_MODIFY | IN_DELETE |
+                                   IN_DELETE_SELF | IN_MOVE_SELF | IN_MOVED_FROM |
+                                   IN_MOVED_TO;
+
+static uv_once_t s_once = UV_ONCE_INIT;
+static uv_mutex_t s_mutex;
+
+// guarded by s_mutex, the watchers are used on their loop threads only
+static std::map<uv_loop_t*, FileWatcher*> s_watchers;
+
+#endif // __linux__
+
+/// ============================================================================
+/// implementation
+/// ============================================================================
+
+#ifdef __linux__
+
+static void InitOnce()
+{
+    NCJS_CHK_EQ(uv_mutex_init(&s_mutex), 0);
+}
+
+static const char* BaseName(const std::string& path)
+{
+    const size_t pos = path.find_last_of('/');
+    return path.c_str() + (pos == std::string::npos ? 0 : pos + 1);
+}
+
+int FileWatcher::Add(uv_loop_t* loop, const std::string& path, bool recursive,
+                     Listener* listener)
+{
+    int err;
+    FileWatcher* watcher = Get(loop, true, err);
+
+    if (watcher == NULL)
+        return err;
+
+    err = watcher->AddListener(path, recursive, listener);
+
+    if (watcher->m_listeners.empty())
+        watcher->Close();
+
+    return err;
+}
+
+void FileWatcher::Remove(uv_loop_t* loop, Listener* listener)
+{
+    int err;
+    FileWatcher* watcher = Get(loop, false, err);
+
+    if (watcher == NULL)
+        return;
+
+    watcher->RemoveListener(listener);
+
+    if (watcher->m_listeners.empty())
+        watcher->Close();
+}
+
+int FileWatcher::AddListener(const std::string& path, bool recursive, Listener* listener)
+{
+    uv_fs_t req;
+    int err = uv_fs_stat(m_loop, &req, path.c_str(), NULL);
+    const bool isDir = err == 0 && (req.statbuf.st_mode & S_IFMT) == S_IFDIR;
+    uv_fs_req_cleanup(&req);
+
+    if (err)
+        return err;
+
+    Registration& reg = m_listeners[listener];
+    reg.path = path;
+    reg.recursive = recursive && isDir;
+    reg.isDir = isDir;
+
+    err = AddWatch(listener, reg, path, std::string());
+
+    if (err == 0 && reg.recursive)
+        err = AddTree(listener, reg, path, std::string(), false);
+
+    if (err)
+        RemoveListener(listener);
+
+    return err;
+}
+
+void FileWatcher::RemoveListener(Listener* listener)
+{
+    ListenerMap::iterator it = m_listeners.find(listener);
+
+    if (it == m_listeners.end())
+        return;
+
+    const Registration::WdMap wds = it->second.wds;
+
+    for (Registration::WdMap::const_iterator wd = wds.begin(); wd != wds.end(); ++wd)
+        Unsubscribe(wd->first, listener, NULL);
+
+    m_listeners.erase(it);
+}
+
+// a directory watched by several listeners takes one inotify watch, the
+// kernel returns the same descriptor for the same inode
+int FileWatcher::AddWatch(Listener* listener, Registration& reg,
+                          const std::string& path, const std::string& prefix)
+{
+    const int wd = inotify_add_watch(m_fd, path.c_str(), WATCH_MASK);
+
+    if (wd < 0)
+        return -errno;
+
+    // the latest path, directories can be moved within the tree
+    Watch& watch = m_watches[wd];
+    watch.path = path;
+
+    // already there through a bind mount or a race with a creation event
+    if (!reg.wds.insert(Registration::WdMap::value_type(wd, prefix)).second)
+        return 0;
+
+    reg.dirs[prefix] = wd;
+    watch.subs.push_back(Subscription(listener, prefix));
+
+    return 0;
+}
+
+// watches every directory below path, reporting what's found if the
+// directory has just appeared, its content may predate the watches
+int FileWatcher::AddTree(Listener* listener, Registration& reg,
+                         const std::string& path, const std::string& prefix, bool report)
+{
+    uv_fs_t req;
+
+    if (uv_fs_scandir(m_loop, &req, path.c_str(), 0, NULL) < 0) {
+        uv_fs_req_cleanup(&req);
+        return 0; // gone meanwhile or unreadable, nothing to watch
+    }
+
+    std::vector<std::string> dirs;
+
+    for (uv_dirent_t ent; uv_fs_scandir_next(&req, &ent) == 0; ) {
+        const std::string rel = prefix.empty() ? ent.name : prefix + '/' + ent.name;
+
+        if (report)
+            listener->OnWatchEvent(rel.c_str(), UV_RENAME);
+
+        int type = ent.type;
+
+        if (type == UV_DIRENT_UNKNOWN) {
+            uv_fs_t st;
+            if (uv_fs_lstat(m_loop, &st, (path + '/' + ent.name).c_str(), NULL) == 0 &&
+                (st.statbuf.st_mode & S_IFMT) == S_IFDIR)
+                type = UV_DIRENT_DIR;
+            uv_fs_req_cleanup(&st);
+        }
+
+        // links are not followed, as inotify doesn't
+        if (type == UV_DIRENT_DIR)
+            dirs.push_back(ent.name);
+    }
+
+    uv_fs_req_cleanup(&req);
+
+    for (size_t i = 0; i < dirs.size(); ++i) {
+        const std::string sub = path + '/' + dirs[i];
+        const std::string rel = prefix.empty() ? dirs[i] : prefix + '/' + dirs[i];
+
+        int err = AddWatch(listener, reg, sub, rel);
+
+        // out of inotify watches, the tree can't be watched as a whole
+        if (err == UV_ENOSPC || err == UV_ENOMEM)
+            return err;
+
+        if (err == 0 && (err = AddTree(listener, reg, sub, rel, report)))
+            return err;
+    }
+
+    return 0;
+}
+
+// drops a directory moved out of or removed from a recursive watch, the
+// directories below it are the prefixes starting with its own and a '/'
+void FileWatcher::RemoveTree(Listener* listener, Registration& reg, const std::string& prefix)
+{
+    const std::string below = prefix + '/';
+    std::vector<int> wds;
+
+    Registration::DirMap::const_iterator it = reg.dirs.find(prefix);
+
+    if (it != reg.dirs.end())
+        wds.push_back(it->second);
+
+    for (it = reg.dirs.lower_bound(below);
+         it != reg.dirs.end() && it->first.compare(0, below.size(), below) == 0; ++it)
+        wds.push_back(it->second);
+
+    for (size_t i = 0; i < wds.size(); ++i)
+        Unsubscribe(wds[i], listener, &prefix);
+}
+
+// prefix limits to the directory and those below it, NULL for any
+void FileWatcher::Unsubscribe(int wd, Listener* listener, const std::string* prefix)
+{
+    WatchMap::iterator it = m_watches.find(wd);
+
+    if (it == m_watches.end())
+        return;
+
+    std::vector<Subscription>& subs = it->second.subs;
+
+    for (size_t i = 0; i < subs.size(); ) {
+        const std::string& p = subs[i].prefix;
+
+        if (subs[i].listener != listener || (prefix &&
+            !(p == *prefix || (p.size() > prefix->size() && p[prefix->size()] == '/' &&
+                               p.compare(0, prefix->size(), *prefix) == 0)))) {
+            ++i;
+            continue;
+        }
+
+        subs.erase(subs.begin() + i);
+        m_listeners[listener].Drop(wd);
+    }
+
+    if (subs.empty()) {
+        inotify_rm_watch(m_fd, wd);
+        m_watches.erase(it);
+    }
+}
+
+void FileWatcher::Read()
+{
+    // large enough for a burst of events in one read()
+    union {
+        char data[64 * 1024];
+        struct inotify_event align;
+    } buf;
+
+    for (;;) {
+        const ssize_t size = read(m_fd, buf.data, sizeof(buf.data));
+
+        if (size < 0 && errno == EINTR)
+            continue;
+        if (size <= 0)
+            return;
+
+        for (ssize_t offset = 0; offset < size; ) {
+            const struct inotify_event* ev =
+                reinterpret_cast<const struct inotify_event*>(buf.data + offset);
+
+            Dispatch(ev->wd, ev->mask, ev->len ? ev->name : NULL);
+
+            offset += sizeof(struct inotify_event) + ev->len;
+        }
+    }
+}
+
+void FileWatcher::Dispatch(int wd, unsigned mask, const char* name)
+{
+    // every listener might have missed something
+    if (mask & IN_Q_OVERFLOW) {
+        for (ListenerMap::const_iterator it = m_listeners.begin(); it != m_listeners.end(); ++it)
+            it->first->OnWatchEvent(NULL, UV_RENAME);
+        return;
+    }
+
+    WatchMap::iterator it = m_watches.find(wd);
+
+    if (it == m_watches.end())
+        return; // removed with events queued
+
+    // the kernel dropped the watch, the directory is gone
+    if (mask & IN_IGNORED) {
+        for (size_t i = 0; i < it->second.subs.size(); ++i)
+            m_listeners[it->second.subs[i].listener].Drop(wd);
+
+        m_watches.erase(it);
+        return;
+    }
+
+    int events = 0;
+
+    if (mask & (IN_ATTRIB | IN_MODIFY))
+        events |= UV_CHANGE;
+    if (mask & ~(IN_ATTRIB | IN_MODIFY | IN_ISDIR))
+        events |= UV_RENAME;
+
+    if (events == 0)
+        return;
+
+    // the callbacks might touch the watch list
+    const Watch watch = it->second;
+    const bool isDir = (mask & IN_ISDIR) != 0;
+
+    for (size_t i = 0; i < watch.subs.size(); ++i) {
+        const Subscription& sub = watch.subs[i];
+        ListenerMap::iterator reg = m_listeners.find(sub.listener);
+
+        if (reg == m_listeners.end())
+            continue;
+
+        // the parent directory reports these for subdirectories already
+        if (name == NULL && !sub.prefix.empty())
+            continue;
+
+        const std::string rel = name == NULL ? BaseName(reg->second.path) :
+                                sub.prefix.empty() ? name : sub.prefix + '/' + name;
+
+        sub.listener->OnWatchEvent(rel.c_str(), events);
+
+        if (!(reg->second.recursive && isDir && name))
+            continue;
+
+        if (mask & (IN_MOVED_FROM | IN_DELETE))
+            RemoveTree(sub.listener, reg->second, rel);
+
+        if (mask & (IN_CREATE | IN_MOVED_TO)) {
+            const std::string path = watch.path + '/' + name;
+            int err = AddWatch(sub.listener, reg->second, path, rel);
+
+            if (err == 0)
+                err = AddTree(sub.listener, reg->second, path, rel, true);
+
+            if (err == UV_ENOSPC || err == UV_ENOMEM) {
+                RemoveListener(sub.listener);
+                sub.listener->OnWatchError(err);
+            }
+        }
+    }
+}
+
+void FileWatcher::Close()
+{
+    uv_mutex_lock(&s_mutex);
+    s_watchers.erase(m_loop);
+    uv_mutex_unlock(&s_mutex);
+
+    uv_poll_stop(&m_poll);
+    uv_close(reinterpret_cast<uv_handle_t*>(&m_poll), OnClose);
+}
+
+/// ----------------------------------------------------------------------------
+/// static functions
+/// ----------------------------------------------------------------------------
+
+FileWatcher* FileWatcher::Get(uv_loop_t* loop, bool create, int& err)
+{
+    uv_once(&s_once, InitOnce);
+
+    uv_mutex_lock(&s_mutex);
+    std::map<uv_loop_t*, FileWatcher*>::const_iterator it = s_watchers.find(loop);
+    FileWatcher* watcher = it == s_watchers.end() ? NULL : it->second;
+    uv_mutex_unlock(&s_mutex);
+
+    err = 0;
+
+    if (watcher || !create)
+        return watcher;
+
+    const int fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+
+    if (fd < 0) {
+        err = -errno;
+        return NULL;
+    }
+
+    watcher = new FileWatcher(loop, fd);
+
+    if ((err = uv_poll_init(loop, &watcher->m_poll, fd))) {
+        close(fd);
+        delete watcher;
+        return NULL;
+    }
+
+    watcher->m_poll.data = watcher;
+
+    if ((err = uv_poll_start(&watcher->m_poll, UV_READABLE, OnPoll))) {
+        uv_close(reinterpret_cast<uv_handle_t*>(&watcher->m_poll), OnClose);
+        return NULL;
+    }
+
+    uv_mutex_lock(&s_mutex);
+    s_watchers[loop] = watcher;
+    uv_mutex_unlock(&s_mutex);
+
+    return watcher;
+}
+
+void FileWatcher::OnPoll(uv_poll_t* handle, int status, int events)
+{
+    NCJS_ASSERT(handle);
+
+    if (status == 0)
+        static_cast<FileWatcher*>(handle->data)->Read();
+}
+
+void FileWatcher::OnClose(uv_handle_t* handle)
+{
+    NCJS_ASSERT(handle);
+
+    FileWatcher* watcher = static_cast<FileWatcher*>(handle->data);
+
+    close(watcher->m_fd);
+    delete watcher;
+}
+
+#else // __linux__
+
+int FileWatcher::Add(uv_loop_t* loop, const std::string& path, bool recursive,
+                     Listener* listener)
+{
+    return UV_ENOSYS;
+}
+
+void FileWatcher::Remove(uv_loop_t* loop, Listener* listener) {}
+
+#endif // __linux__
+
+} // ncjs
@@ -0,0 +1,678 @@
+/***************************************************************
+ * Name:      IoRing.cpp
+ * Purpose:   Codes for Node-CEF IO Ring Class
+ * Author:    Joshua GPBeta (studiocghibli@gmail.com)
+ * Created:   2016-09-02
+ * Copyright: Studio GPBeta (www.gpbeta.com)
+ * License:
+ **************************************************************/
+
+/// ============================================================================
+/// declarations
+/// ============================================================================
+
+#define _WINSOCKAPI_    // stops windows.h including winsock.h
+
+/// ----------------------------------------------------------------------------
+/// Headers
+/// ----------------------------------------------------------------------------
+
+#include "ncjs/IoRing.h"
+
+#include "ncjs/base.h"
+#include "ncjs/atomic.h"
+
+// IORING_OP_OPENAT, CLOSE, STATX and reads at the file position are
+// available since Linux 5.6
+#if defined(__linux__)
+#include <linux/version.h>
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(5, 6, 0)
+#define NCJS_IO_URING
+#endif
+#endif
+
+#ifdef NCJS_IO_URING
+#include <linux/io_uring.h>
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <sys/sysmacros.h>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <deque>
+#include <vector>
+#endif // NCJS_IO_URING
+
+namespace ncjs {
+
+/// ----------------------------------------------------------------------------
+/// variables
+/// ----------------------------------------------------------------------------
+
+static const unsigned DEFAULT_ENTRIES = 256;
+static const unsigned MAX_ENTRIES = 4096;
+
+// at most IOV_MAX buffers in one request
+static const unsigned MAX_BUFS = 1024;
+
+unsigned IoRing::s_entries = DEFAULT_ENTRIES;
+
+static bool s_enabled = true;
+
+static volatile atomic::Word s_rings = 0;
+static volatile atomic::Word s_requests = 0;
+static volatile atomic::Word s_completions = 0;
+static volatile atomic::Word s_enters = 0;
+
+/// ============================================================================
+/// implementation
+/// ============================================================================
+
+/// ----------------------------------------------------------------------------
+/// IoRequest
+/// ----------------------------------------------------------------------------
+
+IoRequest IoRequest::Open(const std::string& path, int flags, int mode)
+{
+    IoRequest req(OPEN);
+    req.path = path;
+    req.flags = flags;
+    req.mode = mode;
+    return req;
+}
+
+IoRequest IoRequest::Close(int fd)
+{
+    IoRequest req(CLOSE);
+    req.fd = fd;
+    return req;
+}
+
+IoRequest IoRequest::Read(int fd, const uv_buf_t* bufs, unsigned nbufs, int64_t offset)
+{
+    IoRequest req(READ);
+    req.fd = fd;
+    req.bufs = bufs;
+    req.nbufs = nbufs;
+    req.offset = offset;
+    return req;
+}
+
+IoRequest IoRequest::Write(int fd, const uv_buf_t* bufs, unsigned nbufs, int64_t offset)
+{
+    IoRequest req = Read(fd, bufs, nbufs, offset);
+    req.op = WRITE;
+    return req;
+}
+
+IoRequest IoRequest::Stat(const std::string& path)
+{
+    IoRequest req(STAT);
+    req.path = path;
+    return req;
+}
+
+IoRequest IoRequest::LStat(const std::string& path)
+{
+    IoRequest req(LSTAT);
+    req.path = path;
+    return req;
+}
+
+IoRequest IoRequest::FStat(int fd)
+{
+    IoRequest req(FSTAT);
+    req.fd = fd;
+    return req;
+}
+
+IoRequest IoRequest::FSync(int fd)
+{
+    IoRequest req(FSYNC);
+    req.fd = fd;
+    return req;
+}
+
+IoRequest IoRequest::FDataSync(int fd)
+{
+    IoRequest req(FDATASYNC);
+    req.fd = fd;
+    return req;
+}
+
+#ifdef NCJS_IO_URING
+
+/// ----------------------------------------------------------------------------
+/// IoRing::Impl
+/// ----------------------------------------------------------------------------
+
+static inline int Setup(unsigned entries, io_uring_params* params)
+{
+    const long rc = syscall(__NR_io_uring_setup, entries, params);
+    return rc < 0 ? -errno : int(rc);
+}
+
+static inline int Enter(int fd, unsigned submit, unsigned minComplete, unsigned flags)
+{
+    const long rc = syscall(__NR_io_uring_enter, fd, submit, minComplete, flags, NULL, 0);
+    return rc < 0 ? -errno : int(rc);
+}
+
+static inline int Register(int fd, unsigned opcode, void* arg, unsigned count)
+{
+    const long rc = syscall(__NR_io_uring_register, fd, opcode, arg, count);
+    return rc < 0 ? -errno : int(rc);
+}
+
+static inline unsigned LoadAcquire(const unsigned* ptr)
+{
+    return __atomic_load_n(ptr, __ATOMIC_ACQUIRE);
+}
+
+static inline void StoreRelease(unsigned* ptr, unsigned value)
+{
+    __atomic_store_n(ptr, value, __ATOMIC_RELEASE);
+}
+
+// same fields as uv_fs_stat() of the bundled libuv, which reports the
+// change time as the birth time on Linux
+static void ToUvStat(const struct statx& s, uv_stat_t& st)
+{
+    memset(&st, 0, sizeof(st));
+
+    st.st_dev = makedev(s.stx_dev_major, s.stx_dev_minor);
+    st.st_mode = s.stx_mode;
+    st.st_nlink = s.stx_nlink;
+    st.st_uid = s.stx_uid;
+    st.st_gid = s.stx_gid;
+    st.st_rdev = makedev(s.stx_rdev_major, s.stx_rdev_minor);
+    st.st_ino = s.stx_ino;
+    st.st_size = s.stx_size;
+    st.st_blksize = s.stx_blksize;
+    st.st_blocks = s.stx_blocks;
+    st.st_atim.tv_sec = s.stx_atime.tv_sec;
+    st.st_atim.tv_nsec = s.stx_atime.tv_nsec;
+    st.st_mtim.tv_sec = s.stx_mtime.tv_sec;
+    st.st_mtim.tv_nsec = s.stx_mtime.tv_nsec;
+    st.st_ctim.tv_sec = s.stx_ctime.tv_sec;
+    st.st_ctim.tv_nsec = s.stx_ctime.tv_nsec;
+    st.st_birthtim = st.st_ctim;
+}
+
+struct IoRing::Impl {
+
+    struct Slot {
+        IoRequest req;
+        struct statx stat;
+    };
+
+    bool Open(unsigned entries);
+    void Close();
+
+    // false if the request has to wait for a free slot or room in the queue
+    bool Queue(const IoRequest& req);
+    void Flush();
+    void Fail(int result);
+    void Reap(bool run);
+    void Drain();
+
+    static void OnEvent(uv_poll_t* handle, int status, int events);
+    static void OnClose(uv_handle_t* handle);
+
+    Impl() : ring(NULL), fd(-1), event(-1), sqMap(MAP_FAILED), sqes(NULL),
+             prepared(0), inflight(0) {}
+
+    /// Declarations
+    /// -----------------
+
+    uv_poll_t poll;
+    IoRing* ring;
+
+    int fd;     // of the ring
+    int event;  // eventfd signaled by completions which didn't finish inline
+
+    void* sqMap;    // both queues, IORING_FEAT_SINGLE_MMAP
+    size_t sqMapSize;
+    io_uring_sqe* sqes;
+
+    unsigned* sqHead;
+    unsigned* sqTail;
+    unsigned* sqArray;
+    unsigned sqMask;
+    unsigned sqEntries;
+
+    unsigned* cqHead;
+    unsigned* cqTail;
+    io_uring_cqe* cqes;
+    unsigned cqMask;
+    unsigned cqEntries;
+
+    // one slot per request in the kernel, no more than the completion
+    // queue can hold so that completions are never dropped
+    std::vector<Slot> slots;
+    std::vector<unsigned> freeSlots;
+    std::deque<IoRequest> waiting;
+
+    unsigned prepared;  // in the submission queue, not submitted yet
+    unsigned inflight;  // slots in use
+};
+
+bool IoRing::Impl::Open(unsigned entries)
+{
+    io_uring_params params;
+    memset(&params, 0, sizeof(params));
+
+    fd = Setup(entries, &params);
+
+    if (fd < 0)
+        return false;
+
+    const unsigned required = IORING_FEAT_SINGLE_MMAP | IORING_FEAT_RW_CUR_POS;
+
+    if ((params.features & required) != required)
+        return false;
+
+    sqMapSize = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+
+    const size_t cqSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+    if (sqMapSize < cqSize)
+        sqMapSize = cqSize;
+
+    sqMap = mmap(NULL, sqMapSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                 fd, IORING_OFF_SQ_RING);
+
+    if (sqMap == MAP_FAILED)
+        return false;
+
+    void* map = mmap(NULL, params.sq_entries * sizeof(io_uring_sqe), PROT_READ | PROT_WRITE,
+                     MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQES);
+
+    if (map == MAP_FAILED)
+        return false;
+
+    char* base = static_cast<char*>(sqMap);
+
+    sqes = static_cast<io_uring_sqe*>(map);
+    sqHead = reinterpret_cast<unsigned*>(base + params.sq_off.head);
+    sqTail = reinterpret_cast<unsigned*>(base + params.sq_off.tail);
+    sqArray = reinterpret_cast<unsigned*>(base + params.sq_off.array);
+    sqMask = *reinterpret_cast<unsigned*>(base + params.sq_off.ring_mask);
+    sqEntries = params.sq_entries;
+
+    cqHead = reinterpret_cast<unsigned*>(base + params.cq_off.head);
+    cqTail = reinterpret_cast<unsigned*>(base + params.cq_off.tail);
+    cqes = reinterpret_cast<io_uring_cqe*>(base + params.cq_off.cqes);
+    cqMask = *reinterpret_cast<unsigned*>(base + params.cq_off.ring_mask);
+    cqEntries = params.cq_entries;
+
+    // every operation must be there, or no request goes to the ring at all
+    static const unsigned char ops[] = {
+        IORING_OP_OPENAT, IORING_OP_CLOSE, IORING_OP_READV,
+        IORING_OP_WRITEV, IORING_OP_STATX, IORING_OP_FSYNC
+    };
+
+    std::vector<char> probeData(sizeof(io_uring_probe) + 256 * sizeof(io_uring_probe_op));
+    io_uring_probe* probe = reinterpret_cast<io_uring_probe*>(&probeData[0]);
+
+    if (Register(fd, IORING_REGISTER_PROBE, probe, 256) < 0)
+        return false;
+
+    for (size_t i = 0; i < sizeof(ops); ++i) {
+        if (ops[i] > probe->last_op || !(probe->ops[ops[i]].flags & IO_URING_OP_SUPPORTED))
+            return false;
+    }
+
+    event = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+
+    if (event < 0)
+        return false;
+
+    // completions reaped right after io_uring_enter() need no wake up
+    if (Register(fd, IORING_REGISTER_EVENTFD_ASYNC, &event, 1) < 0 &&
+        Register(fd, IORING_REGISTER_EVENTFD, &event, 1) < 0)
+        return false;
+
+    slots.resize(cqEntries);
+    freeSlots.reserve(cqEntries);
+
+    for (unsigned i = cqEntries; i > 0; --i)
+        freeSlots.push_back(i - 1);
+
+    return true;
+}
+
+void IoRing::Impl::Close()
+{
+    if (sqes)
+        munmap(sqes, sqEntries * sizeof(io_uring_sqe));
+    if (sqMap != MAP_FAILED)
+        munmap(sqMap, sqMapSize);
+    if (event >= 0)
+        close(event);
+    if (fd >= 0)
+        close(fd);
+}
+
+bool IoRing::Impl::Queue(const IoRequest& req)
+{
+    if (freeSlots.empty() || prepared == sqEntries)
+        return false;
+
+    const unsigned index = freeSlots.back();
+    freeSlots.pop_back();
+
+    Slot& slot = slots[index];
+    slot.req = req;
+
+    const unsigned tail = *sqTail;
+    const unsigned pos = tail & sqMask;
+
+    io_uring_sqe* sqe = &sqes[pos];
+    memset(sqe, 0, sizeof(*sqe));
+
+    switch (req.op) {
+    case IoRequest::OPEN:
+        sqe->opcode = IORING_OP_OPENAT;
+        sqe->fd = AT_FDCWD;
+        sqe->addr = reinterpret_cast<uintptr_t>(slot.req.path.c_str());
+        sqe->len = unsigned(req.mode);
+        sqe->open_flags = unsigned(req.flags | O_CLOEXEC);
+        break;
+    case IoRequest::CLOSE:
+        sqe->opcode = IORING_OP_CLOSE;
+        sqe->fd = req.fd;
+        break;
+    case IoRequest::READ:
+    case IoRequest::WRITE:
+        // uv_buf_t is laid out as struct iovec on Unix
+        sqe->opcode = req.op == IoRequest::READ ? IORING_OP_READV : IORING_OP_WRITEV;
+        sqe->fd = req.fd;
+        sqe->addr = reinterpret_cast<uintptr_t>(req.bufs);
+        sqe->len = req.nbufs;
+        sqe->off = uint64_t(req.offset);
+        break;
+    case IoRequest::STAT:
+    case IoRequest::LSTAT:
+    case IoRequest::FSTAT:
+        sqe->opcode = IORING_OP_STATX;
+        sqe->fd = req.op == IoRequest::FSTAT ? req.fd : AT_FDCWD;
+        sqe->addr = reinterpret_cast<uintptr_t>(req.op == IoRequest::FSTAT ?
+                                                "" : slot.req.path.c_str());
+        sqe->len = STATX_BASIC_STATS;
+        sqe->off = reinterpret_cast<uintptr_t>(&slot.stat);
+        sqe->statx_flags = req.op == IoRequest::STAT ? 0 :
+                           req.op == IoRequest::LSTAT ? AT_SYMLINK_NOFOLLOW : AT_EMPTY_PATH;
+        break;
+    case IoRequest::FSYNC:
+    case IoRequest::FDATASYNC:
+        sqe->opcode = IORING_OP_FSYNC;
+        sqe->fd = req.fd;
+        sqe->fsync_flags = req.op == IoRequest::FDATASYNC ? IORING_FSYNC_DATASYNC : 0;
+        break;
+    }
+
+    sqe->user_data = index;
+    sqArray[pos] = pos;
+
+    StoreRelease(sqTail, tail + 1);
+
+    ++prepared;
+    ++inflight;
+
+    return true;
+}
+
+void IoRing::Impl::Flush()
+{
+    while (prepared) {
+        const int rc = Enter(fd, prepared, 0, 0);
+
+        if (rc >= 0) {
+            prepared -= unsigned(rc);
+            atomic::Increment(&s_enters);
+        } else if ((rc == -EAGAIN || rc == -EBUSY) && inflight > prepared) {
+            // out of kernel resources, wait for something submitted to complete
+            Enter(fd, 0, 1, IORING_ENTER_GETEVENTS);
+        } else if (rc != -EINTR) {
+            // nothing would ever complete to make room, or the kernel refuses
+            // the requests, fail them rather than waiting or aborting
+            Fail(rc);
+            return;
+        }
+
+        // requests served from the page cache are usually done already,
+        // and their slots take the waiting requests
+        Reap(true);
+    }
+}
+
+// completes the requests not submitted yet and the waiting ones with result
+void IoRing::Impl::Fail(int result)
+{
+    std::vector<IoRequest::Callback> callbacks;
+    callbacks.reserve(prepared + waiting.size());
+
+    // none of them was consumed by the kernel, take them back
+    const unsigned tail = *sqTail;
+
+    for (unsigned i = tail - prepared; i != tail; ++i) {
+        const unsigned index = unsigned(sqes[sqArray[i & sqMask]].user_data);
+
+        callbacks.push_back(slots[index].req.callback);
+        slots[index].req = IoRequest();
+        freeSlots.push_back(index);
+    }
+
+    StoreRelease(sqTail, tail - prepared);
+
+    inflight -= prepared;
+    prepared = 0;
+
+    for (; !waiting.empty(); waiting.pop_front())
+        callbacks.push_back(waiting.front().callback);
+
+    for (size_t i = 0; i < callbacks.size(); ++i)
+        callbacks[i].Run(result);
+}
+
+void IoRing::Impl::Reap(bool run)
+{
+    unsigned head = *cqHead;
+
+    for (unsigned tail = LoadAcquire(cqTail); head != tail; tail = LoadAcquire(cqTail)) {
+        while (head != tail) {
+            const io_uring_cqe& cqe = cqes[head & cqMask];
+            const unsigned index = unsigned(cqe.user_data);
+            const int result = cqe.res;
+
+            StoreRelease(cqHead, ++head);
+
+            Slot& slot = slots[index];
+
+            if (result >= 0 && slot.req.stat)
+                ToUvStat(slot.stat, *slot.req.stat);
+
+            const IoRequest::Callback callback = slot.req.callback;
+            slot.req = IoRequest();
+
+            freeSlots.push_back(index);
+            --inflight;
+
+            atomic::Increment(&s_completions);
+
+            if (run) {
+                // negative errno values are libuv error codes on Unix
+                callback.Run(result);
+
+                while (!waiting.empty() && Queue(waiting.front()))
+                    waiting.pop_front();
+            }
+        }
+    }
+}
+
+// requests in the kernel may still write to their buffers, wait for them
+void IoRing::Impl::Drain()
+{
+    inflight -= prepared;
+    prepared = 0;
+
+    // not submitted, never completed
+    for (unsigned i = 0; i < slots.size(); ++i)
+        slots[i].req = IoRequest();
+
+    waiting.clear();
+
+    while (inflight) {
+        const int rc = Enter(fd, 0, 1, IORING_ENTER_GETEVENTS);
+
+        if (rc < 0 && rc != -EINTR)
+            break;
+
+        Reap(false);
+    }
+}
+
+void IoRing::Impl::OnEvent(uv_poll_t* handle, int status, int events)
+{
+    NCJS_ASSERT(handle);
+
+    Impl* impl = static_cast<Impl*>(handle->data);
+
+    uint64_t count;
+    while (read(impl->event, &count, sizeof(count)) < 0 && errno == EINTR) {}
+
+    impl->Reap(true);
+    impl->Flush();
+}
+
+void IoRing::Impl::OnClose(uv_handle_t* handle)
+{
+    NCJS_ASSERT(handle);
+
+    delete static_cast<Impl*>(handle->data)->ring;
+}
+
+/// ----------------------------------------------------------------------------
+/// IoRing
+/// ----------------------------------------------------------------------------
+
+void IoRing::Prepare(const IoRequest& req)
+{
+    atomic::Increment(&s_requests);
+
+    // keep the order of requests behind waiting ones
+    if (!m_impl->waiting.empty() || !m_impl->Queue(req))
+        m_impl->waiting.push_back(req);
+}
+
+void IoRing::Submit()
+{
+    m_impl->Flush();
+}
+
+IoRing* IoRing::Create(uv_loop_t* loop)
+{
+    if (s_entries == 0)
+        return NULL;
+
+    IoRing* ring = new IoRing;
+    Impl* impl = ring->m_impl;
+
+    impl->ring = ring;
+    impl->poll.data = impl;
+
+    if (!impl->Open(s_entries) ||
+        uv_poll_init(loop, &impl->poll, impl->event) != 0) {
+        delete ring;
+        return NULL;
+    }
+
+    NCJS_CHK_EQ(uv_poll_start(&impl->poll, UV_READABLE, &Impl::OnEvent), 0);
+
+    atomic::Increment(&s_rings);
+
+    return ring;
+}
+
+void IoRing::Destroy(IoRing* ring)
+{
+    if (ring == NULL)
+        return;
+
+    ring->m_impl->Drain();
+
+    atomic::Decrement(&s_rings);
+
+    uv_close(reinterpret_cast<uv_handle_t*>(&ring->m_impl->poll), &Impl::OnClose);
+}
+
+bool IoRing::IsSupported(const IoRequest& req)
+{
+    return req.nbufs <= MAX_BUFS;
+}
+
+IoRing::IoRing() : m_impl(new Impl) {}
+
+IoRing::~IoRing()
+{
+    m_impl->Close();
+    delete m_impl;
+}
+
+#else // NCJS_IO_URING
+
+struct IoRing::Impl {};
+
+void IoRing::Prepare(const IoRequest& req) { NCJS_UNREACHABLE(); }
+void IoRing::Submit() {}
+
+IoRing* IoRing::Create(uv_loop_t* loop) { return NULL; }
+void IoRing::Destroy(IoRing* ring) {}
+
+bool IoRing::IsSupported(const IoRequest& req) { return false; }
+
+IoRing::IoRing() : m_impl(NULL) {}
+IoRing::~IoRing() {}
+
+#endif // NCJS_IO_URING
+
+/// ----------------------------------------------------------------------------
+/// static functions
+/// ----------------------------------------------------------------------------
+
+bool IoRing::IsEnabled()
+{
+    return s_enabled && atomic::Load(&s_rings) > 0;
+}
+
+bool IoRing::SetEnabled(bool enabled)
+{
+    s_enabled = enabled;
+
+    return IsEnabled();
+}
+
+void IoRing::GetStats(Stats& stats)
+{
+    stats.requests = double(atomic::Load(&s_requests));
+    stats.completions = double(atomic::Load(&s_completions));
+    stats.enters = double(atomic::Load(&s_enters));
+    stats.rings = unsigned(atomic::Load(&s_rings));
+    stats.entries = s_entries;
+    stats.enabled = IsEnabled();
+}
+
+bool IoRing::Initialize(unsigned entries)
+{
+    s_entries = entries < MAX_ENTRIES ? entries : MAX_ENTRIES;
+
+    return true;
+}
+
+} // ncjs
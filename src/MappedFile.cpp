@@ -0,0 +1,363 @@
+/***************************************************************
+ * Name:      MappedFile.cpp
+ * Purpose:   Codes for Node-CEF Mapped File Class
+ * Author:    Joshua GPBeta (studiocghibli@gmail.com)
+ * Created:   2016-09-06
+ * Copyright: Studio GPBeta (www.gpbeta.com)
+ * License:
+ **************************************************************/
+
+/// ============================================================================
+/// declarations
+/// ============================================================================
+
+#define _WINSOCKAPI_    // stops windows.h including winsock.h
+
+/// ----------------------------------------------------------------------------
+/// Headers
+/// ----------------------------------------------------------------------------
+
+#include "ncjs/MappedFile.h"
+
+#include "ncjs/base.h"
+
+#ifdef _WIN32
+#include <io.h>
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <errno.h>
+#include <unistd.h>
+#endif
+
+#include <limits>
+#include <string.h>
+
+namespace ncjs {
+
+/// ----------------------------------------------------------------------------
+/// variables
+/// ----------------------------------------------------------------------------
+
+static const char* ADVICE_NAMES[MappedFile::ADVICE_COUNT] = {
+    "normal", "random", "sequential", "willneed", "dontneed"
+};
+
+/// ============================================================================
+/// implementation
+/// ============================================================================
+
+// mapping offsets must be multiples of it
+static size_t Granularity()
+{
+#ifdef _WIN32
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return info.dwAllocationGranularity;
+#else
+    return size_t(sysconf(_SC_PAGESIZE));
+#endif
+}
+
+#ifdef _WIN32
+// placeholders of Windows 10 1803 and later let a view be swapped for
+// private pages without the address being free in between
+
+#ifndef MEM_RESERVE_PLACEHOLDER
+#define MEM_RESERVE_PLACEHOLDER  0x00040000
+#define MEM_REPLACE_PLACEHOLDER  0x00004000
+#define MEM_PRESERVE_PLACEHOLDER 0x00000002
+#endif
+
+typedef PVOID (WINAPI* VirtualAlloc2Fn)(HANDLE, PVOID, SIZE_T, ULONG, ULONG, PVOID, ULONG);
+typedef PVOID (WINAPI* MapViewOfFile3Fn)(HANDLE, HANDLE, PVOID, ULONG64, SIZE_T, ULONG, ULONG,
+                                         PVOID, ULONG);
+typedef BOOL (WINAPI* UnmapViewOfFile2Fn)(HANDLE, PVOID, ULONG);
+
+struct Placeholders {
+    VirtualAlloc2Fn virtualAlloc2;
+    MapViewOfFile3Fn mapViewOfFile3;
+    UnmapViewOfFile2Fn unmapViewOfFile2;
+
+    bool IsSupported() const { return virtualAlloc2 && mapViewOfFile3 && unmapViewOfFile2; }
+
+    Placeholders()
+    {
+        HMODULE module = GetModuleHandleW(L"kernelbase.dll");
+        virtualAlloc2 = module ? reinterpret_cast<VirtualAlloc2Fn>(
+            GetProcAddress(module, "VirtualAlloc2")) : NULL;
+        mapViewOfFile3 = module ? reinterpret_cast<MapViewOfFile3Fn>(
+            GetProcAddress(module, "MapViewOfFile3")) : NULL;
+        unmapViewOfFile2 = module ? reinterpret_cast<UnmapViewOfFile2Fn>(
+            GetProcAddress(module, "UnmapViewOfFile2")) : NULL;
+    }
+};
+
+static const Placeholders& GetPlaceholders()
+{
+    static const Placeholders placeholders;
+    return placeholders;
+}
+#endif // _WIN32
+
+static size_t PageSize()
+{
+#ifdef _WIN32
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return info.dwPageSize;
+#else
+    return size_t(sysconf(_SC_PAGESIZE));
+#endif
+}
+
+int MappedFile::Sync(size_t offset, size_t length, bool async)
+{
+    if (!m_mapped)
+        return 0;
+
+    if (offset > m_size)
+        offset = m_size;
+    if (length > m_size - offset)
+        length = m_size - offset;
+
+    const size_t page = PageSize();
+    const size_t start = (m_data - m_base + offset) / page * page;
+    const size_t bytes = m_data - m_base + offset + length - start;
+
+#ifdef _WIN32
+    // Windows writes dirty pages back lazily in any case
+    return FlushViewOfFile(m_base + start, bytes) ? 0 : UV_EIO;
+#else
+    return msync(m_base + start, bytes, async ? MS_ASYNC : MS_SYNC) ? -errno : 0;
+#endif
+}
+
+int MappedFile::Advise(size_t offset, size_t length, Advice advice)
+{
+    if (!m_mapped)
+        return 0;
+
+    if (offset > m_size)
+        offset = m_size;
+    if (length > m_size - offset)
+        length = m_size - offset;
+
+    const size_t page = PageSize();
+    const size_t start = (m_data - m_base + offset) / page * page;
+    const size_t bytes = m_data - m_base + offset + length - start;
+
+#ifdef _WIN32
+    // only a hint, nothing to tell the system here
+    return 0;
+#else
+    static const int ADVICES[ADVICE_COUNT] = {
+        MADV_NORMAL, MADV_RANDOM, MADV_SEQUENTIAL, MADV_WILLNEED, MADV_DONTNEED
+    };
+
+    NCJS_CHECK(advice < ADVICE_COUNT);
+
+    return madvise(m_base + start, bytes, ADVICES[advice]) ? -errno : 0;
+#endif
+}
+
+int MappedFile::Unmap()
+{
+    if (!m_mapped)
+        return 0;
+
+    // Buffers may still point here, replace the pages instead of leaving
+    // a hole behind
+#ifdef _WIN32
+    const Placeholders& placeholders = GetPlaceholders();
+
+    if (placeholders.IsSupported()) {
+        if (!placeholders.unmapViewOfFile2(GetCurrentProcess(), m_base,
+                                           MEM_PRESERVE_PLACEHOLDER))
+            return UV_EINVAL;
+
+        m_mapped = false;
+
+        if (!placeholders.virtualAlloc2(NULL, m_base, m_length,
+                                        MEM_RESERVE | MEM_COMMIT | MEM_REPLACE_PLACEHOLDER,
+                                        PAGE_READWRITE, NULL, 0)) {
+            // out of commit charge, the address is still reserved by the
+            // placeholder but the Buffers fault until they are gone
+            return UV_ENOMEM;
+        }
+
+        return 0;
+    }
+
+    if (!UnmapViewOfFile(m_base))
+        return UV_EINVAL;
+
+    m_mapped = false;
+
+    // another thread may have taken the address meanwhile, which is then
+    // not ours to release, the Buffers must not be used any more
+    if (!VirtualAlloc(m_base, m_length, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE)) {
+        m_reserved = false;
+        return UV_EBUSY;
+    }
+
+    return 0;
+#else
+    void* memory = mmap(m_base, m_length, PROT_READ | PROT_WRITE,
+                        MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED, -1, 0);
+    if (memory == MAP_FAILED)
+        return -errno;
+#endif
+
+    m_mapped = false;
+
+    return 0;
+}
+
+MappedFile::~MappedFile()
+{
+#ifdef _WIN32
+    if (m_mapped)
+        UnmapViewOfFile(m_base);
+    else if (m_reserved)
+        VirtualFree(m_base, 0, MEM_RELEASE);
+#else
+    munmap(m_base, m_length);
+#endif
+}
+
+/// ----------------------------------------------------------------------------
+/// static functions
+/// ----------------------------------------------------------------------------
+
+CefRefPtr<MappedFile> MappedFile::Map(uv_file fd, int64_t offset, size_t length,
+                                      size_t maxLength, bool writable, int& err)
+{
+    int64_t fileSize;
+
+#ifdef _WIN32
+    HANDLE file = reinterpret_cast<HANDLE>(_get_osfhandle(fd));
+    LARGE_INTEGER size;
+
+    if (file == INVALID_HANDLE_VALUE || !GetFileSizeEx(file, &size)) {
+        err = UV_EBADF;
+        return NULL;
+    }
+
+    fileSize = size.QuadPart;
+#else
+    struct stat st;
+
+    if (fstat(fd, &st) < 0) {
+        err = -errno;
+        return NULL;
+    }
+    if (!S_ISREG(st.st_mode)) {
+        err = UV_EINVAL;
+        return NULL;
+    }
+
+    fileSize = st.st_size;
+#endif
+
+    if (offset < 0 || offset > fileSize) {
+        err = UV_EINVAL;
+        return NULL;
+    }
+
+    const int64_t granularity = int64_t(Granularity());
+
+    // the rest of the file may not fit a size_t of a 32-bit build, checked
+    // before the cast truncates it
+    if (length == 0) {
+        const uint64_t rest = uint64_t(fileSize - offset);
+
+        if (rest > uint64_t(maxLength) ||
+            rest > uint64_t(std::numeric_limits<size_t>::max() - granularity)) {
+            err = UV_EFBIG;
+            return NULL;
+        }
+
+        length = size_t(rest);
+    }
+
+    // past the end of the file pages fault with SIGBUS
+    if (length == 0 || length > maxLength ||
+        uint64_t(length) > uint64_t(fileSize - offset)) {
+        err = UV_EINVAL;
+        return NULL;
+    }
+
+    const int64_t aligned = offset / granularity * granularity;
+    const size_t delta = size_t(offset - aligned);
+
+#ifdef _WIN32
+    HANDLE mapping = CreateFileMappingW(file, NULL, writable ? PAGE_READWRITE : PAGE_WRITECOPY,
+                                        0, 0, NULL);
+    if (mapping == NULL) {
+        err = GetLastError() == ERROR_ACCESS_DENIED ? UV_EACCES : UV_EIO;
+        return NULL;
+    }
+
+    const Placeholders& placeholders = GetPlaceholders();
+    void* data = NULL;
+    DWORD error;
+
+    // the view keeps the mapping alive
+    if (placeholders.IsSupported()) {
+        void* placeholder = placeholders.virtualAlloc2(NULL, NULL, length + delta,
+                                                       MEM_RESERVE | MEM_RESERVE_PLACEHOLDER,
+                                                       PAGE_NOACCESS, NULL, 0);
+        if (placeholder) {
+            data = placeholders.mapViewOfFile3(mapping, GetCurrentProcess(), placeholder,
+                                               uint64_t(aligned),
+                                               length + delta, MEM_REPLACE_PLACEHOLDER,
+                                               writable ? PAGE_READWRITE : PAGE_WRITECOPY,
+                                               NULL, 0);
+            if (data == NULL) {
+                error = GetLastError();
+                VirtualFree(placeholder, 0, MEM_RELEASE);
+            }
+        } else {
+            error = GetLastError();
+        }
+    } else {
+        data = MapViewOfFile(mapping, writable ? FILE_MAP_WRITE : FILE_MAP_COPY,
+                             DWORD(uint64_t(aligned) >> 32), DWORD(aligned),
+                             length + delta);
+        error = GetLastError();
+    }
+
+    CloseHandle(mapping);
+
+    if (data == NULL) {
+        err = error == ERROR_NOT_ENOUGH_MEMORY ? UV_ENOMEM : UV_EIO;
+        return NULL;
+    }
+#else
+    void* data = mmap(NULL, length + delta, PROT_READ | PROT_WRITE,
+                      writable ? MAP_SHARED : MAP_PRIVATE, fd, off_t(aligned));
+
+    if (data == MAP_FAILED) {
+        err = -errno;
+        return NULL;
+    }
+#endif
+
+    err = 0;
+
+    return new MappedFile(static_cast<char*>(data), length + delta, delta, writable);
+}
+
+MappedFile::Advice MappedFile::FindAdvice(const char* name)
+{
+    for (int i = 0; i < ADVICE_COUNT; ++i) {
+        if (!strcmp(ADVICE_NAMES[i], name))
+            return Advice(i);
+    }
+
+    return ADVICE_COUNT;
+}
+
+} // ncjs
@@ -0,0 +1,864 @@
+
+/***************************************************************
+ * Name:      ModuleResolver.cpp
+ * Purpose:   Codes for Node-CEF Module Resolver Class
+ * Author:    Joshua GPBeta (studiocghibli@gmail.com)
+ * Created:   2016-08-11
+ * Copyright: Studio GPBeta (www.gpbeta.com)
+ * License:
+ **************************************************************/
+
+/// ============================================================================
+/// declarations
+/// ============================================================================
+
+#define _WINSOCKAPI_    // stops windows.h including winsock.h
+
+/// ----------------------------------------------------------------------------
+/// Headers
+/// ----------------------------------------------------------------------------
+
+#include "ncjs/ModuleResolver.h"
+
+#include "ncjs/base.h"
+#include "ncjs/Archive.h"
+#include "ncjs/SourceCache.h"
+
+#include <uv.h>
+
+#include <string.h>
+
+#include <map>
+
+namespace ncjs {
+
+/// ----------------------------------------------------------------------------
+/// variables
+/// ----------------------------------------------------------------------------
+
+#ifdef _WIN32
+static const char SEP = '\\';
+static const char* SEPS = "\\/";
+#else
+static const char SEP = '/';
+static const char* SEPS = "/";
+#endif
+
+static const unsigned DEFAULT_CAPACITY = 65536;
+static const unsigned MAX_JSON_DEPTH = 256;
+
+struct Package {
+    enum State {
+        NONE,       // no package.json
+        NO_MAIN,    // no main or a falsy one
+        MAIN,
+        INVALID     // left to the JSON.parse() of Module._findPath()
+    } state;
+
+    std::string main;
+};
+
+typedef std::map<std::string, int> StatMap;
+typedef std::map<std::string, Package> PackageMap;
+typedef std::map<std::string, std::string> RealPathMap;
+typedef std::multimap<std::string, std::string> TargetMap;
+
+static uv_mutex_t s_mutex;
+static bool s_initialized = false;
+
+// guarded by s_mutex
+
+static StatMap s_stats;
+static PackageMap s_packages;   // keyed by the path of package.json
+static RealPathMap s_realpaths;
+static TargetMap s_targets;     // keys of s_realpaths by their real paths
+static unsigned s_capacity = DEFAULT_CAPACITY;
+static double s_statHits = 0;
+static double s_statMisses = 0;
+static double s_packageHits = 0;
+static double s_packageMisses = 0;
+static double s_realpathHits = 0;
+static double s_realpathMisses = 0;
+
+/// ============================================================================
+/// implementation
+/// ============================================================================
+
+/// ----------------------------------------------------------------------------
+/// paths
+/// ----------------------------------------------------------------------------
+
+static inline bool IsSep(char c)
+{
+#ifdef _WIN32
+    return c == '\\' || c == '/';
+#else
+    return c == '/';
+#endif
+}
+
+static inline bool IsAbsolute(const std::string& path)
+{
+#ifdef _WIN32
+    return (path.size() > 0 && IsSep(path[0])) || (path.size() > 1 && path[1] == ':');
+#else
+    return path.size() > 0 && path[0] == '/';
+#endif
+}
+
+// length of "/", "C:\" or "\\server\share\" of a path.resolve() result
+static size_t RootLength(const std::string& path)
+{
+#ifdef _WIN32
+    if (path.size() > 1 && path[1] == ':')
+        return path.size() > 2 && IsSep(path[2]) ? 3 : 2;
+
+    if (path.size() > 1 && IsSep(path[0]) && IsSep(path[1])) {
+        size_t seps = 0;
+        for (size_t i = 2; i < path.size(); ++i) {
+            if (IsSep(path[i]) && ++seps == 2)
+                return i + 1;
+        }
+        return path.size();
+    }
+#endif
+    return path.size() > 0 && IsSep(path[0]) ? 1 : 0;
+}
+
+// path.resolve(dir, rel) for an absolute and normalized dir,
+// returns false for absolute rel
+static bool Join(const std::string& dir, const std::string& rel, std::string& out)
+{
+    if (IsAbsolute(rel))
+        return false;
+
+    const size_t root = RootLength(dir);
+
+    out = dir;
+
+    for (size_t start = 0; start < rel.size(); ) {
+        size_t end = start;
+        while (end < rel.size() && !IsSep(rel[end]))
+            ++end;
+
+        const size_t len = end - start;
+
+        if (len == 2 && rel[start] == '.' && rel[start + 1] == '.') {
+            const size_t pos = out.find_last_of(SEPS);
+            out.resize(pos == std::string::npos || pos < root ? root : pos);
+        } else if (len > 0 && !(len == 1 && rel[start] == '.')) {
+            if (out.size() > root || (out.size() && !IsSep(out[out.size() - 1])))
+                out += SEP;
+            out.append(rel, start, len);
+        }
+
+        start = end + 1;
+    }
+
+    return true;
+}
+
+static inline std::string Join(const std::string& dir, const char* name)
+{
+    std::string out;
+    Join(dir, name, out);
+    return out;
+}
+
+/// ----------------------------------------------------------------------------
+/// package.json
+/// ----------------------------------------------------------------------------
+
+// Just enough of JSON.parse() to find the main field: anything it would
+// not take, or a main field other than a string or a falsy value, is left
+// to Module._findPath().
+
+struct Json {
+    const char* p;
+    const char* end;
+    unsigned depth;
+};
+
+enum JsonType { JSON_ERROR, JSON_FALSY, JSON_TRUTHY, JSON_STRING };
+
+static inline void SkipSpaces(Json& json)
+{
+    while (json.p < json.end &&
+           (*json.p == ' ' || *json.p == '\t' || *json.p == '\n' || *json.p == '\r'))
+        ++json.p;
+}
+
+static inline int HexValue(char c)
+{
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    return -1;
+}
+
+static bool ReadHex4(Json& json, unsigned& code)
+{
+    if (json.end - json.p < 4)
+        return false;
+
+    code = 0;
+    for (int i = 0; i < 4; ++i) {
+        const int v = HexValue(*json.p++);
+        if (v < 0)
+            return false;
+        code = code << 4 | unsigned(v);
+    }
+
+    return true;
+}
+
+static void AppendUtf8(std::string& str, unsigned code)
+{
+    if (code < 0x80) {
+        str += char(code);
+    } else if (code < 0x800) {
+        str += char(0xc0 | code >> 6);
+        str += char(0x80 | (code & 0x3f));
+    } else if (code < 0x10000) {
+        str += char(0xe0 | code >> 12);
+        str += char(0x80 | (code >> 6 & 0x3f));
+        str += char(0x80 | (code & 0x3f));
+    } else {
+        str += char(0xf0 | code >> 18);
+        str += char(0x80 | (code >> 12 & 0x3f));
+        str += char(0x80 | (code >> 6 & 0x3f));
+        str += char(0x80 | (code & 0x3f));
+    }
+}
+
+// at the opening quote
+static bool ReadString(Json& json, std::string& str)
+{
+    str.clear();
+
+    for (++json.p; json.p < json.end; ) {
+        const unsigned char c = static_cast<unsigned char>(*json.p++);
+
+        if (c == '"')
+            return true;
+        if (c < 0x20)
+            return false;
+        if (c != '\\') {
+            str += char(c);
+            continue;
+        }
+
+        if (json.p == json.end)
+            return false;
+
+        unsigned code;
+
+        switch (*json.p++) {
+        case '"':  str += '"';  break;
+        case '\\': str += '\\'; break;
+        case '/':  str += '/';  break;
+        case 'b':  str += '\b'; break;
+        case 'f':  str += '\f'; break;
+        case 'n':  str += '\n'; break;
+        case 'r':  str += '\r'; break;
+        case 't':  str += '\t'; break;
+        case 'u':
+            if (!ReadHex4(json, code))
+                return false;
+            // a surrogate pair, lone surrogates are kept as they are
+            if (code >= 0xd800 && code < 0xdc00 && json.end - json.p >= 6 &&
+                json.p[0] == '\\' && json.p[1] == 'u') {
+                Json low = json;
+                unsigned next;
+                low.p += 2;
+                if (ReadHex4(low, next) && next >= 0xdc00 && next < 0xe000) {
+                    code = 0x10000 + ((code - 0xd800) << 10) + (next - 0xdc00);
+                    json.p = low.p;
+                }
+            }
+            AppendUtf8(str, code);
+            break;
+        default:
+            return false;
+        }
+    }
+
+    return false;
+}
+
+static inline bool IsDigit(char c)
+{
+    return c >= '0' && c <= '9';
+}
+
+static JsonType ReadNumber(Json& json)
+{
+    bool zero = true;
+
+    if (*json.p == '-')
+        ++json.p;
+
+    if (json.p == json.end || !IsDigit(*json.p))
+        return JSON_ERROR;
+
+    if (*json.p == '0') {
+        ++json.p;
+    } else {
+        zero = false;
+        while (json.p < json.end && IsDigit(*json.p))
+            ++json.p;
+    }
+
+    if (json.p < json.end && *json.p == '.') {
+        if (++json.p == json.end || !IsDigit(*json.p))
+            return JSON_ERROR;
+        while (json.p < json.end && IsDigit(*json.p))
+            zero = zero && *json.p++ == '0';
+    }
+
+    if (json.p < json.end && (*json.p == 'e' || *json.p == 'E')) {
+        if (++json.p < json.end && (*json.p == '+' || *json.p == '-'))
+            ++json.p;
+        if (json.p == json.end || !IsDigit(*json.p))
+            return JSON_ERROR;
+        while (json.p < json.end && IsDigit(*json.p))
+            ++json.p;
+    }
+
+    return zero ? JSON_FALSY : JSON_TRUTHY;
+}
+
+static inline bool ReadLiteral(Json& json, const char* literal)
+{
+    const size_t len = strlen(literal);
+
+    if (size_t(json.end - json.p) < len || memcmp(json.p, literal, len) != 0)
+        return false;
+
+    json.p += len;
+    return true;
+}
+
+// main is set when the value is an object with a main field
+static JsonType ReadValue(Json& json, std::string* str, JsonType* main, std::string* mainStr)
+{
+    SkipSpaces(json);
+
+    if (json.p == json.end)
+        return JSON_ERROR;
+
+    switch (*json.p) {
+    case '"': {
+        std::string tmp;
+        if (!ReadString(json, str ? *str : tmp))
+            return JSON_ERROR;
+        return JSON_STRING;
+    }
+    case '{': case '[': {
+        const bool object = *json.p++ == '{';
+
+        if (++json.depth > MAX_JSON_DEPTH)
+            return JSON_ERROR;
+
+        SkipSpaces(json);
+
+        if (json.p < json.end && *json.p == (object ? '}' : ']')) {
+            ++json.p;
+            --json.depth;
+            return JSON_TRUTHY;
+        }
+
+        for (;;) {
+            std::string key;
+
+            if (object) {
+                SkipSpaces(json);
+                if (json.p == json.end || *json.p != '"' || !ReadString(json, key))
+                    return JSON_ERROR;
+                SkipSpaces(json);
+                if (json.p == json.end || *json.p++ != ':')
+                    return JSON_ERROR;
+            }
+
+            // the last main field wins like in JSON.parse()
+            if (object && main && key == "main") {
+                *main = ReadValue(json, mainStr, NULL, NULL);
+                if (*main == JSON_ERROR)
+                    return JSON_ERROR;
+            } else if (ReadValue(json, NULL, NULL, NULL) == JSON_ERROR) {
+                return JSON_ERROR;
+            }
+
+            SkipSpaces(json);
+
+            if (json.p == json.end)
+                return JSON_ERROR;
+            if (*json.p == (object ? '}' : ']'))
+                break;
+            if (*json.p++ != ',')
+                return JSON_ERROR;
+        }
+
+        ++json.p;
+        --json.depth;
+        return JSON_TRUTHY;
+    }
+    case 't':
+        return ReadLiteral(json, "true") ? JSON_TRUTHY : JSON_ERROR;
+    case 'f':
+        return ReadLiteral(json, "false") ? JSON_FALSY : JSON_ERROR;
+    case 'n':
+        return ReadLiteral(json, "null") ? JSON_FALSY : JSON_ERROR;
+    default:
+        return ReadNumber(json);
+    }
+}
+
+static Package ParsePackage(const std::string& text)
+{
+    Package pkg;
+    JsonType main = JSON_FALSY;
+
+    Json json = { text.c_str(), text.c_str() + text.size(), 0 };
+
+    if (ReadValue(json, NULL, &main, &pkg.main) == JSON_ERROR ||
+        (SkipSpaces(json), json.p != json.end)) {
+        pkg.state = Package::INVALID;
+    } else if (main == JSON_STRING) {
+        pkg.state = pkg.main.empty() ? Package::NO_MAIN : Package::MAIN;
+    } else if (main == JSON_FALSY) {
+        pkg.state = Package::NO_MAIN;
+    } else {
+        pkg.state = Package::INVALID;
+    }
+
+    return pkg;
+}
+
+/// ----------------------------------------------------------------------------
+/// cache
+/// ----------------------------------------------------------------------------
+
+// call with s_mutex locked
+static inline size_t Entries()
+{
+    return s_stats.size() + s_packages.size() + s_realpaths.size();
+}
+
+// call with s_mutex locked
+static inline void Clear()
+{
+    s_stats.clear();
+    s_packages.clear();
+    s_realpaths.clear();
+    s_targets.clear();
+}
+
+// call with s_mutex locked
+static inline void Reserve()
+{
+    if (Entries() >= s_capacity)
+        Clear();
+}
+
+static Package ReadPackage(const std::string& dir)
+{
+    const std::string path = Join(dir, "package.json");
+
+    uv_mutex_lock(&s_mutex);
+
+    PackageMap::const_iterator it = s_packages.find(path);
+
+    if (it != s_packages.end()) {
+        const Package pkg = it->second;
+        s_packageHits += 1;
+        uv_mutex_unlock(&s_mutex);
+        return pkg;
+    }
+
+    s_packageMisses += 1;
+
+    uv_mutex_unlock(&s_mutex);
+
+    Package pkg;
+    CefString text;
+
+    if (SourceCache::Read(path.c_str(), text) == 0) {
+        pkg = ParsePackage(text.ToString());
+    } else {
+        pkg.state = Package::NONE;
+    }
+
+    uv_mutex_lock(&s_mutex);
+
+    if (s_capacity) {
+        Reserve();
+        s_packages[path] = pkg;
+    }
+
+    uv_mutex_unlock(&s_mutex);
+
+    return pkg;
+}
+
+static inline bool TryFile(const std::string& path, std::string& filename)
+{
+    if (ModuleResolver::Stat(path) != 0)
+        return false;
+
+    filename = path;
+    return true;
+}
+
+static bool TryExtensions(const std::string& path, const ModuleResolver::PathList& exts,
+                          std::string& filename)
+{
+    for (size_t i = 0; i < exts.size(); ++i) {
+        if (TryFile(path + exts[i], filename))
+            return true;
+    }
+
+    return false;
+}
+
+static ModuleResolver::Result TryPackage(const std::string& dir, const ModuleResolver::PathList& exts,
+                                         std::string& filename)
+{
+    const Package pkg = ReadPackage(dir);
+
+    if (pkg.state == Package::INVALID)
+        return ModuleResolver::FALLBACK;
+
+    if (pkg.state != Package::MAIN)
+        return ModuleResolver::NOT_FOUND;
+
+    std::string main;
+
+    if (!Join(dir, pkg.main, main))
+        return ModuleResolver::FALLBACK;
+
+    if (TryFile(main, filename) ||
+        TryExtensions(main, exts, filename) ||
+        TryExtensions(Join(main, "index"), exts, filename))
+        return ModuleResolver::FOUND;
+
+    return ModuleResolver::NOT_FOUND;
+}
+
+/// ----------------------------------------------------------------------------
+/// resolution
+/// ----------------------------------------------------------------------------
+
+// uncached, 0 for files, 1 for directories or a libuv error code
+static int StatPath(const std::string& path)
+{
+    int rc;
+
+    if (!Archive::Stat(path.c_str(), rc)) {
+        uv_fs_t req;
+        rc = uv_fs_stat(uv_default_loop(), &req, path.c_str(), NULL);
+        if (rc == 0)
+            rc = !!(req.statbuf.st_mode & S_IFDIR);
+        uv_fs_req_cleanup(&req);
+    }
+
+    return rc;
+}
+
+static ModuleResolver::Result Search(const ModuleResolver::PathList& paths,
+                                     const ModuleResolver::PathList& bases,
+                                     const ModuleResolver::PathList& exts, bool trailingSlash,
+                                     std::string& filename, unsigned& index)
+{
+    for (size_t i = 0; i < paths.size(); ++i) {
+        // don't search further if path doesn't exist
+        if (!paths[i].empty() && ModuleResolver::Stat(paths[i]) < 1)
+            continue;
+
+        const std::string& base = bases[i];
+        ModuleResolver::Result result = ModuleResolver::NOT_FOUND;
+
+        if (!trailingSlash) {
+            const int rc = ModuleResolver::Stat(base);
+
+            if (rc == 0) {
+                filename = base;
+                result = ModuleResolver::FOUND;
+            } else if (rc == 1) {
+                result = TryPackage(base, exts, filename);
+            }
+
+            if (result == ModuleResolver::NOT_FOUND && TryExtensions(base, exts, filename))
+                result = ModuleResolver::FOUND;
+        }
+
+        if (result == ModuleResolver::NOT_FOUND)
+            result = TryPackage(base, exts, filename);
+
+        if (result == ModuleResolver::NOT_FOUND &&
+            TryExtensions(Join(base, "index"), exts, filename))
+            result = ModuleResolver::FOUND;
+
+        if (result != ModuleResolver::NOT_FOUND) {
+            index = unsigned(i);
+            return result;
+        }
+    }
+
+    return ModuleResolver::NOT_FOUND;
+}
+
+/// ----------------------------------------------------------------------------
+/// static functions
+/// ----------------------------------------------------------------------------
+
+int ModuleResolver::Stat(const std::string& path)
+{
+    NCJS_ASSERT(s_initialized);
+
+    uv_mutex_lock(&s_mutex);
+
+    StatMap::const_iterator it = s_stats.find(path);
+
+    if (it != s_stats.end()) {
+        const int rc = it->second;
+        s_statHits += 1;
+        uv_mutex_unlock(&s_mutex);
+        return rc;
+    }
+
+    s_statMisses += 1;
+
+    uv_mutex_unlock(&s_mutex);
+
+    const int rc = StatPath(path);
+
+    // a missing file may be created any time, by any process
+    if (rc < 0)
+        return rc;
+
+    uv_mutex_lock(&s_mutex);
+
+    if (s_capacity) {
+        Reserve();
+        s_stats[path] = rc;
+    }
+
+    uv_mutex_unlock(&s_mutex);
+
+    return rc;
+}
+
+int ModuleResolver::RealPath(const std::string& path, std::string& real)
+{
+    NCJS_ASSERT(s_initialized);
+
+    uv_mutex_lock(&s_mutex);
+
+    RealPathMap::const_iterator it = s_realpaths.find(path);
+
+    if (it != s_realpaths.end()) {
+        real = it->second;
+        s_realpathHits += 1;
+        uv_mutex_unlock(&s_mutex);
+        return 0;
+    }
+
+    s_realpathMisses += 1;
+
+    uv_mutex_unlock(&s_mutex);
+
+    uv_fs_t req;
+    const int rc = uv_fs_realpath(uv_default_loop(), &req, path.c_str(), NULL);
+
+    if (rc == 0)
+        real = static_cast<const char*>(req.ptr);
+
+    uv_fs_req_cleanup(&req);
+
+    if (rc)
+        return rc;
+
+    uv_mutex_lock(&s_mutex);
+
+    if (s_capacity && s_realpaths.find(path) == s_realpaths.end()) {
+        Reserve();
+        s_realpaths[path] = real;
+        s_targets.insert(std::make_pair(real, path));
+    }
+
+    uv_mutex_unlock(&s_mutex);
+
+    return 0;
+}
+
+ModuleResolver::Result ModuleResolver::Resolve(const PathList& paths, const PathList& bases,
+                                               const PathList& exts, bool trailingSlash,
+                                               std::string& filename, unsigned& index)
+{
+    NCJS_ASSERT(paths.size() == bases.size());
+
+    const Result result = Search(paths, bases, exts, trailingSlash, filename, index);
+
+    if (result != FOUND || StatPath(filename) == 0)
+        return result;
+
+    // removed by another process, the entries that led to it are stale
+    Invalidate(bases[index].c_str());
+    Invalidate(filename.c_str());
+
+    return Search(paths, bases, exts, trailingSlash, filename, index);
+}
+
+// the entry is the path itself, or below it unless subtree is false
+static inline bool IsBelow(const std::string& entry, const std::string& path, bool subtree)
+{
+    return entry.size() == path.size() || (subtree && IsSep(entry[path.size()]));
+}
+
+template <class M>
+static void Erase(M& map, const std::string& path, bool subtree)
+{
+    typename M::iterator it = map.lower_bound(path);
+
+    while (it != map.end() && it->first.compare(0, path.size(), path) == 0) {
+        if (IsBelow(it->first, path, subtree))
+            map.erase(it++);
+        else
+            ++it;
+    }
+}
+
+// call with s_mutex locked
+static void EraseTarget(const std::string& real, const std::string& path)
+{
+    std::pair<TargetMap::iterator, TargetMap::iterator> range = s_targets.equal_range(real);
+
+    for (TargetMap::iterator it = range.first; it != range.second; ++it) {
+        if (it->second == path) {
+            s_targets.erase(it);
+            return;
+        }
+    }
+}
+
+// call with s_mutex locked, a link may have been changed below the path,
+// or the target it resolved to
+static void EraseRealPaths(const std::string& path, bool subtree)
+{
+    RealPathMap::iterator it = s_realpaths.lower_bound(path);
+
+    while (it != s_realpaths.end() && it->first.compare(0, path.size(), path) == 0) {
+        if (IsBelow(it->first, path, subtree)) {
+            EraseTarget(it->second, it->first);
+            s_realpaths.erase(it++);
+        } else {
+            ++it;
+        }
+    }
+
+    TargetMap::iterator target = s_targets.lower_bound(path);
+
+    while (target != s_targets.end() && target->first.compare(0, path.size(), path) == 0) {
+        if (IsBelow(target->first, path, subtree)) {
+            s_realpaths.erase(target->second);
+            s_targets.erase(target++);
+        } else {
+            ++target;
+        }
+    }
+}
+
+void ModuleResolver::Invalidate(const char* path, bool subtree)
+{
+    NCJS_ASSERT(s_initialized);
+
+    // entries are absolute, fs calls may be relative to the working directory
+    std::string absolute;
+
+    if (path && !IsAbsolute(path)) {
+        std::vector<char> cwd(4096);
+        size_t size = cwd.size();
+        int rc = uv_cwd(&cwd[0], &size);
+
+        if (rc == UV_ENOBUFS) {
+            cwd.resize(size + 1);
+            size = cwd.size();
+            rc = uv_cwd(&cwd[0], &size);
+        }
+
+        if (rc || !Join(std::string(&cwd[0], size), path, absolute))
+            return;
+
+        path = absolute.c_str();
+    }
+
+    uv_mutex_lock(&s_mutex);
+
+    if (path == NULL) {
+        Clear();
+    } else {
+        Erase(s_stats, path, subtree);
+        Erase(s_packages, path, subtree);
+        EraseRealPaths(path, subtree);
+    }
+
+    uv_mutex_unlock(&s_mutex);
+}
+
+unsigned ModuleResolver::GetCapacity()
+{
+    return s_capacity;
+}
+
+void ModuleResolver::SetCapacity(unsigned entries)
+{
+    if (!s_initialized) {
+        s_capacity = entries;
+        return;
+    }
+
+    uv_mutex_lock(&s_mutex);
+
+    s_capacity = entries;
+
+    if (Entries() > s_capacity)
+        Clear();
+
+    uv_mutex_unlock(&s_mutex);
+}
+
+void ModuleResolver::GetStats(Stats& stats)
+{
+    stats = Stats();
+
+    if (!s_initialized)
+        return;
+
+    uv_mutex_lock(&s_mutex);
+
+    stats.statHits = s_statHits;
+    stats.statMisses = s_statMisses;
+    stats.packageHits = s_packageHits;
+    stats.packageMisses = s_packageMisses;
+    stats.realpathHits = s_realpathHits;
+    stats.realpathMisses = s_realpathMisses;
+    stats.entries = unsigned(Entries());
+    stats.capacity = s_capacity;
+
+    uv_mutex_unlock(&s_mutex);
+}
+
+bool ModuleResolver::Initialize(unsigned capacity)
+{
+    if (!s_initialized) {
+        NCJS_CHK_EQ(uv_mutex_init(&s_mutex), 0);
+        s_initialized = true;
+    }
+
+    SetCapacity(capacity);
+
+    return true;
+}
+
+} // ncjs
@@ -0,0 +1,324 @@
+
+/***************************************************************
+ * Name:      SourceCache.cpp
+ * Purpose:   Codes for Node-CEF Source Cache Class
+ * Author:    Joshua GPBeta (studiocghibli@gmail.com)
+ * Created:   2016-08-10
+ * Copyright: Studio GPBeta (www.gpbeta.com)
+ * License:
+ **************************************************************/
+
+/// ============================================================================
+/// declarations
+/// ============================================================================
+
+#define _WINSOCKAPI_    // stops windows.h including winsock.h
+
+/// ----------------------------------------------------------------------------
+/// Headers
+/// ----------------------------------------------------------------------------
+
+#include "ncjs/SourceCache.h"
+
+#include "ncjs/base.h"
+#include "ncjs/Archive.h"
+#include "ncjs/Codec.h"
+
+#include <uv.h>
+
+#include <string.h>
+
+#include <map>
+#include <string>
+#include <vector>
+
+namespace ncjs {
+
+/// ----------------------------------------------------------------------------
+/// variables
+/// ----------------------------------------------------------------------------
+
+static const size_t DEFAULT_CAPACITY = 16 << 20;
+
+struct Entry {
+    uint64_t size;          // of the file
+    uv_timespec_t mtime;
+    CefString text;
+    size_t bytes;           // of the text
+    uint64_t tick;          // last use
+};
+
+typedef std::map<std::string, Entry> EntryMap;
+
+static uv_mutex_t s_mutex;
+static bool s_initialized = false;
+
+// guarded by s_mutex
+
+static EntryMap s_entries;
+static size_t s_capacity = DEFAULT_CAPACITY;
+static size_t s_bytes = 0;
+static uint64_t s_tick = 0;
+static double s_hits = 0;
+static double s_misses = 0;
+
+/// ============================================================================
+/// implementation
+/// ============================================================================
+
+static inline bool IsSameFile(const Entry& entry, const uv_stat_t& st)
+{
+    return entry.size == st.st_size &&
+           entry.mtime.tv_sec == st.st_mtim.tv_sec &&
+           entry.mtime.tv_nsec == st.st_mtim.tv_nsec;
+}
+
+static void Decode(const char* data, size_t len, CefString& text)
+{
+    // skip UTF-8 BOM
+    if (len >= 3 && memcmp(data, "\xEF\xBB\xBF", 3) == 0) {
+        data += 3;
+        len -= 3;
+    }
+
+#ifdef CEF_STRING_TYPE_UTF16
+    // never more characters than bytes
+    std::vector<cef_char_t> dst(len + 1);
+    const size_t strLen = Codec::Utf8Decode(data, len, To<Codec::char16*>(&dst[0]));
+
+    text.FromString(&dst[0], strLen, true);
+#else
+    text.FromString(std::string(data, len));
+#endif // CEF_STRING_TYPE_UTF16
+}
+
+static int ReadFile(const char* path, CefString& text, uv_stat_t& st)
+{
+    uv_loop_t* loop = uv_default_loop();
+
+    uv_fs_t req;
+    const int fd = uv_fs_open(loop, &req, path, O_RDONLY, 0, NULL);
+    uv_fs_req_cleanup(&req);
+
+    if (fd < 0)
+        return fd;
+
+    int err = uv_fs_fstat(loop, &req, fd, NULL);
+    st = req.statbuf;
+    uv_fs_req_cleanup(&req);
+
+    const size_t size = size_t(st.st_size);
+
+    // read rather than mapped, a mapped file truncated by an editor while
+    // it is decoded raises SIGBUS
+    if (err == 0) {
+        // one more byte than the size tells a file grown since fstat(),
+        // files of special file systems may report no size at all
+        std::vector<char> chars(size + 1);
+        size_t len = 0;
+
+        for (;;) {
+            uv_buf_t buf = uv_buf_init(&chars[len], unsigned(chars.size() - len));
+
+            const ssize_t nChar = uv_fs_read(loop, &req, fd, &buf, 1, int64_t(len), NULL);
+            uv_fs_req_cleanup(&req);
+
+            if (nChar <= 0) {
+                err = int(nChar);
+                break;
+            }
+
+            len += size_t(nChar);
+
+            if (len == size && len < chars.size())
+                break;
+
+            if (len == chars.size())
+                chars.resize(Max(chars.size() * 2, size_t(32 << 10)));
+        }
+
+        if (err == 0) {
+            Decode(&chars[0], len, text);
+            st.st_size = len;
+        }
+    }
+
+    uv_fs_close(loop, &req, fd, NULL);
+    uv_fs_req_cleanup(&req);
+
+    return err;
+}
+
+// call with s_mutex locked
+static void Erase(EntryMap::iterator it)
+{
+    s_bytes -= it->second.bytes;
+    s_entries.erase(it);
+}
+
+// call with s_mutex locked
+static void Trim()
+{
+    while (s_bytes > s_capacity) {
+        EntryMap::iterator oldest = s_entries.begin();
+
+        for (EntryMap::iterator it = oldest; it != s_entries.end(); ++it) {
+            if (it->second.tick < oldest->second.tick)
+                oldest = it;
+        }
+
+        Erase(oldest);
+    }
+}
+
+/// ----------------------------------------------------------------------------
+/// static functions
+/// ----------------------------------------------------------------------------
+
+int SourceCache::Read(const char* path, CefString& text)
+{
+    NCJS_ASSERT(s_initialized);
+
+    // packs never change and are mapped already, nothing to cache
+    {
+        const char* data;
+        size_t size;
+        std::vector<char> buffer;
+        int err;
+
+        if (Archive::Read(path, data, size, buffer, err)) {
+            if (err == 0)
+                Decode(data, size, text);
+            return err;
+        }
+    }
+
+    const std::string key(path);
+    const bool enabled = GetCapacity() > 0;
+
+    if (enabled) {
+        uv_fs_t req;
+        const int err = uv_fs_stat(uv_default_loop(), &req, path, NULL);
+        const uv_stat_t st = req.statbuf;
+        uv_fs_req_cleanup(&req);
+
+        if (err < 0)
+            return err;
+
+        uv_mutex_lock(&s_mutex);
+
+        EntryMap::iterator it = s_entries.find(key);
+
+        if (it != s_entries.end() && IsSameFile(it->second, st)) {
+            it->second.tick = ++s_tick;
+            text = it->second.text;
+            s_hits += 1;
+
+            uv_mutex_unlock(&s_mutex);
+            return 0;
+        }
+
+        uv_mutex_unlock(&s_mutex);
+    }
+
+    uv_stat_t st;
+    const int err = ReadFile(path, text, st);
+
+    uv_mutex_lock(&s_mutex);
+
+    s_misses += 1;
+
+    EntryMap::iterator it = s_entries.find(key);
+
+    if (it != s_entries.end())
+        Erase(it);
+
+    const size_t bytes = text.length() * sizeof(cef_char_t);
+
+    if (err == 0 && enabled && bytes <= s_capacity) {
+        Entry& entry = s_entries[key];
+        entry.size = st.st_size;
+        entry.mtime = st.st_mtim;
+        entry.text = text;
+        entry.bytes = bytes;
+        entry.tick = ++s_tick;
+
+        s_bytes += bytes;
+        Trim();
+    }
+
+    uv_mutex_unlock(&s_mutex);
+
+    return err;
+}
+
+void SourceCache::Invalidate(const char* path)
+{
+    NCJS_ASSERT(s_initialized);
+
+    uv_mutex_lock(&s_mutex);
+
+    if (path == NULL) {
+        s_entries.clear();
+        s_bytes = 0;
+    } else {
+        EntryMap::iterator it = s_entries.find(path);
+
+        if (it != s_entries.end())
+            Erase(it);
+    }
+
+    uv_mutex_unlock(&s_mutex);
+}
+
+size_t SourceCache::GetCapacity()
+{
+    return s_capacity;
+}
+
+void SourceCache::SetCapacity(size_t bytes)
+{
+    if (!s_initialized) {
+        s_capacity = bytes;
+        return;
+    }
+
+    uv_mutex_lock(&s_mutex);
+
+    s_capacity = bytes;
+    Trim();
+
+    uv_mutex_unlock(&s_mutex);
+}
+
+void SourceCache::GetStats(Stats& stats)
+{
+    stats = Stats();
+
+    if (!s_initialized)
+        return;
+
+    uv_mutex_lock(&s_mutex);
+
+    stats.hits = s_hits;
+    stats.misses = s_misses;
+    stats.entries = unsigned(s_entries.size());
+    stats.bytes = double(s_bytes);
+    stats.capacity = double(s_capacity);
+
+    uv_mutex_unlock(&s_mutex);
+}
+
+bool SourceCache::Initialize(size_t capacity)
+{
+    if (!s_initialized) {
+        NCJS_CHK_EQ(uv_mutex_init(&s_mutex), 0);
+        s_initialized = true;
+    }
+
+    SetCapacity(capacity);
+
+    return true;
+}
+
+} // ncjs
@@ -0,0 +1,369 @@
+/***************************************************************
+ * Name:      StatPoller.cpp
+ * Purpose:   Codes for Node-CEF Stat Poller Class
+ * Author:    Joshua GPBeta (studiocghibli@gmail.com)
+ * Created:   2016-09-14
+ * Copyright: Studio GPBeta (www.gpbeta.com)
+ * License:
+ **************************************************************/
+
+/// ============================================================================
+/// declarations
+/// ============================================================================
+
+#define _WINSOCKAPI_    // stops windows.h including winsock.h
+
+/// ----------------------------------------------------------------------------
+/// Headers
+/// ----------------------------------------------------------------------------
+
+#include "ncjs/StatPoller.h"
+
+#include "ncjs/base.h"
+#include "ncjs/ThreadPool.h"
+
+#include <include/base/cef_bind.h>
+
+#include <algorithm>
+#include <string.h>
+
+namespace ncjs {
+
+/// ----------------------------------------------------------------------------
+/// variables
+/// ----------------------------------------------------------------------------
+
+static uv_once_t s_once = UV_ONCE_INIT;
+static uv_mutex_t s_mutex;
+
+// guarded by s_mutex, the pollers are used on their loop threads only
+static std::map<uv_loop_t*, StatPoller*> s_pollers;
+
+/// ============================================================================
+/// implementation
+/// ============================================================================
+
+static void InitOnce()
+{
+    NCJS_CHK_EQ(uv_mutex_init(&s_mutex), 0);
+}
+
+void StatPoller::Add(uv_loop_t* loop, const std::string& path, unsigned interval,
+                     Listener* listener)
+{
+    StatPoller* poller = Get(loop, true);
+
+    Entry* entry = new Entry;
+    entry->listener = listener;
+    entry->path = path;
+    entry->interval = Max(uint64_t(1), (uint64_t(interval) + TICK - 1) / TICK);
+    entry->due = poller->Now() + 1;
+    entry->busy = 0;
+    entry->pending = false;
+    entry->removed = false;
+    memset(&entry->stat, 0, sizeof(entry->stat));
+
+    poller->m_entries[listener] = entry;
+    poller->Schedule(entry);
+    poller->Arm();
+}
+
+void StatPoller::Remove(uv_loop_t* loop, Listener* listener)
+{
+    StatPoller* poller = Get(loop, false);
+
+    if (poller == NULL)
+        return;
+
+    EntryMap::iterator it = poller->m_entries.find(listener);
+
+    if (it == poller->m_entries.end())
+        return;
+
+    Entry* entry = it->second;
+    poller->m_entries.erase(it);
+
+    // a job has it, deleted once the job is done
+    if (entry->pending) {
+        entry->removed = true;
+    } else {
+        poller->Unschedule(entry);
+        delete entry;
+    }
+
+    poller->CloseIfIdle();
+}
+
+void StatPoller::Schedule(Entry* entry)
+{
+    m_wheel[entry->due % WHEEL_SIZE].push_back(entry);
+    ++m_scheduled;
+}
+
+void StatPoller::Unschedule(Entry* entry)
+{
+    Slot& slot = m_wheel[entry->due % WHEEL_SIZE];
+    Slot::iterator it = std::find(slot.begin(), slot.end(), entry);
+
+    if (it != slot.end()) {
+        slot.erase(it);
+        --m_scheduled;
+    }
+}
+
+// wakes up at the next tick with entries rather than every tick
+void StatPoller::Arm()
+{
+    if (m_scheduled == 0) {
+        uv_timer_stop(&m_timer);
+        return;
+    }
+
+    uint64_t tick = m_tick + 1;
+
+    while (m_wheel[tick % WHEEL_SIZE].empty() && tick < m_tick + WHEEL_SIZE)
+        ++tick;
+
+    const uint64_t at = m_origin + tick * TICK;
+    const uint64_t now = uv_now(m_loop);
+
+    uv_timer_start(&m_timer, OnTimer, at > now ? at - now : 0, 0);
+}
+
+void StatPoller::Tick()
+{
+    const uint64_t now = Now();
+    const uint64_t last = Min(now, m_tick + WHEEL_SIZE);
+
+    std::vector<Entry*> due;
+
+    // a late timer catches up on the ticks it missed, entries of later
+    // rounds of the wheel stay in their slots
+    for (uint64_t tick = m_tick + 1; tick <= last; ++tick) {
+        Slot& slot = m_wheel[tick % WHEEL_SIZE];
+
+        for (size_t i = 0; i < slot.size(); ) {
+            if (slot[i]->due > now) {
+                ++i;
+                continue;
+            }
+
+            due.push_back(slot[i]);
+            slot[i] = slot.back();
+            slot.pop_back();
+            --m_scheduled;
+        }
+    }
+
+    m_tick = Max(m_tick, now);
+
+    // a few jobs for many paths, so that other metadata requests still get
+    // threads
+    for (size_t i = 0; i < due.size(); i += STATS_PER_JOB) {
+        Job* job = new Job;
+        job->poller = this;
+        job->entries.assign(due.begin() + i,
+                            due.begin() + Min(due.size(), i + STATS_PER_JOB));
+
+        for (size_t j = 0; j < job->entries.size(); ++j)
+            job->entries[j]->pending = true;
+
+        ++m_jobs;
+
+        // shut down, completed with nothing stat'ed
+        if (!ThreadPool::Queue(ThreadPool::METADATA, base::Bind(&StatPoller::Run, job)))
+            Done(job);
+    }
+
+    Arm();
+}
+
+// thread safe, Complete() runs on the loop thread. Signalled under the lock,
+// the loop thread can't take the job, complete it and close the poller first
+void StatPoller::Done(Job* job)
+{
+    uv_mutex_lock(&m_mutex);
+    m_done.push_back(job);
+    uv_async_send(&m_async);
+    uv_mutex_unlock(&m_mutex);
+}
+
+// what uv_fs_poll_t reports
+void StatPoller::Complete(Job* job)
+{
+    static const uv_stat_t zero = uv_stat_t();
+
+    for (size_t i = 0; i < job->entries.size(); ++i) {
+        Entry* entry = job->entries[i];
+        entry->pending = false;
+
+        if (entry->removed) {
+            delete entry;
+            continue;
+        }
+
+        // nothing stat'ed if the job was cancelled
+        if (job->errors.size() == job->entries.size()) {
+            const int err = job->errors[i];
+
+            if (err) {
+                if (entry->busy != err) {
+                    entry->listener->OnStatChange(err, entry->stat, zero);
+                    entry->busy = err;
+                }
+            } else {
+                if (entry->busy != 0 && (entry->busy < 0 || !IsEqual(entry->stat, job->stats[i])))
+                    entry->listener->OnStatChange(0, entry->stat, job->stats[i]);
+
+                entry->stat = job->stats[i];
+                entry->busy = 1;
+            }
+        }
+
+        entry->due = Max(entry->due + entry->interval, m_tick + 1);
+        Schedule(entry);
+    }
+
+    delete job;
+    --m_jobs;
+
+    Arm();
+    CloseIfIdle();
+}
+
+void StatPoller::CloseIfIdle()
+{
+    if (m_entries.size() || m_jobs)
+        return;
+
+    uv_mutex_lock(&s_mutex);
+    s_pollers.erase(m_loop);
+    uv_mutex_unlock(&s_mutex);
+
+    uv_timer_stop(&m_timer);
+    uv_close(reinterpret_cast<uv_handle_t*>(&m_timer), OnCloseTimer);
+}
+
+uint64_t StatPoller::Now() const
+{
+    return (uv_now(m_loop) - m_origin) / TICK;
+}
+
+/// ----------------------------------------------------------------------------
+/// constructor & destructor
+/// ----------------------------------------------------------------------------
+
+StatPoller::StatPoller(uv_loop_t* loop) :
+    m_loop(loop), m_origin(uv_now(loop)), m_tick(0), m_scheduled(0), m_jobs(0)
+{
+    NCJS_CHK_EQ(uv_mutex_init(&m_mutex), 0);
+    NCJS_CHK_EQ(uv_timer_init(loop, &m_timer), 0);
+    NCJS_CHK_EQ(uv_async_init(loop, &m_async, OnAsync), 0);
+    m_timer.data = this;
+    m_async.data = this;
+}
+
+StatPoller::~StatPoller()
+{
+    uv_mutex_destroy(&m_mutex);
+}
+
+/// ----------------------------------------------------------------------------
+/// static functions
+/// ----------------------------------------------------------------------------
+
+StatPoller* StatPoller::Get(uv_loop_t* loop, bool create)
+{
+    uv_once(&s_once, InitOnce);
+
+    uv_mutex_lock(&s_mutex);
+
+    std::map<uv_loop_t*, StatPoller*>::const_iterator it = s_pollers.find(loop);
+    StatPoller* poller = it == s_pollers.end() ? NULL : it->second;
+
+    if (poller == NULL && create)
+        s_pollers[loop] = poller = new StatPoller(loop);
+
+    uv_mutex_unlock(&s_mutex);
+
+    return poller;
+}
+
+void StatPoller::OnTimer(uv_timer_t* handle)
+{
+    NCJS_ASSERT(handle);
+
+    static_cast<StatPoller*>(handle->data)->Tick();
+}
+
+// on a ThreadPool worker, the entries are not touched by the loop thread
+// until the job is done
+void StatPoller::Run(Job* job)
+{
+    const size_t count = job->entries.size();
+
+    job->errors.resize(count);
+    job->stats.resize(count);
+
+    for (size_t i = 0; i < count; ++i) {
+        uv_fs_t fs;
+        job->errors[i] = uv_fs_stat(job->poller->m_loop, &fs,
+                                    job->entries[i]->path.c_str(), NULL);
+        job->stats[i] = fs.statbuf;
+        uv_fs_req_cleanup(&fs);
+    }
+
+    job->poller->Done(job);
+}
+
+void StatPoller::OnAsync(uv_async_t* handle)
+{
+    NCJS_ASSERT(handle);
+
+    StatPoller* poller = static_cast<StatPoller*>(handle->data);
+    std::vector<Job*> done;
+
+    uv_mutex_lock(&poller->m_mutex);
+    done.swap(poller->m_done);
+    uv_mutex_unlock(&poller->m_mutex);
+
+    // the last one might close the poller, deleted on a later iteration
+    for (size_t i = 0; i < done.size(); ++i)
+        poller->Complete(done[i]);
+}
+
+void StatPoller::OnCloseTimer(uv_handle_t* handle)
+{
+    NCJS_ASSERT(handle);
+
+    StatPoller* poller = static_cast<StatPoller*>(handle->data);
+    uv_close(reinterpret_cast<uv_handle_t*>(&poller->m_async), OnClose);
+}
+
+void StatPoller::OnClose(uv_handle_t* handle)
+{
+    NCJS_ASSERT(handle);
+
+    delete static_cast<StatPoller*>(handle->data);
+}
+
+// the fields uv_fs_poll_t compares
+bool StatPoller::IsEqual(const uv_stat_t& a, const uv_stat_t& b)
+{
+    return a.st_ctim.tv_nsec == b.st_ctim.tv_nsec &&
+           a.st_mtim.tv_nsec == b.st_mtim.tv_nsec &&
+           a.st_birthtim.tv_nsec == b.st_birthtim.tv_nsec &&
+           a.st_ctim.tv_sec == b.st_ctim.tv_sec &&
+           a.st_mtim.tv_sec == b.st_mtim.tv_sec &&
+           a.st_birthtim.tv_sec == b.st_birthtim.tv_sec &&
+           a.st_size == b.st_size &&
+           a.st_mode == b.st_mode &&
+           a.st_uid == b.st_uid &&
+           a.st_gid == b.st_gid &&
+           a.st_ino == b.st_ino &&
+           a.st_dev == b.st_dev &&
+           a.st_flags == b.st_flags &&
+           a.st_gen == b.st_gen;
+}
+
+} // ncjs
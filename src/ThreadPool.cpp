@@ -0,0 +1,213 @@
+
+/***************************************************************
+ * Name:      ThreadPool.cpp
+ * Purpose:   Codes for Node-CEF Thread Pool Class
+ * Author:    Joshua GPBeta (studiocghibli@gmail.com)
+ * Created:   2016-08-05
+ * Copyright: Studio GPBeta (www.gpbeta.com)
+ * License:
+ **************************************************************/
+
+/// ============================================================================
+/// declarations
+/// ============================================================================
+
+#define _WINSOCKAPI_    // stops windows.h including winsock.h
+
+/// ----------------------------------------------------------------------------
+/// Headers
+/// ----------------------------------------------------------------------------
+
+#include "ncjs/ThreadPool.h"
+
+#include "ncjs/base.h"
+
+#include <include/base/cef_callback.h>
+#include <uv.h>
+
+#include <deque>
+#include <vector>
+
+namespace ncjs {
+
+/// ----------------------------------------------------------------------------
+/// variables
+/// ----------------------------------------------------------------------------
+
+static const unsigned MAX_THREADS = 32;
+
+struct WorkQueue {
+    uv_mutex_t mutex;
+    uv_cond_t cond;
+    std::vector<uv_thread_t> threads;
+
+    // guarded by mutex
+    std::deque<base::Closure> tasks;
+    unsigned running;
+    double completed;
+    bool stopping;
+};
+
+static WorkQueue s_queues[ThreadPool::CLASS_COUNT];
+static bool s_initialized = false;
+
+static const char* s_names[ThreadPool::CLASS_COUNT] = { "metadata", "data", "slow" };
+static const unsigned s_defaults[ThreadPool::CLASS_COUNT] = { 2, 2, 1 };
+
+/// ============================================================================
+/// implementation
+/// ============================================================================
+
+/// ----------------------------------------------------------------------------
+/// static functions
+/// ----------------------------------------------------------------------------
+
+bool ThreadPool::Queue(Class cls, const base::Closure& work)
+{
+    NCJS_ASSERT(cls < CLASS_COUNT);
+
+    if (!s_initialized)
+        return false;
+
+    WorkQueue& queue = s_queues[cls];
+
+    uv_mutex_lock(&queue.mutex);
+
+    const bool accepted = !queue.stopping;
+
+    if (accepted) {
+        queue.tasks.push_back(work);
+        uv_cond_signal(&queue.cond);
+    }
+
+    uv_mutex_unlock(&queue.mutex);
+
+    return accepted;
+}
+
+void ThreadPool::GetStats(Class cls, Stats& stats)
+{
+    NCJS_ASSERT(cls < CLASS_COUNT);
+
+    stats = Stats();
+
+    if (!s_initialized)
+        return;
+
+    WorkQueue& queue = s_queues[cls];
+
+    uv_mutex_lock(&queue.mutex);
+
+    stats.threads = unsigned(queue.threads.size());
+    stats.pending = unsigned(queue.tasks.size());
+    stats.running = queue.running;
+    stats.completed = queue.completed;
+
+    uv_mutex_unlock(&queue.mutex);
+}
+
+const char* ThreadPool::GetClassName(Class cls)
+{
+    return cls < CLASS_COUNT ? s_names[cls] : "";
+}
+
+unsigned ThreadPool::GetDefaultThreads(Class cls)
+{
+    return cls < CLASS_COUNT ? s_defaults[cls] : 0;
+}
+
+void ThreadPool::Worker(void* arg)
+{
+    NCJS_ASSERT(arg);
+
+    WorkQueue* queue = static_cast<WorkQueue*>(arg);
+    base::Closure task;
+    bool busy = false;
+
+    for (;;) {
+        uv_mutex_lock(&queue->mutex);
+
+        // account for the previous task while holding the lock anyway
+        if (busy) {
+            queue->running -= 1;
+            queue->completed += 1;
+            busy = false;
+        }
+
+        while (queue->tasks.empty() && !queue->stopping)
+            uv_cond_wait(&queue->cond, &queue->mutex);
+
+        if (queue->stopping) {
+            uv_mutex_unlock(&queue->mutex);
+            break;
+        }
+
+        task = queue->tasks.front();
+        queue->tasks.pop_front();
+        queue->running += 1;
+        busy = true;
+
+        uv_mutex_unlock(&queue->mutex);
+
+        task.Run();
+        task.Reset();
+    }
+}
+
+bool ThreadPool::Initialize(const unsigned (&threads)[CLASS_COUNT])
+{
+    if (s_initialized)
+        return true;
+
+    for (int i = 0; i < CLASS_COUNT; ++i) {
+        WorkQueue& queue = s_queues[i];
+
+        NCJS_CHK_EQ(uv_mutex_init(&queue.mutex), 0);
+        NCJS_CHK_EQ(uv_cond_init(&queue.cond), 0);
+
+        queue.running = 0;
+        queue.completed = 0;
+        queue.stopping = false;
+        queue.threads.resize(Max(Min(threads[i], MAX_THREADS), 1u));
+
+        for (size_t k = 0; k < queue.threads.size(); ++k)
+            NCJS_CHK_EQ(uv_thread_create(&queue.threads[k], &ThreadPool::Worker, &queue), 0);
+    }
+
+    s_initialized = true;
+
+    return true;
+}
+
+void ThreadPool::Shutdown()
+{
+    if (!s_initialized)
+        return;
+
+    for (int i = 0; i < CLASS_COUNT; ++i) {
+        WorkQueue& queue = s_queues[i];
+
+        uv_mutex_lock(&queue.mutex);
+        queue.stopping = true;
+        uv_cond_broadcast(&queue.cond);
+        uv_mutex_unlock(&queue.mutex);
+    }
+
+    for (int i = 0; i < CLASS_COUNT; ++i) {
+        WorkQueue& queue = s_queues[i];
+
+        for (size_t k = 0; k < queue.threads.size(); ++k)
+            uv_thread_join(&queue.threads[k]);
+
+        // tasks never started are dropped
+        queue.threads.clear();
+        queue.tasks.clear();
+
+        uv_cond_destroy(&queue.cond);
+        uv_mutex_destroy(&queue.mutex);
+    }
+
+    s_initialized = false;
+}
+
+} // ncjs
@@ -12,6 +12,8 @@
 /// declarations
 /// ============================================================================
 
+#define _WINSOCKAPI_    // stops windows.h including winsock.h
+
 #define BUFFER_ERROR Environment::ErrorException(NCJS_TEXT("Argument must be a Buffer"), except)
 #define STRING_ERROR Environment::TypeException(NCJS_TEXT("Argument must be a string"), except)
 #define  INDEX_ERROR Environment::RangeException(NCJS_TEXT("Out of range index"), except)
@@ -32,10 +34,14 @@
 
 #include "ncjs/module.h"
 #include "ncjs/constants.h"
+#include "ncjs/Allocator.h"
+#include "ncjs/Codec.h"
 
 #include <string_search.h>
 #include <include/cef_parser.h>
+#include <uv.h>
 
+#include <math.h>
 #include <signal.h>
 #include <algorithm>
 
@@ -151,7 +157,7 @@ unsigned HEX2BIN(cef_char_t c) {
 
 template <Encoding E>
 static inline CefRefPtr<CefV8Value> DoSliceT(const char* buf, size_t len);
-// allocates memory if buf is NULL, caller's responsibility to free() it
+// allocates memory if buf is NULL, caller's responsibility to Allocator::Free() it
 template <Encoding E>
 static inline size_t DoWriteT(const CefString& str, size_t len, char*& buf);
 
@@ -173,7 +179,7 @@ static inline size_t DoWriteT<ASCII>(const CefString& str, size_t len, char*& bu
         len = strLen;
 
     if (buf == NULL) { // auto allocation
-        if (!(buf = static_cast<char*>(malloc(len))))
+        if (!(buf = static_cast<char*>(Allocator::Allocate(len))))
             return 0;
     }
 
@@ -203,7 +209,7 @@ static inline size_t DoWriteT<BINARY>(const CefString& str, size_t len, char*& b
         len = strLen;
 
     if (buf == NULL) { // auto allocation
-        if (!(buf = static_cast<char*>(malloc(len))))
+        if (!(buf = static_cast<char*>(Allocator::Allocate(len))))
             return 0;
     }
 
@@ -214,6 +220,67 @@ static inline size_t DoWriteT<BINARY>(const CefString& str, size_t len, char*& b
     return len;
 }
 
+#ifdef CEF_STRING_TYPE_UTF16
+
+// Codec writes UTF-16 directly, no intermediate copies
+
+template <>
+static inline CefRefPtr<CefV8Value> DoSliceT<BASE64>(const char* buf, size_t len)
+{
+    const size_t strLen = Codec::Base64EncodedSize(len);
+
+    std::vector<cef_char_t> dst(strLen);
+    Codec::Base64Encode(buf, len, To<Codec::char16*>(&dst[0]));
+
+    return CefV8Value::CreateString(CefString(&dst[0], strLen, false));
+}
+
+template <>
+static inline size_t DoWriteT<BASE64>(const CefString& str, size_t len, char*& buf)
+{
+    const Codec::char16* src = To<const Codec::char16*>(str.c_str());
+    const size_t size = Codec::Base64DecodedSize(src, str.length());
+
+    if (size < len)
+        len = size;
+
+    if (buf == NULL) { // auto allocation
+        if (!(buf = static_cast<char*>(Allocator::Allocate(len))))
+            return 0;
+    }
+
+    return Codec::Base64Decode(src, str.length(), buf, len);
+}
+
+template <>
+static inline CefRefPtr<CefV8Value> DoSliceT<HEX>(const char* buf, size_t len)
+{
+    const size_t strLen = len * 2;
+
+    std::vector<cef_char_t> dst(strLen);
+    Codec::HexEncode(buf, len, To<Codec::char16*>(&dst[0]));
+
+    return CefV8Value::CreateString(CefString(&dst[0], strLen, false));
+}
+
+template <>
+static inline size_t DoWriteT<HEX>(const CefString& str, size_t len, char*& buf)
+{
+    const size_t strLen = str.length() / 2;
+
+    if (strLen < len)
+        len = strLen;
+
+    if (buf == NULL) { // auto allocation
+        if (!(buf = static_cast<char*>(Allocator::Allocate(len))))
+            return 0;
+    }
+
+    return Codec::HexDecode(To<const Codec::char16*>(str.c_str()), len * 2, buf);
+}
+
+#else // UTF8 or UTF32
+
 template <>
 static inline CefRefPtr<CefV8Value> DoSliceT<BASE64>(const char* buf, size_t len)
 {
@@ -234,7 +301,7 @@ static inline size_t DoWriteT<BASE64>(const CefString& str, size_t len, char*& b
         len = rawLen;
 
     if (buf == NULL) { // auto allocation
-        if (!(buf = static_cast<char*>(malloc(len))))
+        if (!(buf = static_cast<char*>(Allocator::Allocate(len))))
             return 0;
     }
 
@@ -266,7 +333,7 @@ static inline size_t DoWriteT<HEX>(const CefString& str, size_t len, char*& buf)
         len = strLen;
 
     if (buf == NULL) { // auto allocation
-        if (!(buf = static_cast<char*>(malloc(len))))
+        if (!(buf = static_cast<char*>(Allocator::Allocate(len))))
             return 0;
     }
 
@@ -274,7 +341,7 @@ static inline size_t DoWriteT<HEX>(const CefString& str, size_t len, char*& buf)
     for (size_t i = 0; i < len; ++i) {
         const unsigned hi = HEX2BIN(*src++);
         const unsigned lo = HEX2BIN(*src++);
-        if (!(~hi && ~hi))
+        if (!(~hi && ~lo))
             return i;
         buf[i] = (hi << 4) | lo;
     }
@@ -282,6 +349,8 @@ static inline size_t DoWriteT<HEX>(const CefString& str, size_t len, char*& buf)
     return len;
 }
 
+#endif // CEF_STRING_TYPE_UTF16
+
 template <>
 static inline CefRefPtr<CefV8Value> DoSliceT<UCS2>(const char* buf, size_t len)
 {    
@@ -323,7 +392,7 @@ static inline size_t DoWriteT<UCS2>(const CefString& str, size_t len, char*& buf
         len = strLen;
 
     if (buf == NULL) { // auto allocation
-        if (!(buf = static_cast<char*>(malloc(len))))
+        if (!(buf = static_cast<char*>(Allocator::Allocate(len))))
             return 0;
     }
 
@@ -350,17 +419,39 @@ static inline size_t DoWriteT<UCS2>(const CefString& str, size_t len, char*& buf
 template <>
 static inline CefRefPtr<CefV8Value> DoSliceT<UTF8>(const char* buf, size_t len)
 {
-#ifdef CEF_STRING_TYPE_UTF8
+#if defined(CEF_STRING_TYPE_UTF16)
+    // never more characters than bytes
+    std::vector<cef_char_t> dst(len);
+    const size_t strLen = Codec::Utf8Decode(buf, len, To<Codec::char16*>(&dst[0]));
+
+    return CefV8Value::CreateString(CefString(&dst[0], strLen, false));
+#elif defined(CEF_STRING_TYPE_UTF8)
     const CefString str(buf, len, false);
+    return CefV8Value::CreateString(str);
 #else
     const std::string str(buf, len);
-#endif // CEF_STRING_TYPE_UTF8
     return CefV8Value::CreateString(str);
+#endif
 }
 
 template <>
 static inline size_t DoWriteT<UTF8>(const CefString& str, size_t len, char*& buf)
 {
+#ifdef CEF_STRING_TYPE_UTF16
+    const Codec::char16* src = To<const Codec::char16*>(str.c_str());
+
+    if (buf == NULL) { // auto allocation
+        const size_t size = Codec::Utf8Length(src, str.length());
+
+        if (size < len)
+            len = size;
+
+        if (!(buf = static_cast<char*>(Allocator::Allocate(len))))
+            return 0;
+    }
+
+    return Codec::Utf8Encode(src, str.length(), buf, len);
+#else
 #ifdef CEF_STRING_TYPE_UTF8
     const CefString& cvt = str;
 #else
@@ -373,13 +464,14 @@ static inline size_t DoWriteT<UTF8>(const CefString& str, size_t len, char*& buf
         len = strLen;
 
     if (buf == NULL) { // auto allocation
-        if (!(buf = static_cast<char*>(malloc(len))))
+        if (!(buf = static_cast<char*>(Allocator::Allocate(len))))
             return 0;
     }
 
     memcpy(buf, cvt.c_str(), len);
 
     return len;
+#endif // CEF_STRING_TYPE_UTF16
 }
 
 template <Encoding E>
@@ -436,6 +528,119 @@ static inline void WriteT(CefRefPtr<CefV8Value> object, const CefV8ValueList& ar
 }
 
 
+// repeats the pattern over len bytes, doubling the copied part every time
+static inline void FillPattern(char* dst, size_t len, const char* pattern, size_t size)
+{
+    if (size == 0 || len == 0)
+        return;
+
+    memcpy(dst, pattern, Min(size, len));
+
+    size_t filled = Min(size, len);
+
+    while (filled < len - filled) {
+        memcpy(dst + filled, dst, filled);
+        filled *= 2;
+    }
+
+    if (filled < len)
+        memcpy(dst + filled, dst, len - filled);
+}
+
+template <class T>
+struct NumberTraits {
+    // integers wrap around like the typed array conversions, NaN and
+    // infinities are 0, converted within 2^64 so the casts are defined
+    static inline T FromDouble(double value) {
+        if (value != value || value == HUGE_VAL || value == -HUGE_VAL)
+            return 0;
+
+        const double mod = fmod(value, 18446744073709551616.0); // exact
+        return T(mod < 0 ? 0 - uint64_t(-mod) : uint64_t(mod));
+    }
+};
+
+template <>
+struct NumberTraits<float> {
+    static inline float FromDouble(double value) { return float(value); }
+};
+
+template <>
+struct NumberTraits<double> {
+    static inline double FromDouble(double value) { return value; }
+};
+
+// memcpy() keeps unaligned offsets safe on every platform
+template <class T, Environment::Endianness E>
+static inline T LoadNumber(const char* data)
+{
+    T value;
+    memcpy(&value, data, sizeof(T));
+    if (E != Environment::GetEndianness())
+        ReverseArray(To<char*>(&value), sizeof(T));
+
+    return value;
+}
+
+template <class T, Environment::Endianness E>
+static inline void StoreNumber(char* data, T value)
+{
+    if (E != Environment::GetEndianness())
+        ReverseArray(To<char*>(&value), sizeof(T));
+    memcpy(data, &value, sizeof(T));
+}
+
+template <Environment::Endianness E, bool SIGNED>
+static inline double LoadInteger(const char* data, size_t size)
+{
+    switch (size) {
+    case 1: return SIGNED ? double(LoadNumber<int8_t, E>(data))
+                          : double(LoadNumber<uint8_t, E>(data));
+    case 2: return SIGNED ? double(LoadNumber<int16_t, E>(data))
+                          : double(LoadNumber<uint16_t, E>(data));
+    case 4: return SIGNED ? double(LoadNumber<int32_t, E>(data))
+                          : double(LoadNumber<uint32_t, E>(data));
+    case 8: return SIGNED ? double(LoadNumber<int64_t, E>(data))
+                          : double(LoadNumber<uint64_t, E>(data));
+    }
+
+    // odd widths: 3, 5, 6 and 7 bytes
+    const unsigned char* bytes = To<const unsigned char*>(data);
+    uint64_t value = 0;
+
+    for (size_t i = 0; i < size; ++i) {
+        const size_t k = E == Environment::LITTLE_ENDIAN ? i : size - 1 - i;
+        value |= uint64_t(bytes[k]) << (8 * i);
+    }
+
+    if (SIGNED && (value >> (8 * size - 1)) & 1)
+        value |= ~uint64_t(0) << (8 * size); // sign extension
+
+    return SIGNED ? double(int64_t(value)) : double(value);
+}
+
+// stores the low size bytes of the two's complement value, which is the
+// same for signed and unsigned integers
+template <Environment::Endianness E>
+static inline void StoreInteger(char* data, size_t size, double number)
+{
+    const uint64_t value = NumberTraits<uint64_t>::FromDouble(number);
+
+    switch (size) {
+    case 1: return StoreNumber<uint8_t, E>(data, uint8_t(value));
+    case 2: return StoreNumber<uint16_t, E>(data, uint16_t(value));
+    case 4: return StoreNumber<uint32_t, E>(data, uint32_t(value));
+    case 8: return StoreNumber<uint64_t, E>(data, value);
+    }
+
+    unsigned char* bytes = To<unsigned char*>(data);
+
+    for (size_t i = 0; i < size; ++i) {
+        const size_t k = E == Environment::LITTLE_ENDIAN ? i : size - 1 - i;
+        bytes[k] = static_cast<unsigned char>(value >> (8 * i));
+    }
+}
+
 template <class T, Environment::Endianness E>
 static inline void ReadNumberT(const CefV8ValueList& args,
                                CefRefPtr<CefV8Value>& retval, CefString& except)
@@ -449,13 +654,10 @@ static inline void ReadNumberT(const CefV8ValueList& args,
 
     const unsigned offset = args[1]->GetUIntValue();
 
-    NCJS_CHK_LE(offset + sizeof(T), buf->Size());
-
-    T value = *To<T*>(buf->Data() + offset);
-    if (E != Environment::GetEndianness())
-        ReverseArray(To<char*>(&value), sizeof(T));
+    if (offset > buf->Size() || sizeof(T) > buf->Size() - offset)
+        return INDEX_ERROR;
 
-    retval = CefV8Value::CreateDouble(value);
+    retval = CefV8Value::CreateDouble(LoadNumber<T, E>(buf->Data() + offset));
 }
 
 template <class T, Environment::Endianness E>
@@ -471,16 +673,116 @@ static inline void WriteNumberT(const CefV8ValueList& args,
 
     const unsigned offset = args[2]->GetUIntValue();
 
-    NCJS_CHK_LE(offset + sizeof(T), buf->Size());
+    if (offset > buf->Size() || sizeof(T) > buf->Size() - offset)
+        return INDEX_ERROR;
 
-    char* value = buf->Data() + offset;
-    *To<T*>(value) = T(args[1]->GetDoubleValue());
-    if (E != Environment::GetEndianness())
-        ReverseArray(value, sizeof(T));
+    StoreNumber<T, E>(buf->Data() + offset, NumberTraits<T>::FromDouble(args[1]->GetDoubleValue()));
 
     retval = CefV8Value::CreateUInt(sizeof(T));
 }
 
+template <Environment::Endianness E, bool SIGNED>
+static inline void ReadIntegerT(const CefV8ValueList& args,
+                                CefRefPtr<CefV8Value>& retval, CefString& except)
+{
+    NCJS_CHK_GE(args.size(), 3);
+
+    Buffer* buf = Buffer::Unwrap(args[0]);
+
+    if (buf == NULL)
+        return BUFFER_ERROR;
+
+    const unsigned offset = args[1]->GetUIntValue();
+    const unsigned size = args[2]->GetUIntValue();
+
+    if (size < 1 || size > 8)
+        return INDEX_ERROR;
+
+    if (offset > buf->Size() || size > buf->Size() - offset)
+        return INDEX_ERROR;
+
+    retval = CefV8Value::CreateDouble(LoadInteger<E, SIGNED>(buf->Data() + offset, size));
+}
+
+template <Environment::Endianness E>
+static inline void WriteIntegerT(const CefV8ValueList& args,
+                                 CefRefPtr<CefV8Value>& retval, CefString& except)
+{
+    NCJS_CHK_GE(args.size(), 4);
+
+    Buffer* buf = Buffer::Unwrap(args[0]);
+
+    if (buf == NULL)
+        return BUFFER_ERROR;
+
+    const unsigned offset = args[2]->GetUIntValue();
+    const unsigned size = args[3]->GetUIntValue();
+
+    if (size < 1 || size > 8)
+        return INDEX_ERROR;
+
+    if (offset > buf->Size() || size > buf->Size() - offset)
+        return INDEX_ERROR;
+
+    StoreInteger<E>(buf->Data() + offset, size, args[1]->GetDoubleValue());
+
+    retval = CefV8Value::CreateUInt(size);
+}
+
+template <class T, Environment::Endianness E>
+static void ReadArrayT(const char* data, unsigned count, unsigned stride,
+                       CefRefPtr<CefV8Value> array)
+{
+    for (unsigned i = 0; i < count; ++i, data += stride)
+        array->SetValue(int(i), CefV8Value::CreateDouble(double(LoadNumber<T, E>(data))));
+}
+
+typedef void (*ReadArrayFunc)(const char*, unsigned, unsigned, CefRefPtr<CefV8Value>);
+
+struct ArrayType {
+    const char* name;
+    unsigned size;
+    ReadArrayFunc read;
+};
+
+#define ARRAY_TYPE(_NAME, _TYPE, _ENDIAN) \
+        { _NAME, sizeof(_TYPE), &ReadArrayT<_TYPE, Environment::_ENDIAN> }
+
+static const ArrayType ARRAY_TYPES[] = {
+    ARRAY_TYPE("Int8",      int8_t,     LITTLE_ENDIAN),
+    ARRAY_TYPE("UInt8",     uint8_t,    LITTLE_ENDIAN),
+    ARRAY_TYPE("Int16LE",   int16_t,    LITTLE_ENDIAN),
+    ARRAY_TYPE("Int16BE",   int16_t,    BIG_ENDIAN),
+    ARRAY_TYPE("UInt16LE",  uint16_t,   LITTLE_ENDIAN),
+    ARRAY_TYPE("UInt16BE",  uint16_t,   BIG_ENDIAN),
+    ARRAY_TYPE("Int32LE",   int32_t,    LITTLE_ENDIAN),
+    ARRAY_TYPE("Int32BE",   int32_t,    BIG_ENDIAN),
+    ARRAY_TYPE("UInt32LE",  uint32_t,   LITTLE_ENDIAN),
+    ARRAY_TYPE("UInt32BE",  uint32_t,   BIG_ENDIAN),
+    ARRAY_TYPE("Int64LE",   int64_t,    LITTLE_ENDIAN),
+    ARRAY_TYPE("Int64BE",   int64_t,    BIG_ENDIAN),
+    ARRAY_TYPE("UInt64LE",  uint64_t,   LITTLE_ENDIAN),
+    ARRAY_TYPE("UInt64BE",  uint64_t,   BIG_ENDIAN),
+    ARRAY_TYPE("FloatLE",   float,      LITTLE_ENDIAN),
+    ARRAY_TYPE("FloatBE",   float,      BIG_ENDIAN),
+    ARRAY_TYPE("DoubleLE",  double,     LITTLE_ENDIAN),
+    ARRAY_TYPE("DoubleBE",  double,     BIG_ENDIAN)
+};
+
+#undef ARRAY_TYPE
+
+static inline const ArrayType* FindArrayType(const CefString& name)
+{
+    const std::string str = name.ToString();
+
+    for (size_t i = 0; i < ArraySize(ARRAY_TYPES); ++i) {
+        if (!str.compare(ARRAY_TYPES[i].name))
+            return &ARRAY_TYPES[i];
+    }
+
+    return NULL;
+}
+
 inline Buffer* Buffer::SubBuffer(size_t offset, size_t size) const
 {
     NCJS_ASSERT(offset + size < m_size);
@@ -527,7 +829,7 @@ inline Buffer* Buffer::Create(CefRefPtr<Environment> env, size_t size)
 
     Environment::BufferObjectInfo& info = env->GetBufferObjectInfo();
 
-    void* buffer = info.NoZeroFill() ? malloc(size) : calloc(size, 1);
+    void* buffer = Allocator::Allocate(size, !info.NoZeroFill());
     info.ResetFillFlag();
 
     return buffer ? new Buffer(static_cast<char*>(buffer), size) : NULL;
@@ -538,7 +840,7 @@ inline Buffer* Buffer::Create(size_t size)
     if (size == 0)
         return EMPTY_BUFFER;
 
-    void* buffer = static_cast<char*>(malloc(size));
+    void* buffer = Allocator::Allocate(size);
     return buffer ? new Buffer(static_cast<char*>(buffer), size) : NULL;
 }
 
@@ -565,6 +867,21 @@ Buffer* Buffer::Create(const CefString& str, const CefString& encoding)
     return Create(str, ParseEncoding(encoding, UTF8));
 }
 
+#ifdef NCJS_BUFFER_VIEW
+// keeps the native buffer alive until V8 collects the ArrayBuffer
+class BufferReleaser : public CefV8ArrayBufferReleaseCallback {
+public:
+    explicit BufferReleaser(Buffer* buffer) : m_buffer(buffer) {}
+
+    virtual void ReleaseBuffer(void* buffer) OVERRIDE { m_buffer = NULL; }
+
+private:
+    CefRefPtr<Buffer> m_buffer;
+
+    IMPLEMENT_REFCOUNTING(BufferReleaser);
+};
+#endif // NCJS_BUFFER_VIEW
+
 inline void WrapBuffer(Buffer* buffer, CefRefPtr<CefV8Value>& value)
 {
     if (buffer) {
@@ -573,6 +890,36 @@ inline void WrapBuffer(Buffer* buffer, CefRefPtr<CefV8Value>& value)
     }
 }
 
+Buffer* Buffer::Adopt(char* data, size_t size)
+{
+    if (size == 0) {
+        Allocator::Free(data);
+        return EMPTY_BUFFER;
+    }
+
+    return new Buffer(data, size);
+}
+
+Buffer* Buffer::Adopt(const CefRefPtr<MappedFile>& mapping)
+{
+    return new Buffer(mapping);
+}
+
+CefRefPtr<CefV8Value> Buffer::NewObject(Buffer* buffer)
+{
+    CefRefPtr<CefV8Value> value = CefV8Value::CreateUndefined();
+    WrapBuffer(buffer, value);
+    return value;
+}
+
+#ifdef NCJS_BUFFER_VIEW
+CefRefPtr<CefV8Value> Buffer::NewArrayBuffer(Buffer* buffer)
+{
+    return CefV8Value::CreateArrayBuffer(buffer->Data(), buffer->Size(),
+                                         new BufferReleaser(buffer));
+}
+#endif // NCJS_BUFFER_VIEW
+
 /// ----------------------------------------------------------------------------
 /// accessors
 /// ----------------------------------------------------------------------------
@@ -804,6 +1151,20 @@ class BindingObject : public JsObjecT<BindingObject> {
         }
     }
 
+#ifdef NCJS_BUFFER_VIEW
+    // arrayBuffer(), shares memory with the buffer
+    NCJS_OBJECT_FUNCTION(GetArrayBuffer)(CefRefPtr<CefV8Value> object,
+        const CefV8ValueList& args, CefRefPtr<CefV8Value>& retval, CefString& except)
+    {
+        Buffer* buf = Buffer::Unwrap(object);
+
+        if (buf == NULL)
+            return BUFFER_ERROR;
+
+        retval = Buffer::NewArrayBuffer(buf);
+    }
+#endif // NCJS_BUFFER_VIEW
+
     // object builder
 
     NCJS_BEGIN_OBJECT_BUILDER()
@@ -812,6 +1173,9 @@ class BindingObject : public JsObjecT<BindingObject> {
         NCJS_MAP_OBJECT_FUNCTION("subarray", SubArray)
         NCJS_MAP_OBJECT_FUNCTION("setAt", SetAt)
         NCJS_MAP_OBJECT_FUNCTION("getAt", GetAt)
+#ifdef NCJS_BUFFER_VIEW
+        NCJS_MAP_OBJECT_FUNCTION("arrayBuffer", GetArrayBuffer)
+#endif
         // accessors
         NCJS_MAP_OBJECT_ACCESSOR("flags", FlagsAccessor)
     NCJS_END_OBJECT_BUILDER()
@@ -843,11 +1207,14 @@ class ModuleBuffer : public JsObjecT<ModuleBuffer> {
     {
         NCJS_CHECK(NCJS_ARG_IS(String, args, 0));
 
-#ifdef CEF_STRING_TYPE_UTF8
+#if defined(CEF_STRING_TYPE_UTF16)
+        const CefString str = args[0]->GetStringValue();
+        const size_t len = Codec::Utf8Length(To<const Codec::char16*>(str.c_str()), str.length());
+#elif defined(CEF_STRING_TYPE_UTF8)
         const size_t len = args[0]->GetStringValue().length();
 #else
         const size_t len = args[0]->GetStringValue().ToString().length();
-#endif // CEF_STRING_TYPE_UTF8
+#endif
 
         retval = CefV8Value::CreateUInt(unsigned(len));
     }
@@ -899,7 +1266,11 @@ class ModuleBuffer : public JsObjecT<ModuleBuffer> {
             const int value = args[1]->GetUIntValue() & 0xFF;
             memset(buf->Data() + start, value, len);
             return;
-        } // else string
+        }
+
+        // a buffer holding the pattern in another encoding
+        if (Buffer* pattern = Buffer::Unwrap(args[1]))
+            return FillPattern(buf->Data() + start, len, pattern->Data(), pattern->Size());
 
 #ifdef CEF_STRING_TYPE_UTF8
         const CefString str = args[1]->GetStringValue();
@@ -907,27 +1278,7 @@ class ModuleBuffer : public JsObjecT<ModuleBuffer> {
         const std::string str = args[1]->GetStringValue().ToString();
 #endif // CEF_STRING_TYPE_UTF8
 
-        if (str.length() == 0)
-            return;
-
-        memcpy(buf->Data() + start, str.c_str(), Min(str.length(), len));
-
-        if (str.length() >= len)
-            return;
-
-        size_t filled = str.length();
-        char* src = buf->Data() + start;
-        char* dst = src + filled;
-        while (filled < len - filled) {
-            memcpy(dst, src, filled);
-            dst += filled;
-            filled *= 2;
-        }
-
-        if (filled < len) {
-            memcpy(dst, src, len - filled);
-            filled = len;
-        }
+        FillPattern(buf->Data() + start, len, str.c_str(), str.length());
     }
 
     // buffer.indexOfBuffer()
@@ -1064,6 +1415,142 @@ class ModuleBuffer : public JsObjecT<ModuleBuffer> {
         WriteNumberT<float, Environment::LITTLE_ENDIAN>(args, retval, except);
     }
 
+    // buffer.readIntBE()
+    NCJS_OBJECT_FUNCTION(ReadIntBE)(CefRefPtr<CefV8Value> object,
+        const CefV8ValueList& args, CefRefPtr<CefV8Value>& retval, CefString& except)
+    {
+        ReadIntegerT<Environment::BIG_ENDIAN, true>(args, retval, except);
+    }
+
+    // buffer.readIntLE()
+    NCJS_OBJECT_FUNCTION(ReadIntLE)(CefRefPtr<CefV8Value> object,
+        const CefV8ValueList& args, CefRefPtr<CefV8Value>& retval, CefString& except)
+    {
+        ReadIntegerT<Environment::LITTLE_ENDIAN, true>(args, retval, except);
+    }
+
+    // buffer.readUIntBE()
+    NCJS_OBJECT_FUNCTION(ReadUIntBE)(CefRefPtr<CefV8Value> object,
+        const CefV8ValueList& args, CefRefPtr<CefV8Value>& retval, CefString& except)
+    {
+        ReadIntegerT<Environment::BIG_ENDIAN, false>(args, retval, except);
+    }
+
+    // buffer.readUIntLE()
+    NCJS_OBJECT_FUNCTION(ReadUIntLE)(CefRefPtr<CefV8Value> object,
+        const CefV8ValueList& args, CefRefPtr<CefV8Value>& retval, CefString& except)
+    {
+        ReadIntegerT<Environment::LITTLE_ENDIAN, false>(args, retval, except);
+    }
+
+    // buffer.writeIntBE(), buffer.writeUIntBE()
+    NCJS_OBJECT_FUNCTION(WriteIntBE)(CefRefPtr<CefV8Value> object,
+        const CefV8ValueList& args, CefRefPtr<CefV8Value>& retval, CefString& except)
+    {
+        WriteIntegerT<Environment::BIG_ENDIAN>(args, retval, except);
+    }
+
+    // buffer.writeIntLE(), buffer.writeUIntLE()
+    NCJS_OBJECT_FUNCTION(WriteIntLE)(CefRefPtr<CefV8Value> object,
+        const CefV8ValueList& args, CefRefPtr<CefV8Value>& retval, CefString& except)
+    {
+        WriteIntegerT<Environment::LITTLE_ENDIAN>(args, retval, except);
+    }
+
+    // buffer.readArray(buffer, type, offset, count, stride)
+    NCJS_OBJECT_FUNCTION(ReadArray)(CefRefPtr<CefV8Value> object,
+        const CefV8ValueList& args, CefRefPtr<CefV8Value>& retval, CefString& except)
+    {
+        NCJS_CHK_GE(args.size(), 5);
+
+        Buffer* buf = Buffer::Unwrap(args[0]);
+
+        if (buf == NULL)
+            return BUFFER_ERROR;
+
+        const ArrayType* type = FindArrayType(args[1]->GetStringValue());
+
+        if (type == NULL)
+            return Environment::TypeException(NCJS_TEXT("Unknown array type"), except);
+
+        const unsigned offset = args[2]->GetUIntValue();
+        const unsigned count  = args[3]->GetUIntValue();
+        const unsigned stride = args[4]->GetUIntValue();
+
+        if (count) {
+            const uint64_t end = uint64_t(offset) + uint64_t(count - 1) * stride + type->size;
+            if (end > buf->Size())
+                return INDEX_ERROR;
+        }
+
+        retval = CefV8Value::CreateArray(int(count));
+        type->read(buf->Data() + offset, count, stride, retval);
+    }
+
+    // buffer.getAllocatorStats()
+    NCJS_OBJECT_FUNCTION(GetAllocatorStats)(CefRefPtr<CefV8Value> object,
+        const CefV8ValueList& args, CefRefPtr<CefV8Value>& retval, CefString& except)
+    {
+        // allocations per second since the previous call, from any context
+        static double s_lastAllocations = 0;
+        static uint64_t s_lastTime = 0;
+
+        const unsigned count = Allocator::GetClassCount();
+        CefRefPtr<CefV8Value> classes = CefV8Value::CreateArray(int(count));
+        Allocator::Stats total = Allocator::Stats();
+
+        for (unsigned i = 0; i < count; ++i) {
+            Allocator::Stats stats;
+            Allocator::GetStats(i, stats);
+
+            CefRefPtr<CefV8Value> cls = CefV8Value::CreateObject(NULL);
+            NCJS_PROPERTY(UInt,   cls, NCJS_REFTEXT("blockSize"),   unsigned(stats.blockSize));
+            NCJS_PROPERTY(UInt,   cls, NCJS_REFTEXT("slabs"),       stats.slabs);
+            NCJS_PROPERTY(UInt,   cls, NCJS_REFTEXT("used"),        stats.used);
+            NCJS_PROPERTY(UInt,   cls, NCJS_REFTEXT("free"),        stats.free);
+            NCJS_PROPERTY(UInt,   cls, NCJS_REFTEXT("mapped"),      stats.mapped);
+            NCJS_PROPERTY(UInt,   cls, NCJS_REFTEXT("highWater"),   stats.highWater);
+            NCJS_PROPERTY(Double, cls, NCJS_REFTEXT("allocations"), stats.allocations);
+            NCJS_PROPERTY(Double, cls, NCJS_REFTEXT("frees"),       stats.frees);
+            NCJS_PROPERTY(Double, cls, NCJS_REFTEXT("requested"),   stats.requested);
+            NCJS_PROPERTY(Double, cls, NCJS_REFTEXT("reserved"),    stats.reserved);
+            classes->SetValue(int(i), cls);
+
+            total.slabs += stats.slabs;
+            total.used += stats.used;
+            total.mapped += stats.mapped;
+            total.allocations += stats.allocations;
+            total.frees += stats.frees;
+            total.requested += stats.requested;
+            total.reserved += stats.reserved;
+        }
+
+        const uint64_t now = uv_hrtime();
+        const double rate = s_lastTime ?
+            (total.allocations - s_lastAllocations) * 1e9 / double(now - s_lastTime) : 0;
+
+        s_lastAllocations = total.allocations;
+        s_lastTime = now;
+
+        retval = CefV8Value::CreateObject(NULL);
+        NCJS_PROPERTY(String, retval, NCJS_REFTEXT("mode"),
+                      Allocator::GetModeName(Allocator::GetMode()));
+        NCJS_PROPERTY(UInt,   retval, NCJS_REFTEXT("slabs"),       total.slabs);
+        NCJS_PROPERTY(UInt,   retval, NCJS_REFTEXT("used"),        total.used);
+        NCJS_PROPERTY(UInt,   retval, NCJS_REFTEXT("mapped"),      total.mapped);
+        NCJS_PROPERTY(Double, retval, NCJS_REFTEXT("mapThreshold"),
+                      double(Allocator::GetMapThreshold()));
+        NCJS_PROPERTY(Double, retval, NCJS_REFTEXT("allocations"), total.allocations);
+        NCJS_PROPERTY(Double, retval, NCJS_REFTEXT("frees"),       total.frees);
+        NCJS_PROPERTY(Double, retval, NCJS_REFTEXT("rate"),        rate);
+        NCJS_PROPERTY(Double, retval, NCJS_REFTEXT("requested"),   total.requested);
+        NCJS_PROPERTY(Double, retval, NCJS_REFTEXT("reserved"),    total.reserved);
+        // share of the reserved memory not asked for by the blocks in use
+        NCJS_PROPERTY(Double, retval, NCJS_REFTEXT("fragmentation"),
+                      total.reserved ? 1 - total.requested / total.reserved : 0);
+        retval->SetValue(NCJS_REFTEXT("classes"), classes, V8_PROPERTY_ATTRIBUTE_NONE);
+    }
+
     // buffer.setupBufferJS()
     NCJS_OBJECT_FUNCTION(SetupBufferJS)(CefRefPtr<CefV8Value> object,
         const CefV8ValueList& args, CefRefPtr<CefV8Value>& retval, CefString& except)
@@ -1086,6 +1573,7 @@ class ModuleBuffer : public JsObjecT<ModuleBuffer> {
         // constants
         NCJS_MAP_OBJECT_READONLY(Int, "kMaxLength",               MAX_LENGTH)
         NCJS_MAP_OBJECT_READONLY(Int, "kStringMaxLength",  STRING_MAX_LENGTH)
+        NCJS_MAP_OBJECT_READONLY(String, "codecLevel", Codec::GetLevelName(Codec::GetLevel()))
 
         // functions
         NCJS_MAP_OBJECT_FUNCTION("setupBufferJS", SetupBufferJS)
@@ -1108,6 +1596,18 @@ class ModuleBuffer : public JsObjecT<ModuleBuffer> {
         NCJS_MAP_OBJECT_FUNCTION("writeDoubleLE", WriteDoubleLE)
         NCJS_MAP_OBJECT_FUNCTION("writeFloatBE",  WriteFloatBE)
         NCJS_MAP_OBJECT_FUNCTION("writeFloatLE",  WriteFloatLE)
+
+        NCJS_MAP_OBJECT_FUNCTION("readIntBE",  ReadIntBE)
+        NCJS_MAP_OBJECT_FUNCTION("readIntLE",  ReadIntLE)
+        NCJS_MAP_OBJECT_FUNCTION("readUIntBE", ReadUIntBE)
+        NCJS_MAP_OBJECT_FUNCTION("readUIntLE", ReadUIntLE)
+
+        NCJS_MAP_OBJECT_FUNCTION("writeIntBE", WriteIntBE)
+        NCJS_MAP_OBJECT_FUNCTION("writeIntLE", WriteIntLE)
+
+        NCJS_MAP_OBJECT_FUNCTION("readArray",  ReadArray)
+
+        NCJS_MAP_OBJECT_FUNCTION("getAllocatorStats", GetAllocatorStats)
     NCJS_END_OBJECT_FACTORY()
 
 };
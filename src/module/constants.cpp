@@ -20,6 +20,7 @@
 
 #include "ncjs/module.h"
 #include "ncjs/string.h"
+#include "ncjs/module/fs.h"
 
 #include <uv.h>
 
@@ -1138,6 +1139,10 @@ void DefineSystemConstants(CefRefPtr<Environment> env, CefRefPtr<CefV8Context> c
 #ifdef X_OK
   NCJS_PROPERTY_CONST_AUTO(Double, target, X_OK);
 #endif
+
+  NCJS_PROPERTY_CONST_AUTO(Double, target, COPYFILE_EXCL);
+  NCJS_PROPERTY_CONST_AUTO(Double, target, COPYFILE_FICLONE);
+  NCJS_PROPERTY_CONST_AUTO(Double, target, COPYFILE_FICLONE_FORCE);
 }
 
 void DefineUVConstants(CefRefPtr<Environment> env, CefRefPtr<CefV8Context> ctx,
@@ -15,16 +15,30 @@
 #define _WINSOCKAPI_    // stops windows.h including winsock.h
 
 #define ASYNC_DEST_CALL(_FUNCTION, _REQ, _DEST, ...) \
-    EventLoop& _loop = Environment::GetAsyncLoop(); \
+    GET_ASYNC_LOOP(_loop); \
     CefRefPtr<AsyncReqWrap> _wrap(new AsyncReqWrap(_loop, #_FUNCTION, _DEST, _REQ)); \
-    AsyncCall<&uv_fs_##_FUNCTION>(_loop, _wrap, &uv_fs_##_FUNCTION, __VA_ARGS__); \
+    _wrap->SetDrops(DropsCached<&uv_fs_##_FUNCTION>(0)); \
+    AsyncCall<&uv_fs_##_FUNCTION>(_wrap, &uv_fs_##_FUNCTION, __VA_ARGS__); \
     retval = _REQ
 
 #define ASYNC_CALL(_FUNCTION, _REQ, ...) \
     ASYNC_DEST_CALL(_FUNCTION, _REQ, NULL, __VA_ARGS__)
 
+// goes to the io_uring of the loop if there is one, the thread pool otherwise
+#define ASYNC_IO_CALL(_FUNCTION, _REQ, _IO, ...) \
+    GET_ASYNC_LOOP(_loop); \
+    CefRefPtr<AsyncReqWrap> _wrap(new AsyncReqWrap(_loop, #_FUNCTION, NULL, _REQ)); \
+    const IoRequest _io(_IO); \
+    _wrap->SetDrops(DropsCached<&uv_fs_##_FUNCTION>(_io.flags)); \
+    if (!_wrap->Submit<&uv_fs_##_FUNCTION>(_loop, _io)) \
+        AsyncCall<&uv_fs_##_FUNCTION>(_wrap, &uv_fs_##_FUNCTION, __VA_ARGS__); \
+    retval = _REQ
+
 #define ASYNC_HOLD_DATA(_DATA) _wrap->HoldData(_DATA)
 
+// completions always run after the binding returned
+#define ASYNC_SHARE_STATS(_SHARE) _wrap->ShareStats(_SHARE)
+
 #define SYNC_DEST_CALL(_FUNCTION, _PATH, _DEST, ...) \
     SyncReqWrap _req; \
     int _err = uv_fs_##_FUNCTION(Environment::GetSyncLoop(), \
@@ -42,6 +56,17 @@
 #define   RANGE_ERROR(_MSG) Environment::RangeException(NCJS_TEXT(_MSG), except)
 #define UNKNOWN_ERROR(_MSG) Environment::ErrorException(NCJS_TEXT(_MSG), except)
 
+// the environment is gone while its context is being released
+#define GET_ASYNC_LOOP(_LOOP) \
+    Environment* _env = Environment::Get(CefV8Context::GetCurrentContext()); \
+    if (_env == NULL) \
+        return UNKNOWN_ERROR("context has been released"); \
+    EventLoop& _LOOP = _env->GetAsyncLoop()
+
+// true asks the stat bindings to share the fields instead of a fs.Stats
+#define GET_PARAM_SHARE_STATS(_ARGS, _INDEX, _SHARE) \
+    const bool _SHARE = NCJS_ARG_IS(Bool, _ARGS, _INDEX) && _ARGS[_INDEX]->GetBoolValue()
+
 #define GET_OFFSET(_VAL) ((_VAL)->IsInt() ? (_VAL)->GetIntValue() : -1)
 
 #define GET_PARAM_FD(_ARGS, _FD) \
@@ -90,21 +115,58 @@
     const AutoString _SRC(_ARGS[0]->GetStringValue().ToString()); \
     const AutoString _DST(_ARGS[1]->GetStringValue().ToString())
 
+// offset and length within the buffer become a range of its mapping
+#define GET_PARAM_MAPPING(_ARGS, _MAPPING, _OFF, _LEN) \
+    Buffer* _buf = _ARGS.size() ? Buffer::Unwrap(_ARGS[0]) : NULL; \
+    if (!(_buf && (_MAPPING = _buf->GetMapping()))) \
+        return TYPE_ERROR("buffer must be made by fs.mmap()"); \
+    _OFF = _buf->IndexOffset(NCJS_ARG_IS(Int, _ARGS, 1) ? _ARGS[1]->GetIntValue() : 0); \
+    _LEN = _buf->Size() - _OFF; \
+    if (NCJS_ARG_IS(Int, _ARGS, 2) && _ARGS[2]->GetIntValue() >= 0) \
+        _LEN = Min(_LEN, size_t(_ARGS[2]->GetIntValue())); \
+    _OFF += size_t(_buf->Data() - _MAPPING->Data())
+
 /// ----------------------------------------------------------------------------
 /// headers
 /// ----------------------------------------------------------------------------
 
 #include "ncjs/module.h"
 #include "ncjs/constants.h"
+#include "ncjs/atomic.h"
 #include "ncjs/EventLoop.h"
+#include "ncjs/IoRing.h"
+#include "ncjs/CompletionQueue.h"
+#include "ncjs/ThreadPool.h"
+#include "ncjs/Archive.h"
+#include "ncjs/Codec.h"
+#include "ncjs/MappedFile.h"
+#include "ncjs/ModuleResolver.h"
+#include "ncjs/SourceCache.h"
 #include "ncjs/module/fs.h"
 #include "ncjs/module/buffer.h"
 
 #include <include/base/cef_bind.h>
-#include <include/wrapper/cef_closure_task.h>
 #include <uv.h>
 
 #include <fcntl.h>
+#include <limits>
+#include <string.h>
+
+#ifdef __linux__
+#include <errno.h>
+#include <linux/fs.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#ifndef FICLONE
+#define FICLONE _IOW(0x94, 9, int)
+#endif
+#endif // __linux__
+
+#include <deque>
+#include <set>
+#include <sstream>
 
 namespace ncjs {
 
@@ -112,6 +174,10 @@ namespace ncjs {
 /// variables
 /// ----------------------------------------------------------------------------
 
+// buffer.kMaxLength, the largest mapping one Buffer can hold
+static const double MAX_MAP_LENGTH =
+    sizeof(int32_t) == sizeof(intptr_t) ? 0x3fffffff : 0x7fffffff;
+
 class AutoString : public std::string {
 public:
     AutoString(const char* str) { if (str) assign(str); }
@@ -130,6 +196,19 @@ private:
     IMPLEMENT_REFCOUNTING(AutoUvBuffer);
 };
 
+// drops the resolver entries a successful call left stale, never all of them
+static inline void DropCached(const char* path, bool subtree = true)
+{
+    if (path && *path)
+        ModuleResolver::Invalidate(path, subtree);
+}
+
+// only writers leave the package.json "main" fields stale
+static inline bool OpensForWrite(int flags)
+{
+    return (flags & (O_WRONLY | O_RDWR)) != 0;
+}
+
 struct SyncReqWrap {
     uv_fs_t req;
 
@@ -139,33 +218,58 @@ struct SyncReqWrap {
     DISALLOW_COPY_AND_ASSIGN(SyncReqWrap);
 };
 
+// requests run synchronously on a ThreadPool worker, or in an io_uring
 class AsyncReqWrap : public CefBase {
-
-    template <void* T> struct After;
-
 public:
     template <void* T, class F, class P1>
     void Run(const P1& p1)
     {
-        Dispatch(static_cast<F>(T)(loop, &req, p1, &After<T>::Entry));
+        Dispatch<T>(static_cast<F>(T)(loop, &req, p1, NULL));
     }
 
     template <void* T, class F, class P1, class P2>
     void Run(const P1& p1, const P2& p2)
     {
-        Dispatch(static_cast<F>(T)(loop, &req, p1, p2, &After<T>::Entry));
+        Dispatch<T>(static_cast<F>(T)(loop, &req, p1, p2, NULL));
     }
 
     template <void* T, class F, class P1, class P2, class P3>
     void Run(const P1& p1, const P2& p2, const P3& p3)
     {
-        Dispatch(static_cast<F>(T)(loop, &req, p1, p2, p3, &After<T>::Entry));
+        Dispatch<T>(static_cast<F>(T)(loop, &req, p1, p2, p3, NULL));
     }
 
     template <void* T, class F, class P1, class P2, class P3, class P4>
     void Run(const P1& p1, const P2& p2, const P3& p3, const P4& p4)
     {
-        Dispatch(static_cast<F>(T)(loop, &req, p1, p2, p3, p4, &After<T>::Entry));
+        Dispatch<T>(static_cast<F>(T)(loop, &req, p1, p2, p3, p4, NULL));
+    }
+
+    // buffers of the request must be held until completion
+    template <void* T>
+    bool Submit(EventLoop& eventLoop, IoRequest io)
+    {
+        if (!(IoRing::IsEnabled() && IoRing::IsSupported(io)))
+            return false;
+
+        memset(&req, 0, sizeof(req));
+        path = io.path;
+
+        io.stat = &req.statbuf;
+        io.callback = base::Bind(&AsyncReqWrap::OnIo<T>, this);
+
+        return eventLoop.QueueIo(io);
+    }
+
+    // completes without running, the thread pool didn't take the request
+    void Cancel()
+    {
+        memset(&req, 0, sizeof(req));
+
+        // keep alive, must call Release manually
+        req.data = this; AddRef();
+        req.result = UV_ECANCELED;
+        CompletionQueue::Post(context, base::Bind(&AsyncReqWrap::OnError, this));
     }
 
     void HoldData(const CefRefPtr<CefBase>& lifeSpanData)
@@ -173,40 +277,69 @@ public:
         data = lifeSpanData;
     }
 
+    // fs.Stats go to the shared values of the environment if it has them
+    void ShareStats(bool share)
+    {
+        shareStats = share;
+    }
+
+    // DROP_* flags of the paths to drop from the resolver once succeeded
+    void SetDrops(unsigned which)
+    {
+        drops = which;
+    }
+
+    enum { DROP_PATH = 1, DROP_DEST = 2, DROP_SUBTREE = 4 };
+
     AsyncReqWrap(EventLoop& eventLoop, const char* syscall, const AutoString& destPath,
         const CefRefPtr<CefV8Value>& reqWrap) :
-        loop(eventLoop.ToUv()), call(syscall), dest(destPath),
-        context(CefV8Context::GetCurrentContext()), wrap(reqWrap) {}
+        loop(eventLoop.ToUv()), call(syscall), dest(destPath), drops(0),
+        shareStats(false), context(CefV8Context::GetCurrentContext()), wrap(reqWrap) {}
     ~AsyncReqWrap() { uv_fs_req_cleanup(&req); }
 
 private:
 
+    template <void* T>
     void Dispatch(int result)
     {
+        // synchronous calls don't copy the path, it's gone with the task
+        path = req.path;
+
+        Complete<T>(result);
+    }
+
+    // called on the loop thread, results in the fields uv_fs_*() would set
+    template <void* T>
+    void OnIo(int result)
+    {
+        req.result = result;
+        req.ptr = &req.statbuf;
+
+        Complete<T>(result);
+    }
+
+    template <void* T>
+    void Complete(int result)
+    {
+        if (result >= 0 && drops) {
+            const bool subtree = (drops & DROP_SUBTREE) != 0;
+            if (drops & DROP_PATH)
+                DropCached(path, subtree);
+            if (drops & DROP_DEST)
+                DropCached(dest, subtree);
+        }
+
         // keep alive, must call Release manually
         req.data = this; AddRef();
 
         if (result < 0) {
             req.result = result;
-            CefPostTask(TID_RENDERER, base::Bind(&AsyncReqWrap::OnError, this));
+            CompletionQueue::Post(context, base::Bind(&AsyncReqWrap::OnError, this));
+        } else {
+            CompletionQueue::Post(context, base::Bind(&AsyncReqWrap::OnSuccess<T>, this));
         }
     }
 
-    template <void* T> struct After {
-        static void Entry(uv_fs_t* req)
-        {
-            AsyncReqWrap* wrap = static_cast<AsyncReqWrap*>(req->data);
-
-            NCJS_ASSERT(wrap);
-
-            if (req->result < 0) {
-                CefPostTask(TID_RENDERER, base::Bind(&AsyncReqWrap::OnError, wrap));
-            } else {
-                CefPostTask(TID_RENDERER, base::Bind(&AsyncReqWrap::OnSuccess<T>, wrap));
-            }
-        }
-    };
-
     template <void* T>
     void Success(Environment& env, CefV8ValueList& args) {}
 
@@ -234,15 +367,15 @@ private:
     }
     template <> void Success<&uv_fs_stat>(Environment& env, CefV8ValueList& args)
     {
-        args.push_back(BuildStatsObject(env, static_cast<uv_stat_t*>(req.ptr)));
+        args.push_back(BuildStatsObject(env, static_cast<uv_stat_t*>(req.ptr), 0, shareStats));
     }
     template <> void Success<&uv_fs_lstat>(Environment& env, CefV8ValueList& args)
     {
-        args.push_back(BuildStatsObject(env, static_cast<uv_stat_t*>(req.ptr)));
+        args.push_back(BuildStatsObject(env, static_cast<uv_stat_t*>(req.ptr), 0, shareStats));
     }
     template <> void Success<&uv_fs_fstat>(Environment& env, CefV8ValueList& args)
     {
-        args.push_back(BuildStatsObject(env, static_cast<uv_stat_t*>(req.ptr)));
+        args.push_back(BuildStatsObject(env, static_cast<uv_stat_t*>(req.ptr), 0, shareStats));
     }
     template <> void Success<&uv_fs_readlink>(Environment& env, CefV8ValueList& args)
     {
@@ -256,115 +389,1976 @@ private:
             uv_dirent_t ent;
             const int res = uv_fs_scandir_next(&req, &ent);
 
-            if (res == UV_EOF)
-                break;
-            if (res) {
-                CefString except;
-                CefV8ValueList str;
-                Environment::UvException(res, call, NULL,
-                    static_cast<const char*>(req.path), NULL, except);
-                str.push_back(CefV8Value::CreateString(except));
-                args.clear();
-                args.push_back(env.GetFunction().new_error->ExecuteFunction(NULL, str));
-                break;
-            }
+            if (res == UV_EOF)
+                break;
+            if (res) {
+                CefString except;
+                CefV8ValueList str;
+                Environment::UvException(res, call, NULL,
+                    path, NULL, except);
+                str.push_back(CefV8Value::CreateString(except));
+                args.clear();
+                args.push_back(env.GetFunction().new_error->ExecuteFunction(NULL, str));
+                break;
+            }
+
+            names->SetValue(i, CefV8Value::CreateString(ent.name));               
+        }
+
+        args.push_back(names);
+    }
+
+    // called by CompletionQueue with the context entered
+    template <void* T>
+    void OnSuccess(Environment* env)
+    {
+        if (env) {
+            CefV8ValueList args; // should have at least 1 argument
+            args.push_back(CefV8Value::CreateNull());
+            Success<T>(*env, args);
+            CefRefPtr<CefV8Value> callback = wrap->GetValue(consts::str_oncomplete);
+            callback->ExecuteFunction(wrap, args);
+        }
+        // really delete here
+        req.data = NULL; Release();
+    }
+
+    void OnError(Environment* env)
+    {
+        if (env) {
+            CefV8ValueList args;
+            CefString except;
+            Environment::UvException(int(req.result), call, NULL, path, dest, except);
+            args.push_back(CefV8Value::CreateString(except));
+            CefRefPtr<CefV8Value> callback = wrap->GetValue(consts::str_oncomplete);
+            callback->ExecuteFunction(wrap, args);
+        } // else context already released
+
+        // really delete here
+        req.data = NULL; Release();
+    }
+
+    /// Declarations
+    /// -----------------
+
+    uv_loop_t* loop;
+    uv_fs_t req;
+
+    const char* call;
+    AutoString path;
+    AutoString dest;
+    unsigned drops;
+    bool shareStats;
+
+    CefRefPtr<CefV8Context> context;
+    CefRefPtr<CefV8Value> wrap;
+
+    CefRefPtr<CefBase> data;
+
+    DISALLOW_COPY_AND_ASSIGN(AsyncReqWrap);
+    IMPLEMENT_REFCOUNTING(AsyncReqWrap);
+};
+
+// thread pool class of requests, metadata if not specialized
+template <void* T> inline ThreadPool::Class PoolClass() { return ThreadPool::METADATA; }
+
+template <> inline ThreadPool::Class PoolClass<&uv_fs_read>()      { return ThreadPool::DATA; }
+template <> inline ThreadPool::Class PoolClass<&uv_fs_write>()     { return ThreadPool::DATA; }
+template <> inline ThreadPool::Class PoolClass<&uv_fs_fsync>()     { return ThreadPool::SLOW; }
+template <> inline ThreadPool::Class PoolClass<&uv_fs_fdatasync>() { return ThreadPool::SLOW; }
+template <> inline ThreadPool::Class PoolClass<&uv_fs_ftruncate>() { return ThreadPool::SLOW; }
+template <> inline ThreadPool::Class PoolClass<&uv_fs_rename>()    { return ThreadPool::SLOW; }
+
+// resolver entries left stale by a request, none if not specialized
+template <void* T> inline unsigned DropsCached(int flags) { return 0; }
+
+template <> inline unsigned DropsCached<&uv_fs_unlink>(int)
+{
+    return AsyncReqWrap::DROP_PATH;
+}
+template <> inline unsigned DropsCached<&uv_fs_rmdir>(int)
+{
+    return AsyncReqWrap::DROP_PATH | AsyncReqWrap::DROP_SUBTREE;
+}
+template <> inline unsigned DropsCached<&uv_fs_rename>(int)
+{
+    return AsyncReqWrap::DROP_PATH | AsyncReqWrap::DROP_DEST | AsyncReqWrap::DROP_SUBTREE;
+}
+template <> inline unsigned DropsCached<&uv_fs_link>(int)
+{
+    return AsyncReqWrap::DROP_DEST;
+}
+template <> inline unsigned DropsCached<&uv_fs_symlink>(int)
+{
+    return AsyncReqWrap::DROP_DEST;
+}
+template <> inline unsigned DropsCached<&uv_fs_open>(int flags)
+{
+    return OpensForWrite(flags) ? AsyncReqWrap::DROP_PATH : 0;
+}
+
+template <void* T, class F, class P1>
+void AsyncCall(const CefRefPtr<AsyncReqWrap>& wrap, const F&, const P1& p1)
+{
+    if (!ThreadPool::Queue(PoolClass<T>(), base::Bind(&AsyncReqWrap::Run<T, F, P1>, wrap, p1)))
+        wrap->Cancel();
+}
+
+template <void* T, class F, class P1, class P2>
+void AsyncCall(const CefRefPtr<AsyncReqWrap>& wrap, const F&, const P1& p1, const P2& p2)
+{
+    if (!ThreadPool::Queue(PoolClass<T>(),
+            base::Bind(&(AsyncReqWrap::Run<T, F, P1, P2>), wrap, p1, p2)))
+        wrap->Cancel();
+}
+
+template <void* T, class F, class P1, class P2, class P3>
+void AsyncCall(const CefRefPtr<AsyncReqWrap>& wrap, const F&,
+    const P1& p1, const P2& p2, const P3& p3)
+{
+    if (!ThreadPool::Queue(PoolClass<T>(),
+            base::Bind(&AsyncReqWrap::Run<T, F, P1, P2, P3>, wrap, p1, p2, p3)))
+        wrap->Cancel();
+}
+
+template <void* T, class F, class P1, class P2, class P3, class P4>
+void AsyncCall(const CefRefPtr<AsyncReqWrap>& wrap, const F&,
+    const P1& p1, const P2& p2, const P3& p3, const P4& p4)
+{
+    if (!ThreadPool::Queue(PoolClass<T>(),
+            base::Bind(&AsyncReqWrap::Run<T, F, P1, P2, P3, P4>, wrap, p1, p2, p3, p4)))
+        wrap->Cancel();
+}
+
+// a whole file read on one ThreadPool worker, open, size, read and close
+// in a row, then delivered with a single completion
+class ReadFileReq : public CefBase {
+public:
+
+    void Run()
+    {
+        if (flags != O_RDONLY || !ReadArchive())
+            ReadFile();
+
+        // V8 can't hold longer strings, never less than a character for
+        // every 3 bytes
+        if (err == 0 && utf8 && size / 3 > STRING_MAX_LENGTH) {
+            err = UV_E2BIG;
+        } else if (err == 0 && utf8 && !Decode()) {
+            err = UV_E2BIG;
+        } else if (err == 0 && utf8) {
+            Allocator::Free(data);
+            data = NULL;
+        }
+
+        // keep alive, must call Release manually
+        AddRef();
+        CompletionQueue::Post(context, base::Bind(&ReadFileReq::OnComplete, this));
+    }
+
+    // completes without running, the thread pool didn't take the request
+    void Cancel()
+    {
+        err = UV_ECANCELED;
+
+        AddRef();
+        CompletionQueue::Post(context, base::Bind(&ReadFileReq::OnComplete, this));
+    }
+
+    ReadFileReq(EventLoop& eventLoop, const AutoString& filePath, int openFlags,
+        bool decodeUtf8, const CefRefPtr<CefV8Value>& reqWrap) :
+        loop(eventLoop.ToUv()), path(filePath), flags(openFlags), utf8(decodeUtf8),
+        call("open"), err(0), data(NULL), size(0), context(CefV8Context::GetCurrentContext()), wrap(reqWrap) {}
+    ~ReadFileReq() { Allocator::Free(data); }
+
+private:
+
+    // same as kMaxLength of buffer
+    static const size_t MAX_LENGTH =
+        sizeof(int32_t) == sizeof(intptr_t) ? 0x3fffffff : 0x7fffffff;
+    static const size_t STRING_MAX_LENGTH = (1 << 28) - 16;
+    static const size_t CHUNK_SIZE = 64 << 10;
+
+    bool ReadArchive()
+    {
+        int rc;
+        if (!Archive::Stat(path.c_str(), rc, &size))
+            return false;
+
+        if (rc != 0) {
+            err = rc > 0 ? UV_EISDIR : rc;
+            call = "open";
+        } else if (size && !(data = static_cast<char*>(Allocator::Allocate(size)))) {
+            err = UV_ENOMEM;
+            call = "read";
+        } else if (!Archive::Read(path.c_str(), data, size, err)) {
+            err = UV_ENOENT;
+            call = "open";
+        } else {
+            call = "read";
+        }
+
+        return true;
+    }
+
+    void ReadFile()
+    {
+        uv_fs_t req;
+
+        call = "open";
+        const int fd = uv_fs_open(loop, &req, path, flags, 0666, NULL);
+        uv_fs_req_cleanup(&req);
+
+        if (fd < 0) {
+            err = fd;
+            return;
+        }
+
+        call = "fstat";
+        err = uv_fs_fstat(loop, &req, fd, NULL);
+        const uv_stat_t st = req.statbuf;
+        uv_fs_req_cleanup(&req);
+
+        // the kernel lies about many files, read them until the end
+        const size_t known = (err == 0 && (st.st_mode & S_IFMT) == S_IFREG) ? size_t(st.st_size) : 0;
+
+        call = "read";
+
+        if (err) {
+            // closes below
+        } else if (known > MAX_LENGTH) {
+            err = UV_EFBIG;
+        } else if (known) {
+            if ((data = static_cast<char*>(Allocator::Allocate(known))))
+                err = ReadChunks(fd, data, known, size);
+            else
+                err = UV_ENOMEM;
+        } else {
+            std::vector<char> chunks;
+            size_t len = 0;
+
+            do {
+                chunks.resize(len + CHUNK_SIZE);
+                err = ReadChunks(fd, &chunks[len], CHUNK_SIZE, size);
+                len += size;
+            } while (err == 0 && size == CHUNK_SIZE && len <= MAX_LENGTH);
+
+            if (err == 0 && len > MAX_LENGTH)
+                err = UV_EFBIG;
+            else if (err == 0 && len && !(data = static_cast<char*>(Allocator::Allocate(len))))
+                err = UV_ENOMEM;
+            else if (err == 0 && len)
+                memcpy(data, &chunks[0], len);
+
+            size = len;
+        }
+
+        uv_fs_close(loop, &req, fd, NULL);
+        uv_fs_req_cleanup(&req);
+    }
+
+    // stops at the end of the file, len is the number of bytes read
+    int ReadChunks(uv_file fd, char* dst, size_t max, size_t& len)
+    {
+        len = 0;
+
+        while (len < max) {
+            uv_fs_t req;
+            uv_buf_t buf = uv_buf_init(dst + len, unsigned(max - len));
+
+            const ssize_t nRead = uv_fs_read(loop, &req, fd, &buf, 1, -1, NULL);
+            uv_fs_req_cleanup(&req);
+
+            if (nRead < 0)
+                return int(nRead);
+            if (nRead == 0)
+                break;
+
+            len += size_t(nRead);
+        }
+
+        return 0;
+    }
+
+    // false if the text is longer than a string can be
+    bool Decode()
+    {
+#ifdef CEF_STRING_TYPE_UTF16
+        // never more characters than bytes
+        std::vector<cef_char_t> dst(size + 1);
+        const size_t strLen = Codec::Utf8Decode(data, size, To<Codec::char16*>(&dst[0]));
+
+        if (strLen > STRING_MAX_LENGTH)
+            return false;
+
+        text.FromString(&dst[0], strLen, true);
+#else
+        if (size > STRING_MAX_LENGTH)
+            return false;
+
+        text.FromString(std::string(data ? data : "", size));
+#endif // CEF_STRING_TYPE_UTF16
+        return true;
+    }
+
+    // the limits of V8 are RangeErrors as in Node.js, not errors of a call
+    CefRefPtr<CefV8Value> RangeError(Environment& env) const
+    {
+        CefV8ValueList msg;
+        msg.push_back(CefV8Value::CreateString(err == UV_EFBIG ?
+            "File size is greater than possible Buffer" :
+            "File is longer than the maximum string length"));
+
+        return env.GetFunction().op_new->ExecuteFunction(
+            context->GetGlobal()->GetValue("RangeError"), msg);
+    }
+
+    // called by CompletionQueue with the context entered
+    void OnComplete(Environment* env)
+    {
+        if (env) {
+            CefV8ValueList args;
+
+            if (err == UV_EFBIG || err == UV_E2BIG) {
+                args.push_back(RangeError(*env));
+            } else if (err) {
+                CefString except;
+                Environment::UvException(err, call, NULL, path, NULL, except);
+                args.push_back(CefV8Value::CreateString(except));
+            } else if (utf8 && data == NULL) {
+                args.push_back(CefV8Value::CreateNull());
+                args.push_back(CefV8Value::CreateString(text));
+            } else {
+                args.push_back(CefV8Value::CreateNull());
+                args.push_back(Buffer::NewObject(Buffer::Adopt(data, size)));
+                data = NULL;
+            }
+
+            CefRefPtr<CefV8Value> callback = wrap->GetValue(consts::str_oncomplete);
+            callback->ExecuteFunction(wrap, args);
+        } // else context already released
+
+        // really delete here
+        Release();
+    }
+
+    /// Declarations
+    /// -----------------
+
+    uv_loop_t* loop;
+
+    AutoString path;
+    const int flags;
+    const bool utf8;
+
+    const char* call;
+    int err;
+    char* data;
+    size_t size;
+    CefString text;
+
+    CefRefPtr<CefV8Context> context;
+    CefRefPtr<CefV8Value> wrap;
+
+    DISALLOW_COPY_AND_ASSIGN(ReadFileReq);
+    IMPLEMENT_REFCOUNTING(ReadFileReq);
+};
+
+// a whole file written on one ThreadPool worker, strings are encoded there,
+// the buffers are gathered into as few writes as possible, atomic writes go
+// to a temporary file renamed over the target once synced
+class WriteFileReq : public CefBase {
+public:
+
+    void Run()
+    {
+        Write();
+
+        // keep alive, must call Release manually
+        AddRef();
+        CompletionQueue::Post(context, base::Bind(&WriteFileReq::OnComplete, this));
+    }
+
+    // completes without running, the thread pool didn't take the request
+    void Cancel()
+    {
+        err = UV_ECANCELED;
+
+        AddRef();
+        CompletionQueue::Post(context, base::Bind(&WriteFileReq::OnComplete, this));
+    }
+
+    void Write()
+    {
+        WriteFile();
+
+        if (err == 0)
+            DropCached(path, false);
+    }
+
+    void WriteFile()
+    {
+        if (isString) {
+            AddBuffer(Buffer::Create(str, encoding));
+        }
+
+        if (atomic) {
+            WriteAtomic();
+            return;
+        }
+
+        uv_fs_t req;
+
+        call = "open";
+        const int fd = uv_fs_open(loop, &req, path, flags, mode, NULL);
+        uv_fs_req_cleanup(&req);
+
+        if (fd < 0) {
+            err = fd;
+            return;
+        }
+
+        err = WriteClose(fd, sync);
+    }
+
+    // the target keeps its mode, a symlink keeps pointing to the file it
+    // points to, which is replaced, and the exclusive flags still fail with
+    // EEXIST if the target exists
+    void WriteAtomic()
+    {
+        uv_fs_t req;
+        std::string target(path);
+        int targetMode = -1;
+
+        int rc = uv_fs_lstat(loop, &req, path, NULL);
+        const uv_stat_t st = req.statbuf;
+        uv_fs_req_cleanup(&req);
+
+        if (rc == 0 && (flags & O_EXCL)) {
+            call = "open";
+            err = UV_EEXIST;
+            return;
+        }
+
+        if (rc == 0 && (st.st_mode & S_IFMT) == S_IFLNK) {
+            // a dangling link is replaced by the new file itself
+            rc = uv_fs_realpath(loop, &req, path, NULL);
+            if (rc == 0)
+                target = static_cast<const char*>(req.ptr);
+            uv_fs_req_cleanup(&req);
+
+            if (rc == 0) {
+                rc = uv_fs_stat(loop, &req, target.c_str(), NULL);
+                if (rc == 0)
+                    targetMode = int(req.statbuf.st_mode & 07777);
+                uv_fs_req_cleanup(&req);
+            }
+        } else if (rc == 0) {
+            targetMode = int(st.st_mode & 07777);
+        }
+
+        const std::string temp = TempPath(target);
+
+        call = "open";
+        const int fd = uv_fs_open(loop, &req, temp.c_str(), O_WRONLY | O_CREAT | O_EXCL,
+                                  mode, NULL);
+        uv_fs_req_cleanup(&req);
+
+        if (fd < 0) {
+            err = fd;
+            return;
+        }
+
+        if (targetMode >= 0) {
+            call = "fchmod";
+            err = uv_fs_fchmod(loop, &req, fd, targetMode, NULL);
+            uv_fs_req_cleanup(&req);
+        }
+
+        if (err == 0) {
+            err = WriteClose(fd, true);
+        } else {
+            uv_fs_close(loop, &req, fd, NULL);
+            uv_fs_req_cleanup(&req);
+        }
+
+        if (err == 0)
+            err = Replace(temp, target);
+
+        // never leave the temporary file behind
+        if (err) {
+            uv_fs_unlink(loop, &req, temp.c_str(), NULL);
+            uv_fs_req_cleanup(&req);
+            return;
+        }
+
+        // the rename itself is only durable once the directory is synced
+        call = "fsync";
+        err = SyncDir(target);
+    }
+
+    // empty buffers are dropped, nothing would ever be written from them
+    void AddBuffer(const CefRefPtr<Buffer>& buf)
+    {
+        if (buf->Size() == 0)
+            return;
+
+        buffers.push_back(buf);
+        bufs.push_back(uv_buf_init(buf->Data(), unsigned(buf->Size())));
+    }
+
+    int GetError() const { return err; }
+    const char* GetCall() const { return call; }
+
+    WriteFileReq(EventLoop& eventLoop, const AutoString& filePath, int openFlags, int openMode,
+        int64_t position, bool fsync, bool replace, const CefRefPtr<CefV8Value>& reqWrap) :
+        loop(eventLoop.ToUv()), path(filePath), flags(openFlags), mode(openMode),
+        offset(position), sync(fsync), atomic(replace), isString(false), call("open"), err(0),
+        context(CefV8Context::GetCurrentContext()), wrap(reqWrap) {}
+
+    void SetString(const CefString& data, const CefString& enc)
+    {
+        isString = true;
+        str = data;
+        encoding = enc;
+    }
+
+private:
+
+    // at most IOV_MAX buffers in one call
+    static const size_t MAX_BUFS = 1024;
+
+    // next to the target, so the rename stays on the same file system
+    std::string TempPath(const std::string& target) const
+    {
+        std::ostringstream format;
+        format << target << ".~" << std::hex << uv_hrtime() << '-'
+               << static_cast<const void*>(this) << ".tmp";
+
+        return format.str();
+    }
+
+    // writes everything, flushes the file if asked to and closes it
+    int WriteClose(uv_file fd, bool flush)
+    {
+        uv_fs_t req;
+
+        call = "write";
+        int rc = WriteAll(fd);
+
+        if (rc == 0 && flush) {
+            call = "fsync";
+            rc = uv_fs_fsync(loop, &req, fd, NULL);
+            uv_fs_req_cleanup(&req);
+        }
+
+        const int rcClose = uv_fs_close(loop, &req, fd, NULL);
+        uv_fs_req_cleanup(&req);
+
+        if (rc == 0 && rcClose) {
+            call = "close";
+            rc = rcClose;
+        }
+
+        return rc;
+    }
+
+    // exclusive writes link the temporary file to the target, which fails if
+    // the target was created meanwhile, other writes rename over the target
+    int Replace(const std::string& temp, const std::string& target)
+    {
+        uv_fs_t req;
+        int rc;
+
+        if (flags & O_EXCL) {
+            rc = uv_fs_link(loop, &req, temp.c_str(), target.c_str(), NULL);
+            uv_fs_req_cleanup(&req);
+
+            if (rc == 0) {
+                uv_fs_unlink(loop, &req, temp.c_str(), NULL);
+                uv_fs_req_cleanup(&req);
+                return 0;
+            }
+
+            if (rc == UV_EEXIST) {
+                call = "open";
+                return rc;
+            }
+
+            // a file system without hard links, the check before writing
+            // must do then
+            if (rc != UV_EPERM && rc != UV_ENOTSUP && rc != UV_ENOSYS) {
+                call = "link";
+                return rc;
+            }
+        }
+
+        call = "rename";
+        rc = uv_fs_rename(loop, &req, temp.c_str(), target.c_str(), NULL);
+        uv_fs_req_cleanup(&req);
+
+        return rc;
+    }
+
+    // flushes the directory entry of the file, NTFS journals the rename and
+    // directories can't be opened for it on Windows
+    int SyncDir(const std::string& file)
+    {
+#ifdef _WIN32
+        return 0;
+#else
+        const size_t slash = file.find_last_of('/');
+        const std::string dir = slash == std::string::npos ? std::string(".") :
+                                slash == 0 ? std::string("/") : file.substr(0, slash);
+        uv_fs_t req;
+
+        const int fd = uv_fs_open(loop, &req, dir.c_str(), O_RDONLY, 0, NULL);
+        uv_fs_req_cleanup(&req);
+
+        if (fd < 0)
+            return fd;
+
+        const int rc = uv_fs_fsync(loop, &req, fd, NULL);
+        uv_fs_req_cleanup(&req);
+
+        uv_fs_close(loop, &req, fd, NULL);
+        uv_fs_req_cleanup(&req);
+
+        // some file systems can't sync directories at all
+        return rc == UV_EINVAL ? 0 : rc;
+#endif
+    }
+
+    int WriteAll(uv_file fd)
+    {
+        size_t i = 0;
+
+        for (;;) {
+            // a write of empty buffers only returns 0 and doesn't move on
+            while (i < bufs.size() && bufs[i].len == 0)
+                ++i;
+
+            if (i == bufs.size())
+                break;
+
+            uv_fs_t req;
+            const unsigned nBuf = unsigned(Min(bufs.size() - i, size_t(MAX_BUFS)));
+
+            const int nWritten = uv_fs_write(loop, &req, fd, &bufs[i], nBuf, offset, NULL);
+            uv_fs_req_cleanup(&req);
+
+            if (nWritten < 0)
+                return nWritten;
+
+            if (offset >= 0)
+                offset += nWritten;
+
+            // skip what's written, the rest of a partial buffer goes next
+            for (size_t left = size_t(nWritten); left && i < bufs.size(); ) {
+                if (left >= bufs[i].len) {
+                    left -= bufs[i++].len;
+                } else {
+                    bufs[i].base += left;
+                    bufs[i].len -= left;
+                    left = 0;
+                }
+            }
+        }
+
+        return 0;
+    }
+
+    // called by CompletionQueue with the context entered
+    void OnComplete(Environment* env)
+    {
+        if (env) {
+            CefV8ValueList args;
+
+            if (err) {
+                CefString except;
+                Environment::UvException(err, call, NULL, path, NULL, except);
+                args.push_back(CefV8Value::CreateString(except));
+            } else {
+                args.push_back(CefV8Value::CreateNull());
+            }
+
+            CefRefPtr<CefV8Value> callback = wrap->GetValue(consts::str_oncomplete);
+            callback->ExecuteFunction(wrap, args);
+        } // else context already released
+
+        // really delete here
+        Release();
+    }
+
+    /// Declarations
+    /// -----------------
+
+    uv_loop_t* loop;
+
+    AutoString path;
+    const int flags;
+    const int mode;
+    int64_t offset;             // -1 to append
+    const bool sync;
+    const bool atomic;
+
+    bool isString;
+    CefString str;
+    CefString encoding;
+
+    std::vector< CefRefPtr<Buffer> > buffers;
+    std::vector<uv_buf_t> bufs;
+
+    const char* call;
+    int err;
+
+    CefRefPtr<CefV8Context> context;
+    CefRefPtr<CefV8Value> wrap;
+
+    DISALLOW_COPY_AND_ASSIGN(WriteFileReq);
+    IMPLEMENT_REFCOUNTING(WriteFileReq);
+};
+
+// a whole file copied on one ThreadPool worker without going through user
+// space whenever possible: a reflink, copy_file_range(), sendfile(), and a
+// read and write loop as the last resort
+class CopyFileReq : public CefBase {
+public:
+
+    void Run()
+    {
+        Copy();
+
+        // keep alive, must call Release manually
+        AddRef();
+        CompletionQueue::Post(context, base::Bind(&CopyFileReq::OnComplete, this));
+    }
+
+    // completes without running, the thread pool didn't take the request
+    void Cancel()
+    {
+        err = UV_ECANCELED;
+
+        AddRef();
+        CompletionQueue::Post(context, base::Bind(&CopyFileReq::OnComplete, this));
+    }
+
+    void Copy()
+    {
+        uv_fs_t req;
+
+        const int fdIn = uv_fs_open(loop, &req, src, O_RDONLY, 0, NULL);
+        uv_fs_req_cleanup(&req);
+
+        if (fdIn < 0) {
+            err = fdIn;
+            return;
+        }
+
+        err = uv_fs_fstat(loop, &req, fdIn, NULL);
+        const uv_stat_t stIn = req.statbuf;
+        uv_fs_req_cleanup(&req);
+
+        if (err == 0 && (stIn.st_mode & S_IFMT) == S_IFDIR)
+            err = UV_EISDIR;
+
+        if (err == 0)
+            err = CopyTo(fdIn, stIn);
+
+        if (err == 0)
+            DropCached(dest, false);
+
+        uv_fs_close(loop, &req, fdIn, NULL);
+        uv_fs_req_cleanup(&req);
+    }
+
+    int GetError() const { return err; }
+
+    CopyFileReq(EventLoop& eventLoop, const AutoString& srcPath, const AutoString& destPath,
+        int copyFlags, int progressInterval, const CefRefPtr<CefV8Value>& reqWrap) :
+        loop(eventLoop.ToUv()), src(srcPath), dest(destPath), flags(copyFlags),
+        interval(progressInterval < 0 ? -1 : int64_t(progressInterval) * 1000000),
+        lastProgress(0), progressPending(0), copied(0), err(0),
+        context(CefV8Context::GetCurrentContext()), wrap(reqWrap) {}
+
+private:
+
+    // bytes of one system call, small enough for regular progress reports
+    static const size_t COPY_CHUNK = 16 * 1024 * 1024;
+    static const size_t BUFFER_SIZE = 1024 * 1024;
+
+    int CopyTo(uv_file fdIn, const uv_stat_t& stIn)
+    {
+        uv_fs_t req;
+        const int mode = int(stIn.st_mode & 0777);
+
+        // not truncated yet, the destination might be the source itself
+        const int fdOut = uv_fs_open(loop, &req, dest, O_WRONLY | O_CREAT |
+                                     (flags & COPYFILE_EXCL ? O_EXCL : 0), mode, NULL);
+        uv_fs_req_cleanup(&req);
+
+        if (fdOut < 0)
+            return fdOut;
+
+        int rc = uv_fs_fstat(loop, &req, fdOut, NULL);
+        const uv_stat_t stOut = req.statbuf;
+        uv_fs_req_cleanup(&req);
+
+        const bool same = rc == 0 && stOut.st_dev == stIn.st_dev && stOut.st_ino == stIn.st_ino;
+
+        if (rc == 0 && !same) {
+            rc = uv_fs_ftruncate(loop, &req, fdOut, 0, NULL);
+            uv_fs_req_cleanup(&req);
+        }
+
+        if (rc == 0 && !same)
+            rc = CopyData(fdIn, fdOut);
+
+        // an existing destination keeps its mode otherwise
+        if (rc == 0 && !same) {
+            rc = uv_fs_fchmod(loop, &req, fdOut, mode, NULL);
+            uv_fs_req_cleanup(&req);
+        }
+
+        const int rcClose = uv_fs_close(loop, &req, fdOut, NULL);
+        uv_fs_req_cleanup(&req);
+
+        if (rc == 0)
+            rc = rcClose;
+
+        // never leave a partial copy behind
+        if (rc && !same) {
+            uv_fs_unlink(loop, &req, dest, NULL);
+            uv_fs_req_cleanup(&req);
+        }
+
+        return rc;
+    }
+
+    int CopyData(uv_file fdIn, uv_file fdOut)
+    {
+        int rc = Clone(fdIn, fdOut);
+
+        if (rc == 0 || flags & COPYFILE_FICLONE_FORCE)
+            return rc;
+
+        rc = CopyRange(fdIn, fdOut);
+
+        if (rc == 0 || copied || !CanFallBack(rc))
+            return rc;
+
+        rc = SendFile(fdIn, fdOut);
+
+        if (rc == 0 || copied || !CanFallBack(rc))
+            return rc;
+
+        return ReadWrite(fdIn, fdOut);
+    }
+
+    // the file system doesn't support the call for these files
+    static bool CanFallBack(int rc)
+    {
+        return rc == UV_ENOSYS || rc == UV_EINVAL || rc == UV_EXDEV ||
+               rc == UV_ENOTSUP || rc == UV_EPERM || rc == UV_EBADF;
+    }
+
+    // shares the extents of the source on Btrfs, XFS and others, no data
+    // is copied at all
+    int Clone(uv_file fdIn, uv_file fdOut)
+    {
+#ifdef __linux__
+        if (ioctl(fdOut, FICLONE, fdIn) < 0)
+            return -errno;
+
+        uv_fs_t req;
+        if (uv_fs_fstat(loop, &req, fdOut, NULL) == 0)
+            copied = int64_t(req.statbuf.st_size);
+        uv_fs_req_cleanup(&req);
+
+        return 0;
+#else
+        return UV_ENOTSUP;
+#endif
+    }
+
+    // in the kernel, and offloaded to the storage by some file systems
+    int CopyRange(uv_file fdIn, uv_file fdOut)
+    {
+#if defined(__linux__) && defined(__NR_copy_file_range)
+        for (;;) {
+            loff_t offIn = copied;
+            loff_t offOut = copied;
+
+            const long n = syscall(__NR_copy_file_range, fdIn, &offIn, fdOut, &offOut,
+                                   COPY_CHUNK, 0);
+            if (n < 0) {
+                if (errno == EINTR)
+                    continue;
+                return -errno;
+            }
+            if (n == 0)
+                return 0;
+
+            Progress(copied += n);
+        }
+#else
+        return UV_ENOSYS;
+#endif
+    }
+
+    // libuv emulates sendfile() with reads and writes where the kernel
+    // can't send to a file
+    int SendFile(uv_file fdIn, uv_file fdOut)
+    {
+        for (;;) {
+            uv_fs_t req;
+            const int n = uv_fs_sendfile(loop, &req, fdOut, fdIn, copied, COPY_CHUNK, NULL);
+            uv_fs_req_cleanup(&req);
+
+            if (n < 0)
+                return n;
+            if (n == 0)
+                return 0;
+
+            Progress(copied += n);
+        }
+    }
+
+    int ReadWrite(uv_file fdIn, uv_file fdOut)
+    {
+        std::vector<char> data(BUFFER_SIZE);
+
+        for (;;) {
+            uv_fs_t req;
+            uv_buf_t buf = uv_buf_init(&data[0], unsigned(data.size()));
+
+            const int n = uv_fs_read(loop, &req, fdIn, &buf, 1, copied, NULL);
+            uv_fs_req_cleanup(&req);
+
+            if (n <= 0)
+                return n;
+
+            for (buf.len = unsigned(n); buf.len; ) {
+                const int nWritten = uv_fs_write(loop, &req, fdOut, &buf, 1, copied, NULL);
+                uv_fs_req_cleanup(&req);
+
+                if (nWritten < 0)
+                    return nWritten;
+
+                buf.base += nWritten;
+                buf.len -= unsigned(nWritten);
+                copied += nWritten;
+            }
+
+            Progress(copied);
+        }
+    }
+
+    // at most one report in flight, so a slow renderer doesn't pile them up
+    void Progress(int64_t bytes)
+    {
+        if (interval < 0 || !wrap.get())
+            return;
+
+        const uint64_t now = uv_hrtime();
+
+        if (now - lastProgress < uint64_t(interval) ||
+            atomic::Exchange(&progressPending, 1))
+            return;
+
+        lastProgress = now;
+
+        AddRef();
+        CompletionQueue::Post(context,
+            base::Bind(&CopyFileReq::OnProgress, this, double(bytes)));
+    }
+
+    // called by CompletionQueue with the context entered
+    void OnProgress(double bytes, Environment* env)
+    {
+        atomic::Store(&progressPending, 0);
+
+        if (env)
+            CallProgress(bytes);
+
+        Release();
+    }
+
+    void CallProgress(double bytes)
+    {
+        CefRefPtr<CefV8Value> callback = wrap->GetValue(consts::str_onprogress);
+
+        if (callback.get() && callback->IsFunction()) {
+            CefV8ValueList args;
+            args.push_back(CefV8Value::CreateDouble(bytes));
+            callback->ExecuteFunction(wrap, args);
+        }
+    }
+
+    // called by CompletionQueue with the context entered
+    void OnComplete(Environment* env)
+    {
+        if (env) {
+            CefV8ValueList args;
+
+            if (err) {
+                CefString except;
+                Environment::UvException(err, "copyfile", NULL, src, dest, except);
+                args.push_back(CefV8Value::CreateString(except));
+            } else {
+                // the last report has every byte
+                if (interval >= 0)
+                    CallProgress(double(copied));
+
+                args.push_back(CefV8Value::CreateNull());
+            }
+
+            CefRefPtr<CefV8Value> callback = wrap->GetValue(consts::str_oncomplete);
+            callback->ExecuteFunction(wrap, args);
+        } // else context already released
+
+        // really delete here
+        Release();
+    }
+
+    /// Declarations
+    /// -----------------
+
+    uv_loop_t* loop;
+
+    const AutoString src;
+    const AutoString dest;
+    const int flags;
+    const int64_t interval;     // of progress reports in ns, -1 for none
+
+    uint64_t lastProgress;
+    volatile atomic::Word progressPending;
+
+    int64_t copied;
+    int err;
+
+    CefRefPtr<CefV8Context> context;
+    CefRefPtr<CefV8Value> wrap;
+
+    DISALLOW_COPY_AND_ASSIGN(CopyFileReq);
+    IMPLEMENT_REFCOUNTING(CopyFileReq);
+};
+
+// the fields of a fs.Stats in the order of its constructor arguments, NaN for
+// the ones not available on the platform
+static void StoreStats(const uv_stat_t* s, double* field)
+{
+#define X(_NAME) *field++ = double(unsigned(s->st_##_NAME));
+    X(dev) X(mode) X(nlink) X(uid) X(gid) X(rdev)
+# if defined(__POSIX__)
+    X(blksize)
+# else
+    *field++ = std::numeric_limits<double>::quiet_NaN();
+# endif
+#undef X
+#define X(_NAME) *field++ = double(s->st_##_NAME);
+    X(ino) X(size)
+# if defined(__POSIX__)
+    X(blocks)
+# else
+    *field++ = std::numeric_limits<double>::quiet_NaN();
+# endif
+#undef X
+#define X(_NAME) *field++ = double(s->st_##_NAME.tv_sec) * 1000 + \
+                            double(s->st_##_NAME.tv_nsec / 1000000);
+    X(atim) X(mtim) X(ctim) X(birthtim)
+#undef X
+}
+
+// STATS_FIELDS numbers per entry as StoreStats() writes them, a NaN dev for
+// the entries that couldn't be stat'ed, in an ArrayBuffer to be read as a
+// Float64Array, or in a plain array without ArrayBuffer support
+static CefRefPtr<CefV8Value> PackStats(const std::vector<uv_stat_t>& stats,
+                                       const std::vector<int>& errors)
+{
+    const size_t count = stats.size() * STATS_FIELDS;
+    std::vector<double> packed;
+    double* values = NULL;
+
+#ifdef NCJS_BUFFER_VIEW
+    CefRefPtr<Buffer> buf = Buffer::Create(count * sizeof(double));
+    if (buf.get())
+        values = reinterpret_cast<double*>(buf->Data());
+#endif
+    if (values == NULL) {
+        packed.resize(count);
+        values = count ? &packed[0] : NULL;
+    }
+
+    for (size_t i = 0; i < stats.size(); ++i) {
+        if (errors[i])
+            values[i * STATS_FIELDS] = std::numeric_limits<double>::quiet_NaN();
+        else
+            StoreStats(&stats[i], values + i * STATS_FIELDS);
+    }
+
+#ifdef NCJS_BUFFER_VIEW
+    if (packed.empty() && buf.get())
+        return Buffer::NewArrayBuffer(buf);
+#endif
+    CefRefPtr<CefV8Value> array = CefV8Value::CreateArray(int(count));
+
+    for (size_t i = 0; i < count; ++i)
+        array->SetValue(int(i), CefV8Value::CreateDouble(values[i]));
+
+    return array;
+}
+
+// a directory listed on one ThreadPool worker with the types of its entries,
+// and stat() of every entry if asked for, delivered with a single completion
+class ReadDirReq : public CefBase {
+public:
+
+    void Run()
+    {
+        Scan();
+
+        // keep alive, must call Release manually
+        AddRef();
+        CompletionQueue::Post(context, base::Bind(&ReadDirReq::OnComplete, this));
+    }
+
+    // completes without running, the thread pool didn't take the request
+    void Cancel()
+    {
+        err = UV_ECANCELED;
+
+        AddRef();
+        CompletionQueue::Post(context, base::Bind(&ReadDirReq::OnComplete, this));
+    }
+
+    void Scan()
+    {
+        uv_fs_t req;
+
+        err = uv_fs_scandir(loop, &req, path, 0, NULL);
+
+        for (uv_dirent_t ent; err >= 0; ) {
+            const int res = uv_fs_scandir_next(&req, &ent);
+
+            if (res == UV_EOF) {
+                err = 0;
+                break;
+            }
+
+            if (res) {
+                err = res;
+                break;
+            }
+
+            names.push_back(ent.name);
+            types.push_back(ent.type);
+        }
+
+        uv_fs_req_cleanup(&req);
+
+        if (err || !withStats)
+            return;
+
+        const std::string dir(path);
+        const char last = dir.empty() ? '/' : dir[dir.size() - 1];
+#ifdef _WIN32
+        const std::string prefix = (last == '\\' || last == '/') ? dir : dir + '\\';
+#else
+        const std::string prefix = last == '/' ? dir : dir + '/';
+#endif
+
+        stats.resize(names.size());
+        statErrors.resize(names.size());
+
+        // entries removed meanwhile get no stats rather than failing the call
+        for (size_t i = 0; i < names.size(); ++i) {
+            statErrors[i] = uv_fs_stat(loop, &req, (prefix + names[i]).c_str(), NULL);
+            stats[i] = req.statbuf;
+            uv_fs_req_cleanup(&req);
+        }
+    }
+
+    // [names, types, stats], stats as PackStats() delivers them
+    void GetResult(CefV8ValueList& args) const
+    {
+        const int count = int(names.size());
+
+        CefRefPtr<CefV8Value> nameArray = CefV8Value::CreateArray(count);
+        CefRefPtr<CefV8Value> typeArray = CefV8Value::CreateArray(count);
+
+        for (int i = 0; i < count; ++i) {
+            nameArray->SetValue(i, CefV8Value::CreateString(names[i]));
+            typeArray->SetValue(i, CefV8Value::CreateInt(types[i]));
+        }
+
+        args.push_back(nameArray);
+        args.push_back(typeArray);
+
+        if (!withStats)
+            return;
+
+        args.push_back(PackStats(stats, statErrors));
+    }
+
+    int GetError() const { return err; }
+
+    ReadDirReq(EventLoop& eventLoop, const AutoString& dirPath, bool stat,
+        const CefRefPtr<CefV8Value>& reqWrap) :
+        loop(eventLoop.ToUv()), path(dirPath), withStats(stat), err(0),
+        context(CefV8Context::GetCurrentContext()), wrap(reqWrap) {}
+
+private:
+
+    // called by CompletionQueue with the context entered
+    void OnComplete(Environment* env)
+    {
+        if (env) {
+            CefV8ValueList args;
+
+            if (err) {
+                CefString except;
+                Environment::UvException(err, "scandir", NULL, path, NULL, except);
+                args.push_back(CefV8Value::CreateString(except));
+            } else {
+                args.push_back(CefV8Value::CreateNull());
+                GetResult(args);
+            }
+
+            CefRefPtr<CefV8Value> callback = wrap->GetValue(consts::str_oncomplete);
+            callback->ExecuteFunction(wrap, args);
+        } // else context already released
+
+        // really delete here
+        Release();
+    }
+
+    /// Declarations
+    /// -----------------
+
+    uv_loop_t* loop;
+
+    AutoString path;
+    const bool withStats;
+
+    int err;
+    std::vector<std::string> names;
+    std::vector<int> types;
+    std::vector<uv_stat_t> stats;
+    std::vector<int> statErrors;
+
+    CefRefPtr<CefV8Context> context;
+    CefRefPtr<CefV8Value> wrap;
+
+    DISALLOW_COPY_AND_ASSIGN(ReadDirReq);
+    IMPLEMENT_REFCOUNTING(ReadDirReq);
+};
+
+// the pattern after its element matching c, NULL if it doesn't, the element
+// is anything but * and lies within one path component ending at end
+static const char* GlobMatchOne(const char* pattern, const char* end, char c)
+{
+    switch (*pattern) {
+    case '?':
+        return pattern + 1;
+
+    case '[': {
+        const char* p = pattern + 1;
+        const bool negate = p < end && (*p == '!' || *p == '^');
+        bool match = false;
+
+        if (negate)
+            ++p;
+
+        // a leading ']' is a member of the class
+        for (const char* first = p; p < end && (*p != ']' || p == first); ++p) {
+            unsigned char lo = *p == '\\' && p + 1 < end ? *++p : *p;
+            unsigned char hi = lo;
+
+            if (p + 2 < end && p[1] == '-' && p[2] != ']') {
+                p += 2;
+                hi = *p == '\\' && p + 1 < end ? *++p : *p;
+            }
+
+            if (lo <= (unsigned char)c && (unsigned char)c <= hi)
+                match = true;
+        }
+
+        // unclosed, just a '['
+        if (p == end)
+            return c == '[' ? pattern + 1 : NULL;
+
+        return match != negate ? p + 1 : NULL;
+    }
+
+    case '\\':
+        if (pattern + 1 < end)
+            ++pattern;
+        // fall through
+
+    default:
+        return *pattern == c ? pattern + 1 : NULL;
+    }
+}
+
+// one path component, iterative, on a mismatch the last * takes one more
+// character and the rest of the pattern is tried again from there
+static bool GlobMatchName(const char* pattern, const char* patternEnd,
+                          const char* str, const char* strEnd)
+{
+    const char* starPattern = NULL;
+    const char* starStr = NULL;
+
+    while (pattern < patternEnd || str < strEnd) {
+        if (pattern < patternEnd && *pattern == '*') {
+            starPattern = ++pattern;
+            starStr = str;
+            continue;
+        }
+
+        if (pattern < patternEnd && str < strEnd) {
+            if (const char* next = GlobMatchOne(pattern, patternEnd, *str)) {
+                pattern = next;
+                ++str;
+                continue;
+            }
+        }
+
+        if (!starPattern || starStr == strEnd)
+            return false;
+
+        pattern = starPattern;
+        str = ++starStr;
+    }
+
+    return true;
+}
+
+static inline const char* ComponentEnd(const char* path)
+{
+    return path + strcspn(path, "/");
+}
+
+// the next component, NULL past the last one
+static inline const char* NextComponent(const char* path)
+{
+    const char* end = ComponentEnd(path);
+    return *end ? end + 1 : NULL;
+}
+
+// *, ? and [...] match within one path component, a ** component any number
+// of them. The same two pointers one level up, on a mismatch the last **
+// takes one more component, so no pattern is worse than the product of the
+// lengths.
+static bool GlobMatch(const char* pattern, const char* str)
+{
+    const char* globPattern = NULL;
+    const char* globStr = NULL;
+    bool glob = false;
+
+    while (pattern || str) {
+        if (pattern && pattern[0] == '*' && pattern[1] == '*' &&
+            (pattern[2] == '/' || !pattern[2])) {
+            pattern = NextComponent(pattern);
+            globPattern = pattern;
+            globStr = str;
+            glob = true;
+            continue;
+        }
+
+        if (pattern && str &&
+            GlobMatchName(pattern, ComponentEnd(pattern), str, ComponentEnd(str))) {
+            pattern = NextComponent(pattern);
+            str = NextComponent(str);
+            continue;
+        }
+
+        if (!glob || !globStr)
+            return false;
+
+        globStr = NextComponent(globStr);
+        pattern = globPattern;
+        str = globStr;
+    }
+
+    return true;
+}
+
+// the uv_dirent_type_t of a stat() mode
+static int DirentType(uint64_t mode)
+{
+    switch (mode & S_IFMT) {
+    case S_IFREG:  return UV_DIRENT_FILE;
+    case S_IFDIR:  return UV_DIRENT_DIR;
+    case S_IFLNK:  return UV_DIRENT_LINK;
+    case S_IFCHR:  return UV_DIRENT_CHAR;
+#ifdef S_IFIFO
+    case S_IFIFO:  return UV_DIRENT_FIFO;
+#endif
+#ifdef S_IFSOCK
+    case S_IFSOCK: return UV_DIRENT_SOCKET;
+#endif
+#ifdef S_IFBLK
+    case S_IFBLK:  return UV_DIRENT_BLOCK;
+#endif
+    default:       return UV_DIRENT_UNKNOWN;
+    }
+}
+
+// a directory tree listed by up to `concurrency` ThreadPool workers at once,
+// the entries delivered in batches to wrap.onentries() as they are found
+class WalkReq : public CefBase {
+public:
+
+    enum Symlinks {
+        SYMLINKS_IGNORE,    // neither reported nor followed
+        SYMLINKS_REPORT,    // reported as links
+        SYMLINKS_FOLLOW     // reported as their targets, directories walked
+    };
+
+    void Start()
+    {
+        uv_mutex_lock(&mutex);
+        pending.push_back(Dir(std::string(), 0));
+        Schedule();
+        uv_mutex_unlock(&mutex);
+    }
+
+    void AddGlob(const std::string& glob) { globs.push_back(glob); }
+    void AddExtension(const std::string& ext) { exts.push_back(ext); }
+
+    WalkReq(EventLoop& eventLoop, const AutoString& rootPath, int maxDepth, int symlinkPolicy,
+        bool stat, unsigned maxJobs, unsigned entriesPerBatch,
+        const CefRefPtr<CefV8Value>& reqWrap) :
+        loop(eventLoop.ToUv()), root(rootPath), depth(maxDepth), symlinks(symlinkPolicy),
+        withStats(stat), concurrency(maxJobs), batchSize(entriesPerBatch),
+        jobs(0), queued(0), cancelled(0), err(0),
+        context(CefV8Context::GetCurrentContext()), wrap(reqWrap)
+    {
+        NCJS_CHK_EQ(uv_mutex_init(&mutex), 0);
+
+        const char last = root.empty() ? '/' : root[root.size() - 1];
+#ifdef _WIN32
+        prefix = (last == '\\' || last == '/') ? root : root + '\\';
+#else
+        prefix = last == '/' ? root : root + '/';
+#endif
+    }
+
+    ~WalkReq() { uv_mutex_destroy(&mutex); }
+
+private:
+
+    // relative to the root, separated by '/' whatever the platform
+    struct Dir {
+        std::string path;
+        int level;
+
+        Dir(const std::string& rel, int lv) : path(rel), level(lv) {}
+    };
+
+    struct Batch {
+        std::vector<std::string> names;
+        std::vector<int> types;
+        std::vector<uv_stat_t> stats;
+        std::vector<int> statErrors;
+        std::vector<std::string> errors;
+
+        size_t Size() const { return names.size() + errors.size(); }
+
+        void Swap(Batch& other)
+        {
+            names.swap(other.names);
+            types.swap(other.types);
+            stats.swap(other.stats);
+            statErrors.swap(other.statErrors);
+            errors.swap(other.errors);
+        }
+    };
+
+    typedef std::pair<uint64_t, uint64_t> FileId;  // st_dev, st_ino
+
+    // called with the mutex locked, a worker for every waiting directory
+    void Schedule()
+    {
+        while (jobs < concurrency && queued < pending.size() && !atomic::Load(&cancelled)) {
+            if (!ThreadPool::Queue(ThreadPool::METADATA,
+                                   base::Bind(&WalkReq::Run, CefRefPtr<WalkReq>(this))))
+                break;
+
+            ++jobs;
+            ++queued;
+        }
+
+        // no worker is left that would complete the walk
+        if (jobs == 0 && !atomic::Load(&cancelled)) {
+            err = UV_ECANCELED;
+
+            AddRef();
+            CompletionQueue::Post(context, base::Bind(&WalkReq::OnComplete, this));
+        }
+    }
+
+    void Run()
+    {
+        uv_mutex_lock(&mutex);
+        --queued;
+
+        // depth first, keeps the pending list short on wide trees
+        while (!pending.empty() && !atomic::Load(&cancelled)) {
+            const Dir dir = pending.back();
+            pending.pop_back();
+
+            uv_mutex_unlock(&mutex);
+            Scan(dir);
+            uv_mutex_lock(&mutex);
+        }
+
+        if (--jobs == 0) {
+            if (current.Size())
+                Flush();
+
+            // after the batches, CompletionQueue keeps the order
+            AddRef();
+            CompletionQueue::Post(context, base::Bind(&WalkReq::OnComplete, this));
+        }
+
+        uv_mutex_unlock(&mutex);
+    }
+
+    void Scan(const Dir& dir)
+    {
+        const std::string path = dir.path.empty() ? root : prefix + Native(dir.path);
+        const bool follow = symlinks == SYMLINKS_FOLLOW;
+        uv_fs_t req;
+
+        // the root might be reached again through a link
+        uv_stat_t st;
+        if (follow && dir.level == 0 && Stat(path, st) == 0)
+            Visit(st);
+
+        int rc = uv_fs_scandir(loop, &req, path.c_str(), 0, NULL);
+
+        // depth counts the levels of entries, 0 lists nothing but still
+        // reports a root that can't be read
+        const bool list = depth < 0 || dir.level < depth;
+
+        Batch found;
+        std::vector<Dir> subdirs;
+
+        for (uv_dirent_t ent; rc >= 0 && list; ) {
+            rc = uv_fs_scandir_next(&req, &ent);
+
+            if (rc == UV_EOF) {
+                rc = 0;
+                break;
+            }
+
+            if (rc)
+                break;
+
+            const std::string rel = dir.path.empty() ? ent.name : dir.path + '/' + ent.name;
+            const std::string full = prefix + Native(rel);
+            const int level = dir.level + 1;
+            const bool descend = depth < 0 || level < depth;
+
+            int type = ent.type;
+            int statErr = 1;    // no stat() yet
+            uv_stat_t st;
+
+            // file systems without d_type
+            if (type == UV_DIRENT_UNKNOWN) {
+                statErr = LStat(full, st);
+                if (statErr == 0)
+                    type = DirentType(st.st_mode);
+            }
+
+            if (type == UV_DIRENT_LINK) {
+                if (symlinks == SYMLINKS_IGNORE)
+                    continue;
+
+                // dangling links are reported as links
+                if (follow && Stat(full, st) == 0) {
+                    statErr = 0;
+                    type = DirentType(st.st_mode);
+
+                    // a cycle, reported as the link itself
+                    if (type == UV_DIRENT_DIR && descend && !Visit(st)) {
+                        type = UV_DIRENT_LINK;
+                        statErr = 1;
+                    } else if (type == UV_DIRENT_DIR && descend) {
+                        subdirs.push_back(Dir(rel, level));
+                    }
+                }
+            } else if (type == UV_DIRENT_DIR && descend) {
+                if (!follow || (statErr = LStat(full, st)) || Visit(st))
+                    subdirs.push_back(Dir(rel, level));
+            }
+
+            if (!Matches(ent.name, rel))
+                continue;
+
+            if (withStats && statErr > 0)
+                statErr = LStat(full, st);
+
+            found.names.push_back(rel);
+            found.types.push_back(type);
+
+            if (withStats) {
+                found.stats.push_back(st);
+                found.statErrors.push_back(statErr);
+            }
+
+            if (found.Size() >= batchSize)
+                Deliver(found, subdirs);
+        }
+
+        uv_fs_req_cleanup(&req);
+
+        // the root failing fails the walk, directories removed meanwhile are
+        // no news, the others are reported
+        if (rc && dir.path.empty()) {
+            err = rc;
+            atomic::Store(&cancelled, 1);
+        } else if (rc && rc != UV_ENOENT) {
+            CefString except;
+            Environment::UvException(rc, "scandir", NULL, path.c_str(), NULL, except);
+            found.errors.push_back(except.ToString());
+        }
+
+        Deliver(found, subdirs);
+    }
+
+    // hands the entries and directories found over to the walk
+    void Deliver(Batch& found, std::vector<Dir>& subdirs)
+    {
+        uv_mutex_lock(&mutex);
+
+        for (size_t i = 0; i < found.names.size(); ++i) {
+            current.names.push_back(found.names[i]);
+            current.types.push_back(found.types[i]);
+
+            if (withStats) {
+                current.stats.push_back(found.stats[i]);
+                current.statErrors.push_back(found.statErrors[i]);
+            }
+
+            if (current.Size() >= batchSize)
+                Flush();
+        }
+
+        current.errors.insert(current.errors.end(), found.errors.begin(), found.errors.end());
+
+        if (current.Size() >= batchSize)
+            Flush();
+
+        // reversed, the first entry is walked first
+        pending.insert(pending.end(), subdirs.rbegin(), subdirs.rend());
+        Schedule();
+
+        uv_mutex_unlock(&mutex);
+
+        Batch().Swap(found);
+        subdirs.clear();
+    }
+
+    // called with the mutex locked
+    void Flush()
+    {
+        ready.push_back(Batch());
+        ready.back().Swap(current);
+
+        AddRef();
+        CompletionQueue::Post(context, base::Bind(&WalkReq::OnBatch, this));
+    }
+
+    // true the first time a directory is seen, when following links
+    bool Visit(const uv_stat_t& st)
+    {
+        uv_mutex_lock(&mutex);
+        const bool added = visited.insert(FileId(st.st_dev, st.st_ino)).second;
+        uv_mutex_unlock(&mutex);
+
+        return added;
+    }
+
+    // a filter of either kind must match if any
+    bool Matches(const char* name, const std::string& rel) const
+    {
+        if (globs.size()) {
+            bool match = false;
+
+            // patterns of a single component match names at any level
+            for (size_t i = 0; i < globs.size() && !match; ++i)
+                match = GlobMatch(globs[i].c_str(),
+                                  globs[i].find('/') == std::string::npos ? name : rel.c_str());
+            if (!match)
+                return false;
+        }
+
+        if (exts.size()) {
+            const size_t len = strlen(name);
+
+            for (size_t i = 0; i < exts.size(); ++i) {
+                if (len > exts[i].size() &&
+                    memcmp(name + len - exts[i].size(), exts[i].data(), exts[i].size()) == 0)
+                    return true;
+            }
+
+            return false;
+        }
+
+        return true;
+    }
+
+    int Stat(const std::string& path, uv_stat_t& st)
+    {
+        uv_fs_t req;
+        const int rc = uv_fs_stat(loop, &req, path.c_str(), NULL);
+        st = req.statbuf;
+        uv_fs_req_cleanup(&req);
+
+        return rc;
+    }
+
+    int LStat(const std::string& path, uv_stat_t& st)
+    {
+        uv_fs_t req;
+        const int rc = uv_fs_lstat(loop, &req, path.c_str(), NULL);
+        st = req.statbuf;
+        uv_fs_req_cleanup(&req);
+
+        return rc;
+    }
+
+    static std::string Native(const std::string& rel)
+    {
+#ifdef _WIN32
+        std::string path(rel);
+        for (size_t i = 0; i < path.size(); ++i) {
+            if (path[i] == '/')
+                path[i] = '\\';
+        }
+        return path;
+#else
+        return rel;
+#endif
+    }
+
+    // called by CompletionQueue with the context entered
+    void OnBatch(Environment* env)
+    {
+        Batch batch;
+
+        uv_mutex_lock(&mutex);
+        batch.Swap(ready.front());
+        ready.pop_front();
+        uv_mutex_unlock(&mutex);
+
+        if (env && !atomic::Load(&cancelled)) {
+            const int count = int(batch.names.size());
+
+            CefRefPtr<CefV8Value> nameArray = CefV8Value::CreateArray(count);
+            CefRefPtr<CefV8Value> typeArray = CefV8Value::CreateArray(count);
+            CefRefPtr<CefV8Value> errorArray = CefV8Value::CreateArray(int(batch.errors.size()));
+
+            for (int i = 0; i < count; ++i) {
+                nameArray->SetValue(i, CefV8Value::CreateString(Native(batch.names[i])));
+                typeArray->SetValue(i, CefV8Value::CreateInt(batch.types[i]));
+            }
+
+            for (int i = 0; i < int(batch.errors.size()); ++i)
+                errorArray->SetValue(i, CefV8Value::CreateString(batch.errors[i]));
+
+            CefV8ValueList args;
+            args.push_back(nameArray);
+            args.push_back(typeArray);
+
+            if (withStats) {
+                args.push_back(PackStats(batch.stats, batch.statErrors));
+            } else {
+                args.push_back(CefV8Value::CreateUndefined());
+            }
+
+            args.push_back(errorArray);
+
+            CefRefPtr<CefV8Value> callback = wrap->GetValue(consts::str_onentries);
+            CefRefPtr<CefV8Value> result = callback->ExecuteFunction(wrap, args);
+
+            // false or an exception stops the walk
+            if (!result.get() || (result->IsBool() && !result->GetBoolValue()))
+                atomic::Store(&cancelled, 1);
+        } else {
+            atomic::Store(&cancelled, 1);
+        }
+
+        // really delete here
+        Release();
+    }
+
+    // called by CompletionQueue with the context entered
+    void OnComplete(Environment* env)
+    {
+        if (env) {
+            CefV8ValueList args;
+
+            if (err) {
+                CefString except;
+                Environment::UvException(err, "scandir", NULL, root, NULL, except);
+                args.push_back(CefV8Value::CreateString(except));
+            } else {
+                args.push_back(CefV8Value::CreateNull());
+            }
+
+            CefRefPtr<CefV8Value> callback = wrap->GetValue(consts::str_oncomplete);
+            callback->ExecuteFunction(wrap, args);
+        } // else context already released
+
+        // really delete here
+        Release();
+    }
+
+    /// Declarations
+    /// -----------------
+
+    uv_loop_t* loop;
+
+    AutoString root;
+    std::string prefix;         // root with a trailing separator
+    const int depth;            // levels below the root, -1 for all
+    const int symlinks;
+    const bool withStats;
+    const unsigned concurrency;
+    const size_t batchSize;
+
+    std::vector<std::string> globs;
+    std::vector<std::string> exts;
+
+    uv_mutex_t mutex;
+    std::deque<Dir> pending;
+    std::set<FileId> visited;
+    unsigned jobs;              // queued or running workers
+    unsigned queued;            // not started yet
+    volatile atomic::Word cancelled;
+
+    Batch current;
+    std::deque<Batch> ready;    // posted to CompletionQueue, not delivered yet
+
+    int err;
+
+    CefRefPtr<CefV8Context> context;
+    CefRefPtr<CefV8Value> wrap;
+
+    DISALLOW_COPY_AND_ASSIGN(WalkReq);
+    IMPLEMENT_REFCOUNTING(WalkReq);
+};
+
+// realpath() of the platform on a ThreadPool worker, through the cache
+// ModuleResolver shares with every context if asked for
+class RealPathReq : public CefBase {
+public:
 
-            names->SetValue(i, CefV8Value::CreateString(ent.name));               
-        }
+    void Run()
+    {
+        Resolve();
 
-        args.push_back(names);
+        // keep alive, must call Release manually
+        AddRef();
+        CompletionQueue::Post(context, base::Bind(&RealPathReq::OnComplete, this));
     }
 
-    template <void* T>
-    void OnSuccess()
+    // completes without running, the thread pool didn't take the request
+    void Cancel()
     {
-        if (Environment* env = Environment::Get(context)) {
-            context->Enter();
+        err = UV_ECANCELED;
 
-            CefV8ValueList args; // should have at least 1 argument
-            args.push_back(CefV8Value::CreateNull());
-            Success<T>(*env, args);
-            CefRefPtr<CefV8Value> callback = wrap->GetValue(consts::str_oncomplete);
-            callback->ExecuteFunction(wrap, args);
+        AddRef();
+        CompletionQueue::Post(context, base::Bind(&RealPathReq::OnComplete, this));
+    }
 
-            context->Exit();
+    void Resolve()
+    {
+        if (cached) {
+            err = ModuleResolver::RealPath(path, real);
+            return;
         }
-        // really delete here
-        req.data = NULL; Release();
+
+        uv_fs_t req;
+
+        err = uv_fs_realpath(loop, &req, path, NULL);
+        if (err == 0)
+            real = static_cast<const char*>(req.ptr);
+
+        uv_fs_req_cleanup(&req);
     }
 
-    void OnError()
-    {
-        if (Environment* env = Environment::Get(context)) {
-            context->Enter();
+    int GetError() const { return err; }
+    const std::string& GetResult() const { return real; }
+
+    RealPathReq(EventLoop& eventLoop, const AutoString& filePath, bool cache,
+        const CefRefPtr<CefV8Value>& reqWrap) :
+        loop(eventLoop.ToUv()), path(filePath), cached(cache), err(0),
+        context(CefV8Context::GetCurrentContext()), wrap(reqWrap) {}
+
+private:
 
+    // called by CompletionQueue with the context entered
+    void OnComplete(Environment* env)
+    {
+        if (env) {
             CefV8ValueList args;
-            CefString except;
-            Environment::UvException(int(req.result), call, NULL, req.path, dest, except);
-            args.push_back(CefV8Value::CreateString(except));
+
+            if (err) {
+                CefString except;
+                Environment::UvException(err, "realpath", NULL, path, NULL, except);
+                args.push_back(CefV8Value::CreateString(except));
+            } else {
+                args.push_back(CefV8Value::CreateNull());
+                args.push_back(CefV8Value::CreateString(real));
+            }
+
             CefRefPtr<CefV8Value> callback = wrap->GetValue(consts::str_oncomplete);
             callback->ExecuteFunction(wrap, args);
-
-            context->Exit();
         } // else context already released
 
         // really delete here
-        req.data = NULL; Release();
+        Release();
     }
 
     /// Declarations
     /// -----------------
 
     uv_loop_t* loop;
-    uv_fs_t req;
 
-    const char* call;
-    AutoString dest;
+    AutoString path;
+    const bool cached;
+
+    int err;
+    std::string real;
 
     CefRefPtr<CefV8Context> context;
     CefRefPtr<CefV8Value> wrap;
 
-    CefRefPtr<CefBase> data;
-
-    DISALLOW_COPY_AND_ASSIGN(AsyncReqWrap);
-    IMPLEMENT_REFCOUNTING(AsyncReqWrap);
+    DISALLOW_COPY_AND_ASSIGN(RealPathReq);
+    IMPLEMENT_REFCOUNTING(RealPathReq);
 };
 
-template <void* T, class F, class P1>
-void AsyncCall(EventLoop& loop, const CefRefPtr<AsyncReqWrap>& wrap,
-    const F&, const P1& p1)
-{
-    loop.Queue(base::Bind(&AsyncReqWrap::Run<T, F, P1>, wrap, p1));
-}
-
-template <void* T, class F, class P1, class P2>
-void AsyncCall(EventLoop& loop, const CefRefPtr<AsyncReqWrap>& wrap,
-    const F&, const P1& p1, const P2& p2)
-{
-    loop.Queue(base::Bind(&(AsyncReqWrap::Run<T, F, P1, P2>), wrap, p1, p2));
-}
-
-template <void* T, class F, class P1, class P2, class P3>
-void AsyncCall(EventLoop& loop, const CefRefPtr<AsyncReqWrap>& wrap,
-    const F&, const P1& p1, const P2& p2, const P3& p3)
-{
-    loop.Queue(base::Bind(&AsyncReqWrap::Run<T, F, P1, P2, P3>, wrap, p1, p2, p3));
-}
-
-template <void* T, class F, class P1, class P2, class P3, class P4>
-void AsyncCall(EventLoop& loop, const CefRefPtr<AsyncReqWrap>& wrap,
-    const F&, const P1& p1, const P2& p2, const P3& p3, const P4& p4)
-{
-    loop.Queue(base::Bind(&AsyncReqWrap::Run<T, F, P1, P2, P3, P4>, wrap, p1, p2, p3, p4));
-}
-
 /// ============================================================================
 /// implementation
 /// ============================================================================
 
-CefRefPtr<CefV8Value> BuildStatsObject(Environment& env, const UvState* stat)
+CefRefPtr<CefV8Value> BuildStatsObject(Environment& env, const UvState* stat, int slot,
+                                       bool shared)
 {
     const uv_stat_t* s = static_cast<const uv_stat_t*>(stat);
+    double* values = shared ? env.GetStatValues() : NULL;
+
+    if (values) {
+        // no V8 allocation at all, JS reads the fields right after the call
+        StoreStats(s, values + slot * STATS_FIELDS);
+        return CefV8Value::CreateUndefined();
+    }
+
     // see node_file.cc #343
     CefV8ValueList argv;
     argv.reserve(14);
@@ -457,75 +2451,368 @@ class ModuleFS : public JsObjecT<ModuleFS> {
     NCJS_OBJECT_FUNCTION(InternalModuleReadFile)(CefRefPtr<CefV8Value> object,
         const CefV8ValueList& args, CefRefPtr<CefV8Value>& retval, CefString& except)
     {
-        uv_loop_t* loop = Environment::GetSyncLoop();
-
         NCJS_CHECK(NCJS_ARG_IS(String, args, 0));
         const AutoString path(args[0]->GetStringValue().ToString());
 
-        uv_fs_t reqOpen;
-        const int fd = uv_fs_open(loop, &reqOpen, path, O_RDONLY, 0, NULL);
-        uv_fs_req_cleanup(&reqOpen);
+        // shared by all environments, BOM already skipped
+        CefString text;
+        if (SourceCache::Read(path, text) == 0)
+            retval = CefV8Value::CreateString(text);
+    }
 
-        if (fd < 0)
-            return;
+    // fs.getSourceCacheStats()
+    NCJS_OBJECT_FUNCTION(GetSourceCacheStats)(CefRefPtr<CefV8Value> object,
+        const CefV8ValueList& args, CefRefPtr<CefV8Value>& retval, CefString& except)
+    {
+        SourceCache::Stats stats;
+        SourceCache::GetStats(stats);
+
+        retval = CefV8Value::CreateObject(NULL);
+        NCJS_PROPERTY(Double, retval, NCJS_REFTEXT("hits"),     stats.hits);
+        NCJS_PROPERTY(Double, retval, NCJS_REFTEXT("misses"),   stats.misses);
+        NCJS_PROPERTY(UInt,   retval, NCJS_REFTEXT("entries"),  stats.entries);
+        NCJS_PROPERTY(Double, retval, NCJS_REFTEXT("bytes"),    stats.bytes);
+        NCJS_PROPERTY(Double, retval, NCJS_REFTEXT("capacity"), stats.capacity);
+    }
 
-        std::vector<char> chars;
-        int64_t offset = 0;
-        for (;;) {
-            const size_t BLOCK_SIZE = 32 << 10;
-            const size_t start = chars.size();
-            chars.resize(start + BLOCK_SIZE);
+    // fs.invalidateSourceCache([path])
+    NCJS_OBJECT_FUNCTION(InvalidateSourceCache)(CefRefPtr<CefV8Value> object,
+        const CefV8ValueList& args, CefRefPtr<CefV8Value>& retval, CefString& except)
+    {
+        if (args.size() < 1 || args[0]->IsUndefined())
+            return SourceCache::Invalidate(NULL);
+
+        if (!args[0]->IsString())
+            return TYPE_ERROR("path must be a string");
+
+        const AutoString path(args[0]->GetStringValue().ToString());
+        SourceCache::Invalidate(path);
+    }
+
+    // fs.internalModuleStat()
+    NCJS_OBJECT_FUNCTION(InternalModuleStat)(CefRefPtr<CefV8Value> object,
+        const CefV8ValueList& args, CefRefPtr<CefV8Value>& retval, CefString& except)
+    {
+        NCJS_CHECK(NCJS_ARG_IS(String, args, 0));
 
-            uv_buf_t buf;
-            buf.base = &chars[start];
-            buf.len = BLOCK_SIZE;
+        const std::string path = args[0]->GetStringValue().ToString();
 
-            uv_fs_t reqRead;
-            const ssize_t nChar = uv_fs_read(loop, &reqRead, fd, &buf, 1, offset, NULL);
-            uv_fs_req_cleanup(&reqRead);
+        retval = CefV8Value::CreateInt(ModuleResolver::Stat(path));
+    }
 
-            NCJS_CHK_GE(nChar, 0);
-            if (static_cast<size_t>(nChar) < BLOCK_SIZE)
-                chars.resize(start + nChar);
+    static void GetPathList(const CefRefPtr<CefV8Value>& array, ModuleResolver::PathList& list)
+    {
+        const int length = array->GetArrayLength();
 
-            if (nChar == 0)
-                break;
+        list.resize(length);
+        for (int i = 0; i < length; ++i)
+            list[i] = array->GetValue(i)->GetStringValue().ToString();
+    }
 
-            offset += nChar;
+    // fs.internalModuleResolve(paths, bases, exts, trailingSlash)
+    NCJS_OBJECT_FUNCTION(InternalModuleResolve)(CefRefPtr<CefV8Value> object,
+        const CefV8ValueList& args, CefRefPtr<CefV8Value>& retval, CefString& except)
+    {
+        NCJS_CHECK(NCJS_ARG_IS(Array, args, 0));
+        NCJS_CHECK(NCJS_ARG_IS(Array, args, 1));
+        NCJS_CHECK(NCJS_ARG_IS(Array, args, 2));
+
+        ModuleResolver::PathList paths, bases, exts;
+        GetPathList(args[0], paths);
+        GetPathList(args[1], bases);
+        GetPathList(args[2], exts);
+
+        if (paths.size() != bases.size())
+            return TYPE_ERROR("paths and bases must have the same length");
+
+        const bool trailingSlash = NCJS_ARG_IS(Bool, args, 3) && args[3]->GetBoolValue();
+
+        std::string filename;
+        unsigned index = 0;
+
+        // [filename, index], false or undefined to resolve it in JS
+        switch (ModuleResolver::Resolve(paths, bases, exts, trailingSlash, filename, index)) {
+        case ModuleResolver::FOUND:
+            retval = CefV8Value::CreateArray(2);
+            retval->SetValue(0, CefV8Value::CreateString(filename));
+            retval->SetValue(1, CefV8Value::CreateUInt(index));
+            break;
+        case ModuleResolver::NOT_FOUND:
+            retval = CefV8Value::CreateBool(false);
+            break;
+        default:
+            break;
         }
+    }
+
+    // fs.getResolverStats()
+    NCJS_OBJECT_FUNCTION(GetResolverStats)(CefRefPtr<CefV8Value> object,
+        const CefV8ValueList& args, CefRefPtr<CefV8Value>& retval, CefString& except)
+    {
+        ModuleResolver::Stats stats;
+        ModuleResolver::GetStats(stats);
+
+        retval = CefV8Value::CreateObject(NULL);
+        NCJS_PROPERTY(Double, retval, NCJS_REFTEXT("statHits"),      stats.statHits);
+        NCJS_PROPERTY(Double, retval, NCJS_REFTEXT("statMisses"),    stats.statMisses);
+        NCJS_PROPERTY(Double, retval, NCJS_REFTEXT("packageHits"),   stats.packageHits);
+        NCJS_PROPERTY(Double, retval, NCJS_REFTEXT("packageMisses"), stats.packageMisses);
+        NCJS_PROPERTY(Double, retval, NCJS_REFTEXT("realpathHits"),  stats.realpathHits);
+        NCJS_PROPERTY(Double, retval, NCJS_REFTEXT("realpathMisses"), stats.realpathMisses);
+        NCJS_PROPERTY(UInt,   retval, NCJS_REFTEXT("entries"),       stats.entries);
+        NCJS_PROPERTY(UInt,   retval, NCJS_REFTEXT("capacity"),      stats.capacity);
+    }
+
+    // fs.invalidateResolverCache([path])
+    NCJS_OBJECT_FUNCTION(InvalidateResolverCache)(CefRefPtr<CefV8Value> object,
+        const CefV8ValueList& args, CefRefPtr<CefV8Value>& retval, CefString& except)
+    {
+        if (args.size() < 1 || args[0]->IsUndefined())
+            return ModuleResolver::Invalidate(NULL);
+
+        if (!args[0]->IsString())
+            return TYPE_ERROR("path must be a string");
+
+        ModuleResolver::Invalidate(args[0]->GetStringValue().ToString().c_str());
+    }
+
+    // fs.readFile(path, flags, utf8, req)
+    NCJS_OBJECT_FUNCTION(ReadFile)(CefRefPtr<CefV8Value> object,
+        const CefV8ValueList& args, CefRefPtr<CefV8Value>& retval, CefString& except)
+    {
+        GET_PARAM_PATH(args, path);
+
+        NCJS_CHECK(NCJS_ARG_IS(Int, args, 1));
+        NCJS_CHECK(NCJS_ARG_IS(Object, args, 3));
+
+        const int flags = args[1]->GetIntValue();
+        const bool utf8 = NCJS_ARG_IS(Bool, args, 2) && args[2]->GetBoolValue();
 
-        uv_fs_t reqClose;
-        NCJS_CHK_EQ(0, uv_fs_close(loop, &reqClose, fd, NULL));
-        uv_fs_req_cleanup(&reqClose);
+        GET_ASYNC_LOOP(loop);
+        CefRefPtr<ReadFileReq> req(new ReadFileReq(loop, path, flags, utf8, args[3]));
 
-        size_t start = 0;
-        // Skip UTF-8 BOM.
-        if (chars.size() >= 3 && 0 == memcmp(&chars[0], "\xEF\xBB\xBF", 3))
-            start = 3;  
+        if (!ThreadPool::Queue(ThreadPool::DATA, base::Bind(&ReadFileReq::Run, req)))
+            req->Cancel();
 
-        const CefString text(&chars[start]);
-        retval = CefV8Value::CreateString(text);
+        retval = args[3];
     }
 
-    // fs.internalModuleStat()
-    NCJS_OBJECT_FUNCTION(InternalModuleStat)(CefRefPtr<CefV8Value> object,
+    // fs.writeFile(path, data, encoding, flags, mode, position, fsync, atomic[, req])
+    NCJS_OBJECT_FUNCTION(WriteFile)(CefRefPtr<CefV8Value> object,
+        const CefV8ValueList& args, CefRefPtr<CefV8Value>& retval, CefString& except)
+    {
+        GET_PARAM_PATH(args, path);
+
+        NCJS_CHK_GE(args.size(), 8);
+        NCJS_CHECK(args[3]->IsInt());
+        NCJS_CHECK(args[4]->IsInt());
+
+        const bool async = NCJS_ARG_IS(Object, args, 8);
+        GET_ASYNC_LOOP(loop);
+
+        CefRefPtr<WriteFileReq> req(new WriteFileReq(loop, path, args[3]->GetIntValue(),
+            args[4]->GetIntValue(), GET_OFFSET(args[5]), args[6]->GetBoolValue(),
+            args[7]->GetBoolValue(), async ? args[8] : CefRefPtr<CefV8Value>()));
+
+        if (args[1]->IsString()) {
+            req->SetString(args[1]->GetStringValue(), args[2]->IsString() ?
+                           args[2]->GetStringValue() : CefString());
+        } else if (Buffer* buf = Buffer::Unwrap(args[1])) {
+            req->AddBuffer(buf);
+        } else if (args[1]->IsArray()) {
+            for (int i = 0, n = args[1]->GetArrayLength(); i < n; ++i) {
+                if (Buffer* buf = Buffer::Unwrap(args[1]->GetValue(i)))
+                    req->AddBuffer(buf);
+                else
+                    return TYPE_ERROR("array elements all need to be buffers");
+            }
+        } else {
+            return TYPE_ERROR("data must be a string, a buffer or an array of buffers");
+        }
+
+        if (async) {
+            if (!ThreadPool::Queue(ThreadPool::DATA, base::Bind(&WriteFileReq::Run, req)))
+                req->Cancel();
+            retval = args[8];
+        } else {
+            req->Write();
+
+            if (req->GetError())
+                return Environment::UvException(req->GetError(), req->GetCall(), NULL,
+                                                path, NULL, except);
+        }
+    }
+
+    // fs.copyFile(src, dest, flags, interval[, req])
+    NCJS_OBJECT_FUNCTION(CopyFile)(CefRefPtr<CefV8Value> object,
+        const CefV8ValueList& args, CefRefPtr<CefV8Value>& retval, CefString& except)
+    {
+        NCJS_CHK_GE(args.size(), 4);
+
+        if (!args[0]->IsString())
+            return TYPE_ERROR("src must be a string");
+        if (!args[1]->IsString())
+            return TYPE_ERROR("dest must be a string");
+        if (!args[2]->IsInt())
+            return TYPE_ERROR("flags must be an int");
+
+        const AutoString src(args[0]->GetStringValue().ToString());
+        const AutoString dest(args[1]->GetStringValue().ToString());
+        const int flags = args[2]->GetIntValue();
+        const int interval = args[3]->IsInt() ? args[3]->GetIntValue() : -1;
+
+        const bool async = NCJS_ARG_IS(Object, args, 4);
+        GET_ASYNC_LOOP(loop);
+
+        CefRefPtr<CopyFileReq> req(new CopyFileReq(loop, src, dest, flags, async ? interval : -1,
+                                                   async ? args[4] : CefRefPtr<CefV8Value>()));
+
+        if (async) {
+            if (!ThreadPool::Queue(ThreadPool::DATA, base::Bind(&CopyFileReq::Run, req)))
+                req->Cancel();
+            retval = args[4];
+        } else {
+            req->Copy();
+
+            if (req->GetError())
+                return Environment::UvException(req->GetError(), "copyfile", NULL,
+                                                src, dest, except);
+        }
+    }
+
+    // fs.mmap(fd, offset, length, writable)
+    NCJS_OBJECT_FUNCTION(MMap)(CefRefPtr<CefV8Value> object,
+        const CefV8ValueList& args, CefRefPtr<CefV8Value>& retval, CefString& except)
+    {
+        GET_PARAM_FD(args, fd);
+
+        NCJS_CHK_GE(args.size(), 4);
+
+        // doubles, files and offsets beyond 2 GB are the point of mapping
+        const double offset = args[1]->IsDouble() ? args[1]->GetDoubleValue() : 0;
+        const double length = args[2]->IsDouble() ? args[2]->GetDoubleValue() : 0;
+
+        if (offset < 0)
+            return RANGE_ERROR("offset must not be negative");
+        if (length < 0 || length > MAX_MAP_LENGTH)
+            return RANGE_ERROR("length must be within 0 and buffer.kMaxLength");
+
+        int err;
+        CefRefPtr<MappedFile> mapping = MappedFile::Map(fd, int64_t(offset), size_t(length),
+                                                        size_t(MAX_MAP_LENGTH),
+                                                        args[3]->GetBoolValue(), err);
+        if (err == UV_EFBIG)
+            return RANGE_ERROR("mapping exceeds buffer.kMaxLength, map a range");
+        if (err)
+            return Environment::UvException(err, "mmap", NULL, NULL, NULL, except);
+
+        retval = Buffer::NewObject(Buffer::Adopt(mapping));
+    }
+
+    // fs.msync(buffer, offset, length, async)
+    NCJS_OBJECT_FUNCTION(MSync)(CefRefPtr<CefV8Value> object,
+        const CefV8ValueList& args, CefRefPtr<CefV8Value>& retval, CefString& except)
+    {
+        size_t off, len;
+        MappedFile* mapping = NULL;
+        GET_PARAM_MAPPING(args, mapping, off, len);
+
+        const int err = mapping->Sync(off, len, NCJS_ARG_IS(Bool, args, 3) &&
+                                      args[3]->GetBoolValue());
+        if (err)
+            return Environment::UvException(err, "msync", NULL, NULL, NULL, except);
+    }
+
+    // fs.madvise(buffer, offset, length, advice)
+    NCJS_OBJECT_FUNCTION(MAdvise)(CefRefPtr<CefV8Value> object,
+        const CefV8ValueList& args, CefRefPtr<CefV8Value>& retval, CefString& except)
+    {
+        size_t off, len;
+        MappedFile* mapping = NULL;
+        GET_PARAM_MAPPING(args, mapping, off, len);
+
+        if (!NCJS_ARG_IS(String, args, 3))
+            return TYPE_ERROR("advice must be a string");
+
+        const MappedFile::Advice advice =
+            MappedFile::FindAdvice(args[3]->GetStringValue().ToString().c_str());
+
+        if (advice == MappedFile::ADVICE_COUNT)
+            return TYPE_ERROR("advice must be normal, random, sequential, willneed or dontneed");
+
+        const int err = mapping->Advise(off, len, advice);
+        if (err)
+            return Environment::UvException(err, "madvise", NULL, NULL, NULL, except);
+    }
+
+    // fs.munmap(buffer)
+    NCJS_OBJECT_FUNCTION(MUnmap)(CefRefPtr<CefV8Value> object,
         const CefV8ValueList& args, CefRefPtr<CefV8Value>& retval, CefString& except)
     {
-        uv_loop_t* loop = Environment::GetSyncLoop();
+        Buffer* buf = args.size() ? Buffer::Unwrap(args[0]) : NULL;
+        MappedFile* mapping = buf ? buf->GetMapping() : NULL;
+
+        if (mapping == NULL)
+            return TYPE_ERROR("buffer must be made by fs.mmap()");
+
+        const int err = mapping->Unmap();
+        if (err)
+            return Environment::UvException(err, "munmap", NULL, NULL, NULL, except);
+    }
 
+    // fs.internalArchiveSize(path)
+    NCJS_OBJECT_FUNCTION(InternalArchiveSize)(CefRefPtr<CefV8Value> object,
+        const CefV8ValueList& args, CefRefPtr<CefV8Value>& retval, CefString& except)
+    {
         NCJS_CHECK(NCJS_ARG_IS(String, args, 0));
+        const AutoString path(args[0]->GetStringValue().ToString());
+
+        // undefined if the path is not in a pack
+        int rc;
+        size_t size = 0;
+        if (!Archive::Stat(path, rc, &size))
+            return;
+
+        if (rc != 0)
+            return Environment::UvException(rc > 0 ? UV_EISDIR : rc, "open", NULL,
+                                            path, NULL, except);
+
+        retval = CefV8Value::CreateDouble(double(size));
+    }
 
+    // fs.internalArchiveRead(path, buffer)
+    NCJS_OBJECT_FUNCTION(InternalArchiveRead)(CefRefPtr<CefV8Value> object,
+        const CefV8ValueList& args, CefRefPtr<CefV8Value>& retval, CefString& except)
+    {
+        NCJS_CHECK(NCJS_ARG_IS(String, args, 0));
         const AutoString path(args[0]->GetStringValue().ToString());
 
-        uv_fs_t req;
-        int rc = uv_fs_stat(loop, &req, path, NULL);
-        if (rc == 0) {
-            const uv_stat_t* const s = static_cast<const uv_stat_t*>(req.ptr);
-            rc = !!(s->st_mode & S_IFDIR);
-        }
-        uv_fs_req_cleanup(&req);
+        Buffer* buf = Buffer::Unwrap(args[1]);
+        if (buf == NULL)
+            return TYPE_ERROR("buffer must be a Buffer");
+
+        size_t size = buf->Size();
+        int err;
+        if (!Archive::Read(path, buf->Data(), size, err))
+            err = UV_ENOENT;
+
+        if (err)
+            return Environment::UvException(err, "read", NULL, path, NULL, except);
+
+        retval = CefV8Value::CreateDouble(double(size));
+    }
+
+    // fs.getArchiveStats()
+    NCJS_OBJECT_FUNCTION(GetArchiveStats)(CefRefPtr<CefV8Value> object,
+        const CefV8ValueList& args, CefRefPtr<CefV8Value>& retval, CefString& except)
+    {
+        Archive::Stats stats;
+        Archive::GetStats(stats);
 
-        retval = CefV8Value::CreateInt(rc);
+        retval = CefV8Value::CreateObject(NULL);
+        NCJS_PROPERTY(UInt,   retval, NCJS_REFTEXT("archives"), stats.archives);
+        NCJS_PROPERTY(Double, retval, NCJS_REFTEXT("mapped"),   stats.mapped);
+        NCJS_PROPERTY(Double, retval, NCJS_REFTEXT("reads"),    stats.reads);
     }
 
     // fs.access()
@@ -548,7 +2835,7 @@ class ModuleFS : public JsObjecT<ModuleFS> {
         GET_PARAM_FD(args, fd);
 
         if (NCJS_ARG_IS(Object, args, 1)) {
-            ASYNC_CALL(close, args[1], fd);
+            ASYNC_IO_CALL(close, args[1], IoRequest::Close(fd), fd);
         } else {
             SYNC_CALL(close, 0, fd);
         }
@@ -577,10 +2864,14 @@ class ModuleFS : public JsObjecT<ModuleFS> {
         const int mode = args[2]->GetIntValue();
 
         if (NCJS_ARG_IS(Object, args, 3)) {
-            ASYNC_CALL(open, args[3], path, flags, mode);
+            ASYNC_IO_CALL(open, args[3], IoRequest::Open(path, flags, mode),
+                          path, flags, mode);
         } else {
             SYNC_CALL(open, path, path, flags, mode);
             retval = CefV8Value::CreateInt(SYNC_RESULT);
+
+            if (OpensForWrite(flags))
+                DropCached(path, false);
         }
     }
 
@@ -619,7 +2910,9 @@ class ModuleFS : public JsObjecT<ModuleFS> {
         CefRefPtr<AutoUvBuffer> uvbuf(new AutoUvBuffer(buf, off, len));
 
         if (NCJS_ARG_IS(Object, args, 5)) {
-            ASYNC_CALL(read, args[5], fd, uvbuf, 1, pos);
+            ASYNC_IO_CALL(read, args[5], IoRequest::Read(fd, uvbuf, 1, pos),
+                          fd, uvbuf, 1, pos);
+            ASYNC_HOLD_DATA(uvbuf);
         } else {
             SYNC_CALL(read, 0, fd, uvbuf, 1, pos);
             retval = CefV8Value::CreateInt(SYNC_RESULT);
@@ -633,7 +2926,7 @@ class ModuleFS : public JsObjecT<ModuleFS> {
         GET_PARAM_FD(args, fd);
 
         if (NCJS_ARG_IS(Object, args, 1)) {
-            ASYNC_CALL(fdatasync, args[1], fd);
+            ASYNC_IO_CALL(fdatasync, args[1], IoRequest::FDataSync(fd), fd);
         } else {
             SYNC_CALL(fdatasync, 0, fd);
         }
@@ -646,7 +2939,7 @@ class ModuleFS : public JsObjecT<ModuleFS> {
         GET_PARAM_FD(args, fd);
 
         if (NCJS_ARG_IS(Object, args, 1)) {
-            ASYNC_CALL(fsync, args[1], fd);
+            ASYNC_IO_CALL(fsync, args[1], IoRequest::FSync(fd), fd);
         } else {
             SYNC_CALL(fsync, 0, fd);
         }
@@ -678,6 +2971,8 @@ class ModuleFS : public JsObjecT<ModuleFS> {
             ASYNC_DEST_CALL(rename, args[2], pathNew, pathOld, pathNew);
         } else {
             SYNC_DEST_CALL(rename, pathOld, pathNew, pathOld, pathNew);
+            DropCached(pathOld);
+            DropCached(pathNew);
         }
     }
 
@@ -691,6 +2986,7 @@ class ModuleFS : public JsObjecT<ModuleFS> {
             ASYNC_CALL(rmdir, args[1], path);
         } else {
             SYNC_CALL(rmdir, path, path);
+            DropCached(path);
         }
     }
 
@@ -739,19 +3035,97 @@ class ModuleFS : public JsObjecT<ModuleFS> {
         }
     }
 
+    // fs.scandir(path, stats[, req])
+    NCJS_OBJECT_FUNCTION(ScanDir)(CefRefPtr<CefV8Value> object,
+        const CefV8ValueList& args, CefRefPtr<CefV8Value>& retval, CefString& except)
+    {
+        GET_PARAM_PATH(args, path);
+
+        const bool stats = NCJS_ARG_IS(Bool, args, 1) && args[1]->GetBoolValue();
+        const bool async = NCJS_ARG_IS(Object, args, 2);
+        GET_ASYNC_LOOP(loop);
+
+        CefRefPtr<ReadDirReq> req(new ReadDirReq(loop, path, stats,
+                                                 async ? args[2] : CefRefPtr<CefV8Value>()));
+
+        if (async) {
+            if (!ThreadPool::Queue(ThreadPool::METADATA, base::Bind(&ReadDirReq::Run, req)))
+                req->Cancel();
+            retval = args[2];
+            return;
+        }
+
+        req->Scan();
+
+        if (req->GetError())
+            return Environment::UvException(req->GetError(), "scandir", NULL,
+                                            path, NULL, except);
+
+        CefV8ValueList result;
+        req->GetResult(result);
+
+        retval = CefV8Value::CreateArray(int(result.size()));
+        for (size_t i = 0; i < result.size(); ++i)
+            retval->SetValue(int(i), result[i]);
+    }
+
+    // fs.walk(root, depth, globs, exts, symlinks, stats, concurrency, batchSize, req)
+    NCJS_OBJECT_FUNCTION(Walk)(CefRefPtr<CefV8Value> object,
+        const CefV8ValueList& args, CefRefPtr<CefV8Value>& retval, CefString& except)
+    {
+        GET_PARAM_PATH(args, root);
+
+        NCJS_CHK_GE(args.size(), 9);
+
+        if (!args[8]->IsObject())
+            return TYPE_ERROR("req must be an object");
+
+        const int depth = args[1]->IsInt() ? args[1]->GetIntValue() : -1;
+        const int symlinks = args[4]->IsInt() ? args[4]->GetIntValue() : WalkReq::SYMLINKS_REPORT;
+        const int concurrency = args[6]->IsInt() ? args[6]->GetIntValue() : 4;
+        const int batchSize = args[7]->IsInt() ? args[7]->GetIntValue() : 256;
+
+        if (symlinks < WalkReq::SYMLINKS_IGNORE || symlinks > WalkReq::SYMLINKS_FOLLOW)
+            return RANGE_ERROR("symlinks must be ignore, report or follow");
+        if (concurrency < 1)
+            return RANGE_ERROR("concurrency must be positive");
+        if (batchSize < 1)
+            return RANGE_ERROR("batchSize must be positive");
+
+        GET_ASYNC_LOOP(loop);
+
+        CefRefPtr<WalkReq> req(new WalkReq(loop, root, depth, symlinks, args[5]->GetBoolValue(),
+                                           unsigned(concurrency), unsigned(batchSize), args[8]));
+
+        if (args[2]->IsArray()) {
+            for (int i = 0; i < args[2]->GetArrayLength(); ++i)
+                req->AddGlob(args[2]->GetValue(i)->GetStringValue().ToString());
+        }
+
+        if (args[3]->IsArray()) {
+            for (int i = 0; i < args[3]->GetArrayLength(); ++i)
+                req->AddExtension(args[3]->GetValue(i)->GetStringValue().ToString());
+        }
+
+        req->Start();
+        retval = args[8];
+    }
+
     // fs.stat()
     NCJS_OBJECT_FUNCTION(Stat)(CefRefPtr<CefV8Value> object,
         const CefV8ValueList& args, CefRefPtr<CefV8Value>& retval, CefString& except)
     {
         GET_PARAM_PATH(args, path);
+        GET_PARAM_SHARE_STATS(args, 2, share);
 
         Environment* env = Environment::Get(CefV8Context::GetCurrentContext());
 
         if (NCJS_ARG_IS(Object, args, 1)) {
-            ASYNC_CALL(stat, args[1], path);
+            ASYNC_IO_CALL(stat, args[1], IoRequest::Stat(path), path);
+            ASYNC_SHARE_STATS(share);
         } else {
             SYNC_CALL(stat, path, path);
-            retval = BuildStatsObject(*env, static_cast<uv_stat_t*>(SYNC_REQ.ptr));
+            retval = BuildStatsObject(*env, static_cast<uv_stat_t*>(SYNC_REQ.ptr), 0, share);
         }
     }
 
@@ -760,14 +3134,16 @@ class ModuleFS : public JsObjecT<ModuleFS> {
         const CefV8ValueList& args, CefRefPtr<CefV8Value>& retval, CefString& except)
     {
         GET_PARAM_PATH(args, path);
+        GET_PARAM_SHARE_STATS(args, 2, share);
 
         Environment* env = Environment::Get(CefV8Context::GetCurrentContext());
 
         if (NCJS_ARG_IS(Object, args, 1)) {
-             ASYNC_CALL(lstat, args[1], path);
+             ASYNC_IO_CALL(lstat, args[1], IoRequest::LStat(path), path);
+             ASYNC_SHARE_STATS(share);
         } else {
              SYNC_CALL(lstat, path, path);
-             retval = BuildStatsObject(*env, static_cast<uv_stat_t*>(SYNC_REQ.ptr));
+             retval = BuildStatsObject(*env, static_cast<uv_stat_t*>(SYNC_REQ.ptr), 0, share);
         }
     }
 
@@ -776,14 +3152,16 @@ class ModuleFS : public JsObjecT<ModuleFS> {
         const CefV8ValueList& args, CefRefPtr<CefV8Value>& retval, CefString& except)
     {
         GET_PARAM_FD(args, fd);
+        GET_PARAM_SHARE_STATS(args, 2, share);
 
         Environment* env = Environment::Get(CefV8Context::GetCurrentContext());
 
         if (NCJS_ARG_IS(Object, args, 1)) {
-            ASYNC_CALL(fstat, args[1], fd);
+            ASYNC_IO_CALL(fstat, args[1], IoRequest::FStat(fd), fd);
+            ASYNC_SHARE_STATS(share);
         } else {
             SYNC_CALL(fstat, 0, fd);
-            retval = BuildStatsObject(*env, static_cast<uv_stat_t*>(SYNC_REQ.ptr));
+            retval = BuildStatsObject(*env, static_cast<uv_stat_t*>(SYNC_REQ.ptr), 0, share);
         }
     }
 
@@ -800,6 +3178,7 @@ class ModuleFS : public JsObjecT<ModuleFS> {
             ASYNC_DEST_CALL(link, args[2], pathDst, pathSrc, pathDst);
         } else {
             SYNC_DEST_CALL(link, pathSrc, pathDst, pathSrc, pathDst);
+            DropCached(pathDst, false);
         }
     }
 
@@ -827,6 +3206,7 @@ class ModuleFS : public JsObjecT<ModuleFS> {
             ASYNC_DEST_CALL(symlink, args[3], path, target, path, flags);
         } else {
             SYNC_DEST_CALL(symlink, target, path, target, path, flags);
+            DropCached(path, false);
         }
     }
 
@@ -845,6 +3225,35 @@ class ModuleFS : public JsObjecT<ModuleFS> {
         }
     }
 
+    // fs.realpath(path, cached[, req]), path must be absolute if cached
+    NCJS_OBJECT_FUNCTION(RealPath)(CefRefPtr<CefV8Value> object,
+        const CefV8ValueList& args, CefRefPtr<CefV8Value>& retval, CefString& except)
+    {
+        GET_PARAM_PATH(args, path);
+
+        const bool cached = NCJS_ARG_IS(Bool, args, 1) && args[1]->GetBoolValue();
+        const bool async = NCJS_ARG_IS(Object, args, 2);
+        GET_ASYNC_LOOP(loop);
+
+        CefRefPtr<RealPathReq> req(new RealPathReq(loop, path, cached,
+                                                   async ? args[2] : CefRefPtr<CefV8Value>()));
+
+        if (async) {
+            if (!ThreadPool::Queue(ThreadPool::METADATA, base::Bind(&RealPathReq::Run, req)))
+                req->Cancel();
+            retval = args[2];
+            return;
+        }
+
+        req->Resolve();
+
+        if (req->GetError())
+            return Environment::UvException(req->GetError(), "realpath", NULL,
+                                            path, NULL, except);
+
+        retval = CefV8Value::CreateString(req->GetResult());
+    }
+
     // fs.unlink()
     NCJS_OBJECT_FUNCTION(Unlink)(CefRefPtr<CefV8Value> object,
         const CefV8ValueList& args, CefRefPtr<CefV8Value>& retval, CefString& except)
@@ -855,6 +3264,7 @@ class ModuleFS : public JsObjecT<ModuleFS> {
             ASYNC_CALL(unlink, args[1], path);
         } else {
             SYNC_CALL(unlink, path, path);
+            DropCached(path, false);
         }
     }
 
@@ -1028,8 +3438,9 @@ class ModuleFS : public JsObjecT<ModuleFS> {
         CefRefPtr<AutoUvBuffer> uvbuf(new AutoUvBuffer(buf, off, len));
 
         if (NCJS_ARG_IS(Object, args, 5)) {
-            ASYNC_CALL(write, args[5], fd, uvbuf, 1, pos);
-            ASYNC_HOLD_DATA(buf);
+            ASYNC_IO_CALL(write, args[5], IoRequest::Write(fd, uvbuf, 1, pos),
+                          fd, uvbuf, 1, pos);
+            ASYNC_HOLD_DATA(uvbuf);
         } else {
             SYNC_CALL(write, NULL, fd, uvbuf, 1, pos);
 
@@ -1072,7 +3483,8 @@ class ModuleFS : public JsObjecT<ModuleFS> {
         }
 
         if (NCJS_ARG_IS(Object, args, 3)) {
-            ASYNC_CALL(write, args[3], fd, &hold->bufs[0], nChunk, pos);
+            ASYNC_IO_CALL(write, args[3], IoRequest::Write(fd, &hold->bufs[0], nChunk, pos),
+                          fd, &hold->bufs[0], nChunk, pos);
             ASYNC_HOLD_DATA(hold);
         } else {
             SYNC_CALL(write, NULL, fd, &hold->bufs[0], nChunk, pos);
@@ -1100,7 +3512,9 @@ class ModuleFS : public JsObjecT<ModuleFS> {
         CefRefPtr<AutoUvBuffer> uvbuf(new AutoUvBuffer(buf, 0, unsigned(buf->Size())));
 
         if (NCJS_ARG_IS(Object, args, 4)) {
-            ASYNC_CALL(write, args[4], fd, uvbuf, 1, pos);
+            ASYNC_IO_CALL(write, args[4], IoRequest::Write(fd, uvbuf, 1, pos),
+                          fd, uvbuf, 1, pos);
+            ASYNC_HOLD_DATA(uvbuf);
         } else {
             SYNC_CALL(write, NULL, fd, uvbuf, 1, pos);
 
@@ -1108,6 +3522,33 @@ class ModuleFS : public JsObjecT<ModuleFS> {
         }
     }
 
+#ifdef NCJS_BUFFER_VIEW
+    // fs.statValues(enable), shares the fields of the fs.Stats delivered by
+    // the stat bindings passed true through an ArrayBuffer of STATS_SLOTS *
+    // STATS_FIELDS doubles instead of building objects, returns undefined if
+    // disabled
+    NCJS_OBJECT_FUNCTION(StatValues)(CefRefPtr<CefV8Value> object,
+        const CefV8ValueList& args, CefRefPtr<CefV8Value>& retval, CefString& except)
+    {
+        Environment* env = Environment::Get(CefV8Context::GetCurrentContext());
+
+        // the same memory for the whole life of the environment
+        CefRefPtr<Buffer> buf = static_cast<Buffer*>(env->GetStatValuesOwner().get());
+        if (!buf.get()) {
+            buf = Buffer::Create(STATS_SLOTS * STATS_FIELDS * sizeof(double));
+            NCJS_CHECK(buf);
+        }
+
+        if (NCJS_ARG_IS(Bool, args, 0) && !args[0]->GetBoolValue()) {
+            env->SetStatValues(buf.get(), NULL);
+            return;
+        }
+
+        env->SetStatValues(buf.get(), reinterpret_cast<double*>(buf->Data()));
+        retval = Buffer::NewArrayBuffer(buf);
+    }
+#endif // NCJS_BUFFER_VIEW
+
     // fs.FSInitialize()
     NCJS_OBJECT_FUNCTION(FSInitialize)(CefRefPtr<CefV8Value> object,
         const CefV8ValueList& args, CefRefPtr<CefV8Value>& retval, CefString& except)
@@ -1128,13 +3569,31 @@ class ModuleFS : public JsObjecT<ModuleFS> {
 
         // functions
         NCJS_MAP_OBJECT_FUNCTION("FSInitialize", FSInitialize)
+#ifdef NCJS_BUFFER_VIEW
+        NCJS_MAP_OBJECT_FUNCTION("statValues",   StatValues)
+#endif
 
         NCJS_MAP_OBJECT_FUNCTION("internalModuleReadFile", InternalModuleReadFile)
         NCJS_MAP_OBJECT_FUNCTION("internalModuleStat",     InternalModuleStat)
+        NCJS_MAP_OBJECT_FUNCTION("internalModuleResolve",  InternalModuleResolve)
+        NCJS_MAP_OBJECT_FUNCTION("getResolverStats",       GetResolverStats)
+        NCJS_MAP_OBJECT_FUNCTION("invalidateResolverCache", InvalidateResolverCache)
+        NCJS_MAP_OBJECT_FUNCTION("getSourceCacheStats",    GetSourceCacheStats)
+        NCJS_MAP_OBJECT_FUNCTION("invalidateSourceCache",  InvalidateSourceCache)
+        NCJS_MAP_OBJECT_FUNCTION("internalArchiveSize",    InternalArchiveSize)
+        NCJS_MAP_OBJECT_FUNCTION("internalArchiveRead",    InternalArchiveRead)
+        NCJS_MAP_OBJECT_FUNCTION("getArchiveStats",        GetArchiveStats)
         NCJS_MAP_OBJECT_FUNCTION("access",       Access)
         NCJS_MAP_OBJECT_FUNCTION("close",        Close)
         NCJS_MAP_OBJECT_FUNCTION("open",         Open)
         NCJS_MAP_OBJECT_FUNCTION("read",         Read)
+        NCJS_MAP_OBJECT_FUNCTION("readFile",     ReadFile)
+        NCJS_MAP_OBJECT_FUNCTION("writeFile",    WriteFile)
+        NCJS_MAP_OBJECT_FUNCTION("copyFile",     CopyFile)
+        NCJS_MAP_OBJECT_FUNCTION("mmap",         MMap)
+        NCJS_MAP_OBJECT_FUNCTION("msync",        MSync)
+        NCJS_MAP_OBJECT_FUNCTION("madvise",      MAdvise)
+        NCJS_MAP_OBJECT_FUNCTION("munmap",       MUnmap)
         NCJS_MAP_OBJECT_FUNCTION("fdatasync",    FDataSync)
         NCJS_MAP_OBJECT_FUNCTION("fsync",        FSync)
         NCJS_MAP_OBJECT_FUNCTION("ftruncate",    FTruncate)
@@ -1142,12 +3601,15 @@ class ModuleFS : public JsObjecT<ModuleFS> {
         NCJS_MAP_OBJECT_FUNCTION("rmdir",        RMDir)
         NCJS_MAP_OBJECT_FUNCTION("mkdir",        MKDir)
         NCJS_MAP_OBJECT_FUNCTION("readdir",      ReadDir)
+        NCJS_MAP_OBJECT_FUNCTION("scandir",      ScanDir)
+        NCJS_MAP_OBJECT_FUNCTION("walk",         Walk)
         NCJS_MAP_OBJECT_FUNCTION("stat",         Stat)
         NCJS_MAP_OBJECT_FUNCTION("lstat",        LStat)
         NCJS_MAP_OBJECT_FUNCTION("fstat",        FStat)
         NCJS_MAP_OBJECT_FUNCTION("link",         Link)
         NCJS_MAP_OBJECT_FUNCTION("symlink",      SymLink)
         NCJS_MAP_OBJECT_FUNCTION("readlink",     ReadLink)
+        NCJS_MAP_OBJECT_FUNCTION("realpath",     RealPath)
         NCJS_MAP_OBJECT_FUNCTION("unlink",       Unlink)
         NCJS_MAP_OBJECT_FUNCTION("chmod",        Chmod)
         NCJS_MAP_OBJECT_FUNCTION("fchmod",       FChmod)
@@ -1158,6 +3620,16 @@ class ModuleFS : public JsObjecT<ModuleFS> {
         NCJS_MAP_OBJECT_FUNCTION("writeBuffer",  WriteBuffer)
         NCJS_MAP_OBJECT_FUNCTION("writeBuffers", WriteBuffers)
         NCJS_MAP_OBJECT_FUNCTION("writeString",  WriteString)
+
+        // entry types of scandir()
+        NCJS_MAP_OBJECT_CONSTANT(Int, "UV_DIRENT_UNKNOWN", UV_DIRENT_UNKNOWN)
+        NCJS_MAP_OBJECT_CONSTANT(Int, "UV_DIRENT_FILE",    UV_DIRENT_FILE)
+        NCJS_MAP_OBJECT_CONSTANT(Int, "UV_DIRENT_DIR",     UV_DIRENT_DIR)
+        NCJS_MAP_OBJECT_CONSTANT(Int, "UV_DIRENT_LINK",    UV_DIRENT_LINK)
+        NCJS_MAP_OBJECT_CONSTANT(Int, "UV_DIRENT_FIFO",    UV_DIRENT_FIFO)
+        NCJS_MAP_OBJECT_CONSTANT(Int, "UV_DIRENT_SOCKET",  UV_DIRENT_SOCKET)
+        NCJS_MAP_OBJECT_CONSTANT(Int, "UV_DIRENT_CHAR",    UV_DIRENT_CHAR)
+        NCJS_MAP_OBJECT_CONSTANT(Int, "UV_DIRENT_BLOCK",   UV_DIRENT_BLOCK)
     NCJS_END_OBJECT_FACTORY()
 
 };
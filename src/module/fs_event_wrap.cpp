@@ -20,10 +20,14 @@
 
 #include "ncjs/module.h"
 #include "ncjs/constants.h"
+#include "ncjs/FileWatcher.h"
 #include "ncjs/HandleWrap.h"
+#include "ncjs/ModuleResolver.h"
 #include "ncjs/module/fs.h"
 
-#include <include/wrapper/cef_closure_task.h>
+#include <map>
+#include <string>
+#include <vector>
 
 namespace ncjs {
 
@@ -35,86 +39,245 @@ namespace ncjs {
 /// implementation
 /// ============================================================================
 
+// the resolver may have cached the changed entry,
+// the watched path itself is a file or a directory
+static void InvalidateResolver(const std::string& watched, const char* filename)
+{
+#ifdef _WIN32
+    const char sep = '\\';
+#else
+    const char sep = '/';
+#endif
+
+    ModuleResolver::Invalidate(watched.c_str(), false);
+
+    if (filename && *filename)
+        ModuleResolver::Invalidate((watched + sep + filename).c_str());
+}
+
 /// ----------------------------------------------------------------------------
 /// FSEvent
 /// ----------------------------------------------------------------------------
 
 class FSEvent : public JsObjecT<FSEvent> {
 
-    class Handle : public HandleWrap<Handle, uv_fs_event_t, USER_DATA::FS_EVENT_WRAP> {
+    // the changes of one path within the debounce delay go to JS together in
+    // the order they happened, with a delay a file renamed or changed several
+    // times is reported once for each kind, at its first one
+    class Handle : public HandleWrap<Handle, uv_timer_t, USER_DATA::FS_EVENT_WRAP>,
+                   public FileWatcher::Listener {
     public:
 
-        Handle(const CefRefPtr<CefV8Value>& handle, const CefString& path, unsigned flags) :
-            HandleWrap(handle), m_path(path), m_flags(flags) {}
+        Handle(Environment& env, const CefRefPtr<CefV8Value>& handle, const CefString& path,
+            bool recursive, unsigned debounce) :
+            HandleWrap(env, handle), m_path(path), m_recursive(recursive),
+            m_debounce(debounce), m_event(NULL), m_dropped(false) {}
 
     private:
 
-        void OnChange(const CefString& filename, int events, int status)
+        struct Change {
+            std::string filename;
+            int event;              // UV_RENAME or UV_CHANGE
+        };
+
+        typedef std::vector<Change> Changes;
+        typedef std::map<std::pair<std::string, int>, size_t> ChangeIndex;
+
+        void OnChanges(const std::vector<std::string>& filenames,
+                       const std::vector<int>& events, bool dropped, Environment* env)
+        {
+            if (!IsActive() || !env)
+                return;
+
+            const int count = int(filenames.size());
+
+            CefRefPtr<CefV8Value> nameArray = CefV8Value::CreateArray(count + dropped);
+            CefRefPtr<CefV8Value> eventArray = CefV8Value::CreateArray(count + dropped);
+
+            for (int i = 0; i < count; ++i) {
+                nameArray->SetValue(i, filenames[i].empty() ? CefV8Value::CreateNull() :
+                                       CefV8Value::CreateString(filenames[i]));
+                eventArray->SetValue(i, CefV8Value::CreateString(
+                    events[i] == UV_RENAME ? consts::str_rename : consts::str_change));
+            }
+
+            // the kernel dropped events, anything may have changed
+            if (dropped) {
+                nameArray->SetValue(count, CefV8Value::CreateNull());
+                eventArray->SetValue(count, CefV8Value::CreateString(consts::str_rename));
+            }
+
+            CefV8ValueList args;
+            args.push_back(nameArray);
+            args.push_back(eventArray);
+
+            const CefRefPtr<CefV8Value>& handle = GetHandle();
+            const CefRefPtr<CefV8Value> callback = handle->GetValue(consts::str_onchanges);
+            callback->ExecuteFunction(handle, args);
+        }
+
+        void OnError(int status, Environment* env)
         {
-            if (!IsActive())
+            if (!IsActive() || !env)
                 return;
 
-            if (Environment* env = EnterEnvironment()) {
-                const CefString* evt = &consts::str_NULL;
-                if (status == 0) {
-                    if (events & UV_RENAME)
-                        evt = &consts::str_rename;
-                    else if (events & UV_CHANGE)
-                        evt = &consts::str_change;
-                    else
-                        NCJS_UNREACHABLE();
-                }
-
-                CefV8ValueList args;
-                args.push_back(CefV8Value::CreateInt(status));
-                args.push_back(CefV8Value::CreateString(*evt));
-                if (filename.length())
-                    args.push_back(CefV8Value::CreateString(filename));
-                
-                const CefRefPtr<CefV8Value>& handle = GetHandle();
-                const CefRefPtr<CefV8Value> callback = handle->GetValue(consts::str_onchange);
-                callback->ExecuteFunction(handle, args);
-
-                ExitEnvironment(env);
+            CefV8ValueList args;
+            args.push_back(CefV8Value::CreateInt(status));
+            args.push_back(CefV8Value::CreateString(consts::str_NULL));
+
+            const CefRefPtr<CefV8Value>& handle = GetHandle();
+            const CefRefPtr<CefV8Value> callback = handle->GetValue(consts::str_onchange);
+            callback->ExecuteFunction(handle, args);
+        }
+
+        virtual void OnWatchEvent(const char* filename, int events) OVERRIDE
+        {
+            if (filename) {
+                InvalidateResolver(m_path, filename);
+                AddChange(filename, events & UV_RENAME ? UV_RENAME : UV_CHANGE);
+            } else {
+                ModuleResolver::Invalidate(m_path.c_str());
+                m_dropped = true;
+            }
+
+            uv_timer_t* timer = this;
+            if (!uv_is_active(reinterpret_cast<uv_handle_t*>(timer)))
+                uv_timer_start(timer, Handle::Flush, m_debounce, 0);
+        }
+
+        void AddChange(const char* filename, int event)
+        {
+            if (m_debounce) {
+                const std::pair<ChangeIndex::iterator, bool> ins = m_index.insert(
+                    ChangeIndex::value_type(std::make_pair(std::string(filename), event),
+                                            m_changes.size()));
+                if (!ins.second)
+                    return; // already reported
             }
+
+            const Change change = { filename, event };
+            m_changes.push_back(change);
+        }
+
+        virtual void OnWatchError(int err) OVERRIDE
+        {
+            PostCallback(base::Bind(&Handle::OnError, this, err));
         }
 
         virtual bool AsyncStart(uv_loop_t* loop) OVERRIDE
         {
-            int err = uv_fs_event_init(loop, this);
-            if (err >= 0) {
-                err = uv_fs_event_start(this, Handle::Callback, m_path.c_str(), m_flags);
-                if (err >= 0)
-                    return true;
+            // one inotify descriptor for the loop, uv_fs_event_t elsewhere
+            int err = FileWatcher::Add(loop, m_path, m_recursive, this);
+
+            if (err == UV_ENOSYS)
+                err = StartEvent(loop);
+
+            if (err == 0) {
+                uv_timer_init(loop, this);
+                return true;
             }
+
             // failed
-            Callback(this, m_path.c_str(), 0, err);
+            OnWatchError(err);
             return false;
         }
 
+        virtual void AsyncStop() OVERRIDE
+        {
+            if (m_event) {
+                uv_close(reinterpret_cast<uv_handle_t*>(m_event), Handle::FreeEvent);
+                m_event = NULL;
+            } else {
+                FileWatcher::Remove(static_cast<uv_timer_t*>(this)->loop, this);
+            }
+        }
+
+        int StartEvent(uv_loop_t* loop)
+        {
+            m_event = new uv_fs_event_t;
+
+            int err = uv_fs_event_init(loop, m_event);
+
+            if (err) {
+                delete m_event;
+                m_event = NULL;
+                return err;
+            }
+
+            m_event->data = this;
+            err = uv_fs_event_start(m_event, Handle::Callback, m_path.c_str(),
+                                    m_recursive ? UV_FS_EVENT_RECURSIVE : 0);
+            if (err) {
+                uv_close(reinterpret_cast<uv_handle_t*>(m_event), Handle::FreeEvent);
+                m_event = NULL;
+            }
+
+            return err;
+        }
+
         static void Callback(uv_fs_event_t* handle,
                              const char* filename, int events, int status)
         {
             NCJS_ASSERT(handle);
-            
-            const CefString path(filename);
-            Handle* wrap = static_cast<Handle*>(handle);
-            CefPostTask(TID_RENDERER,
-                        base::Bind(&Handle::OnChange, wrap, path, events, status));
+
+            Handle* wrap = static_cast<Handle*>(handle->data);
+
+            if (status)
+                wrap->OnWatchError(status);
+            else
+                wrap->OnWatchEvent(filename ? filename : "", events);
+        }
+
+        static void Flush(uv_timer_t* timer)
+        {
+            NCJS_ASSERT(timer);
+
+            Handle* wrap = static_cast<Handle*>(timer);
+
+            std::vector<std::string> filenames;
+            std::vector<int> events;
+
+            filenames.reserve(wrap->m_changes.size());
+            events.reserve(wrap->m_changes.size());
+
+            for (Changes::const_iterator it = wrap->m_changes.begin();
+                 it != wrap->m_changes.end(); ++it) {
+                filenames.push_back(it->filename);
+                events.push_back(it->event);
+            }
+
+            wrap->PostCallback(base::Bind(&Handle::OnChanges, wrap,
+                                          filenames, events, wrap->m_dropped));
+            wrap->m_changes.clear();
+            wrap->m_index.clear();
+            wrap->m_dropped = false;
+        }
+
+        static void FreeEvent(uv_handle_t* handle)
+        {
+            delete reinterpret_cast<uv_fs_event_t*>(handle);
         }
 
         /// Declarations
         /// -----------------
 
         const std::string m_path;
-        const unsigned m_flags;
+        const bool m_recursive;
+        const unsigned m_debounce;  // ms
+
+        uv_fs_event_t* m_event;     // NULL with a FileWatcher
+
+        // loop thread only
+        Changes m_changes;          // in arrival order
+        ChangeIndex m_index;        // into m_changes, with a delay only
+        bool m_dropped;
     };
 
     // FSEvent.start()
     NCJS_OBJECT_FUNCTION(Start)(CefRefPtr<CefV8Value> object,
         const CefV8ValueList& args, CefRefPtr<CefV8Value>& retval, CefString& except)
     {
-        NCJS_CHK_EQ(args.size(), 3);
+        NCJS_CHK_GE(args.size(), 3);
 
         if (!args[0]->IsString())
             return Environment::TypeException(NCJS_TEXT("filename must be a valid string"), except);
@@ -128,11 +291,18 @@ class FSEvent : public JsObjecT<FSEvent> {
         if (Handle::Unwrap(objWrap))
             return; // already started
 
+        Environment* env = Environment::Get(CefV8Context::GetCurrentContext());
+
+        if (!env)
+            return Environment::ErrorException(NCJS_TEXT("context has been released"), except);
+
         const CefString path = args[0]->GetStringValue();
         // const bool persistent = args[1]->GetBoolValue(); // always persistent
-        const unsigned flags = args[2]->GetBoolValue() ? UV_FS_EVENT_RECURSIVE : 0;
+        const bool recursive = args[2]->GetBoolValue();
+        const int debounce = NCJS_ARG_IS(Int, args, 3) ? args[3]->GetIntValue() : 0;
 
-        CefRefPtr<Handle> handle(new Handle(object, path, flags));
+        CefRefPtr<Handle> handle(new Handle(*env, object, path, recursive,
+                                            unsigned(debounce > 0 ? debounce : 0)));
         handle->Wrap(objWrap);
         handle->OnStart();
     }
@@ -21,9 +21,9 @@
 #include "ncjs/module.h"
 #include "ncjs/constants.h"
 #include "ncjs/HandleWrap.h"
+#include "ncjs/StatPoller.h"
 #include "ncjs/module/fs.h"
 
-#include <include/wrapper/cef_closure_task.h>
 #include <uv.h>
 
 namespace ncjs {
@@ -42,51 +42,56 @@ namespace ncjs {
 
 class StatWatcher : public JsObjecT<StatWatcher> {
 
-    class Handle : public HandleWrap<Handle, uv_fs_poll_t, USER_DATA::STAT_WATCHER_WRAP> {
+    // polled by the StatPoller of the loop, the idle handle is never started,
+    // it only ends the life of the watcher with uv_close()
+    class Handle : public HandleWrap<Handle, uv_idle_t, USER_DATA::STAT_WATCHER_WRAP>,
+                   public StatPoller::Listener {
     public:
 
-        Handle(const CefRefPtr<CefV8Value>& handle, const CefString& path, unsigned interval) :
-            HandleWrap(handle), m_path(path.ToString()), m_interval(interval) {}
+        Handle(Environment& env, const CefRefPtr<CefV8Value>& handle, const CefString& path,
+               unsigned interval, bool shareStats) :
+            HandleWrap(env, handle), m_path(path.ToString()), m_interval(interval),
+            m_shareStats(shareStats) {}
 
     private:
 
-        void OnChange(int status, const uv_stat_t& prev, const uv_stat_t& curr)
+        void OnChange(int status, const uv_stat_t& prev, const uv_stat_t& curr,
+                      Environment* env)
         {
             if (!IsActive())
                 return;
 
-            if (Environment* env = EnterEnvironment()) {
+            if (env) {
                 CefV8ValueList args;
-                args.push_back(BuildStatsObject(*env, &curr));
-                args.push_back(BuildStatsObject(*env, &prev));
+                args.push_back(BuildStatsObject(*env, &curr, 0, m_shareStats));
+                args.push_back(BuildStatsObject(*env, &prev, 1, m_shareStats));
                 args.push_back(CefV8Value::CreateInt(status));
                 const CefRefPtr<CefV8Value>& handle = GetHandle();
                 const CefRefPtr<CefV8Value> callback = handle->GetValue(consts::str_onchange);
                 callback->ExecuteFunction(handle, args);
-
-                ExitEnvironment(env);
             }
         }
 
+        // the changes of a tick are posted together, CompletionQueue runs
+        // them in one renderer task
+        virtual void OnStatChange(int status, const uv_stat_t& prev,
+                                  const uv_stat_t& curr) OVERRIDE
+        {
+            PostCallback(base::Bind(&Handle::OnChange, this, status, prev, curr));
+        }
+
         virtual bool AsyncStart(uv_loop_t* loop) OVERRIDE
         {
-            int err = uv_fs_poll_init(loop, this);
-            if (err >= 0) {
-                err = uv_fs_poll_start(this, Handle::Callback, m_path.c_str(), m_interval);
-                return err >= 0;
-            }
+            if (uv_idle_init(loop, this) < 0)
+                return false;
 
-            return false;
+            StatPoller::Add(loop, m_path, m_interval, this);
+            return true;
         }
 
-        static void Callback(uv_fs_poll_t* handle, int status,
-                             const uv_stat_t* prev, const uv_stat_t* curr)
+        virtual void AsyncStop() OVERRIDE
         {
-            NCJS_ASSERT(handle);
-
-            Handle* wrap = static_cast<Handle*>(handle);
-            CefPostTask(TID_RENDERER,
-                        base::Bind(&Handle::OnChange, wrap, status, *prev, *curr));
+            StatPoller::Remove(static_cast<uv_idle_t*>(this)->loop, this);
         }
 
         /// Declarations
@@ -94,26 +99,31 @@ class StatWatcher : public JsObjecT<StatWatcher> {
 
         const std::string m_path;
         const unsigned m_interval;
+        const bool m_shareStats;
     };
 
-    // StatWatcher.start()
+    // StatWatcher.start(path, persistent, interval[, shareStats])
     NCJS_OBJECT_FUNCTION(Start)(CefRefPtr<CefV8Value> object,
         const CefV8ValueList& args, CefRefPtr<CefV8Value>& retval, CefString& except)
     {
-        NCJS_CHK_EQ(args.size(), 3);
+        NCJS_CHK_GE(args.size(), 3);
 
         CefRefPtr<CefV8Value> objWrap = object->GetValue(consts::str_wrap);
 
         if (Handle::Unwrap(objWrap))
             return; // already started
 
-        EventLoop& loop = Environment::GetAsyncLoop();
-        CefRefPtr<CefV8Context> context = CefV8Context::GetCurrentContext();
+        Environment* env = Environment::Get(CefV8Context::GetCurrentContext());
+
+        if (!env)
+            return Environment::ErrorException(NCJS_TEXT("context has been released"), except);
+
         const CefString path = args[0]->GetStringValue();
         // const bool persistent = args[1]->GetBoolValue(); // always persistent
         const unsigned interval = args[2]->GetUIntValue();
+        const bool shareStats = NCJS_ARG_IS(Bool, args, 3) && args[3]->GetBoolValue();
 
-        CefRefPtr<Handle> handle(new Handle(object, path, interval));
+        CefRefPtr<Handle> handle(new Handle(*env, object, path, interval, shareStats));
         handle->Wrap(objWrap);
         handle->OnStart();
     }
@@ -20,6 +20,9 @@
 
 #include "ncjs/module.h"
 #include "ncjs/constants.h"
+#include "ncjs/CompletionQueue.h"
+#include "ncjs/IoRing.h"
+#include "ncjs/ThreadPool.h"
 
 #include <uv.h>
 
@@ -55,10 +58,105 @@ class ModuleUV : public JsObjecT<ModuleUV> {
         retval = CefV8Value::CreateString(uv_err_name(err));
     }
 
+    // uv.getCompletionStats()
+    NCJS_OBJECT_FUNCTION(GetCompletionStats)(CefRefPtr<CefV8Value> object,
+        const CefV8ValueList& args, CefRefPtr<CefV8Value>& retval, CefString& except)
+    {
+        CompletionQueue::Stats stats;
+        CompletionQueue::GetStats(stats);
+
+        retval = CefV8Value::CreateObject(NULL);
+        NCJS_PROPERTY(Double, retval, NCJS_REFTEXT("batches"),     stats.batches);
+        NCJS_PROPERTY(Double, retval, NCJS_REFTEXT("completions"), stats.completions);
+        NCJS_PROPERTY(Double, retval, NCJS_REFTEXT("entries"),     stats.entries);
+        NCJS_PROPERTY(Double, retval, NCJS_REFTEXT("fullBatches"), stats.fullBatches);
+        NCJS_PROPERTY(UInt,   retval, NCJS_REFTEXT("largest"),     stats.largest);
+        NCJS_PROPERTY(UInt,   retval, NCJS_REFTEXT("pending"),     stats.pending);
+        NCJS_PROPERTY(UInt,   retval, NCJS_REFTEXT("maxBatchSize"),
+                      CompletionQueue::GetMaxBatchSize());
+        NCJS_PROPERTY(UInt,   retval, NCJS_REFTEXT("latency"),
+                      CompletionQueue::GetLatency());
+    }
+
+    // uv.getThreadPoolStats()
+    NCJS_OBJECT_FUNCTION(GetThreadPoolStats)(CefRefPtr<CefV8Value> object,
+        const CefV8ValueList& args, CefRefPtr<CefV8Value>& retval, CefString& except)
+    {
+        retval = CefV8Value::CreateObject(NULL);
+
+        for (int i = 0; i < ThreadPool::CLASS_COUNT; ++i) {
+            const ThreadPool::Class cls = ThreadPool::Class(i);
+            ThreadPool::Stats stats;
+            ThreadPool::GetStats(cls, stats);
+
+            CefRefPtr<CefV8Value> queue = CefV8Value::CreateObject(NULL);
+            NCJS_PROPERTY(UInt,   queue, NCJS_REFTEXT("threads"),   stats.threads);
+            NCJS_PROPERTY(UInt,   queue, NCJS_REFTEXT("pending"),   stats.pending);
+            NCJS_PROPERTY(UInt,   queue, NCJS_REFTEXT("running"),   stats.running);
+            NCJS_PROPERTY(Double, queue, NCJS_REFTEXT("completed"), stats.completed);
+
+            retval->SetValue(ThreadPool::GetClassName(cls), queue, V8_PROPERTY_ATTRIBUTE_NONE);
+        }
+    }
+
+    // uv.getIoRingStats()
+    NCJS_OBJECT_FUNCTION(GetIoRingStats)(CefRefPtr<CefV8Value> object,
+        const CefV8ValueList& args, CefRefPtr<CefV8Value>& retval, CefString& except)
+    {
+        IoRing::Stats stats;
+        IoRing::GetStats(stats);
+
+        retval = CefV8Value::CreateObject(NULL);
+        NCJS_PROPERTY(Bool,   retval, NCJS_REFTEXT("enabled"),     stats.enabled);
+        NCJS_PROPERTY(UInt,   retval, NCJS_REFTEXT("rings"),       stats.rings);
+        NCJS_PROPERTY(UInt,   retval, NCJS_REFTEXT("entries"),     stats.entries);
+        NCJS_PROPERTY(Double, retval, NCJS_REFTEXT("requests"),    stats.requests);
+        NCJS_PROPERTY(Double, retval, NCJS_REFTEXT("completions"), stats.completions);
+        NCJS_PROPERTY(Double, retval, NCJS_REFTEXT("enters"),      stats.enters);
+    }
+
+    // uv.setIoRingEnabled()
+    NCJS_OBJECT_FUNCTION(SetIoRingEnabled)(CefRefPtr<CefV8Value> object,
+        const CefV8ValueList& args, CefRefPtr<CefV8Value>& retval, CefString& except)
+    {
+        if (!NCJS_ARG_IS(Bool, args, 0)) {
+            except = NCJS_TEXT("enabled must be a boolean");
+            return;
+        }
+        // false if no ring is there to enable
+        retval = CefV8Value::CreateBool(IoRing::SetEnabled(args[0]->GetBoolValue()));
+    }
+
+    // uv.getAsyncLoops()
+    NCJS_OBJECT_FUNCTION(GetAsyncLoops)(CefRefPtr<CefV8Value> object,
+        const CefV8ValueList& args, CefRefPtr<CefV8Value>& retval, CefString& except)
+    {
+        Environment* env = Environment::Get(CefV8Context::GetCurrentContext());
+
+        if (!env)
+            return Environment::ErrorException(NCJS_TEXT("context has been released"), except);
+
+        const unsigned count = Environment::GetAsyncLoopCount();
+
+        CefRefPtr<CefV8Value> loads = CefV8Value::CreateArray(int(count));
+        for (unsigned i = 0; i < count; ++i)
+            loads->SetValue(int(i), CefV8Value::CreateUInt(Environment::GetAsyncLoopLoad(i)));
+
+        retval = CefV8Value::CreateObject(NULL);
+        NCJS_PROPERTY(UInt,  retval, NCJS_REFTEXT("count"), count);
+        NCJS_PROPERTY(UInt,  retval, NCJS_REFTEXT("current"), env->GetAsyncLoopIndex());
+        retval->SetValue(NCJS_REFTEXT("loads"), loads, V8_PROPERTY_ATTRIBUTE_NONE);
+    }
+
     // object factory
 
     NCJS_BEGIN_OBJECT_FACTORY()
         NCJS_MAP_OBJECT_FUNCTION("errname", ErrName)
+        NCJS_MAP_OBJECT_FUNCTION("getCompletionStats", GetCompletionStats)
+        NCJS_MAP_OBJECT_FUNCTION("getAsyncLoops", GetAsyncLoops)
+        NCJS_MAP_OBJECT_FUNCTION("getThreadPoolStats", GetThreadPoolStats)
+        NCJS_MAP_OBJECT_FUNCTION("getIoRingStats", GetIoRingStats)
+        NCJS_MAP_OBJECT_FUNCTION("setIoRingEnabled", SetIoRingEnabled)
 
         NCJS_MAP_OBJECT_EXTRA(DefineUvConstants)
     NCJS_END_OBJECT_FACTORY()
@@ -24,8 +24,27 @@ const kNoZeroFill = 0;
 function BufferWrap() {}
 BufferWrap.prototype.subarray = bindingObj.subarray;
 // NCJS: Uint8Array[] -> BufferWrap.get()/set()
-BufferWrap.prototype.getAt = bindingObj.getAt;
-BufferWrap.prototype.setAt = bindingObj.setAt;
+if (typeof bindingObj.arrayBuffer === 'function') {
+  // CEF 3.2840+: access the native memory through a Uint8Array view,
+  // created on first access, instead of a native call per byte.
+  const arrayBuffer = bindingObj.arrayBuffer;
+  Object.defineProperty(BufferWrap.prototype, '_view', {
+    get: function() {
+      const view = new Uint8Array(arrayBuffer.call(this));
+      Object.defineProperty(this, '_view', { value: view });
+      return view;
+    }
+  });
+  BufferWrap.prototype.getAt = function(offset) {
+    return this._view[offset];
+  };
+  BufferWrap.prototype.setAt = function(offset, value) {
+    return (this._view[offset] = value);
+  };
+} else {
+  BufferWrap.prototype.getAt = bindingObj.getAt;
+  BufferWrap.prototype.setAt = bindingObj.setAt;
+}
 
 function createBuffer(size) {
   const ui8 = bindingObj.createBuffer(size);
@@ -86,6 +105,37 @@ Object.setPrototypeOf(SlowBuffer.prototype, BufferWrap.prototype);
 Object.setPrototypeOf(SlowBuffer, BufferWrap);
 
 
+// the binding takes the size as an unsigned integer, -1 would become 4 GB
+function assertSize(size) {
+  if (typeof size !== 'number')
+    throw new TypeError('"size" argument must be a number');
+  if (size < 0 || size !== size)
+    throw new RangeError('"size" argument must not be negative');
+  if (size > binding.kMaxLength)
+    throw new RangeError('"size" argument must not be larger than ' +
+                         binding.kMaxLength);
+}
+
+
+Buffer.alloc = function(size, fill, encoding) {
+  assertSize(size);
+  if (size === 0)
+    return createBuffer(size);
+  if (!fill || fill.length === 0)
+    return createBuffer(size);
+  // Filled in a single pass, no need to zero the memory first. Large
+  // buffers come from fresh mappings which are zeroed anyway.
+  flags[kNoZeroFill] = 1;
+  return createBuffer(size).fill(fill, 0, size, encoding);
+};
+
+
+Buffer.allocUnsafe = function(size) {
+  assertSize(size);
+  return allocate(size);
+};
+
+
 function allocate(size) {
   if (size === 0) {
     return createBuffer(size);
@@ -484,7 +534,16 @@ Buffer.prototype.indexOf = function indexOf(val, byteOffset, encoding) {
 };
 
 
-Buffer.prototype.fill = function fill(val, start, end) {
+Buffer.prototype.fill = function fill(val, start, end, encoding) {
+  if (typeof start === 'string') {
+    encoding = start;
+    start = 0;
+    end = this.length;
+  } else if (typeof end === 'string') {
+    encoding = end;
+    end = this.length;
+  }
+
   start = start >> 0;
   end = (end === undefined) ? this.length : end >> 0;
 
@@ -493,12 +552,26 @@ Buffer.prototype.fill = function fill(val, start, end) {
   if (end <= start)
     return this;
 
-  if (typeof val !== 'string') {
+  if (typeof val === 'string') {
+    if (encoding !== undefined && typeof encoding !== 'string')
+      throw new TypeError('encoding must be a string');
+    if (typeof encoding === 'string' && !Buffer.isEncoding(encoding))
+      throw new TypeError('Unknown encoding: ' + encoding);
+
+    encoding = (encoding || 'utf8').toLowerCase();
+    if (encoding !== 'utf8' && encoding !== 'utf-8') {
+      // The native side takes UTF-8 text, other encodings fill the bytes.
+      val = fromString(val, encoding);
+      // Nothing decoded, zero the range rather than leaving it as it was.
+      if (val.length === 0)
+        val = 0;
+    } else if (val.length === 1) {
+      var code = val.charCodeAt(0);
+      if (code < 256)
+        val = code;
+    }
+  } else if (!(val instanceof Buffer)) {
     val = val >>> 0;
-  } else if (val.length === 1) {
-    var code = val.charCodeAt(0);
-    if (code < 256)
-      val = code;
   }
 
   binding.fill(this, val, start, end);
@@ -641,14 +714,7 @@ Buffer.prototype.readUIntLE = function(offset, byteLength, noAssert) {
   byteLength = byteLength >>> 0;
   if (!noAssert)
     checkOffset(offset, byteLength, this.length);
-
-  var val = this.getAt(offset);
-  var mul = 1;
-  var i = 0;
-  while (++i < byteLength && (mul *= 0x100))
-    val += this.getAt(offset + i) * mul;
-
-  return val;
+  return binding.readUIntLE(this, offset, byteLength);
 };
 
 
@@ -657,13 +723,7 @@ Buffer.prototype.readUIntBE = function(offset, byteLength, noAssert) {
   byteLength = byteLength >>> 0;
   if (!noAssert)
     checkOffset(offset, byteLength, this.length);
-
-  var val = this.getAt(offset + --byteLength);
-  var mul = 1;
-  while (byteLength > 0 && (mul *= 0x100))
-    val += this.getAt(offset + --byteLength) * mul;
-
-  return val;
+  return binding.readUIntBE(this, offset, byteLength);
 };
 
 
@@ -720,18 +780,7 @@ Buffer.prototype.readIntLE = function(offset, byteLength, noAssert) {
   byteLength = byteLength >>> 0;
   if (!noAssert)
     checkOffset(offset, byteLength, this.length);
-
-  var val = this.getAt(offset);
-  var mul = 1;
-  var i = 0;
-  while (++i < byteLength && (mul *= 0x100))
-    val += this.getAt(offset + i) * mul;
-  mul *= 0x80;
-
-  if (val >= mul)
-    val -= Math.pow(2, 8 * byteLength);
-
-  return val;
+  return binding.readIntLE(this, offset, byteLength);
 };
 
 
@@ -740,18 +789,7 @@ Buffer.prototype.readIntBE = function(offset, byteLength, noAssert) {
   byteLength = byteLength >>> 0;
   if (!noAssert)
     checkOffset(offset, byteLength, this.length);
-
-  var i = byteLength;
-  var mul = 1;
-  var val = this.getAt(offset + --i);
-  while (i > 0 && (mul *= 0x100))
-    val += this.getAt(offset + --i) * mul;
-  mul *= 0x80;
-
-  if (val >= mul)
-    val -= Math.pow(2, 8 * byteLength);
-
-  return val;
+  return binding.readIntBE(this, offset, byteLength);
 };
 
 
@@ -856,13 +894,7 @@ Buffer.prototype.writeUIntLE = function(value, offset, byteLength, noAssert) {
     const maxBytes = Math.pow(2, 8 * byteLength) - 1;
     checkInt(this, value, offset, byteLength, maxBytes, 0);
   }
-
-  var mul = 1;
-  var i = 0;
-  this.setAt(offset, value & 0xff);
-  while (++i < byteLength && (mul *= 0x100))
-    this.setAt(offset + i, (value / mul) & 0xff);
-
+  binding.writeIntLE(this, value, offset, byteLength);
   return offset + byteLength;
 };
 
@@ -875,13 +907,7 @@ Buffer.prototype.writeUIntBE = function(value, offset, byteLength, noAssert) {
     const maxBytes = Math.pow(2, 8 * byteLength) - 1;
     checkInt(this, value, offset, byteLength, maxBytes, 0);
   }
-
-  var i = byteLength - 1;
-  var mul = 1;
-  this.setAt(offset + i, value & 0xff);
-  while (--i >= 0 && (mul *= 0x100))
-    this.setAt(offset + i, (value / mul) & 0xff);
-
+  binding.writeIntBE(this, value, offset, byteLength);
   return offset + byteLength;
 };
 
@@ -947,6 +973,7 @@ Buffer.prototype.writeUInt32BE = function(value, offset, noAssert) {
 Buffer.prototype.writeIntLE = function(value, offset, byteLength, noAssert) {
   value = +value;
   offset = offset >>> 0;
+  byteLength = byteLength >>> 0;
   if (!noAssert) {
     checkInt(this,
              value,
@@ -955,17 +982,7 @@ Buffer.prototype.writeIntLE = function(value, offset, byteLength, noAssert) {
              Math.pow(2, 8 * byteLength - 1) - 1,
              -Math.pow(2, 8 * byteLength - 1));
   }
-
-  var i = 0;
-  var mul = 1;
-  var sub = 0;
-  this.setAt(offset, value & 0xff);
-  while (++i < byteLength && (mul *= 0x100)) {
-    if (value < 0 && sub === 0 && this.getAt(offset + i - 1) !== 0)
-      sub = 1;
-    this.setAt(offset + i, (value / mul - sub) & 0xff);
-  }
-
+  binding.writeIntLE(this, value, offset, byteLength);
   return offset + byteLength;
 };
 
@@ -973,6 +990,7 @@ Buffer.prototype.writeIntLE = function(value, offset, byteLength, noAssert) {
 Buffer.prototype.writeIntBE = function(value, offset, byteLength, noAssert) {
   value = +value;
   offset = offset >>> 0;
+  byteLength = byteLength >>> 0;
   if (!noAssert) {
     checkInt(this,
              value,
@@ -981,17 +999,7 @@ Buffer.prototype.writeIntBE = function(value, offset, byteLength, noAssert) {
              Math.pow(2, 8 * byteLength - 1) - 1,
              -Math.pow(2, 8 * byteLength - 1));
   }
-
-  var i = byteLength - 1;
-  var mul = 1;
-  var sub = 0;
-  this.setAt(offset + i, value & 0xff);
-  while (--i >= 0 && (mul *= 0x100)) {
-    if (value < 0 && sub === 0 && this.getAt(offset + i + 1) !== 0)
-      sub = 1;
-    this.setAt(offset + i, (value / mul - sub) & 0xff);
-  }
-
+  binding.writeIntBE(this, value, offset, byteLength);
   return offset + byteLength;
 };
 
@@ -1054,6 +1062,159 @@ Buffer.prototype.writeInt32BE = function(value, offset, noAssert) {
 };
 
 
+
+// 64-bit integers are exact up to Number.MAX_SAFE_INTEGER
+// the largest doubles below 2^64 and 2^63, the literals of 2^64 - 1 and
+// 2^63 - 1 round up to them and would let them through checkInt()
+const kMaxUInt64 = 0xfffffffffffff800;
+const kMaxInt64 = 0x7ffffffffffffc00;
+
+Buffer.prototype.readUInt64LE = function(offset, noAssert) {
+  offset = offset >>> 0;
+  if (!noAssert)
+    checkOffset(offset, 8, this.length);
+  return binding.readUIntLE(this, offset, 8);
+};
+
+
+Buffer.prototype.readUInt64BE = function(offset, noAssert) {
+  offset = offset >>> 0;
+  if (!noAssert)
+    checkOffset(offset, 8, this.length);
+  return binding.readUIntBE(this, offset, 8);
+};
+
+
+Buffer.prototype.readInt64LE = function(offset, noAssert) {
+  offset = offset >>> 0;
+  if (!noAssert)
+    checkOffset(offset, 8, this.length);
+  return binding.readIntLE(this, offset, 8);
+};
+
+
+Buffer.prototype.readInt64BE = function(offset, noAssert) {
+  offset = offset >>> 0;
+  if (!noAssert)
+    checkOffset(offset, 8, this.length);
+  return binding.readIntBE(this, offset, 8);
+};
+
+
+Buffer.prototype.writeUInt64LE = function(value, offset, noAssert) {
+  value = +value;
+  offset = offset >>> 0;
+  if (!noAssert)
+    checkInt(this, value, offset, 8, kMaxUInt64, 0);
+  binding.writeIntLE(this, value, offset, 8);
+  return offset + 8;
+};
+
+
+Buffer.prototype.writeUInt64BE = function(value, offset, noAssert) {
+  value = +value;
+  offset = offset >>> 0;
+  if (!noAssert)
+    checkInt(this, value, offset, 8, kMaxUInt64, 0);
+  binding.writeIntBE(this, value, offset, 8);
+  return offset + 8;
+};
+
+
+Buffer.prototype.writeInt64LE = function(value, offset, noAssert) {
+  value = +value;
+  offset = offset >>> 0;
+  if (!noAssert)
+    checkInt(this, value, offset, 8, kMaxInt64, -0x8000000000000000);
+  binding.writeIntLE(this, value, offset, 8);
+  return offset + 8;
+};
+
+
+Buffer.prototype.writeInt64BE = function(value, offset, noAssert) {
+  value = +value;
+  offset = offset >>> 0;
+  if (!noAssert)
+    checkInt(this, value, offset, 8, kMaxInt64, -0x8000000000000000);
+  binding.writeIntBE(this, value, offset, 8);
+  return offset + 8;
+};
+
+
+// NCJS: without the Uint8Array view every getAt()/setAt() is a native
+// call, so decode the fixed-width integers with a single one instead.
+if (typeof bindingObj.arrayBuffer !== 'function') {
+  const nativeRead = function(read, byteLength) {
+    return function(offset, noAssert) {
+      offset = offset >>> 0;
+      if (!noAssert)
+        checkOffset(offset, byteLength, this.length);
+      return read(this, offset, byteLength);
+    };
+  };
+
+  const nativeWrite = function(write, byteLength, max, min) {
+    return function(value, offset, noAssert) {
+      value = +value;
+      offset = offset >>> 0;
+      if (!noAssert)
+        checkInt(this, value, offset, byteLength, max, min);
+      write(this, value, offset, byteLength);
+      return offset + byteLength;
+    };
+  };
+
+  Buffer.prototype.readUInt16LE = nativeRead(binding.readUIntLE, 2);
+  Buffer.prototype.readUInt16BE = nativeRead(binding.readUIntBE, 2);
+  Buffer.prototype.readUInt32LE = nativeRead(binding.readUIntLE, 4);
+  Buffer.prototype.readUInt32BE = nativeRead(binding.readUIntBE, 4);
+  Buffer.prototype.readInt16LE = nativeRead(binding.readIntLE, 2);
+  Buffer.prototype.readInt16BE = nativeRead(binding.readIntBE, 2);
+  Buffer.prototype.readInt32LE = nativeRead(binding.readIntLE, 4);
+  Buffer.prototype.readInt32BE = nativeRead(binding.readIntBE, 4);
+
+  Buffer.prototype.writeUInt16LE =
+      nativeWrite(binding.writeIntLE, 2, 0xffff, 0);
+  Buffer.prototype.writeUInt16BE =
+      nativeWrite(binding.writeIntBE, 2, 0xffff, 0);
+  Buffer.prototype.writeUInt32LE =
+      nativeWrite(binding.writeIntLE, 4, 0xffffffff, 0);
+  Buffer.prototype.writeUInt32BE =
+      nativeWrite(binding.writeIntBE, 4, 0xffffffff, 0);
+  Buffer.prototype.writeInt16LE =
+      nativeWrite(binding.writeIntLE, 2, 0x7fff, -0x8000);
+  Buffer.prototype.writeInt16BE =
+      nativeWrite(binding.writeIntBE, 2, 0x7fff, -0x8000);
+  Buffer.prototype.writeInt32LE =
+      nativeWrite(binding.writeIntLE, 4, 0x7fffffff, -0x80000000);
+  Buffer.prototype.writeInt32BE =
+      nativeWrite(binding.writeIntBE, 4, 0x7fffffff, -0x80000000);
+}
+
+
+// NCJS: batched decoding, e.g. buf.readUInt32LEArray(offset, count[, stride])
+// reads count fields starting at offset, stride bytes apart (defaults to
+// the field size), with one native call.
+[
+  ['Int8', 1], ['UInt8', 1],
+  ['Int16LE', 2], ['Int16BE', 2], ['UInt16LE', 2], ['UInt16BE', 2],
+  ['Int32LE', 4], ['Int32BE', 4], ['UInt32LE', 4], ['UInt32BE', 4],
+  ['Int64LE', 8], ['Int64BE', 8], ['UInt64LE', 8], ['UInt64BE', 8],
+  ['FloatLE', 4], ['FloatBE', 4], ['DoubleLE', 8], ['DoubleBE', 8]
+].forEach(function(field) {
+  const type = field[0];
+  const size = field[1];
+
+  Buffer.prototype['read' + type + 'Array'] = function(offset, count, stride) {
+    offset = offset >>> 0;
+    count = count >>> 0;
+    stride = stride === undefined ? size : stride >>> 0;
+    if (count > 0)
+      checkOffset(offset + (count - 1) * stride, size, this.length);
+    return binding.readArray(this, type, offset, count, stride);
+  };
+});
+
 function checkFloat(buffer, value, offset, ext) {
   if (!(buffer instanceof Buffer))
     throw new TypeError('buffer must be a Buffer instance');
@@ -128,15 +128,76 @@ fs.Stats = function(
   this.ino = ino;
   this.size = size;
   this.blocks = blocks;
-  this.atime = new Date(atim_msec);
-  this.mtime = new Date(mtim_msec);
-  this.ctime = new Date(ctim_msec);
-  this.birthtime = new Date(birthtim_msec);
-};
+  this.atimeMs = atim_msec;
+  this.mtimeMs = mtim_msec;
+  this.ctimeMs = ctim_msec;
+  this.birthtimeMs = birthtim_msec;
+  Object.defineProperties(this, lazyDates);
+};
+
+// The Date objects are created on first access, most callers never look at
+// them. They are still own enumerable properties, so Object.keys() and
+// JSON.stringify() see them. Assigning replaces the accessor with a plain
+// own property.
+const lazyDates = {};
+
+function defineLazyDate(name, msec) {
+  function setDate(stats, date) {
+    Object.defineProperty(stats, name, {
+      value: date, writable: true, enumerable: true, configurable: true
+    });
+    return date;
+  }
+  lazyDates[name] = {
+    enumerable: true,
+    configurable: true,
+    get: function() { return setDate(this, new Date(this[msec])); },
+    set: function(date) { setDate(this, date); }
+  };
+}
+
+defineLazyDate('atime', 'atimeMs');
+defineLazyDate('mtime', 'mtimeMs');
+defineLazyDate('ctime', 'ctimeMs');
+defineLazyDate('birthtime', 'birthtimeMs');
 
 // Create a C++ binding to the function which creates a Stats object.
 binding.FSInitialize(fs.Stats);
 
+// Fields of the Stats delivered by the stat bindings, which return undefined
+// instead of a Stats object when passed kShareStats, see statsFromValues().
+// Other callers of the bindings still get Stats objects.
+const statValues = binding.statValues ?
+    new Float64Array(binding.statValues(true)) : null;
+const kShareStats = statValues !== null;
+
+// NaN marks fields not available on the platform
+function statField(value) {
+  return value === value ? value : undefined;
+}
+
+// Stats from the shared values of the given slot, must be called before the
+// next stat binding call overwrites them.
+function statsFromValues(slot) {
+  const v = statValues;
+  const o = slot * 14;
+  return new fs.Stats(v[o], v[o + 1], v[o + 2], v[o + 3], v[o + 4], v[o + 5],
+                      statField(v[o + 6]), v[o + 7], v[o + 8],
+                      statField(v[o + 9]), v[o + 10], v[o + 11], v[o + 12],
+                      v[o + 13]);
+}
+
+function toStats(stats, slot) {
+  return stats === undefined ? statsFromValues(slot || 0) : stats;
+}
+
+function makeStatsCallback(callback) {
+  return function(err, stats) {
+    if (err) return callback(err);
+    callback(null, toStats(stats));
+  };
+}
+
 fs.Stats.prototype._checkModeProperty = function(property) {
   return ((this.mode & constants.S_IFMT) === property);
 };
@@ -170,7 +231,8 @@ fs.Stats.prototype.isSocket = function() {
 };
 
 // Don't allow mode to accidentally be overwritten.
-['F_OK', 'R_OK', 'W_OK', 'X_OK'].forEach(function(key) {
+['F_OK', 'R_OK', 'W_OK', 'X_OK', 'COPYFILE_EXCL', 'COPYFILE_FICLONE',
+ 'COPYFILE_FICLONE_FORCE'].forEach(function(key) {
   Object.defineProperty(fs, key, {
     enumerable: true, value: constants[key] || 0, writable: false
   });
@@ -208,7 +270,7 @@ fs.exists = function(path, callback) {
   if (!nullCheck(path, cb)) return;
   var req = new FSReqWrap();
   req.oncomplete = cb;
-  binding.stat(pathModule._makeLong(path), req);
+  binding.stat(pathModule._makeLong(path), req, kShareStats);
   function cb(err, stats) {
     if (callback) callback(err ? false : true);
   }
@@ -217,7 +279,7 @@ fs.exists = function(path, callback) {
 fs.existsSync = function(path) {
   try {
     nullCheck(path);
-    binding.stat(pathModule._makeLong(path));
+    binding.stat(pathModule._makeLong(path), undefined, kShareStats);
     return true;
   } catch (e) {
     return false;
@@ -243,142 +305,38 @@ fs.readFile = function(path, options, callback_) {
   if (!nullCheck(path, callback))
     return;
 
-  var context = new ReadFileContext(callback, encoding);
-  var req = new FSReqWrap();
-  req.context = context;
-  req.oncomplete = readFileAfterOpen;
-
-  binding.open(pathModule._makeLong(path),
-               stringToFlags(flag),
-               0o666,
-               req);
-};
-
-const kReadFileBufferLength = 8 * 1024;
-
-function ReadFileContext(callback, encoding) {
-  this.fd = undefined;
-  this.size = undefined;
-  this.callback = callback;
-  this.buffers = null;
-  this.buffer = null;
-  this.pos = 0;
-  this.encoding = encoding;
-  this.err = null;
-}
-
-ReadFileContext.prototype.read = function() {
-  var buffer;
-  var offset;
-  var length;
-
-  if (this.size === 0) {
-    buffer = this.buffer = new SlowBuffer(kReadFileBufferLength);
-    offset = 0;
-    length = kReadFileBufferLength;
-  } else {
-    buffer = this.buffer;
-    offset = this.pos;
-    length = this.size - this.pos;
-  }
-
+  // opened, sized, read and closed in one go on the thread pool, utf8 is
+  // decoded there as well
   var req = new FSReqWrap();
+  req.callback = callback;
+  req.encoding = encoding;
   req.oncomplete = readFileAfterRead;
-  req.context = this;
 
-  binding.read(this.fd, buffer, offset, length, -1, req);
+  binding.readFile(pathModule._makeLong(path),
+                   stringToFlags(flag),
+                   typeof encoding === 'string' && /^utf-?8$/i.test(encoding),
+                   req);
 };
 
-ReadFileContext.prototype.close = function(err) {
-  var req = new FSReqWrap();
-  req.oncomplete = readFileAfterClose;
-  req.context = this;
-  this.err = err;
-  binding.close(this.fd, req);
-};
-
-function readFileAfterOpen(err, fd) {
-  var context = this.context;
-
-  if (err) {
-    context.callback(err);
-    return;
-  }
-
-  context.fd = fd;
-
-  var req = new FSReqWrap();
-  req.oncomplete = readFileAfterStat;
-  req.context = context;
-  binding.fstat(fd, req);
-}
-
-function readFileAfterStat(err, st) {
-  var context = this.context;
-
-  if (err)
-    return context.close(err);
-
-  var size = context.size = st.isFile() ? st.size : 0;
-
-  if (size === 0) {
-    context.buffers = [];
-    context.read();
-    return;
-  }
-
-  if (size > kMaxLength) {
-    err = new RangeError('File size is greater than possible Buffer: ' +
-                         `0x${kMaxLength.toString(16)} bytes`);
-    return context.close(err);
-  }
-
-  context.buffer = new SlowBuffer(size);
-  context.read();
-}
-
-function readFileAfterRead(err, bytesRead) {
-  var context = this.context;
+function readFileAfterRead(err, data) {
+  var callback = this.callback;
 
   if (err)
-    return context.close(err);
-
-  if (bytesRead === 0)
-    return context.close();
-
-  context.pos += bytesRead;
-
-  if (context.size !== 0) {
-    if (context.pos === context.size)
-      context.close();
-    else
-      context.read();
-  } else {
-    // unknown size, just read until we don't get bytes.
-    context.buffers.push(context.buffer.slice(0, bytesRead));
-    context.read();
+    return callback(err);
+
+  if (typeof data !== 'string') {
+    Object.setPrototypeOf(data, Buffer.prototype);
+    // V8 can't hold longer strings, reported as utf8 is natively
+    if (this.encoding) {
+      try {
+        data = data.toString(this.encoding);
+      } catch (e) {
+        return callback(new RangeError('File is longer than the maximum string length'));
+      }
+    }
   }
-}
 
-function readFileAfterClose(err) {
-  var context = this.context;
-  var buffer = null;
-  var callback = context.callback;
-
-  if (context.err)
-    return callback(context.err);
-
-  if (context.size === 0)
-    buffer = Buffer.concat(context.buffers, context.pos);
-  else if (context.pos < context.size)
-    buffer = context.buffer.slice(0, context.pos);
-  else
-    buffer = context.buffer;
-
-  if (context.encoding)
-    buffer = buffer.toString(context.encoding);
-
-  callback(err, buffer);
+  callback(null, data);
 }
 
 
@@ -395,6 +353,12 @@ fs.readFileSync = function(path, options) {
   assertEncoding(encoding);
 
   var flag = options.flag || 'r';
+
+  if (flag === 'r' && typeof path === 'string' && kArchivePath.test(path)) {
+    var archived = readArchiveSync(path, encoding);
+    if (archived !== undefined) return archived;
+  }
+
   var fd = fs.openSync(path, flag, 0o666);
 
   var st;
@@ -464,6 +428,23 @@ fs.readFileSync = function(path, options) {
 };
 
 
+// Files in a pack (*.ncpk) are copied straight out of its mapping,
+// undefined if the path doesn't go through one.
+const kArchivePath = /\.ncpk(?:[\/\\]|$)/;
+
+function readArchiveSync(path, encoding) {
+  path = pathModule._makeLong(pathModule.resolve(path));
+
+  const size = binding.internalArchiveSize(path);
+  if (size === undefined) return;
+
+  var buffer = Buffer.allocUnsafe(size);
+  binding.internalArchiveRead(path, buffer);
+
+  return encoding ? buffer.toString(encoding) : buffer;
+}
+
+
 // Used by binding.open and friends
 function stringToFlags(flag) {
   // Only mess with strings
@@ -796,53 +777,250 @@ fs.mkdirSync = function(path, mode) {
                        modeNum(mode, 0o777));
 };
 
-fs.readdir = function(path, callback) {
-  callback = makeCallback(callback);
+// Entries of fs.readdir(path, { withFileTypes: true }), typed by the
+// directory listing itself, without a stat() call each.
+function Dirent(name, type) {
+  this.name = name;
+  this._type = type;
+}
+
+Dirent.prototype.isDirectory = function() {
+  return this._type === binding.UV_DIRENT_DIR;
+};
+
+Dirent.prototype.isFile = function() {
+  return this._type === binding.UV_DIRENT_FILE;
+};
+
+Dirent.prototype.isBlockDevice = function() {
+  return this._type === binding.UV_DIRENT_BLOCK;
+};
+
+Dirent.prototype.isCharacterDevice = function() {
+  return this._type === binding.UV_DIRENT_CHAR;
+};
+
+Dirent.prototype.isSymbolicLink = function() {
+  return this._type === binding.UV_DIRENT_LINK;
+};
+
+Dirent.prototype.isFIFO = function() {
+  return this._type === binding.UV_DIRENT_FIFO;
+};
+
+Dirent.prototype.isSocket = function() {
+  return this._type === binding.UV_DIRENT_SOCKET;
+};
+
+// some file systems don't tell the types, stat() those entries
+Dirent.prototype.isUnknown = function() {
+  return this._type === binding.UV_DIRENT_UNKNOWN;
+};
+
+fs.Dirent = Dirent;
+
+function toDirents(names, types) {
+  var dirents = new Array(names.length);
+  for (var i = 0; i < names.length; i++)
+    dirents[i] = new Dirent(names[i], types[i]);
+  return dirents;
+}
+
+// [names, types, packed] from binding.scandir() into fs.Stats objects,
+// packed is an ArrayBuffer of doubles or a plain array of numbers, null for
+// entries gone before they could be stat'ed, which have a NaN dev
+function toStatsArray(count, packed) {
+  const F = 14;
+  const v = packed instanceof ArrayBuffer ? new Float64Array(packed) : packed;
+  var stats = new Array(count);
+  for (var i = 0, o = 0; i < count; i++, o += F) {
+    stats[i] = v[o] !== v[o] ? null :
+        new fs.Stats(v[o], v[o + 1], v[o + 2], v[o + 3], v[o + 4], v[o + 5],
+                     statField(v[o + 6]), v[o + 7], v[o + 8],
+                     statField(v[o + 9]), v[o + 10], v[o + 11], v[o + 12],
+                     v[o + 13]);
+  }
+  return stats;
+}
+
+fs.readdir = function(path, options, callback) {
+  callback = makeCallback(arguments[arguments.length - 1]);
+  if (!options || typeof options === 'function')
+    options = {};
   if (!nullCheck(path, callback)) return;
   var req = new FSReqWrap();
+
+  if (options.withFileTypes) {
+    req.oncomplete = function(err, names, types) {
+      if (err) return callback(err);
+      callback(null, toDirents(names, types));
+    };
+    binding.scandir(pathModule._makeLong(path), false, req);
+    return;
+  }
+
   req.oncomplete = callback;
   binding.readdir(pathModule._makeLong(path), req);
 };
 
-fs.readdirSync = function(path) {
+fs.readdirSync = function(path, options) {
   nullCheck(path);
+  if (options && options.withFileTypes) {
+    var result = binding.scandir(pathModule._makeLong(path), false);
+    return toDirents(result[0], result[1]);
+  }
   return binding.readdir(pathModule._makeLong(path));
 };
 
+// Lists a directory and stats all of its entries in a single thread pool
+// job, callback(err, { names, stats }) as readdirStatSync() returns it, with
+// stats[i] null for entries removed in the meantime.
+fs.readdirStat = function(path, callback) {
+  callback = makeCallback(callback);
+  if (!nullCheck(path, callback)) return;
+  var req = new FSReqWrap();
+  req.oncomplete = function(err, names, types, packed) {
+    if (err) return callback(err);
+    callback(null, { names: names, stats: toStatsArray(names.length, packed) });
+  };
+  binding.scandir(pathModule._makeLong(path), true, req);
+};
+
+fs.readdirStatSync = function(path) {
+  nullCheck(path);
+  var result = binding.scandir(pathModule._makeLong(path), true);
+  return { names: result[0], stats: toStatsArray(result[0].length, result[2]) };
+};
+
+// Walks a directory tree on the thread pool, emits 'entries' with arrays of
+// Dirents named relative to root, 'skip' for the directories that couldn't
+// be read, 'error' if root itself couldn't, then 'end'. Options:
+//   depth        levels of entries below root to list, 1 for the entries
+//                of root only, 0 for none (Infinity)
+//   glob         pattern or array of, a '**' component crosses directories
+//                and those without '/' match the names at any level
+//   extensions   array of name suffixes, like ['.js', '.json']
+//   symlinks     'ignore', 'report' (as links) or 'follow'
+//   stats        adds dirent.stats, lstat() unless links are followed
+//   concurrency  directories read at once (4)
+//   batchSize    entries of one 'entries' event (256)
+function Walker(root) {
+  EventEmitter.call(this);
+  this.root = root;
+  this.closed = false;
+}
+util.inherits(Walker, EventEmitter);
+
+// nothing more is emitted, the walk stops with the batch being read
+Walker.prototype.close = function() {
+  this.closed = true;
+};
+
+const walkSymlinks = { ignore: 0, report: 1, follow: 2 };
+
+function toArray(value) {
+  if (value === undefined || value === null)
+    return null;
+  return Array.isArray(value) ? value.map(String) : [String(value)];
+}
+
+fs.walk = function(root, options) {
+  nullCheck(root);
+  options = options || {};
+
+  const symlinks = walkSymlinks[options.symlinks || 'report'];
+  if (symlinks === undefined)
+    throw new TypeError('symlinks must be ignore, report or follow');
+
+  const depth = options.depth === undefined || options.depth === Infinity ?
+                -1 : Math.max(0, options.depth | 0);
+  const extensions = toArray(options.extensions);
+  if (extensions) {
+    for (var i = 0; i < extensions.length; i++) {
+      if (extensions[i][0] !== '.')
+        extensions[i] = '.' + extensions[i];
+    }
+  }
+
+  const walker = new Walker(root);
+  const sep = /[\/\\]$/.test(root) ? '' : pathModule.sep;
+  const req = new FSReqWrap();
+
+  req.onentries = function(names, types, packed, errors) {
+    if (walker.closed) return false;
+
+    for (var i = 0; i < errors.length; i++)
+      walker.emit('skip', new Error(errors[i]));
+
+    if (names.length) {
+      const stats = packed ? toStatsArray(names.length, packed) : null;
+      const dirents = toDirents(names, types);
+      for (var j = 0; j < dirents.length; j++) {
+        dirents[j].path = root + sep + names[j];
+        if (stats) dirents[j].stats = stats[j];
+      }
+      walker.emit('entries', dirents);
+    }
+
+    return !walker.closed;
+  };
+
+  req.oncomplete = function(err) {
+    if (walker.closed) return;
+    walker.closed = true;
+    if (err) walker.emit('error', new Error(err));
+    else walker.emit('end');
+  };
+
+  binding.walk(pathModule._makeLong(root),
+               depth,
+               toArray(options.glob),
+               extensions,
+               symlinks,
+               !!options.stats,
+               options.concurrency === undefined ? 4 : options.concurrency | 0,
+               options.batchSize === undefined ? 256 : options.batchSize | 0,
+               req);
+
+  return walker;
+};
+
 fs.fstat = function(fd, callback) {
   var req = new FSReqWrap();
-  req.oncomplete = makeCallback(callback);
-  binding.fstat(fd, req);
+  req.oncomplete = makeStatsCallback(makeCallback(callback));
+  binding.fstat(fd, req, kShareStats);
 };
 
 fs.lstat = function(path, callback) {
   callback = makeCallback(callback);
   if (!nullCheck(path, callback)) return;
   var req = new FSReqWrap();
-  req.oncomplete = callback;
-  binding.lstat(pathModule._makeLong(path), req);
+  req.oncomplete = makeStatsCallback(callback);
+  binding.lstat(pathModule._makeLong(path), req, kShareStats);
 };
 
 fs.stat = function(path, callback) {
   callback = makeCallback(callback);
   if (!nullCheck(path, callback)) return;
   var req = new FSReqWrap();
-  req.oncomplete = callback;
-  binding.stat(pathModule._makeLong(path), req);
+  req.oncomplete = makeStatsCallback(callback);
+  binding.stat(pathModule._makeLong(path), req, kShareStats);
 };
 
 fs.fstatSync = function(fd) {
-  return binding.fstat(fd);
+  return toStats(binding.fstat(fd, undefined, kShareStats));
 };
 
 fs.lstatSync = function(path) {
   nullCheck(path);
-  return binding.lstat(pathModule._makeLong(path));
+  return toStats(binding.lstat(pathModule._makeLong(path), undefined,
+                               kShareStats));
 };
 
 fs.statSync = function(path) {
   nullCheck(path);
-  return binding.stat(pathModule._makeLong(path));
+  return toStats(binding.stat(pathModule._makeLong(path), undefined,
+                              kShareStats));
 };
 
 fs.readlink = function(path, callback) {
@@ -1092,28 +1270,18 @@ fs.futimesSync = function(fd, atime, mtime) {
   binding.futimes(fd, atime, mtime);
 };
 
-function writeAll(fd, buffer, offset, length, position, callback_) {
-  var callback = maybeCallback(arguments[arguments.length - 1]);
-
-  // write(fd, buffer, offset, length, position, callback)
-  fs.write(fd, buffer, offset, length, position, function(writeErr, written) {
-    if (writeErr) {
-      fs.close(fd, function() {
-        if (callback) callback(writeErr);
-      });
-    } else {
-      if (written === length) {
-        fs.close(fd, callback);
-      } else {
-        offset += written;
-        length -= written;
-        if (position !== null) {
-          position += written;
-        }
-        writeAll(fd, buffer, offset, length, position, callback);
-      }
-    }
-  });
+// Strings are encoded, the data written, synced if asked to and the file
+// closed in one go on the thread pool. options.atomic writes a temporary
+// file next to path and renames it over path once synced, so readers never
+// see a partial file; data may also be an array of Buffers.
+function writeFileData(data) {
+  if (data instanceof Buffer || typeof data === 'string')
+    return data;
+  if (Array.isArray(data) && data.every(function(chunk) {
+        return chunk instanceof Buffer;
+      }))
+    return data;
+  return '' + data;
 }
 
 fs.writeFile = function(path, data, options, callback_) {
@@ -1130,16 +1298,23 @@ fs.writeFile = function(path, data, options, callback_) {
   assertEncoding(options.encoding);
 
   var flag = options.flag || 'w';
-  fs.open(path, flag, options.mode, function(openErr, fd) {
-    if (openErr) {
-      if (callback) callback(openErr);
-    } else {
-      var buffer = (data instanceof Buffer) ? data : new Buffer('' + data,
-          options.encoding || 'utf8');
-      var position = /a/.test(flag) ? null : 0;
-      writeAll(fd, buffer, 0, buffer.length, position, callback);
-    }
-  });
+
+  if (!nullCheck(path, callback))
+    return;
+
+  var req = new FSReqWrap();
+  req.oncomplete = callback;
+
+  var append = /a/.test(flag);
+  binding.writeFile(pathModule._makeLong(path),
+                    writeFileData(data),
+                    options.encoding || 'utf8',
+                    stringToFlags(flag),
+                    modeNum(options.mode, 0o666),
+                    append ? null : 0,
+                    !!options.fsync,
+                    !append && !!options.atomic,
+                    req);
 };
 
 fs.writeFileSync = function(path, data, options) {
@@ -1154,25 +1329,94 @@ fs.writeFileSync = function(path, data, options) {
   assertEncoding(options.encoding);
 
   var flag = options.flag || 'w';
-  var fd = fs.openSync(path, flag, options.mode);
-  if (!(data instanceof Buffer)) {
-    data = new Buffer('' + data, options.encoding || 'utf8');
+
+  nullCheck(path);
+
+  var append = /a/.test(flag);
+  binding.writeFile(pathModule._makeLong(path),
+                    writeFileData(data),
+                    options.encoding || 'utf8',
+                    stringToFlags(flag),
+                    modeNum(options.mode, 0o666),
+                    append ? null : 0,
+                    !!options.fsync,
+                    !append && !!options.atomic);
+};
+
+// The copy runs in the kernel where possible, reports the bytes copied to
+// options.onProgress at most every options.progressInterval ms (100).
+fs.copyFile = function(src, dest, mode, callback) {
+  var options = {};
+
+  if (typeof mode === 'function') {
+    callback = mode;
+    mode = 0;
+  } else if (mode !== null && typeof mode === 'object') {
+    options = mode;
+    mode = options.mode;
   }
-  var offset = 0;
-  var length = data.length;
-  var position = /a/.test(flag) ? null : 0;
-  try {
-    while (length > 0) {
-      var written = fs.writeSync(fd, data, offset, length, position);
-      offset += written;
-      length -= written;
-      if (position !== null) {
-        position += written;
-      }
-    }
-  } finally {
-    fs.closeSync(fd);
+
+  callback = makeCallback(callback);
+  if (!nullCheck(src, callback)) return;
+  if (!nullCheck(dest, callback)) return;
+
+  var req = new FSReqWrap();
+  req.oncomplete = callback;
+
+  var interval = -1;
+  if (typeof options.onProgress === 'function') {
+    req.onprogress = options.onProgress;
+    interval = options.progressInterval === undefined ?
+               100 : Math.max(0, options.progressInterval | 0);
+  }
+
+  binding.copyFile(pathModule._makeLong(src),
+                   pathModule._makeLong(dest),
+                   mode | 0,
+                   interval,
+                   req);
+};
+
+fs.copyFileSync = function(src, dest, mode) {
+  nullCheck(src);
+  nullCheck(dest);
+  binding.copyFile(pathModule._makeLong(src),
+                   pathModule._makeLong(dest),
+                   mode | 0,
+                   -1);
+};
+
+// Memory mapped files, the Buffer reads and writes the file itself. Writes
+// to a mapping without PROT_WRITE stay in memory. The range is unmapped when
+// the Buffer and all its slices are collected, or right away by fs.munmap()
+// after which they read zeros.
+fs.PROT_READ = 1;
+fs.PROT_WRITE = 2;
+
+fs.mmap = function(fd, offset, length, prot) {
+  if (prot === undefined)
+    prot = fs.PROT_READ;
+  const buffer = binding.mmap(fd, +offset || 0, +length || 0,
+                              (prot & fs.PROT_WRITE) !== 0);
+  Object.setPrototypeOf(buffer, Buffer.prototype);
+  return buffer;
+};
+
+fs.msync = function(buffer, offset, length, async) {
+  binding.msync(buffer, offset | 0, length === undefined ? -1 : length | 0, !!async);
+};
+
+fs.madvise = function(buffer, offset, length, advice) {
+  if (typeof offset === 'string') {
+    advice = offset;
+    offset = 0;
+    length = undefined;
   }
+  binding.madvise(buffer, offset | 0, length === undefined ? -1 : length | 0, advice);
+};
+
+fs.munmap = function(buffer) {
+  binding.munmap(buffer);
 };
 
 fs.appendFile = function(path, data, options, callback_) {
@@ -1222,14 +1466,23 @@ function FSWatcher() {
       self.emit('change', event, filename);
     }
   };
+
+  // a batch of changes in the order they happened, with a debounce delay a
+  // file is in it once for each kind of change
+  this._handle.onchanges = function(filenames, events) {
+    for (var i = 0; i < filenames.length; i++)
+      self.emit('change', events[i], filenames[i]);
+    self.emit('changes', events, filenames);
+  };
 }
 util.inherits(FSWatcher, EventEmitter);
 
-FSWatcher.prototype.start = function(filename, persistent, recursive) {
+FSWatcher.prototype.start = function(filename, persistent, recursive, debounce) {
   nullCheck(filename);
   var err = this._handle.start(pathModule._makeLong(filename),
                                persistent,
-                               recursive);
+                               recursive,
+                               debounce | 0);
   if (err) {
     this._handle.close();
     const error = errnoException(err, `watch ${filename}`);
@@ -1260,7 +1513,8 @@ fs.watch = function(filename) {
   if (options.recursive === undefined) options.recursive = false;
 
   watcher = new FSWatcher();
-  watcher.start(filename, options.persistent, options.recursive);
+  watcher.start(filename, options.persistent, options.recursive,
+                options.debounce);
 
   if (listener) {
     watcher.addListener('change', listener);
@@ -1283,6 +1537,8 @@ function StatWatcher() {
   var oldStatus = -1;
 
   this._handle.onchange = function(current, previous, newStatus) {
+    current = toStats(current, 0);
+    previous = toStats(previous, 1);
     if (oldStatus === -1 &&
         newStatus === -1 &&
         current.nlink === previous.nlink) return;
@@ -1300,7 +1556,8 @@ util.inherits(StatWatcher, EventEmitter);
 
 StatWatcher.prototype.start = function(filename, persistent, interval) {
   nullCheck(filename);
-  this._handle.start(pathModule._makeLong(filename), persistent, interval);
+  this._handle.start(pathModule._makeLong(filename), persistent, interval,
+                     kShareStats);
 };
 
 
@@ -1366,21 +1623,9 @@ fs.unwatchFile = function(filename, listener) {
   }
 };
 
-// Regexp that finds the next partion of a (partial) path
-// result is [base_with_slash, base], e.g. ['somedir/', 'somedir']
-if (isWindows) {
-  var nextPartRe = /(.*?)(?:[\/\\]+|$)/g;
-} else {
-  var nextPartRe = /(.*?)(?:[\/]+|$)/g;
-}
-
-// Regex to find the device root, including trailing slash. E.g. 'c:\\'.
-if (isWindows) {
-  var splitRootRe = /^(?:[a-zA-Z]:|[\\\/]{2}[^\\\/]+[\\\/][^\\\/]+)?[\\\/]*/;
-} else {
-  var splitRootRe = /^[\/]*/;
-}
-
+// Resolved by realpath() of the platform. A cache object is looked up and
+// filled in as before, the cache native code shares with every context is
+// never used here.
 fs.realpathSync = function realpathSync(p, cache) {
   // make p is absolute
   p = pathModule.resolve(p);
@@ -1389,92 +1634,10 @@ fs.realpathSync = function realpathSync(p, cache) {
     return cache[p];
   }
 
-  const original = p;
-  const seenLinks = {};
-  const knownHard = {};
-
-  // current character position in p
-  var pos;
-  // the partial path so far, including a trailing slash if any
-  var current;
-  // the partial path without a trailing slash (except when pointing at a root)
-  var base;
-  // the partial path scanned in the previous round, with slash
-  var previous;
-
-  start();
-
-  function start() {
-    // Skip over roots
-    var m = splitRootRe.exec(p);
-    pos = m[0].length;
-    current = m[0];
-    base = m[0];
-    previous = '';
-
-    // On windows, check that the root exists. On unix there is no need.
-    if (isWindows && !knownHard[base]) {
-      fs.lstatSync(base);
-      knownHard[base] = true;
-    }
-  }
-
-  // walk down the path, swapping out linked pathparts for their real
-  // values
-  // NB: p.length changes.
-  while (pos < p.length) {
-    // find the next part
-    nextPartRe.lastIndex = pos;
-    var result = nextPartRe.exec(p);
-    previous = current;
-    current += result[0];
-    base = previous + result[1];
-    pos = nextPartRe.lastIndex;
-
-    // continue if not a symlink
-    if (knownHard[base] || (cache && cache[base] === base)) {
-      continue;
-    }
-
-    var resolvedLink;
-    if (cache && Object.prototype.hasOwnProperty.call(cache, base)) {
-      // some known symbolic link.  no need to stat again.
-      resolvedLink = cache[base];
-    } else {
-      var stat = fs.lstatSync(base);
-      if (!stat.isSymbolicLink()) {
-        knownHard[base] = true;
-        if (cache) cache[base] = base;
-        continue;
-      }
-
-      // read the link if it wasn't read before
-      // dev/ino always return 0 on windows, so skip the check.
-      var linkTarget = null;
-      if (!isWindows) {
-        var id = stat.dev.toString(32) + ':' + stat.ino.toString(32);
-        if (seenLinks.hasOwnProperty(id)) {
-          linkTarget = seenLinks[id];
-        }
-      }
-      if (linkTarget === null) {
-        fs.statSync(base);
-        linkTarget = fs.readlinkSync(base);
-      }
-      resolvedLink = pathModule.resolve(previous, linkTarget);
-      // track this, if given a cache.
-      if (cache) cache[base] = resolvedLink;
-      if (!isWindows) seenLinks[id] = linkTarget;
-    }
-
-    // resolve the link, then start over
-    p = pathModule.resolve(resolvedLink, p.slice(pos));
-    start();
-  }
-
-  if (cache) cache[original] = p;
-
-  return p;
+  nullCheck(p);
+  const real = binding.realpath(pathModule._makeLong(p), false);
+  if (cache) cache[p] = real;
+  return real;
 };
 
 
@@ -1491,113 +1654,14 @@ fs.realpath = function realpath(p, cache, cb) {
     return process.nextTick(cb.bind(null, null, cache[p]));
   }
 
-  const original = p;
-  const seenLinks = {};
-  const knownHard = {};
-
-  // current character position in p
-  var pos;
-  // the partial path so far, including a trailing slash if any
-  var current;
-  // the partial path without a trailing slash (except when pointing at a root)
-  var base;
-  // the partial path scanned in the previous round, with slash
-  var previous;
-
-  start();
-
-  function start() {
-    // Skip over roots
-    var m = splitRootRe.exec(p);
-    pos = m[0].length;
-    current = m[0];
-    base = m[0];
-    previous = '';
-
-    // On windows, check that the root exists. On unix there is no need.
-    if (isWindows && !knownHard[base]) {
-      fs.lstat(base, function(err) {
-        if (err) return cb(err);
-        knownHard[base] = true;
-        LOOP();
-      });
-    } else {
-      process.nextTick(LOOP);
-    }
-  }
-
-  // walk down the path, swapping out linked pathparts for their real
-  // values
-  function LOOP() {
-    // stop if scanned past end of path
-    if (pos >= p.length) {
-      if (cache) cache[original] = p;
-      return cb(null, p);
-    }
-
-    // find the next part
-    nextPartRe.lastIndex = pos;
-    var result = nextPartRe.exec(p);
-    previous = current;
-    current += result[0];
-    base = previous + result[1];
-    pos = nextPartRe.lastIndex;
-
-    // continue if not a symlink
-    if (knownHard[base] || (cache && cache[base] === base)) {
-      return process.nextTick(LOOP);
-    }
-
-    if (cache && Object.prototype.hasOwnProperty.call(cache, base)) {
-      // known symbolic link.  no need to stat again.
-      return gotResolvedLink(cache[base]);
-    }
-
-    return fs.lstat(base, gotStat);
-  }
-
-  function gotStat(err, stat) {
-    if (err) return cb(err);
-
-    // if not a symlink, skip to the next path part
-    if (!stat.isSymbolicLink()) {
-      knownHard[base] = true;
-      if (cache) cache[base] = base;
-      return process.nextTick(LOOP);
-    }
-
-    // stat & read the link if not read before
-    // call gotTarget as soon as the link target is known
-    // dev/ino always return 0 on windows, so skip the check.
-    if (!isWindows) {
-      var id = stat.dev.toString(32) + ':' + stat.ino.toString(32);
-      if (seenLinks.hasOwnProperty(id)) {
-        return gotTarget(null, seenLinks[id], base);
-      }
-    }
-    fs.stat(base, function(err) {
-      if (err) return cb(err);
-
-      fs.readlink(base, function(err, target) {
-        if (!isWindows) seenLinks[id] = target;
-        gotTarget(err, target);
-      });
-    });
-  }
-
-  function gotTarget(err, target, base) {
+  if (!nullCheck(p, cb)) return;
+  var req = new FSReqWrap();
+  req.oncomplete = function(err, real) {
     if (err) return cb(err);
-
-    var resolvedLink = pathModule.resolve(previous, target);
-    if (cache) cache[base] = resolvedLink;
-    gotResolvedLink(resolvedLink);
-  }
-
-  function gotResolvedLink(resolvedLink) {
-    // resolve the link, then start over
-    p = pathModule.resolve(resolvedLink, p.slice(pos));
-    start();
-  }
+    if (cache) cache[p] = real;
+    cb(null, real);
+  };
+  binding.realpath(pathModule._makeLong(p), false, req);
 };
 
 
@@ -11,6 +11,8 @@ const fs = require('fs');
 const path = require('path');
 const internalModuleReadFile = process.binding('fs').internalModuleReadFile;
 const internalModuleStat = process.binding('fs').internalModuleStat;
+const internalModuleResolve = process.binding('fs').internalModuleResolve;
+const internalRealPath = process.binding('fs').realpath;
 
 const splitRe = process.platform === 'win32' ? /[\/\\]/ : /\//;
 const isIndexRe = /^index\.\w+?$/;
@@ -98,19 +100,36 @@ function tryPackage(requestPath, exts) {
          tryExtensions(path.resolve(filename, 'index'), exts);
 }
 
-// In order to minimize unnecessary lstat() calls,
-// this cache is a list of known-real paths.
-// Set to an empty object to reset.
+// Real paths of this context, dropped with it on a page reload.
 Module._realpathCache = {};
 
+// Also look real paths up in the cache native code shares with every
+// context. Only fs watchers and fs.invalidateResolverCache() drop its
+// entries, so a symlink swapped by another process stays stale until then.
+Module._sharedRealpathCache = false;
+
+// Resolve paths with the native resolver, which shares its stat() and
+// package.json cache with every context. Set to false to use the JS one.
+Module._nativeResolver = true;
+
 // check if the file exists and is not a directory
 function tryFile(requestPath) {
   const rc = internalModuleStat(path._makeLong(requestPath));
   return rc === 0 && toRealPath(requestPath);
 }
 
+// packs (*.ncpk) hold no links, and realpath() can't look into them
+const kArchivePath = /\.ncpk(?:[\/\\]|$)/;
+
 function toRealPath(requestPath) {
-  return fs.realpathSync(requestPath, Module._realpathCache);
+  requestPath = path.resolve(requestPath);
+  if (kArchivePath.test(requestPath))
+    return requestPath;
+  const cache = Module._realpathCache;
+  if (Object.prototype.hasOwnProperty.call(cache, requestPath))
+    return cache[requestPath];
+  return cache[requestPath] = internalRealPath(path._makeLong(requestPath),
+                                               !!Module._sharedRealpathCache);
 }
 
 // given a path check a the file exists with any of the set extensions
@@ -139,8 +158,23 @@ Module._findPath = function(request, paths) {
   const exts = Object.keys(Module._extensions);
   const trailingSlash = request.slice(-1) === '/';
 
+  var i, PL;
+
+  if (Module._nativeResolver) {
+    var bases = [];
+    for (i = 0, PL = paths.length; i < PL; i++)
+      bases.push(path.resolve(paths[i], request));
+
+    // undefined leaves package.json files it can't handle to the JS one
+    var found = internalModuleResolve(paths, bases, exts, trailingSlash);
+    if (found === false)
+      return false;
+    if (found !== undefined)
+      return cacheFoundPath(request, cacheKey, toRealPath(found[0]), found[1]);
+  }
+
   // For each path
-  for (var i = 0, PL = paths.length; i < PL; i++) {
+  for (i = 0, PL = paths.length; i < PL; i++) {
     // Don't search further if path doesn't exist
     if (paths[i] && internalModuleStat(path._makeLong(paths[i])) < 1) continue;
     var basePath = path.resolve(paths[i], request);
@@ -170,21 +204,25 @@ Module._findPath = function(request, paths) {
     }
 
     if (filename) {
-      // Warn once if '.' resolved outside the module dir
-      if (request === '.' && i > 0) {
-        warned = internalUtil.printDeprecationMessage(
-          'warning: require(\'.\') resolved outside the package ' +
-          'directory. This functionality is deprecated and will be removed ' +
-          'soon.', warned);
-      }
-
-      Module._pathCache[cacheKey] = filename;
-      return filename;
+      return cacheFoundPath(request, cacheKey, filename, i);
     }
   }
   return false;
 };
 
+function cacheFoundPath(request, cacheKey, filename, index) {
+  // Warn once if '.' resolved outside the module dir
+  if (request === '.' && index > 0) {
+    warned = internalUtil.printDeprecationMessage(
+      'warning: require(\'.\') resolved outside the package ' +
+      'directory. This functionality is deprecated and will be removed ' +
+      'soon.', warned);
+  }
+
+  Module._pathCache[cacheKey] = filename;
+  return filename;
+}
+
 // 'from' is the __dirname of the module.
 Module._nodeModulePaths = function(from) {
   // guarantee that 'from' is absolute.
@@ -413,16 +451,21 @@ Module.prototype._compile = function(content, filename) {
 
 // Native extension for .js
 Module._extensions['.js'] = function(module, filename) {
-  var content = fs.readFileSync(filename, 'utf8');
-  module._compile(internalModule.stripBOM(content), filename);
+  // Shared by every frame, fs.readFileSync() reports the errors.
+  var content = internalModuleReadFile(path._makeLong(filename));
+  if (content === undefined)
+    content = internalModule.stripBOM(fs.readFileSync(filename, 'utf8'));
+  module._compile(content, filename);
 };
 
 
 // Native extension for .json
 Module._extensions['.json'] = function(module, filename) {
-  var content = fs.readFileSync(filename, 'utf8');
+  var content = internalModuleReadFile(path._makeLong(filename));
+  if (content === undefined)
+    content = internalModule.stripBOM(fs.readFileSync(filename, 'utf8'));
   try {
-    module.exports = JSON.parse(internalModule.stripBOM(content));
+    module.exports = JSON.parse(content);
   } catch (err) {
     err.message = filename + ': ' + err.message;
     throw err;
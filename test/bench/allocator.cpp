@@ -0,0 +1,215 @@
+/***************************************************************
+ * Name:      allocator.cpp
+ * Purpose:   Throughput Benchmark for the Buffer Allocator
+ * Author:    Joshua GPBeta (studiocghibli@gmail.com)
+ * Created:   2016-08-08
+ * Copyright: Studio GPBeta (www.gpbeta.com)
+ * License:
+ **************************************************************/
+
+/// ============================================================================
+/// declarations
+/// ============================================================================
+
+// Standalone program, build it with the same include paths as libcef_node:
+//
+//   cl /O2 /EHsc /I include test\bench\allocator.cpp src\Allocator.cpp libuv.lib ...
+//   g++ -O2 -I include test/bench/allocator.cpp src/Allocator.cpp -luv -lpthread
+//
+// Usage: allocator [operations per thread]
+//
+// Every thread keeps a window of live blocks, replacing the oldest one with
+// a new block of random size (mostly below 1 KB, some up to 16 KB and a few
+// of 64 KB like fs streams read), and checks the content of every block it
+// frees. Reports million allocations per second for plain malloc() and for
+// every allocator mode, and the fragmentation the mode left behind.
+
+/// ----------------------------------------------------------------------------
+/// headers
+/// ----------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "ncjs/Allocator.h"
+
+#include <uv.h>
+
+#include <vector>
+
+using namespace ncjs;
+
+/// ----------------------------------------------------------------------------
+/// variables
+/// ----------------------------------------------------------------------------
+
+static const unsigned THREADS[] = { 1, 2, 4, 8 };
+static const size_t WINDOW = 256;
+
+enum Backend { MALLOC, SYSTEM, SLAB, BACKEND_COUNT };
+
+struct Worker {
+    uv_thread_t thread;
+    Backend backend;
+    size_t operations;
+    unsigned seed;
+    bool failed;
+};
+
+/// ============================================================================
+/// implementation
+/// ============================================================================
+
+static inline unsigned Random(unsigned& seed)
+{
+    seed = seed * 1103515245 + 12345;
+    return seed >> 8;
+}
+
+static inline size_t RandomSize(unsigned& seed)
+{
+    const unsigned r = Random(seed) % 100;
+
+    if (r < 70)
+        return 1 + Random(seed) % 1024;
+    if (r < 95)
+        return 1024 + Random(seed) % (15 * 1024);
+    return 65536;
+}
+
+static void* Allocate(Backend backend, size_t size)
+{
+    return backend == MALLOC ? malloc(size) : Allocator::Allocate(size);
+}
+
+static void Free(Backend backend, void* data)
+{
+    if (backend == MALLOC)
+        free(data);
+    else
+        Allocator::Free(data);
+}
+
+static void Run(void* arg)
+{
+    Worker* worker = static_cast<Worker*>(arg);
+    std::vector<unsigned char*> blocks(WINDOW);
+    std::vector<size_t> sizes(WINDOW);
+
+    for (size_t i = 0; i < worker->operations + WINDOW; ++i) {
+        const size_t slot = i % WINDOW;
+        unsigned char* block = blocks[slot];
+
+        if (block) {
+            const unsigned char tag = static_cast<unsigned char>(sizes[slot]);
+            // first and last bytes are enough to catch overlapping blocks
+            if (block[0] != tag || block[sizes[slot] - 1] != tag)
+                worker->failed = true;
+            Free(worker->backend, block);
+            blocks[slot] = NULL;
+        }
+
+        if (i >= worker->operations)
+            continue;
+
+        const size_t size = RandomSize(worker->seed);
+
+        if (!(block = static_cast<unsigned char*>(Allocate(worker->backend, size)))) {
+            worker->failed = true;
+            continue;
+        }
+
+        const unsigned char tag = static_cast<unsigned char>(size);
+        block[0] = block[size - 1] = tag;
+        blocks[slot] = block;
+        sizes[slot] = size;
+    }
+}
+
+// returns million allocations per second, 0 on errors
+static double Measure(Backend backend, unsigned threads, size_t operations)
+{
+    std::vector<Worker> workers(threads);
+
+    if (backend != MALLOC)
+        Allocator::Initialize(backend == SLAB ? Allocator::SLAB : Allocator::SYSTEM);
+
+    const uint64_t start = uv_hrtime();
+
+    for (unsigned i = 0; i < threads; ++i) {
+        Worker& worker = workers[i];
+        worker.backend = backend;
+        worker.operations = operations;
+        worker.seed = i + 1;
+        worker.failed = false;
+        uv_thread_create(&worker.thread, Run, &worker);
+    }
+
+    bool failed = false;
+
+    for (unsigned i = 0; i < threads; ++i) {
+        uv_thread_join(&workers[i].thread);
+        failed = failed || workers[i].failed;
+    }
+
+    const double elapsed = double(uv_hrtime() - start) / 1e9;
+
+    return failed ? 0 : double(operations) * threads / elapsed / 1e6;
+}
+
+// fraction of the reserved memory not asked for, at the peak of the run
+static double Fragmentation(size_t peakRequested)
+{
+    double reserved = 0;
+
+    for (unsigned cls = 0; cls < Allocator::GetClassCount(); ++cls) {
+        Allocator::Stats stats;
+        Allocator::GetStats(cls, stats);
+        reserved += stats.reserved;
+    }
+
+    return reserved ? 1 - double(peakRequested) / reserved : 0;
+}
+
+int main(int argc, char* argv[])
+{
+    const size_t operations = size_t(argc > 1 ? atoi(argv[1]) : 1000000);
+    const char* names[] = { "malloc", "system", "slab" };
+
+    printf("%-8s %8s %14s\n", "backend", "threads", "M allocs/s");
+
+    for (int backend = MALLOC; backend < BACKEND_COUNT; ++backend) {
+        for (size_t t = 0; t < sizeof(THREADS) / sizeof(THREADS[0]); ++t) {
+            const double rate = Measure(Backend(backend), THREADS[t], operations);
+
+            if (rate == 0) {
+                printf("%s: corrupted or failed allocation\n", names[backend]);
+                return 1;
+            }
+
+            printf("%-8s %8u %14.2f\n", names[backend], THREADS[t], rate);
+        }
+    }
+
+    // every block has been freed, keep a window alive to look at the slabs
+    Allocator::Initialize(Allocator::SLAB);
+
+    unsigned seed = 1;
+    size_t requested = 0;
+    std::vector<void*> blocks(WINDOW * 8);
+
+    for (size_t i = 0; i < blocks.size(); ++i) {
+        const size_t size = RandomSize(seed);
+        blocks[i] = Allocator::Allocate(size);
+        requested += size;
+    }
+
+    printf("\nslab fragmentation with %u live blocks: %.1f%%\n",
+           unsigned(blocks.size()), Fragmentation(requested) * 100);
+
+    for (size_t i = 0; i < blocks.size(); ++i)
+        Allocator::Free(blocks[i]);
+
+    return 0;
+}
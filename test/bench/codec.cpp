@@ -0,0 +1,191 @@
+/***************************************************************
+ * Name:      codec.cpp
+ * Purpose:   Throughput Benchmark for the Buffer Codecs
+ * Author:    Joshua GPBeta (studiocghibli@gmail.com)
+ * Created:   2016-08-07
+ * Copyright: Studio GPBeta (www.gpbeta.com)
+ * License:
+ **************************************************************/
+
+/// ============================================================================
+/// declarations
+/// ============================================================================
+
+// Standalone program, build it with the same include paths as libcef_node:
+//
+//   cl /O2 /EHsc /I include test\bench\codec.cpp src\Codec.cpp libuv.lib ...
+//   g++ -O2 -I include test/bench/codec.cpp src/Codec.cpp -luv -lpthread
+//
+// Usage: codec [MB per run]
+//
+// Reports MB/s of binary data converted to and from UTF-16 strings for
+// every implementation the CPU supports, per encoding and size bucket, and
+// checks that every implementation produces the scalar output. The utf8
+// input is ASCII text with a two byte character every 64 bytes, utf8-cjk
+// is made of three byte characters.
+
+/// ----------------------------------------------------------------------------
+/// headers
+/// ----------------------------------------------------------------------------
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "ncjs/Codec.h"
+
+#include <uv.h>
+
+#include <vector>
+
+using namespace ncjs;
+
+typedef Codec::char16 char16;
+
+/// ----------------------------------------------------------------------------
+/// variables
+/// ----------------------------------------------------------------------------
+
+static const size_t BUCKETS[] = { 16, 256, 4096, 65536, 1048576 };
+
+enum Encoding { HEX, BASE64, UTF8, UTF8_CJK, ENCODING_COUNT };
+
+/// ============================================================================
+/// implementation
+/// ============================================================================
+
+static void Fill(Encoding enc, std::vector<char>& bin)
+{
+    const size_t len = bin.size();
+
+    for (size_t i = 0; i < len; ++i) {
+        switch (enc) {
+        case UTF8:
+            if (i % 64 == 62 && i + 1 < len) {
+                bin[i++] = char(0xc3); // U+00E9
+                bin[i] = char(0xa9);
+            } else {
+                bin[i] = char(' ' + rand() % 95);
+            }
+            break;
+        case UTF8_CJK:
+            if (i + 2 < len) {
+                bin[i++] = char(0xe4); // U+4E2D
+                bin[i++] = char(0xb8);
+                bin[i] = char(0xad);
+            } else {
+                bin[i] = 'a';
+            }
+            break;
+        default:
+            bin[i] = char(rand());
+            break;
+        }
+    }
+}
+
+// binary to string, returns the string length
+static size_t Encode(Encoding enc, const std::vector<char>& src, std::vector<char16>& dst)
+{
+    switch (enc) {
+    case HEX:
+        dst.resize(src.size() * 2);
+        Codec::HexEncode(&src[0], src.size(), &dst[0]);
+        return dst.size();
+    case BASE64:
+        dst.resize(Codec::Base64EncodedSize(src.size()));
+        Codec::Base64Encode(&src[0], src.size(), &dst[0]);
+        return dst.size();
+    default:
+        dst.resize(src.size());
+        dst.resize(Codec::Utf8Decode(&src[0], src.size(), &dst[0]));
+        return dst.size();
+    }
+}
+
+// string to binary, returns the number of bytes
+static size_t Decode(Encoding enc, const std::vector<char16>& src, size_t len, std::vector<char>& dst)
+{
+    switch (enc) {
+    case HEX:
+        return Codec::HexDecode(&src[0], len, &dst[0]);
+    case BASE64:
+        return Codec::Base64Decode(&src[0], len, &dst[0], dst.size());
+    default:
+        return Codec::Utf8Encode(&src[0], len, &dst[0], Codec::Utf8Length(&src[0], len));
+    }
+}
+
+// returns MB/s of binary data
+static double Measure(Encoding enc, bool decode, size_t len, size_t total)
+{
+    std::vector<char> bin(len);
+    std::vector<char16> str;
+
+    Fill(enc, bin);
+
+    const size_t strLen = Encode(enc, bin, str);
+
+    const size_t rounds = total / len + 1;
+    const uint64_t start = uv_hrtime();
+
+    for (size_t r = 0; r < rounds; ++r) {
+        if (decode)
+            Decode(enc, str, strLen, bin);
+        else
+            Encode(enc, bin, str);
+    }
+
+    const double elapsed = double(uv_hrtime() - start) / 1e9;
+
+    return double(len) * rounds / elapsed / 1048576;
+}
+
+static bool Verify(Encoding enc, size_t len)
+{
+    std::vector<char> bin(len), out(len);
+    std::vector<char16> str, ref;
+
+    Fill(enc, bin);
+
+    const Codec::Level level = Codec::GetLevel();
+
+    Codec::SetLevel(Codec::SCALAR);
+    const size_t refLen = Encode(enc, bin, ref);
+
+    Codec::SetLevel(level);
+    const size_t strLen = Encode(enc, bin, str);
+
+    return strLen == refLen && str == ref && Decode(enc, str, strLen, out) == len && out == bin;
+}
+
+int main(int argc, char* argv[])
+{
+    const size_t total = size_t(argc > 1 ? atoi(argv[1]) : 64) * 1048576;
+    const char* names[] = { "hex", "base64", "utf8", "utf8-cjk" };
+
+    printf("%-8s %-8s %10s %16s %16s\n", "codec", "level", "bytes", "to string (MB/s)", "to bytes (MB/s)");
+
+    for (int enc = HEX; enc < ENCODING_COUNT; ++enc) {
+        for (int lvl = Codec::SCALAR; lvl <= Codec::GetSupportedLevel(); ++lvl) {
+            Codec::SetLevel(Codec::Level(lvl));
+
+            for (size_t b = 0; b < sizeof(BUCKETS) / sizeof(BUCKETS[0]); ++b) {
+                const size_t len = BUCKETS[b];
+
+                if (!Verify(Encoding(enc), len + 7)) {
+                    printf("%s %s: output mismatch\n", names[enc], Codec::GetLevelName(Codec::Level(lvl)));
+                    return 1;
+                }
+
+                printf("%-8s %-8s %10u %16.1f %16.1f\n", names[enc],
+                       Codec::GetLevelName(Codec::Level(lvl)), unsigned(len),
+                       Measure(Encoding(enc), false, len, total),
+                       Measure(Encoding(enc), true, len, total));
+            }
+        }
+    }
+
+    return 0;
+}
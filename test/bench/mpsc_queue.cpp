@@ -0,0 +1,214 @@
+
+/***************************************************************
+ * Name:      mpsc_queue.cpp
+ * Purpose:   Enqueue Throughput Benchmark for the Event Loop Queue
+ * Author:    Joshua GPBeta (studiocghibli@gmail.com)
+ * Created:   2016-08-02
+ * Copyright: Studio GPBeta (www.gpbeta.com)
+ * License:
+ **************************************************************/
+
+/// ============================================================================
+/// declarations
+/// ============================================================================
+
+// Standalone program, build it with the same include paths as libcef_node:
+//
+//   cl /O2 /EHsc /I include /I <cef> test\bench\mpsc_queue.cpp libuv.lib ...
+//   g++ -O2 -I include -I <cef> test/bench/mpsc_queue.cpp -luv -lpthread
+//
+// Usage: mpsc_queue [max producers] [tasks per producer]
+//
+// Compares the lock-free ring used by EventLoopImpl::Queue() with the
+// previous mutex + std::vector swap queue, for 1..N producer threads and
+// one consumer thread.
+
+/// ----------------------------------------------------------------------------
+/// headers
+/// ----------------------------------------------------------------------------
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "ncjs/MpscQueue.h"
+
+#include <uv.h>
+
+#include <vector>
+
+#ifdef _WIN32
+#include <windows.h>
+#define YIELD() SwitchToThread()
+#else
+#include <sched.h>
+#define YIELD() sched_yield()
+#endif
+
+using namespace ncjs;
+
+/// ----------------------------------------------------------------------------
+/// variables
+/// ----------------------------------------------------------------------------
+
+static const unsigned QUEUE_CAPACITY = 1 << 12;
+
+struct Context {
+    unsigned producers;
+    unsigned tasks;
+    volatile atomic::Word started;
+    volatile atomic::Word consumed;
+};
+
+/// ============================================================================
+/// implementation
+/// ============================================================================
+
+/// ----------------------------------------------------------------------------
+/// RingQueue
+/// ----------------------------------------------------------------------------
+
+class RingQueue {
+public:
+
+    void Push(unsigned value)
+    {
+        while (!m_queue.Push(value))
+            YIELD(); // full, let the consumer drain
+    }
+
+    unsigned Drain()
+    {
+        unsigned value, n = 0;
+        while (m_queue.Pop(value))
+            ++n;
+        return n;
+    }
+
+    RingQueue() : m_queue(QUEUE_CAPACITY) {}
+
+private:
+
+    MpscQueue<unsigned> m_queue;
+};
+
+/// ----------------------------------------------------------------------------
+/// LockedQueue
+/// ----------------------------------------------------------------------------
+
+class LockedQueue {
+public:
+
+    void Push(unsigned value)
+    {
+        uv_mutex_lock(&m_mutex);
+        m_queue.push_back(value);
+        uv_mutex_unlock(&m_mutex);
+    }
+
+    unsigned Drain()
+    {
+        std::vector<unsigned> queue;
+
+        uv_mutex_lock(&m_mutex);
+        queue.swap(m_queue);
+        uv_mutex_unlock(&m_mutex);
+
+        return unsigned(queue.size());
+    }
+
+    LockedQueue() { uv_mutex_init(&m_mutex); }
+    ~LockedQueue() { uv_mutex_destroy(&m_mutex); }
+
+private:
+
+    uv_mutex_t m_mutex;
+    std::vector<unsigned> m_queue;
+};
+
+/// ----------------------------------------------------------------------------
+/// threads
+/// ----------------------------------------------------------------------------
+
+template <class Q>
+struct Bench {
+    Context* context;
+    Q queue;
+
+    static void Producer(void* arg)
+    {
+        Bench* bench = static_cast<Bench*>(arg);
+        Context* ctx = bench->context;
+
+        atomic::Increment(&ctx->started);
+        while (atomic::Load(&ctx->started) < atomic::Word(ctx->producers))
+            YIELD(); // start together
+
+        for (unsigned i = 0; i < ctx->tasks; ++i)
+            bench->queue.Push(i);
+    }
+
+    static void Consumer(void* arg)
+    {
+        Bench* bench = static_cast<Bench*>(arg);
+        Context* ctx = bench->context;
+
+        const atomic::Word total = atomic::Word(ctx->producers * ctx->tasks);
+        atomic::Word consumed = 0;
+
+        while (consumed < total) {
+            if (const unsigned n = bench->queue.Drain())
+                consumed += n;
+            else
+                YIELD();
+        }
+
+        atomic::Store(&ctx->consumed, consumed);
+    }
+};
+
+template <class Q>
+static double Run(unsigned producers, unsigned tasks)
+{
+    Context ctx = { producers, tasks, 0, 0 };
+    Bench<Q>* bench = new Bench<Q>;
+    bench->context = &ctx;
+
+    std::vector<uv_thread_t> threads(producers);
+    uv_thread_t consumer;
+
+    const uint64_t start = uv_hrtime();
+
+    uv_thread_create(&consumer, &Bench<Q>::Consumer, bench);
+    for (unsigned i = 0; i < producers; ++i)
+        uv_thread_create(&threads[i], &Bench<Q>::Producer, bench);
+
+    for (unsigned i = 0; i < producers; ++i)
+        uv_thread_join(&threads[i]);
+    uv_thread_join(&consumer);
+
+    const double elapsed = double(uv_hrtime() - start) / 1e9;
+
+    delete bench;
+
+    assert(ctx.consumed == atomic::Word(producers * tasks));
+
+    return double(producers) * tasks / elapsed;
+}
+
+int main(int argc, char* argv[])
+{
+    const unsigned maxProducers = argc > 1 ? unsigned(atoi(argv[1])) : 8;
+    const unsigned tasks = argc > 2 ? unsigned(atoi(argv[2])) : 1000000;
+
+    printf("%10s %16s %16s %8s\n", "producers", "mutex (ops/s)", "ring (ops/s)", "speedup");
+
+    for (unsigned n = 1; n <= maxProducers; ++n) {
+        const double locked = Run<LockedQueue>(n, tasks);
+        const double ring = Run<RingQueue>(n, tasks);
+
+        printf("%10u %16.0f %16.0f %7.2fx\n", n, locked, ring, ring / locked);
+    }
+
+    return 0;
+}
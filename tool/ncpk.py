@@ -0,0 +1,154 @@
+#!/usr/bin/env python
+#
+# Packs a directory of modules into a Node-CEF archive (*.ncpk), which is
+# mapped into memory when a path goes through it, for example
+#
+#   python tool/ncpk.py -c app.ncpk app
+#   require('./app.ncpk/index.js')
+#
+# Layout, all numbers are little endian unsigned 32-bit integers:
+#
+#   header   'NCJSPACK', version, count, namesOffset, namesSize, dataOffset, 0
+#   entries  count * (nameOffset, nameLength, flags, offset, stored, size)
+#   names    relative paths separated by '/', sorted byte by byte
+#   data     contents of the files, offsets relative to dataOffset
+#
+# flags: 1 for directories, 2 for files stored as LZ4 blocks (-c).
+
+import os
+import struct
+import sys
+
+MAGIC = b'NCJSPACK'
+VERSION = 1
+
+FLAG_DIRECTORY = 1
+FLAG_LZ4 = 2
+
+HEADER = struct.Struct('<8s6I')
+ENTRY = struct.Struct('<6I')
+
+
+def lz4_length(out, n):
+  while n >= 255:
+    out.append(255)
+    n -= 255
+  out.append(n)
+
+
+def lz4_sequence(out, data, anchor, end, offset, length):
+  literals = end - anchor
+  token = min(literals, 15) << 4
+  if offset:
+    token |= min(length - 4, 15)
+  out.append(token)
+  if literals >= 15:
+    lz4_length(out, literals - 15)
+  out += data[anchor:end]
+  if offset:
+    out += struct.pack('<H', offset)
+    if length - 4 >= 15:
+      lz4_length(out, length - 4 - 15)
+
+
+def lz4_compress(data):
+  """Greedy LZ4 block compression, good enough for sources."""
+  out = bytearray()
+  table = {}
+  size = len(data)
+  # the last match has to start 12 bytes before the end and the
+  # last 5 bytes are always literals
+  limit = size - 12
+  anchor = 0
+  i = 0
+  while i < limit:
+    key = data[i:i + 4]
+    candidate = table.get(key)
+    table[key] = i
+    if candidate is None or i - candidate > 0xffff:
+      i += 1
+      continue
+    length = 4
+    while i + length < size - 5 and data[candidate + length] == data[i + length]:
+      length += 1
+    lz4_sequence(out, data, anchor, i, i - candidate, length)
+    i += length
+    anchor = i
+  lz4_sequence(out, data, anchor, size, 0, 0)
+  return bytes(out)
+
+
+def collect(root):
+  entries = []
+  for path, dirs, files in os.walk(root):
+    dirs.sort()
+    rel = os.path.relpath(path, root)
+    for name in dirs:
+      entries.append((os.path.join(rel, name), None))
+    for name in files:
+      entries.append((os.path.join(rel, name), os.path.join(path, name)))
+  result = []
+  for name, path in entries:
+    name = os.path.normpath(name).replace(os.sep, '/')
+    result.append((name.encode('utf-8'), path))
+  result.sort()
+  return result
+
+
+def pack(archive, root, compress):
+  entries = collect(root)
+  names = bytearray()
+  data = bytearray()
+  index = []
+
+  for name, path in entries:
+    flags = offset = stored = size = 0
+    if path is None:
+      flags = FLAG_DIRECTORY
+    else:
+      with open(path, 'rb') as f:
+        content = f.read()
+      size = len(content)
+      if compress and size > 64:
+        packed = lz4_compress(content)
+        if len(packed) < size - size // 8:
+          content = packed
+          flags = FLAG_LZ4
+      offset = len(data)
+      stored = len(content)
+      data += content
+    index.append(ENTRY.pack(len(names), len(name), flags, offset, stored, size))
+    names += name
+
+  names_offset = HEADER.size + ENTRY.size * len(index)
+  data_offset = names_offset + len(names)
+  # keeps the data aligned for the mapping
+  padding = (8 - data_offset % 8) % 8
+  data_offset += padding
+
+  with open(archive, 'wb') as f:
+    f.write(HEADER.pack(MAGIC, VERSION, len(index), names_offset,
+                        len(names), data_offset, 0))
+    for entry in index:
+      f.write(entry)
+    f.write(names)
+    f.write(b'\0' * padding)
+    f.write(data)
+
+  return len(index), data_offset + len(data)
+
+
+def main():
+  args = sys.argv[1:]
+  compress = '-c' in args
+  args = [arg for arg in args if arg != '-c']
+  if len(args) != 2 or not os.path.isdir(args[1]):
+    sys.stderr.write('usage: ncpk.py [-c] <archive.ncpk> <directory>\n')
+    return 1
+  count, size = pack(args[0], args[1], compress)
+  print('%s: %d entries, %d bytes' % (args[0], count, size))
+  return 0
+
+
+if __name__ == '__main__':
+  sys.exit(main())